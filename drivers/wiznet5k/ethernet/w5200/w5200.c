@@ -133,12 +133,38 @@ void WIZCHIP_WRITE_BUF(uint32_t AddrSel, uint8_t* pBuf, uint16_t len) {
     WIZCHIP_CRITICAL_EXIT();
 }
 
+uint16_t WIZCHIP_READ_WORD(uint32_t AddrSel) {
+    uint8_t buf[2];
+    WIZCHIP_READ_BUF(AddrSel, buf, 2);
+    return (buf[0] << 8) | buf[1];
+}
+
+void WIZCHIP_WRITE_WORD(uint32_t AddrSel, uint16_t w) {
+    WIZCHIP_CRITICAL_ENTER();
+    WIZCHIP.CS._select();
+
+    uint8_t spi_data[6] = {
+        AddrSel >> 8,
+        AddrSel,
+        0x80,
+        0x02,
+        w >> 8,
+        w,
+    };
+    WIZCHIP.IF.SPI._write_bytes(spi_data, 6);
+
+    WIZCHIP.CS._deselect();
+    WIZCHIP_CRITICAL_EXIT();
+}
+
+// The chip may update these registers between the two bytes, so read them
+// until two reads agree.  Each read is a single burst of both bytes.
 uint16_t getSn_TX_FSR(uint8_t sn) {
     uint16_t val = 0, val1 = 0;
     do {
-        val1 = (WIZCHIP_READ(Sn_TX_FSR(sn)) << 8) | WIZCHIP_READ(Sn_TX_FSR(sn) + 1);
+        val1 = WIZCHIP_READ_WORD(Sn_TX_FSR(sn));
         if (val1 != 0) {
-            val = (WIZCHIP_READ(Sn_TX_FSR(sn)) << 8) | WIZCHIP_READ(Sn_TX_FSR(sn) + 1);
+            val = WIZCHIP_READ_WORD(Sn_TX_FSR(sn));
         }
     } while (val != val1);
     return val;
@@ -147,9 +173,9 @@ uint16_t getSn_TX_FSR(uint8_t sn) {
 uint16_t getSn_RX_RSR(uint8_t sn) {
     uint16_t val = 0, val1 = 0;
     do {
-        val1 = (WIZCHIP_READ(Sn_RX_RSR(sn)) << 8) | WIZCHIP_READ(Sn_RX_RSR(sn) + 1);
+        val1 = WIZCHIP_READ_WORD(Sn_RX_RSR(sn));
         if (val1 != 0) {
-            val = (WIZCHIP_READ(Sn_RX_RSR(sn)) << 8) | WIZCHIP_READ(Sn_RX_RSR(sn) + 1);
+            val = WIZCHIP_READ_WORD(Sn_RX_RSR(sn));
         }
     } while (val != val1);
     return val;
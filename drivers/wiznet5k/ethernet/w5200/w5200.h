@@ -1214,6 +1214,22 @@ void     WIZCHIP_READ_BUF (uint32_t AddrSel, uint8_t* pBuf, uint16_t len);
  */
 void     WIZCHIP_WRITE_BUF(uint32_t AddrSel, uint8_t* pBuf, uint16_t len);
 
+/**
+ * @ingroup Basic_IO_function
+ * @brief It reads a 16-bit big-endian register in a single SPI transaction.
+ * @param AddrSel Register address
+ * @return The value of the register
+ */
+uint16_t WIZCHIP_READ_WORD(uint32_t AddrSel);
+
+/**
+ * @ingroup Basic_IO_function
+ * @brief It writes a 16-bit big-endian register in a single SPI transaction.
+ * @param AddrSel Register address
+ * @param w Value to write
+ */
+void     WIZCHIP_WRITE_WORD(uint32_t AddrSel, uint16_t w);
+
 /////////////////////////////////
 // Common Register I/O function //
 /////////////////////////////////
@@ -1912,7 +1928,7 @@ uint16_t getSn_TX_FSR(uint8_t sn);
  * @return uint16_t. Value of @ref Sn_TX_RD.
  */
 #define getSn_TX_RD(sn) \
-		((WIZCHIP_READ(Sn_TX_RD(sn)) << 8) + WIZCHIP_READ((Sn_TX_RD(sn)+1)))
+		WIZCHIP_READ_WORD(Sn_TX_RD(sn))
 
 /**
  * @ingroup Socket_register_access_function
@@ -1921,10 +1937,8 @@ uint16_t getSn_TX_FSR(uint8_t sn);
  * @param (uint16_t)txwr Value to set @ref Sn_TX_WR
  * @sa GetSn_TX_WR()
  */
-#define setSn_TX_WR(sn, txwr) { \
-		WIZCHIP_WRITE(Sn_TX_WR(sn),   (uint8_t)(txwr>>8)); \
-		WIZCHIP_WRITE((Sn_TX_WR(sn)+1), (uint8_t) txwr); \
-		}
+#define setSn_TX_WR(sn, txwr) \
+		WIZCHIP_WRITE_WORD(Sn_TX_WR(sn), txwr)
 
 /**
  * @ingroup Socket_register_access_function
@@ -1934,7 +1948,7 @@ uint16_t getSn_TX_FSR(uint8_t sn);
  * @sa setSn_TX_WR()
  */
 #define getSn_TX_WR(sn) \
-		((WIZCHIP_READ(Sn_TX_WR(sn)) << 8) + WIZCHIP_READ((Sn_TX_WR(sn)+1)))
+		WIZCHIP_READ_WORD(Sn_TX_WR(sn))
 
 
 /**
@@ -1953,10 +1967,8 @@ uint16_t getSn_RX_RSR(uint8_t sn);
  * @param (uint16_t)rxrd Value to set @ref Sn_RX_RD
  * @sa getSn_RX_RD()
  */
-#define setSn_RX_RD(sn, rxrd) { \
-		WIZCHIP_WRITE(Sn_RX_RD(sn),   (uint8_t)(rxrd>>8)); \
-		WIZCHIP_WRITE((Sn_RX_RD(sn)+1), (uint8_t) rxrd); \
-	}
+#define setSn_RX_RD(sn, rxrd) \
+		WIZCHIP_WRITE_WORD(Sn_RX_RD(sn), rxrd)
 
 /**
  * @ingroup Socket_register_access_function
@@ -1966,7 +1978,7 @@ uint16_t getSn_RX_RSR(uint8_t sn);
  * @sa setSn_RX_RD()
  */
 #define getSn_RX_RD(sn) \
-		((WIZCHIP_READ(Sn_RX_RD(sn)) << 8) + WIZCHIP_READ((Sn_RX_RD(sn)+1)))
+		WIZCHIP_READ_WORD(Sn_RX_RD(sn))
 
 /**
  * @ingroup Socket_register_access_function
@@ -1975,7 +1987,7 @@ uint16_t getSn_RX_RSR(uint8_t sn);
  * @return uint16_t. Value of @ref Sn_RX_WR.
  */
 #define getSn_RX_WR(sn) \
-		((WIZCHIP_READ(Sn_RX_WR(sn)) << 8) + WIZCHIP_READ((Sn_RX_WR(sn)+1)))
+		WIZCHIP_READ_WORD(Sn_RX_WR(sn))
 
 
 /**
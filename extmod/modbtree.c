@@ -31,6 +31,7 @@
 
 #include "py/runtime.h"
 #include "py/stream.h"
+#include "supervisor/shared/translate.h"
 
 #if MICROPY_PY_BTREE
 
@@ -118,6 +119,41 @@ STATIC mp_obj_t btree_get(size_t n_args, const mp_obj_t *args) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(btree_get_obj, 2, 3, btree_get);
 
+// Insert (key, value) pairs given in ascending key order.  The library notices
+// sorted inserts at the end of the tree: it skips the root-to-leaf search and,
+// when the last leaf fills, starts a new empty one instead of splitting it in
+// half.  Leaf pages are therefore filled one after the other and left full.
+// Pages stay in the cache until it overflows or flush() is called, so a
+// cachesize that covers the pages being filled means each is written once.
+STATIC mp_obj_t btree_bulk_load(mp_obj_t self_in, mp_obj_t items_in) {
+    mp_obj_btree_t *self = MP_OBJ_TO_PTR(self_in);
+    BTREE *t = self->db->internal;
+    mp_obj_t iter = mp_getiter(items_in, NULL);
+    mp_obj_t prev_key = MP_OBJ_NULL;
+    mp_int_t count = 0;
+    mp_obj_t item;
+    while ((item = mp_iternext(iter)) != MP_OBJ_STOP_ITERATION) {
+        mp_obj_t *kv;
+        mp_obj_get_array_fixed_n(item, 2, &kv);
+        DBT key, val;
+        key.data = (void*)mp_obj_str_get_data(kv[0], &key.size);
+        val.data = (void*)mp_obj_str_get_data(kv[1], &val.size);
+        if (prev_key != MP_OBJ_NULL) {
+            DBT prev;
+            prev.data = (void*)mp_obj_str_get_data(prev_key, &prev.size);
+            if (t->bt_cmp(&prev, &key) >= 0) {
+                mp_raise_ValueError(translate("keys must be in ascending order"));
+            }
+        }
+        int res = __bt_put(self->db, &key, &val, 0);
+        CHECK_ERROR(res);
+        prev_key = kv[0];
+        count++;
+    }
+    return MP_OBJ_NEW_SMALL_INT(count);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(btree_bulk_load_obj, btree_bulk_load);
+
 STATIC mp_obj_t btree_seq(size_t n_args, const mp_obj_t *args) {
     mp_obj_btree_t *self = MP_OBJ_TO_PTR(args[0]);
     int flags = MP_OBJ_SMALL_INT_VALUE(args[1]);
@@ -300,6 +336,7 @@ STATIC const mp_rom_map_elem_t btree_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&btree_flush_obj) },
     { MP_ROM_QSTR(MP_QSTR_get), MP_ROM_PTR(&btree_get_obj) },
     { MP_ROM_QSTR(MP_QSTR_put), MP_ROM_PTR(&btree_put_obj) },
+    { MP_ROM_QSTR(MP_QSTR_bulk_load), MP_ROM_PTR(&btree_bulk_load_obj) },
     { MP_ROM_QSTR(MP_QSTR_seq), MP_ROM_PTR(&btree_seq_obj) },
     { MP_ROM_QSTR(MP_QSTR_keys), MP_ROM_PTR(&btree_keys_obj) },
     { MP_ROM_QSTR(MP_QSTR_values), MP_ROM_PTR(&btree_values_obj) },
@@ -0,0 +1,441 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2020 Damien P. George
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/mphal.h"
+#include "py/runtime.h"
+#include "py/smallint.h"
+
+#include "supervisor/shared/translate.h"
+
+#if MICROPY_PY_UASYNCIO
+
+// This is the C core of the uasyncio package in extmod/uasyncio: a Task type
+// and a TaskQueue that holds Tasks in a binary heap ordered by the tick at
+// which they should next run.  The scheduling loop itself is in core.py.
+
+#define MODULO MICROPY_PY_UTIME_TICKS_PERIOD
+
+#define TASK_IS_DONE(task) ((task)->coro == MP_OBJ_FROM_PTR(task))
+
+typedef struct _mp_obj_task_t {
+    mp_obj_base_t base;
+    mp_obj_t coro;
+    // What the task is parked on: None while it is on the run queue, the
+    // Task or TaskQueue it is waiting on, or an exception to throw into it.
+    mp_obj_t data;
+    // MP_OBJ_NULL until something awaits the task, so hasattr(t, "waiting")
+    // works the same as for the pure-Python version.
+    mp_obj_t waiting;
+    // The globals of core.py, used to find cur_task and _task_queue.
+    mp_obj_t globals;
+    mp_obj_t ph_key;
+    // Breaks ties between tasks due at the same tick so they run in FIFO order.
+    mp_uint_t seq;
+} mp_obj_task_t;
+
+typedef struct _mp_obj_task_queue_t {
+    mp_obj_base_t base;
+    size_t alloc;
+    size_t len;
+    mp_obj_task_t **heap;
+} mp_obj_task_queue_t;
+
+STATIC const mp_obj_type_t task_queue_type;
+STATIC const mp_obj_type_t task_type;
+
+STATIC mp_uint_t task_seq;
+
+/******************************************************************************/
+// Ticks helpers
+
+STATIC mp_uint_t ticks_now(void) {
+    return mp_hal_ticks_ms() & (MODULO - 1);
+}
+
+STATIC mp_int_t ticks_diff(mp_uint_t end, mp_uint_t start) {
+    return ((end - start + MODULO / 2) & (MODULO - 1)) - MODULO / 2;
+}
+
+STATIC mp_obj_t uasyncio_ticks(void) {
+    return MP_OBJ_NEW_SMALL_INT(ticks_now());
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(uasyncio_ticks_obj, uasyncio_ticks);
+
+STATIC mp_obj_t uasyncio_ticks_diff(mp_obj_t end_in, mp_obj_t start_in) {
+    return MP_OBJ_NEW_SMALL_INT(ticks_diff(mp_obj_get_int(end_in), mp_obj_get_int(start_in)));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(uasyncio_ticks_diff_obj, uasyncio_ticks_diff);
+
+STATIC mp_obj_t uasyncio_ticks_add(mp_obj_t ticks_in, mp_obj_t delta_in) {
+    mp_uint_t ticks = mp_obj_get_int(ticks_in);
+    mp_uint_t delta = mp_obj_get_int(delta_in);
+    return MP_OBJ_NEW_SMALL_INT((ticks + delta) & (MODULO - 1));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(uasyncio_ticks_add_obj, uasyncio_ticks_add);
+
+// Wait for up to the given number of milliseconds with nothing to run.  On
+// CircuitPython this is mp_hal_delay_ms, which keeps the background tasks
+// going and sleeps the CPU until the next tick or interrupt.
+STATIC mp_obj_t uasyncio_idle(mp_obj_t ms_in) {
+    mp_int_t ms = mp_obj_get_int(ms_in);
+    if (ms > 0) {
+        mp_hal_delay_ms(ms);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(uasyncio_idle_obj, uasyncio_idle);
+
+/******************************************************************************/
+// TaskQueue class
+
+STATIC bool task_earlier(mp_obj_task_t *a, mp_obj_task_t *b) {
+    mp_int_t diff = ticks_diff(MP_OBJ_SMALL_INT_VALUE(a->ph_key), MP_OBJ_SMALL_INT_VALUE(b->ph_key));
+    if (diff == 0) {
+        return (mp_int_t)(a->seq - b->seq) < 0;
+    }
+    return diff < 0;
+}
+
+// Move the entry at pos towards the root until its parent runs earlier.
+STATIC void heap_siftdown(mp_obj_task_queue_t *q, size_t pos) {
+    mp_obj_task_t *item = q->heap[pos];
+    while (pos > 0) {
+        size_t parent_pos = (pos - 1) >> 1;
+        mp_obj_task_t *parent = q->heap[parent_pos];
+        if (!task_earlier(item, parent)) {
+            break;
+        }
+        q->heap[pos] = parent;
+        pos = parent_pos;
+    }
+    q->heap[pos] = item;
+}
+
+// Move the entry at pos towards the leaves until both children run later.
+STATIC void heap_siftup(mp_obj_task_queue_t *q, size_t pos) {
+    mp_obj_task_t *item = q->heap[pos];
+    for (size_t child_pos = 2 * pos + 1; child_pos < q->len; child_pos = 2 * pos + 1) {
+        if (child_pos + 1 < q->len && task_earlier(q->heap[child_pos + 1], q->heap[child_pos])) {
+            child_pos += 1;
+        }
+        if (!task_earlier(q->heap[child_pos], item)) {
+            break;
+        }
+        q->heap[pos] = q->heap[child_pos];
+        pos = child_pos;
+    }
+    q->heap[pos] = item;
+}
+
+STATIC mp_obj_task_t *get_task(mp_obj_t task_in) {
+    if (!MP_OBJ_IS_TYPE(task_in, &task_type)) {
+        mp_raise_TypeError(NULL);
+    }
+    return MP_OBJ_TO_PTR(task_in);
+}
+
+STATIC void task_queue_push(mp_obj_task_queue_t *q, mp_obj_task_t *task, mp_uint_t key) {
+    if (q->len == q->alloc) {
+        size_t alloc = q->alloc ? q->alloc * 2 : 4;
+        q->heap = m_renew(mp_obj_task_t*, q->heap, q->alloc, alloc);
+        q->alloc = alloc;
+    }
+    task->ph_key = MP_OBJ_NEW_SMALL_INT(key & (MODULO - 1));
+    task->seq = task_seq++;
+    q->heap[q->len] = task;
+    heap_siftdown(q, q->len++);
+}
+
+STATIC void task_queue_remove_at(mp_obj_task_queue_t *q, size_t pos) {
+    q->len -= 1;
+    if (pos < q->len) {
+        q->heap[pos] = q->heap[q->len];
+        heap_siftdown(q, pos);
+        heap_siftup(q, pos);
+    }
+    // So we don't retain a pointer.
+    q->heap[q->len] = NULL;
+}
+
+STATIC bool task_queue_remove(mp_obj_task_queue_t *q, mp_obj_task_t *task) {
+    for (size_t i = 0; i < q->len; i++) {
+        if (q->heap[i] == task) {
+            task_queue_remove_at(q, i);
+            return true;
+        }
+    }
+    return false;
+}
+
+STATIC mp_obj_t task_queue_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
+    (void)args;
+    mp_arg_check_num(n_args, kw_args, 0, 0, false);
+    mp_obj_task_queue_t *self = m_new_obj(mp_obj_task_queue_t);
+    self->base.type = type;
+    self->alloc = 0;
+    self->len = 0;
+    self->heap = NULL;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC mp_obj_t task_queue_peek(mp_obj_t self_in) {
+    mp_obj_task_queue_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->len == 0) {
+        return mp_const_none;
+    }
+    return MP_OBJ_FROM_PTR(self->heap[0]);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(task_queue_peek_obj, task_queue_peek);
+
+STATIC mp_obj_t task_queue_push_sorted(mp_obj_t self_in, mp_obj_t task_in, mp_obj_t key_in) {
+    mp_obj_task_queue_t *self = MP_OBJ_TO_PTR(self_in);
+    task_queue_push(self, get_task(task_in), mp_obj_get_int(key_in));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(task_queue_push_sorted_obj, task_queue_push_sorted);
+
+STATIC mp_obj_t task_queue_push_head(mp_obj_t self_in, mp_obj_t task_in) {
+    mp_obj_task_queue_t *self = MP_OBJ_TO_PTR(self_in);
+    task_queue_push(self, get_task(task_in), ticks_now());
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(task_queue_push_head_obj, task_queue_push_head);
+
+STATIC mp_obj_t task_queue_pop_head(mp_obj_t self_in) {
+    mp_obj_task_queue_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->len == 0) {
+        mp_raise_IndexError(translate("empty heap"));
+    }
+    mp_obj_task_t *head = self->heap[0];
+    task_queue_remove_at(self, 0);
+    return MP_OBJ_FROM_PTR(head);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(task_queue_pop_head_obj, task_queue_pop_head);
+
+STATIC mp_obj_t task_queue_remove_meth(mp_obj_t self_in, mp_obj_t task_in) {
+    mp_obj_task_queue_t *self = MP_OBJ_TO_PTR(self_in);
+    task_queue_remove(self, get_task(task_in));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(task_queue_remove_obj, task_queue_remove_meth);
+
+STATIC mp_obj_t task_queue_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
+    mp_obj_task_queue_t *self = MP_OBJ_TO_PTR(self_in);
+    switch (op) {
+        case MP_UNARY_OP_BOOL: return mp_obj_new_bool(self->len != 0);
+        case MP_UNARY_OP_LEN: return MP_OBJ_NEW_SMALL_INT(self->len);
+        default: return MP_OBJ_NULL; // op not supported
+    }
+}
+
+STATIC const mp_rom_map_elem_t task_queue_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_peek), MP_ROM_PTR(&task_queue_peek_obj) },
+    { MP_ROM_QSTR(MP_QSTR_push_sorted), MP_ROM_PTR(&task_queue_push_sorted_obj) },
+    { MP_ROM_QSTR(MP_QSTR_push_head), MP_ROM_PTR(&task_queue_push_head_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pop_head), MP_ROM_PTR(&task_queue_pop_head_obj) },
+    { MP_ROM_QSTR(MP_QSTR_remove), MP_ROM_PTR(&task_queue_remove_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(task_queue_locals_dict, task_queue_locals_dict_table);
+
+STATIC const mp_obj_type_t task_queue_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_TaskQueue,
+    .make_new = task_queue_make_new,
+    .unary_op = task_queue_unary_op,
+    .locals_dict = (mp_obj_dict_t*)&task_queue_locals_dict,
+};
+
+/******************************************************************************/
+// Task class
+
+STATIC mp_obj_t task_global(mp_obj_task_t *self, qstr name) {
+    return mp_obj_dict_get(self->globals, MP_OBJ_NEW_QSTR(name));
+}
+
+STATIC mp_obj_t task_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
+    mp_arg_check_num(n_args, kw_args, 2, 2, false);
+    if (!MP_OBJ_IS_TYPE(args[1], &mp_type_dict)) {
+        mp_raise_TypeError(NULL);
+    }
+    mp_obj_task_t *self = m_new_obj(mp_obj_task_t);
+    self->base.type = type;
+    self->coro = args[0];
+    self->data = mp_const_none;
+    self->waiting = MP_OBJ_NULL;
+    self->globals = args[1];
+    self->ph_key = MP_OBJ_NEW_SMALL_INT(0);
+    self->seq = 0;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC mp_obj_t task_done(mp_obj_t self_in) {
+    mp_obj_task_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(TASK_IS_DONE(self));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(task_done_obj, task_done);
+
+STATIC mp_obj_t task_cancel(mp_obj_t self_in) {
+    mp_obj_task_t *self = MP_OBJ_TO_PTR(self_in);
+    // Check if the task is already finished.
+    if (TASK_IS_DONE(self)) {
+        return mp_const_false;
+    }
+    // Can't cancel self (not supported yet).
+    if (self_in == task_global(self, MP_QSTR_cur_task)) {
+        mp_raise_RuntimeError(translate("can't cancel self"));
+    }
+    // If the task waits on another task then forward the cancel to the one it's waiting on.
+    while (MP_OBJ_IS_TYPE(self->data, &task_type)) {
+        self = MP_OBJ_TO_PTR(self->data);
+    }
+    mp_obj_task_queue_t *task_queue = MP_OBJ_TO_PTR(task_global(self, MP_QSTR__task_queue));
+    if (MP_OBJ_IS_TYPE(self->data, &task_queue_type)) {
+        // Not on the main running queue, so move it there.
+        task_queue_remove(MP_OBJ_TO_PTR(self->data), self);
+        task_queue_push(task_queue, self, ticks_now());
+    } else if (ticks_diff(MP_OBJ_SMALL_INT_VALUE(self->ph_key), ticks_now()) > 0) {
+        // On the main running queue but scheduled in the future, so bring it forward to now.
+        task_queue_remove(task_queue, self);
+        task_queue_push(task_queue, self, ticks_now());
+    }
+    self->data = task_global(self, MP_QSTR_CancelledError);
+    return mp_const_true;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(task_cancel_obj, task_cancel);
+
+// The scheduling loop "throws" into a finished task whose exception nobody
+// retrieved; report it through the loop's exception handler.
+STATIC mp_obj_t task_throw(mp_obj_t self_in, mp_obj_t value_in) {
+    mp_obj_task_t *self = MP_OBJ_TO_PTR(self_in);
+    self->data = value_in;
+    if (self->waiting == MP_OBJ_NULL) {
+        mp_obj_t exc_context = task_global(self, MP_QSTR__exc_context);
+        mp_obj_dict_store(exc_context, MP_OBJ_NEW_QSTR(MP_QSTR_exception), value_in);
+        mp_obj_dict_store(exc_context, MP_OBJ_NEW_QSTR(MP_QSTR_future), self_in);
+        mp_obj_t dest[3];
+        mp_load_method(task_global(self, MP_QSTR_Loop), MP_QSTR_call_exception_handler, dest);
+        dest[2] = exc_context;
+        mp_call_method_n_kw(1, 0, dest);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(task_throw_obj, task_throw);
+
+STATIC void task_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
+    mp_obj_task_t *self = MP_OBJ_TO_PTR(self_in);
+    if (dest[0] == MP_OBJ_NULL) {
+        // Load
+        if (attr == MP_QSTR_coro) {
+            dest[0] = self->coro;
+        } else if (attr == MP_QSTR_data) {
+            dest[0] = self->data;
+        } else if (attr == MP_QSTR_waiting) {
+            // Leaving dest[0] NULL for an unset queue raises AttributeError.
+            dest[0] = self->waiting;
+        } else if (attr == MP_QSTR_ph_key) {
+            dest[0] = self->ph_key;
+        } else if (attr == MP_QSTR_done) {
+            dest[0] = MP_OBJ_FROM_PTR(&task_done_obj);
+            dest[1] = self_in;
+        } else if (attr == MP_QSTR_cancel) {
+            dest[0] = MP_OBJ_FROM_PTR(&task_cancel_obj);
+            dest[1] = self_in;
+        } else if (attr == MP_QSTR_throw) {
+            dest[0] = MP_OBJ_FROM_PTR(&task_throw_obj);
+            dest[1] = self_in;
+        }
+    } else if (dest[1] != MP_OBJ_NULL) {
+        // Store
+        if (attr == MP_QSTR_coro) {
+            self->coro = dest[1];
+            dest[0] = MP_OBJ_NULL;
+        } else if (attr == MP_QSTR_data) {
+            self->data = dest[1];
+            dest[0] = MP_OBJ_NULL;
+        } else if (attr == MP_QSTR_waiting) {
+            self->waiting = dest[1];
+            dest[0] = MP_OBJ_NULL;
+        }
+    }
+}
+
+STATIC mp_obj_t task_getiter(mp_obj_t self_in, mp_obj_iter_buf_t *iter_buf) {
+    (void)iter_buf;
+    mp_obj_task_t *self = MP_OBJ_TO_PTR(self_in);
+    if (TASK_IS_DONE(self)) {
+        // Signal that the completed task has been awaited on.
+        self->waiting = mp_const_none;
+    } else if (self->waiting == MP_OBJ_NULL || self->waiting == mp_const_none) {
+        // Lazily allocate the queue of tasks waiting on completion of this task.
+        self->waiting = task_queue_make_new(&task_queue_type, 0, NULL, NULL);
+    }
+    return self_in;
+}
+
+STATIC mp_obj_t task_iternext(mp_obj_t self_in) {
+    mp_obj_task_t *self = MP_OBJ_TO_PTR(self_in);
+    if (TASK_IS_DONE(self)) {
+        // Task finished, raise its return value (a StopIteration) or its
+        // exception in the caller so it can continue.
+        nlr_raise(self->data);
+    }
+    // Put the calling task on the waiting queue and point its data at this
+    // task, so cancelling the caller can be forwarded here.
+    mp_obj_t cur_task = task_global(self, MP_QSTR_cur_task);
+    task_queue_push(MP_OBJ_TO_PTR(self->waiting), get_task(cur_task), ticks_now());
+    ((mp_obj_task_t*)MP_OBJ_TO_PTR(cur_task))->data = self_in;
+    return mp_const_none;
+}
+
+STATIC const mp_obj_type_t task_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Task,
+    .make_new = task_make_new,
+    .attr = task_attr,
+    .getiter = task_getiter,
+    .iternext = task_iternext,
+};
+
+/******************************************************************************/
+// C-level uasyncio module
+
+STATIC const mp_rom_map_elem_t mp_module_uasyncio_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR__uasyncio) },
+    { MP_ROM_QSTR(MP_QSTR_TaskQueue), MP_ROM_PTR(&task_queue_type) },
+    { MP_ROM_QSTR(MP_QSTR_Task), MP_ROM_PTR(&task_type) },
+    { MP_ROM_QSTR(MP_QSTR_ticks), MP_ROM_PTR(&uasyncio_ticks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ticks_add), MP_ROM_PTR(&uasyncio_ticks_add_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ticks_diff), MP_ROM_PTR(&uasyncio_ticks_diff_obj) },
+    { MP_ROM_QSTR(MP_QSTR_idle), MP_ROM_PTR(&uasyncio_idle_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(mp_module_uasyncio_globals, mp_module_uasyncio_globals_table);
+
+const mp_obj_module_t mp_module_uasyncio = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t*)&mp_module_uasyncio_globals,
+};
+
+#endif // MICROPY_PY_UASYNCIO
@@ -40,6 +40,44 @@ static void check_not_unicode(const mp_obj_t arg) {
 #endif
 }
 
+static const char hex_digits[16] = "0123456789abcdef";
+
+// Number of bytes binascii_hexlify_into writes for len bytes of input.
+static size_t binascii_hexlify_len(size_t len, const char *sep) {
+    if (len == 0) {
+        return 0;
+    }
+    return len * 2 + (sep != NULL ? len - 1 : 0);
+}
+
+// Writes the hex encoding of in[0:len] to out, which must not overlap it. sep,
+// if not NULL, points to a 1-char separator written between values.
+static void binascii_hexlify_into(byte *out, const byte *in, size_t len, const char *sep) {
+    if (sep == NULL) {
+        for (; len >= 2; len -= 2) {
+            byte b0 = *in++;
+            byte b1 = *in++;
+            out[0] = hex_digits[b0 >> 4];
+            out[1] = hex_digits[b0 & 0xf];
+            out[2] = hex_digits[b1 >> 4];
+            out[3] = hex_digits[b1 & 0xf];
+            out += 4;
+        }
+        if (len != 0) {
+            out[0] = hex_digits[*in >> 4];
+            out[1] = hex_digits[*in & 0xf];
+        }
+        return;
+    }
+    for (size_t i = len; i--;) {
+        *out++ = hex_digits[*in >> 4];
+        *out++ = hex_digits[*in++ & 0xf];
+        if (i != 0) {
+            *out++ = *sep;
+        }
+    }
+}
+
 mp_obj_t mod_binascii_hexlify(size_t n_args, const mp_obj_t *args) {
     // Second argument is for an extension to allow a separator to be used
     // between values.
@@ -48,40 +86,41 @@ mp_obj_t mod_binascii_hexlify(size_t n_args, const mp_obj_t *args) {
     check_not_unicode(args[0]);
     mp_get_buffer_raise(args[0], &bufinfo, MP_BUFFER_READ);
 
-    // Code below assumes non-zero buffer length when computing size with
-    // separator, so handle the zero-length case here.
     if (bufinfo.len == 0) {
         return mp_const_empty_bytes;
     }
-
-    vstr_t vstr;
-    size_t out_len = bufinfo.len * 2;
     if (n_args > 1) {
-        // 1-char separator between hex numbers
-        out_len += bufinfo.len - 1;
         sep = mp_obj_str_get_str(args[1]);
     }
-    vstr_init_len(&vstr, out_len);
-    byte *in = bufinfo.buf, *out = (byte*)vstr.buf;
-    for (mp_uint_t i = bufinfo.len; i--;) {
-        byte d = (*in >> 4);
-        if (d > 9) {
-            d += 'a' - '9' - 1;
-        }
-        *out++ = d + '0';
-        d = (*in++ & 0xf);
-        if (d > 9) {
-            d += 'a' - '9' - 1;
-        }
-        *out++ = d + '0';
-        if (sep != NULL && i != 0) {
-            *out++ = *sep;
-        }
-    }
+
+    vstr_t vstr;
+    vstr_init_len(&vstr, binascii_hexlify_len(bufinfo.len, sep));
+    binascii_hexlify_into((byte*)vstr.buf, bufinfo.buf, bufinfo.len, sep);
     return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_binascii_hexlify_obj, 1, 2, mod_binascii_hexlify);
 
+// hexlify_into(data, buf[, sep]) encodes into buf, without allocating, and
+// returns the number of bytes written.
+mp_obj_t mod_binascii_hexlify_into(size_t n_args, const mp_obj_t *args) {
+    const char *sep = NULL;
+    mp_buffer_info_t bufinfo, outinfo;
+    check_not_unicode(args[0]);
+    mp_get_buffer_raise(args[0], &bufinfo, MP_BUFFER_READ);
+    mp_get_buffer_raise(args[1], &outinfo, MP_BUFFER_WRITE);
+    if (n_args > 2) {
+        sep = mp_obj_str_get_str(args[2]);
+    }
+
+    size_t out_len = binascii_hexlify_len(bufinfo.len, sep);
+    if (out_len > outinfo.len) {
+        mp_raise_ValueError(translate("buffer too small"));
+    }
+    binascii_hexlify_into(outinfo.buf, bufinfo.buf, bufinfo.len, sep);
+    return MP_OBJ_NEW_SMALL_INT(out_len);
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_binascii_hexlify_into_obj, 2, 3, mod_binascii_hexlify_into);
+
 mp_obj_t mod_binascii_unhexlify(mp_obj_t data) {
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
@@ -173,59 +212,78 @@ mp_obj_t mod_binascii_a2b_base64(mp_obj_t data) {
 }
 MP_DEFINE_CONST_FUN_OBJ_1(mod_binascii_a2b_base64_obj, mod_binascii_a2b_base64);
 
+static const char base64_digits[64] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Number of bytes binascii_b2a_base64_into writes for len bytes of input.
+static size_t binascii_b2a_base64_len(size_t len, bool newline) {
+    return (len + 2) / 3 * 4 + newline;
+}
+
+// Writes the base64 encoding of in[0:len] to out, which must not overlap it.
+// Each group of 3 input bytes is loaded as one 24-bit word and split into 4
+// table lookups.
+static void binascii_b2a_base64_into(byte *out, const byte *in, size_t len, bool newline) {
+    for (; len >= 3; len -= 3) {
+        uint32_t w = (uint32_t)in[0] << 16 | in[1] << 8 | in[2];
+        out[0] = base64_digits[w >> 18];
+        out[1] = base64_digits[(w >> 12) & 0x3f];
+        out[2] = base64_digits[(w >> 6) & 0x3f];
+        out[3] = base64_digits[w & 0x3f];
+        in += 3;
+        out += 4;
+    }
+    if (len != 0) {
+        uint32_t w = (uint32_t)in[0] << 16 | (len == 2 ? in[1] << 8 : 0);
+        out[0] = base64_digits[w >> 18];
+        out[1] = base64_digits[(w >> 12) & 0x3f];
+        out[2] = len == 2 ? base64_digits[(w >> 6) & 0x3f] : '=';
+        out[3] = '=';
+        out += 4;
+    }
+    if (newline) {
+        *out = '\n';
+    }
+}
+
 mp_obj_t mod_binascii_b2a_base64(mp_obj_t data) {
     check_not_unicode(data);
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
 
     vstr_t vstr;
-    vstr_init_len(&vstr, ((bufinfo.len != 0) ? (((bufinfo.len - 1) / 3) + 1) * 4 : 0) + 1);
+    vstr_init_len(&vstr, binascii_b2a_base64_len(bufinfo.len, true));
+    binascii_b2a_base64_into((byte*)vstr.buf, bufinfo.buf, bufinfo.len, true);
+    return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(mod_binascii_b2a_base64_obj, mod_binascii_b2a_base64);
 
-    // First pass, we convert input buffer to numeric base 64 values
-    byte *in = bufinfo.buf, *out = (byte*)vstr.buf;
-    mp_uint_t i;
-    for (i = bufinfo.len; i >= 3; i -= 3) {
-        *out++ = (in[0] & 0xFC) >> 2;
-        *out++ = (in[0] & 0x03) << 4 | (in[1] & 0xF0) >> 4;
-        *out++ = (in[1] & 0x0F) << 2 | (in[2] & 0xC0) >> 6;
-        *out++ = in[2] & 0x3F;
-        in += 3;
-    }
-    if (i != 0) {
-        *out++ = (in[0] & 0xFC) >> 2;
-        if (i == 2) {
-            *out++ = (in[0] & 0x03) << 4 | (in[1] & 0xF0) >> 4;
-            *out++ = (in[1] & 0x0F) << 2;
-        }
-        else {
-            *out++ = (in[0] & 0x03) << 4;
-            *out++ = 64;
-        }
-        *out = 64;
-    }
+// b2a_base64_into(data, buf, *, newline=True) encodes into buf, without
+// allocating, and returns the number of bytes written.
+mp_obj_t mod_binascii_b2a_base64_into(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_data, ARG_buf, ARG_newline };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_data, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_buf, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_newline, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
-    // Second pass, we convert number base 64 values to actual base64 ascii encoding
-    out = (byte*)vstr.buf;
-    for (mp_uint_t j = vstr.len - 1; j--;) {
-        if (*out < 26) {
-            *out += 'A';
-        } else if (*out < 52) {
-            *out += 'a' - 26;
-        } else if (*out < 62) {
-            *out += '0' - 52;
-        } else if (*out == 62) {
-            *out ='+';
-        } else if (*out == 63) {
-            *out = '/';
-        } else {
-            *out = '=';
-        }
-        out++;
+    check_not_unicode(args[ARG_data].u_obj);
+    mp_buffer_info_t bufinfo, outinfo;
+    mp_get_buffer_raise(args[ARG_data].u_obj, &bufinfo, MP_BUFFER_READ);
+    mp_get_buffer_raise(args[ARG_buf].u_obj, &outinfo, MP_BUFFER_WRITE);
+
+    bool newline = args[ARG_newline].u_bool;
+    size_t out_len = binascii_b2a_base64_len(bufinfo.len, newline);
+    if (out_len > outinfo.len) {
+        mp_raise_ValueError(translate("buffer too small"));
     }
-    *out = '\n';
-    return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
+    binascii_b2a_base64_into(outinfo.buf, bufinfo.buf, bufinfo.len, newline);
+    return MP_OBJ_NEW_SMALL_INT(out_len);
 }
-MP_DEFINE_CONST_FUN_OBJ_1(mod_binascii_b2a_base64_obj, mod_binascii_b2a_base64);
+MP_DEFINE_CONST_FUN_OBJ_KW(mod_binascii_b2a_base64_into_obj, 2, mod_binascii_b2a_base64_into);
 
 #if MICROPY_PY_UBINASCII_CRC32
 #include "../../lib/uzlib/src/tinf.h"
@@ -246,9 +304,11 @@ MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_binascii_crc32_obj, 1, 2, mod_binascii_c
 STATIC const mp_rom_map_elem_t mp_module_binascii_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_binascii) },
     { MP_ROM_QSTR(MP_QSTR_hexlify), MP_ROM_PTR(&mod_binascii_hexlify_obj) },
+    { MP_ROM_QSTR(MP_QSTR_hexlify_into), MP_ROM_PTR(&mod_binascii_hexlify_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_unhexlify), MP_ROM_PTR(&mod_binascii_unhexlify_obj) },
     { MP_ROM_QSTR(MP_QSTR_a2b_base64), MP_ROM_PTR(&mod_binascii_a2b_base64_obj) },
     { MP_ROM_QSTR(MP_QSTR_b2a_base64), MP_ROM_PTR(&mod_binascii_b2a_base64_obj) },
+    { MP_ROM_QSTR(MP_QSTR_b2a_base64_into), MP_ROM_PTR(&mod_binascii_b2a_base64_into_obj) },
     #if MICROPY_PY_UBINASCII_CRC32
     { MP_ROM_QSTR(MP_QSTR_crc32), MP_ROM_PTR(&mod_binascii_crc32_obj) },
     #endif
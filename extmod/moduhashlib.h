@@ -0,0 +1,55 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Paul Sokolovsky
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#ifndef MICROPY_INCLUDED_EXTMOD_MODUHASHLIB_H
+#define MICROPY_INCLUDED_EXTMOD_MODUHASHLIB_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// A port with a hashing engine sets MICROPY_PY_UHASHLIB_SHA256_HW and/or
+// MICROPY_PY_UHASHLIB_SHA1_HW and provides the matching functions below in
+// place of the software implementations.  Each hash object holds a context of
+// the given size on the GC heap.  Hash objects may be interleaved, and may be
+// collected without ever being finished, so the engine must not be held
+// between calls.
+
+#if MICROPY_PY_UHASHLIB_SHA256_HW
+extern const size_t mp_hal_sha256_context_size;
+void mp_hal_sha256_init(void *ctx);
+void mp_hal_sha256_update(void *ctx, const uint8_t *data, size_t len);
+// Writes the 32 byte digest.
+void mp_hal_sha256_final(void *ctx, uint8_t *digest);
+#endif
+
+#if MICROPY_PY_UHASHLIB_SHA1_HW
+extern const size_t mp_hal_sha1_context_size;
+void mp_hal_sha1_init(void *ctx);
+void mp_hal_sha1_update(void *ctx, const uint8_t *data, size_t len);
+// Writes the 20 byte digest.
+void mp_hal_sha1_final(void *ctx, uint8_t *digest);
+#endif
+
+#endif // MICROPY_INCLUDED_EXTMOD_MODUHASHLIB_H
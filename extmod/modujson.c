@@ -25,9 +25,10 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 
 #include "py/objlist.h"
-#include "py/objstringio.h"
+#include "py/objtype.h"
 #include "py/parsenum.h"
 #include "py/runtime.h"
 #include "py/stream.h"
@@ -36,14 +37,62 @@
 
 #if MICROPY_PY_UJSON
 
+// Output is gathered in a fixed buffer rather than written a token at a time.
+// With a stream the buffer is flushed whenever it fills up; without one (for
+// dumps_into) it is the caller's buffer and running out of room is an error.
+#define UJSON_DUMP_BUF_SIZE (64)
+
+typedef struct _ujson_dump_buf_t {
+    mp_obj_t stream;
+    byte *buf;
+    size_t len;
+    size_t alloc;
+} ujson_dump_buf_t;
+
+STATIC void ujson_dump_flush(ujson_dump_buf_t *b) {
+    if (b->len > 0) {
+        mp_stream_write(b->stream, b->buf, b->len, MP_STREAM_RW_WRITE);
+        b->len = 0;
+    }
+}
+
+STATIC void ujson_dump_strn(void *data, const char *str, size_t len) {
+    ujson_dump_buf_t *b = data;
+    if (len > b->alloc - b->len) {
+        if (b->stream == MP_OBJ_NULL) {
+            mp_raise_ValueError(translate("buffer too small"));
+        }
+        ujson_dump_flush(b);
+        if (len >= b->alloc) {
+            mp_stream_write(b->stream, str, len, MP_STREAM_RW_WRITE);
+            return;
+        }
+    }
+    memcpy(b->buf + b->len, str, len);
+    b->len += len;
+}
+
 STATIC mp_obj_t mod_ujson_dump(mp_obj_t obj, mp_obj_t stream) {
     mp_get_stream_raise(stream, MP_STREAM_OP_WRITE);
-    mp_print_t print = {MP_OBJ_TO_PTR(stream), mp_stream_write_adaptor};
+    byte buf[UJSON_DUMP_BUF_SIZE];
+    ujson_dump_buf_t b = { stream, buf, 0, sizeof(buf) };
+    mp_print_t print = {&b, ujson_dump_strn};
     mp_obj_print_helper(&print, obj, PRINT_JSON);
+    ujson_dump_flush(&b);
     return mp_const_none;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_ujson_dump_obj, mod_ujson_dump);
 
+STATIC mp_obj_t mod_ujson_dumps_into(mp_obj_t obj, mp_obj_t buf_in) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_WRITE);
+    ujson_dump_buf_t b = { MP_OBJ_NULL, bufinfo.buf, 0, bufinfo.len };
+    mp_print_t print = {&b, ujson_dump_strn};
+    mp_obj_print_helper(&print, obj, PRINT_JSON);
+    return MP_OBJ_NEW_SMALL_INT(b.len);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_ujson_dumps_into_obj, mod_ujson_dumps_into);
+
 STATIC mp_obj_t mod_ujson_dumps(mp_obj_t obj) {
     vstr_t vstr;
     mp_print_t print;
@@ -70,11 +119,21 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_ujson_dumps_obj, mod_ujson_dumps);
 // strings).  It does 1 pass over the input stream.  It tries to be fast and
 // small in code size, while not using more RAM than necessary.
 
+// Non-seekable streams (UARTs, sockets) are read a byte at a time, so that
+// nothing after the JSON is taken from them.  Seekable ones are read in
+// blocks and the unused part is given back with a seek when parsing stops.
+#define UJSON_STREAM_BUF_SIZE (64)
+
 typedef struct _ujson_stream_t {
     mp_obj_t stream_obj;
     mp_uint_t (*read)(mp_obj_t obj, void *buf, mp_uint_t size, int *errcode);
     int errcode;
     byte cur;
+    bool seekable;
+    const byte *data; // either buf, or the whole input for loads()
+    size_t pos;
+    size_t len;
+    byte buf[UJSON_STREAM_BUF_SIZE];
 } ujson_stream_t;
 
 #define S_EOF (0) // null is not allowed in json stream so is ok as EOF marker
@@ -82,40 +141,71 @@ typedef struct _ujson_stream_t {
 #define S_CUR(s) ((s).cur)
 #define S_NEXT(s) (ujson_stream_next(&(s)))
 
-STATIC byte ujson_stream_next(ujson_stream_t *s) {
-    mp_uint_t ret = s->read(s->stream_obj, &s->cur, 1, &s->errcode);
-    JSON_DEBUG("  usjon_stream_next err:%2d cur: %c \n", s->errcode, s->cur);
-    if (s->errcode != 0) {
-        mp_raise_OSError(s->errcode);
+STATIC void ujson_stream_init(ujson_stream_t *s, mp_obj_t stream_obj) {
+    const mp_stream_p_t *stream_p = mp_get_stream_raise(stream_obj, MP_STREAM_OP_READ);
+    s->stream_obj = stream_obj;
+    s->read = stream_p->read;
+    s->errcode = 0;
+    s->cur = 0;
+    s->seekable = false;
+    s->data = s->buf;
+    s->pos = 0;
+    s->len = 0;
+    // Streams written in Python may not handle seeking, so leave them alone.
+    if (stream_p->ioctl != NULL && !mp_obj_is_instance_type(mp_obj_get_type(stream_obj))) {
+        struct mp_stream_seek_t seek = { .offset = 0, .whence = MP_SEEK_CUR };
+        int errcode;
+        s->seekable = stream_p->ioctl(stream_obj, MP_STREAM_SEEK, (uintptr_t)&seek, &errcode) != MP_STREAM_ERROR;
     }
-    if (ret == 0) {
-        s->cur = S_EOF;
+}
+
+STATIC byte ujson_stream_next(ujson_stream_t *s) {
+    if (s->pos == s->len) {
+        if (s->read == NULL) {
+            s->cur = S_EOF;
+            return S_EOF;
+        }
+        mp_uint_t ret = s->read(s->stream_obj, s->buf, s->seekable ? sizeof(s->buf) : 1, &s->errcode);
+        JSON_DEBUG("  usjon_stream_next err:%2d len: %d \n", s->errcode, ret);
+        s->pos = 0;
+        s->len = 0;
+        if (s->errcode != 0) {
+            mp_raise_OSError(s->errcode);
+        }
+        if (ret == 0) {
+            s->cur = S_EOF;
+            return S_EOF;
+        }
+        s->len = ret;
     }
+    s->cur = s->data[s->pos++];
     return s->cur;
 }
 
-STATIC mp_obj_t _mod_ujson_load(mp_obj_t stream_obj, bool return_first_json) {
-    const mp_stream_p_t *stream_p = mp_get_stream_raise(stream_obj, MP_STREAM_OP_READ);
-    ujson_stream_t s = {stream_obj, stream_p->read, 0, 0};
-    JSON_DEBUG("got JSON stream\n");
-    vstr_t vstr;
-    vstr_init(&vstr, 8);
-    mp_obj_list_t stack; // we use a list as a simple stack for nested JSON
-    stack.len = 0;
-    stack.items = NULL;
-    mp_obj_t stack_top = MP_OBJ_NULL;
-    mp_obj_type_t *stack_top_type = NULL;
-    mp_obj_t stack_key = MP_OBJ_NULL;
-    S_NEXT(s);
+// Seek back over anything read ahead, so the stream is left just after the
+// current character, as if it had been read a byte at a time.
+STATIC void ujson_stream_unread(ujson_stream_t *s) {
+    if (s->seekable && s->pos < s->len) {
+        const mp_stream_p_t *stream_p = mp_get_stream(s->stream_obj);
+        struct mp_stream_seek_t seek = { .offset = -(mp_off_t)(s->len - s->pos), .whence = MP_SEEK_CUR };
+        int errcode;
+        stream_p->ioctl(s->stream_obj, MP_STREAM_SEEK, (uintptr_t)&seek, &errcode);
+        s->pos = s->len;
+    }
+}
+
+#define TOK_VALUE (1)
+
+// Reads the next token, skipping whitespace and separators.  Returns one of
+// '[', '{', ']' and '}', TOK_VALUE with *value set for a primitive, or S_EOF
+// at the end of the stream.
+STATIC byte ujson_next_token(ujson_stream_t *s, vstr_t *vstr, mp_obj_t *value) {
     for (;;) {
-        cont:
-        if (S_END(s)) {
-            break;
+        if (S_END(*s)) {
+            return S_EOF;
         }
-        mp_obj_t next = MP_OBJ_NULL;
-        bool enter = false;
-        byte cur = S_CUR(s);
-        S_NEXT(s);
+        byte cur = S_CUR(*s);
+        S_NEXT(*s);
         switch (cur) {
             case ',':
             case ':':
@@ -123,37 +213,37 @@ STATIC mp_obj_t _mod_ujson_load(mp_obj_t stream_obj, bool return_first_json) {
             case '\t':
             case '\n':
             case '\r':
-                goto cont;
+                continue;
             case 'n':
-                if (S_CUR(s) == 'u' && S_NEXT(s) == 'l' && S_NEXT(s) == 'l') {
-                    S_NEXT(s);
-                    next = mp_const_none;
+                if (S_CUR(*s) == 'u' && S_NEXT(*s) == 'l' && S_NEXT(*s) == 'l') {
+                    S_NEXT(*s);
+                    *value = mp_const_none;
                 } else {
                     goto fail;
                 }
-                break;
+                return TOK_VALUE;
             case 'f':
-                if (S_CUR(s) == 'a' && S_NEXT(s) == 'l' && S_NEXT(s) == 's' && S_NEXT(s) == 'e') {
-                    S_NEXT(s);
-                    next = mp_const_false;
+                if (S_CUR(*s) == 'a' && S_NEXT(*s) == 'l' && S_NEXT(*s) == 's' && S_NEXT(*s) == 'e') {
+                    S_NEXT(*s);
+                    *value = mp_const_false;
                 } else {
                     goto fail;
                 }
-                break;
+                return TOK_VALUE;
             case 't':
-                if (S_CUR(s) == 'r' && S_NEXT(s) == 'u' && S_NEXT(s) == 'e') {
-                    S_NEXT(s);
-                    next = mp_const_true;
+                if (S_CUR(*s) == 'r' && S_NEXT(*s) == 'u' && S_NEXT(*s) == 'e') {
+                    S_NEXT(*s);
+                    *value = mp_const_true;
                 } else {
                     goto fail;
                 }
-                break;
+                return TOK_VALUE;
             case '"':
-                vstr_reset(&vstr);
-                for (; !S_END(s) && S_CUR(s) != '"';) {
-                    byte c = S_CUR(s);
+                vstr_reset(vstr);
+                for (; !S_END(*s) && S_CUR(*s) != '"';) {
+                    byte c = S_CUR(*s);
                     if (c == '\\') {
-                        c = S_NEXT(s);
+                        c = S_NEXT(*s);
                         switch (c) {
                             case 'b': c = 0x08; break;
                             case 'f': c = 0x0c; break;
@@ -163,34 +253,34 @@ STATIC mp_obj_t _mod_ujson_load(mp_obj_t stream_obj, bool return_first_json) {
                             case 'u': {
                                 mp_uint_t num = 0;
                                 for (int i = 0; i < 4; i++) {
-                                    c = (S_NEXT(s) | 0x20) - '0';
+                                    c = (S_NEXT(*s) | 0x20) - '0';
                                     if (c > 9) {
                                         c -= ('a' - ('9' + 1));
                                     }
                                     num = (num << 4) | c;
                                 }
-                                vstr_add_char(&vstr, num);
+                                vstr_add_char(vstr, num);
                                 goto str_cont;
                             }
                         }
                     }
-                    vstr_add_byte(&vstr, c);
+                    vstr_add_byte(vstr, c);
                 str_cont:
-                    S_NEXT(s);
+                    S_NEXT(*s);
                 }
-                if (S_END(s)) {
+                if (S_END(*s)) {
                     goto fail;
                 }
-                S_NEXT(s);
-                next = mp_obj_new_str(vstr.buf, vstr.len);
-                break;
+                S_NEXT(*s);
+                *value = mp_obj_new_str(vstr->buf, vstr->len);
+                return TOK_VALUE;
             case '-':
             case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9': {
                 bool flt = false;
-                vstr_reset(&vstr);
+                vstr_reset(vstr);
                 for (;;) {
-                    vstr_add_byte(&vstr, cur);
-                    cur = S_CUR(s);
+                    vstr_add_byte(vstr, cur);
+                    cur = S_CUR(*s);
                     if (cur == '.' || cur == 'E' || cur == 'e') {
                         flt = true;
                     } else if (cur == '-' || unichar_isdigit(cur)) {
@@ -198,15 +288,48 @@ STATIC mp_obj_t _mod_ujson_load(mp_obj_t stream_obj, bool return_first_json) {
                     } else {
                         break;
                     }
-                    S_NEXT(s);
+                    S_NEXT(*s);
                 }
                 if (flt) {
-                    next = mp_parse_num_decimal(vstr.buf, vstr.len, false, false, NULL);
+                    *value = mp_parse_num_decimal(vstr->buf, vstr->len, false, false, NULL);
                 } else {
-                    next = mp_parse_num_integer(vstr.buf, vstr.len, 10, NULL);
+                    *value = mp_parse_num_integer(vstr->buf, vstr->len, 10, NULL);
                 }
-                break;
+                return TOK_VALUE;
             }
+            case '[':
+            case '{':
+            case ']':
+            case '}':
+                return cur;
+            default:
+                goto fail;
+        }
+    }
+
+    fail:
+    mp_raise_ValueError(translate("syntax error in JSON"));
+}
+
+STATIC mp_obj_t _mod_ujson_load(ujson_stream_t *s, bool return_first_json) {
+    JSON_DEBUG("got JSON stream\n");
+    vstr_t vstr;
+    vstr_init(&vstr, 8);
+    mp_obj_list_t stack; // we use a list as a simple stack for nested JSON
+    stack.len = 0;
+    stack.items = NULL;
+    mp_obj_t stack_top = MP_OBJ_NULL;
+    mp_obj_type_t *stack_top_type = NULL;
+    mp_obj_t stack_key = MP_OBJ_NULL;
+    S_NEXT(*s);
+    for (;;) {
+        mp_obj_t next = MP_OBJ_NULL;
+        bool enter = false;
+        switch (ujson_next_token(s, &vstr, &next)) {
+            case S_EOF:
+                goto eof;
+            case TOK_VALUE:
+                break;
             case '[':
                 next = mp_obj_new_list(0, NULL);
                 enter = true;
@@ -215,8 +338,7 @@ STATIC mp_obj_t _mod_ujson_load(mp_obj_t stream_obj, bool return_first_json) {
                 next = mp_obj_new_dict(0);
                 enter = true;
                 break;
-            case '}':
-            case ']': {
+            default: { // ']' or '}'
                 if (stack_top == MP_OBJ_NULL) {
                     // no object at all
                     goto fail;
@@ -228,10 +350,8 @@ STATIC mp_obj_t _mod_ujson_load(mp_obj_t stream_obj, bool return_first_json) {
                 stack.len -= 1;
                 stack_top = stack.items[stack.len];
                 stack_top_type = mp_obj_get_type(stack_top);
-                goto cont;
+                continue;
             }
-            default:
-                goto fail;
         }
         if (stack_top == MP_OBJ_NULL) {
             stack_top = next;
@@ -273,18 +393,20 @@ STATIC mp_obj_t _mod_ujson_load(mp_obj_t stream_obj, bool return_first_json) {
     //   return the first complete JSON object, while in loads() we will retain
     //   strict adherence to the buffer's complete semantic.
     if (!return_first_json) {
-        while (unichar_isspace(S_CUR(s))) {
-            S_NEXT(s);
+        while (unichar_isspace(S_CUR(*s))) {
+            S_NEXT(*s);
         }
-        if (!S_END(s)) {
+        if (!S_END(*s)) {
             // unexpected chars
             goto fail;
         }
     }
+    eof:
     if (stack_top == MP_OBJ_NULL || stack.len != 0) {
         // not exactly 1 object
         goto fail;
     }
+    ujson_stream_unread(s);
     vstr_clear(&vstr);
     return stack_top;
 
@@ -293,19 +415,157 @@ STATIC mp_obj_t _mod_ujson_load(mp_obj_t stream_obj, bool return_first_json) {
 }
 
 STATIC mp_obj_t mod_ujson_load(mp_obj_t stream_obj) {
-    return _mod_ujson_load(stream_obj, true);
+    ujson_stream_t s;
+    ujson_stream_init(&s, stream_obj);
+    return _mod_ujson_load(&s, true);
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_ujson_load_obj, mod_ujson_load);
 
 STATIC mp_obj_t mod_ujson_loads(mp_obj_t obj) {
-    size_t len;
-    const char *buf = mp_obj_str_get_data(obj, &len);
-    vstr_t vstr = {len, len, (char*)buf, true};
-    mp_obj_stringio_t sio = {{&mp_type_stringio}, &vstr, 0, MP_OBJ_NULL};
-    return _mod_ujson_load(MP_OBJ_FROM_PTR(&sio), false);
+    // parse straight out of the string, with no stream in between
+    ujson_stream_t s;
+    s.read = NULL;
+    s.cur = 0;
+    s.seekable = false;
+    s.data = (const byte*)mp_obj_str_get_data(obj, &s.len);
+    s.pos = 0;
+    return _mod_ujson_load(&s, false);
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_ujson_loads_obj, mod_ujson_loads);
 
+#if MICROPY_PY_UJSON_ITERLOAD
+
+// iterload() walks a document without building it, which suits documents too
+// big for the heap.  It yields (path, value) for each primitive value, and for
+// each empty list or dict, where path is a tuple of the keys and indices that
+// lead to the value.  kinds holds one byte per open container: 'l' for a list
+// (path[-1] is the current index), 'k' for a dict expecting a key and 'v' for
+// a dict expecting a value (path[-1] is the key).
+
+typedef struct _mp_obj_ujson_iter_t {
+    mp_obj_base_t base;
+    bool started;
+    bool done;
+    mp_obj_t path;
+    vstr_t kinds;
+    vstr_t vstr;
+    ujson_stream_t s;
+} mp_obj_ujson_iter_t;
+
+STATIC mp_obj_t ujson_iter_item(mp_obj_ujson_iter_t *self, mp_obj_t value) {
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_list_get(self->path, &len, &items);
+    mp_obj_t tuple[2] = { mp_obj_new_tuple(len, items), value };
+    return mp_obj_new_tuple(2, tuple);
+}
+
+STATIC void ujson_iter_finish(mp_obj_ujson_iter_t *self) {
+    self->done = true;
+    ujson_stream_unread(&self->s);
+    vstr_clear(&self->kinds);
+    vstr_clear(&self->vstr);
+}
+
+STATIC mp_obj_t ujson_iter_iternext(mp_obj_t self_in) {
+    mp_obj_ujson_iter_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->done) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+    if (!self->started) {
+        self->started = true;
+        S_NEXT(self->s);
+    }
+    mp_obj_list_t *path = MP_OBJ_TO_PTR(self->path);
+    for (;;) {
+        mp_obj_t value = MP_OBJ_NULL;
+        byte tok = ujson_next_token(&self->s, &self->vstr, &value);
+        size_t depth = self->kinds.len;
+        char kind = depth > 0 ? self->kinds.buf[depth - 1] : 0;
+        if (tok == S_EOF) {
+            goto fail;
+        }
+        if (kind == 'k' && tok == TOK_VALUE) {
+            if (!MP_OBJ_IS_STR(value)) {
+                goto fail;
+            }
+            path->items[path->len - 1] = value;
+            self->kinds.buf[depth - 1] = 'v';
+            continue;
+        }
+        if (tok == ']' || tok == '}') {
+            if (kind != (tok == ']' ? 'l' : 'k')) {
+                goto fail;
+            }
+            mp_obj_t last = path->items[--path->len];
+            path->items[path->len] = MP_OBJ_NULL;
+            vstr_cut_tail_bytes(&self->kinds, 1);
+            mp_obj_t item = MP_OBJ_NULL;
+            if (tok == ']' && last == MP_OBJ_NEW_SMALL_INT(-1)) {
+                item = ujson_iter_item(self, mp_obj_new_list(0, NULL));
+            } else if (tok == '}' && last == mp_const_none) {
+                item = ujson_iter_item(self, mp_obj_new_dict(0));
+            }
+            if (depth == 1) {
+                ujson_iter_finish(self);
+            }
+            if (item != MP_OBJ_NULL) {
+                return item;
+            }
+            if (self->done) {
+                return MP_OBJ_STOP_ITERATION;
+            }
+            continue;
+        }
+        if (kind == 'k') {
+            // a container can't be a key
+            goto fail;
+        } else if (kind == 'l') {
+            mp_int_t index = MP_OBJ_SMALL_INT_VALUE(path->items[path->len - 1]);
+            path->items[path->len - 1] = MP_OBJ_NEW_SMALL_INT(index + 1);
+        } else if (kind == 'v') {
+            self->kinds.buf[depth - 1] = 'k';
+        }
+        if (tok == TOK_VALUE) {
+            mp_obj_t item = ujson_iter_item(self, value);
+            if (depth == 0) {
+                ujson_iter_finish(self);
+            }
+            return item;
+        }
+        // open a list, where the index starts before the first item, or a
+        // dict, where None marks that no key has been seen yet
+        vstr_add_byte(&self->kinds, tok == '[' ? 'l' : 'k');
+        mp_obj_list_append(self->path, tok == '[' ? MP_OBJ_NEW_SMALL_INT(-1) : mp_const_none);
+    }
+
+    fail:
+    self->done = true;
+    mp_raise_ValueError(translate("syntax error in JSON"));
+}
+
+STATIC const mp_obj_type_t ujson_iter_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_iterator,
+    .getiter = mp_identity_getiter,
+    .iternext = ujson_iter_iternext,
+};
+
+STATIC mp_obj_t mod_ujson_iterload(mp_obj_t stream_obj) {
+    mp_obj_ujson_iter_t *self = m_new_obj(mp_obj_ujson_iter_t);
+    self->base.type = &ujson_iter_type;
+    self->started = false;
+    self->done = false;
+    self->path = mp_obj_new_list(0, NULL);
+    vstr_init(&self->kinds, 8);
+    vstr_init(&self->vstr, 8);
+    ujson_stream_init(&self->s, stream_obj);
+    return MP_OBJ_FROM_PTR(self);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_ujson_iterload_obj, mod_ujson_iterload);
+
+#endif // MICROPY_PY_UJSON_ITERLOAD
+
 STATIC const mp_rom_map_elem_t mp_module_ujson_globals_table[] = {
 #if CIRCUITPY
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_json) },
@@ -314,8 +574,12 @@ STATIC const mp_rom_map_elem_t mp_module_ujson_globals_table[] = {
 #endif
     { MP_ROM_QSTR(MP_QSTR_dump), MP_ROM_PTR(&mod_ujson_dump_obj) },
     { MP_ROM_QSTR(MP_QSTR_dumps), MP_ROM_PTR(&mod_ujson_dumps_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dumps_into), MP_ROM_PTR(&mod_ujson_dumps_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_load), MP_ROM_PTR(&mod_ujson_load_obj) },
     { MP_ROM_QSTR(MP_QSTR_loads), MP_ROM_PTR(&mod_ujson_loads_obj) },
+#if MICROPY_PY_UJSON_ITERLOAD
+    { MP_ROM_QSTR(MP_QSTR_iterload), MP_ROM_PTR(&mod_ujson_iterload_obj) },
+#endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_ujson_globals, mp_module_ujson_globals_table);
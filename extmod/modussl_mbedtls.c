@@ -33,6 +33,7 @@
 
 #include "py/runtime.h"
 #include "py/stream.h"
+#include "supervisor/shared/translate.h"
 
 // mbedtls_time_t
 #include "mbedtls/platform.h"
@@ -61,10 +62,58 @@ struct ssl_args {
     mp_arg_val_t cert;
     mp_arg_val_t server_side;
     mp_arg_val_t server_hostname;
+    mp_arg_val_t max_fragment_length;
 };
 
 STATIC const mp_obj_type_t ussl_socket_type;
 
+#if MICROPY_PY_USSL_SESSION_CACHE && defined(MBEDTLS_SSL_CLI_C)
+// Sessions from earlier handshakes, so that a new connection to the same host
+// can resume with a session ID or ticket instead of doing the key exchange
+// again.  Entries are keyed on a hash of server_hostname: a collision only
+// costs a full handshake, because the server rejects a session it doesn't
+// know.  Session data is allocated by mbedtls, outside the GC heap, so it
+// survives a soft reset.
+typedef struct {
+    mp_uint_t hash;
+    size_t len;
+    bool valid;
+    mbedtls_ssl_session session;
+} ussl_session_cache_entry_t;
+
+STATIC ussl_session_cache_entry_t ussl_session_cache[MICROPY_PY_USSL_SESSION_CACHE];
+STATIC size_t ussl_session_cache_next;
+
+STATIC ussl_session_cache_entry_t *ussl_session_cache_find(const char *host, size_t len) {
+    mp_uint_t hash = qstr_compute_hash((const byte*)host, len);
+    for (size_t i = 0; i < MICROPY_PY_USSL_SESSION_CACHE; i++) {
+        ussl_session_cache_entry_t *entry = &ussl_session_cache[i];
+        if (entry->valid && entry->hash == hash && entry->len == len) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+STATIC void ussl_session_cache_store(const char *host, size_t len, const mbedtls_ssl_context *ssl) {
+    ussl_session_cache_entry_t *entry = ussl_session_cache_find(host, len);
+    if (entry == NULL) {
+        entry = &ussl_session_cache[ussl_session_cache_next];
+        ussl_session_cache_next = (ussl_session_cache_next + 1) % MICROPY_PY_USSL_SESSION_CACHE;
+    }
+    if (entry->valid) {
+        mbedtls_ssl_session_free(&entry->session);
+    }
+    mbedtls_ssl_session_init(&entry->session);
+    entry->hash = qstr_compute_hash((const byte*)host, len);
+    entry->len = len;
+    entry->valid = mbedtls_ssl_get_session(ssl, &entry->session) == 0;
+    if (!entry->valid) {
+        mbedtls_ssl_session_free(&entry->session);
+    }
+}
+#endif
+
 #ifdef MBEDTLS_DEBUG_C
 STATIC void mbedtls_debug(void *ctx, int level, const char *file, int line, const char *str) {
     (void)ctx;
@@ -147,6 +196,23 @@ STATIC mp_obj_ssl_socket_t *socket_new(mp_obj_t sock, struct ssl_args *args) {
         goto cleanup;
     }
 
+    #if defined(MBEDTLS_SSL_MAX_FRAGMENT_LENGTH)
+    // Ask the peer for smaller records. With MBEDTLS_SSL_VARIABLE_BUFFER_LENGTH
+    // mbedtls also shrinks its record buffers to match once negotiated.
+    if (args->max_fragment_length.u_obj != mp_const_none) {
+        mp_int_t frag_len = mp_obj_get_int(args->max_fragment_length.u_obj);
+        unsigned char mfl_code;
+        switch (frag_len) {
+            case 512: mfl_code = MBEDTLS_SSL_MAX_FRAG_LEN_512; break;
+            case 1024: mfl_code = MBEDTLS_SSL_MAX_FRAG_LEN_1024; break;
+            case 2048: mfl_code = MBEDTLS_SSL_MAX_FRAG_LEN_2048; break;
+            case 4096: mfl_code = MBEDTLS_SSL_MAX_FRAG_LEN_4096; break;
+            default: mp_raise_ValueError(translate("Invalid argument"));
+        }
+        mbedtls_ssl_conf_max_frag_len(&o->conf, mfl_code);
+    }
+    #endif
+
     mbedtls_ssl_conf_authmode(&o->conf, MBEDTLS_SSL_VERIFY_NONE);
     mbedtls_ssl_conf_rng(&o->conf, mbedtls_ctr_drbg_random, &o->ctr_drbg);
     #ifdef MBEDTLS_DEBUG_C
@@ -158,14 +224,26 @@ STATIC mp_obj_ssl_socket_t *socket_new(mp_obj_t sock, struct ssl_args *args) {
         goto cleanup;
     }
 
+    const char *sni = NULL;
+    size_t sni_len = 0;
     if (args->server_hostname.u_obj != mp_const_none) {
-        const char *sni = mp_obj_str_get_str(args->server_hostname.u_obj);
+        sni = mp_obj_str_get_data(args->server_hostname.u_obj, &sni_len);
         ret = mbedtls_ssl_set_hostname(&o->ssl, sni);
         if (ret != 0) {
             goto cleanup;
         }
     }
 
+    #if MICROPY_PY_USSL_SESSION_CACHE && defined(MBEDTLS_SSL_CLI_C)
+    if (sni != NULL && !args->server_side.u_bool) {
+        ussl_session_cache_entry_t *entry = ussl_session_cache_find(sni, sni_len);
+        // a failure here just means a full handshake
+        if (entry != NULL) {
+            mbedtls_ssl_set_session(&o->ssl, &entry->session);
+        }
+    }
+    #endif
+
     mbedtls_ssl_set_bio(&o->ssl, &o->sock, _mbedtls_ssl_send, _mbedtls_ssl_recv, NULL);
 
     if (args->key.u_obj != MP_OBJ_NULL) {
@@ -192,6 +270,12 @@ STATIC mp_obj_ssl_socket_t *socket_new(mp_obj_t sock, struct ssl_args *args) {
         }
     }
 
+    #if MICROPY_PY_USSL_SESSION_CACHE && defined(MBEDTLS_SSL_CLI_C)
+    if (sni != NULL && !args->server_side.u_bool) {
+        ussl_session_cache_store(sni, sni_len, &o->ssl);
+    }
+    #endif
+
     return o;
 
 cleanup:
@@ -329,6 +413,7 @@ STATIC mp_obj_t mod_ssl_wrap_socket(size_t n_args, const mp_obj_t *pos_args, mp_
         { MP_QSTR_cert, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
         { MP_QSTR_server_side, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
         { MP_QSTR_server_hostname, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_max_fragment_length, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
     };
 
     // TODO: Check that sock implements stream protocol
@@ -40,10 +40,22 @@
 #define DEBUG 0
 
 // the algorithm here is modelled on CPython's heapq.py
+//
+// Each entry also holds a handle, which push returns.  Its low bits are a slot
+// number, and pos[slot] is the entry's index in the heap, kept up to date as
+// entries move, so an entry can be found from its handle, and removed or
+// rescheduled, in O(log n).  The handles not in use are kept in the unused
+// entries past the end of the heap.  The high bits of a handle count how many
+// times its slot has been reused, so a handle whose entry has already been
+// popped or removed doesn't select whatever went into the slot next.
+
+#define SLOT_BITS (16)
+#define SLOT_MASK ((1 << SLOT_BITS) - 1)
 
 struct qentry {
     mp_uint_t time;
     mp_uint_t id;
+    mp_uint_t handle;
     mp_obj_t callback;
     mp_obj_t args;
 };
@@ -52,7 +64,9 @@ typedef struct _mp_obj_utimeq_t {
     mp_obj_base_t base;
     mp_uint_t alloc;
     mp_uint_t len;
-    struct qentry items[];
+    bool grow;
+    struct qentry *items;
+    mp_uint_t *pos;
 } mp_obj_utimeq_t;
 
 STATIC mp_uint_t utimeq_id;
@@ -76,17 +90,42 @@ STATIC bool time_less_than(struct qentry *item, struct qentry *parent) {
     return res && res < (MODULO / 2);
 }
 
-STATIC mp_obj_t utimeq_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
-    mp_arg_check_num(n_args, kw_args, 1, 1, false);
-    mp_uint_t alloc = mp_obj_get_int(args[0]);
-    mp_obj_utimeq_t *o = m_new_obj_var(mp_obj_utimeq_t, struct qentry, alloc);
+STATIC void utimeq_init_slots(mp_obj_utimeq_t *heap, mp_uint_t from) {
+    memset(&heap->items[from], 0, sizeof(*heap->items) * (heap->alloc - from));
+    for (mp_uint_t i = from; i < heap->alloc; i++) {
+        heap->items[i].handle = i;
+    }
+}
+
+STATIC mp_obj_t utimeq_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_alloc, ARG_grow };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_alloc, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_grow, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_uint_t alloc = args[ARG_alloc].u_int;
+    if (alloc > SLOT_MASK + 1) {
+        mp_raise_ValueError(translate("queue overflow"));
+    }
+    mp_obj_utimeq_t *o = m_new_obj(mp_obj_utimeq_t);
     o->base.type = type;
-    memset(o->items, 0, sizeof(*o->items) * alloc);
+    o->items = m_new(struct qentry, alloc);
+    o->pos = m_new(mp_uint_t, alloc);
     o->alloc = alloc;
     o->len = 0;
+    o->grow = args[ARG_grow].u_bool;
+    utimeq_init_slots(o, 0);
     return MP_OBJ_FROM_PTR(o);
 }
 
+STATIC inline void heap_set(mp_obj_utimeq_t *heap, mp_uint_t pos, const struct qentry *item) {
+    heap->items[pos] = *item;
+    heap->pos[item->handle & SLOT_MASK] = pos;
+}
+
 STATIC void heap_siftdown(mp_obj_utimeq_t *heap, mp_uint_t start_pos, mp_uint_t pos) {
     struct qentry item = heap->items[pos];
     while (pos > start_pos) {
@@ -94,13 +133,13 @@ STATIC void heap_siftdown(mp_obj_utimeq_t *heap, mp_uint_t start_pos, mp_uint_t
         struct qentry *parent = &heap->items[parent_pos];
         bool lessthan = time_less_than(&item, parent);
         if (lessthan) {
-            heap->items[pos] = *parent;
+            heap_set(heap, pos, parent);
             pos = parent_pos;
         } else {
             break;
         }
     }
-    heap->items[pos] = item;
+    heap_set(heap, pos, &item);
 }
 
 STATIC void heap_siftup(mp_obj_utimeq_t *heap, mp_uint_t pos) {
@@ -116,28 +155,83 @@ STATIC void heap_siftup(mp_obj_utimeq_t *heap, mp_uint_t pos) {
             }
         }
         // bubble up the smaller child
-        heap->items[pos] = heap->items[child_pos];
+        heap_set(heap, pos, &heap->items[child_pos]);
         pos = child_pos;
     }
-    heap->items[pos] = item;
+    heap_set(heap, pos, &item);
     heap_siftdown(heap, start_pos, pos);
 }
 
+// Restore the heap after the entry at pos was replaced or given a new time.
+// If it's earlier than its parent it's earlier than everything below too, so
+// it only needs to move towards the root, otherwise only towards the leaves.
+STATIC void heap_fix(mp_obj_utimeq_t *heap, mp_uint_t pos) {
+    if (pos > 0 && time_less_than(&heap->items[pos], &heap->items[(pos - 1) >> 1])) {
+        heap_siftdown(heap, 0, pos);
+    } else {
+        heap_siftup(heap, pos);
+    }
+}
+
+// Take the entry at pos out of the heap and put the next handle for its slot
+// with the unused ones.
+STATIC void heap_remove(mp_obj_utimeq_t *heap, mp_uint_t pos) {
+    mp_uint_t handle = heap->items[pos].handle + (1 << SLOT_BITS);
+    if (handle > MP_SMALL_INT_MAX) {
+        handle &= SLOT_MASK;
+    }
+    heap->len -= 1;
+    mp_uint_t last = heap->len;
+    if (pos != last) {
+        heap_set(heap, pos, &heap->items[last]);
+    }
+    heap->items[last].handle = handle;
+    heap->items[last].callback = MP_OBJ_NULL; // so we don't retain a pointer
+    heap->items[last].args = MP_OBJ_NULL;
+    if (pos != last) {
+        heap_fix(heap, pos);
+    }
+}
+
+// Returns the heap index of the entry with the given handle, or -1 if the
+// handle doesn't refer to a queued entry.
+STATIC mp_int_t heap_find(mp_obj_utimeq_t *heap, mp_obj_t handle_in) {
+    mp_int_t handle = mp_obj_get_int(handle_in);
+    if (handle < 0 || (mp_uint_t)(handle & SLOT_MASK) >= heap->alloc) {
+        return -1;
+    }
+    mp_uint_t pos = heap->pos[handle & SLOT_MASK];
+    if (pos >= heap->len || heap->items[pos].handle != (mp_uint_t)handle) {
+        return -1;
+    }
+    return pos;
+}
+
 STATIC mp_obj_t mod_utimeq_heappush(size_t n_args, const mp_obj_t *args) {
     (void)n_args;
     mp_obj_t heap_in = args[0];
     mp_obj_utimeq_t *heap = get_heap(heap_in);
     if (heap->len == heap->alloc) {
-        mp_raise_IndexError(translate("queue overflow"));
+        if (!heap->grow || heap->alloc > SLOT_MASK) {
+            mp_raise_IndexError(translate("queue overflow"));
+        }
+        mp_uint_t new_alloc = MIN(heap->alloc * 2 + 4, SLOT_MASK + 1);
+        heap->items = m_renew(struct qentry, heap->items, heap->alloc, new_alloc);
+        heap->pos = m_renew(mp_uint_t, heap->pos, heap->alloc, new_alloc);
+        mp_uint_t old_alloc = heap->alloc;
+        heap->alloc = new_alloc;
+        utimeq_init_slots(heap, old_alloc);
     }
     mp_uint_t l = heap->len;
+    mp_uint_t handle = heap->items[l].handle;
     heap->items[l].time = MP_OBJ_SMALL_INT_VALUE(args[1]);
     heap->items[l].id = utimeq_id++;
     heap->items[l].callback = args[2];
     heap->items[l].args = args[3];
+    heap->pos[handle & SLOT_MASK] = l;
     heap_siftdown(heap, 0, heap->len);
     heap->len++;
-    return mp_const_none;
+    return MP_OBJ_NEW_SMALL_INT(handle);
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_utimeq_heappush_obj, 4, 4, mod_utimeq_heappush);
 
@@ -155,13 +249,7 @@ STATIC mp_obj_t mod_utimeq_heappop(mp_obj_t heap_in, mp_obj_t list_ref) {
     ret->items[0] = MP_OBJ_NEW_SMALL_INT(item->time);
     ret->items[1] = item->callback;
     ret->items[2] = item->args;
-    heap->len -= 1;
-    heap->items[0] = heap->items[heap->len];
-    heap->items[heap->len].callback = MP_OBJ_NULL; // so we don't retain a pointer
-    heap->items[heap->len].args = MP_OBJ_NULL;
-    if (heap->len) {
-        heap_siftup(heap, 0);
-    }
+    heap_remove(heap, 0);
     return mp_const_none;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_utimeq_heappop_obj, mod_utimeq_heappop);
@@ -177,6 +265,36 @@ STATIC mp_obj_t mod_utimeq_peektime(mp_obj_t heap_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_utimeq_peektime_obj, mod_utimeq_peektime);
 
+// remove(handle) takes a pushed entry out of the queue. Returns False if the
+// handle doesn't refer to a queued entry.
+STATIC mp_obj_t mod_utimeq_remove(mp_obj_t heap_in, mp_obj_t handle_in) {
+    mp_obj_utimeq_t *heap = get_heap(heap_in);
+    mp_int_t pos = heap_find(heap, handle_in);
+    if (pos < 0) {
+        return mp_const_false;
+    }
+    heap_remove(heap, pos);
+    return mp_const_true;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_utimeq_remove_obj, mod_utimeq_remove);
+
+// update(handle, time) gives a queued entry a new time, moving it earlier or
+// later. It then sorts after any entries already queued for the same time, as
+// if it had been removed and pushed again. Returns False if the handle doesn't
+// refer to a queued entry.
+STATIC mp_obj_t mod_utimeq_update(mp_obj_t heap_in, mp_obj_t handle_in, mp_obj_t time_in) {
+    mp_obj_utimeq_t *heap = get_heap(heap_in);
+    mp_int_t pos = heap_find(heap, handle_in);
+    if (pos < 0) {
+        return mp_const_false;
+    }
+    heap->items[pos].time = MP_OBJ_SMALL_INT_VALUE(time_in);
+    heap->items[pos].id = utimeq_id++;
+    heap_fix(heap, pos);
+    return mp_const_true;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(mod_utimeq_update_obj, mod_utimeq_update);
+
 #if DEBUG
 STATIC mp_obj_t mod_utimeq_dump(mp_obj_t heap_in) {
     mp_obj_utimeq_t *heap = get_heap(heap_in);
@@ -202,6 +320,8 @@ STATIC const mp_rom_map_elem_t utimeq_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_push), MP_ROM_PTR(&mod_utimeq_heappush_obj) },
     { MP_ROM_QSTR(MP_QSTR_pop), MP_ROM_PTR(&mod_utimeq_heappop_obj) },
     { MP_ROM_QSTR(MP_QSTR_peektime), MP_ROM_PTR(&mod_utimeq_peektime_obj) },
+    { MP_ROM_QSTR(MP_QSTR_remove), MP_ROM_PTR(&mod_utimeq_remove_obj) },
+    { MP_ROM_QSTR(MP_QSTR_update), MP_ROM_PTR(&mod_utimeq_update_obj) },
     #if DEBUG
     { MP_ROM_QSTR(MP_QSTR_dump), MP_ROM_PTR(&mod_utimeq_dump_obj) },
     #endif
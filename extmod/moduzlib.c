@@ -204,10 +204,296 @@ error:
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_uzlib_decompress_obj, 1, 3, mod_uzlib_decompress);
 
+#if MICROPY_PY_UZLIB_COMPRESS
+
+// The compressor is a simple LZ77 matcher feeding a single fixed-Huffman
+// DEFLATE block, which keeps it small and its memory use bounded: a window of
+// 2**wbits bytes and a hash table of 2**(wbits-4) positions, one per hash.
+
+#define COMP_MIN_MATCH (3)
+#define COMP_MAX_MATCH (258)
+
+typedef struct _uzlib_comp_t {
+    vstr_t out;
+    uint32_t bits;
+    uint8_t nbits;
+    uint8_t format; // COMP_FORMAT_xxx
+    uint8_t hash_bits;
+    uint16_t wsize;
+    uint16_t *hash;
+    byte *window;
+    uint32_t pos; // number of bytes consumed so far
+    uint32_t checksum;
+} uzlib_comp_t;
+
+#define COMP_FORMAT_RAW (0)
+#define COMP_FORMAT_ZLIB (1)
+#define COMP_FORMAT_GZIP (2)
+
+STATIC const uint16_t comp_length_base[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258,
+};
+
+STATIC const uint16_t comp_dist_base[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577,
+};
+
+STATIC void comp_put_bits(uzlib_comp_t *c, uint32_t bits, uint8_t n) {
+    c->bits |= bits << c->nbits;
+    c->nbits += n;
+    while (c->nbits >= 8) {
+        vstr_add_byte(&c->out, c->bits);
+        c->bits >>= 8;
+        c->nbits -= 8;
+    }
+}
+
+// Huffman codes are packed starting from their most significant bit.
+STATIC void comp_put_code(uzlib_comp_t *c, uint32_t code, uint8_t n) {
+    uint32_t rev = 0;
+    for (uint8_t i = 0; i < n; i++) {
+        rev = (rev << 1) | (code & 1);
+        code >>= 1;
+    }
+    comp_put_bits(c, rev, n);
+}
+
+// Emit a literal/length symbol using the fixed Huffman code.
+STATIC void comp_put_symbol(uzlib_comp_t *c, unsigned int sym) {
+    if (sym < 144) {
+        comp_put_code(c, 0x30 + sym, 8);
+    } else if (sym < 256) {
+        comp_put_code(c, 0x190 + sym - 144, 9);
+    } else if (sym < 280) {
+        comp_put_code(c, sym - 256, 7);
+    } else {
+        comp_put_code(c, 0xc0 + sym - 280, 8);
+    }
+}
+
+STATIC void comp_put_match(uzlib_comp_t *c, unsigned int len, unsigned int dist) {
+    unsigned int i = 28;
+    while (comp_length_base[i] > len) {
+        i--;
+    }
+    comp_put_symbol(c, 257 + i);
+    if (i >= 8 && i < 28) {
+        comp_put_bits(c, len - comp_length_base[i], i / 4 - 1);
+    }
+    i = 29;
+    while (comp_dist_base[i] > dist) {
+        i--;
+    }
+    comp_put_code(c, i, 5);
+    if (i >= 4) {
+        comp_put_bits(c, dist - comp_dist_base[i], i / 2 - 1);
+    }
+}
+
+STATIC void comp_put_be32(vstr_t *out, uint32_t v) {
+    for (int i = 24; i >= 0; i -= 8) {
+        vstr_add_byte(out, v >> i);
+    }
+}
+
+STATIC void comp_init(uzlib_comp_t *c, mp_int_t wbits) {
+    c->format = COMP_FORMAT_ZLIB;
+    if (wbits >= 16) {
+        c->format = COMP_FORMAT_GZIP;
+        wbits -= 16;
+    } else if (wbits < 0) {
+        c->format = COMP_FORMAT_RAW;
+        wbits = -wbits;
+    }
+    if (wbits < 9 || wbits > 15) {
+        mp_raise_ValueError(translate("invalid window size"));
+    }
+    vstr_init(&c->out, 64);
+    c->bits = 0;
+    c->nbits = 0;
+    c->hash_bits = wbits - 4;
+    c->wsize = 1 << wbits;
+    c->hash = m_new0(uint16_t, 1 << c->hash_bits);
+    c->window = m_new(byte, c->wsize);
+    c->pos = 0;
+    if (c->format == COMP_FORMAT_ZLIB) {
+        byte cmf = ((wbits - 8) << 4) | 8;
+        vstr_add_byte(&c->out, cmf);
+        vstr_add_byte(&c->out, 31 - (cmf << 8) % 31);
+        c->checksum = 1;
+    } else if (c->format == COMP_FORMAT_GZIP) {
+        // magic, deflate, no flags, no mtime, no extra flags, unknown OS
+        vstr_add_strn(&c->out, "\x1f\x8b\x08\0\0\0\0\0\0\xff", 10);
+        c->checksum = ~0;
+    }
+    // one final block with fixed Huffman codes holds the whole stream
+    comp_put_bits(c, 1 | (1 << 1), 3);
+}
+
+STATIC void comp_deinit(uzlib_comp_t *c) {
+    m_del(uint16_t, c->hash, 1 << c->hash_bits);
+    m_del(byte, c->window, c->wsize);
+    c->hash = NULL;
+    c->window = NULL;
+}
+
+STATIC void comp_write(uzlib_comp_t *c, const byte *src, size_t len) {
+    if (c->format == COMP_FORMAT_ZLIB) {
+        c->checksum = uzlib_adler32(src, len, c->checksum);
+    } else if (c->format == COMP_FORMAT_GZIP) {
+        c->checksum = uzlib_crc32(src, len, c->checksum);
+    }
+    // Bytes before src are in the window and bytes from src on are in src, so
+    // a match may run from the history into the data being compressed.
+    const uint32_t base = c->pos;
+    const uint16_t wmask = c->wsize - 1;
+    const byte *end = src + len;
+    #define COMP_BYTE(p) ((p) < c->pos ? c->window[(p) & wmask] : src[(p) - base])
+    for (const byte *p = src; p < end;) {
+        unsigned int n = 1;
+        if (end - p >= COMP_MIN_MATCH) {
+            unsigned int h = ((p[0] << 10) ^ (p[1] << 5) ^ p[2]) & ((1 << c->hash_bits) - 1);
+            uint16_t dist = (uint16_t)(c->pos - c->hash[h]);
+            c->hash[h] = c->pos;
+            if (dist > 0 && dist <= c->wsize && dist <= c->pos) {
+                unsigned int max = MIN((size_t)(end - p), COMP_MAX_MATCH);
+                uint32_t q = c->pos - dist;
+                unsigned int m = 0;
+                while (m < max && COMP_BYTE(q + m) == p[m]) {
+                    m++;
+                }
+                if (m >= COMP_MIN_MATCH) {
+                    comp_put_match(c, m, dist);
+                    n = m;
+                }
+            }
+        }
+        if (n == 1) {
+            comp_put_symbol(c, *p);
+        }
+        for (; n > 0; n--) {
+            c->window[c->pos++ & wmask] = *p++;
+        }
+    }
+    #undef COMP_BYTE
+}
+
+STATIC void comp_finish(uzlib_comp_t *c) {
+    // end of block, then pad to a whole byte
+    comp_put_symbol(c, 256);
+    comp_put_bits(c, 0, 7);
+    if (c->format == COMP_FORMAT_ZLIB) {
+        comp_put_be32(&c->out, c->checksum);
+    } else if (c->format == COMP_FORMAT_GZIP) {
+        uint32_t crc = ~c->checksum;
+        for (int i = 0; i < 8; i++) {
+            vstr_add_byte(&c->out, (i < 4 ? crc : c->pos) >> (8 * (i & 3)));
+        }
+    }
+}
+
+STATIC mp_obj_t mod_uzlib_compress(size_t n_args, const mp_obj_t *args) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[0], &bufinfo, MP_BUFFER_READ);
+    uzlib_comp_t c;
+    comp_init(&c, n_args > 1 ? mp_obj_get_int(args[1]) : 15);
+    comp_write(&c, bufinfo.buf, bufinfo.len);
+    comp_finish(&c);
+    comp_deinit(&c);
+    return mp_obj_new_str_from_vstr(&mp_type_bytes, &c.out);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_uzlib_compress_obj, 1, 2, mod_uzlib_compress);
+
+typedef struct _mp_obj_compio_t {
+    mp_obj_base_t base;
+    mp_obj_t dest_stream;
+    uzlib_comp_t comp;
+} mp_obj_compio_t;
+
+STATIC void compio_flush_out(mp_obj_compio_t *o) {
+    mp_stream_write(o->dest_stream, o->comp.out.buf, o->comp.out.len, MP_STREAM_RW_WRITE);
+    vstr_reset(&o->comp.out);
+}
+
+STATIC mp_obj_t compio_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
+    mp_arg_check_num(n_args, kw_args, 1, 2, false);
+    mp_get_stream_raise(args[0], MP_STREAM_OP_WRITE);
+    mp_obj_compio_t *o = m_new_obj(mp_obj_compio_t);
+    o->base.type = type;
+    o->dest_stream = args[0];
+    comp_init(&o->comp, n_args > 1 ? mp_obj_get_int(args[1]) : 15);
+    return MP_OBJ_FROM_PTR(o);
+}
+
+STATIC mp_uint_t compio_write(mp_obj_t o_in, const void *buf, mp_uint_t size, int *errcode) {
+    mp_obj_compio_t *o = MP_OBJ_TO_PTR(o_in);
+    if (o->comp.window == NULL) {
+        *errcode = MP_EINVAL;
+        return MP_STREAM_ERROR;
+    }
+    comp_write(&o->comp, buf, size);
+    compio_flush_out(o);
+    return size;
+}
+
+STATIC mp_uint_t compio_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg, int *errcode) {
+    mp_obj_compio_t *o = MP_OBJ_TO_PTR(o_in);
+    (void)arg;
+    if (request == MP_STREAM_CLOSE) {
+        // Finish the compressed stream; the destination stream stays open.
+        if (o->comp.window != NULL) {
+            comp_finish(&o->comp);
+            compio_flush_out(o);
+            comp_deinit(&o->comp);
+            vstr_clear(&o->comp.out);
+        }
+        return 0;
+    }
+    *errcode = MP_EINVAL;
+    return MP_STREAM_ERROR;
+}
+
+STATIC mp_obj_t compio___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    return mp_stream_close(args[0]);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(compio___exit___obj, 4, 4, compio___exit__);
+
+STATIC const mp_rom_map_elem_t compio_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&mp_stream_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&mp_stream_close_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&mp_identity_obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&compio___exit___obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(compio_locals_dict, compio_locals_dict_table);
+
+STATIC const mp_stream_p_t compio_stream_p = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_stream)
+    .write = compio_write,
+    .ioctl = compio_ioctl,
+};
+
+STATIC const mp_obj_type_t compio_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_CompressIO,
+    .make_new = compio_make_new,
+    .protocol = &compio_stream_p,
+    .locals_dict = (void*)&compio_locals_dict,
+};
+
+#endif // MICROPY_PY_UZLIB_COMPRESS
+
 STATIC const mp_rom_map_elem_t mp_module_uzlib_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_uzlib) },
     { MP_ROM_QSTR(MP_QSTR_decompress), MP_ROM_PTR(&mod_uzlib_decompress_obj) },
     { MP_ROM_QSTR(MP_QSTR_DecompIO), MP_ROM_PTR(&decompio_type) },
+    #if MICROPY_PY_UZLIB_COMPRESS
+    { MP_ROM_QSTR(MP_QSTR_compress), MP_ROM_PTR(&mod_uzlib_compress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_CompressIO), MP_ROM_PTR(&compio_type) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_uzlib_globals, mp_module_uzlib_globals_table);
@@ -36,7 +36,17 @@
 
 enum { FRAME_HEADER, FRAME_OPT, PAYLOAD, CONTROL };
 
-enum { BLOCKING_WRITE = 0x80 };
+// FRAME_MORE (see modwebsocket.h) is also kept in opts; FRAGMENTING is set
+// while the frames of a fragmented message are being sent.
+enum { FRAGMENTING = 0x20, BLOCKING_WRITE = 0x80 };
+
+// Size of the lookahead buffer for reads from the underlying stream, so that
+// a frame header, its options and a short payload usually take one read.
+#define WEBSOCKET_RBUF_SIZE (32)
+
+// Frames with payloads up to this size are assembled on the stack and written
+// with the header in one go, rather than as two writes.
+#define WEBSOCKET_SMALL_FRAME (64)
 
 typedef struct _mp_obj_websocket_t {
     mp_obj_base_t base;
@@ -53,6 +63,9 @@ typedef struct _mp_obj_websocket_t {
     byte ws_flags;
     // Copy of current frame flags
     byte last_flags;
+    byte rbuf_pos;
+    byte rbuf_len;
+    byte rbuf[WEBSOCKET_RBUF_SIZE];
 } mp_obj_websocket_t;
 
 STATIC mp_uint_t websocket_write(mp_obj_t self_in, const void *buf, mp_uint_t size, int *errcode);
@@ -67,6 +80,8 @@ STATIC mp_obj_t websocket_make_new(const mp_obj_type_t *type, size_t n_args, con
     o->to_recv = 2;
     o->mask_pos = 0;
     o->buf_pos = 0;
+    o->rbuf_pos = 0;
+    o->rbuf_len = 0;
     o->opts = FRAME_TXT;
     if (n_args > 1 && args[1] == mp_const_true) {
         o->opts |= BLOCKING_WRITE;
@@ -74,21 +89,64 @@ STATIC mp_obj_t websocket_make_new(const mp_obj_type_t *type, size_t n_args, con
     return  MP_OBJ_FROM_PTR(o);
 }
 
+STATIC mp_uint_t websocket_sock_read(mp_obj_websocket_t *self, void *buf, mp_uint_t size, int *errcode) {
+    if (self->rbuf_pos == self->rbuf_len) {
+        const mp_stream_p_t *stream_p = mp_get_stream(self->sock);
+        if (size >= sizeof(self->rbuf)) {
+            // large payload reads go straight into the caller's buffer
+            return stream_p->read(self->sock, buf, size, errcode);
+        }
+        mp_uint_t out_sz = stream_p->read(self->sock, self->rbuf, sizeof(self->rbuf), errcode);
+        if (out_sz == 0 || out_sz == MP_STREAM_ERROR) {
+            return out_sz;
+        }
+        self->rbuf_pos = 0;
+        self->rbuf_len = out_sz;
+    }
+    mp_uint_t n = MIN(size, (mp_uint_t)(self->rbuf_len - self->rbuf_pos));
+    memcpy(buf, self->rbuf + self->rbuf_pos, n);
+    self->rbuf_pos += n;
+    return n;
+}
+
+STATIC void websocket_unmask(mp_obj_websocket_t *self, byte *p, size_t sz) {
+    if ((self->mask[0] | self->mask[1] | self->mask[2] | self->mask[3]) == 0) {
+        // unmasked frame, as sent by servers
+        return;
+    }
+    byte pos = self->mask_pos;
+    self->mask_pos += sz;
+    while (sz != 0 && ((uintptr_t)p & 3) != 0) {
+        *p++ ^= self->mask[pos++ & 3];
+        sz--;
+    }
+    if (sz >= 4) {
+        // XOR a word at a time with the mask rotated to start at pos
+        byte mask_bytes[4];
+        for (int i = 0; i < 4; i++) {
+            mask_bytes[i] = self->mask[(pos + i) & 3];
+        }
+        uint32_t mask;
+        memcpy(&mask, mask_bytes, sizeof(mask));
+        for (; sz >= 4; sz -= 4, p += 4) {
+            *(uint32_t*)(void*)p ^= mask;
+        }
+    }
+    while (sz--) {
+        *p++ ^= self->mask[pos++ & 3];
+    }
+}
+
 STATIC mp_uint_t websocket_read(mp_obj_t self_in, void *buf, mp_uint_t size, int *errcode) {
     mp_obj_websocket_t *self =  MP_OBJ_TO_PTR(self_in);
-    const mp_stream_p_t *stream_p = mp_get_stream(self->sock);
     while (1) {
-        if (self->to_recv != 0) {
-            mp_uint_t out_sz = stream_p->read(self->sock, self->buf + self->buf_pos, self->to_recv, errcode);
+        while (self->to_recv != 0) {
+            mp_uint_t out_sz = websocket_sock_read(self, self->buf + self->buf_pos, self->to_recv, errcode);
             if (out_sz == 0 || out_sz == MP_STREAM_ERROR) {
                 return out_sz;
             }
             self->buf_pos += out_sz;
             self->to_recv -= out_sz;
-            if (self->to_recv != 0) {
-                *errcode = MP_EAGAIN;
-                return MP_STREAM_ERROR;
-            }
         }
 
         switch (self->state) {
@@ -170,15 +228,12 @@ STATIC mp_uint_t websocket_read(mp_obj_t self_in, void *buf, mp_uint_t size, int
                 }
 
                 size_t sz = MIN(size, self->msg_sz);
-                out_sz = stream_p->read(self->sock, buf, sz, errcode);
+                out_sz = websocket_sock_read(self, buf, sz, errcode);
                 if (out_sz == 0 || out_sz == MP_STREAM_ERROR) {
                     return out_sz;
                 }
 
-                sz = out_sz;
-                for (byte *p = buf; sz--; p++) {
-                    *p ^= self->mask[self->mask_pos++ & 3];
-                }
+                websocket_unmask(self, buf, out_sz);
 
                 self->msg_sz -= out_sz;
                 if (self->msg_sz == 0) {
@@ -218,17 +273,31 @@ no_payload:
 
 STATIC mp_uint_t websocket_write(mp_obj_t self_in, const void *buf, mp_uint_t size, int *errcode) {
     mp_obj_websocket_t *self =  MP_OBJ_TO_PTR(self_in);
-    assert(size < 0x10000);
-    byte header[4] = {0x80 | (self->opts & FRAME_OPCODE_MASK)};
+    byte frame[10 + WEBSOCKET_SMALL_FRAME];
+    byte *header = frame;
+    // Continuation frames of a fragmented message carry FRAME_CONT, and all but
+    // the last frame have FIN clear.
+    header[0] = (self->opts & FRAGMENTING) ? FRAME_CONT : (self->opts & FRAME_OPCODE_MASK);
+    if (!(self->opts & FRAME_MORE)) {
+        header[0] |= 0x80;
+    }
     int hdr_sz;
     if (size < 126) {
         header[1] = size;
         hdr_sz = 2;
-    } else {
+    } else if (size < 0x10000) {
         header[1] = 126;
         header[2] = size >> 8;
         header[3] = size & 0xff;
         hdr_sz = 4;
+    } else {
+        header[1] = 127;
+        uint64_t sz64 = size;
+        for (int i = 9; i >= 2; i--) {
+            header[i] = sz64 & 0xff;
+            sz64 >>= 8;
+        }
+        hdr_sz = 10;
     }
 
     mp_obj_t dest[3];
@@ -238,9 +307,18 @@ STATIC mp_uint_t websocket_write(mp_obj_t self_in, const void *buf, mp_uint_t si
         mp_call_method_n_kw(1, 0, dest);
     }
 
-    mp_uint_t out_sz = mp_stream_write_exactly(self->sock, header, hdr_sz, errcode);
-    if (*errcode == 0) {
-        out_sz = mp_stream_write_exactly(self->sock, buf, size, errcode);
+    mp_uint_t out_sz;
+    if (size <= WEBSOCKET_SMALL_FRAME) {
+        memcpy(frame + hdr_sz, buf, size);
+        out_sz = mp_stream_write_exactly(self->sock, frame, hdr_sz + size, errcode);
+        if (*errcode == 0) {
+            out_sz = size;
+        }
+    } else {
+        out_sz = mp_stream_write_exactly(self->sock, header, hdr_sz, errcode);
+        if (*errcode == 0) {
+            out_sz = mp_stream_write_exactly(self->sock, buf, size, errcode);
+        }
     }
 
     if (self->opts & BLOCKING_WRITE) {
@@ -251,6 +329,11 @@ STATIC mp_uint_t websocket_write(mp_obj_t self_in, const void *buf, mp_uint_t si
     if (*errcode != 0) {
         return MP_STREAM_ERROR;
     }
+    if (self->opts & FRAME_MORE) {
+        self->opts |= FRAGMENTING;
+    } else {
+        self->opts &= ~FRAGMENTING;
+    }
     return out_sz;
 }
 
@@ -265,8 +348,8 @@ STATIC mp_uint_t websocket_ioctl(mp_obj_t self_in, mp_uint_t request, uintptr_t
         case MP_STREAM_GET_DATA_OPTS:
             return self->ws_flags & FRAME_OPCODE_MASK;
         case MP_STREAM_SET_DATA_OPTS: {
-            int cur = self->opts & FRAME_OPCODE_MASK;
-            self->opts = (self->opts & ~FRAME_OPCODE_MASK) | (arg & FRAME_OPCODE_MASK);
+            int cur = self->opts & (FRAME_OPCODE_MASK | FRAME_MORE);
+            self->opts = (self->opts & ~(FRAME_OPCODE_MASK | FRAME_MORE)) | (arg & (FRAME_OPCODE_MASK | FRAME_MORE));
             return cur;
         }
         default:
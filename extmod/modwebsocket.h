@@ -7,4 +7,8 @@ enum {
     FRAME_CLOSE = 0x8, FRAME_PING, FRAME_PONG
 };
 
+// Set with MP_STREAM_SET_DATA_OPTS to send the following writes as fragments
+// of one message; the first write after clearing it ends the message.
+#define FRAME_MORE 0x10
+
 #endif // MICROPY_INCLUDED_EXTMOD_MODWEBSOCKET_H
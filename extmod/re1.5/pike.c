@@ -0,0 +1,150 @@
+// Based on pike.c from re1, Copyright 2007-2009 Russ Cox.  All Rights Reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include "re1.5.h"
+
+// Pike VM: runs all threads in lock step over the subject, so the time taken
+// is linear in the length of the subject whatever the regex is.  Threads are
+// kept in priority order, which gives the same (leftmost, first alternative)
+// match as the backtracking matchers.  A thread is one slot of nsubp + 1
+// pointers: the pc of a consuming instruction, then its capture pointers.
+
+#ifndef re1_5_alloc
+#define re1_5_alloc(n) malloc(n)
+#define re1_5_free(p, n) free(p)
+#endif
+
+typedef struct {
+	const char **slots;
+	int n;
+} ThreadList;
+
+typedef struct {
+	ByteProg *prog;
+	Subject *input;
+	char *visited;
+	int nsubp;
+} PikeVM;
+
+static void
+addthread(PikeVM *vm, ThreadList *l, const char *pc, const char *sp, const char **subp)
+{
+	const char *old;
+	int off;
+
+	re1_5_stack_chk();
+
+	for(;;) {
+		off = pc - vm->prog->insts;
+		if(vm->visited[off])
+			return;
+		vm->visited[off] = 1;
+		switch(*pc) {
+		case Jmp:
+			pc = pc + 2 + (signed char)pc[1];
+			continue;
+		case Split:
+			addthread(vm, l, pc + 2, sp, subp);
+			pc = pc + 2 + (signed char)pc[1];
+			continue;
+		case RSplit:
+			addthread(vm, l, pc + 2 + (signed char)pc[1], sp, subp);
+			pc = pc + 2;
+			continue;
+		case Save:
+			off = (unsigned char)pc[1];
+			if(off >= vm->nsubp) {
+				pc += 2;
+				continue;
+			}
+			old = subp[off];
+			subp[off] = sp;
+			addthread(vm, l, pc + 2, sp, subp);
+			subp[off] = old;
+			return;
+		case Bol:
+			if(sp != vm->input->begin)
+				return;
+			pc++;
+			continue;
+		case Eol:
+			if(sp != vm->input->end)
+				return;
+			pc++;
+			continue;
+		}
+		// a consuming instruction or Match, which waits for the next step
+		const char **t = l->slots + l->n++ * (vm->nsubp + 1);
+		t[0] = pc;
+		memcpy(t + 1, subp, vm->nsubp * sizeof(*subp));
+		return;
+	}
+}
+
+int
+re1_5_pikevm(ByteProg *prog, Subject *input, const char **subp, int nsubp, int is_anchored)
+{
+	int slot_size = (nsubp + 1) * sizeof(*subp);
+	int alloc = 2 * prog->bytelen * slot_size + prog->bytelen;
+	char *mem = re1_5_alloc(alloc);
+	ThreadList clist = { (const char**)mem, 0 };
+	ThreadList nlist = { (const char**)(mem + prog->bytelen * slot_size), 0 };
+	ThreadList tmp;
+	PikeVM vm = { prog, input, mem + 2 * prog->bytelen * slot_size, nsubp };
+	const char *sp;
+	const char *pc;
+	const char **t;
+	int i, len, matched = 0;
+
+	memset(vm.visited, 0, prog->bytelen);
+	for(i = 0; i < nsubp; i++)
+		subp[i] = nil;
+	addthread(&vm, &clist, HANDLE_ANCHORED(prog->insts, is_anchored), input->begin, subp);
+	for(sp = input->begin; clist.n > 0; sp++) {
+		memset(vm.visited, 0, prog->bytelen);
+		nlist.n = 0;
+		for(i = 0; i < clist.n; i++) {
+			t = clist.slots + i * (nsubp + 1);
+			pc = t[0];
+			if(*pc == Match) {
+				// threads after this one have lower priority, so drop them
+				memcpy(subp, t + 1, nsubp * sizeof(*subp));
+				matched = 1;
+				break;
+			}
+			if(sp >= input->end)
+				continue;
+			switch(*pc) {
+			case Char:
+				if(*sp != pc[1])
+					continue;
+				len = 2;
+				break;
+			case Any:
+				len = 1;
+				break;
+			case Class:
+			case ClassNot:
+				if(!_re1_5_classmatch(pc + 1, sp))
+					continue;
+				len = 2 + *(unsigned char*)(pc + 1) * 2;
+				break;
+			case NamedClass:
+				if(!_re1_5_namedclassmatch(pc + 1, sp))
+					continue;
+				len = 2;
+				break;
+			default:
+				re1_5_fatal("pikevm");
+				continue;
+			}
+			addthread(&vm, &nlist, pc + len, sp + 1, t + 1);
+		}
+		tmp = clist;
+		clist = nlist;
+		nlist = tmp;
+	}
+	re1_5_free(mem, alloc);
+	return matched;
+}
@@ -0,0 +1,9 @@
+# MicroPython uasyncio module
+# MIT license; Copyright (c) 2019-2020 Damien P. George
+
+from .core import *
+from .event import Event
+from .funcs import wait_for, wait_for_ms, gather
+from .stream import Stream, StreamReader, StreamWriter, wait_readable
+
+__version__ = (3, 0, 0)
@@ -104,4 +104,6 @@ MP_DECLARE_CONST_FUN_OBJ_1(mp_vfs_rmdir_obj);
 MP_DECLARE_CONST_FUN_OBJ_1(mp_vfs_stat_obj);
 MP_DECLARE_CONST_FUN_OBJ_1(mp_vfs_statvfs_obj);
 
+extern const mp_obj_type_t mp_type_vfs_ramblockdev;
+
 #endif // MICROPY_INCLUDED_EXTMOD_VFS_H
@@ -60,6 +60,13 @@ typedef struct _fs_user_mount_t {
 typedef struct _pyb_file_obj_t {
     mp_obj_base_t base;
     FIL fp;
+    #if MICROPY_VFS_FAT_READ_AHEAD_SIZE
+    // Holds the file from read_ahead_start on so small reads don't each go
+    // through the filesystem's single sector window.
+    byte *read_ahead;
+    FSIZE_t read_ahead_start;
+    UINT read_ahead_len;
+    #endif
 } pyb_file_obj_t;
 
 extern const byte fresult_to_errno_table[20];
@@ -66,8 +66,48 @@ STATIC void file_obj_print(const mp_print_t *print, mp_obj_t self_in, mp_print_k
     mp_printf(print, "<io.%s %p>", mp_obj_get_type_str(self_in), MP_OBJ_TO_PTR(self_in));
 }
 
+#if MICROPY_VFS_FAT_READ_AHEAD_SIZE
+// Serves a small read from the read ahead buffer, refilling it from the
+// current sector on when the position is outside it. The file position is
+// kept where the caller expects it, which is cheap because files with a read
+// ahead buffer always have a fast seek table, so native modules that use the
+// FIL directly still see the right position.
+STATIC mp_uint_t file_obj_read_ahead(pyb_file_obj_t *self, byte *buf, mp_uint_t size, int *errcode) {
+    FSIZE_t pos = f_tell(&self->fp);
+    if (pos < self->read_ahead_start || pos >= self->read_ahead_start + self->read_ahead_len) {
+        FSIZE_t start = pos - pos % _MIN_SS;
+        FRESULT res = f_lseek(&self->fp, start);
+        if (res == FR_OK) {
+            res = f_read(&self->fp, self->read_ahead, MICROPY_VFS_FAT_READ_AHEAD_SIZE, &self->read_ahead_len);
+        }
+        if (res != FR_OK) {
+            self->read_ahead_len = 0;
+            f_lseek(&self->fp, pos);
+            *errcode = fresult_to_errno_table[res];
+            return MP_STREAM_ERROR;
+        }
+        self->read_ahead_start = start;
+        if (pos >= start + self->read_ahead_len) {
+            // end of file
+            f_lseek(&self->fp, pos);
+            return 0;
+        }
+    }
+    UINT offset = pos - self->read_ahead_start;
+    mp_uint_t n = MIN(size, self->read_ahead_len - offset);
+    memcpy(buf, self->read_ahead + offset, n);
+    f_lseek(&self->fp, pos + n);
+    return n;
+}
+#endif
+
 STATIC mp_uint_t file_obj_read(mp_obj_t self_in, void *buf, mp_uint_t size, int *errcode) {
     pyb_file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    #if MICROPY_VFS_FAT_READ_AHEAD_SIZE
+    if (self->read_ahead != NULL && size < MICROPY_VFS_FAT_READ_AHEAD_SIZE) {
+        return file_obj_read_ahead(self, buf, size, errcode);
+    }
+    #endif
     UINT sz_out;
     FRESULT res = f_read(&self->fp, buf, size, &sz_out);
     if (res != FR_OK) {
@@ -100,6 +140,27 @@ STATIC mp_obj_t file_obj___exit__(size_t n_args, const mp_obj_t *args) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(file_obj___exit___obj, 4, 4, file_obj___exit__);
 
+#if _USE_EXPAND
+// Allocates a contiguous run of clusters for an empty file without changing
+// its size. Writes then follow the chain that is already in the FAT, so only
+// the directory entry changes when the file is flushed or closed. Any clusters
+// that aren't written stay allocated to the file.
+STATIC mp_obj_t file_obj_preallocate(mp_obj_t self_in, mp_obj_t size_in) {
+    pyb_file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_int_t size = mp_obj_get_int(size_in);
+    if (size <= 0) {
+        mp_raise_OSError(MP_EINVAL);
+    }
+    FRESULT res = f_expand(&self->fp, size, 1);
+    if (res != FR_OK) {
+        mp_raise_OSError(fresult_to_errno_table[res]);
+    }
+    self->fp.obj.objsize = 0;
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(file_obj_preallocate_obj, file_obj_preallocate);
+#endif
+
 STATIC mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg, int *errcode) {
     pyb_file_obj_t *self = MP_OBJ_TO_PTR(o_in);
 
@@ -134,6 +195,11 @@ STATIC mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg,
     } else if (request == MP_STREAM_CLOSE) {
         // if fs==NULL then the file is closed and in that case this method is a no-op
         if (self->fp.obj.fs != NULL) {
+            #if MICROPY_VFS_FAT_READ_AHEAD_SIZE
+            // Close can run as a finaliser during a collection, where freeing
+            // isn't allowed, so leave the buffer for the gc.
+            self->read_ahead = NULL;
+            #endif
             FRESULT res = f_close(&self->fp);
             if (res != FR_OK) {
                 *errcode = fresult_to_errno_table[res];
@@ -195,6 +261,11 @@ STATIC mp_obj_t file_open(fs_user_mount_t *vfs, const mp_obj_type_t *type, mp_ar
 
     pyb_file_obj_t *o = m_new_obj_with_finaliser(pyb_file_obj_t);
     o->base.type = type;
+    #if MICROPY_VFS_FAT_READ_AHEAD_SIZE
+    o->read_ahead = NULL;
+    o->read_ahead_start = 0;
+    o->read_ahead_len = 0;
+    #endif
 
     const char *fname = mp_obj_str_get_str(args[0].u_obj);
     FRESULT res = f_open(&vfs->fatfs, &o->fp, fname, mode);
@@ -218,6 +289,12 @@ STATIC mp_obj_t file_open(fs_user_mount_t *vfs, const mp_obj_type_t *type, mp_ar
                 o->fp.cltbl = NULL;
             }
         }
+        #if MICROPY_VFS_FAT_READ_AHEAD_SIZE
+        // Reading ahead relies on seeking back being cheap.
+        if (o->fp.cltbl != NULL) {
+            o->read_ahead = m_malloc_maybe(MICROPY_VFS_FAT_READ_AHEAD_SIZE, false);
+        }
+        #endif
     }
 
     // for 'a' mode, we must begin at the end of the file
@@ -246,6 +323,9 @@ STATIC const mp_rom_map_elem_t rawfile_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&mp_stream_close_obj) },
     { MP_ROM_QSTR(MP_QSTR_seek), MP_ROM_PTR(&mp_stream_seek_obj) },
     { MP_ROM_QSTR(MP_QSTR_tell), MP_ROM_PTR(&mp_stream_tell_obj) },
+    #if _USE_EXPAND
+    { MP_ROM_QSTR(MP_QSTR_preallocate), MP_ROM_PTR(&file_obj_preallocate_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&mp_stream_close_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&mp_identity_obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&file_obj___exit___obj) },
@@ -0,0 +1,151 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "py/mperrno.h"
+#include "extmod/vfs.h"
+
+#if MICROPY_VFS_RAMBLOCKDEV
+
+// A block device held in RAM, for scratch files that don't need to survive a
+// reset.  Formatting it with VfsFat and mounting it keeps short-lived
+// files off the flash, so they cost neither erase time nor wear.
+typedef struct _mp_obj_vfs_ramblockdev_t {
+    mp_obj_base_t base;
+    uint32_t block_size;
+    uint32_t block_count;
+    byte *data;
+} mp_obj_vfs_ramblockdev_t;
+
+STATIC mp_obj_t ramblockdev_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *all_args, mp_map_t *kw_args) {
+    enum { ARG_block_count, ARG_block_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_block_count, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_block_size, MP_ARG_INT, {.u_int = 512} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, 0, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    (void)kw_args;
+
+    mp_int_t block_count = args[ARG_block_count].u_int;
+    mp_int_t block_size = args[ARG_block_size].u_int;
+    // Both filesystems need power of two blocks of at least 128 bytes.
+    if (block_count <= 0 || block_size < 128 || (block_size & (block_size - 1)) != 0
+        || (size_t)block_count > SIZE_MAX / (size_t)block_size) {
+        mp_raise_ValueError(NULL);
+    }
+
+    mp_obj_vfs_ramblockdev_t *self = m_new_obj(mp_obj_vfs_ramblockdev_t);
+    self->base.type = type;
+    self->block_size = block_size;
+    self->block_count = block_count;
+    self->data = m_new(byte, (size_t)block_count * block_size);
+    memset(self->data, 0, (size_t)block_count * block_size);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+// Check that len bytes at offset into block_num fit in the device, and
+// return where they are.
+STATIC byte *ramblockdev_addr(mp_obj_vfs_ramblockdev_t *self, mp_obj_t block_num_in, size_t n_args, const mp_obj_t *args, size_t len) {
+    mp_int_t block_num = mp_obj_get_int(block_num_in);
+    mp_int_t offset = n_args > 3 ? mp_obj_get_int(args[3]) : 0;
+    size_t size = (size_t)self->block_count * self->block_size;
+    if (block_num < 0 || offset < 0 || (size_t)block_num >= self->block_count) {
+        mp_raise_OSError(MP_EIO);
+    }
+    size_t start = (size_t)block_num * self->block_size + offset;
+    if (start > size || len > size - start) {
+        mp_raise_OSError(MP_EIO);
+    }
+    return self->data + start;
+}
+
+STATIC mp_obj_t ramblockdev_readblocks(size_t n_args, const mp_obj_t *args) {
+    mp_obj_vfs_ramblockdev_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[2], &bufinfo, MP_BUFFER_WRITE);
+    memcpy(bufinfo.buf, ramblockdev_addr(self, args[1], n_args, args, bufinfo.len), bufinfo.len);
+    return MP_OBJ_NEW_SMALL_INT(0);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ramblockdev_readblocks_obj, 3, 4, ramblockdev_readblocks);
+
+STATIC mp_obj_t ramblockdev_writeblocks(size_t n_args, const mp_obj_t *args) {
+    mp_obj_vfs_ramblockdev_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[2], &bufinfo, MP_BUFFER_READ);
+    memcpy(ramblockdev_addr(self, args[1], n_args, args, bufinfo.len), bufinfo.buf, bufinfo.len);
+    return MP_OBJ_NEW_SMALL_INT(0);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ramblockdev_writeblocks_obj, 3, 4, ramblockdev_writeblocks);
+
+STATIC mp_obj_t ramblockdev_ioctl(mp_obj_t self_in, mp_obj_t op_in, mp_obj_t arg_in) {
+    mp_obj_vfs_ramblockdev_t *self = MP_OBJ_TO_PTR(self_in);
+    (void)arg_in;
+    switch (mp_obj_get_int(op_in)) {
+        case BP_IOCTL_INIT:
+        case BP_IOCTL_DEINIT:
+        case BP_IOCTL_SYNC:
+            return MP_OBJ_NEW_SMALL_INT(0);
+        case BP_IOCTL_SEC_COUNT:
+            return mp_obj_new_int_from_uint(self->block_count);
+        case BP_IOCTL_SEC_SIZE:
+            return mp_obj_new_int_from_uint(self->block_size);
+        default:
+            return mp_const_none;
+    }
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(ramblockdev_ioctl_obj, ramblockdev_ioctl);
+
+// The contents can be read directly, which is mostly useful for tests.
+STATIC mp_int_t ramblockdev_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    mp_obj_vfs_ramblockdev_t *self = MP_OBJ_TO_PTR(self_in);
+    if (flags & MP_BUFFER_WRITE) {
+        return 1;
+    }
+    bufinfo->buf = self->data;
+    bufinfo->len = (size_t)self->block_count * self->block_size;
+    bufinfo->typecode = 'B';
+    return 0;
+}
+
+STATIC const mp_rom_map_elem_t ramblockdev_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_readblocks), MP_ROM_PTR(&ramblockdev_readblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_writeblocks), MP_ROM_PTR(&ramblockdev_writeblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ioctl), MP_ROM_PTR(&ramblockdev_ioctl_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(ramblockdev_locals_dict, ramblockdev_locals_dict_table);
+
+const mp_obj_type_t mp_type_vfs_ramblockdev = {
+    { &mp_type_type },
+    .name = MP_QSTR_RAMBlockDevice,
+    .make_new = ramblockdev_make_new,
+    .buffer_p = { .get_buffer = ramblockdev_get_buffer },
+    .locals_dict = (mp_obj_dict_t*)&ramblockdev_locals_dict,
+};
+
+#endif // MICROPY_VFS_RAMBLOCKDEV
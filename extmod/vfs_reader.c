@@ -38,7 +38,7 @@ typedef struct _mp_reader_vfs_t {
     mp_obj_t file;
     uint16_t len;
     uint16_t pos;
-    byte buf[24];
+    byte buf[MICROPY_READER_BUF_SIZE];
 } mp_reader_vfs_t;
 
 STATIC mp_uint_t mp_reader_vfs_readbyte(void *data) {
@@ -63,6 +63,24 @@ STATIC mp_uint_t mp_reader_vfs_readbyte(void *data) {
     return reader->buf[reader->pos++];
 }
 
+STATIC const byte *mp_reader_vfs_readchunk(void *data, size_t *len) {
+    mp_reader_vfs_t *reader = (mp_reader_vfs_t*)data;
+    if (reader->pos >= reader->len && reader->len == sizeof(reader->buf)) {
+        int errcode;
+        reader->len = mp_stream_rw(reader->file, reader->buf, sizeof(reader->buf),
+            &errcode, MP_STREAM_RW_READ | MP_STREAM_RW_ONCE);
+        if (errcode != 0) {
+            // TODO handle errors properly
+            reader->len = 0;
+        }
+        reader->pos = 0;
+    }
+    const byte *buf = reader->buf + reader->pos;
+    *len = reader->pos < reader->len ? reader->len - reader->pos : 0;
+    reader->pos = reader->len;
+    return buf;
+}
+
 STATIC void mp_reader_vfs_close(void *data) {
     mp_reader_vfs_t *reader = (mp_reader_vfs_t*)data;
     mp_stream_close(reader->file);
@@ -81,6 +99,7 @@ void mp_reader_new_file(mp_reader_t *reader, const char *filename) {
     rf->pos = 0;
     reader->data = rf;
     reader->readbyte = mp_reader_vfs_readbyte;
+    reader->readchunk = mp_reader_vfs_readchunk;
     reader->close = mp_reader_vfs_close;
 }
 
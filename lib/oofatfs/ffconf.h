@@ -78,7 +78,11 @@
 /* This option switches fast seek function. (0:Disable or 1:Enable) */
 
 
+#ifdef MICROPY_FATFS_USE_EXPAND
+#define _USE_EXPAND     (MICROPY_FATFS_USE_EXPAND)
+#else
 #define _USE_EXPAND     0
+#endif
 /* This option switches f_expand function. (0:Disable or 1:Enable) */
 
 
@@ -54,12 +54,14 @@ STATIC bool repl_display_debugging_info = 0;
 #define EXEC_FLAG_SOURCE_IS_RAW_CODE (8)
 #define EXEC_FLAG_SOURCE_IS_VSTR (16)
 #define EXEC_FLAG_SOURCE_IS_FILENAME (32)
+#define EXEC_FLAG_SOURCE_IS_READER (64)
 
 // parses, compiles and executes the code in the lexer
 // frees the lexer before returning
 // EXEC_FLAG_PRINT_EOF prints 2 EOF chars: 1 after normal output, 1 after exception output
 // EXEC_FLAG_ALLOW_DEBUGGING allows debugging info to be printed after executing the code
 // EXEC_FLAG_IS_REPL is used for REPL inputs (flag passed on to mp_compile)
+// EXEC_FLAG_SOURCE_IS_READER means source is an mp_reader_t to lex from
 STATIC int parse_compile_execute(const void *source, mp_parse_input_kind_t input_kind, int exec_flags, pyexec_result_t *result) {
     int ret = 0;
     uint32_t start = 0;
@@ -70,6 +72,9 @@ STATIC int parse_compile_execute(const void *source, mp_parse_input_kind_t input
     nlr_buf_t nlr;
     if (nlr_push(&nlr) == 0) {
         mp_obj_t module_fun;
+        #if MICROPY_COMP_INCREMENTAL
+        bool incremental = false;
+        #endif
         #if MICROPY_MODULE_FROZEN_MPY
         if (exec_flags & EXEC_FLAG_SOURCE_IS_RAW_CODE) {
             // source is a raw_code object, create the function
@@ -82,6 +87,8 @@ STATIC int parse_compile_execute(const void *source, mp_parse_input_kind_t input
             if (exec_flags & EXEC_FLAG_SOURCE_IS_VSTR) {
                 const vstr_t *vstr = source;
                 lex = mp_lexer_new_from_str_len(MP_QSTR__lt_stdin_gt_, vstr->buf, vstr->len, 0);
+            } else if (exec_flags & EXEC_FLAG_SOURCE_IS_READER) {
+                lex = mp_lexer_new(MP_QSTR__lt_stdin_gt_, *(mp_reader_t*)source);
             } else if (exec_flags & EXEC_FLAG_SOURCE_IS_FILENAME) {
                 lex = mp_lexer_new_from_file(source);
             } else {
@@ -92,10 +99,19 @@ STATIC int parse_compile_execute(const void *source, mp_parse_input_kind_t input
             if (input_kind == MP_PARSE_FILE_INPUT) {
                 mp_store_global(MP_QSTR___file__, MP_OBJ_NEW_QSTR(source_name));
             }
-            mp_parse_tree_t parse_tree = mp_parse(lex, input_kind);
-            module_fun = mp_compile(&parse_tree, source_name, MP_EMIT_OPT_NONE, exec_flags & EXEC_FLAG_IS_REPL);
-            // Clear the parse tree because it has a heap pointer we don't need anymore.
-            *((uint32_t volatile*) &parse_tree.chunk) = 0;
+            #if MICROPY_COMP_INCREMENTAL
+            if (input_kind == MP_PARSE_FILE_INPUT) {
+                // a list of module functions, one for each top-level statement
+                module_fun = mp_compile_incremental(lex, MP_EMIT_OPT_NONE);
+                incremental = true;
+            } else
+            #endif
+            {
+                mp_parse_tree_t parse_tree = mp_parse(lex, input_kind);
+                module_fun = mp_compile(&parse_tree, source_name, MP_EMIT_OPT_NONE, exec_flags & EXEC_FLAG_IS_REPL);
+                // Clear the parse tree because it has a heap pointer we don't need anymore.
+                *((uint32_t volatile*) &parse_tree.chunk) = 0;
+            }
             #else
             mp_raise_msg(&mp_type_RuntimeError, translate("script compilation not supported"));
             #endif
@@ -104,14 +120,33 @@ STATIC int parse_compile_execute(const void *source, mp_parse_input_kind_t input
         // If the code was loaded from a file its likely to be running for a while so we'll long
         // live it and collect any garbage before running.
         if (input_kind == MP_PARSE_FILE_INPUT) {
-            module_fun = make_obj_long_lived(module_fun, 6);
+            #if MICROPY_COMP_INCREMENTAL
+            if (incremental) {
+                size_t n;
+                mp_obj_t *funs;
+                mp_obj_list_get(module_fun, &n, &funs);
+                for (size_t i = 0; i < n; i++) {
+                    funs[i] = make_obj_long_lived(funs[i], 6);
+                }
+            } else
+            #endif
+            {
+                module_fun = make_obj_long_lived(module_fun, 6);
+            }
             gc_collect();
         }
 
         // execute code
         mp_hal_set_interrupt_char(CHAR_CTRL_C); // allow ctrl-C to interrupt us
         start = mp_hal_ticks_ms();
-        mp_call_function_0(module_fun);
+        #if MICROPY_COMP_INCREMENTAL
+        if (incremental) {
+            mp_call_incremental(module_fun);
+        } else
+        #endif
+        {
+            mp_call_function_0(module_fun);
+        }
         mp_hal_set_interrupt_char(-1); // disable interrupt
         nlr_pop();
         ret = 0;
@@ -182,6 +217,107 @@ STATIC int parse_compile_execute(const void *source, mp_parse_input_kind_t input
 }
 
 #if MICROPY_ENABLE_COMPILER
+
+// Raw-paste mode lets the host stream source into the raw REPL at full speed.
+// The host sends ^E A ^A at the raw REPL prompt; if supported the device replies
+// "R\x01" then a 16-bit little-endian window size.  The host may send that many
+// bytes, and each \x01 from the device grants it one more window.  The source is
+// lexed and compiled as it arrives, so it never has to be buffered whole.  The
+// host ends the data with ^D (or aborts with ^C) and the device replies \x04
+// before running the code and printing its output as for a normal raw REPL
+// command.
+
+// The largest number of bytes the port can hold in its stdin buffer; the flow
+// control window is half of this.
+#ifndef MICROPY_REPL_STDIN_BUFFER_MAX
+#define MICROPY_REPL_STDIN_BUFFER_MAX (256)
+#endif
+
+typedef struct _mp_reader_stdin_t {
+    bool eof;
+    uint16_t window_max;
+    uint16_t window_remain;
+} mp_reader_stdin_t;
+
+STATIC mp_uint_t mp_reader_stdin_readbyte(void *data) {
+    mp_reader_stdin_t *reader = (mp_reader_stdin_t*)data;
+
+    if (reader->eof) {
+        return MP_READER_EOF;
+    }
+
+    int c = mp_hal_stdin_rx_chr();
+
+    if (c == CHAR_CTRL_C || c == CHAR_CTRL_D) {
+        reader->eof = true;
+        mp_hal_stdout_tx_strn("\x04", 1); // indicate end to host
+        if (c == CHAR_CTRL_C) {
+            #if MICROPY_KBD_EXCEPTION
+            MP_STATE_VM(mp_kbd_exception).traceback_data = NULL;
+            nlr_raise(MP_OBJ_FROM_PTR(&MP_STATE_VM(mp_kbd_exception)));
+            #else
+            nlr_raise(mp_obj_new_exception(&mp_type_KeyboardInterrupt));
+            #endif
+        }
+        return MP_READER_EOF;
+    }
+
+    if (--reader->window_remain == 0) {
+        mp_hal_stdout_tx_strn("\x01", 1); // indicate another window is free
+        reader->window_remain = reader->window_max;
+    }
+
+    return c;
+}
+
+STATIC void mp_reader_stdin_close(void *data) {
+    mp_reader_stdin_t *reader = (mp_reader_stdin_t*)data;
+    if (!reader->eof) {
+        // The lexer stopped early (eg on a syntax error) so drain what the
+        // host is still sending, up to its end marker.
+        reader->eof = true;
+        mp_hal_stdout_tx_strn("\x04", 1); // indicate end to host
+        for (;;) {
+            int c = mp_hal_stdin_rx_chr();
+            if (c == CHAR_CTRL_C || c == CHAR_CTRL_D) {
+                break;
+            }
+        }
+    }
+}
+
+STATIC void mp_reader_new_stdin(mp_reader_t *reader, mp_reader_stdin_t *reader_stdin, uint16_t buf_max) {
+    // Sending the window size implicitly frees one window, and the \x01 that
+    // follows frees a second, so the host can fill the whole buffer at once.
+    size_t window = buf_max / 2;
+    char reply[3] = { window & 0xff, window >> 8, 0x01 };
+    mp_hal_stdout_tx_strn(reply, sizeof(reply));
+
+    reader_stdin->eof = false;
+    reader_stdin->window_max = window;
+    reader_stdin->window_remain = window;
+    reader->data = reader_stdin;
+    reader->readbyte = mp_reader_stdin_readbyte;
+    reader->readchunk = NULL;
+    reader->close = mp_reader_stdin_close;
+}
+
+STATIC int do_reader_stdin(int c) {
+    if (c != 'A') {
+        // unsupported raw-paste variant
+        mp_hal_stdout_tx_strn("R\x00", 2);
+        return 0;
+    }
+
+    // indicate reception of command
+    mp_hal_stdout_tx_strn("R\x01", 2);
+
+    mp_reader_t reader;
+    mp_reader_stdin_t reader_stdin;
+    mp_reader_new_stdin(&reader, &reader_stdin, MICROPY_REPL_STDIN_BUFFER_MAX);
+    return parse_compile_execute(&reader, MP_PARSE_FILE_INPUT, EXEC_FLAG_PRINT_EOF | EXEC_FLAG_SOURCE_IS_READER, NULL);
+}
+
 #if MICROPY_REPL_EVENT_DRIVEN
 
 typedef struct _repl_t {
@@ -212,6 +348,15 @@ void pyexec_event_repl_init(void) {
 
 STATIC int pyexec_raw_repl_process_char(int c) {
     if (c == CHAR_CTRL_A) {
+        vstr_t *line = MP_STATE_VM(repl_line);
+        if (line->len == 2 && line->buf[0] == CHAR_CTRL_E) {
+            // the host is asking for raw-paste mode
+            int ret = do_reader_stdin(line->buf[1]);
+            if (ret & PYEXEC_FORCED_EXIT) {
+                return ret;
+            }
+            goto reset;
+        }
         // reset raw REPL
         mp_hal_stdout_tx_str("raw REPL; CTRL-B to exit\r\n");
         goto reset;
@@ -357,11 +502,20 @@ raw_repl_reset:
     mp_hal_stdout_tx_str("raw REPL; CTRL-B to exit\r\n");
 
     for (;;) {
+    raw_repl_next:
         vstr_reset(&line);
         mp_hal_stdout_tx_str(">");
         for (;;) {
             int c = mp_hal_stdin_rx_chr();
             if (c == CHAR_CTRL_A) {
+                if (line.len == 2 && line.buf[0] == CHAR_CTRL_E) {
+                    // the host is asking for raw-paste mode
+                    int ret = do_reader_stdin(line.buf[1]);
+                    if (ret & PYEXEC_FORCED_EXIT) {
+                        return ret;
+                    }
+                    goto raw_repl_next;
+                }
                 // reset raw REPL
                 goto raw_repl_reset;
             } else if (c == CHAR_CTRL_B) {
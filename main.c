@@ -35,9 +35,11 @@
 #include "py/compile.h"
 #include "py/frozenmod.h"
 #include "py/mphal.h"
+#include "py/mpthread.h"
 #include "py/runtime.h"
 #include "py/repl.h"
 #include "py/gc.h"
+#include "py/objfun.h"
 #include "py/stackctrl.h"
 
 #include "lib/mp-readline/readline.h"
@@ -50,6 +52,8 @@
 #include "supervisor/port.h"
 #include "supervisor/filesystem.h"
 #include "supervisor/shared/autoreload.h"
+#include "supervisor/shared/gc_trace.h"
+#include "supervisor/shared/perf.h"
 #include "supervisor/shared/translate.h"
 #include "supervisor/shared/rgb_led_status.h"
 #include "supervisor/shared/safe_mode.h"
@@ -61,6 +65,7 @@
 
 #if CIRCUITPY_DISPLAYIO
 #include "shared-module/displayio/__init__.h"
+#include "supervisor/shared/display.h"
 #endif
 
 #if CIRCUITPY_NETWORK
@@ -76,6 +81,14 @@
 #include "supervisor/shared/bluetooth.h"
 #endif
 
+#if CIRCUITPY_KEYPAD
+#include "shared-module/keypad/__init__.h"
+#endif
+
+#if CIRCUITPY_PROFILER
+#include "shared-module/profiler/__init__.h"
+#endif
+
 void do_str(const char *src, mp_parse_input_kind_t input_kind) {
     mp_lexer_t *lex = mp_lexer_new_from_str_len(MP_QSTR__lt_stdin_gt_, src, strlen(src), 0);
     if (lex == NULL) {
@@ -96,6 +109,187 @@ void do_str(const char *src, mp_parse_input_kind_t input_kind) {
     }
 }
 
+#if CIRCUITPY_MODULE_SNAPSHOT
+// Frozen modules imported by the last VM, kept on its heap so that the next VM
+// can use them without running their code again. While a snapshot is held the
+// heap stays allocated, and the GC usable, between VMs.
+static supervisor_allocation* snapshot_heap = NULL;
+static mp_obj_dict_t* snapshot_modules = NULL;
+static qstr_pool_t* snapshot_qstr_pool = NULL;
+static byte* snapshot_qstr_chunk = NULL;
+static size_t snapshot_qstr_alloc;
+static size_t snapshot_qstr_used;
+
+STATIC bool module_is_frozen(mp_obj_t module) {
+    if (!MP_OBJ_IS_TYPE(module, &mp_type_module)) {
+        return false;
+    }
+    mp_obj_dict_t* globals = mp_obj_module_get_globals(module);
+    mp_map_elem_t* file = mp_map_lookup(&globals->map, MP_OBJ_NEW_QSTR(MP_QSTR___file__), MP_MAP_LOOKUP);
+    if (file == NULL || !MP_OBJ_IS_STR(file->value)) {
+        return false;
+    }
+    size_t len;
+    const char* path = mp_obj_str_get_data(file->value, &len);
+    return len > MP_FROZEN_FAKE_DIR_SLASH_LENGTH &&
+        strncmp(path, MP_FROZEN_FAKE_DIR_SLASH, MP_FROZEN_FAKE_DIR_SLASH_LENGTH) == 0;
+}
+
+STATIC bool snapshot_has_globals(mp_obj_dict_t* kept, mp_obj_dict_t* globals) {
+    for (size_t i = 0; i < kept->map.alloc; i++) {
+        if (MP_MAP_SLOT_IS_FILLED(&kept->map, i) &&
+            mp_obj_module_get_globals(kept->map.table[i].value) == globals) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// A module can only be kept if the modules and functions in its globals are
+// in ROM or kept too. Anything that came from the filesystem may have changed
+// and has to be imported again, along with the modules that refer to it.
+STATIC bool snapshot_can_keep(mp_obj_dict_t* kept, mp_obj_dict_t* globals) {
+    for (size_t i = 0; i < globals->map.alloc; i++) {
+        if (!MP_MAP_SLOT_IS_FILLED(&globals->map, i)) {
+            continue;
+        }
+        mp_obj_t value = globals->map.table[i].value;
+        mp_obj_dict_t* other = NULL;
+        if (MP_OBJ_IS_TYPE(value, &mp_type_module)) {
+            other = mp_obj_module_get_globals(value);
+        } else if (MP_OBJ_IS_TYPE(value, &mp_type_fun_bc)) {
+            other = ((mp_obj_fun_bc_t*) MP_OBJ_TO_PTR(value))->globals;
+        }
+        if (other == NULL || other == globals || gc_nbytes(other) == 0) {
+            continue;
+        }
+        if (!snapshot_has_globals(kept, other)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+STATIC void snapshot_gc_collect(void) {
+    gc_collect_ptr(snapshot_modules);
+    gc_collect_ptr(snapshot_qstr_pool);
+    gc_collect_ptr(snapshot_qstr_chunk);
+}
+
+// Called instead of gc_deinit. Frees everything on the heap apart from the
+// frozen modules that can be kept and the qstrs they may use. Returns false,
+// leaving the heap alone, if there is nothing to keep.
+STATIC bool snapshot_take(supervisor_allocation* heap) {
+    mp_obj_dict_t* kept;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        kept = MP_OBJ_TO_PTR(mp_obj_new_dict(0));
+        mp_map_t* loaded = &MP_STATE_VM(mp_loaded_modules_dict).map;
+        for (size_t i = 0; i < loaded->alloc; i++) {
+            if (MP_MAP_SLOT_IS_FILLED(loaded, i) && module_is_frozen(loaded->table[i].value)) {
+                mp_obj_dict_store(MP_OBJ_FROM_PTR(kept), loaded->table[i].key, loaded->table[i].value);
+            }
+        }
+        nlr_pop();
+    } else {
+        return false;
+    }
+    // Dropping one module can make others unkeepable, so repeat until stable.
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t i = 0; i < kept->map.alloc; i++) {
+            if (!MP_MAP_SLOT_IS_FILLED(&kept->map, i)) {
+                continue;
+            }
+            mp_obj_t module = kept->map.table[i].value;
+            if (!snapshot_can_keep(kept, mp_obj_module_get_globals(module))) {
+                mp_map_lookup(&kept->map, kept->map.table[i].key, MP_MAP_LOOKUP_REMOVE_IF_FOUND);
+                changed = true;
+            }
+        }
+    }
+    if (kept->map.used == 0) {
+        return false;
+    }
+
+    snapshot_modules = kept;
+    snapshot_qstr_pool = MP_STATE_VM(last_pool);
+    snapshot_qstr_chunk = MP_STATE_VM(qstr_last_chunk);
+    snapshot_qstr_alloc = MP_STATE_VM(qstr_last_alloc);
+    snapshot_qstr_used = MP_STATE_VM(qstr_last_used);
+
+    gc_collect_start_without_roots();
+    snapshot_gc_collect();
+    // Keep what supervisor_move_memory would otherwise move off the heap.
+    #if CIRCUITPY_DISPLAYIO
+    gc_collect_ptr(MP_STATE_VM(terminal_tilegrid_tiles));
+    displayio_gc_collect();
+    #endif
+    #if CIRCUITPY_BLEIO
+    common_hal_bleio_gc_collect();
+    #endif
+    gc_collect_end();
+
+    snapshot_heap = heap;
+    return true;
+}
+
+// Gives up the snapshot and frees its heap as cleanup_after_vm would have.
+STATIC void snapshot_discard(void) {
+    if (snapshot_heap == NULL) {
+        return;
+    }
+    snapshot_modules = NULL;
+    snapshot_qstr_pool = NULL;
+    snapshot_qstr_chunk = NULL;
+    gc_deinit();
+    free_memory(snapshot_heap);
+    snapshot_heap = NULL;
+    supervisor_move_memory();
+}
+
+// Called after mp_init on the snapshot's heap. Puts back the qstrs and the
+// kept modules so that importing them again finds them in sys.modules.
+STATIC void snapshot_restore(void) {
+    MP_STATE_VM(last_pool) = snapshot_qstr_pool;
+    MP_STATE_VM(qstr_last_chunk) = snapshot_qstr_chunk;
+    MP_STATE_VM(qstr_last_alloc) = snapshot_qstr_alloc;
+    MP_STATE_VM(qstr_last_used) = snapshot_qstr_used;
+
+    mp_map_t* loaded = &MP_STATE_VM(mp_loaded_modules_dict).map;
+    for (size_t i = 0; i < snapshot_modules->map.alloc; i++) {
+        if (MP_MAP_SLOT_IS_FILLED(&snapshot_modules->map, i)) {
+            mp_map_lookup(loaded, snapshot_modules->map.table[i].key, MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)->value =
+                snapshot_modules->map.table[i].value;
+        }
+    }
+
+    snapshot_heap = NULL;
+    snapshot_modules = NULL;
+    snapshot_qstr_pool = NULL;
+    snapshot_qstr_chunk = NULL;
+}
+#endif
+
+// Gets the stack and filesystem ready for a new VM and returns its heap.
+STATIC supervisor_allocation* allocate_vm_heap(void) {
+    #if CIRCUITPY_MODULE_SNAPSHOT
+    if (stack_resize_pending()) {
+        // The stack can't move while the snapshot holds on to the heap.
+        snapshot_discard();
+    }
+    #endif
+    stack_resize();
+    filesystem_flush();
+    #if CIRCUITPY_MODULE_SNAPSHOT
+    if (snapshot_heap != NULL) {
+        return snapshot_heap;
+    }
+    #endif
+    return allocate_remaining_memory();
+}
+
 void start_mp(supervisor_allocation* heap) {
     reset_status_led();
     autoreload_stop();
@@ -126,10 +320,28 @@ void start_mp(supervisor_allocation* heap) {
     // Clear the readline history. It references the heap we're about to destroy.
     readline_init0();
 
-    #if MICROPY_ENABLE_GC
-    gc_init(heap->ptr, heap->ptr + heap->length / 4);
+    #if CIRCUITPY_MODULE_SNAPSHOT
+    bool resume_snapshot = snapshot_heap != NULL && heap == snapshot_heap;
+    if (!resume_snapshot)
     #endif
+    {
+        #if MICROPY_ENABLE_GC
+        gc_init(heap->ptr, heap->ptr + heap->length / 4);
+        #if MICROPY_GC_SPLIT_HEAP
+        uint32_t *extra_bottom;
+        uint32_t *extra_top;
+        if (port_heap_get_extra(&extra_bottom, &extra_top)) {
+            gc_add(extra_bottom, extra_top);
+        }
+        #endif
+        #endif
+    }
     mp_init();
+    #if CIRCUITPY_MODULE_SNAPSHOT
+    if (resume_snapshot) {
+        snapshot_restore();
+    }
+    #endif
     mp_obj_list_init(mp_sys_path, 0);
     mp_obj_list_append(mp_sys_path, MP_OBJ_NEW_QSTR(MP_QSTR_)); // current dir (or base dir of the script)
     mp_obj_list_append(mp_sys_path, MP_OBJ_NEW_QSTR(MP_QSTR__slash_));
@@ -145,7 +357,7 @@ void start_mp(supervisor_allocation* heap) {
     #endif
 }
 
-void stop_mp(void) {
+void stop_mp(supervisor_allocation* heap) {
     #if CIRCUITPY_NETWORK
     network_module_deinit();
     #endif
@@ -161,6 +373,13 @@ void stop_mp(void) {
     MP_STATE_VM(vfs_cur) = vfs;
     #endif
 
+    #if CIRCUITPY_MODULE_SNAPSHOT
+    if (snapshot_take(heap)) {
+        return;
+    }
+    #else
+    (void) heap;
+    #endif
     gc_deinit();
 }
 
@@ -193,14 +412,32 @@ bool maybe_run_list(const char ** filenames, pyexec_result_t* exec_result) {
 }
 
 void cleanup_after_vm(supervisor_allocation* heap) {
+    #if MICROPY_PY_THREAD
+    // Stop any threads the program left running before their heap goes away.
+    mp_thread_deinit();
+    #endif
+
     // Turn off the display and flush the fileystem before the heap disappears.
     #if CIRCUITPY_DISPLAYIO
     reset_displays();
     #endif
     filesystem_flush();
-    stop_mp();
-    free_memory(heap);
-    supervisor_move_memory();
+    #if CIRCUITPY_KEYPAD
+    // The scanners and their queues are on the heap.
+    keypad_reset();
+    #endif
+    #if CIRCUITPY_PROFILER
+    // The samples refer to qstrs on the heap.
+    reset_profiler();
+    #endif
+    stop_mp(heap);
+    #if CIRCUITPY_MODULE_SNAPSHOT
+    if (snapshot_heap == NULL)
+    #endif
+    {
+        free_memory(heap);
+        supervisor_move_memory();
+    }
 
     reset_port();
     #if CIRCUITPY_BOARD
@@ -208,6 +445,13 @@ void cleanup_after_vm(supervisor_allocation* heap) {
     #endif
     reset_board();
     reset_status_led();
+    #ifdef USB_AVAILABLE
+    // Don't drop anything the REPL prints.
+    serial_set_write_blocking(true);
+    #endif
+    #if CIRCUITPY_DISPLAYIO
+    supervisor_terminal_set_while_serial_connected(true);
+    #endif
 }
 
 bool run_code_py(safe_mode_t safe_mode) {
@@ -242,9 +486,7 @@ bool run_code_py(safe_mode_t safe_mode) {
         static const char *double_extension_filenames[] = STRING_LIST("code.txt.py", "code.py.txt", "code.txt.txt","code.py.py",
                                                     "main.txt.py", "main.py.txt", "main.txt.txt","main.py.py");
 
-        stack_resize();
-        filesystem_flush();
-        supervisor_allocation* heap = allocate_remaining_memory();
+        supervisor_allocation* heap = allocate_vm_heap();
         start_mp(heap);
         found_main = maybe_run_list(supported_filenames, &result);
         if (!found_main){
@@ -390,14 +632,16 @@ void __attribute__ ((noinline)) run_boot_py(safe_mode_t safe_mode) {
         #endif
 
         cleanup_after_vm(heap);
+        #if CIRCUITPY_MODULE_SNAPSHOT
+        // USB and BLE start after boot.py and need memory outside the heap.
+        snapshot_discard();
+        #endif
     }
 }
 
 int run_repl(void) {
     int exit_code = PYEXEC_FORCED_EXIT;
-    stack_resize();
-    filesystem_flush();
-    supervisor_allocation* heap = allocate_remaining_memory();
+    supervisor_allocation* heap = allocate_vm_heap();
     start_mp(heap);
     autoreload_suspend();
     new_status_color(REPL_RUNNING);
@@ -412,6 +656,12 @@ int run_repl(void) {
 }
 
 int __attribute__((used)) main(void) {
+    #if MICROPY_PY_THREAD
+    // nlr and the stack checks reach MP_STATE_THREAD through the thread local
+    // storage that this sets up for the main task.
+    mp_thread_init();
+    #endif
+
     memory_init();
 
     // initialise the cpu and peripherals
@@ -438,6 +688,9 @@ int __attribute__((used)) main(void) {
 
     // Start the debug serial
     serial_early_init();
+    #if CIRCUITPY_GC_TRACE
+    gc_trace_init();
+    #endif
 
     // Reset everything and prep MicroPython to run boot.py.
     reset_port();
@@ -483,6 +736,7 @@ int __attribute__((used)) main(void) {
 }
 
 void gc_collect(void) {
+    PERF_START();
     gc_collect_start();
 
     mp_uint_t regs[10];
@@ -500,10 +754,24 @@ void gc_collect(void) {
     common_hal_bleio_gc_collect();
     #endif
 
+    #if CIRCUITPY_MODULE_SNAPSHOT
+    snapshot_gc_collect();
+    #endif
+
+    uint32_t stack_top = (uint32_t)port_stack_get_top();
+    #if MICROPY_PY_THREAD
+    if (mp_thread_get_state() != &mp_state_ctx.thread) {
+        // Collecting from a _thread thread, which runs on its own stack.
+        stack_top = (uint32_t)MP_STATE_THREAD(stack_top);
+    }
+    mp_thread_gc_others();
+    #endif
+
     // This naively collects all object references from an approximate stack
     // range.
-    gc_collect_root((void**)sp, ((uint32_t)port_stack_get_top() - sp) / sizeof(uint32_t));
+    gc_collect_root((void**)sp, (stack_top - sp) / sizeof(uint32_t));
     gc_collect_end();
+    PERF_END(PERF_COUNTER_GC);
 }
 
 void NORETURN nlr_jump_fail(void *val) {
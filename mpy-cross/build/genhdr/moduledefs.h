@@ -0,0 +1,5 @@
+// Automatically generated by makemoduledefs.py.
+
+
+#define MICROPY_REGISTERED_MODULES \
+// MICROPY_REGISTERED_MODULES
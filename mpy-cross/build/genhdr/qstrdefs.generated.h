@@ -0,0 +1,773 @@
+// 32   939 000 0
+// 97 a 525 0010 2
+// 101 e 897 0011 3
+// 105 i 493 0100 4
+// 110 n 597 0101 5
+// 111 o 582 0110 6
+// 114 r 576 0111 7
+// 115 s 579 1000 8
+// 116 t 804 1001 9
+// 99 c 327 10100 20
+// 100 d 335 10101 21
+// 108 l 318 10110 22
+// 109 m 263 10111 23
+// 112 p 254 11000 24
+// 117 u 325 11001 25
+// 39 \' 146 110100 52
+// 95 _ 218 110101 53
+// 98 b 182 110110 54
+// 102 f 172 110111 55
+// 103 g 160 111000 56
+// 37 % 91 1110010 114
+// 69 E 69 1110011 115
+// 104 h 98 1110100 116
+// 118 v 90 1110101 117
+// 119 w 67 1110110 118
+// 120 x 108 1110111 119
+// 121 y 106 1111000 120
+// 78 N 33 11110010 242
+// 106 j 35 11110011 243
+// 107 k 46 11110100 244
+// 113 q 57 11110101 245
+// 40 ( 24 111101100 492
+// 41 ) 24 111101101 493
+// 45 - 23 111101110 494
+// 49 1 24 111101111 495
+// 54 6 19 111110000 496
+// 73 I 18 111110001 497
+// 79 O 19 111110010 498
+// 83 S 18 111110011 499
+// 42 * 9 1111101000 1000
+// 44 , 14 1111101001 1001
+// 47 / 9 1111101010 1002
+// 48 0 12 1111101011 1003
+// 50 2 12 1111101100 1004
+// 51 3 12 1111101101 1005
+// 56 8 15 1111101110 1006
+// 58 : 10 1111101111 1007
+// 60 < 9 1111110000 1008
+// 62 > 9 1111110001 1009
+// 65 A 14 1111110010 1010
+// 67 C 9 1111110011 1011
+// 68 D 10 1111110100 1012
+// 82 R 13 1111110101 1013
+// 84 T 15 1111110110 1014
+// 85 U 10 1111110111 1015
+// 122 z 9 1111111000 1016
+// 35 # 5 11111110010 2034
+// 46 . 8 11111110011 2035
+// 66 B 5 11111110100 2036
+// 70 F 7 11111110101 2037
+// 71 G 4 11111110110 2038
+// 77 M 6 11111110111 2039
+// 80 P 7 11111111000 2040
+// 125 } 5 11111111001 2041
+// 10 \n 3 111111110100 4084
+// 13 \r 2 111111110101 4085
+// 61 = 4 111111110110 4086
+// 72 H 3 111111110111 4087
+// 75 K 2 111111111000 4088
+// 76 L 4 111111111001 4089
+// 86 V 3 111111111010 4090
+// 123 { 3 111111111011 4091
+// 34 \" 2 1111111111000 8184
+// 52 4 1 1111111111001 8185
+// 59 ; 1 1111111111010 8186
+// 88 X 1 1111111111011 8187
+// 89 Y 1 1111111111100 8188
+// 90 Z 1 1111111111101 8189
+// 91 [ 1 1111111111110 8190
+// 93 ] 1 1111111111111 8191
+// length count {3: 1, 4: 8, 5: 6, 6: 5, 7: 7, 8: 4, 9: 8, 10: 17, 11: 8, 12: 8, 13: 8}
+// values [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', 'c', 'd', 'l', 'm', 'p', 'u', "'", '_', 'b', 'f', 'g', '%', 'E', 'h', 'v', 'w', 'x', 'y', 'N', 'j', 'k', 'q', '(', ')', '-', '1', '6', 'I', 'O', 'S', '*', ',', '/', '0', '2', '3', '8', ':', '<', '>', 'A', 'C', 'D', 'R', 'T', 'U', 'z', '#', '.', 'B', 'F', 'G', 'M', 'P', '}', '\n', '\r', '=', 'H', 'K', 'L', 'V', '{', '"', '4', ';', 'X', 'Y', 'Z', '[', ']'] lengths 14 bytearray(b'\x00\x00\x01\x08\x06\x05\x07\x04\x08\x11\x08\x08\x08\x00')
+// estimated total memory size 47705
+// [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', 'c', 'd', 'l', 'm', 'p', 'u', "'", '_', 'b', 'f', 'g', '%', 'E', 'h', 'v', 'w', 'x', 'y', 'N', 'j', 'k', 'q', '(', ')', '-', '1', '6', 'I', 'O', 'S', '*', ',', '/', '0', '2', '3', '8', ':', '<', '>', 'A', 'C', 'D', 'R', 'T', 'U', 'z', '#', '.', 'B', 'F', 'G', 'M', 'P', '}', '\n', '\r', '=', 'H', 'K', 'L', 'V', '{', '"', '4', ';', 'X', 'Y', 'Z', '[', ']'] bytearray(b'\x00\x00\x01\x08\x06\x05\x07\x04\x08\x11\x08\x08\x08\x00')
+// This file was automatically generated by makeqstrdata.py
+
+QDEF(MP_QSTR_NULL, (const byte*)"\x00\x00\x00" "")
+QDEF(MP_QSTR_, (const byte*)"\x05\x15\x00" "")
+QDEF(MP_QSTR___add__, (const byte*)"\xc4\x82\x07" "__add__")
+QDEF(MP_QSTR___aenter__, (const byte*)"\x4c\x84\x0a" "__aenter__")
+QDEF(MP_QSTR___aexit__, (const byte*)"\xc4\xcf\x09" "__aexit__")
+QDEF(MP_QSTR___aiter__, (const byte*)"\x4e\x2b\x09" "__aiter__")
+QDEF(MP_QSTR___anext__, (const byte*)"\x83\xb4\x09" "__anext__")
+QDEF(MP_QSTR___bool__, (const byte*)"\x2b\x65\x08" "__bool__")
+QDEF(MP_QSTR___build_class__, (const byte*)"\x42\x88\x0f" "__build_class__")
+QDEF(MP_QSTR___bytes__, (const byte*)"\xdc\x81\x09" "__bytes__")
+QDEF(MP_QSTR___call__, (const byte*)"\xa7\xf9\x08" "__call__")
+QDEF(MP_QSTR___class__, (const byte*)"\x2b\xc5\x09" "__class__")
+QDEF(MP_QSTR___contains__, (const byte*)"\xc6\x5f\x0c" "__contains__")
+QDEF(MP_QSTR___delitem__, (const byte*)"\xfd\x35\x0b" "__delitem__")
+QDEF(MP_QSTR___dict__, (const byte*)"\x7f\x54\x08" "__dict__")
+QDEF(MP_QSTR___enter__, (const byte*)"\x6d\xba\x09" "__enter__")
+QDEF(MP_QSTR___eq__, (const byte*)"\x71\x3e\x06" "__eq__")
+QDEF(MP_QSTR___exit__, (const byte*)"\x45\xf8\x08" "__exit__")
+QDEF(MP_QSTR___ge__, (const byte*)"\xa7\x46\x06" "__ge__")
+QDEF(MP_QSTR___getattr__, (const byte*)"\x40\xf8\x0b" "__getattr__")
+QDEF(MP_QSTR___getitem__, (const byte*)"\x26\x39\x0b" "__getitem__")
+QDEF(MP_QSTR___gt__, (const byte*)"\xb6\x82\x06" "__gt__")
+QDEF(MP_QSTR___hash__, (const byte*)"\xf7\xc8\x08" "__hash__")
+QDEF(MP_QSTR___iadd__, (const byte*)"\x6d\x4a\x08" "__iadd__")
+QDEF(MP_QSTR___import__, (const byte*)"\x38\x3e\x0a" "__import__")
+QDEF(MP_QSTR___init__, (const byte*)"\x5f\xa5\x08" "__init__")
+QDEF(MP_QSTR___isub__, (const byte*)"\x08\x78\x08" "__isub__")
+QDEF(MP_QSTR___iter__, (const byte*)"\xcf\x32\x08" "__iter__")
+QDEF(MP_QSTR___le__, (const byte*)"\xcc\x13\x06" "__le__")
+QDEF(MP_QSTR___len__, (const byte*)"\xe2\xb0\x07" "__len__")
+QDEF(MP_QSTR___lt__, (const byte*)"\x5d\x68\x06" "__lt__")
+QDEF(MP_QSTR___main__, (const byte*)"\x8e\x13\x08" "__main__")
+QDEF(MP_QSTR___module__, (const byte*)"\xff\x30\x0a" "__module__")
+QDEF(MP_QSTR___name__, (const byte*)"\xe2\x38\x08" "__name__")
+QDEF(MP_QSTR___new__, (const byte*)"\x79\x15\x07" "__new__")
+QDEF(MP_QSTR___next__, (const byte*)"\x02\x73\x08" "__next__")
+QDEF(MP_QSTR___path__, (const byte*)"\xc8\x23\x08" "__path__")
+QDEF(MP_QSTR___qualname__, (const byte*)"\x6b\x00\x0c" "__qualname__")
+QDEF(MP_QSTR___repl_print__, (const byte*)"\x00\xbb\x0e" "__repl_print__")
+QDEF(MP_QSTR___repr__, (const byte*)"\x10\x0b\x08" "__repr__")
+QDEF(MP_QSTR___reversed__, (const byte*)"\x61\xff\x0c" "__reversed__")
+QDEF(MP_QSTR___setitem__, (const byte*)"\x32\x3e\x0b" "__setitem__")
+QDEF(MP_QSTR___str__, (const byte*)"\xd0\xcd\x07" "__str__")
+QDEF(MP_QSTR___sub__, (const byte*)"\x21\x09\x07" "__sub__")
+QDEF(MP_QSTR___traceback__, (const byte*)"\x4f\xcf\x0d" "__traceback__")
+QDEF(MP_QSTR__star_, (const byte*)"\x8f\xb5\x01" "*")
+QDEF(MP_QSTR__, (const byte*)"\xfa\xb5\x01" "_")
+QDEF(MP_QSTR__slash_, (const byte*)"\x8a\xb5\x01" "/")
+QDEF(MP_QSTR__percent__hash_o, (const byte*)"\x6c\x1a\x03" "%#o")
+QDEF(MP_QSTR__percent__hash_x, (const byte*)"\x7b\x1a\x03" "%#x")
+QDEF(MP_QSTR__brace_open__colon__hash_b_brace_close_, (const byte*)"\x58\x37\x05" "{:#b}")
+QDEF(MP_QSTR__space_, (const byte*)"\x85\xb5\x01" " ")
+QDEF(MP_QSTR__0x0a_, (const byte*)"\xaf\xb5\x01" "\x0a")
+QDEF(MP_QSTR_maximum_space_recursion_space_depth_space_exceeded, (const byte*)"\x73\x1e\x20" "maximum recursion depth exceeded")
+QDEF(MP_QSTR__lt_module_gt_, (const byte*)"\xbd\x94\x08" "<module>")
+QDEF(MP_QSTR__lt_lambda_gt_, (const byte*)"\x80\x8c\x08" "<lambda>")
+QDEF(MP_QSTR__lt_listcomp_gt_, (const byte*)"\xd4\x15\x0a" "<listcomp>")
+QDEF(MP_QSTR__lt_dictcomp_gt_, (const byte*)"\xcc\x8d\x0a" "<dictcomp>")
+QDEF(MP_QSTR__lt_setcomp_gt_, (const byte*)"\x54\x51\x09" "<setcomp>")
+QDEF(MP_QSTR__lt_genexpr_gt_, (const byte*)"\x34\x6a\x09" "<genexpr>")
+QDEF(MP_QSTR__lt_string_gt_, (const byte*)"\x52\x53\x08" "<string>")
+QDEF(MP_QSTR__lt_stdin_gt_, (const byte*)"\xe3\x63\x07" "<stdin>")
+QDEF(MP_QSTR_utf_hyphen_8, (const byte*)"\xb7\x82\x05" "utf-8")
+QDEF(MP_QSTR_ArithmeticError, (const byte*)"\x2d\x8c\x0f" "ArithmeticError")
+QDEF(MP_QSTR_AssertionError, (const byte*)"\x97\x5a\x0e" "AssertionError")
+QDEF(MP_QSTR_AttributeError, (const byte*)"\x21\xde\x0e" "AttributeError")
+QDEF(MP_QSTR_BaseException, (const byte*)"\x07\x92\x0d" "BaseException")
+QDEF(MP_QSTR_EACCES, (const byte*)"\x37\xc2\x06" "EACCES")
+QDEF(MP_QSTR_EADDRINUSE, (const byte*)"\x17\x11\x0a" "EADDRINUSE")
+QDEF(MP_QSTR_EAGAIN, (const byte*)"\x20\xec\x06" "EAGAIN")
+QDEF(MP_QSTR_EALREADY, (const byte*)"\x46\x15\x08" "EALREADY")
+QDEF(MP_QSTR_EBADF, (const byte*)"\x61\xa3\x05" "EBADF")
+QDEF(MP_QSTR_ECONNABORTED, (const byte*)"\x27\xab\x0c" "ECONNABORTED")
+QDEF(MP_QSTR_ECONNREFUSED, (const byte*)"\x3a\x2c\x0c" "ECONNREFUSED")
+QDEF(MP_QSTR_ECONNRESET, (const byte*)"\x19\xfb\x0a" "ECONNRESET")
+QDEF(MP_QSTR_EEXIST, (const byte*)"\x53\xad\x06" "EEXIST")
+QDEF(MP_QSTR_EHOSTUNREACH, (const byte*)"\x86\x25\x0c" "EHOSTUNREACH")
+QDEF(MP_QSTR_EINPROGRESS, (const byte*)"\x9a\xa0\x0b" "EINPROGRESS")
+QDEF(MP_QSTR_EINVAL, (const byte*)"\x5c\xff\x06" "EINVAL")
+QDEF(MP_QSTR_EIO, (const byte*)"\x86\xa6\x03" "EIO")
+QDEF(MP_QSTR_EISDIR, (const byte*)"\xa5\x4f\x06" "EISDIR")
+QDEF(MP_QSTR_ENOBUFS, (const byte*)"\xe3\x87\x07" "ENOBUFS")
+QDEF(MP_QSTR_ENODEV, (const byte*)"\xb6\x67\x06" "ENODEV")
+QDEF(MP_QSTR_ENOENT, (const byte*)"\x5e\x65\x06" "ENOENT")
+QDEF(MP_QSTR_ENOMEM, (const byte*)"\xa4\x85\x06" "ENOMEM")
+QDEF(MP_QSTR_ENOTCONN, (const byte*)"\x79\xd7\x08" "ENOTCONN")
+QDEF(MP_QSTR_EOFError, (const byte*)"\x91\xbf\x08" "EOFError")
+QDEF(MP_QSTR_EOPNOTSUPP, (const byte*)"\xac\x97\x0a" "EOPNOTSUPP")
+QDEF(MP_QSTR_EPERM, (const byte*)"\xea\x7f\x05" "EPERM")
+QDEF(MP_QSTR_ETIMEDOUT, (const byte*)"\xff\xf8\x09" "ETIMEDOUT")
+QDEF(MP_QSTR_Ellipsis, (const byte*)"\xf0\xe0\x08" "Ellipsis")
+QDEF(MP_QSTR_Exception, (const byte*)"\xf2\x29\x09" "Exception")
+QDEF(MP_QSTR_GeneratorExit, (const byte*)"\x16\x62\x0d" "GeneratorExit")
+QDEF(MP_QSTR_ImportError, (const byte*)"\x20\x9c\x0b" "ImportError")
+QDEF(MP_QSTR_IndentationError, (const byte*)"\x5c\x20\x10" "IndentationError")
+QDEF(MP_QSTR_IndexError, (const byte*)"\x83\xad\x0a" "IndexError")
+QDEF(MP_QSTR_KeyError, (const byte*)"\xea\x00\x08" "KeyError")
+QDEF(MP_QSTR_KeyboardInterrupt, (const byte*)"\xaf\xe2\x11" "KeyboardInterrupt")
+QDEF(MP_QSTR_LookupError, (const byte*)"\xff\x69\x0b" "LookupError")
+QDEF(MP_QSTR_MemoryError, (const byte*)"\xdc\x83\x0b" "MemoryError")
+QDEF(MP_QSTR_MpyError, (const byte*)"\x39\x7f\x08" "MpyError")
+QDEF(MP_QSTR_NameError, (const byte*)"\xba\x2d\x09" "NameError")
+QDEF(MP_QSTR_NoneType, (const byte*)"\x17\x68\x08" "NoneType")
+QDEF(MP_QSTR_NotImplementedError, (const byte*)"\xc6\x98\x13" "NotImplementedError")
+QDEF(MP_QSTR_OSError, (const byte*)"\xa1\x65\x07" "OSError")
+QDEF(MP_QSTR_OverflowError, (const byte*)"\x81\xe1\x0d" "OverflowError")
+QDEF(MP_QSTR_ReloadException, (const byte*)"\x03\xc2\x0f" "ReloadException")
+QDEF(MP_QSTR_RuntimeError, (const byte*)"\x61\xf1\x0c" "RuntimeError")
+QDEF(MP_QSTR_StopAsyncIteration, (const byte*)"\xec\xf0\x12" "StopAsyncIteration")
+QDEF(MP_QSTR_StopIteration, (const byte*)"\xea\x1c\x0d" "StopIteration")
+QDEF(MP_QSTR_Struct, (const byte*)"\xf2\x94\x06" "Struct")
+QDEF(MP_QSTR_SyntaxError, (const byte*)"\x94\x8f\x0b" "SyntaxError")
+QDEF(MP_QSTR_SystemExit, (const byte*)"\x20\xff\x0a" "SystemExit")
+QDEF(MP_QSTR_TimeoutError, (const byte*)"\x66\x4b\x0c" "TimeoutError")
+QDEF(MP_QSTR_TypeError, (const byte*)"\x25\x96\x09" "TypeError")
+QDEF(MP_QSTR_UnicodeError, (const byte*)"\x22\xd1\x0c" "UnicodeError")
+QDEF(MP_QSTR_ValueError, (const byte*)"\x96\x87\x0a" "ValueError")
+QDEF(MP_QSTR_ZeroDivisionError, (const byte*)"\xb6\x27\x11" "ZeroDivisionError")
+QDEF(MP_QSTR_abs, (const byte*)"\x95\x32\x03" "abs")
+QDEF(MP_QSTR_add, (const byte*)"\x44\x32\x03" "add")
+QDEF(MP_QSTR_all, (const byte*)"\x44\x33\x03" "all")
+QDEF(MP_QSTR_and_, (const byte*)"\x91\x94\x04" "and_")
+QDEF(MP_QSTR_any, (const byte*)"\x13\x33\x03" "any")
+QDEF(MP_QSTR_append, (const byte*)"\x6b\x97\x06" "append")
+QDEF(MP_QSTR_args, (const byte*)"\xc2\xc6\x04" "args")
+QDEF(MP_QSTR_asr, (const byte*)"\x65\x35\x03" "asr")
+QDEF(MP_QSTR_b, (const byte*)"\xc7\xb5\x01" "b")
+QDEF(MP_QSTR_bin, (const byte*)"\xe0\x48\x03" "bin")
+QDEF(MP_QSTR_bl, (const byte*)"\xcb\x6e\x02" "bl")
+QDEF(MP_QSTR_bool, (const byte*)"\xeb\x3c\x04" "bool")
+QDEF(MP_QSTR_bound_method, (const byte*)"\x97\xa2\x0c" "bound_method")
+QDEF(MP_QSTR_buf, (const byte*)"\x74\x49\x03" "buf")
+QDEF(MP_QSTR_buffer, (const byte*)"\xe5\xa0\x06" "buffer")
+QDEF(MP_QSTR_builtins, (const byte*)"\xf7\x31\x08" "builtins")
+QDEF(MP_QSTR_bx, (const byte*)"\xdf\x6e\x02" "bx")
+QDEF(MP_QSTR_bytearray, (const byte*)"\x76\xa3\x09" "bytearray")
+QDEF(MP_QSTR_bytecode, (const byte*)"\x22\x7d\x08" "bytecode")
+QDEF(MP_QSTR_byteorder, (const byte*)"\x61\x99\x09" "byteorder")
+QDEF(MP_QSTR_bytes, (const byte*)"\x5c\xb2\x05" "bytes")
+QDEF(MP_QSTR_calcsize, (const byte*)"\x4d\x38\x08" "calcsize")
+QDEF(MP_QSTR_callable, (const byte*)"\x0d\x70\x08" "callable")
+QDEF(MP_QSTR_chr, (const byte*)"\xdc\x4c\x03" "chr")
+QDEF(MP_QSTR_classmethod, (const byte*)"\xb4\x8c\x0b" "classmethod")
+QDEF(MP_QSTR_clear, (const byte*)"\x7c\xa0\x05" "clear")
+QDEF(MP_QSTR_close, (const byte*)"\x33\x67\x05" "close")
+QDEF(MP_QSTR_closure, (const byte*)"\x74\xca\x07" "closure")
+QDEF(MP_QSTR_clz, (const byte*)"\x50\x4c\x03" "clz")
+QDEF(MP_QSTR_cmp, (const byte*)"\x3b\x4c\x03" "cmp")
+QDEF(MP_QSTR_complex, (const byte*)"\xc5\x9d\x07" "complex")
+QDEF(MP_QSTR_const, (const byte*)"\xc0\xff\x05" "const")
+QDEF(MP_QSTR_copy, (const byte*)"\xe0\xdb\x04" "copy")
+QDEF(MP_QSTR_count, (const byte*)"\xa6\x4d\x05" "count")
+QDEF(MP_QSTR_cpsid, (const byte*)"\xe8\xc7\x05" "cpsid")
+QDEF(MP_QSTR_cpsie, (const byte*)"\xe9\xc7\x05" "cpsie")
+QDEF(MP_QSTR_data, (const byte*)"\x15\xdc\x04" "data")
+QDEF(MP_QSTR_decode, (const byte*)"\xa9\x59\x06" "decode")
+QDEF(MP_QSTR_default, (const byte*)"\xce\x7d\x07" "default")
+QDEF(MP_QSTR_delattr, (const byte*)"\xdb\xc8\x07" "delattr")
+QDEF(MP_QSTR_deleter, (const byte*)"\x6e\xdb\x07" "deleter")
+QDEF(MP_QSTR_dict, (const byte*)"\x3f\xfc\x04" "dict")
+QDEF(MP_QSTR_dict_view, (const byte*)"\x2d\xa9\x09" "dict_view")
+QDEF(MP_QSTR_difference, (const byte*)"\x72\x24\x0a" "difference")
+QDEF(MP_QSTR_difference_update, (const byte*)"\x9c\xfa\x11" "difference_update")
+QDEF(MP_QSTR_dir, (const byte*)"\xfa\x1e\x03" "dir")
+QDEF(MP_QSTR_discard, (const byte*)"\x0f\x71\x07" "discard")
+QDEF(MP_QSTR_divmod, (const byte*)"\xb8\x04\x06" "divmod")
+QDEF(MP_QSTR_doc, (const byte*)"\x2d\x1f\x03" "doc")
+QDEF(MP_QSTR_encode, (const byte*)"\x43\xca\x06" "encode")
+QDEF(MP_QSTR_end, (const byte*)"\x0a\x23\x03" "end")
+QDEF(MP_QSTR_endswith, (const byte*)"\x1b\xa3\x08" "endswith")
+QDEF(MP_QSTR_enumerate, (const byte*)"\x71\xba\x09" "enumerate")
+QDEF(MP_QSTR_errno, (const byte*)"\xc1\x11\x05" "errno")
+QDEF(MP_QSTR_eval, (const byte*)"\x9b\xa6\x04" "eval")
+QDEF(MP_QSTR_exec, (const byte*)"\x1e\xc0\x04" "exec")
+QDEF(MP_QSTR_extend, (const byte*)"\x63\xe8\x06" "extend")
+QDEF(MP_QSTR_filename, (const byte*)"\xe4\x54\x08" "filename")
+QDEF(MP_QSTR_filename2, (const byte*)"\x56\xf1\x09" "filename2")
+QDEF(MP_QSTR_filter, (const byte*)"\x25\xbe\x06" "filter")
+QDEF(MP_QSTR_find, (const byte*)"\x00\x34\x04" "find")
+QDEF(MP_QSTR_float, (const byte*)"\x35\x44\x05" "float")
+QDEF(MP_QSTR_flush, (const byte*)"\x61\xc1\x05" "flush")
+QDEF(MP_QSTR_format, (const byte*)"\x26\x33\x06" "format")
+QDEF(MP_QSTR_from_bytes, (const byte*)"\x35\x74\x0a" "from_bytes")
+QDEF(MP_QSTR_fromkeys, (const byte*)"\x37\xbd\x08" "fromkeys")
+QDEF(MP_QSTR_function, (const byte*)"\x27\x02\x08" "function")
+QDEF(MP_QSTR_generator, (const byte*)"\x96\xc3\x09" "generator")
+QDEF(MP_QSTR_get, (const byte*)"\x33\x3b\x03" "get")
+QDEF(MP_QSTR_getattr, (const byte*)"\xc0\x17\x07" "getattr")
+QDEF(MP_QSTR_getter, (const byte*)"\x90\xb2\x06" "getter")
+QDEF(MP_QSTR_globals, (const byte*)"\x9d\x49\x07" "globals")
+QDEF(MP_QSTR_hasattr, (const byte*)"\x8c\xb0\x07" "hasattr")
+QDEF(MP_QSTR_hash, (const byte*)"\xb7\x70\x04" "hash")
+QDEF(MP_QSTR_heap_lock, (const byte*)"\xad\x8c\x09" "heap_lock")
+QDEF(MP_QSTR_heap_unlock, (const byte*)"\x56\x2d\x0b" "heap_unlock")
+QDEF(MP_QSTR_hex, (const byte*)"\x70\x50\x03" "hex")
+QDEF(MP_QSTR_id, (const byte*)"\x28\x6f\x02" "id")
+QDEF(MP_QSTR_imag, (const byte*)"\x47\xb7\x04" "imag")
+QDEF(MP_QSTR_index, (const byte*)"\x7b\x28\x05" "index")
+QDEF(MP_QSTR_insert, (const byte*)"\x12\x54\x06" "insert")
+QDEF(MP_QSTR_int, (const byte*)"\x16\x53\x03" "int")
+QDEF(MP_QSTR_intersection, (const byte*)"\x28\x2a\x0c" "intersection")
+QDEF(MP_QSTR_intersection_update, (const byte*)"\x06\xdd\x13" "intersection_update")
+QDEF(MP_QSTR_isalpha, (const byte*)"\xeb\x37\x07" "isalpha")
+QDEF(MP_QSTR_isdigit, (const byte*)"\xa8\x9a\x07" "isdigit")
+QDEF(MP_QSTR_isdisjoint, (const byte*)"\xf7\x68\x0a" "isdisjoint")
+QDEF(MP_QSTR_isinstance, (const byte*)"\xb6\xbe\x0a" "isinstance")
+QDEF(MP_QSTR_islower, (const byte*)"\xfc\x80\x07" "islower")
+QDEF(MP_QSTR_isspace, (const byte*)"\x5b\xf8\x07" "isspace")
+QDEF(MP_QSTR_issubclass, (const byte*)"\xb5\x7f\x0a" "issubclass")
+QDEF(MP_QSTR_issubset, (const byte*)"\xb9\xc1\x08" "issubset")
+QDEF(MP_QSTR_issuperset, (const byte*)"\xfc\xec\x0a" "issuperset")
+QDEF(MP_QSTR_isupper, (const byte*)"\xdd\xa7\x07" "isupper")
+QDEF(MP_QSTR_items, (const byte*)"\xe3\x53\x05" "items")
+QDEF(MP_QSTR_iter, (const byte*)"\x8f\x21\x04" "iter")
+QDEF(MP_QSTR_iter_unpack, (const byte*)"\xb2\x2f\x0b" "iter_unpack")
+QDEF(MP_QSTR_iterable, (const byte*)"\x25\x92\x08" "iterable")
+QDEF(MP_QSTR_iterator, (const byte*)"\x47\xbe\x08" "iterator")
+QDEF(MP_QSTR_join, (const byte*)"\xa7\x5c\x04" "join")
+QDEF(MP_QSTR_key, (const byte*)"\x32\x6d\x03" "key")
+QDEF(MP_QSTR_keys, (const byte*)"\x01\x13\x04" "keys")
+QDEF(MP_QSTR_ldr, (const byte*)"\x5f\x40\x03" "ldr")
+QDEF(MP_QSTR_ldrb, (const byte*)"\x5d\x4c\x04" "ldrb")
+QDEF(MP_QSTR_ldrex, (const byte*)"\xe2\xd7\x05" "ldrex")
+QDEF(MP_QSTR_ldrh, (const byte*)"\x57\x4c\x04" "ldrh")
+QDEF(MP_QSTR_len, (const byte*)"\x62\x40\x03" "len")
+QDEF(MP_QSTR_length, (const byte*)"\x59\x87\x06" "length")
+QDEF(MP_QSTR_list, (const byte*)"\x27\x1d\x04" "list")
+QDEF(MP_QSTR_little, (const byte*)"\x89\x6a\x06" "little")
+QDEF(MP_QSTR_locals, (const byte*)"\x3b\xa1\x06" "locals")
+QDEF(MP_QSTR_lower, (const byte*)"\xc6\xcb\x05" "lower")
+QDEF(MP_QSTR_lsl, (const byte*)"\xb6\x41\x03" "lsl")
+QDEF(MP_QSTR_lsr, (const byte*)"\xa8\x41\x03" "lsr")
+QDEF(MP_QSTR_lstrip, (const byte*)"\xe5\xb9\x06" "lstrip")
+QDEF(MP_QSTR_map, (const byte*)"\xb9\x43\x03" "map")
+QDEF(MP_QSTR_max, (const byte*)"\xb1\x43\x03" "max")
+QDEF(MP_QSTR_micropython, (const byte*)"\x0b\x7c\x0b" "micropython")
+QDEF(MP_QSTR_min, (const byte*)"\xaf\x42\x03" "min")
+QDEF(MP_QSTR_module, (const byte*)"\xbf\x99\x06" "module")
+QDEF(MP_QSTR_mov, (const byte*)"\xf1\x43\x03" "mov")
+QDEF(MP_QSTR_movt, (const byte*)"\x65\xc2\x04" "movt")
+QDEF(MP_QSTR_movw, (const byte*)"\x66\xc2\x04" "movw")
+QDEF(MP_QSTR_movwt, (const byte*)"\x52\x0f\x05" "movwt")
+QDEF(MP_QSTR_mrs, (const byte*)"\x89\x45\x03" "mrs")
+QDEF(MP_QSTR_native, (const byte*)"\x84\x0b\x06" "native")
+QDEF(MP_QSTR_newline, (const byte*)"\x37\x89\x07" "newline")
+QDEF(MP_QSTR_next, (const byte*)"\x42\x88\x04" "next")
+QDEF(MP_QSTR_nop, (const byte*)"\xb4\x57\x03" "nop")
+QDEF(MP_QSTR_object, (const byte*)"\x90\x8d\x06" "object")
+QDEF(MP_QSTR_oct, (const byte*)"\xfd\x5c\x03" "oct")
+QDEF(MP_QSTR_offset, (const byte*)"\x48\x3c\x06" "offset")
+QDEF(MP_QSTR_opt_level, (const byte*)"\x87\x67\x09" "opt_level")
+QDEF(MP_QSTR_ord, (const byte*)"\x1c\x5e\x03" "ord")
+QDEF(MP_QSTR_out, (const byte*)"\x2b\x5f\x03" "out")
+QDEF(MP_QSTR_pack, (const byte*)"\xbc\xd1\x04" "pack")
+QDEF(MP_QSTR_pack_into, (const byte*)"\x1f\xa9\x09" "pack_into")
+QDEF(MP_QSTR_pend_throw, (const byte*)"\xf3\x74\x0a" "pend_throw")
+QDEF(MP_QSTR_pkhbt, (const byte*)"\xe0\x2c\x05" "pkhbt")
+QDEF(MP_QSTR_pkhtb, (const byte*)"\x20\x2a\x05" "pkhtb")
+QDEF(MP_QSTR_pop, (const byte*)"\x2a\x73\x03" "pop")
+QDEF(MP_QSTR_popitem, (const byte*)"\xbf\x2c\x07" "popitem")
+QDEF(MP_QSTR_pow, (const byte*)"\x2d\x73\x03" "pow")
+QDEF(MP_QSTR_print, (const byte*)"\x54\xc6\x05" "print")
+QDEF(MP_QSTR_property, (const byte*)"\xc2\x29\x08" "property")
+QDEF(MP_QSTR_protocol_pin, (const byte*)"\x1b\x57\x0c" "protocol_pin")
+QDEF(MP_QSTR_protocol_stream, (const byte*)"\x90\x24\x0f" "protocol_stream")
+QDEF(MP_QSTR_push, (const byte*)"\xbb\x7e\x04" "push")
+QDEF(MP_QSTR_qadd, (const byte*)"\xb5\x4c\x04" "qadd")
+QDEF(MP_QSTR_qadd16, (const byte*)"\xd2\x4f\x06" "qadd16")
+QDEF(MP_QSTR_qadd8, (const byte*)"\x6d\xe3\x05" "qadd8")
+QDEF(MP_QSTR_qasx, (const byte*)"\x1e\x4b\x04" "qasx")
+QDEF(MP_QSTR_qdadd, (const byte*)"\xd1\x42\x05" "qdadd")
+QDEF(MP_QSTR_qdsub, (const byte*)"\xf4\x19\x05" "qdsub")
+QDEF(MP_QSTR_qsax, (const byte*)"\x5e\x22\x04" "qsax")
+QDEF(MP_QSTR_qsub, (const byte*)"\xd0\x23\x04" "qsub")
+QDEF(MP_QSTR_qsub16, (const byte*)"\x37\x5a\x06" "qsub16")
+QDEF(MP_QSTR_qsub8, (const byte*)"\xe8\x9d\x05" "qsub8")
+QDEF(MP_QSTR_range, (const byte*)"\x1a\x5e\x05" "range")
+QDEF(MP_QSTR_rbit, (const byte*)"\xe8\xee\x04" "rbit")
+QDEF(MP_QSTR_real, (const byte*)"\xbf\xf9\x04" "real")
+QDEF(MP_QSTR_remove, (const byte*)"\x63\x8a\x06" "remove")
+QDEF(MP_QSTR_replace, (const byte*)"\x49\x25\x07" "replace")
+QDEF(MP_QSTR_repr, (const byte*)"\xd0\xf7\x04" "repr")
+QDEF(MP_QSTR_reverse, (const byte*)"\x25\x2a\x07" "reverse")
+QDEF(MP_QSTR_reversed, (const byte*)"\xa1\x6e\x08" "reversed")
+QDEF(MP_QSTR_rfind, (const byte*)"\xd2\x9c\x05" "rfind")
+QDEF(MP_QSTR_rindex, (const byte*)"\xe9\x2b\x06" "rindex")
+QDEF(MP_QSTR_round, (const byte*)"\xe7\x25\x05" "round")
+QDEF(MP_QSTR_rsplit, (const byte*)"\xa5\x00\x06" "rsplit")
+QDEF(MP_QSTR_rstrip, (const byte*)"\x3b\x95\x06" "rstrip")
+QDEF(MP_QSTR_sadd16, (const byte*)"\x10\x02\x06" "sadd16")
+QDEF(MP_QSTR_sadd8, (const byte*)"\x6f\x55\x05" "sadd8")
+QDEF(MP_QSTR_sasx, (const byte*)"\x5c\x84\x04" "sasx")
+QDEF(MP_QSTR_sdiv, (const byte*)"\xcd\x7a\x04" "sdiv")
+QDEF(MP_QSTR_sel, (const byte*)"\x3f\x8f\x03" "sel")
+QDEF(MP_QSTR_send, (const byte*)"\xb9\x76\x04" "send")
+QDEF(MP_QSTR_sep, (const byte*)"\x23\x8f\x03" "sep")
+QDEF(MP_QSTR_set, (const byte*)"\x27\x8f\x03" "set")
+QDEF(MP_QSTR_setattr, (const byte*)"\xd4\xa8\x07" "setattr")
+QDEF(MP_QSTR_setdefault, (const byte*)"\x6c\xa3\x0a" "setdefault")
+QDEF(MP_QSTR_setter, (const byte*)"\x04\x59\x06" "setter")
+QDEF(MP_QSTR_shadd16, (const byte*)"\xf8\xd5\x07" "shadd16")
+QDEF(MP_QSTR_shadd8, (const byte*)"\x07\x54\x06" "shadd8")
+QDEF(MP_QSTR_shsub16, (const byte*)"\xdd\x2d\x07" "shsub16")
+QDEF(MP_QSTR_shsub8, (const byte*)"\x82\x9c\x06" "shsub8")
+QDEF(MP_QSTR_signed, (const byte*)"\x37\x01\x06" "signed")
+QDEF(MP_QSTR_size, (const byte*)"\x20\xa5\x04" "size")
+QDEF(MP_QSTR_slice, (const byte*)"\xb5\xf4\x05" "slice")
+QDEF(MP_QSTR_smlabb, (const byte*)"\xb6\x50\x06" "smlabb")
+QDEF(MP_QSTR_smlabt, (const byte*)"\xa0\x50\x06" "smlabt")
+QDEF(MP_QSTR_smlad, (const byte*)"\x52\x86\x05" "smlad")
+QDEF(MP_QSTR_smladx, (const byte*)"\xea\x50\x06" "smladx")
+QDEF(MP_QSTR_smlald, (const byte*)"\xfe\x51\x06" "smlald")
+QDEF(MP_QSTR_smlaldx, (const byte*)"\xc6\x91\x07" "smlaldx")
+QDEF(MP_QSTR_smlatb, (const byte*)"\xe0\x4e\x06" "smlatb")
+QDEF(MP_QSTR_smlatt, (const byte*)"\xf6\x4e\x06" "smlatt")
+QDEF(MP_QSTR_smlawb, (const byte*)"\x03\x4e\x06" "smlawb")
+QDEF(MP_QSTR_smlawt, (const byte*)"\x15\x4e\x06" "smlawt")
+QDEF(MP_QSTR_smlsd, (const byte*)"\x80\x83\x05" "smlsd")
+QDEF(MP_QSTR_smlsdx, (const byte*)"\xf8\xf3\x06" "smlsdx")
+QDEF(MP_QSTR_smlsld, (const byte*)"\xec\xf4\x06" "smlsld")
+QDEF(MP_QSTR_smlsldx, (const byte*)"\x14\x92\x07" "smlsldx")
+QDEF(MP_QSTR_smmla, (const byte*)"\xbb\x69\x05" "smmla")
+QDEF(MP_QSTR_smmlar, (const byte*)"\x69\xa1\x06" "smmlar")
+QDEF(MP_QSTR_smmls, (const byte*)"\xa9\x69\x05" "smmls")
+QDEF(MP_QSTR_smmlsr, (const byte*)"\xbb\x9e\x06" "smmlsr")
+QDEF(MP_QSTR_smmul, (const byte*)"\x8f\x66\x05" "smmul")
+QDEF(MP_QSTR_smmulr, (const byte*)"\x1d\x38\x06" "smmulr")
+QDEF(MP_QSTR_smuad, (const byte*)"\x0b\x47\x05" "smuad")
+QDEF(MP_QSTR_smuadx, (const byte*)"\x13\x28\x06" "smuadx")
+QDEF(MP_QSTR_smulbb, (const byte*)"\xc2\xf9\x06" "smulbb")
+QDEF(MP_QSTR_smulbt, (const byte*)"\xd4\xf9\x06" "smulbt")
+QDEF(MP_QSTR_smultb, (const byte*)"\x14\xfc\x06" "smultb")
+QDEF(MP_QSTR_smultt, (const byte*)"\x02\xfc\x06" "smultt")
+QDEF(MP_QSTR_smulwb, (const byte*)"\x37\xfc\x06" "smulwb")
+QDEF(MP_QSTR_smulwt, (const byte*)"\x21\xfc\x06" "smulwt")
+QDEF(MP_QSTR_smusd, (const byte*)"\x59\x49\x05" "smusd")
+QDEF(MP_QSTR_smusdx, (const byte*)"\x01\x74\x06" "smusdx")
+QDEF(MP_QSTR_sort, (const byte*)"\xbf\x9d\x04" "sort")
+QDEF(MP_QSTR_sorted, (const byte*)"\x5e\x15\x06" "sorted")
+QDEF(MP_QSTR_split, (const byte*)"\xb7\x33\x05" "split")
+QDEF(MP_QSTR_ssat, (const byte*)"\x10\x4a\x04" "ssat")
+QDEF(MP_QSTR_ssat16, (const byte*)"\x77\x10\x06" "ssat16")
+QDEF(MP_QSTR_ssax, (const byte*)"\x1c\x4a\x04" "ssax")
+QDEF(MP_QSTR_ssub16, (const byte*)"\x75\x7a\x06" "ssub16")
+QDEF(MP_QSTR_ssub8, (const byte*)"\xea\xbd\x05" "ssub8")
+QDEF(MP_QSTR_start, (const byte*)"\x85\xef\x05" "start")
+QDEF(MP_QSTR_startswith, (const byte*)"\x74\xe8\x0a" "startswith")
+QDEF(MP_QSTR_staticmethod, (const byte*)"\x62\xaf\x0c" "staticmethod")
+QDEF(MP_QSTR_step, (const byte*)"\x57\x36\x04" "step")
+QDEF(MP_QSTR_stop, (const byte*)"\x9d\x36\x04" "stop")
+QDEF(MP_QSTR_str, (const byte*)"\x50\x8d\x03" "str")
+QDEF(MP_QSTR_strb, (const byte*)"\x32\x37\x04" "strb")
+QDEF(MP_QSTR_strerror, (const byte*)"\x48\x71\x08" "strerror")
+QDEF(MP_QSTR_strex, (const byte*)"\xad\x1d\x05" "strex")
+QDEF(MP_QSTR_strh, (const byte*)"\x38\x37\x04" "strh")
+QDEF(MP_QSTR_strip, (const byte*)"\x29\x1e\x05" "strip")
+QDEF(MP_QSTR_sub, (const byte*)"\x21\x8d\x03" "sub")
+QDEF(MP_QSTR_sum, (const byte*)"\x2e\x8d\x03" "sum")
+QDEF(MP_QSTR_super, (const byte*)"\xc4\xb2\x05" "super")
+QDEF(MP_QSTR_sxtab, (const byte*)"\xb9\xb9\x05" "sxtab")
+QDEF(MP_QSTR_sxtab16, (const byte*)"\xde\x0d\x07" "sxtab16")
+QDEF(MP_QSTR_sxtah, (const byte*)"\xb3\xb9\x05" "sxtah")
+QDEF(MP_QSTR_sxtb16, (const byte*)"\x5f\xe2\x06" "sxtb16")
+QDEF(MP_QSTR_symmetric_difference, (const byte*)"\xce\x67\x14" "symmetric_difference")
+QDEF(MP_QSTR_symmetric_difference_update, (const byte*)"\x60\xf8\x1b" "symmetric_difference_update")
+QDEF(MP_QSTR_throw, (const byte*)"\xb3\x44\x05" "throw")
+QDEF(MP_QSTR_to_bytes, (const byte*)"\xd8\x3e\x08" "to_bytes")
+QDEF(MP_QSTR_tuple, (const byte*)"\xfd\x41\x05" "tuple")
+QDEF(MP_QSTR_type, (const byte*)"\x9d\x7f\x04" "type")
+QDEF(MP_QSTR_uadd16, (const byte*)"\x56\xee\x06" "uadd16")
+QDEF(MP_QSTR_uadd8, (const byte*)"\x69\xa2\x05" "uadd8")
+QDEF(MP_QSTR_uasx, (const byte*)"\x9a\x19\x04" "uasx")
+QDEF(MP_QSTR_udiv, (const byte*)"\x8b\x31\x04" "udiv")
+QDEF(MP_QSTR_uhadd16, (const byte*)"\x7e\x29\x07" "uhadd16")
+QDEF(MP_QSTR_uhadd8, (const byte*)"\x41\x20\x06" "uhadd8")
+QDEF(MP_QSTR_uhsub16, (const byte*)"\x5b\x55\x07" "uhsub16")
+QDEF(MP_QSTR_uhsub8, (const byte*)"\xc4\xdb\x06" "uhsub8")
+QDEF(MP_QSTR_union, (const byte*)"\xf6\x7c\x05" "union")
+QDEF(MP_QSTR_unpack, (const byte*)"\x07\x3c\x06" "unpack")
+QDEF(MP_QSTR_unpack_from, (const byte*)"\x0e\x6d\x0b" "unpack_from")
+QDEF(MP_QSTR_update, (const byte*)"\xb4\x76\x06" "update")
+QDEF(MP_QSTR_upper, (const byte*)"\x27\x94\x05" "upper")
+QDEF(MP_QSTR_uqadd16, (const byte*)"\x07\x56\x07" "uqadd16")
+QDEF(MP_QSTR_uqadd8, (const byte*)"\x18\xd4\x06" "uqadd8")
+QDEF(MP_QSTR_uqsub16, (const byte*)"\x22\x9d\x07" "uqsub16")
+QDEF(MP_QSTR_uqsub8, (const byte*)"\x9d\x4a\x06" "uqsub8")
+QDEF(MP_QSTR_usad8, (const byte*)"\xbe\x09\x05" "usad8")
+QDEF(MP_QSTR_usada8, (const byte*)"\xff\x46\x06" "usada8")
+QDEF(MP_QSTR_usat, (const byte*)"\xd6\xf0\x04" "usat")
+QDEF(MP_QSTR_usat16, (const byte*)"\xb1\x80\x06" "usat16")
+QDEF(MP_QSTR_usax, (const byte*)"\xda\xf0\x04" "usax")
+QDEF(MP_QSTR_ustruct, (const byte*)"\x47\x08\x07" "ustruct")
+QDEF(MP_QSTR_usub16, (const byte*)"\xb3\x1a\x06" "usub16")
+QDEF(MP_QSTR_usub8, (const byte*)"\xec\x5d\x05" "usub8")
+QDEF(MP_QSTR_uxtab, (const byte*)"\xbf\x07\x05" "uxtab")
+QDEF(MP_QSTR_uxtab16, (const byte*)"\x58\xf5\x07" "uxtab16")
+QDEF(MP_QSTR_uxtah, (const byte*)"\xb5\x07\x05" "uxtah")
+QDEF(MP_QSTR_uxtb16, (const byte*)"\x99\x01\x06" "uxtb16")
+QDEF(MP_QSTR_vabs, (const byte*)"\x83\xd8\x04" "vabs")
+QDEF(MP_QSTR_value, (const byte*)"\x4e\x34\x05" "value")
+QDEF(MP_QSTR_values, (const byte*)"\x7d\xbe\x06" "values")
+QDEF(MP_QSTR_vcmp, (const byte*)"\xad\xc1\x04" "vcmp")
+QDEF(MP_QSTR_vcvt_f32_s32, (const byte*)"\x47\xc9\x0c" "vcvt_f32_s32")
+QDEF(MP_QSTR_vcvt_f32_u32, (const byte*)"\x41\xb0\x0c" "vcvt_f32_u32")
+QDEF(MP_QSTR_vcvt_s32_f32, (const byte*)"\x07\x33\x0c" "vcvt_s32_f32")
+QDEF(MP_QSTR_vcvt_u32_f32, (const byte*)"\x81\x99\x0c" "vcvt_u32_f32")
+QDEF(MP_QSTR_vldr, (const byte*)"\xc9\x07\x04" "vldr")
+QDEF(MP_QSTR_vmov, (const byte*)"\xe7\x0a\x04" "vmov")
+QDEF(MP_QSTR_vmrs, (const byte*)"\x9f\x09\x04" "vmrs")
+QDEF(MP_QSTR_vmsr, (const byte*)"\x7f\x0a\x04" "vmsr")
+QDEF(MP_QSTR_vneg, (const byte*)"\xff\xee\x04" "vneg")
+QDEF(MP_QSTR_vsqrt, (const byte*)"\xf7\x42\x05" "vsqrt")
+QDEF(MP_QSTR_vstr, (const byte*)"\xc6\x7e\x04" "vstr")
+QDEF(MP_QSTR_wfi, (const byte*)"\x9d\x7e\x03" "wfi")
+QDEF(MP_QSTR_zip, (const byte*)"\xe6\xac\x03" "zip")
+TRANSLATION("  File \"%q\", line %d", 40, 7, 245, 75, 24, 255, 199, 47, 95, 252, 125, 34, 200, 166, 57, 84) //   File \"%q\", line %d
+TRANSLATION("%%c requires int or char", 49, 203, 149, 3, 159, 174, 81, 206, 2, 44, 134, 113, 78, 132, 224) // %%c requires int or char
+TRANSLATION("%q index out of range", 43, 203, 212, 34, 212, 251, 134, 204, 134, 220, 57, 47, 6) // %q index out of range
+TRANSLATION("%q indices must be integers, not %s", 71, 203, 212, 34, 213, 40, 112, 47, 152, 145, 177, 132, 89, 62, 13, 227, 233, 10, 210, 57, 64) // %q indices must be integers, not %s
+TRANSLATION("%q() takes %d positional arguments but %d were given", 105, 203, 215, 217, 237, 18, 94, 135, 3, 149, 70, 26, 18, 81, 148, 172, 9, 248, 205, 205, 102, 6, 217, 145, 202, 163, 177, 185, 142, 19, 169, 168) // %q() takes %d positional arguments but %d were given
+TRANSLATION("'%q' argument required", 45, 167, 47, 93, 1, 63, 25, 185, 172, 135, 63, 92, 163, 157, 64) // \'%q\' argument required
+TRANSLATION("'%s' expects a label", 41, 167, 40, 208, 31, 124, 29, 38, 1, 11, 22, 199, 96) // \'%s\' expects a label
+TRANSLATION("'%s' expects a register", 47, 167, 40, 208, 31, 124, 29, 38, 1, 7, 62, 18, 36, 220) // \'%s\' expects a register
+TRANSLATION("'%s' expects a special register", 63, 167, 40, 208, 31, 124, 29, 38, 1, 8, 193, 209, 10, 193, 207, 132, 137, 55) // \'%s\' expects a special register
+TRANSLATION("'%s' expects an FPU register", 57, 167, 40, 208, 31, 124, 29, 38, 1, 40, 254, 191, 227, 247, 14, 124, 36, 73, 184) // \'%s\' expects an FPU register
+TRANSLATION("'%s' expects an address of the form [a, b]", 85, 167, 40, 208, 31, 124, 29, 38, 1, 40, 42, 213, 206, 32, 54, 226, 122, 24, 221, 158, 227, 255, 197, 244, 141, 191, 254) // \'%s\' expects an address of the form [a, b]
+TRANSLATION("'%s' expects an integer", 47, 167, 40, 208, 31, 124, 29, 38, 1, 40, 69, 147, 224, 220) // \'%s\' expects an integer
+TRANSLATION("'%s' expects at most r%d", 49, 167, 40, 208, 31, 124, 29, 38, 1, 72, 187, 68, 135, 229, 80) // \'%s\' expects at most r%d
+TRANSLATION("'%s' expects {r0, r1, ...}", 53, 167, 40, 208, 31, 124, 29, 38, 7, 253, 191, 215, 244, 135, 247, 253, 35, 249, 255, 63, 231, 254, 64) // \'%s\' expects {r0, r1, ...}
+TRANSLATION("'%s' integer %d is not within range %d..%d", 85, 167, 40, 208, 34, 201, 240, 110, 57, 84, 36, 5, 105, 29, 146, 122, 34, 135, 37, 224, 199, 42, 255, 63, 231, 202, 160) // \'%s\' integer %d is not within range %d..%d
+TRANSLATION("'%s' integer 0x%x does not fit in mask 0x%x", 87, 167, 40, 208, 34, 201, 240, 110, 62, 190, 252, 187, 138, 177, 192, 86, 145, 186, 72, 69, 23, 40, 244, 31, 95, 126, 93, 192) // \'%s\' integer 0x%x does not fit in mask 0x%x
+TRANSLATION("'%s' object cannot assign attribute '%q'", 81, 167, 40, 208, 54, 222, 103, 73, 20, 37, 86, 144, 81, 9, 194, 130, 153, 116, 219, 50, 99, 78, 94, 186, 0) // \'%s\' object cannot assign attribute \'%q\'
+TRANSLATION("'%s' object does not support '%q'", 67, 167, 40, 208, 54, 222, 103, 73, 21, 99, 128, 173, 34, 51, 140, 51, 200, 211, 151, 174, 128) // \'%s\' object does not support \'%q\'
+TRANSLATION("'%s' object does not support item assignment", 89, 167, 40, 208, 54, 222, 103, 73, 21, 99, 128, 173, 34, 51, 140, 51, 200, 73, 59, 130, 136, 78, 22, 230, 178) // \'%s\' object does not support item assignment
+TRANSLATION("'%s' object does not support item deletion", 85, 167, 40, 208, 54, 222, 103, 73, 21, 99, 128, 173, 34, 51, 140, 51, 200, 73, 59, 138, 157, 142, 81, 148) // \'%s\' object does not support item deletion
+TRANSLATION("'%s' object has no attribute '%q'", 67, 167, 40, 208, 54, 222, 103, 73, 29, 10, 2, 176, 41, 151, 77, 179, 38, 52, 229, 235, 160) // \'%s\' object has no attribute \'%q\'
+TRANSLATION("'%s' object is not an iterator", 61, 167, 40, 208, 54, 222, 103, 73, 9, 1, 90, 65, 40, 73, 55, 41, 103) // \'%s\' object is not an iterator
+TRANSLATION("'%s' object is not callable", 55, 167, 40, 208, 54, 222, 103, 73, 9, 1, 90, 69, 10, 214, 45, 172, 96) // \'%s\' object is not callable
+TRANSLATION("'%s' object is not iterable", 55, 167, 40, 208, 54, 222, 103, 73, 9, 1, 90, 66, 73, 185, 109, 99) // \'%s\' object is not iterable
+TRANSLATION("'%s' object is not subscriptable", 65, 167, 40, 208, 54, 222, 103, 73, 9, 1, 90, 68, 103, 104, 163, 166, 36, 182, 177, 128) // \'%s\' object is not subscriptable
+TRANSLATION("'=' alignment not allowed in string format specifier", 105, 167, 251, 104, 10, 201, 194, 220, 214, 66, 180, 130, 181, 155, 177, 212, 34, 136, 151, 69, 224, 110, 207, 114, 145, 24, 58, 38, 232, 110) // \'=\' alignment not allowed in string format specifier
+TRANSLATION("'async for' or 'async with' outside async function", 101, 161, 71, 133, 160, 221, 159, 64, 206, 52, 40, 240, 180, 29, 146, 122, 104, 27, 51, 9, 83, 5, 30, 22, 131, 124, 173, 37, 25, 64) // \'async for\' or \'async with\' outside async function
+TRANSLATION("'await' outside function", 49, 161, 118, 36, 157, 3, 102, 97, 42, 99, 124, 173, 37, 25, 64) // \'await\' outside function
+TRANSLATION("'break' outside loop", 41, 166, 206, 101, 233, 160, 108, 204, 37, 76, 89, 155, 0) // \'break\' outside loop
+TRANSLATION("'continue' outside loop", 47, 165, 25, 101, 23, 39, 160, 108, 204, 37, 76, 89, 155, 0) // \'continue\' outside loop
+TRANSLATION("'return' outside function", 51, 163, 156, 229, 215, 64, 217, 152, 74, 152, 223, 43, 73, 70, 80) // \'return\' outside function
+TRANSLATION("'yield' outside function", 49, 167, 132, 59, 87, 64, 217, 152, 74, 152, 223, 43, 73, 70, 80) // \'yield\' outside function
+TRANSLATION("*x must be assignment target", 57, 244, 119, 23, 204, 72, 216, 193, 68, 39, 11, 115, 89, 18, 79, 193, 200) // *x must be assignment target
+TRANSLATION(", in %q\n", 19, 244, 132, 81, 203, 215, 253, 127, 208) // , in %q\r\n
+TRANSLATION("0.0 to a complex power", 45, 245, 255, 63, 172, 75, 2, 20, 107, 226, 199, 220, 97, 187, 27, 128) // 0.0 to a complex power
+TRANSLATION("3-arg pow() not supported", 51, 246, 251, 137, 248, 24, 110, 222, 207, 104, 86, 145, 25, 198, 25, 228, 234) // 3-arg pow() not supported
+TRANSLATION("Call super().__init__() before accessing native object.", 111, 249, 149, 172, 35, 56, 55, 246, 123, 127, 158, 186, 162, 164, 235, 175, 179, 218, 54, 61, 217, 204, 21, 40, 113, 8, 188, 5, 41, 78, 166, 27, 111, 51, 164, 255, 48) // Call super().__init__() before accessing native object.
+TRANSLATION("Corrupt raw code", 33, 249, 179, 190, 113, 33, 203, 176, 163, 84, 192) // Corrupt raw code
+TRANSLATION("File exists", 23, 253, 82, 198, 15, 186, 68, 192) // File exists
+TRANSLATION("Input/output error", 37, 241, 92, 102, 126, 166, 204, 227, 50, 13, 221, 156) // Input/output error
+TRANSLATION("Invalid argument", 33, 241, 94, 165, 100, 168, 39, 227, 55, 53, 144) // Invalid argument
+TRANSLATION("LHS of keyword arg must be an id", 65, 255, 63, 239, 243, 13, 184, 244, 63, 29, 153, 234, 9, 248, 23, 204, 72, 216, 193, 40, 74, 128) // LHS of keyword arg must be an id
+TRANSLATION("Name too long", 27, 228, 87, 49, 44, 194, 204, 188, 0) // Name too long
+TRANSLATION("No space left on device", 47, 228, 194, 48, 84, 49, 99, 222, 67, 40, 169, 245, 74, 24) // No space left on device
+TRANSLATION("No such file/directory", 45, 228, 194, 51, 78, 131, 116, 177, 253, 85, 71, 58, 75, 63, 128) // No such file/directory
+TRANSLATION("Permission denied", 35, 254, 13, 238, 145, 8, 202, 42, 106, 135, 80) // Permission denied
+TRANSLATION("Read-only filesystem", 41, 250, 153, 87, 220, 203, 111, 3, 116, 177, 199, 136, 147, 184) // Read-only filesystem
+TRANSLATION("Traceback (most recent call last):\n", 73, 251, 57, 80, 246, 42, 122, 15, 101, 218, 36, 57, 208, 214, 69, 10, 214, 22, 40, 159, 111, 223, 254, 191, 232) // Traceback (most recent call last):\r\n
+TRANSLATION("Unable to init parser", 43, 251, 169, 109, 99, 18, 193, 21, 36, 96, 158, 13, 192) // Unable to init parser
+TRANSLATION("Unsupported operation", 43, 251, 172, 103, 24, 103, 147, 168, 108, 27, 148, 163, 40) // Unsupported operation
+TRANSLATION("__init__() should return None", 59, 174, 168, 169, 58, 235, 236, 246, 136, 232, 217, 181, 67, 156, 229, 212, 121, 50, 152) // __init__() should return None
+TRANSLATION("__init__() should return None, not '%s'", 79, 174, 168, 169, 58, 235, 236, 246, 136, 232, 217, 181, 67, 156, 229, 212, 121, 50, 159, 210, 21, 164, 105, 202, 52) // __init__() should return None, not \'%s\'
+TRANSLATION("__new__ arg must be a user-type", 63, 174, 170, 125, 181, 212, 19, 240, 47, 152, 145, 177, 130, 25, 131, 127, 116, 248, 193, 128) // __new__ arg must be a user-type
+TRANSLATION("a bytes-like object is required", 62, 67, 111, 18, 113, 238, 178, 122, 24, 109, 188, 206, 146, 18, 3, 159, 174, 81, 206, 160) // a bytes-like object is required
+TRANSLATION("abort() called", 28, 91, 51, 207, 179, 218, 40, 86, 177, 212) // abort() called
+TRANSLATION("arg is an empty sequence", 48, 79, 192, 72, 4, 160, 239, 137, 240, 32, 253, 114, 107, 67) // arg is an empty sequence
+TRANSLATION("argument has wrong type", 46, 79, 198, 110, 107, 35, 161, 64, 236, 236, 188, 9, 241, 131) // argument has wrong type
+TRANSLATION("argument num/types mismatch", 54, 79, 198, 110, 107, 33, 115, 127, 170, 124, 96, 224, 93, 34, 229, 52, 232) // argument num/types mismatch
+TRANSLATION("argument should be a '%q' not a '%q'", 72, 79, 198, 110, 107, 34, 58, 54, 109, 81, 177, 130, 26, 114, 245, 208, 43, 72, 33, 167, 47, 93, 0) // argument should be a \'%q\' not a \'%q\'
+TRANSLATION("attributes not supported yet", 56, 83, 46, 155, 102, 78, 2, 180, 136, 206, 48, 207, 39, 81, 224, 228) // attributes not supported yet
+TRANSLATION("bad conversion specifier", 49, 177, 84, 81, 151, 169, 188, 35, 40, 140, 29, 19, 116, 55) // bad conversion specifier
+TRANSLATION("bad typecode", 25, 177, 84, 79, 140, 29, 26, 166) // bad typecode
+TRANSLATION("branch not in range", 39, 179, 146, 211, 160, 86, 144, 138, 28, 151, 131) // branch not in range
+TRANSLATION("buffer size must match format", 59, 182, 119, 220, 220, 66, 127, 6, 47, 152, 145, 114, 154, 116, 27, 179, 220, 164) // buffer size must match format
+TRANSLATION("buffer too small", 33, 182, 119, 220, 220, 75, 48, 139, 149, 172) // buffer too small
+TRANSLATION("byte code not implemented", 51, 183, 137, 49, 70, 169, 133, 105, 9, 124, 88, 238, 107, 39, 80) // byte code not implemented
+TRANSLATION("bytes value out of range", 49, 183, 137, 56, 29, 74, 217, 48, 217, 144, 219, 135, 37, 224, 192) // bytes value out of range
+TRANSLATION("can only have up to 4 parameters to Thumb assembly", 101, 66, 80, 203, 111, 3, 161, 117, 49, 156, 9, 97, 255, 145, 130, 114, 185, 201, 188, 9, 97, 251, 116, 205, 246, 5, 16, 119, 218, 222, 0) // can only have up to 4 parameters to Thumb assembly
+TRANSLATION("can only save bytecode", 45, 66, 80, 203, 111, 2, 11, 169, 141, 188, 73, 209, 170, 96) // can only save bytecode
+TRANSLATION("can't add special method to already-subclassed class", 105, 66, 93, 36, 21, 106, 35, 7, 68, 43, 11, 156, 244, 106, 137, 96, 86, 115, 42, 248, 247, 70, 118, 165, 138, 32, 234, 41, 98, 136) // can\'t add special method to already-subclassed class
+TRANSLATION("can't assign to expression", 53, 66, 93, 36, 20, 66, 112, 162, 88, 31, 124, 57, 196, 35, 40) // can\'t assign to expression
+TRANSLATION("can't convert %s to complex", 55, 66, 93, 36, 81, 151, 169, 188, 142, 80, 37, 133, 26, 248, 177, 247) // can\'t convert %s to complex
+TRANSLATION("can't convert %s to float", 51, 66, 93, 36, 81, 151, 169, 188, 142, 80, 37, 134, 246, 98, 144) // can\'t convert %s to float
+TRANSLATION("can't convert %s to int", 47, 66, 93, 36, 81, 151, 169, 188, 142, 80, 37, 130, 44, 128) // can\'t convert %s to int
+TRANSLATION("can't convert '%q' object to %q implicitly", 85, 66, 93, 36, 81, 151, 169, 188, 141, 57, 122, 232, 27, 111, 51, 164, 137, 97, 203, 212, 37, 241, 100, 162, 77, 188, 0) // can\'t convert \'%q\' object to %q implicitly
+TRANSLATION("can't convert NaN to int", 49, 66, 93, 36, 81, 151, 169, 188, 143, 34, 242, 18, 193, 22, 64) // can\'t convert NaN to int
+TRANSLATION("can't convert inf to int", 49, 66, 93, 36, 81, 151, 169, 188, 132, 93, 196, 176, 69, 144) // can\'t convert inf to int
+TRANSLATION("can't convert to complex", 49, 66, 93, 36, 81, 151, 169, 188, 137, 97, 70, 190, 44, 125, 192) // can\'t convert to complex
+TRANSLATION("can't convert to float", 45, 66, 93, 36, 81, 151, 169, 188, 137, 97, 189, 152, 164) // can\'t convert to float
+TRANSLATION("can't convert to int", 41, 66, 93, 36, 81, 151, 169, 188, 137, 96, 139, 32) // can\'t convert to int
+TRANSLATION("can't convert to str implicitly", 63, 66, 93, 36, 81, 151, 169, 188, 137, 97, 18, 225, 47, 139, 37, 18, 109, 224) // can\'t convert to str implicitly
+TRANSLATION("can't declare nonlocal in outer code", 73, 66, 93, 36, 84, 233, 98, 115, 10, 203, 102, 161, 88, 34, 134, 204, 155, 138, 53, 76) // can\'t declare nonlocal in outer code
+TRANSLATION("can't delete expression", 47, 66, 93, 36, 84, 236, 114, 96, 251, 225, 206, 33, 25, 64) // can\'t delete expression
+TRANSLATION("can't do truncated division of a complex number", 95, 66, 93, 36, 85, 132, 190, 86, 133, 39, 81, 84, 234, 144, 140, 161, 183, 4, 40, 215, 197, 143, 184, 92, 223, 99, 112) // can\'t do truncated division of a complex number
+TRANSLATION("can't have multiple **x", 47, 66, 93, 36, 116, 46, 166, 47, 155, 74, 98, 198, 62, 143, 163, 184) // can\'t have multiple **x
+TRANSLATION("can't have multiple *x", 45, 66, 93, 36, 116, 46, 166, 47, 155, 74, 98, 198, 62, 142, 224) // can\'t have multiple *x
+TRANSLATION("can't pend throw to just-started generator", 85, 66, 93, 36, 96, 214, 162, 122, 59, 118, 18, 195, 207, 49, 62, 232, 146, 121, 58, 142, 13, 77, 202, 89, 192) // can\'t pend throw to just-started generator
+TRANSLATION("can't send non-None value to a just-started generator", 107, 66, 93, 36, 65, 173, 66, 178, 251, 188, 153, 76, 117, 43, 100, 196, 176, 33, 231, 152, 159, 116, 73, 60, 157, 71, 6, 166, 229, 44, 224) // can\'t send non-None value to a just-started generator
+TRANSLATION("can't switch from automatic field numbering to manual field specification", 147, 66, 93, 36, 71, 100, 154, 116, 27, 187, 92, 22, 101, 174, 82, 148, 27, 161, 218, 161, 115, 125, 141, 209, 120, 18, 194, 228, 185, 43, 13, 208, 237, 81, 24, 58, 38, 233, 66, 148, 101) // can\'t switch from automatic field numbering to manual field specification
+TRANSLATION("can't switch from manual field specification to automatic field numbering", 147, 66, 93, 36, 71, 100, 154, 116, 27, 187, 92, 92, 151, 37, 97, 186, 29, 170, 35, 7, 68, 221, 40, 82, 140, 162, 88, 22, 101, 174, 82, 148, 27, 161, 218, 161, 115, 125, 141, 209, 120) // can\'t switch from manual field specification to automatic field numbering
+TRANSLATION("cannot create '%q' instances", 57, 66, 85, 105, 20, 115, 41, 49, 167, 47, 93, 2, 44, 73, 45, 14, 0) // cannot create \'%q\' instances
+TRANSLATION("cannot create instance", 45, 66, 85, 105, 20, 115, 41, 48, 139, 18, 75, 67) // cannot create instance
+TRANSLATION("cannot import name %q", 43, 66, 85, 105, 9, 124, 51, 200, 82, 185, 142, 94, 160) // cannot import name %q
+TRANSLATION("cannot perform relative import", 61, 66, 85, 105, 24, 55, 221, 158, 225, 206, 197, 41, 212, 194, 95, 12, 242) // cannot perform relative import
+TRANSLATION("chr() arg not in range(0x110000)", 65, 78, 143, 236, 246, 130, 126, 2, 180, 132, 80, 228, 188, 31, 179, 235, 239, 239, 247, 253, 127, 95, 215, 245, 251, 64) // chr() arg not in range(0x110000)
+TRANSLATION("complex division by zero", 49, 70, 190, 44, 125, 197, 83, 170, 66, 50, 141, 188, 15, 224, 221, 128) // complex division by zero
+TRANSLATION("constant must be an integer", 55, 70, 88, 146, 89, 23, 204, 72, 216, 193, 40, 69, 147, 224, 220) // constant must be an integer
+TRANSLATION("default 'except' must be last", 59, 83, 220, 179, 105, 26, 31, 122, 30, 39, 65, 124, 196, 141, 140, 88, 162, 64) // default \'except\' must be last
+TRANSLATION("dict update sequence has wrong length", 75, 84, 164, 140, 226, 165, 38, 32, 253, 114, 107, 67, 29, 10, 7, 103, 101, 224, 88, 215, 137, 232) // dict update sequence has wrong length
+TRANSLATION("division by zero", 33, 84, 234, 144, 140, 163, 111, 3, 248, 55, 96) // division by zero
+TRANSLATION("empty separator", 30, 119, 196, 248, 16, 120, 39, 41, 103) // empty separator
+TRANSLATION("end of format while looking for conversion specifier", 104, 107, 80, 219, 141, 217, 238, 82, 59, 116, 75, 24, 179, 55, 162, 47, 3, 118, 113, 70, 94, 166, 240, 140, 162, 48, 116, 77, 208, 220) // end of format while looking for conversion specifier
+TRANSLATION("exceptions must derive from BaseException", 82, 125, 232, 120, 148, 101, 129, 124, 196, 138, 155, 167, 83, 27, 187, 92, 127, 66, 131, 231, 222, 135, 137, 70, 80) // exceptions must derive from BaseException
+TRANSLATION("expected ':' after format specifier", 70, 125, 240, 116, 147, 168, 211, 239, 208, 22, 242, 110, 55, 103, 185, 72, 140, 29, 19, 116, 55) // expected \':\' after format specifier
+TRANSLATION("expected tuple/list", 38, 125, 240, 116, 147, 168, 156, 226, 199, 245, 89, 34, 64) // expected tuple/list
+TRANSLATION("expecting just a value for set", 60, 125, 240, 116, 148, 94, 7, 158, 98, 65, 14, 165, 108, 152, 221, 156, 65, 200) // expecting just a value for set
+TRANSLATION("expecting key:value for dict", 56, 125, 240, 116, 148, 94, 7, 161, 248, 251, 250, 149, 178, 99, 118, 113, 84, 164, 128) // expecting key:value for dict
+TRANSLATION("extra keyword arguments given", 58, 125, 229, 200, 122, 31, 142, 204, 245, 4, 252, 102, 230, 179, 3, 132, 234, 106) // extra keyword arguments given
+TRANSLATION("extra positional arguments given", 64, 125, 229, 200, 97, 161, 37, 25, 74, 192, 159, 140, 220, 214, 96, 112, 157, 77, 64) // extra positional arguments given
+TRANSLATION("f-string expression part cannot include a '#'", 91, 191, 186, 37, 209, 120, 7, 223, 14, 113, 8, 202, 48, 79, 34, 132, 170, 210, 17, 105, 108, 212, 193, 13, 63, 150, 128) // f-string expression part cannot include a \'#\'
+TRANSLATION("f-string expression part cannot include a backslash", 103, 191, 186, 37, 209, 120, 7, 223, 14, 113, 8, 202, 48, 79, 34, 132, 170, 210, 17, 105, 108, 212, 193, 13, 138, 158, 145, 98, 142, 128) // f-string expression part cannot include a backslash
+TRANSLATION("f-string: empty expression not allowed", 77, 191, 186, 37, 209, 120, 251, 193, 223, 19, 224, 31, 124, 57, 196, 35, 40, 86, 144, 86, 179, 118, 58, 128) // f-string: empty expression not allowed
+TRANSLATION("f-string: expecting '}'", 47, 191, 186, 37, 209, 120, 251, 193, 247, 193, 210, 81, 120, 26, 127, 157, 0) // f-string: expecting \'}\'
+TRANSLATION("f-string: single '}' is not allowed", 71, 191, 186, 37, 209, 120, 251, 196, 34, 241, 99, 26, 127, 157, 2, 64, 86, 144, 86, 179, 118, 58, 128) // f-string: single \'}\' is not allowed
+TRANSLATION("first argument to super() must be type", 77, 186, 60, 72, 39, 227, 55, 53, 145, 44, 35, 56, 55, 246, 123, 69, 243, 18, 54, 49, 62, 48, 96) // first argument to super() must be type
+TRANSLATION("format requires a dict", 45, 187, 61, 202, 67, 159, 174, 81, 206, 1, 10, 165, 36) // format requires a dict
+TRANSLATION("function does not take keyword arguments", 81, 190, 86, 146, 140, 162, 172, 112, 21, 164, 73, 122, 24, 244, 63, 29, 153, 234, 9, 248, 205, 205, 102, 0) // function does not take keyword arguments
+TRANSLATION("function expected at most %d arguments, got %d", 93, 190, 86, 146, 140, 160, 251, 224, 233, 39, 80, 82, 46, 209, 35, 149, 65, 63, 25, 185, 172, 199, 210, 56, 105, 28, 170) // function expected at most %d arguments, got %d
+TRANSLATION("function got multiple values for argument '%q'", 93, 190, 86, 146, 140, 163, 134, 145, 124, 218, 83, 22, 49, 212, 173, 147, 129, 187, 56, 39, 227, 55, 53, 145, 167, 47, 93, 0) // function got multiple values for argument \'%q\'
+TRANSLATION("function missing %d required positional arguments", 99, 190, 86, 146, 140, 162, 233, 16, 139, 192, 229, 80, 231, 235, 148, 115, 168, 195, 66, 74, 50, 149, 129, 63, 25, 185, 172, 192) // function missing %d required positional arguments
+TRANSLATION("function missing keyword-only argument", 77, 190, 86, 146, 140, 162, 233, 16, 139, 192, 244, 63, 29, 153, 235, 238, 101, 183, 128, 79, 198, 110, 107, 32) // function missing keyword-only argument
+TRANSLATION("function missing required keyword argument '%q'", 95, 190, 86, 146, 140, 162, 233, 16, 139, 192, 115, 245, 202, 57, 212, 122, 31, 142, 204, 245, 4, 252, 102, 230, 178, 52, 229, 235, 160) // function missing required keyword argument \'%q\'
+TRANSLATION("function missing required positional argument #%d", 99, 190, 86, 146, 140, 162, 233, 16, 139, 192, 115, 245, 202, 57, 212, 97, 161, 37, 25, 74, 192, 159, 140, 220, 214, 71, 242, 229, 80) // function missing required positional argument #%d
+TRANSLATION("function takes %d positional arguments but %d were given", 113, 190, 86, 146, 140, 162, 75, 208, 224, 114, 168, 195, 66, 74, 50, 149, 129, 63, 25, 185, 172, 192, 219, 50, 57, 84, 118, 55, 49, 194, 117, 53) // function takes %d positional arguments but %d were given
+TRANSLATION("generator already executing", 55, 193, 169, 185, 75, 56, 43, 57, 149, 124, 3, 238, 116, 204, 162, 240) // generator already executing
+TRANSLATION("generator ignored GeneratorExit", 63, 193, 169, 185, 75, 56, 78, 21, 156, 234, 63, 177, 169, 185, 75, 63, 62, 233, 32) // generator ignored GeneratorExit
+TRANSLATION("identifier redefined as global", 60, 149, 53, 148, 221, 13, 195, 157, 79, 116, 83, 168, 40, 28, 89, 182, 43, 0) // identifier redefined as global
+TRANSLATION("identifier redefined as nonlocal", 64, 149, 53, 148, 221, 13, 195, 157, 79, 116, 83, 168, 40, 10, 203, 102, 161, 88) // identifier redefined as nonlocal
+TRANSLATION("incomplete format", 34, 139, 70, 190, 44, 114, 99, 118, 123, 148, 128) // incomplete format
+TRANSLATION("incomplete format key", 42, 139, 70, 190, 44, 114, 99, 118, 123, 148, 143, 67, 240) // incomplete format key
+TRANSLATION("incorrect padding", 34, 139, 70, 119, 58, 72, 193, 86, 168, 188, 0) // incorrect padding
+TRANSLATION("index out of range", 36, 139, 83, 238, 27, 50, 27, 112, 228, 188, 24) // index out of range
+TRANSLATION("indices must be integers", 48, 139, 84, 161, 192, 190, 98, 70, 198, 17, 100, 248, 55, 128) // indices must be integers
+TRANSLATION("int() arg 2 must be >= 2 and <= 36", 68, 139, 62, 207, 104, 39, 224, 125, 130, 249, 137, 27, 24, 252, 127, 216, 125, 128, 150, 163, 240, 255, 97, 246, 252, 0) // int() arg 2 must be >= 2 and <= 36
+TRANSLATION("integer required", 32, 139, 39, 193, 184, 115, 245, 202, 57, 212) // integer required
+TRANSLATION("invalid format specifier", 48, 139, 212, 172, 149, 27, 179, 220, 164, 70, 14, 137, 186, 27, 128) // invalid format specifier
+TRANSLATION("invalid micropython decorator", 58, 139, 212, 172, 149, 23, 74, 59, 99, 196, 244, 101, 21, 58, 51, 148, 179, 128) // invalid micropython decorator
+TRANSLATION("invalid syntax", 28, 139, 212, 172, 149, 17, 225, 100, 187, 128) // invalid syntax
+TRANSLATION("invalid syntax for integer", 52, 139, 212, 172, 149, 17, 225, 100, 187, 141, 217, 194, 44, 159, 6, 224) // invalid syntax for integer
+TRANSLATION("invalid syntax for integer with base %d", 78, 139, 212, 172, 149, 17, 225, 100, 187, 141, 217, 194, 44, 159, 6, 227, 178, 79, 65, 177, 65, 142, 85) // invalid syntax for integer with base %d
+TRANSLATION("invalid syntax for number", 50, 139, 212, 172, 149, 17, 225, 100, 187, 141, 217, 194, 230, 251, 27, 128) // invalid syntax for number
+TRANSLATION("issubclass() arg 1 must be a class", 68, 145, 25, 218, 150, 40, 143, 103, 180, 19, 240, 61, 226, 249, 137, 27, 24, 33, 75, 20, 64) // issubclass() arg 1 must be a class
+TRANSLATION("issubclass() arg 2 must be a class or a tuple of classes", 112, 145, 25, 218, 150, 40, 143, 103, 180, 19, 240, 62, 193, 124, 196, 141, 140, 16, 165, 138, 32, 51, 130, 19, 156, 88, 195, 110, 41, 98, 136, 56) // issubclass() arg 2 must be a class or a tuple of classes
+TRANSLATION("join expects a list of str/bytes objects consistent with self object", 137, 230, 200, 160, 251, 224, 233, 48, 8, 89, 34, 67, 110, 34, 95, 234, 219, 196, 156, 6, 219, 204, 233, 48, 40, 203, 9, 18, 107, 35, 178, 79, 65, 7, 109, 195, 109, 230, 116, 144) // join expects a list of str/bytes objects consistent with self object
+TRANSLATION("keyword argument(s) not yet implemented - use normal args instead", 131, 232, 126, 59, 51, 212, 19, 241, 155, 154, 207, 178, 61, 161, 90, 71, 131, 144, 151, 197, 142, 230, 178, 117, 30, 225, 152, 48, 172, 247, 43, 2, 126, 32, 34, 196, 153, 84) // keyword argument(s) not yet implemented - use normal args instead
+TRANSLATION("keywords must be strings", 49, 232, 126, 59, 51, 214, 5, 243, 18, 54, 49, 18, 232, 188, 64) // keywords must be strings
+TRANSLATION("label '%q' not defined", 45, 98, 216, 236, 52, 229, 235, 160, 86, 145, 83, 221, 20, 234) // label \'%q\' not defined
+TRANSLATION("length argument not allowed for this type", 83, 99, 94, 39, 160, 39, 227, 55, 53, 144, 173, 32, 173, 102, 236, 117, 27, 179, 137, 232, 144, 39, 198, 12) // length argument not allowed for this type
+TRANSLATION("local variable referenced before assignment", 87, 102, 161, 88, 117, 39, 66, 218, 198, 28, 247, 55, 53, 161, 212, 108, 123, 179, 152, 40, 132, 225, 110, 107, 32) // local variable referenced before assignment
+TRANSLATION("maximum recursion depth exceeded", 65, 114, 238, 151, 205, 195, 157, 50, 240, 140, 162, 167, 137, 232, 15, 189, 12, 234, 117) // maximum recursion depth exceeded
+TRANSLATION("memory allocation failed, allocating %u bytes", 91, 115, 187, 63, 128, 86, 179, 80, 165, 25, 70, 228, 150, 58, 253, 32, 173, 102, 161, 74, 47, 3, 150, 70, 222, 36, 224) // memory allocation failed, allocating %u bytes
+TRANSLATION("memory allocation failed, heap is locked", 81, 115, 187, 63, 128, 86, 179, 80, 165, 25, 70, 228, 150, 58, 253, 35, 161, 150, 2, 64, 179, 83, 208, 234) // memory allocation failed, heap is locked
+TRANSLATION("module not found", 33, 118, 174, 108, 97, 90, 70, 237, 149, 168) // module not found
+TRANSLATION("multiple *x in assignment", 51, 124, 218, 83, 22, 49, 244, 119, 8, 160, 162, 19, 133, 185, 172, 128) // multiple *x in assignment
+TRANSLATION("multiple bases have instance lay-out conflict", 91, 124, 218, 83, 22, 49, 177, 65, 192, 232, 93, 76, 34, 196, 146, 208, 197, 139, 199, 185, 179, 34, 140, 187, 217, 41, 32) // multiple bases have instance lay-out conflict
+TRANSLATION("must use keyword argument for key function", 85, 124, 196, 140, 193, 143, 67, 241, 217, 158, 160, 159, 140, 220, 214, 70, 236, 227, 208, 252, 13, 242, 180, 148, 101) // must use keyword argument for key function
+TRANSLATION("name '%q' is not defined", 48, 165, 115, 26, 114, 245, 208, 36, 5, 105, 21, 61, 209, 78, 160) // name \'%q\' is not defined
+TRANSLATION("name not defined", 32, 165, 115, 10, 210, 42, 123, 162, 157, 64) // name not defined
+TRANSLATION("name reused for argument", 48, 165, 115, 14, 121, 131, 168, 221, 156, 19, 241, 155, 154, 200) // name reused for argument
+TRANSLATION("need more than %d values to unpack", 68, 166, 117, 23, 103, 49, 61, 9, 71, 42, 142, 165, 108, 156, 9, 97, 149, 193, 83, 208) // need more than %d values to unpack
+TRANSLATION("negative shift count", 40, 167, 193, 74, 117, 49, 29, 19, 121, 20, 108, 172, 128) // negative shift count
+TRANSLATION("no active exception to reraise", 60, 172, 10, 146, 157, 76, 31, 122, 30, 37, 25, 68, 176, 115, 114, 72, 48) // no active exception to reraise
+TRANSLATION("no binding for nonlocal found", 58, 172, 54, 69, 170, 47, 3, 118, 112, 172, 182, 106, 21, 134, 237, 149, 168) // no binding for nonlocal found
+TRANSLATION("no module named '%q'", 40, 172, 46, 213, 205, 140, 41, 92, 234, 52, 229, 235, 160) // no module named \'%q\'
+TRANSLATION("no such attribute", 34, 172, 35, 52, 232, 10, 101, 211, 108, 201, 128) // no such attribute
+TRANSLATION("non-default argument follows default argument", 90, 172, 190, 234, 158, 229, 155, 72, 39, 227, 55, 53, 145, 187, 90, 205, 218, 5, 79, 114, 205, 164, 19, 241, 155, 154, 200) // non-default argument follows default argument
+TRANSLATION("non-hex digit found", 38, 172, 190, 238, 135, 220, 85, 56, 73, 27, 182, 86, 160) // non-hex digit found
+TRANSLATION("non-keyword arg after */**", 52, 172, 190, 239, 67, 241, 217, 158, 160, 159, 128, 91, 201, 184, 250, 62, 175, 163, 232) // non-keyword arg after */**
+TRANSLATION("non-keyword arg after keyword arg", 66, 172, 190, 239, 67, 241, 217, 158, 160, 159, 128, 91, 201, 184, 244, 63, 29, 153, 234, 9, 248) // non-keyword arg after keyword arg
+TRANSLATION("not all arguments converted during string formatting", 104, 173, 32, 173, 96, 79, 198, 110, 107, 48, 40, 203, 212, 222, 78, 162, 185, 116, 94, 4, 75, 162, 240, 55, 103, 185, 76, 162, 240) // not all arguments converted during string formatting
+TRANSLATION("not enough arguments for format string", 76, 173, 32, 213, 179, 199, 64, 79, 198, 110, 107, 48, 55, 103, 27, 179, 220, 164, 68, 186, 47, 0) // not enough arguments for format string
+TRANSLATION("object '%s' is not a tuple or list", 68, 219, 121, 157, 36, 105, 202, 52, 9, 1, 90, 65, 9, 206, 44, 97, 156, 89, 34, 64) // object \'%s\' is not a tuple or list
+TRANSLATION("object does not support item assignment", 78, 219, 121, 157, 36, 85, 142, 2, 180, 136, 206, 48, 207, 33, 36, 238, 10, 33, 56, 91, 154, 200) // object does not support item assignment
+TRANSLATION("object does not support item deletion", 74, 219, 121, 157, 36, 85, 142, 2, 180, 136, 206, 48, 207, 33, 36, 238, 42, 118, 57, 70, 80) // object does not support item deletion
+TRANSLATION("object has no len", 34, 219, 121, 157, 36, 116, 40, 10, 194, 198, 160) // object has no len
+TRANSLATION("object is not subscriptable", 54, 219, 121, 157, 36, 36, 5, 105, 17, 157, 162, 142, 152, 146, 218, 198) // object is not subscriptable
+TRANSLATION("object not an iterator", 44, 219, 121, 157, 36, 43, 72, 37, 9, 38, 229, 44, 224) // object not an iterator
+TRANSLATION("object not callable", 38, 219, 121, 157, 36, 43, 72, 161, 90, 197, 181, 140) // object not callable
+TRANSLATION("object not in sequence", 44, 219, 121, 157, 36, 43, 72, 69, 16, 126, 185, 53, 161, 128) // object not in sequence
+TRANSLATION("object not iterable", 38, 219, 121, 157, 36, 43, 72, 73, 55, 45, 172, 96) // object not iterable
+TRANSLATION("object of type '%s' has no len()", 64, 219, 121, 157, 36, 54, 226, 124, 96, 198, 156, 163, 65, 208, 160, 43, 11, 26, 251, 61, 160) // object of type \'%s\' has no len()
+TRANSLATION("object with buffer protocol required", 72, 219, 121, 157, 36, 118, 73, 232, 54, 206, 251, 155, 140, 59, 75, 81, 172, 28, 253, 114, 142, 117) // object with buffer protocol required
+TRANSLATION("odd-length string", 34, 213, 175, 186, 198, 188, 79, 65, 18, 232, 188, 0) // odd-length string
+TRANSLATION("offset out of bounds", 40, 219, 239, 7, 33, 179, 33, 183, 27, 54, 86, 176) // offset out of bounds
+TRANSLATION("only slices with step=1 (aka None) are supported", 96, 203, 111, 2, 44, 148, 56, 29, 146, 122, 8, 147, 199, 251, 123, 199, 176, 189, 8, 121, 50, 159, 180, 19, 152, 140, 227, 12, 242, 117) // only slices with step=1 (aka None) are supported
+TRANSLATION("ord expects a character", 46, 207, 80, 125, 240, 116, 152, 4, 41, 208, 156, 169, 38, 224) // ord expects a character
+TRANSLATION("ord() expected a character, but string of length %d found", 114, 207, 95, 103, 180, 31, 124, 29, 36, 234, 8, 83, 161, 57, 82, 77, 254, 145, 182, 100, 68, 186, 47, 1, 183, 22, 53, 226, 122, 14, 85, 27, 182, 86, 160) // ord() expected a character, but string of length %d found
+TRANSLATION("overflow converting long int to machine word", 88, 221, 77, 247, 179, 118, 20, 101, 234, 111, 40, 188, 11, 50, 240, 17, 100, 75, 11, 149, 58, 34, 152, 236, 207, 80) // overflow converting long int to machine word
+TRANSLATION("parameters must be registers in sequence r0 to r3", 99, 130, 114, 185, 201, 188, 11, 230, 36, 108, 97, 207, 132, 137, 55, 128, 138, 32, 253, 114, 107, 67, 15, 245, 137, 96, 255, 104) // parameters must be registers in sequence r0 to r3
+TRANSLATION("pop from an empty set", 43, 134, 192, 221, 218, 224, 148, 29, 241, 62, 4, 28, 128) // pop from an empty set
+TRANSLATION("pop from empty list", 39, 134, 192, 221, 218, 224, 239, 137, 240, 44, 145, 32) // pop from empty list
+TRANSLATION("popitem(): dictionary is empty", 61, 134, 194, 73, 223, 217, 237, 251, 197, 82, 146, 140, 164, 254, 2, 64, 59, 226, 124, 0) // popitem(): dictionary is empty
+TRANSLATION("raw f-strings are not implemented", 66, 229, 216, 111, 238, 137, 116, 94, 32, 19, 152, 86, 144, 151, 197, 142, 230, 178, 117) // raw f-strings are not implemented
+TRANSLATION("requested length %d but object has length %d", 88, 231, 235, 147, 137, 58, 139, 26, 241, 61, 7, 42, 141, 179, 33, 182, 243, 58, 72, 232, 80, 44, 107, 196, 244, 28, 170) // requested length %d but object has length %d
+TRANSLATION("rsplit(None,n)", 28, 241, 139, 36, 251, 60, 153, 79, 233, 95, 104) // rsplit(None,n)
+TRANSLATION("sign not allowed in string format specifier", 87, 9, 194, 133, 105, 5, 107, 55, 99, 168, 69, 17, 46, 139, 192, 221, 158, 229, 34, 48, 116, 77, 208, 220) // sign not allowed in string format specifier
+TRANSLATION("sign not allowed with integer format specifier 'c'", 101, 9, 194, 133, 105, 5, 107, 55, 99, 168, 236, 147, 208, 34, 201, 240, 110, 55, 103, 185, 72, 140, 29, 19, 116, 55, 26, 83, 64) // sign not allowed with integer format specifier \'c\'
+TRANSLATION("single '}' encountered in format string", 79, 8, 188, 88, 198, 159, 231, 64, 107, 70, 202, 201, 185, 212, 34, 141, 217, 238, 82, 34, 93, 23, 128) // single \'}\' encountered in format string
+TRANSLATION("slice step cannot be zero", 51, 22, 74, 24, 137, 60, 10, 18, 171, 72, 216, 199, 240, 110, 192) // slice step cannot be zero
+TRANSLATION("small int overflow", 37, 23, 43, 88, 34, 200, 110, 166, 251, 217, 187, 0) // small int overflow
+TRANSLATION("start/end indices", 35, 18, 79, 63, 81, 173, 66, 45, 82, 135, 0) // start/end indices
+TRANSLATION("stream operation not supported", 61, 18, 230, 87, 13, 131, 114, 148, 101, 10, 210, 35, 56, 195, 60, 157, 64) // stream operation not supported
+TRANSLATION("string index out of range", 51, 18, 232, 188, 4, 90, 159, 112, 217, 144, 219, 135, 37, 224, 192) // string index out of range
+TRANSLATION("string indices must be integers, not %s", 79, 18, 232, 188, 4, 90, 165, 14, 5, 243, 18, 54, 48, 139, 39, 193, 188, 125, 33, 90, 71, 40) // string indices must be integers, not %s
+TRANSLATION("string not supported; use bytes or bytearray", 89, 18, 232, 188, 5, 105, 17, 156, 97, 158, 78, 191, 250, 25, 131, 27, 120, 147, 128, 206, 54, 241, 38, 78, 229, 224) // string not supported; use bytes or bytearray
+TRANSLATION("substring not found", 39, 25, 218, 37, 209, 120, 10, 210, 55, 108, 173, 64) // substring not found
+TRANSLATION("super() can't find self", 47, 25, 193, 191, 179, 218, 40, 75, 164, 141, 209, 106, 32, 237, 184) // super() can\'t find self
+TRANSLATION("too many values to unpack (expected %d)", 79, 44, 194, 228, 190, 7, 82, 182, 78, 4, 176, 202, 224, 169, 232, 61, 135, 223, 7, 73, 58, 142, 85, 246, 128) // too many values to unpack (expected %d)
+TRANSLATION("tuple index out of range", 49, 57, 197, 140, 34, 212, 251, 134, 204, 134, 220, 57, 47, 6) // tuple index out of range
+TRANSLATION("tuple/list has wrong length", 55, 57, 197, 143, 234, 178, 68, 142, 133, 3, 179, 178, 240, 44, 107, 196, 244) // tuple/list has wrong length
+TRANSLATION("type '%q' is not an acceptable base type", 81, 62, 48, 99, 78, 94, 186, 4, 128, 173, 32, 148, 21, 40, 120, 146, 218, 198, 54, 40, 49, 62, 48, 96) // type \'%q\' is not an acceptable base type
+TRANSLATION("type is not an acceptable base type", 71, 62, 48, 97, 32, 43, 72, 37, 5, 74, 30, 36, 182, 177, 141, 138, 12, 79, 140, 24) // type is not an acceptable base type
+TRANSLATION("type object '%q' has no attribute '%q'", 77, 62, 48, 97, 182, 243, 58, 72, 211, 151, 174, 131, 161, 64, 86, 5, 50, 233, 182, 100, 198, 156, 189, 116) // type object \'%q\' has no attribute \'%q\'
+TRANSLATION("type takes 1 or 3 arguments", 55, 62, 48, 98, 75, 208, 224, 123, 195, 56, 251, 65, 63, 25, 185, 172, 192) // type takes 1 or 3 arguments
+TRANSLATION("unexpected indent", 35, 149, 62, 248, 58, 73, 212, 34, 212, 214, 64) // unexpected indent
+TRANSLATION("unexpected keyword argument '%q'", 65, 149, 62, 248, 58, 73, 212, 122, 31, 142, 204, 245, 4, 252, 102, 230, 178, 52, 229, 235, 160) // unexpected keyword argument \'%q\'
+TRANSLATION("unicode name escapes", 41, 149, 74, 53, 76, 41, 92, 193, 197, 11, 7, 0) // unicode name escapes
+TRANSLATION("unindent does not match any outer indentation level", 103, 149, 69, 169, 172, 138, 177, 192, 86, 145, 114, 154, 116, 4, 190, 3, 102, 77, 194, 45, 77, 100, 165, 25, 69, 143, 169, 216) // unindent does not match any outer indentation level
+TRANSLATION("unknown conversion specifier %c", 63, 149, 244, 86, 236, 162, 140, 189, 77, 225, 25, 68, 96, 232, 155, 161, 184, 229, 64) // unknown conversion specifier %c
+TRANSLATION("unknown format code '%c' for object of type '%s'", 97, 149, 244, 86, 236, 163, 118, 123, 148, 138, 53, 76, 105, 202, 154, 13, 217, 195, 109, 230, 116, 144, 219, 137, 241, 131, 26, 114, 141, 0) // unknown format code \'%c\' for object of type \'%s\'
+TRANSLATION("unmatched '{' in format", 47, 149, 185, 77, 58, 29, 70, 159, 247, 160, 69, 27, 179, 220, 164) // unmatched \'{\' in format
+TRANSLATION("unreadable attribute", 41, 149, 115, 42, 150, 214, 48, 83, 46, 155, 102, 76) // unreadable attribute
+TRANSLATION("unsupported Thumb instruction '%s' with %d arguments", 105, 149, 140, 227, 12, 242, 117, 31, 183, 76, 223, 96, 139, 18, 249, 164, 163, 40, 211, 148, 104, 59, 36, 244, 28, 170, 9, 248, 205, 205, 102, 0) // unsupported Thumb instruction \'%s\' with %d arguments
+TRANSLATION("unsupported format character '%c' (0x%x) at index %d", 105, 149, 140, 227, 12, 242, 117, 27, 179, 220, 164, 83, 161, 57, 82, 77, 198, 156, 169, 160, 246, 125, 125, 249, 119, 246, 130, 144, 139, 83, 238, 57, 84) // unsupported format character \'%c\' (0x%x) at index %d
+TRANSLATION("unsupported type for %q: '%s'", 59, 149, 140, 227, 12, 242, 117, 19, 227, 6, 55, 103, 28, 189, 126, 241, 167, 40, 208) // unsupported type for %q: \'%s\'
+TRANSLATION("unsupported type for operator", 59, 149, 140, 227, 12, 242, 117, 19, 227, 6, 55, 103, 13, 131, 114, 150, 112) // unsupported type for operator
+TRANSLATION("unsupported types for %q: '%s', '%s'", 73, 149, 140, 227, 12, 242, 117, 19, 227, 7, 3, 118, 113, 203, 215, 239, 26, 114, 141, 62, 145, 167, 40, 208) // unsupported types for %q: \'%s\', \'%s\'
+TRANSLATION("value must fit in %d byte(s)", 57, 212, 173, 147, 23, 204, 72, 221, 36, 34, 142, 85, 27, 120, 147, 246, 71, 180) // value must fit in %d byte(s)
+TRANSLATION("wrong number of arguments", 51, 217, 217, 120, 11, 155, 236, 110, 27, 112, 79, 198, 110, 107, 48) // wrong number of arguments
+TRANSLATION("wrong number of values to unpack", 65, 217, 217, 120, 11, 155, 236, 110, 27, 113, 212, 173, 147, 129, 44, 50, 184, 42, 122, 0) // wrong number of values to unpack
+TRANSLATION("zero step", 19, 252, 27, 176, 137, 60, 0) // zero step
+
+#ifdef QSTR_INDEX
+QSTR_INDEX(104, 414, 68, 54, 16, 11, 1, 2, 1, 5, 196, 2, 23, 13, 38, 19)
+QSTR_INDEX(4, 117, 24, 116, 1, 43, 107, 93, 15, 5, 2, 1, 17, 13, 6, 1)
+QSTR_INDEX(5, 34, 174, 15, 24, 4, 130, 53, 25, 559, 2, 42, 39, 98, 145, 3)
+QSTR_INDEX(114, 143, 1, 36, 134, 2, 90, 17, 260, 5, 74, 266, 24, 2, 2, 574)
+QSTR_INDEX(164, 109, 734, 359, 593, 193, 813, 100, 7, 2, 117, 7, 361, 7, 287, 154)
+QSTR_INDEX(1959, 6, 1357, 64, 156, 60, 242, 1648, 8, 1252, 1, 5, 2226, 12, 85, 535)
+QSTR_INDEX(2, 884, 13, 30, 901, 2153, 6, 27, 1177, 1004, 56, 183, 53, 335, 350, 73)
+QSTR_INDEX(242, 1, 97, 337, 47, 231, 257, 206, 229, 136, 351, 387, 413, 135, 176, 163)
+QSTR_INDEX(223, 202, 288, 319, 201, 186, 294, 158, 110, 395, 154, 239, 192, 64, 67, 234)
+QSTR_INDEX(77, 114, 171, 356, 111, 332, 38, 222, 279, 246, 324, 13, 159, 174, 70, 198)
+QSTR_INDEX(330, 396, 349, 255, 364, 43, 305, 22, 325, 30, 89, 343, 39, 170, 344, 79)
+QSTR_INDEX(298, 259, 23, 230, 281, 398, 374, 109, 232, 26, 314, 95, 107, 213, 33, 7)
+QSTR_INDEX(322, 274, 277, 381, 60, 300, 216, 254, 228, 293, 83, 91, 10, 34, 402, 127)
+QSTR_INDEX(128, 221, 317, 100, 379, 147, 48, 15, 224, 287, 74, 290, 399, 152, 409, 3)
+QSTR_INDEX(175, 357, 333, 247, 280, 140, 71, 391, 394, 320, 121, 304, 9, 143, 358, 403)
+QSTR_INDEX(265, 342, 161, 25, 42, 96, 29, 204, 173, 92, 372, 339, 46, 219, 238, 153)
+QSTR_INDEX(27, 69, 397, 17, 296, 352, 382, 406, 215, 210, 76, 112, 196, 11, 270, 134)
+QSTR_INDEX(271, 120, 363, 105, 367, 258, 225, 118, 14, 61, 211, 273, 263, 236, 253, 340)
+QSTR_INDEX(370, 262, 348, 212, 66, 327, 245, 276, 104, 346, 278, 129, 311, 286, 179, 264)
+QSTR_INDEX(251, 261, 98, 180, 86, 345, 326, 188, 63, 138, 21, 233, 244, 240, 185, 132)
+QSTR_INDEX(199, 329, 164, 302, 41, 235, 149, 182, 328, 181, 197, 193, 99, 68, 312, 6)
+QSTR_INDEX(412, 291, 411, 284, 195, 318, 177, 388, 155, 207, 130, 401, 90, 124, 157, 119)
+QSTR_INDEX(371, 93, 16, 310, 383, 389, 2, 203, 62, 191, 334, 410, 365, 72, 189, 113)
+QSTR_INDEX(289, 368, 303, 378, 12, 392, 249, 400, 360, 220, 366, 146, 275, 306, 45, 103)
+QSTR_INDEX(151, 108, 299, 36, 347, 8, 162, 341, 122, 19, 237, 32, 301, 256, 81, 28)
+QSTR_INDEX(205, 184, 55, 376, 40, 150, 167, 116, 58, 309, 252, 148, 373, 51, 35, 54)
+QSTR_INDEX(156, 18, 359, 355, 385, 88, 178, 267, 331, 307, 316, 393, 131, 52, 59, 380)
+QSTR_INDEX(285, 94, 187, 139, 125, 85, 166, 266, 405, 101, 123, 142, 354, 268, 106, 78)
+QSTR_INDEX(31, 241, 37, 4, 133, 65, 145, 190, 407, 160, 141, 353, 57, 165, 384, 361)
+QSTR_INDEX(214, 117, 44, 50, 295, 308, 115, 227, 338, 82, 169, 282, 272, 283, 5, 377)
+QSTR_INDEX(250, 248, 336, 87, 362, 126, 292, 390, 386, 375, 168, 84, 404, 49, 144, 313)
+QSTR_INDEX(269, 209, 217, 218, 80, 200, 297, 414, 208, 102, 24, 321, 75, 20, 260, 408)
+QSTR_INDEX(369, 194, 172, 137, 226, 323, 243, 315)
+#endif
+
+// 2812 bytes worth of qstr
+// 7120 bytes worth of translations
+// 4388 bytes worth of translations compressed
+// 2732 bytes saved
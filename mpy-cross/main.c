@@ -96,6 +96,42 @@ STATIC int compile_and_save(const char *file, const char *output_file, const cha
     }
 }
 
+// Parse a module only to collect its public consts, so that modules compiled
+// afterwards can use them in place of names imported from it.
+STATIC int load_consts(const char *file) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_lexer_t *lex = mp_lexer_new_from_file(file);
+
+        // the module name is the file name without directory and .py extension
+        const char *name = strrchr(file, '/');
+        name = name == NULL ? file : name + 1;
+        size_t len = strlen(name);
+        if (len > 3 && strcmp(name + len - 3, ".py") == 0) {
+            len -= 3;
+        }
+
+        if (MP_STATE_VM(comp_const_modules) == NULL) {
+            MP_STATE_VM(comp_const_modules) = MP_OBJ_TO_PTR(mp_obj_new_dict(0));
+        }
+        mp_obj_t consts = mp_obj_new_dict(0);
+        MP_STATE_VM(comp_const_export) = MP_OBJ_TO_PTR(consts);
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        MP_STATE_VM(comp_const_export) = NULL;
+        mp_parse_tree_clear(&parse_tree);
+
+        mp_obj_dict_store(MP_OBJ_FROM_PTR(MP_STATE_VM(comp_const_modules)),
+            MP_OBJ_NEW_QSTR(qstr_from_strn(name, len)), consts);
+
+        nlr_pop();
+        return 0;
+    } else {
+        MP_STATE_VM(comp_const_export) = NULL;
+        mp_obj_print_exception(&mp_stderr_print, (mp_obj_t)nlr.ret_val);
+        return 1;
+    }
+}
+
 STATIC int usage(char **argv) {
     printf(
 "usage: %s [<opts>] [-X <implopt>] <input filename>\n"
@@ -104,6 +140,8 @@ STATIC int usage(char **argv) {
 "-s : source filename to embed in the compiled bytecode (defaults to input file)\n"
 "-v : verbose (trace various operations); can be multiple\n"
 "-O[N] : apply bytecode optimizations of level N\n"
+"-c <file> : make the public consts of the module in <file> available to\n"
+"            'from <module> import <name>'; can be given more than once\n"
 "\n"
 "Target specific options:\n"
 "-msmall-int-bits=number : set the maximum bits used to encode a small-int\n"
@@ -224,6 +262,14 @@ MP_NOINLINE int main_(int argc, char **argv) {
                 }
                 a += 1;
                 source_file = argv[a];
+            } else if (strcmp(argv[a], "-c") == 0) {
+                if (a + 1 >= argc) {
+                    exit(usage(argv));
+                }
+                a += 1;
+                if (load_consts(argv[a]) != 0) {
+                    exit(1);
+                }
             } else if (strncmp(argv[a], "-msmall-int-bits=", sizeof("-msmall-int-bits=") - 1) == 0) {
                 char *end;
                 mp_dynamic_compiler.small_int_bits =
@@ -42,13 +42,19 @@
 #define MICROPY_COMP_CONST_FOLDING  (1)
 #define MICROPY_COMP_MODULE_CONST   (1)
 #define MICROPY_COMP_CONST          (1)
+#define MICROPY_COMP_CONST_STR      (1)
+#define MICROPY_COMP_CONST_IMPORT   (1)
 #define MICROPY_COMP_DOUBLE_TUPLE_ASSIGN (1)
 #define MICROPY_COMP_TRIPLE_TUPLE_ASSIGN (1)
 #define MICROPY_COMP_RETURN_IF_EXPR (1)
 
 #define MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE (0)
+#define MICROPY_OPT_BC_PEEPHOLE     (1)
+#define MICROPY_OPT_FAST_NUM_PARSE  (1)
+#define MICROPY_OPT_LEXER_FAST_SCAN (1)
 
 #define MICROPY_READER_POSIX        (1)
+#define MICROPY_READER_BUF_SIZE     (4096)
 #define MICROPY_ENABLE_RUNTIME      (0)
 #define MICROPY_ENABLE_GC           (1)
 #define MICROPY_STACK_CHECK         (1)
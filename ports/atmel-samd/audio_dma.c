@@ -122,9 +122,11 @@ void audio_dma_convert_signed(audio_dma_t* dma, uint8_t* buffer, uint32_t buffer
 void audio_dma_load_next_block(audio_dma_t* dma) {
     uint8_t* buffer;
     uint32_t buffer_length;
+    uint64_t started = audiocore_stats_now();
     audioio_get_buffer_result_t get_buffer_result =
         audiosample_get_buffer(dma->sample, dma->single_channel, dma->audio_channel,
                                &buffer, &buffer_length);
+    audiocore_stats_got_buffer(&dma->stats, started);
 
     DmacDescriptor* descriptor = dma->second_descriptor;
     if (dma->first_descriptor_free) {
@@ -153,6 +155,7 @@ void audio_dma_load_next_block(audio_dma_t* dma) {
         }
     }
     descriptor->BTCTRL.bit.VALID = true;
+    audiocore_stats_filled(&dma->stats, started, descriptor->BTCNT.reg);
 }
 
 static void setup_audio_descriptor(DmacDescriptor* descriptor, uint8_t beat_size,
@@ -195,6 +198,10 @@ audio_dma_result audio_dma_setup_playback(audio_dma_t* dma,
     dma->second_descriptor = NULL;
     dma->spacing = 1;
     dma->first_descriptor_free = true;
+    audiocore_stats_init(&dma->stats, audiosample_sample_rate(sample));
+    // Let samples that can render in the DAC's format do so, so their buffers
+    // don't have to be converted into first_buffer and second_buffer.
+    audiosample_set_output_signed(sample, output_signed);
     audiosample_reset_buffer(sample, single_channel, audio_channel);
 
     bool single_buffer;
@@ -280,6 +287,7 @@ audio_dma_result audio_dma_setup_playback(audio_dma_t* dma,
 
     dma_configure(dma_channel, dma_trigger_source, true);
     audio_dma_enable_channel(dma_channel);
+    audiocore_stats_started(&dma->stats);
 
     return AUDIO_DMA_OK;
 }
@@ -301,6 +309,7 @@ void audio_dma_pause(audio_dma_t* dma) {
 }
 
 void audio_dma_resume(audio_dma_t* dma) {
+    audiocore_stats_resync(&dma->stats);
     dma_resume_channel(dma->dma_channel);
 }
 
@@ -313,8 +322,16 @@ bool audio_dma_get_paused(audio_dma_t* dma) {
     return (status & DMAC_CHINTFLAG_SUSP) != 0;
 }
 
+void audio_dma_get_stats(audio_dma_t* dma, audiocore_stats_t* stats, bool reset) {
+    audiocore_stats_merge(stats, &dma->stats);
+    if (reset) {
+        audiocore_stats_clear(&dma->stats);
+    }
+}
+
 void audio_dma_init(audio_dma_t* dma) {
     dma->dma_channel = AUDIO_DMA_CHANNEL_COUNT;
+    audiocore_stats_init(&dma->stats, 0);
 }
 
 void audio_dma_reset(void) {
@@ -358,6 +375,8 @@ void audio_dma_background(void) {
 
         bool block_done = event_interrupt_active(dma->event_channel);
         if (!block_done) {
+            // Nothing is due, so give the sample time to read ahead.
+            audiosample_prefetch(dma->sample);
             continue;
         }
 
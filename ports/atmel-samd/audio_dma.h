@@ -29,6 +29,7 @@
 
 #include "extmod/vfs_fat.h"
 #include "py/obj.h"
+#include "shared-module/audiocore/__init__.h"
 #include "shared-module/audiocore/RawSample.h"
 #include "shared-module/audiocore/WaveFile.h"
 
@@ -49,6 +50,7 @@ typedef struct {
     uint8_t* second_buffer;
     bool first_descriptor_free;
     DmacDescriptor* second_descriptor;
+    audiocore_stats_t stats;
 } audio_dma_t;
 
 typedef enum {
@@ -92,6 +94,7 @@ bool audio_dma_get_playing(audio_dma_t* dma);
 void audio_dma_pause(audio_dma_t* dma);
 void audio_dma_resume(audio_dma_t* dma);
 bool audio_dma_get_paused(audio_dma_t* dma);
+void audio_dma_get_stats(audio_dma_t* dma, audiocore_stats_t* stats, bool reset);
 
 void audio_dma_background(void);
 
@@ -27,6 +27,7 @@
 
 #include "audio_dma.h"
 #include "supervisor/filesystem.h"
+#include "supervisor/shared/background_tasks.h"
 #include "supervisor/shared/tick.h"
 #include "supervisor/usb.h"
 
@@ -39,11 +40,69 @@
 #include "shared-module/displayio/__init__.h"
 #endif
 
-volatile uint64_t last_finished_tick = 0;
+#if CIRCUITPY_AUDIOBUSIO
+#include "common-hal/audiobusio/PDMIn.h"
+#endif
+
+#if CIRCUITPY_TOUCHIO && CIRCUITPY_TOUCHIO_USE_NATIVE && defined(SAMD21)
+#include "common-hal/touchio/TouchIn.h"
+#define TOUCHIN_BACKGROUND (1)
+#else
+#define TOUCHIN_BACKGROUND (0)
+#endif
+
+#if CIRCUITPY_I2CSLAVE
+#include "common-hal/i2cslave/I2CSlave.h"
+#endif
 
 bool stack_ok_so_far = true;
 
-static bool running_background_tasks = false;
+#if CIRCUITPY_AUDIOIO || CIRCUITPY_AUDIOBUSIO
+STATIC background_task_t audio_dma_task = BACKGROUND_TASK(audio_dma_background, BACKGROUND_TASK_PRIORITY_AUDIO, 1);
+#endif
+#if CIRCUITPY_AUDIOBUSIO
+STATIC background_task_t pdmin_task = BACKGROUND_TASK(pdmin_background, BACKGROUND_TASK_PRIORITY_AUDIO, 1);
+#endif
+STATIC background_task_t usb_task = BACKGROUND_TASK(usb_background, BACKGROUND_TASK_PRIORITY_USB, 1);
+#if CIRCUITPY_NETWORK
+STATIC background_task_t network_task = BACKGROUND_TASK(network_module_background, BACKGROUND_TASK_PRIORITY_NETWORK, 8);
+#endif
+STATIC background_task_t filesystem_task = BACKGROUND_TASK(filesystem_background, BACKGROUND_TASK_PRIORITY_FILESYSTEM, 16);
+#if CIRCUITPY_DISPLAYIO
+STATIC background_task_t displayio_task = BACKGROUND_TASK(displayio_background, BACKGROUND_TASK_PRIORITY_DISPLAY, 16);
+#endif
+#if CIRCUITPY_I2CSLAVE
+STATIC background_task_t i2cslave_task = BACKGROUND_TASK(i2cslave_background, BACKGROUND_TASK_PRIORITY_I2CSLAVE, 1);
+#endif
+#if TOUCHIN_BACKGROUND
+STATIC background_task_t touchin_task = BACKGROUND_TASK(touchin_background, BACKGROUND_TASK_PRIORITY_TOUCH, 16);
+#endif
+
+STATIC bool tasks_registered = false;
+
+STATIC void register_background_tasks(void) {
+    #if CIRCUITPY_AUDIOIO || CIRCUITPY_AUDIOBUSIO
+    supervisor_background_task_register(&audio_dma_task);
+    #endif
+    #if CIRCUITPY_AUDIOBUSIO
+    supervisor_background_task_register(&pdmin_task);
+    #endif
+    supervisor_background_task_register(&usb_task);
+    #if CIRCUITPY_NETWORK
+    supervisor_background_task_register(&network_task);
+    #endif
+    supervisor_background_task_register(&filesystem_task);
+    #if CIRCUITPY_DISPLAYIO
+    supervisor_background_task_register(&displayio_task);
+    #endif
+    #if CIRCUITPY_I2CSLAVE
+    supervisor_background_task_register(&i2cslave_task);
+    #endif
+    #if TOUCHIN_BACKGROUND
+    supervisor_background_task_register(&touchin_task);
+    #endif
+    tasks_registered = true;
+}
 
 #ifdef MONITOR_BACKGROUND_TASKS
 // PB03 is physical pin "SCL" on the Metro M4 express
@@ -63,39 +122,19 @@ STATIC void finish_background_task(void) {}
 #endif
 
 void background_tasks_reset(void) {
-    running_background_tasks = false;
+    supervisor_background_tasks_reset();
 }
 
 void run_background_tasks(void) {
-    // Don't call ourselves recursively.
-    if (running_background_tasks) {
-        return;
+    if (!tasks_registered) {
+        register_background_tasks();
     }
 
     start_background_task();
-
-    assert_heap_ok();
-    running_background_tasks = true;
-
-    #if CIRCUITPY_AUDIOIO || CIRCUITPY_AUDIOBUSIO
-    audio_dma_background();
-    #endif
-    #if CIRCUITPY_DISPLAYIO
-    displayio_background();
-    #endif
-
-    #if CIRCUITPY_NETWORK
-    network_module_background();
-    #endif
-    filesystem_background();
-    usb_background();
-    running_background_tasks = false;
-    assert_heap_ok();
-
-    last_finished_tick = port_get_raw_ticks(NULL);
+    supervisor_background_tasks_run();
     finish_background_task();
 }
 
 bool background_tasks_ok(void) {
-    return port_get_raw_ticks(NULL) - last_finished_tick < 1024;
+    return supervisor_background_tasks_ok();
 }
@@ -97,7 +97,10 @@ void board_init(void) {
         &pin_PA01, // busy_pin
         false, // busy_state
         5, // seconds_per_frame
-        false); // chip_select (don't always toggle chip select)
+        false, // chip_select (don't always toggle chip select)
+        NULL, // partial_start_sequence
+        0, // partial_start_sequence_len
+        0); // partial_refresh_limit
 }
 
 bool board_requests_safe_mode(void) {
@@ -58,4 +58,5 @@ void reset_board(void) {
     common_hal_nvm_bytearray_get_bytes(&bootcnt,0,1,&value_out);
     ++value_out;
     common_hal_nvm_bytearray_set_bytes(&bootcnt,0,&value_out,1);
+    common_hal_nvm_bytearray_flush(&bootcnt);
 }
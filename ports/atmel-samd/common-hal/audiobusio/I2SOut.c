@@ -344,6 +344,10 @@ bool common_hal_audiobusio_i2sout_get_paused(audiobusio_i2sout_obj_t* self) {
     return audio_dma_get_paused(&self->dma);
 }
 
+void common_hal_audiobusio_i2sout_get_stats(audiobusio_i2sout_obj_t* self, audiocore_stats_t* stats, bool reset) {
+    audio_dma_get_stats(&self->dma, stats, reset);
+}
+
 void common_hal_audiobusio_i2sout_stop(audiobusio_i2sout_obj_t* self) {
     audio_dma_stop(&self->dma);
 
@@ -52,6 +52,10 @@
 
 #define OVERSAMPLING 64
 #define SAMPLES_PER_BUFFER 32
+// Samples in each DMA buffer while streaming. Background tasks have to
+// decimate one buffer while the other fills, so this is larger than for
+// record(), where the loop does nothing else.
+#define STREAM_SAMPLES_PER_BUFFER 128
 
 // MEMS microphones must be clocked at at least 1MHz.
 #define MIN_MIC_CLOCK 1000000
@@ -64,6 +68,16 @@
 #define SERCTRL(name) I2S_RXCTRL_ ## name
 #endif
 
+// The PDMIn recording in the background, if any, and the hardware it uses.
+// These are kept outside of the object so they can be reset without it.
+static struct {
+    audiobusio_pdmin_obj_t* pdmin;
+    uint32_t buffers_processed;
+    uint8_t dma_channel;
+    uint8_t event_channel;
+    uint8_t serializer;
+} streaming;
+
 void pdmin_reset(void) {
     while (I2S->SYNCBUSY.reg & I2S_SYNCBUSY_ENABLE) {}
     I2S->INTENCLR.reg = I2S_INTENCLR_MASK;
@@ -224,6 +238,7 @@ void common_hal_audiobusio_pdmin_deinit(audiobusio_pdmin_obj_t* self) {
     if (common_hal_audiobusio_pdmin_deinited(self)) {
         return;
     }
+    common_hal_audiobusio_pdmin_stop_stream(self);
 
     i2s_set_serializer_enable(self->serializer, false);
     i2s_set_clock_unit_enable(self->clock_unit, false);
@@ -349,6 +364,22 @@ static uint16_t filter_sample(uint32_t pdm_samples[4]) {
     return running_sum;
 }
 
+// Decimates count samples from buffer into output, which holds 8 or 16 bit
+// values depending on bit_depth.
+static void decimate(audiobusio_pdmin_obj_t* self, uint32_t* buffer, uint8_t* output, uint32_t count) {
+    uint8_t words_per_sample = self->bytes_per_sample / 2;
+    for (uint32_t i = 0; i < count; i++) {
+        // Call filter_sample just one place so it can be inlined.
+        uint16_t value = filter_sample(buffer + i * words_per_sample);
+        if (self->bit_depth == 8) {
+            // Truncate to 8 bits.
+            output[i] = value >> 8;
+        } else {
+            ((uint16_t*)(void*) output)[i] = value;
+        }
+    }
+}
+
 // output_buffer may be a byte buffer or a halfword buffer.
 // output_buffer_length is the number of slots, not the number of bytes.
 uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t* self,
@@ -423,17 +454,9 @@ uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t* se
         uint32_t samples_gathered = descriptor->BTCNT.reg / words_per_sample;
         // Don't run off the end of output buffer. Process only as many as needed.
         uint32_t samples_to_process = min(remaining_samples_needed, samples_gathered);
-        for (uint32_t i = 0; i < samples_to_process; i++) {
-            // Call filter_sample just one place so it can be inlined.
-            uint16_t value = filter_sample(buffer + i * words_per_sample);
-            if (self->bit_depth == 8) {
-                // Truncate to 8 bits.
-                ((uint8_t*) output_buffer)[values_output] = value >> 8;
-            } else {
-                output_buffer[values_output] = value;
-            }
-            values_output++;
-        }
+        decimate(self, buffer, ((uint8_t*) output_buffer) + values_output * self->bit_depth / 8,
+                 samples_to_process);
+        values_output += samples_to_process;
 
         buffers_processed++;
 
@@ -469,6 +492,128 @@ uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t* se
     return values_output;
 }
 
+void common_hal_audiobusio_pdmin_start_stream(audiobusio_pdmin_obj_t* self,
+        uint32_t block_length, uint8_t block_count) {
+    if (streaming.pdmin != NULL) {
+        mp_raise_RuntimeError(translate("Serializer in use"));
+    }
+    uint8_t words_per_sample = self->bytes_per_sample / 2;
+    uint32_t words_per_buffer = STREAM_SAMPLES_PER_BUFFER * words_per_sample;
+    audiobusio_pdmstream_construct(&self->stream, block_length * self->bit_depth / 8, block_count);
+    self->raw_buffer = m_malloc(2 * words_per_buffer * sizeof(uint32_t), false);
+    // The heap keeps blocks 16 byte aligned, as descriptors must be.
+    self->second_descriptor = m_malloc(sizeof(DmacDescriptor), false);
+    if (self->raw_buffer == NULL || self->second_descriptor == NULL) {
+        audiobusio_pdmstream_deinit(&self->stream);
+        mp_raise_msg(&mp_type_MemoryError, translate("Couldn't allocate input buffer"));
+    }
+
+    uint8_t dma_channel = audio_dma_allocate_channel();
+    if (dma_channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        audiobusio_pdmstream_deinit(&self->stream);
+        mp_raise_RuntimeError(translate("No DMA channel found"));
+    }
+    turn_on_event_system();
+    uint8_t event_channel = find_sync_event_channel();
+    if (event_channel >= EVSYS_SYNCH_NUM) {
+        audio_dma_free_channel(dma_channel);
+        audiobusio_pdmstream_deinit(&self->stream);
+        mp_raise_RuntimeError(translate("All sync event channels in use"));
+    }
+
+    // Asking for exactly two buffers' worth chains them into a loop.
+    setup_dma(self, 2 * STREAM_SAMPLES_PER_BUFFER, dma_descriptor(dma_channel),
+              self->second_descriptor, words_per_buffer, words_per_sample,
+              self->raw_buffer, self->raw_buffer + words_per_buffer);
+
+    uint8_t trigger_source = I2S_DMAC_ID_RX_0;
+    #ifdef SAMD21
+    trigger_source += self->serializer;
+    #endif
+
+    dma_configure(dma_channel, trigger_source, true);
+    init_event_channel_interrupt(event_channel, CORE_GCLK, EVSYS_ID_GEN_DMAC_CH_0 + dma_channel);
+
+    streaming.pdmin = self;
+    streaming.buffers_processed = 0;
+    streaming.dma_channel = dma_channel;
+    streaming.event_channel = event_channel;
+    streaming.serializer = self->serializer;
+    // Keep the object, and so its buffers, alive while DMA writes to them.
+    MP_STATE_PORT(playing_audio)[dma_channel] = self;
+
+    // Turn on serializer now to get it in sync with DMA.
+    i2s_set_serializer_enable(self->serializer, true);
+    audio_dma_enable_channel(dma_channel);
+}
+
+STATIC void stop_streaming(void) {
+    disable_event_channel(streaming.event_channel);
+    MP_STATE_PORT(playing_audio)[streaming.dma_channel] = NULL;
+    audio_dma_free_channel(streaming.dma_channel);
+    // Turn off serializer, but leave clock on, to avoid mic startup delay.
+    i2s_set_serializer_enable(streaming.serializer, false);
+    streaming.pdmin = NULL;
+}
+
+void common_hal_audiobusio_pdmin_stop_stream(audiobusio_pdmin_obj_t* self) {
+    if (streaming.pdmin != self) {
+        return;
+    }
+    stop_streaming();
+    audiobusio_pdmstream_deinit(&self->stream);
+    self->raw_buffer = NULL;
+    self->second_descriptor = NULL;
+}
+
+// Runs before audio DMA is reset, while the channel is still allocated.
+void pdmin_stream_reset(void) {
+    if (streaming.pdmin != NULL) {
+        stop_streaming();
+    }
+}
+
+bool common_hal_audiobusio_pdmin_get_streaming(audiobusio_pdmin_obj_t* self) {
+    return audiobusio_pdmstream_active(&self->stream);
+}
+
+uint8_t* common_hal_audiobusio_pdmin_read_block(audiobusio_pdmin_obj_t* self, uint32_t* length) {
+    *length = self->stream.block_size;
+    return audiobusio_pdmstream_read(&self->stream);
+}
+
+uint32_t common_hal_audiobusio_pdmin_get_overruns(audiobusio_pdmin_obj_t* self) {
+    return self->stream.overruns;
+}
+
+// Decimates the DMA buffer that just filled into the ring.
+void pdmin_background(void) {
+    audiobusio_pdmin_obj_t* self = streaming.pdmin;
+    if (self == NULL || !event_interrupt_active(streaming.event_channel)) {
+        return;
+    }
+    if (event_interrupt_overflow(streaming.event_channel)) {
+        // Both buffers filled since we last looked, so the older one is
+        // being overwritten already.
+        audiobusio_pdmstream_overrun(&self->stream);
+        streaming.buffers_processed++;
+    }
+    uint8_t bytes_per_value = self->bit_depth / 8;
+    uint32_t words_per_buffer = STREAM_SAMPLES_PER_BUFFER * self->bytes_per_sample / 2;
+    uint32_t* buffer = self->raw_buffer + (streaming.buffers_processed % 2) * words_per_buffer;
+    streaming.buffers_processed++;
+
+    uint32_t samples_done = 0;
+    while (samples_done < STREAM_SAMPLES_PER_BUFFER) {
+        uint32_t space;
+        uint8_t* output = audiobusio_pdmstream_write_pointer(&self->stream, &space);
+        uint32_t count = min(space / bytes_per_value, STREAM_SAMPLES_PER_BUFFER - samples_done);
+        decimate(self, buffer + samples_done * self->bytes_per_sample / 2, output, count);
+        audiobusio_pdmstream_commit(&self->stream, count * bytes_per_value);
+        samples_done += count;
+    }
+}
+
 void common_hal_audiobusio_pdmin_record_to_file(audiobusio_pdmin_obj_t* self, uint8_t* buffer, uint32_t length) {
 
 }
@@ -31,6 +31,7 @@
 
 #include "extmod/vfs_fat.h"
 #include "py/obj.h"
+#include "shared-module/audiobusio/PDMStream.h"
 
 typedef struct {
     mp_obj_base_t base;
@@ -42,9 +43,14 @@ typedef struct {
     uint8_t bytes_per_sample;
     uint8_t bit_depth;
     uint8_t gclk;
+    // Used by start_stream.
+    audiobusio_pdmstream_t stream;
+    uint32_t* raw_buffer; // Two halves that DMA fills in turn
+    DmacDescriptor* second_descriptor;
 } audiobusio_pdmin_obj_t;
 
 void pdmin_reset(void);
+void pdmin_stream_reset(void);
 
 void pdmin_background(void);
 
@@ -375,6 +375,10 @@ void common_hal_audioio_audioout_play(audioio_audioout_obj_t* self,
     if (sample_rate > max_sample_rate) {
         mp_raise_ValueError_varg(translate("Sample rate too high. It must be less than %d"), max_sample_rate);
     }
+    #ifdef SAMD51
+    // The right channel may not be needed for this sample.
+    audiocore_stats_init(&self->right_dma.stats, 0);
+    #endif
     #ifdef SAMD21
     result = audio_dma_setup_playback(&self->left_dma, sample, loop, true, 0,
                                       false /* output unsigned */,
@@ -458,6 +462,13 @@ bool common_hal_audioio_audioout_get_paused(audioio_audioout_obj_t* self) {
     return audio_dma_get_paused(&self->left_dma);
 }
 
+void common_hal_audioio_audioout_get_stats(audioio_audioout_obj_t* self, audiocore_stats_t* stats, bool reset) {
+    audio_dma_get_stats(&self->left_dma, stats, reset);
+    #ifdef SAMD51
+    audio_dma_get_stats(&self->right_dma, stats, reset);
+    #endif
+}
+
 void common_hal_audioio_audioout_stop(audioio_audioout_obj_t* self) {
     Tc* timer = tc_insts[self->tc_index];
     timer->COUNT16.CTRLBSET.reg = TC_CTRLBSET_CMD_STOP;
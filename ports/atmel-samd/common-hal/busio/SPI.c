@@ -41,6 +41,10 @@
 #include "samd/dma.h"
 #include "samd/sercom.h"
 
+#if CIRCUITPY_BUSIO_SPI_BACKGROUND
+#include "audio_dma.h"
+#endif
+
 bool never_reset_sercoms[SERCOM_INST_NUM];
 
 void never_reset_sercom(Sercom* sercom) {
@@ -229,6 +233,13 @@ void common_hal_busio_spi_construct(busio_spi_obj_t *self,
         claim_pin(miso);
     }
 
+    #if CIRCUITPY_BUSIO_SPI_BACKGROUND
+    self->tx_channel = AUDIO_DMA_CHANNEL_COUNT;
+    self->rx_channel = AUDIO_DMA_CHANNEL_COUNT;
+    self->transfer_failed = false;
+    self->transfer_buffers = MP_OBJ_NULL;
+    #endif
+
     spi_m_sync_enable(&self->spi_desc);
 }
 
@@ -248,6 +259,9 @@ void common_hal_busio_spi_deinit(busio_spi_obj_t *self) {
     if (common_hal_busio_spi_deinited(self)) {
         return;
     }
+    #if CIRCUITPY_BUSIO_SPI_BACKGROUND
+    common_hal_busio_spi_wait(self);
+    #endif
     allow_reset_sercom(self->spi_desc.dev.prvt);
 
     spi_m_sync_disable(&self->spi_desc);
@@ -260,6 +274,9 @@ void common_hal_busio_spi_deinit(busio_spi_obj_t *self) {
 
 bool common_hal_busio_spi_configure(busio_spi_obj_t *self,
         uint32_t baudrate, uint8_t polarity, uint8_t phase, uint8_t bits) {
+    #if CIRCUITPY_BUSIO_SPI_BACKGROUND
+    common_hal_busio_spi_wait(self);
+    #endif
     uint8_t baud_reg_value = samd_peripherals_spi_baudrate_to_baud_reg_value(baudrate);
 
     void * hw = self->spi_desc.dev.prvt;
@@ -308,6 +325,9 @@ void common_hal_busio_spi_unlock(busio_spi_obj_t *self) {
 
 bool common_hal_busio_spi_write(busio_spi_obj_t *self,
         const uint8_t *data, size_t len) {
+    #if CIRCUITPY_BUSIO_SPI_BACKGROUND
+    common_hal_busio_spi_wait(self);
+    #endif
     if (len == 0) {
         return true;
     }
@@ -324,6 +344,9 @@ bool common_hal_busio_spi_write(busio_spi_obj_t *self,
 
 bool common_hal_busio_spi_read(busio_spi_obj_t *self,
         uint8_t *data, size_t len, uint8_t write_value) {
+    #if CIRCUITPY_BUSIO_SPI_BACKGROUND
+    common_hal_busio_spi_wait(self);
+    #endif
     if (len == 0) {
         return true;
     }
@@ -342,6 +365,9 @@ bool common_hal_busio_spi_read(busio_spi_obj_t *self,
 }
 
 bool common_hal_busio_spi_transfer(busio_spi_obj_t *self, uint8_t *data_out, uint8_t *data_in, size_t len) {
+    #if CIRCUITPY_BUSIO_SPI_BACKGROUND
+    common_hal_busio_spi_wait(self);
+    #endif
     if (len == 0) {
         return true;
     }
@@ -358,6 +384,118 @@ bool common_hal_busio_spi_transfer(busio_spi_obj_t *self, uint8_t *data_out, uin
     return status >= 0; // Status is number of chars read or an error code < 0.
 }
 
+#if CIRCUITPY_BUSIO_SPI_BACKGROUND
+STATIC uint8_t sercom_index(Sercom* sercom) {
+    Sercom *sercom_instances[SERCOM_INST_NUM] = SERCOM_INSTS;
+    for (uint8_t i = 0; i < SERCOM_INST_NUM; i++) {
+        if (sercom_instances[i] == sercom) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+STATIC void finish_transfer(busio_spi_obj_t *self) {
+    uint8_t status = dma_transfer_status(self->rx_channel) | dma_transfer_status(self->tx_channel);
+    self->transfer_failed = (status & DMAC_CHINTFLAG_TERR) != 0;
+    MP_STATE_PORT(playing_audio)[self->rx_channel] = NULL;
+    audio_dma_free_channel(self->tx_channel);
+    audio_dma_free_channel(self->rx_channel);
+    self->tx_channel = AUDIO_DMA_CHANNEL_COUNT;
+    self->rx_channel = AUDIO_DMA_CHANNEL_COUNT;
+    self->transfer_buffers = MP_OBJ_NULL;
+}
+
+bool common_hal_busio_spi_start_transfer(busio_spi_obj_t *self, uint8_t *data_out, uint8_t *data_in,
+        size_t len, mp_obj_t buffers) {
+    common_hal_busio_spi_wait(self);
+    if (len == 0) {
+        self->transfer_failed = false;
+        return true;
+    }
+    uint8_t tx_channel = audio_dma_allocate_channel();
+    uint8_t rx_channel = audio_dma_allocate_channel();
+    if (tx_channel >= AUDIO_DMA_CHANNEL_COUNT || rx_channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        if (tx_channel < AUDIO_DMA_CHANNEL_COUNT) {
+            audio_dma_free_channel(tx_channel);
+        }
+        if (rx_channel < AUDIO_DMA_CHANNEL_COUNT) {
+            audio_dma_free_channel(rx_channel);
+        }
+        return false;
+    }
+
+    Sercom* sercom = self->spi_desc.dev.prvt;
+    uint8_t index = sercom_index(sercom);
+    // Drop anything left over from an earlier write so it isn't read back first.
+    while (sercom->SPI.INTFLAG.bit.RXC) {
+        (void) sercom->SPI.DATA.reg;
+    }
+
+    // Reading is paced by received bytes and writing by an empty data register,
+    // so the two channels run in step a byte at a time.
+    DmacDescriptor* descriptor = dma_descriptor(rx_channel);
+    descriptor->BTCTRL.reg = DMAC_BTCTRL_VALID |
+                             DMAC_BTCTRL_BLOCKACT_NOACT |
+                             DMAC_BTCTRL_DSTINC |
+                             DMAC_BTCTRL_BEATSIZE_BYTE;
+    descriptor->BTCNT.reg = len;
+    descriptor->SRCADDR.reg = (uint32_t) &sercom->SPI.DATA.reg;
+    descriptor->DSTADDR.reg = (uint32_t) data_in + len;
+    descriptor->DESCADDR.reg = 0;
+    dma_configure(rx_channel, SERCOM0_DMAC_ID_RX + 2 * index, false);
+
+    descriptor = dma_descriptor(tx_channel);
+    descriptor->BTCTRL.reg = DMAC_BTCTRL_VALID |
+                             DMAC_BTCTRL_BLOCKACT_NOACT |
+                             DMAC_BTCTRL_SRCINC |
+                             DMAC_BTCTRL_BEATSIZE_BYTE;
+    descriptor->BTCNT.reg = len;
+    descriptor->SRCADDR.reg = (uint32_t) data_out + len;
+    descriptor->DSTADDR.reg = (uint32_t) &sercom->SPI.DATA.reg;
+    descriptor->DESCADDR.reg = 0;
+    dma_configure(tx_channel, SERCOM0_DMAC_ID_TX + 2 * index, false);
+
+    self->tx_channel = tx_channel;
+    self->rx_channel = rx_channel;
+    self->transfer_failed = false;
+    self->transfer_buffers = buffers;
+    // Keeps the buffers alive while the transfer runs and lets a reset
+    // end it along with the audio channels.
+    MP_STATE_PORT(playing_audio)[rx_channel] = self;
+
+    audio_dma_enable_channel(rx_channel);
+    audio_dma_enable_channel(tx_channel);
+    return true;
+}
+
+bool common_hal_busio_spi_get_busy(busio_spi_obj_t *self) {
+    if (self->rx_channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        return false;
+    }
+    if (MP_STATE_PORT(playing_audio)[self->rx_channel] != self) {
+        // audio_dma_reset() already freed the channels.
+        self->tx_channel = AUDIO_DMA_CHANNEL_COUNT;
+        self->rx_channel = AUDIO_DMA_CHANNEL_COUNT;
+        self->transfer_buffers = MP_OBJ_NULL;
+        return false;
+    }
+    uint8_t status = dma_transfer_status(self->rx_channel);
+    if ((status & (DMAC_CHINTFLAG_TCMPL | DMAC_CHINTFLAG_TERR)) == 0) {
+        return true;
+    }
+    finish_transfer(self);
+    return false;
+}
+
+bool common_hal_busio_spi_wait(busio_spi_obj_t *self) {
+    while (common_hal_busio_spi_get_busy(self)) {
+        RUN_BACKGROUND_TASKS;
+    }
+    return !self->transfer_failed;
+}
+#endif
+
 uint32_t common_hal_busio_spi_get_frequency(busio_spi_obj_t* self) {
     return samd_peripherals_spi_baud_reg_value_to_baudrate(hri_sercomspi_read_BAUD_reg(self->spi_desc.dev.prvt));
 }
@@ -40,6 +40,15 @@ typedef struct {
     uint8_t clock_pin;
     uint8_t MOSI_pin;
     uint8_t MISO_pin;
+    #if CIRCUITPY_BUSIO_SPI_BACKGROUND
+    // DMA channels of a transfer started in the background, or
+    // AUDIO_DMA_CHANNEL_COUNT when there is none.
+    uint8_t tx_channel;
+    uint8_t rx_channel;
+    bool transfer_failed;
+    // Kept referenced until the transfer is done.
+    mp_obj_t transfer_buffers;
+    #endif
 } busio_spi_obj_t;
 
 void reset_sercoms(void);
@@ -24,6 +24,8 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/busio/UART.h"
 
@@ -43,8 +45,13 @@
 #include "hal/include/hal_usart_async.h"
 #include "hal/include/hpl_usart_async.h"
 
+#include "samd/dma.h"
 #include "samd/sercom.h"
 
+#if CIRCUITPY_BUSIO_UART_RX_DMA
+#include "audio_dma.h"
+#endif
+
 #define UART_DEBUG(...) (void)0
 // #define UART_DEBUG(...) mp_printf(&mp_plat_print __VA_OPT__(,) __VA_ARGS__)
 
@@ -54,6 +61,57 @@ static void usart_async_rxc_callback(const struct usart_async_descriptor *const
     // Nothing needs to be done by us.
 }
 
+#if CIRCUITPY_BUSIO_UART_RX_DMA
+// Receive every character straight into the buffer, wrapping around by linking
+// the descriptor to itself. Returns false if there's no free channel.
+STATIC bool start_rx_dma(busio_uart_obj_t *self, Sercom* sercom, uint8_t sercom_index) {
+    uint8_t channel = audio_dma_allocate_channel();
+    if (channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        return false;
+    }
+    DmacDescriptor* descriptor = dma_descriptor(channel);
+    descriptor->BTCTRL.reg = DMAC_BTCTRL_VALID |
+                             DMAC_BTCTRL_BLOCKACT_NOACT |
+                             DMAC_BTCTRL_DSTINC |
+                             DMAC_BTCTRL_BEATSIZE_BYTE;
+    descriptor->BTCNT.reg = self->buffer_length;
+    descriptor->SRCADDR.reg = (uint32_t) &sercom->USART.DATA.reg;
+    descriptor->DSTADDR.reg = (uint32_t) self->buffer + self->buffer_length;
+    descriptor->DESCADDR.reg = (uint32_t) descriptor;
+    dma_configure(channel, SERCOM0_DMAC_ID_RX + 2 * sercom_index, false);
+
+    // The write back may be stale from the channel's last use.
+    DmacDescriptor* write_back = ((DmacDescriptor*) DMAC->WRBADDR.reg) + channel;
+    write_back->BTCNT.reg = self->buffer_length;
+
+    self->rx_channel = channel;
+    self->rx_read_index = 0;
+    audio_dma_enable_channel(channel);
+    return true;
+}
+
+// Index in buffer that the next received character goes to.
+STATIC uint32_t rx_dma_write_index(busio_uart_obj_t *self) {
+    DmacDescriptor* write_back = ((DmacDescriptor*) DMAC->WRBADDR.reg) + self->rx_channel;
+    return (self->buffer_length - write_back->BTCNT.reg) % self->buffer_length;
+}
+
+STATIC uint32_t rx_dma_available(busio_uart_obj_t *self) {
+    return (rx_dma_write_index(self) + self->buffer_length - self->rx_read_index) % self->buffer_length;
+}
+
+// Copy out up to len received characters. Characters that were overwritten
+// because the buffer filled up are lost.
+STATIC size_t rx_dma_read(busio_uart_obj_t *self, uint8_t *data, size_t len) {
+    size_t count = MIN(len, rx_dma_available(self));
+    size_t first = MIN(count, self->buffer_length - self->rx_read_index);
+    memcpy(data, self->buffer + self->rx_read_index, first);
+    memcpy(data + first, self->buffer, count - first);
+    self->rx_read_index = (self->rx_read_index + count) % self->buffer_length;
+    return count;
+}
+#endif
+
 void common_hal_busio_uart_construct(busio_uart_obj_t *self,
     const mcu_pin_obj_t * tx, const mcu_pin_obj_t * rx,
     const mcu_pin_obj_t * rts, const mcu_pin_obj_t * cts,
@@ -86,6 +144,9 @@ void common_hal_busio_uart_construct(busio_uart_obj_t *self,
     self->baudrate = baudrate;
     self->character_bits = bits;
     self->timeout_ms = timeout * 1000;
+    #if CIRCUITPY_BUSIO_UART_RX_DMA
+    self->rx_channel = AUDIO_DMA_CHANNEL_COUNT;
+    #endif
 
     // This assignment is only here because the usart_async routines take a *const argument.
     struct usart_async_descriptor * const usart_desc_p = (struct usart_async_descriptor * const) &self->usart_desc;
@@ -220,8 +281,13 @@ void common_hal_busio_uart_construct(busio_uart_obj_t *self,
     // Different read function behavior in some asynchronous drivers. As of this writing:
     // http://start.atmel.com/static/help/index.html?GUID-79201A5A-226F-4FBB-B0B8-AB0BE0554836
     // Look at the ASFv4 code example for async USART.
-    usart_async_register_callback(usart_desc_p, USART_ASYNC_RXC_CB, usart_async_rxc_callback);
-
+    // When DMA receives the characters the interrupts stay off.
+    #if CIRCUITPY_BUSIO_UART_RX_DMA
+    if (!have_rx || self->buffer == NULL || !start_rx_dma(self, sercom, sercom_index))
+    #endif
+    {
+        usart_async_register_callback(usart_desc_p, USART_ASYNC_RXC_CB, usart_async_rxc_callback);
+    }
 
     if (have_tx) {
         gpio_set_pin_direction(tx->number, GPIO_DIRECTION_OUT);
@@ -256,6 +322,12 @@ void common_hal_busio_uart_deinit(busio_uart_obj_t *self) {
     }
     // This assignment is only here because the usart_async routines take a *const argument.
     struct usart_async_descriptor * const usart_desc_p = (struct usart_async_descriptor * const) &self->usart_desc;
+    #if CIRCUITPY_BUSIO_UART_RX_DMA
+    if (self->rx_channel < AUDIO_DMA_CHANNEL_COUNT) {
+        audio_dma_free_channel(self->rx_channel);
+        self->rx_channel = AUDIO_DMA_CHANNEL_COUNT;
+    }
+    #endif
     usart_async_disable(usart_desc_p);
     usart_async_deinit(usart_desc_p);
     reset_pin_number(self->rx_pin);
@@ -287,7 +359,15 @@ size_t common_hal_busio_uart_read(busio_uart_obj_t *self, uint8_t *data, size_t
     // Busy-wait until timeout or until we've read enough chars.
     while (supervisor_ticks_ms64() - start_ticks <= self->timeout_ms) {
         // Read as many chars as we can right now, up to len.
-        size_t num_read = io_read(io, data, len);
+        size_t num_read;
+        #if CIRCUITPY_BUSIO_UART_RX_DMA
+        if (self->rx_channel < AUDIO_DMA_CHANNEL_COUNT) {
+            num_read = rx_dma_read(self, data, len);
+        } else
+        #endif
+        {
+            num_read = io_read(io, data, len);
+        }
 
         // Advance pointer in data buffer, and decrease how many chars left to read.
         data += num_read;
@@ -381,6 +461,11 @@ void common_hal_busio_uart_set_timeout(busio_uart_obj_t *self, mp_float_t timeou
 }
 
 uint32_t common_hal_busio_uart_rx_characters_available(busio_uart_obj_t *self) {
+    #if CIRCUITPY_BUSIO_UART_RX_DMA
+    if (self->rx_channel < AUDIO_DMA_CHANNEL_COUNT) {
+        return rx_dma_available(self);
+    }
+    #endif
     // This assignment is only here because the usart_async routines take a *const argument.
     struct usart_async_descriptor * const usart_desc_p = (struct usart_async_descriptor * const) &self->usart_desc;
     struct usart_async_status async_status;
@@ -389,6 +474,12 @@ uint32_t common_hal_busio_uart_rx_characters_available(busio_uart_obj_t *self) {
 }
 
 void common_hal_busio_uart_clear_rx_buffer(busio_uart_obj_t *self) {
+    #if CIRCUITPY_BUSIO_UART_RX_DMA
+    if (self->rx_channel < AUDIO_DMA_CHANNEL_COUNT) {
+        self->rx_read_index = rx_dma_write_index(self);
+        return;
+    }
+    #endif
     // This assignment is only here because the usart_async routines take a *const argument.
     struct usart_async_descriptor * const usart_desc_p = (struct usart_async_descriptor * const) &self->usart_desc;
     usart_async_flush_rx_buffer(usart_desc_p);
@@ -44,6 +44,12 @@ typedef struct {
     uint32_t timeout_ms;
     uint32_t buffer_length;
     uint8_t* buffer;
+    #if CIRCUITPY_BUSIO_UART_RX_DMA
+    // DMA channel filling buffer as a ring, or AUDIO_DMA_CHANNEL_COUNT when
+    // characters are received by interrupt instead.
+    uint8_t rx_channel;
+    uint32_t rx_read_index;
+    #endif
 } busio_uart_obj_t;
 
 #endif // MICROPY_INCLUDED_ATMEL_SAMD_COMMON_HAL_BUSIO_UART_H
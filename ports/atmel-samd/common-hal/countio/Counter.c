@@ -4,10 +4,134 @@
 #include "atmel_start_pins.h"
 
 #include "eic_handler.h"
+#include "timer_handler.h"
+#include "samd/clocks.h"
+#include "samd/events.h"
 #include "samd/external_interrupts.h"
+#include "samd/timers.h"
 #include "py/runtime.h"
 #include "supervisor/shared/translate.h"
 
+static countio_counter_obj_t *active_counters[TC_INST_NUM];
+
+// Route falling edges on the EIC channel through the event system to a TC
+// that counts them. Returns false, having claimed nothing, when no TC or
+// event channel is free.
+static bool counter_start_tc(countio_counter_obj_t* self) {
+    uint8_t timer_index = find_free_timer();
+    if (timer_index == 0xff) {
+        return false;
+    }
+    turn_on_event_system();
+    uint8_t evsys_channel = find_async_event_channel();
+    if (evsys_channel >= EVSYS_CHANNELS) {
+        return false;
+    }
+    Tc *tc = tc_insts[timer_index];
+
+    self->uses_tc = true;
+    self->tc_index = timer_index;
+    self->event_channel = evsys_channel;
+    active_counters[timer_index] = self;
+
+    // The TC only needs a clock to synchronise events; GCLK0 is always on.
+    set_timer_handler(true, timer_index, TC_HANDLER_COUNTER);
+    turn_on_clocks(true, timer_index, 0);
+
+    eic_set_enable(false);
+    uint8_t config_index = self->eic_channel_a / 8;
+    uint8_t position = (self->eic_channel_a % 8) * 4;
+    uint32_t masked_value = EIC->CONFIG[config_index].reg & ~(0xf << position);
+    EIC->CONFIG[config_index].reg = masked_value | (EIC_CONFIG_SENSE0_FALL_Val << position);
+    #ifdef SAMD21
+    EIC->EVCTRL.vec.EXTINTEO |= 1 << self->eic_channel_a;
+    #endif
+    #ifdef SAMD51
+    EIC->EVCTRL.bit.EXTINTEO |= 1 << self->eic_channel_a;
+    #endif
+    eic_set_enable(true);
+
+    #ifdef SAMD21
+    connect_event_user_to_channel((EVSYS_ID_USER_TC3_EVU + timer_index), evsys_channel);
+    #endif
+    #ifdef SAMD51
+    connect_event_user_to_channel((EVSYS_ID_USER_TC0_EVU + timer_index), evsys_channel);
+    #endif
+    init_async_event_channel(evsys_channel, (EVSYS_ID_GEN_EIC_EXTINT_0 + self->eic_channel_a));
+
+    tc_set_enable(tc, false);
+    tc_reset(tc);
+    #ifdef SAMD21
+    tc->COUNT16.CTRLA.reg = TC_CTRLA_MODE_COUNT16 |
+                            TC_CTRLA_PRESCALER_DIV1;
+    tc->COUNT16.EVCTRL.bit.TCEI = 1;
+    tc->COUNT16.EVCTRL.bit.EVACT = TC_EVCTRL_EVACT_COUNT_Val;
+    #endif
+    #ifdef SAMD51
+    tc->COUNT16.EVCTRL.reg = TC_EVCTRL_EVACT(TC_EVCTRL_EVACT_COUNT_Val) | TC_EVCTRL_TCEI;
+    tc->COUNT16.CTRLA.reg = TC_CTRLA_MODE_COUNT16 |
+                            TC_CTRLA_PRESCALER_DIV1;
+    #endif
+    // Only the 16-bit wrap interrupts; every edge below that is free.
+    tc->COUNT16.INTENSET.reg = TC_INTENSET_OVF;
+    tc_enable_interrupts(timer_index);
+    tc_set_enable(tc, true);
+    return true;
+}
+
+static void counter_stop_tc(countio_counter_obj_t* self) {
+    Tc *tc = tc_insts[self->tc_index];
+    tc_set_enable(tc, false);
+    tc_reset(tc);
+    tc_disable_interrupts(self->tc_index);
+    set_timer_handler(true, self->tc_index, TC_HANDLER_NO_INTERRUPT);
+
+    disable_event_channel(self->event_channel);
+    eic_set_enable(false);
+    #ifdef SAMD21
+    disable_event_user(EVSYS_ID_USER_TC3_EVU + self->tc_index);
+    EIC->EVCTRL.vec.EXTINTEO &= ~(1 << self->eic_channel_a);
+    #endif
+    #ifdef SAMD51
+    disable_event_user(EVSYS_ID_USER_TC0_EVU + self->tc_index);
+    EIC->EVCTRL.bit.EXTINTEO &= ~(1 << self->eic_channel_a);
+    #endif
+    eic_set_enable(true);
+    if (EIC->EVCTRL.reg == 0 && EIC->INTENSET.reg == 0) {
+        turn_off_external_interrupt_controller();
+    }
+
+    active_counters[self->tc_index] = NULL;
+    self->uses_tc = false;
+}
+
+// Read the TC count, folding a wrap that hasn't been serviced yet into
+// self->count so the result is never short by 65536.
+static uint16_t counter_read_tc(countio_counter_obj_t* self) {
+    Tc *tc = tc_insts[self->tc_index];
+    tc_disable_interrupts(self->tc_index);
+    #ifdef SAMD51
+    tc->COUNT16.CTRLBSET.bit.CMD = TC_CTRLBSET_CMD_READSYNC_Val;
+    while ((tc->COUNT16.SYNCBUSY.bit.COUNT == 1) ||
+           (tc->COUNT16.CTRLBSET.bit.CMD == TC_CTRLBSET_CMD_READSYNC_Val)) {
+    }
+    #endif
+    #ifdef SAMD21
+    tc->COUNT16.READREQ.reg = TC_READREQ_RREQ | TC_READREQ_ADDR(0x10);
+    while (tc->COUNT16.STATUS.bit.SYNCBUSY == 1) {
+    }
+    #endif
+    uint16_t value = tc->COUNT16.COUNT.reg;
+    // A pending wrap with a small value happened before the read, so account
+    // for it now. A large value means it happened after; leave it for the ISR.
+    if (tc->COUNT16.INTFLAG.bit.OVF && value < 0x8000) {
+        tc->COUNT16.INTFLAG.reg = TC_INTFLAG_OVF;
+        self->count += 0x10000;
+    }
+    tc_enable_interrupts(self->tc_index);
+    return value;
+}
+
 void common_hal_countio_counter_construct(countio_counter_obj_t* self,
     const mcu_pin_obj_t* pin_a) {
     if (!pin_a->has_extint) {
@@ -31,14 +155,17 @@ void common_hal_countio_counter_construct(countio_counter_obj_t* self,
     gpio_set_pin_function(self->pin_a, GPIO_PIN_FUNCTION_A);
     gpio_set_pin_pull_mode(self->pin_a, GPIO_PULL_UP);
 
-    set_eic_channel_data(self->eic_channel_a, (void*) self);
-
     self->count = 0;
+    self->uses_tc = false;
 
 
     claim_pin(pin_a);
 
+    if (counter_start_tc(self)) {
+        return;
+    }
 
+    set_eic_channel_data(self->eic_channel_a, (void*) self);
     set_eic_handler(self->eic_channel_a, EIC_HANDLER_COUNTER);
     turn_on_eic_channel(self->eic_channel_a, EIC_CONFIG_SENSE0_FALL_Val);
 
@@ -53,8 +180,12 @@ void common_hal_countio_counter_deinit(countio_counter_obj_t* self) {
         return;
     }
 
-    set_eic_handler(self->eic_channel_a, EIC_HANDLER_NO_INTERRUPT);
-    turn_off_eic_channel(self->eic_channel_a);
+    if (self->uses_tc) {
+        counter_stop_tc(self);
+    } else {
+        set_eic_handler(self->eic_channel_a, EIC_HANDLER_NO_INTERRUPT);
+        turn_off_eic_channel(self->eic_channel_a);
+    }
 
 
     reset_pin_number(self->pin_a);
@@ -63,16 +194,26 @@ void common_hal_countio_counter_deinit(countio_counter_obj_t* self) {
 }
 
 mp_int_t common_hal_countio_counter_get_count(countio_counter_obj_t* self) {
+    if (self->uses_tc) {
+        uint16_t value = counter_read_tc(self);
+        return self->count + value;
+    }
     return self->count;
 }
 
 void common_hal_countio_counter_set_count(countio_counter_obj_t* self,
         mp_int_t new_count) {
+    if (self->uses_tc) {
+        // Keep the TC free-running and offset the base instead.
+        uint16_t value = counter_read_tc(self);
+        self->count = new_count - value;
+        return;
+    }
     self->count = new_count;
 }
 
 void common_hal_countio_counter_reset(countio_counter_obj_t* self){
-   self->count = 0;
+    common_hal_countio_counter_set_count(self, 0);
 }
 
 void counter_interrupt_handler(uint8_t channel) {
@@ -81,3 +222,15 @@ void counter_interrupt_handler(uint8_t channel) {
     self->count += 1;
 
 }
+
+void counter_timer_interrupt_handler(uint8_t index) {
+    countio_counter_obj_t* self = active_counters[index];
+    Tc *tc = tc_insts[index];
+    if (!tc->COUNT16.INTFLAG.bit.OVF) {
+        return;
+    }
+    tc->COUNT16.INTFLAG.reg = TC_INTFLAG_OVF;
+    if (self != NULL) {
+        self->count += 0x10000;
+    }
+}
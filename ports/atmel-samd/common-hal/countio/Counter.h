@@ -10,10 +10,17 @@ typedef struct {
     mp_obj_base_t base;
     uint8_t pin_a;
     uint8_t eic_channel_a:4;
-    mp_int_t count;
+    // When a TC and an event channel are free, edges are routed from the EIC
+    // through the event system to the TC and counted in hardware. Otherwise
+    // each edge raises an EIC interrupt that increments count.
+    bool uses_tc;
+    uint8_t tc_index;
+    uint8_t event_channel;
+    volatile mp_int_t count;
 } countio_counter_obj_t;
 
 
 void counter_interrupt_handler(uint8_t channel);
+void counter_timer_interrupt_handler(uint8_t index);
 
 #endif // MICROPY_INCLUDED_ATMEL_SAMD_COMMON_HAL_COUNTIO_COUNT_H
@@ -33,6 +33,25 @@
 #include "shared-bindings/digitalio/DigitalInOut.h"
 #include "shared-bindings/microcontroller/__init__.h"
 
+#if CIRCUITPY_DISPLAYIO_PARALLELBUS_DMA
+#include "audio_dma.h"
+#include "samd/dma.h"
+#include "samd/events.h"
+#include "samd/timers.h"
+
+// Pixels are streamed by a DMA channel paced by a TC. Every TC period the
+// overflow triggers a byte write to the data port, and the channel's beat
+// event pulls WR low through a PORT event input. The TC's compare match then
+// raises WR through a second input, latching the byte. After the last byte no
+// beat lowers WR again, so stopping the TC late does no harm.
+// Counted in GCLK0 cycles: at 120MHz a byte takes 200ns, and the DMA has 150ns
+// from the trigger to settle the byte before WR rises.
+#define PARALLELBUS_DMA_PERIOD (24)
+#define PARALLELBUS_DMA_COMPARE (18)
+// Shorter sends aren't worth setting the DMA up for.
+#define PARALLELBUS_DMA_MIN_LENGTH (32)
+#endif
+
 void common_hal_displayio_parallelbus_construct(displayio_parallelbus_obj_t* self,
     const mcu_pin_obj_t* data0, const mcu_pin_obj_t* command, const mcu_pin_obj_t* chip_select,
     const mcu_pin_obj_t* write, const mcu_pin_obj_t* read, const mcu_pin_obj_t* reset) {
@@ -76,6 +95,9 @@ void common_hal_displayio_parallelbus_construct(displayio_parallelbus_obj_t* sel
     self->data0_pin = data_pin;
     self->write_group = &PORT->Group[write->number / 32];
     self->write_mask = 1 << (write->number % 32);
+    #if CIRCUITPY_DISPLAYIO_PARALLELBUS_DMA
+    self->dma_channel = AUDIO_DMA_CHANNEL_COUNT;
+    #endif
 
     self->reset.base.type = &mp_type_NoneType;
     if (reset != NULL) {
@@ -96,6 +118,9 @@ void common_hal_displayio_parallelbus_construct(displayio_parallelbus_obj_t* sel
 }
 
 void common_hal_displayio_parallelbus_deinit(displayio_parallelbus_obj_t* self) {
+    #if CIRCUITPY_DISPLAYIO_PARALLELBUS_DMA
+    common_hal_displayio_parallelbus_wait_for_send(MP_OBJ_FROM_PTR(self));
+    #endif
     for (uint8_t i = 0; i < 8; i++) {
         reset_pin_number(self->data0_pin + i);
     }
@@ -146,3 +171,109 @@ void common_hal_displayio_parallelbus_end_transaction(mp_obj_t obj) {
     displayio_parallelbus_obj_t* self = MP_OBJ_TO_PTR(obj);
     common_hal_digitalio_digitalinout_set_value(&self->chip_select, true);
 }
+
+#if CIRCUITPY_DISPLAYIO_PARALLELBUS_DMA
+// Returns false, having claimed nothing, when there's no free TC, DMA channel
+// or pair of event channels.
+STATIC bool start_dma(displayio_parallelbus_obj_t* self, uint8_t *data, uint32_t data_length) {
+    uint8_t timer_index = find_free_timer();
+    if (timer_index == 0xff) {
+        return false;
+    }
+    turn_on_event_system();
+    // A channel only stops looking free once it has a generator.
+    uint8_t low_channel = find_async_event_channel();
+    if (low_channel >= EVSYS_CHANNELS) {
+        return false;
+    }
+    uint8_t dma_channel = audio_dma_allocate_channel();
+    if (dma_channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        return false;
+    }
+    init_async_event_channel(low_channel, EVSYS_ID_GEN_DMAC_CH_0 + dma_channel);
+    uint8_t high_channel = find_async_event_channel();
+    if (high_channel >= EVSYS_CHANNELS) {
+        disable_event_channel(low_channel);
+        audio_dma_free_channel(dma_channel);
+        return false;
+    }
+    init_async_event_channel(high_channel, EVSYS_ID_GEN_TC0_MC_0 + 3 * timer_index);
+    connect_event_user_to_channel(EVSYS_ID_USER_PORT_EV_0, low_channel);
+    connect_event_user_to_channel(EVSYS_ID_USER_PORT_EV_1, high_channel);
+    uint8_t write_pin = self->write.pin->number % 32;
+    self->write_group->EVCTRL.reg =
+        PORT_EVCTRL_PID0(write_pin) | PORT_EVCTRL_EVACT0(PORT_EVCTRL_EVACT0_CLR_Val) | PORT_EVCTRL_PORTEI0 |
+        PORT_EVCTRL_PID1(write_pin) | PORT_EVCTRL_EVACT1(PORT_EVCTRL_EVACT1_SET_Val) | PORT_EVCTRL_PORTEI1;
+
+    Tc *tc = tc_insts[timer_index];
+    turn_on_clocks(true, timer_index, 0);
+    tc_set_enable(tc, false);
+    tc_reset(tc);
+    tc->COUNT8.EVCTRL.reg = TC_EVCTRL_MCEO0;
+    tc->COUNT8.CTRLA.reg = TC_CTRLA_MODE_COUNT8 |
+                           TC_CTRLA_PRESCALER_DIV1;
+    tc->COUNT8.WAVE.reg = TC_WAVE_WAVEGEN_NPWM;
+    tc->COUNT8.PER.reg = PARALLELBUS_DMA_PERIOD - 1;
+    tc->COUNT8.CC[0].reg = PARALLELBUS_DMA_COMPARE;
+    tc_wait_for_sync(tc);
+
+    DmacDescriptor* descriptor = dma_descriptor(dma_channel);
+    descriptor->BTCTRL.reg = DMAC_BTCTRL_VALID |
+                             DMAC_BTCTRL_BLOCKACT_NOACT |
+                             DMAC_BTCTRL_EVOSEL_BEAT |
+                             DMAC_BTCTRL_SRCINC |
+                             DMAC_BTCTRL_BEATSIZE_BYTE;
+    descriptor->BTCNT.reg = data_length;
+    descriptor->SRCADDR.reg = (uint32_t) data + data_length;
+    descriptor->DSTADDR.reg = (uint32_t) self->bus;
+    descriptor->DESCADDR.reg = 0;
+    dma_configure(dma_channel, TC0_DMAC_ID_OVF + 3 * timer_index, true);
+
+    self->dma_channel = dma_channel;
+    self->tc_index = timer_index;
+    self->event_channels[0] = low_channel;
+    self->event_channels[1] = high_channel;
+
+    audio_dma_enable_channel(dma_channel);
+    tc_set_enable(tc, true);
+    return true;
+}
+
+void common_hal_displayio_parallelbus_send_async(mp_obj_t obj, uint8_t *data, uint32_t data_length) {
+    displayio_parallelbus_obj_t* self = MP_OBJ_TO_PTR(obj);
+    common_hal_displayio_parallelbus_wait_for_send(obj);
+    if (data_length >= PARALLELBUS_DMA_MIN_LENGTH && data_length <= 0xffff) {
+        common_hal_digitalio_digitalinout_set_value(&self->command, true);
+        if (start_dma(self, data, data_length)) {
+            return;
+        }
+    }
+    common_hal_displayio_parallelbus_send(obj, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED, data, data_length);
+}
+
+void common_hal_displayio_parallelbus_wait_for_send(mp_obj_t obj) {
+    displayio_parallelbus_obj_t* self = MP_OBJ_TO_PTR(obj);
+    if (self->dma_channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        return;
+    }
+    while ((dma_transfer_status(self->dma_channel) & (DMAC_CHINTFLAG_TCMPL | DMAC_CHINTFLAG_TERR)) == 0) {
+    }
+    // The last beat has lowered WR, so the next compare match latches the last byte.
+    Tc *tc = tc_insts[self->tc_index];
+    tc->COUNT8.INTFLAG.reg = TC_INTFLAG_MC0;
+    while (!tc->COUNT8.INTFLAG.bit.MC0) {
+    }
+    tc_set_enable(tc, false);
+    tc_reset(tc);
+
+    self->write_group->EVCTRL.reg = 0;
+    // WR idles high, whether or not the event raising it has arrived yet.
+    self->write_group->OUTSET.reg = self->write_mask;
+    disable_event_user(EVSYS_ID_USER_PORT_EV_0);
+    disable_event_user(EVSYS_ID_USER_PORT_EV_1);
+    disable_event_channel(self->event_channels[0]);
+    disable_event_channel(self->event_channels[1]);
+    audio_dma_free_channel(self->dma_channel);
+    self->dma_channel = AUDIO_DMA_CHANNEL_COUNT;
+}
+#endif
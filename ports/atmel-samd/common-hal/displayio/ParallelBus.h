@@ -40,6 +40,13 @@ typedef struct {
     uint8_t data0_pin;
     PortGroup* write_group;
     uint32_t write_mask;
+    #if CIRCUITPY_DISPLAYIO_PARALLELBUS_DMA
+    // What a send running in the background holds. dma_channel is
+    // AUDIO_DMA_CHANNEL_COUNT when there is none.
+    uint8_t dma_channel;
+    uint8_t tc_index;
+    uint8_t event_channels[2];
+    #endif
 } displayio_parallelbus_obj_t;
 
 #endif // MICROPY_INCLUDED_ATMEL_SAMD_COMMON_HAL_DISPLAYIO_PARALLELBUS_H
@@ -35,6 +35,15 @@
 #include "hal/include/hal_gpio.h"
 #include "peripherals/samd/sercom.h"
 
+// States of a register map transfer.
+#define REGISTER_STATE_IDLE (0)
+// The master is writing and its next byte sets the register pointer.
+#define REGISTER_STATE_POINTER (1)
+// The master is writing register values.
+#define REGISTER_STATE_WRITE (2)
+// The master is reading register values.
+#define REGISTER_STATE_READ (3)
+
 void common_hal_i2cslave_i2c_slave_construct(i2cslave_i2c_slave_obj_t *self,
         const mcu_pin_obj_t *scl, const mcu_pin_obj_t *sda,
         uint8_t *addresses, unsigned int num_addresses, bool smbus) {
@@ -45,6 +54,10 @@ void common_hal_i2cslave_i2c_slave_construct(i2cslave_i2c_slave_obj_t *self,
         mp_raise_ValueError(translate("Invalid pins"));
     }
     self->sercom = sercom;
+    self->sercom_index = sercom_index;
+    self->registers = mp_const_none;
+    self->register_buf = NULL;
+    self->register_len = 0;
 
     gpio_set_pin_function(sda->number, GPIO_PIN_FUNCTION_OFF);
     gpio_set_pin_function(scl->number, GPIO_PIN_FUNCTION_OFF);
@@ -103,6 +116,7 @@ void common_hal_i2cslave_i2c_slave_deinit(i2cslave_i2c_slave_obj_t *self) {
         return;
     }
 
+    common_hal_i2cslave_i2c_slave_set_registers(self, mp_const_none);
     self->sercom->I2CS.CTRLA.bit.ENABLE = 0;
 
     reset_pin_number(self->sda_pin);
@@ -250,3 +264,164 @@ void common_hal_i2cslave_i2c_slave_close(i2cslave_i2c_slave_obj_t *self) {
         mp_raise_OSError(MP_EIO);
     }
 }
+
+// The register map is served from a background task rather than the SERCOM
+// interrupt, whose vector belongs to the ASF4 USART driver. The slave holds
+// SCL low until each address match and byte is handled, so a master simply
+// waits for the next pass; Python never sees the individual transfers.
+
+STATIC bool is_own_address(i2cslave_i2c_slave_obj_t *self, uint8_t address) {
+    for (unsigned int i = 0; i < self->num_addresses; i++) {
+        if (address == self->addresses[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Called at a stop or repeated start: the registers the transfer wrote
+// become visible through `written`.
+STATIC void register_transfer_done(i2cslave_i2c_slave_obj_t *self) {
+    if (self->pending_start < self->pending_end) {
+        if (self->written_start >= self->written_end) {
+            self->written_start = self->pending_start;
+            self->written_end = self->pending_end;
+        } else {
+            self->written_start = MIN(self->written_start, self->pending_start);
+            self->written_end = MAX(self->written_end, self->pending_end);
+        }
+    }
+    self->pending_start = 0;
+    self->pending_end = 0;
+    self->register_state = REGISTER_STATE_IDLE;
+}
+
+STATIC void register_received(i2cslave_i2c_slave_obj_t *self, uint8_t data) {
+    if (self->register_state == REGISTER_STATE_POINTER) {
+        self->register_pointer = data;
+        self->register_state = REGISTER_STATE_WRITE;
+        return;
+    }
+    if (self->register_state != REGISTER_STATE_WRITE || self->register_pointer >= self->register_len) {
+        // Writes past the end of the map are acked and dropped.
+        return;
+    }
+    size_t reg = self->register_pointer++;
+    self->register_buf[reg] = data;
+    if (self->pending_start >= self->pending_end) {
+        self->pending_start = reg;
+        self->pending_end = reg + 1;
+    } else {
+        self->pending_start = MIN(self->pending_start, reg);
+        self->pending_end = MAX(self->pending_end, reg + 1);
+    }
+}
+
+STATIC uint8_t register_to_send(i2cslave_i2c_slave_obj_t *self) {
+    if (self->register_pointer >= self->register_len) {
+        return 0xff;
+    }
+    return self->register_buf[self->register_pointer++];
+}
+
+// Handle what the SERCOM is waiting on. Each step releases SCL, so only a
+// few can be pending at once.
+STATIC void register_map_service(i2cslave_i2c_slave_obj_t *self) {
+    SercomI2cs *i2cs = &self->sercom->I2CS;
+    for (int i = 0; i < 4; i++) {
+        uint8_t flags = i2cs->INTFLAG.reg;
+        if (flags & SERCOM_I2CS_INTFLAG_ERROR) {
+            i2cs->INTFLAG.reg = SERCOM_I2CS_INTFLAG_ERROR;
+            self->pending_start = 0;
+            self->pending_end = 0;
+            self->register_state = REGISTER_STATE_IDLE;
+            continue;
+        }
+        if (flags & SERCOM_I2CS_INTFLAG_PREC) {
+            i2cs->INTFLAG.reg = SERCOM_I2CS_INTFLAG_PREC;
+            register_transfer_done(self);
+            continue;
+        }
+        if (flags & SERCOM_I2CS_INTFLAG_AMATCH) {
+            register_transfer_done(self);
+            bool ours = is_own_address(self, i2cs->DATA.reg >> 1);
+            if (ours) {
+                self->register_state = i2cs->STATUS.bit.DIR ? REGISTER_STATE_READ : REGISTER_STATE_POINTER;
+                self->writing = false;
+            }
+            common_hal_i2cslave_i2c_slave_ack(self, ours);
+            continue;
+        }
+        if (flags & SERCOM_I2CS_INTFLAG_DRDY) {
+            if (i2cs->STATUS.bit.DIR) {
+                if (self->writing && i2cs->STATUS.bit.RXNACK) {
+                    // The master nacked the last byte, so it's done reading.
+                    i2cs->CTRLB.bit.CMD = 0x02;
+                    self->register_state = REGISTER_STATE_IDLE;
+                    continue;
+                }
+                self->writing = true;
+                i2cs->DATA.bit.DATA = register_to_send(self);
+            } else {
+                register_received(self, i2cs->DATA.reg);
+                common_hal_i2cslave_i2c_slave_ack(self, true);
+            }
+            continue;
+        }
+        return;
+    }
+}
+
+void i2cslave_background(void) {
+    for (uint8_t i = 0; i < SERCOM_INST_NUM; i++) {
+        mp_obj_t obj = MP_STATE_PORT(i2cslave_register_maps)[i];
+        if (obj != MP_OBJ_NULL) {
+            register_map_service(MP_OBJ_TO_PTR(obj));
+        }
+    }
+}
+
+void i2cslave_reset(void) {
+    for (uint8_t i = 0; i < SERCOM_INST_NUM; i++) {
+        MP_STATE_PORT(i2cslave_register_maps)[i] = MP_OBJ_NULL;
+    }
+}
+
+void common_hal_i2cslave_i2c_slave_set_registers(i2cslave_i2c_slave_obj_t *self, mp_obj_t registers) {
+    // Stop serving the old map before switching buffers.
+    MP_STATE_PORT(i2cslave_register_maps)[self->sercom_index] = MP_OBJ_NULL;
+    self->registers = mp_const_none;
+    self->register_buf = NULL;
+    self->register_len = 0;
+    if (registers == mp_const_none) {
+        return;
+    }
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(registers, &bufinfo, MP_BUFFER_RW);
+    self->registers = registers;
+    self->register_buf = bufinfo.buf;
+    self->register_len = bufinfo.len;
+    self->register_pointer = 0;
+    self->register_state = REGISTER_STATE_IDLE;
+    self->pending_start = 0;
+    self->pending_end = 0;
+    self->written_start = 0;
+    self->written_end = 0;
+    MP_STATE_PORT(i2cslave_register_maps)[self->sercom_index] = MP_OBJ_FROM_PTR(self);
+}
+
+mp_obj_t common_hal_i2cslave_i2c_slave_get_registers(i2cslave_i2c_slave_obj_t *self) {
+    return self->registers;
+}
+
+bool common_hal_i2cslave_i2c_slave_get_written(i2cslave_i2c_slave_obj_t *self, size_t *start, size_t *end) {
+    if (self->written_start >= self->written_end) {
+        return false;
+    }
+    *start = self->written_start;
+    *end = self->written_end;
+    self->written_start = 0;
+    self->written_end = 0;
+    return true;
+}
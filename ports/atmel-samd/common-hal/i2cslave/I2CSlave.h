@@ -37,9 +37,27 @@ typedef struct {
     unsigned int num_addresses;
 
     Sercom *sercom;
+    uint8_t sercom_index;
     uint8_t scl_pin;
     uint8_t sda_pin;
     bool writing;
+
+    // Register map served by i2cslave_background, or mp_const_none.
+    mp_obj_t registers;
+    uint8_t *register_buf;
+    size_t register_len;
+    // Next register to read or write. The first byte a master writes sets it.
+    size_t register_pointer;
+    uint8_t register_state;
+    // Registers written by the transfer in progress, and by the finished
+    // transfers since `written` was last read. Empty when start >= end.
+    size_t pending_start;
+    size_t pending_end;
+    size_t written_start;
+    size_t written_end;
 } i2cslave_i2c_slave_obj_t;
 
+void i2cslave_background(void);
+void i2cslave_reset(void);
+
 #endif // MICROPY_INCLUDED_ATMEL_SAMD_COMMON_HAL_BUSIO_I2C_SLAVE_H
@@ -28,28 +28,93 @@
 
 #include "hal_flash.h"
 
+#include "py/misc.h"
 #include "supervisor/shared/stack.h"
 
 #include <stdint.h>
 #include <string.h>
 
+#define NO_CACHE (0xffffffff)
+
+// Writes are gathered in a copy of one erase unit. It only goes out to the
+// flash when a write moves on to another unit, on flush() and at reset, so
+// a run of small assignments costs one erase.
+STATIC uint8_t nvm_cache[FLASH_ERASE_SIZE] __attribute__((aligned(4)));
+STATIC uint32_t nvm_cache_addr = NO_CACHE;
+
 uint32_t common_hal_nvm_bytearray_get_length(nvm_bytearray_obj_t *self) {
     return self->len;
 }
 
-bool common_hal_nvm_bytearray_set_bytes(nvm_bytearray_obj_t *self,
-        uint32_t start_index, uint8_t* values, uint32_t len) {
+bool nvm_bytearray_flush(void) {
+    if (nvm_cache_addr == NO_CACHE) {
+        return true;
+    }
+    uint8_t *flash = (uint8_t *) nvm_cache_addr;
+    nvm_cache_addr = NO_CACHE;
+
+    // Only rewrite the span that changed.
+    uint32_t start = 0;
+    while (start < FLASH_ERASE_SIZE && nvm_cache[start] == flash[start]) {
+        start++;
+    }
+    if (start == FLASH_ERASE_SIZE) {
+        return true;
+    }
+    uint32_t end = FLASH_ERASE_SIZE;
+    while (nvm_cache[end - 1] == flash[end - 1]) {
+        end--;
+    }
+
     // We don't use features that use any advanced NVMCTRL features so we can fake the descriptor
     // whenever we need it instead of storing it long term.
     struct flash_descriptor desc;
     desc.dev.hw = NVMCTRL;
-    bool status = flash_write(&desc, (uint32_t) self->start_address + start_index, values, len) == ERR_NONE;
+    bool status = flash_write(&desc, (uint32_t) flash + start, nvm_cache + start, end - start) == ERR_NONE;
     assert_heap_ok();
     return status;
 }
 
-// NVM memory is memory mapped so reading it is easy.
+bool common_hal_nvm_bytearray_set_bytes(nvm_bytearray_obj_t *self,
+        uint32_t start_index, uint8_t* values, uint32_t len) {
+    uint32_t address = (uint32_t) self->start_address + start_index;
+    while (len) {
+        uint32_t unit_addr = address & ~(FLASH_ERASE_SIZE - 1);
+        uint32_t offset = address - unit_addr;
+        uint32_t write_len = MIN(len, FLASH_ERASE_SIZE - offset);
+        if (unit_addr != nvm_cache_addr && memcmp(values, (uint8_t *) address, write_len) != 0) {
+            if (!nvm_bytearray_flush()) {
+                return false;
+            }
+            memcpy(nvm_cache, (uint8_t *) unit_addr, FLASH_ERASE_SIZE);
+            nvm_cache_addr = unit_addr;
+        }
+        if (unit_addr == nvm_cache_addr) {
+            memcpy(nvm_cache + offset, values, write_len);
+        }
+        address += write_len;
+        values += write_len;
+        len -= write_len;
+    }
+    return true;
+}
+
+bool common_hal_nvm_bytearray_flush(nvm_bytearray_obj_t *self) {
+    return nvm_bytearray_flush();
+}
+
+// NVM memory is memory mapped so reading it is easy, apart from what's
+// still in the cache.
 void common_hal_nvm_bytearray_get_bytes(nvm_bytearray_obj_t *self,
     uint32_t start_index, uint32_t len, uint8_t* values) {
-    memcpy(values, self->start_address + start_index, len);
+    uint32_t address = (uint32_t) self->start_address + start_index;
+    memcpy(values, (uint8_t *) address, len);
+    if (nvm_cache_addr == NO_CACHE) {
+        return;
+    }
+    uint32_t start = MAX(address, nvm_cache_addr);
+    uint32_t end = MIN(address + len, nvm_cache_addr + FLASH_ERASE_SIZE);
+    if (start < end) {
+        memcpy(values + (start - address), nvm_cache + (start - nvm_cache_addr), end - start);
+    }
 }
@@ -24,6 +24,8 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "genhdr/mpversion.h"
 #include "py/mpconfig.h"
 #include "py/objstr.h"
@@ -73,7 +75,15 @@ bool common_hal_os_urandom(uint8_t* buffer, uint32_t length) {
     rand_sync_init(&random, TRNG);
     rand_sync_enable(&random);
 
-    rand_sync_read_buf8(&random, buffer, length);
+    // Each TRNG result is 32 bits, so use all of them rather than waiting
+    // for a new one per byte.
+    while (length > 0) {
+        uint32_t value = rand_sync_read32(&random);
+        uint32_t n = length < sizeof(value) ? length : sizeof(value);
+        memcpy(buffer, &value, n);
+        buffer += n;
+        length -= n;
+    }
 
     rand_sync_disable(&random);
     rand_sync_deinit(&random);
@@ -40,6 +40,7 @@ typedef struct {
     bool idle_state;
     volatile uint16_t start;
     volatile uint16_t len;
+    volatile uint32_t dropped;
     volatile bool first_edge;
     volatile uint32_t last_overflow;
     volatile uint16_t last_count;
@@ -39,6 +39,11 @@
 #include "supervisor/shared/translate.h"
 #include "timer_handler.h"
 
+#if CIRCUITPY_PULSEOUT_DMA
+#include "audio_dma.h"
+#include "samd/dma.h"
+#endif
+
 // This timer is shared amongst all PulseOut objects under the assumption that
 // the code is single threaded.
 static uint8_t refcount = 0;
@@ -89,10 +94,154 @@ void pulseout_interrupt_handler(uint8_t index) {
     tc->COUNT16.INTFLAG.reg = TC_INTFLAG_MC0;
 }
 
+#if CIRCUITPY_PULSEOUT_DMA
+// The pulses are played by two DMA channels, both paced by the timer running
+// in match frequency mode. At the end of each pulse the timer starts over, one
+// channel gives it the length of the next pulse and the other turns the
+// carrier on or off, so the CPU isn't involved until the busy check finds the
+// pins channel done. MP_STATE_PORT(playing_audio) keeps the sequence alive
+// meanwhile, and audio_dma_reset() ends it.
+static pulseio_pulseout_obj_t *dma_pulseout = NULL;
+
+static void set_wavegen(Tc *tc, bool match_frequency) {
+    tc_set_enable(tc, false);
+    #ifdef SAMD21
+    tc->COUNT16.CTRLA.bit.WAVEGEN = match_frequency ? TC_CTRLA_WAVEGEN_MFRQ_Val : TC_CTRLA_WAVEGEN_NFRQ_Val;
+    #endif
+    #ifdef SAMD51
+    tc->COUNT16.WAVE.reg = match_frequency ? TC_WAVE_WAVEGEN_MFRQ : TC_WAVE_WAVEGEN_NFRQ;
+    #endif
+    tc_set_enable(tc, true);
+    tc->COUNT16.CTRLBSET.reg = TC_CTRLBSET_CMD_STOP;
+}
+
+static void finish_dma_send(pulseio_pulseout_obj_t *self) {
+    Tc* tc = tc_insts[pulseout_tc_index];
+    // The timer goes back to compare mode for sends without DMA.
+    set_wavegen(tc, false);
+    turn_off(self->pincfg);
+    MP_STATE_PORT(playing_audio)[self->pincfg_channel] = NULL;
+    if (self->period_channel < AUDIO_DMA_CHANNEL_COUNT) {
+        audio_dma_free_channel(self->period_channel);
+    }
+    audio_dma_free_channel(self->pincfg_channel);
+    self->period_channel = AUDIO_DMA_CHANNEL_COUNT;
+    self->pincfg_channel = AUDIO_DMA_CHANNEL_COUNT;
+    dma_pulseout = NULL;
+}
+
+static bool dma_send_busy(pulseio_pulseout_obj_t *self) {
+    if (dma_pulseout != self) {
+        return false;
+    }
+    if (MP_STATE_PORT(playing_audio)[self->pincfg_channel] != self) {
+        // audio_dma_reset() already freed the channels.
+        self->period_channel = AUDIO_DMA_CHANNEL_COUNT;
+        self->pincfg_channel = AUDIO_DMA_CHANNEL_COUNT;
+        dma_pulseout = NULL;
+        return false;
+    }
+    uint8_t status = dma_transfer_status(self->pincfg_channel);
+    if ((status & (DMAC_CHINTFLAG_TCMPL | DMAC_CHINTFLAG_TERR)) == 0) {
+        return true;
+    }
+    finish_dma_send(self);
+    return false;
+}
+
+static void wait_for_dma_send(void) {
+    while (dma_pulseout != NULL && dma_send_busy(dma_pulseout)) {
+        // Do other things while we wait. The DMA sends the signal.
+        RUN_BACKGROUND_TASKS;
+    }
+}
+
+static void set_up_channel(uint8_t channel, void *src, uint16_t beats, uint32_t beat_size,
+    volatile void *dst, uint8_t trigger) {
+    DmacDescriptor* descriptor = dma_descriptor(channel);
+    descriptor->BTCTRL.reg = DMAC_BTCTRL_VALID |
+                             DMAC_BTCTRL_BLOCKACT_NOACT |
+                             DMAC_BTCTRL_SRCINC |
+                             beat_size;
+    descriptor->BTCNT.reg = beats;
+    descriptor->SRCADDR.reg = (uint32_t) src + beats * (beat_size == DMAC_BTCTRL_BEATSIZE_HWORD ? 2 : 1);
+    descriptor->DSTADDR.reg = (uint32_t) dst;
+    descriptor->DESCADDR.reg = 0;
+    dma_configure(channel, trigger, true);
+}
+
+// Returns false if there aren't enough DMA channels, so the caller can send
+// the pulses from the timer interrupt instead.
+static bool start_dma_send(pulseio_pulseout_obj_t *self, uint16_t *pulses, uint16_t length) {
+    uint8_t pincfg_channel = audio_dma_allocate_channel();
+    if (pincfg_channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        return false;
+    }
+    uint8_t period_channel = AUDIO_DMA_CHANNEL_COUNT;
+    if (length > 1) {
+        period_channel = audio_dma_allocate_channel();
+        if (period_channel >= AUDIO_DMA_CHANNEL_COUNT) {
+            audio_dma_free_channel(pincfg_channel);
+            return false;
+        }
+    }
+
+    // The period of pulse i + 1 and the pin configuration after pulse i are
+    // both written when pulse i ends.
+    size_t size = (length - 1) * sizeof(uint16_t) + length;
+    if (self->sequence_size < size) {
+        self->sequence = m_renew(uint8_t, self->sequence, self->sequence_size, size);
+        self->sequence_size = size;
+    }
+    uint16_t *periods = (uint16_t *) self->sequence;
+    uint8_t *pincfgs = self->sequence + (length - 1) * sizeof(uint16_t);
+    for (uint16_t i = 0; i < length; i++) {
+        if (i > 0) {
+            periods[i - 1] = MAX(pulses[i] * 3 / 4, 1) - 1;
+        }
+        pincfgs[i] = (i + 1 < length && (i + 1) % 2 == 0) ? PORT_PINCFG_PMUXEN : PORT_PINCFG_RESETVALUE;
+    }
+
+    Tc* tc = tc_insts[pulseout_tc_index];
+    set_wavegen(tc, true);
+    tc->COUNT16.CC[0].reg = MAX(pulses[0] * 3 / 4, 1) - 1;
+
+    #ifdef SAMD21
+    uint8_t trigger = TC3_DMAC_ID_OVF + 3 * pulseout_tc_index;
+    #endif
+    #ifdef SAMD51
+    uint8_t trigger = TC0_DMAC_ID_OVF + 3 * pulseout_tc_index;
+    #endif
+    if (period_channel < AUDIO_DMA_CHANNEL_COUNT) {
+        set_up_channel(period_channel, periods, length - 1, DMAC_BTCTRL_BEATSIZE_HWORD,
+            &tc->COUNT16.CC[0].reg, trigger);
+    }
+    set_up_channel(pincfg_channel, pincfgs, length, DMAC_BTCTRL_BEATSIZE_BYTE,
+        &self->pincfg->reg, trigger);
+
+    self->period_channel = period_channel;
+    self->pincfg_channel = pincfg_channel;
+    MP_STATE_PORT(playing_audio)[pincfg_channel] = self;
+    dma_pulseout = self;
+
+    if (period_channel < AUDIO_DMA_CHANNEL_COUNT) {
+        audio_dma_enable_channel(period_channel);
+    }
+    audio_dma_enable_channel(pincfg_channel);
+    turn_on(self->pincfg);
+    tc->COUNT16.CTRLBSET.reg = TC_CTRLBSET_CMD_RETRIGGER;
+    return true;
+}
+#endif
+
 void pulseout_reset() {
     refcount = 0;
     pulseout_tc_index = 0xff;
     active_pincfg = NULL;
+    #if CIRCUITPY_PULSEOUT_DMA
+    // audio_dma_reset() has stopped the channels.
+    dma_pulseout = NULL;
+    #endif
 }
 
 void common_hal_pulseio_pulseout_construct(pulseio_pulseout_obj_t* self,
@@ -152,6 +301,13 @@ void common_hal_pulseio_pulseout_construct(pulseio_pulseout_obj_t* self,
 
     // Turn off the pinmux which should connect the port output.
     turn_off(self->pincfg);
+
+    #if CIRCUITPY_PULSEOUT_DMA
+    self->sequence = NULL;
+    self->sequence_size = 0;
+    self->period_channel = AUDIO_DMA_CHANNEL_COUNT;
+    self->pincfg_channel = AUDIO_DMA_CHANNEL_COUNT;
+    #endif
 }
 
 bool common_hal_pulseio_pulseout_deinited(pulseio_pulseout_obj_t* self) {
@@ -162,6 +318,14 @@ void common_hal_pulseio_pulseout_deinit(pulseio_pulseout_obj_t* self) {
     if (common_hal_pulseio_pulseout_deinited(self)) {
         return;
     }
+    #if CIRCUITPY_PULSEOUT_DMA
+    if (dma_send_busy(self)) {
+        finish_dma_send(self);
+    }
+    m_del(uint8_t, self->sequence, self->sequence_size);
+    self->sequence = NULL;
+    self->sequence_size = 0;
+    #endif
     PortGroup *const port_base = &PORT->Group[GPIO_PORT(self->pin)];
     port_base->DIRCLR.reg = 1 << (self->pin % 32);
 
@@ -176,6 +340,15 @@ void common_hal_pulseio_pulseout_deinit(pulseio_pulseout_obj_t* self) {
 }
 
 void common_hal_pulseio_pulseout_send(pulseio_pulseout_obj_t* self, uint16_t* pulses, uint16_t length) {
+    #if CIRCUITPY_PULSEOUT_DMA
+    wait_for_dma_send();
+    if (length == 0) {
+        return;
+    }
+    if (start_dma_send(self, pulses, length)) {
+        return;
+    }
+    #endif
     if (active_pincfg != NULL) {
         mp_raise_RuntimeError(translate("Another send is already active"));
     }
@@ -206,3 +379,12 @@ void common_hal_pulseio_pulseout_send(pulseio_pulseout_obj_t* self, uint16_t* pu
     tc_disable_interrupts(pulseout_tc_index);
     active_pincfg = NULL;
 }
+
+bool common_hal_pulseio_pulseout_get_busy(pulseio_pulseout_obj_t* self) {
+    #if CIRCUITPY_PULSEOUT_DMA
+    return dma_send_busy(self);
+    #else
+    // send waits until the pulses are out.
+    return false;
+    #endif
+}
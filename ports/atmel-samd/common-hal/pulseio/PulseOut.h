@@ -35,6 +35,13 @@ typedef struct {
     mp_obj_base_t base;
     __IO PORT_PINCFG_Type *pincfg;
     uint8_t pin;
+    #if CIRCUITPY_PULSEOUT_DMA
+    // Timer periods and then pin configurations for the DMA channels.
+    uint8_t *sequence;
+    size_t sequence_size;
+    uint8_t period_channel;
+    uint8_t pincfg_channel;
+    #endif
 } pulseio_pulseout_obj_t;
 
 void pulseout_reset(void);
@@ -44,9 +44,94 @@
 
 #include "adafruit_ptc.h"
 
+// filtered and baseline are kept as reading * 2**TOUCHIN_FILTER_SHIFT.
+#define TOUCHIN_FILTER_SHIFT (4)
+// Each reading moves filtered 1/4 of the way to it.
+#define TOUCHIN_FILTER_WEIGHT_SHIFT (2)
+// While untouched the baseline follows filtered, quickly down and slowly up,
+// so drift is absorbed but a slow approach doesn't become the new baseline.
+#define TOUCHIN_BASELINE_DOWN_SHIFT (2)
+#define TOUCHIN_BASELINE_UP_SHIFT (6)
+
 bool touch_enabled = false;
 
+// The pads are measured one after another by touchin_background, so reading
+// a TouchIn only looks at the last results. Kept in MP_STATE_PORT(touchin_slots)
+// so the objects stay alive while they're scanned.
+STATIC uint8_t scan_slot;
+// Slot of the pad being converted, or TOUCHIN_SCAN_SLOTS when the PTC is idle.
+STATIC uint8_t converting_slot = TOUCHIN_SCAN_SLOTS;
+// Set while get_raw_reading has the PTC, since it runs background tasks.
+STATIC bool reading_directly;
+
+STATIC touchio_touchin_obj_t *slot_touchin(uint8_t slot) {
+    mp_obj_t obj = MP_STATE_PORT(touchin_slots)[slot];
+    return obj == MP_OBJ_NULL ? NULL : MP_OBJ_TO_PTR(obj);
+}
+
+STATIC uint16_t touchin_threshold(touchio_touchin_obj_t *self) {
+    int32_t threshold = (int32_t)(self->baseline >> TOUCHIN_FILTER_SHIFT) + self->margin;
+    return MIN(MAX(threshold, 0), 0xffff);
+}
+
+STATIC void add_reading(touchio_touchin_obj_t *self, uint16_t reading) {
+    self->raw = reading;
+    uint32_t scaled = (uint32_t)reading << TOUCHIN_FILTER_SHIFT;
+    if (scaled > self->filtered) {
+        self->filtered += (scaled - self->filtered) >> TOUCHIN_FILTER_WEIGHT_SHIFT;
+    } else {
+        self->filtered -= (self->filtered - scaled) >> TOUCHIN_FILTER_WEIGHT_SHIFT;
+    }
+    if ((self->filtered >> TOUCHIN_FILTER_SHIFT) > touchin_threshold(self)) {
+        // Touched, so hold the baseline where it is.
+        return;
+    }
+    if (self->filtered > self->baseline) {
+        self->baseline += (self->filtered - self->baseline) >> TOUCHIN_BASELINE_UP_SHIFT;
+    } else {
+        self->baseline -= (self->baseline - self->filtered) >> TOUCHIN_BASELINE_DOWN_SHIFT;
+    }
+}
+
+// Store the result of the conversion in progress, if any, once it's done.
+// Returns false if it isn't done yet.
+STATIC bool finish_conversion(void) {
+    if (converting_slot >= TOUCHIN_SCAN_SLOTS) {
+        return true;
+    }
+    if (!adafruit_ptc_is_conversion_finished(PTC)) {
+        return false;
+    }
+    uint16_t reading = adafruit_ptc_get_conversion_result(PTC);
+    touchio_touchin_obj_t *self = slot_touchin(converting_slot);
+    // The pad may have been deinited while it was converted.
+    if (self != NULL) {
+        add_reading(self, reading);
+    }
+    converting_slot = TOUCHIN_SCAN_SLOTS;
+    return true;
+}
+
+void touchin_background(void) {
+    if (reading_directly || !finish_conversion()) {
+        return;
+    }
+    for (uint8_t i = 0; i < TOUCHIN_SCAN_SLOTS; i++) {
+        scan_slot = (scan_slot + 1) % TOUCHIN_SCAN_SLOTS;
+        touchio_touchin_obj_t *self = slot_touchin(scan_slot);
+        if (self != NULL) {
+            adafruit_ptc_start_conversion(PTC, &self->config);
+            converting_slot = scan_slot;
+            return;
+        }
+    }
+}
+
 static uint16_t get_raw_reading(touchio_touchin_obj_t *self) {
+    // Let the background scan finish with the PTC first.
+    while (!finish_conversion()) {
+    }
+    reading_directly = true;
     adafruit_ptc_start_conversion(PTC, &self->config);
 
     while (!adafruit_ptc_is_conversion_finished(PTC)) {
@@ -54,6 +139,7 @@ static uint16_t get_raw_reading(touchio_touchin_obj_t *self) {
         RUN_BACKGROUND_TASKS;
     }
 
+    reading_directly = false;
     return adafruit_ptc_get_conversion_result(PTC);
 }
 
@@ -92,7 +178,23 @@ void common_hal_touchio_touchin_construct(touchio_touchin_obj_t* self,
     // For simple finger touch, the values may vary as much as a factor of two,
     // but for touches using fruit or other objects, the difference is much less.
 
-    self->threshold = get_raw_reading(self) + 100;
+    uint16_t reading = get_raw_reading(self);
+    self->raw = reading;
+    self->filtered = (uint32_t)reading << TOUCHIN_FILTER_SHIFT;
+    self->baseline = self->filtered;
+    self->margin = 100;
+
+    uint8_t slot = 0;
+    while (slot < TOUCHIN_SCAN_SLOTS && MP_STATE_PORT(touchin_slots)[slot] != MP_OBJ_NULL) {
+        slot++;
+    }
+    if (slot == TOUCHIN_SCAN_SLOTS) {
+        reset_pin_number(self->config.pin);
+        self->config.pin = NO_PIN;
+        mp_raise_RuntimeError(translate("Too many touch pins"));
+    }
+    self->slot = slot;
+    MP_STATE_PORT(touchin_slots)[slot] = MP_OBJ_FROM_PTR(self);
 }
 
 bool common_hal_touchio_touchin_deinited(touchio_touchin_obj_t* self) {
@@ -106,11 +208,19 @@ void common_hal_touchio_touchin_deinit(touchio_touchin_obj_t* self) {
     }
     // We leave the clocks running because they may be in use by others.
 
+    MP_STATE_PORT(touchin_slots)[self->slot] = MP_OBJ_NULL;
     reset_pin_number(self->config.pin);
     self->config.pin = NO_PIN;
 }
 
 void touchin_reset() {
+    MP_STATIC_ASSERT(MP_ARRAY_SIZE(MP_STATE_PORT(touchin_slots)) == TOUCHIN_SCAN_SLOTS);
+    for (uint8_t i = 0; i < TOUCHIN_SCAN_SLOTS; i++) {
+        MP_STATE_PORT(touchin_slots)[i] = MP_OBJ_NULL;
+    }
+    converting_slot = TOUCHIN_SCAN_SLOTS;
+    reading_directly = false;
+
     Ptc* ptc = ((Ptc *) PTC);
     if (ptc->CTRLA.bit.ENABLE == 1) {
         ptc->CTRLA.bit.ENABLE = 0;
@@ -122,20 +232,19 @@ void touchin_reset() {
 }
 
 bool common_hal_touchio_touchin_get_value(touchio_touchin_obj_t *self) {
-    uint16_t reading = get_raw_reading(self);
-    return reading > self->threshold;
+    return (self->filtered >> TOUCHIN_FILTER_SHIFT) > touchin_threshold(self);
 }
 
 uint16_t common_hal_touchio_touchin_get_raw_value(touchio_touchin_obj_t *self) {
-    return get_raw_reading(self);
+    return self->raw;
 }
 
 uint16_t common_hal_touchio_touchin_get_threshold(touchio_touchin_obj_t *self) {
-    return self->threshold;
+    return touchin_threshold(self);
 }
 
 void common_hal_touchio_touchin_set_threshold(touchio_touchin_obj_t *self, uint16_t new_threshold) {
-    self->threshold = new_threshold;
+    self->margin = (int32_t)new_threshold - (int32_t)(self->baseline >> TOUCHIN_FILTER_SHIFT);
 }
 
 #endif // SAMD21
@@ -37,13 +37,24 @@
 
 #include "py/obj.h"
 
+// Most pads scanned in the background at once.
+#define TOUCHIN_SCAN_SLOTS (16)
+
 typedef struct {
     mp_obj_base_t base;
     struct adafruit_ptc_config config;
-    uint16_t threshold;
+    // Readings kept by the background scan. filtered and baseline are scaled
+    // up by 16 so small steps aren't lost.
+    uint32_t filtered;
+    uint32_t baseline;
+    // threshold is margin above the tracked baseline.
+    int32_t margin;
+    uint16_t raw;
+    uint8_t slot;
 } touchio_touchin_obj_t;
 
 void touchin_reset(void);
+void touchin_background(void);
 
 #endif // SAMD21
 
@@ -83,6 +83,19 @@
 
 #endif // SAMD51
 
+// busio.SPI can run a transfer in the background with DMA channels from the
+// audio DMA allocator.
+#define CIRCUITPY_BUSIO_SPI_BACKGROUND              (CIRCUITPY_AUDIOIO || CIRCUITPY_AUDIOBUSIO)
+// busio.UART receives into its ring buffer with a DMA channel from the same allocator.
+#define CIRCUITPY_BUSIO_UART_RX_DMA                 (CIRCUITPY_AUDIOIO || CIRCUITPY_AUDIOBUSIO)
+// displayio.ParallelBus streams pixels with a channel from it too. The WR strobes
+// come through the PORT event inputs, which only the SAMD51 has.
+#ifdef SAMD51
+#define CIRCUITPY_DISPLAYIO_PARALLELBUS_DMA         (CIRCUITPY_AUDIOIO || CIRCUITPY_AUDIOBUSIO)
+#endif
+// pulseio.PulseOut plays its pulses with two channels from it, paced by its timer.
+#define CIRCUITPY_PULSEOUT_DMA                      (CIRCUITPY_AUDIOIO || CIRCUITPY_AUDIOBUSIO)
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // This also includes mpconfigboard.h.
@@ -222,8 +235,24 @@
 
 #include "peripherals/samd/dma.h"
 
+// The TouchIn objects being scanned in the background.
+#if CIRCUITPY_TOUCHIO_USE_NATIVE && defined(SAMD21)
+#define TOUCHIO_ROOT_POINTERS mp_obj_t touchin_slots[16];
+#else
+#define TOUCHIO_ROOT_POINTERS
+#endif
+
+// The I2CSlave objects serving a register map, by SERCOM.
+#if CIRCUITPY_I2CSLAVE
+#define I2CSLAVE_ROOT_POINTERS mp_obj_t i2cslave_register_maps[SERCOM_INST_NUM];
+#else
+#define I2CSLAVE_ROOT_POINTERS
+#endif
+
 #define MICROPY_PORT_ROOT_POINTERS \
     CIRCUITPY_COMMON_ROOT_POINTERS \
+    TOUCHIO_ROOT_POINTERS \
+    I2CSLAVE_ROOT_POINTERS \
     mp_obj_t playing_audio[AUDIO_DMA_CHANNEL_COUNT];
 
 #endif  // __INCLUDED_MPCONFIGPORT_H
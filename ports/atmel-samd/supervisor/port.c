@@ -53,6 +53,8 @@
 #include "common-hal/audiobusio/I2SOut.h"
 #include "common-hal/audioio/AudioOut.h"
 #include "common-hal/busio/SPI.h"
+#include "common-hal/i2cslave/I2CSlave.h"
+#include "common-hal/nvm/ByteArray.h"
 #include "common-hal/microcontroller/Pin.h"
 #include "common-hal/pulseio/PulseIn.h"
 #include "common-hal/pulseio/PulseOut.h"
@@ -295,8 +297,15 @@ safe_mode_t port_init(void) {
 }
 
 void reset_port(void) {
+#if CIRCUITPY_NVM
+    nvm_bytearray_flush();
+#endif
     reset_sercoms();
 
+#if CIRCUITPY_AUDIOBUSIO
+    // Stop streaming before audio DMA forgets which channels are allocated.
+    pdmin_stream_reset();
+#endif
 #if CIRCUITPY_AUDIOIO
     audio_dma_reset();
     audioout_reset();
@@ -310,6 +319,9 @@ void reset_port(void) {
     touchin_reset();
 #endif
     eic_reset();
+#if CIRCUITPY_I2CSLAVE
+    i2cslave_reset();
+#endif
 #if CIRCUITPY_PULSEIO
     pulsein_reset();
     pulseout_reset();
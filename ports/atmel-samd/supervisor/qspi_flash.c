@@ -39,7 +39,24 @@
 #include "atmel_start_pins.h"
 #include "hal_gpio.h"
 
+// True while the read started by spi_flash_memory_map is left going.
+static bool memory_mapped = false;
+
+// Ends the read left going by spi_flash_memory_map so another command can be sent.
+static void end_memory_map(void) {
+    if (!memory_mapped) {
+        return;
+    }
+    QSPI->CTRLA.reg = QSPI_CTRLA_ENABLE | QSPI_CTRLA_LASTXFER;
+
+    while( !QSPI->INTFLAG.bit.INSTREND );
+
+    QSPI->INTFLAG.reg = QSPI_INTFLAG_INSTREND;
+    memory_mapped = false;
+}
+
 bool spi_flash_command(uint8_t command) {
+    end_memory_map();
     QSPI->INSTRCTRL.bit.INSTR = command;
 
     QSPI->INSTRFRAME.reg = QSPI_INSTRFRAME_WIDTH_SINGLE_BIT_SPI |
@@ -57,6 +74,7 @@ bool spi_flash_command(uint8_t command) {
 }
 
 bool spi_flash_read_command(uint8_t command, uint8_t* response, uint32_t length) {
+    end_memory_map();
     samd_peripherals_disable_and_clear_cache();
 
     QSPI->INSTRCTRL.bit.INSTR = command;
@@ -86,6 +104,7 @@ bool spi_flash_read_command(uint8_t command, uint8_t* response, uint32_t length)
 }
 
 bool spi_flash_write_command(uint8_t command, uint8_t* data, uint32_t length) {
+    end_memory_map();
     samd_peripherals_disable_and_clear_cache();
 
     QSPI->INSTRCTRL.bit.INSTR = command;
@@ -117,6 +136,7 @@ bool spi_flash_write_command(uint8_t command, uint8_t* data, uint32_t length) {
 }
 
 bool spi_flash_sector_command(uint8_t command, uint32_t address) {
+    end_memory_map();
     QSPI->INSTRCTRL.bit.INSTR = command;
     QSPI->INSTRADDR.bit.ADDR = address;
 
@@ -136,6 +156,7 @@ bool spi_flash_sector_command(uint8_t command, uint32_t address) {
 }
 
 bool spi_flash_write_data(uint32_t address, uint8_t* data, uint32_t length) {
+    end_memory_map();
     samd_peripherals_disable_and_clear_cache();
 
     QSPI->INSTRCTRL.bit.INSTR = CMD_PAGE_PROGRAM;
@@ -163,9 +184,8 @@ bool spi_flash_write_data(uint32_t address, uint8_t* data, uint32_t length) {
     return true;
 }
 
-bool spi_flash_read_data(uint32_t address, uint8_t* data, uint32_t length) {
-    samd_peripherals_disable_and_clear_cache();
-
+// Sets up a read of the flash through the QSPI_AHB window.
+static void start_memory_read(void) {
     #ifdef EXTERNAL_FLASH_QSPI_SINGLE
     QSPI->INSTRCTRL.bit.INSTR = CMD_READ_DATA;
     uint32_t mode = QSPI_INSTRFRAME_WIDTH_SINGLE_BIT_SPI;
@@ -194,6 +214,13 @@ bool spi_flash_read_data(uint32_t address, uint8_t* data, uint32_t length) {
                            QSPI_INSTRFRAME_DATAEN |
                            QSPI_INSTRFRAME_DUMMYLEN(8);
     #endif
+}
+
+bool spi_flash_read_data(uint32_t address, uint8_t* data, uint32_t length) {
+    end_memory_map();
+    samd_peripherals_disable_and_clear_cache();
+
+    start_memory_read();
 
     memcpy(data, ((uint8_t *) QSPI_AHB) + address, length);
     // TODO(tannewt): Fix DMA and enable it.
@@ -210,6 +237,16 @@ bool spi_flash_read_data(uint32_t address, uint8_t* data, uint32_t length) {
     return true;
 }
 
+uint8_t* spi_flash_memory_map(uint32_t address) {
+    if (!memory_mapped) {
+        // Drop anything cached from the window before the flash last changed.
+        samd_peripherals_disable_and_clear_cache();
+        start_memory_read();
+        samd_peripherals_enable_cache();
+        memory_mapped = true;
+    }
+    return ((uint8_t *) QSPI_AHB) + address;
+}
 
 void spi_flash_init(void) {
     MCLK->APBCMASK.bit.QSPI_ = true;
@@ -217,6 +254,7 @@ void spi_flash_init(void) {
     MCLK->AHBMASK.bit.QSPI_2X_ = false; // Only true if we are doing DDR.
 
     QSPI->CTRLA.reg = QSPI_CTRLA_SWRST;
+    memory_mapped = false;
     // We don't need to wait because we're running as fast as the CPU.
 
     // Slow, good for debugging with Saleae
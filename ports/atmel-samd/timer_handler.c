@@ -33,6 +33,7 @@
 #include "common-hal/pulseio/PulseOut.h"
 #include "shared-module/_pew/PewPew.h"
 #include "common-hal/frequencyio/FrequencyIn.h"
+#include "common-hal/countio/Counter.h"
 
 extern void _PM_IRQ_HANDLER(void);
 
@@ -70,6 +71,11 @@ void shared_timer_handler(bool is_tc, uint8_t index) {
                 frequencyin_interrupt_handler(index);
             #endif
                 break;
+            case TC_HANDLER_COUNTER:
+            #if CIRCUITPY_COUNTIO
+                counter_timer_interrupt_handler(index);
+            #endif
+                break;
             case TC_HANDLER_RGBMATRIX:
             #if CIRCUITPY_RGBMATRIX
                 _PM_IRQ_HANDLER();
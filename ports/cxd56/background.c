@@ -28,26 +28,27 @@
 
 #include "supervisor/usb.h"
 #include "supervisor/filesystem.h"
+#include "supervisor/shared/background_tasks.h"
 #include "supervisor/shared/stack.h"
 
-static bool running_background_tasks = false;
+STATIC background_task_t usb_task = BACKGROUND_TASK(usb_background, BACKGROUND_TASK_PRIORITY_USB, 1);
+STATIC background_task_t filesystem_task = BACKGROUND_TASK(filesystem_background, BACKGROUND_TASK_PRIORITY_FILESYSTEM, 16);
+
+STATIC bool tasks_registered = false;
+
+STATIC void register_background_tasks(void) {
+    supervisor_background_task_register(&usb_task);
+    supervisor_background_task_register(&filesystem_task);
+    tasks_registered = true;
+}
 
 void background_tasks_reset(void) {
-    running_background_tasks = false;
+    supervisor_background_tasks_reset();
 }
 
 void run_background_tasks(void) {
-    // Don't call ourselves recursively.
-    if (running_background_tasks) {
-        return;
+    if (!tasks_registered) {
+        register_background_tasks();
     }
-
-    assert_heap_ok();
-    running_background_tasks = true;
-
-    usb_background();
-    filesystem_background();
-
-    running_background_tasks = false;
-    assert_heap_ok();
+    supervisor_background_tasks_run();
 }
@@ -0,0 +1,265 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <errno.h>
+
+#include <asmp/asmp.h>
+
+#include "bindings/subcore/Worker.h"
+
+#include "lib/utils/context_manager_helpers.h"
+#include "lib/utils/interrupt_char.h"
+#include "py/objtuple.h"
+#include "py/runtime.h"
+#include "shared-bindings/util.h"
+#include "supervisor/shared/tick.h"
+#include "supervisor/shared/translate.h"
+
+// Workers live outside the heap so that they can be stopped after the VM
+// that started them is gone.
+STATIC subcore_worker_obj_t workers[SUBCORE_MAX_WORKERS];
+
+STATIC void worker_destroy(subcore_worker_obj_t *self) {
+    int exitcode;
+    mptask_destroy(&self->task, true, &exitcode);
+    mpmq_destroy(&self->mq);
+    if (self->shared_memory != NULL) {
+        mpshm_detach(&self->shm);
+        mpshm_destroy(&self->shm);
+        self->shared_memory = NULL;
+    }
+    self->running = false;
+}
+
+void subcore_reset(void) {
+    for (size_t i = 0; i < SUBCORE_MAX_WORKERS; i++) {
+        if (workers[i].running) {
+            worker_destroy(&workers[i]);
+        }
+    }
+}
+
+STATIC void check_for_deinit(subcore_worker_obj_t *self) {
+    if (!self->running) {
+        raise_deinited_error();
+    }
+}
+
+//| class Worker:
+//|     """A precompiled program running on one of the subcores.
+//|
+//|        The main core and the worker share a block of memory, which the
+//|        Worker exposes through the buffer protocol, and exchange short
+//|        messages through a queue. The worker attaches to them with the keys
+//|        `SHM_KEY` and `MQ_KEY`, then the main core can, for example, fill
+//|        the memory with audio samples and send a message for the worker to
+//|        process them while the application carries on."""
+//|
+//|     def __init__(self, filename: str, *, shared_memory_size: int = 4096) -> None:
+//|         """Loads the worker ELF file ``filename`` onto a free subcore and
+//|            starts it, with ``shared_memory_size`` bytes of shared memory."""
+//|         ...
+//|
+STATIC mp_obj_t subcore_worker_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_filename, ARG_shared_memory_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_filename, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_shared_memory_size, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 4096} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    const char *filename = mp_obj_str_get_str(args[ARG_filename].u_obj);
+    mp_int_t shared_memory_size = args[ARG_shared_memory_size].u_int;
+    if (shared_memory_size < 0) {
+        mp_raise_ValueError_varg(translate("%q must be >= 0"), MP_QSTR_shared_memory_size);
+    }
+
+    subcore_worker_obj_t *self = NULL;
+    for (size_t i = 0; i < SUBCORE_MAX_WORKERS; i++) {
+        if (!workers[i].running) {
+            self = &workers[i];
+            break;
+        }
+    }
+    if (self == NULL) {
+        mp_raise_RuntimeError(translate("All subcores in use"));
+    }
+    self->base.type = &subcore_worker_type;
+    self->shared_memory = NULL;
+    self->shared_memory_size = 0;
+
+    asmp_init();
+    if (mptask_init(&self->task, filename) != 0) {
+        mp_raise_OSError(ENOENT);
+    }
+    if (mptask_assign(&self->task) != 0) {
+        int exitcode;
+        mptask_destroy(&self->task, true, &exitcode);
+        mp_raise_RuntimeError(translate("All subcores in use"));
+    }
+    int ret = mpmq_init(&self->mq, SUBCORE_MQ_KEY, mptask_getcpuid(&self->task));
+    if (ret == 0) {
+        ret = mptask_bindobj(&self->task, &self->mq);
+    }
+    if (ret == 0 && shared_memory_size > 0) {
+        ret = mpshm_init(&self->shm, SUBCORE_SHM_KEY, shared_memory_size);
+        if (ret == 0) {
+            self->shared_memory = mpshm_attach(&self->shm, 0);
+            self->shared_memory_size = shared_memory_size;
+            ret = self->shared_memory == NULL ? -ENOMEM : mptask_bindobj(&self->task, &self->shm);
+        }
+    }
+    if (ret == 0) {
+        ret = mptask_exec(&self->task);
+    }
+    self->running = true;
+    if (ret != 0) {
+        worker_destroy(self);
+        mp_raise_OSError(-ret);
+    }
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Stops the worker and frees its subcore and shared memory."""
+//|         ...
+//|
+STATIC mp_obj_t subcore_worker_deinit(mp_obj_t self_in) {
+    subcore_worker_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->running) {
+        worker_destroy(self);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(subcore_worker_deinit_obj, subcore_worker_deinit);
+
+//|     def __enter__(self) -> Worker:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes the worker when exiting a context. See
+//|            :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+STATIC mp_obj_t subcore_worker_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    return subcore_worker_deinit(args[0]);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(subcore_worker___exit___obj, 4, 4, subcore_worker_obj___exit__);
+
+//|     def send(self, message_id: int, data: int = 0) -> None:
+//|         """Sends a message to the worker. ``message_id`` is 0 to 127 and
+//|            ``data`` is any 32-bit value, such as an offset into the shared
+//|            memory."""
+//|         ...
+//|
+STATIC mp_obj_t subcore_worker_send(size_t n_args, const mp_obj_t *args) {
+    subcore_worker_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    check_for_deinit(self);
+    mp_int_t message_id = mp_obj_get_int(args[1]);
+    if (message_id < 0 || message_id > 127) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_message_id);
+    }
+    uint32_t data = n_args > 2 ? mp_obj_int_get_truncated(args[2]) : 0;
+    int ret = mpmq_send(&self->mq, message_id, data);
+    if (ret < 0) {
+        mp_raise_OSError(-ret);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(subcore_worker_send_obj, 2, 3, subcore_worker_send);
+
+//|     def receive(self, timeout: Optional[float] = None) -> Optional[Tuple[int, int]]:
+//|         """Waits for a message from the worker and returns it as a
+//|            ``(message_id, data)`` tuple, or returns None if ``timeout``
+//|            seconds pass first."""
+//|         ...
+//|
+STATIC mp_obj_t subcore_worker_receive(size_t n_args, const mp_obj_t *args) {
+    subcore_worker_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    check_for_deinit(self);
+    uint64_t timeout_ms = UINT64_MAX;
+    if (n_args > 1 && args[1] != mp_const_none) {
+        mp_float_t timeout = mp_obj_get_float(args[1]);
+        if (timeout < 0) {
+            mp_raise_ValueError(translate("timeout must be >= 0.0"));
+        }
+        timeout_ms = (uint64_t)(timeout * 1000);
+    }
+
+    uint64_t start_ticks = supervisor_ticks_ms64();
+    do {
+        // Wait in short slices so that background tasks keep running.
+        uint32_t data;
+        int message_id = mpmq_timedreceive(&self->mq, &data, 10);
+        if (message_id >= 0) {
+            mp_obj_t items[2] = { MP_OBJ_NEW_SMALL_INT(message_id), mp_obj_new_int_from_uint(data) };
+            return mp_obj_new_tuple(2, items);
+        }
+        if (message_id != -ETIMEDOUT) {
+            mp_raise_OSError(-message_id);
+        }
+        RUN_BACKGROUND_TASKS;
+        if (mp_hal_is_interrupted()) {
+            break;
+        }
+    } while (supervisor_ticks_ms64() - start_ticks < timeout_ms);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(subcore_worker_receive_obj, 1, 2, subcore_worker_receive);
+
+STATIC mp_int_t subcore_worker_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    subcore_worker_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    (void)flags;
+    if (!self->running || self->shared_memory == NULL) {
+        return 1;
+    }
+    bufinfo->buf = self->shared_memory;
+    bufinfo->len = self->shared_memory_size;
+    bufinfo->typecode = 'B';
+    return 0;
+}
+
+STATIC const mp_rom_map_elem_t subcore_worker_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&subcore_worker_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&subcore_worker___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_send), MP_ROM_PTR(&subcore_worker_send_obj) },
+    { MP_ROM_QSTR(MP_QSTR_receive), MP_ROM_PTR(&subcore_worker_receive_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(subcore_worker_locals_dict, subcore_worker_locals_dict_table);
+
+const mp_obj_type_t subcore_worker_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Worker,
+    .make_new = subcore_worker_make_new,
+    .buffer_p = { .get_buffer = subcore_worker_get_buffer, },
+    .locals_dict = (mp_obj_dict_t*)&subcore_worker_locals_dict,
+};
@@ -0,0 +1,57 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_CXD56_BINDINGS_SUBCORE_WORKER_H
+#define MICROPY_INCLUDED_CXD56_BINDINGS_SUBCORE_WORKER_H
+
+#include <asmp/mptask.h>
+#include <asmp/mpshm.h>
+#include <asmp/mpmq.h>
+
+#include "py/obj.h"
+
+// Keys that a worker uses to attach to the objects bound to its task.
+#define SUBCORE_SHM_KEY (1)
+#define SUBCORE_MQ_KEY (2)
+
+// The CXD5602 has five subcores besides the main one.
+#define SUBCORE_MAX_WORKERS (5)
+
+typedef struct {
+    mp_obj_base_t base;
+    mptask_t task;
+    mpshm_t shm;
+    mpmq_t mq;
+    uint8_t *shared_memory;
+    size_t shared_memory_size;
+    bool running;
+} subcore_worker_obj_t;
+
+extern const mp_obj_type_t subcore_worker_type;
+
+void subcore_reset(void);
+
+#endif // MICROPY_INCLUDED_CXD56_BINDINGS_SUBCORE_WORKER_H
@@ -0,0 +1,57 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "bindings/subcore/Worker.h"
+
+//| """CXD5602 subcores
+//|
+//| The :mod:`subcore` module runs precompiled workers on the other Cortex-M4F
+//| cores, so that audio or DSP processing can run in parallel with the
+//| application."""
+//|
+//| SHM_KEY: int
+//| """The key a worker passes to ``mpshm_init`` to attach to the shared memory."""
+//|
+//| MQ_KEY: int
+//| """The key a worker passes to ``mpmq_init`` to reach the message queue."""
+//|
+
+STATIC const mp_rom_map_elem_t subcore_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_subcore) },
+    { MP_ROM_QSTR(MP_QSTR_Worker), MP_ROM_PTR(&subcore_worker_type) },
+    { MP_ROM_QSTR(MP_QSTR_SHM_KEY), MP_ROM_INT(SUBCORE_SHM_KEY) },
+    { MP_ROM_QSTR(MP_QSTR_MQ_KEY), MP_ROM_INT(SUBCORE_MQ_KEY) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(subcore_module_globals, subcore_module_globals_table);
+
+const mp_obj_module_t subcore_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t*)&subcore_module_globals,
+};
@@ -26,6 +26,7 @@
 
 #include <arch/board/board.h>
 #include <sys/time.h>
+#include <string.h>
 
 #include "py/runtime.h"
 #include "py/mphal.h"
@@ -75,7 +76,8 @@ static int pulsein_interrupt_handler(int irq, FAR void *context, FAR void *arg)
         if (self->len < self->maxlen) {
             self->len++;
         } else {
-            self->start++;
+            self->start = (self->start + 1) % self->maxlen;
+            self->dropped++;
         }
     }
     self->last_us = current_us;
@@ -95,6 +97,7 @@ void common_hal_pulseio_pulsein_construct(pulseio_pulsein_obj_t *self,
     self->idle_state = idle_state;
     self->start = 0;
     self->len = 0;
+    self->dropped = 0;
     self->first_edge = true;
     self->paused = false;
 
@@ -155,6 +158,7 @@ void common_hal_pulseio_pulsein_clear(pulseio_pulsein_obj_t *self) {
     common_hal_mcu_disable_interrupts();
     self->start = 0;
     self->len = 0;
+    self->dropped = 0;
     common_hal_mcu_enable_interrupts();
 }
 
@@ -171,6 +175,23 @@ uint16_t common_hal_pulseio_pulsein_popleft(pulseio_pulsein_obj_t *self) {
     return value;
 }
 
+uint16_t common_hal_pulseio_pulsein_readinto(pulseio_pulsein_obj_t *self, uint16_t* buffer, uint16_t len) {
+    common_hal_mcu_disable_interrupts();
+    uint16_t count = MIN(len, self->len);
+    uint16_t first = MIN(count, self->maxlen - self->start);
+    memcpy(buffer, self->buffer + self->start, first * sizeof(uint16_t));
+    memcpy(buffer + first, self->buffer, (count - first) * sizeof(uint16_t));
+    self->start = (self->start + count) % self->maxlen;
+    self->len -= count;
+    common_hal_mcu_enable_interrupts();
+
+    return count;
+}
+
+uint32_t common_hal_pulseio_pulsein_get_dropped(pulseio_pulsein_obj_t *self) {
+    return self->dropped;
+}
+
 uint16_t common_hal_pulseio_pulsein_get_maxlen(pulseio_pulsein_obj_t *self) {
     return self->maxlen;
 }
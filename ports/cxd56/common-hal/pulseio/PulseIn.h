@@ -38,6 +38,7 @@ typedef struct {
     uint16_t maxlen;
     uint16_t start;
     uint16_t len;
+    volatile uint32_t dropped;
     uint64_t last_us;
     bool idle_state;
     bool first_edge;
@@ -124,3 +124,8 @@ void pulseout_reset(void) {
 
     pulse_buffer = NULL;
 }
+
+bool common_hal_pulseio_pulseout_get_busy(pulseio_pulseout_obj_t *self) {
+    // send waits until the pulses are out.
+    return false;
+}
@@ -20,3 +20,6 @@ CIRCUITPY_DISPLAYIO = 0
 CIRCUITPY_FREQUENCYIO = 0
 CIRCUITPY_COUNTIO = 0
 INTERNAL_LIBM = 1
+
+# Workers on the other cores through the SDK's ASMP framework
+CIRCUITPY_SUBCORE = 1
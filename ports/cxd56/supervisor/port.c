@@ -44,6 +44,10 @@
 #include "common-hal/pulseio/PWMOut.h"
 #include "common-hal/busio/UART.h"
 
+#if CIRCUITPY_SUBCORE
+#include "bindings/subcore/Worker.h"
+#endif
+
 safe_mode_t port_init(void) {
     boardctl(BOARDIOC_INIT, 0);
 
@@ -72,6 +76,9 @@ void reset_port(void) {
 #if CIRCUITPY_BUSIO
     busio_uart_reset();
 #endif
+#if CIRCUITPY_SUBCORE
+    subcore_reset();
+#endif
 
     reset_all_pins();
 }
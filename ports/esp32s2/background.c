@@ -26,6 +26,7 @@
 
 #include "py/runtime.h"
 #include "supervisor/filesystem.h"
+#include "supervisor/shared/background_tasks.h"
 #include "supervisor/shared/stack.h"
 
 #include "freertos/FreeRTOS.h"
@@ -35,29 +36,41 @@
 #include "shared-module/displayio/__init__.h"
 #endif
 
-static bool running_background_tasks = false;
+#if CIRCUITPY_NETWORK
+#include "shared-module/network/__init__.h"
+#endif
+
+STATIC background_task_t filesystem_task = BACKGROUND_TASK(filesystem_background, BACKGROUND_TASK_PRIORITY_FILESYSTEM, 16);
+#if CIRCUITPY_NETWORK
+STATIC background_task_t network_task = BACKGROUND_TASK(network_module_background, BACKGROUND_TASK_PRIORITY_NETWORK, 8);
+#endif
+
+STATIC bool tasks_registered = false;
+
+STATIC void register_background_tasks(void) {
+    supervisor_background_task_register(&filesystem_task);
+    #if CIRCUITPY_NETWORK
+    supervisor_background_task_register(&network_task);
+    #endif
+    tasks_registered = true;
+}
 
 void background_tasks_reset(void) {
-    running_background_tasks = false;
+    supervisor_background_tasks_reset();
 }
 
 void run_background_tasks(void) {
-    // Don't call ourselves recursively.
-    if (running_background_tasks) {
+    // Don't delay again when called from inside a task.
+    if (supervisor_background_tasks_running()) {
         return;
     }
+    if (!tasks_registered) {
+        register_background_tasks();
+    }
 
     // Delay for 1 tick so that we don't starve the idle task.
     // TODO: 1 tick is 10ms which is a long time! Can we delegate to idle for a minimal amount of
     // time?
     vTaskDelay(1);
-    running_background_tasks = true;
-    filesystem_background();
-
-    // #if CIRCUITPY_DISPLAYIO
-    // displayio_background();
-    // #endif
-    running_background_tasks = false;
-
-    assert_heap_ok();
+    supervisor_background_tasks_run();
 }
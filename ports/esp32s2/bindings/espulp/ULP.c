@@ -0,0 +1,225 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "bindings/espulp/ULP.h"
+
+#include "lib/utils/interrupt_char.h"
+#include "py/mphal.h"
+#include "py/runtime.h"
+#include "supervisor/shared/tick.h"
+#include "supervisor/shared/translate.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "driver/rtc_cntl.h"
+#include "esp32s2/rom/ets_sys.h"
+#include "esp32s2/ulp.h"
+#include "esp32s2/ulp_riscv.h"
+#include "soc/rtc_cntl_reg.h"
+#include "soc/soc.h"
+
+// There is only one coprocessor, so there is only one ULP object.
+STATIC espulp_ulp_obj_t espulp_ulp_obj = {
+    .base = { &espulp_ulp_type },
+};
+
+STATIC bool isr_registered;
+
+// The ULP program calls ulp_riscv_wakeup_main_processor() to raise this.
+STATIC void espulp_isr(void *arg) {
+    espulp_ulp_obj_t *self = arg;
+    self->signaled = true;
+    if (self->waiting_task != NULL) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(self->waiting_task, &woken);
+        if (woken == pdTRUE) {
+            portYIELD_FROM_ISR();
+        }
+    }
+}
+
+STATIC void espulp_halt(espulp_ulp_obj_t *self) {
+    // Stop the timer that restarts the program, let a run in progress
+    // finish, then hold the core in reset.
+    CLEAR_PERI_REG_MASK(RTC_CNTL_ULP_CP_TIMER_REG, RTC_CNTL_ULP_CP_SLP_TIMER_EN);
+    ets_delay_us(20);
+    REG_SET_FIELD(RTC_CNTL_COCPU_CTRL_REG, RTC_CNTL_COCPU_SHUT_2_CLK_DIS, 0x3F);
+    REG_SET_BIT(RTC_CNTL_COCPU_CTRL_REG, RTC_CNTL_COCPU_SHUT_RESET_EN);
+    self->running = false;
+}
+
+// Stops the coprocessor so that a program doesn't outlive the VM.
+void espulp_reset(void) {
+    if (espulp_ulp_obj.running) {
+        espulp_halt(&espulp_ulp_obj);
+    }
+    espulp_ulp_obj.signaled = false;
+    espulp_ulp_obj.waiting_task = NULL;
+}
+
+//| class ULP:
+//|     """The ULP-RISC-V coprocessor.
+//|
+//|        It keeps running small programs, such as sampling a sensor, while the
+//|        main core sleeps. The program's memory in RTC slow memory is shared
+//|        with the main core: a ULP object supports the buffer protocol over
+//|        it, so ``memoryview(ulp)`` reads and writes the program's variables
+//|        as a mailbox."""
+//|
+//|     def __init__(self) -> None:
+//|         """Returns the ULP. There is only one coprocessor, so every call
+//|            returns the same object."""
+//|         ...
+//|
+STATIC mp_obj_t espulp_ulp_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
+    mp_arg_check_num(n_args, kw_args, 0, 0, false);
+    espulp_ulp_obj_t *self = &espulp_ulp_obj;
+    if (!isr_registered) {
+        if (rtc_isr_register(espulp_isr, self, RTC_CNTL_COCPU_INT_ST_M) != ESP_OK) {
+            mp_raise_RuntimeError(translate("Could not set up the ULP interrupt"));
+        }
+        REG_SET_BIT(RTC_CNTL_INT_ENA_REG, RTC_CNTL_COCPU_INT_ENA_M);
+        isr_registered = true;
+    }
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def run(self, program: ReadableBuffer, *, period_us: int = 10000) -> None:
+//|         """Loads the ULP-RISC-V binary ``program`` and starts it. The program
+//|            is restarted ``period_us`` microseconds after it halts itself.
+//|            Any program that is already running is stopped first."""
+//|         ...
+//|
+STATIC mp_obj_t espulp_ulp_run(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_program, ARG_period_us };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_program, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_period_us, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 10000} },
+    };
+    espulp_ulp_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_program].u_obj, &bufinfo, MP_BUFFER_READ);
+    if (bufinfo.len > CONFIG_ESP32S2_ULP_COPROC_RESERVE_MEM) {
+        mp_raise_ValueError(translate("Program too large"));
+    }
+    if (args[ARG_period_us].u_int < 0) {
+        mp_raise_ValueError_varg(translate("%q must be >= 0"), MP_QSTR_period_us);
+    }
+
+    if (self->running) {
+        espulp_halt(self);
+    }
+    self->signaled = false;
+    if (ulp_set_wakeup_period(0, args[ARG_period_us].u_int) != ESP_OK ||
+        ulp_riscv_load_binary(bufinfo.buf, bufinfo.len) != ESP_OK ||
+        ulp_riscv_run() != ESP_OK) {
+        mp_raise_RuntimeError(translate("Could not start the ULP program"));
+    }
+    self->running = true;
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(espulp_ulp_run_obj, 1, espulp_ulp_run);
+
+//|     def halt(self) -> None:
+//|         """Stops the program. Its memory is left as it was."""
+//|         ...
+//|
+STATIC mp_obj_t espulp_ulp_halt(mp_obj_t self_in) {
+    espulp_ulp_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->running) {
+        espulp_halt(self);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(espulp_ulp_halt_obj, espulp_ulp_halt);
+
+//|     def wait(self, timeout: Optional[float] = None) -> bool:
+//|         """Waits for the program to wake the main core, for example when a
+//|            reading crosses a threshold. The main core idles while it waits.
+//|            Returns False if ``timeout`` seconds pass first."""
+//|         ...
+//|
+STATIC mp_obj_t espulp_ulp_wait(size_t n_args, const mp_obj_t *args) {
+    espulp_ulp_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    uint64_t timeout_ms = UINT64_MAX;
+    if (n_args > 1 && args[1] != mp_const_none) {
+        #if MICROPY_PY_BUILTINS_FLOAT
+        mp_float_t timeout = mp_obj_get_float(args[1]);
+        #else
+        mp_int_t timeout = mp_obj_get_int(args[1]);
+        #endif
+        if (timeout < 0) {
+            mp_raise_ValueError(translate("timeout must be >= 0.0"));
+        }
+        timeout_ms = (uint64_t)(timeout * 1000);
+    }
+
+    uint64_t start_ticks = supervisor_ticks_ms64();
+    self->waiting_task = xTaskGetCurrentTaskHandle();
+    while (!self->signaled && supervisor_ticks_ms64() - start_ticks < timeout_ms) {
+        // Block until the interrupt notifies this task, waking up regularly
+        // to run background tasks.
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10));
+        RUN_BACKGROUND_TASKS;
+        if (mp_hal_is_interrupted()) {
+            break;
+        }
+    }
+    self->waiting_task = NULL;
+    bool signaled = self->signaled;
+    self->signaled = false;
+    return mp_obj_new_bool(signaled);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(espulp_ulp_wait_obj, 1, 2, espulp_ulp_wait);
+
+STATIC mp_int_t espulp_ulp_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    (void)self_in;
+    (void)flags;
+    bufinfo->buf = (void*)RTC_SLOW_MEM;
+    bufinfo->len = CONFIG_ESP32S2_ULP_COPROC_RESERVE_MEM;
+    bufinfo->typecode = 'B';
+    return 0;
+}
+
+STATIC const mp_rom_map_elem_t espulp_ulp_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_run), MP_ROM_PTR(&espulp_ulp_run_obj) },
+    { MP_ROM_QSTR(MP_QSTR_halt), MP_ROM_PTR(&espulp_ulp_halt_obj) },
+    { MP_ROM_QSTR(MP_QSTR_wait), MP_ROM_PTR(&espulp_ulp_wait_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(espulp_ulp_locals_dict, espulp_ulp_locals_dict_table);
+
+const mp_obj_type_t espulp_ulp_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_ULP,
+    .make_new = espulp_ulp_make_new,
+    .buffer_p = { .get_buffer = espulp_ulp_get_buffer, },
+    .locals_dict = (mp_obj_dict_t*)&espulp_ulp_locals_dict,
+};
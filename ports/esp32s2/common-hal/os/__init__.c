@@ -30,6 +30,8 @@
 #include "py/objtuple.h"
 #include "py/qstr.h"
 
+#include "esp_system.h"
+
 STATIC const qstr os_uname_info_fields[] = {
     MP_QSTR_sysname, MP_QSTR_nodename,
     MP_QSTR_release, MP_QSTR_version, MP_QSTR_machine
@@ -57,5 +59,8 @@ mp_obj_t common_hal_os_uname(void) {
 }
 
 bool common_hal_os_urandom(uint8_t* buffer, uint32_t length) {
-    return false;
+    // Reads the hardware RNG a word at a time. It is only truly random while
+    // the radio or the bootloader's entropy source is running.
+    esp_fill_random(buffer, length);
+    return true;
 }
@@ -0,0 +1,675 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "shared-bindings/wifi/__init__.h"
+#include "shared-bindings/wifi/Radio.h"
+
+#include "lib/netutils/netutils.h"
+#include "py/mperrno.h"
+#include "py/mphal.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+#include "supervisor/shared/tick.h"
+
+#include "esp_system.h"
+#include "esp_wifi.h"
+#include "lwip/dns.h"
+#include "lwip/ip_addr.h"
+#include "lwip/netbuf.h"
+#include "lwip/tcp.h"
+
+// These match lwIP's sockets.h, which can't be included alongside the socket
+// module's names.
+#define WIFI_SOL_SOCKET (0xfff)
+#define WIFI_SO_REUSEADDR (0x0004)
+
+// Number of times the driver reassociates before connect() gives up.
+#define WIFI_CONNECT_RETRIES (5)
+
+STATIC void socket_close_all(wifi_radio_obj_t *self);
+
+bool common_hal_wifi_radio_get_enabled(wifi_radio_obj_t *self) {
+    return self->started;
+}
+
+void common_hal_wifi_radio_set_enabled(wifi_radio_obj_t *self, bool enabled) {
+    if (enabled == self->started) {
+        return;
+    }
+    if (!enabled) {
+        socket_close_all(self);
+        self->connecting = false;
+        esp_wifi_stop();
+        self->started = false;
+        self->ap_started = false;
+        xEventGroupClearBits(self->event_group_handle, WIFI_CONNECTED_BIT | WIFI_DISCONNECTED_BIT);
+        return;
+    }
+    common_hal_wifi_init(self);
+    esp_wifi_set_mode(WIFI_MODE_STA);
+    if (esp_wifi_start() != ESP_OK) {
+        mp_raise_OSError(MP_EIO);
+    }
+    self->started = true;
+    network_module_register_nic(MP_OBJ_FROM_PTR(self));
+}
+
+mp_obj_t common_hal_wifi_radio_get_mac_address(wifi_radio_obj_t *self) {
+    uint8_t mac[6];
+    // Read from efuse so that it works before the driver is up.
+    esp_read_mac(mac, ESP_MAC_WIFI_STA);
+    return mp_obj_new_bytes(mac, sizeof(mac));
+}
+
+bool common_hal_wifi_radio_get_connected(wifi_radio_obj_t *self) {
+    if (!self->started) {
+        return false;
+    }
+    return (xEventGroupGetBits(self->event_group_handle) & WIFI_CONNECTED_BIT) != 0;
+}
+
+STATIC mp_obj_t get_ipv4_address(esp_netif_t *netif) {
+    esp_netif_ip_info_t ip_info;
+    if (esp_netif_get_ip_info(netif, &ip_info) != ESP_OK || ip_info.ip.addr == 0) {
+        return mp_const_none;
+    }
+    // The address is stored in network order.
+    return netutils_format_ipv4_addr((uint8_t*)&ip_info.ip.addr, NETUTILS_BIG);
+}
+
+mp_obj_t common_hal_wifi_radio_get_ipv4_address(wifi_radio_obj_t *self) {
+    if (!common_hal_wifi_radio_get_connected(self)) {
+        return mp_const_none;
+    }
+    return get_ipv4_address(self->netif);
+}
+
+mp_obj_t common_hal_wifi_radio_get_ap_ipv4_address(wifi_radio_obj_t *self) {
+    if (!self->ap_started) {
+        return mp_const_none;
+    }
+    return get_ipv4_address(self->ap_netif);
+}
+
+void common_hal_wifi_radio_connect(wifi_radio_obj_t *self, const uint8_t *ssid, size_t ssid_len, const uint8_t *password, size_t password_len, uint8_t channel, mp_float_t timeout) {
+    common_hal_wifi_radio_set_enabled(self, true);
+    if (self->connecting || common_hal_wifi_radio_get_connected(self)) {
+        self->connecting = false;
+        esp_wifi_disconnect();
+    }
+
+    wifi_config_t config;
+    memset(&config, 0, sizeof(config));
+    memcpy(&config.sta.ssid, ssid, ssid_len);
+    memcpy(&config.sta.password, password, password_len);
+    config.sta.channel = channel;
+    // Without a channel hint, look at all of them and pick the strongest AP.
+    config.sta.scan_method = channel == 0 ? WIFI_ALL_CHANNEL_SCAN : WIFI_FAST_SCAN;
+    config.sta.sort_method = WIFI_CONNECT_AP_BY_SIGNAL;
+    config.sta.threshold.authmode = password_len == 0 ? WIFI_AUTH_OPEN : WIFI_AUTH_WPA2_PSK;
+    esp_wifi_set_config(ESP_IF_WIFI_STA, &config);
+
+    xEventGroupClearBits(self->event_group_handle, WIFI_CONNECTED_BIT | WIFI_DISCONNECTED_BIT);
+    self->retries_left = WIFI_CONNECT_RETRIES;
+    self->connecting = true;
+    esp_wifi_connect();
+
+    uint64_t start = supervisor_ticks_ms64();
+    uint64_t timeout_ms = timeout < 0 ? 0 : (uint64_t)(timeout * 1000);
+    EventBits_t bits;
+    do {
+        RUN_BACKGROUND_TASKS;
+        bits = xEventGroupGetBits(self->event_group_handle);
+        if (bits & (WIFI_CONNECTED_BIT | WIFI_DISCONNECTED_BIT)) {
+            break;
+        }
+        if (timeout >= 0 && supervisor_ticks_ms64() - start >= timeout_ms) {
+            break;
+        }
+    } while (!mp_hal_is_interrupted());
+
+    if (bits & WIFI_CONNECTED_BIT) {
+        return;
+    }
+    self->connecting = false;
+    esp_wifi_disconnect();
+    if (mp_hal_is_interrupted()) {
+        return;
+    }
+    if (bits & WIFI_DISCONNECTED_BIT) {
+        mp_raise_OSError(self->last_disconnect_reason == WIFI_REASON_NO_AP_FOUND ? MP_EHOSTUNREACH : MP_ECONNREFUSED);
+    }
+    mp_raise_OSError(MP_ETIMEDOUT);
+}
+
+void common_hal_wifi_radio_disconnect(wifi_radio_obj_t *self) {
+    if (!self->started) {
+        return;
+    }
+    self->connecting = false;
+    esp_wifi_disconnect();
+}
+
+void common_hal_wifi_radio_start_ap(wifi_radio_obj_t *self, const uint8_t *ssid, size_t ssid_len, const uint8_t *password, size_t password_len, uint8_t channel) {
+    common_hal_wifi_radio_set_enabled(self, true);
+
+    wifi_config_t config;
+    memset(&config, 0, sizeof(config));
+    memcpy(&config.ap.ssid, ssid, ssid_len);
+    config.ap.ssid_len = ssid_len;
+    memcpy(&config.ap.password, password, password_len);
+    config.ap.channel = channel;
+    config.ap.authmode = password_len == 0 ? WIFI_AUTH_OPEN : WIFI_AUTH_WPA2_PSK;
+    config.ap.max_connection = 4;
+
+    esp_wifi_set_mode(WIFI_MODE_APSTA);
+    if (esp_wifi_set_config(ESP_IF_WIFI_AP, &config) != ESP_OK) {
+        mp_raise_OSError(MP_EIO);
+    }
+    self->ap_started = true;
+}
+
+void common_hal_wifi_radio_stop_ap(wifi_radio_obj_t *self) {
+    if (!self->ap_started) {
+        return;
+    }
+    esp_wifi_set_mode(WIFI_MODE_STA);
+    self->ap_started = false;
+}
+
+// Sockets
+//
+// Sockets run on lwIP's netconn API rather than its BSD socket layer, which
+// would mean a second copy of every buffer. netconns are always non-blocking
+// and waiting is done here, so background tasks and ctrl-C keep working.
+
+STATIC int error_to_errno(err_t err) {
+    switch (err) {
+        case ERR_MEM: return MP_ENOMEM;
+        case ERR_BUF: return MP_ENOBUFS;
+        case ERR_TIMEOUT: return MP_ETIMEDOUT;
+        case ERR_RTE: return MP_EHOSTUNREACH;
+        case ERR_INPROGRESS: return MP_EINPROGRESS;
+        case ERR_WOULDBLOCK: return MP_EAGAIN;
+        case ERR_USE: return MP_EADDRINUSE;
+        case ERR_ALREADY: return MP_EALREADY;
+        case ERR_ISCONN: return MP_EISCONN;
+        case ERR_CONN: return MP_ENOTCONN;
+        case ERR_IF: return MP_ENODEV;
+        case ERR_ABRT: return MP_ECONNABORTED;
+        case ERR_RST: return MP_ECONNRESET;
+        case ERR_CLSD: return MP_ENOTCONN;
+        default: return MP_EIO;
+    }
+}
+
+// Called from the lwIP task. Until a netconn has been given a slot its
+// socket field counts the data events it missed, the same way lwIP's own
+// socket layer does for connections waiting in accept().
+STATIC void socket_event_callback(struct netconn *conn, enum netconn_evt evt, u16_t len) {
+    SYS_ARCH_DECL_PROTECT(lev);
+    SYS_ARCH_PROTECT(lev);
+    if (conn->socket < 0) {
+        if (evt == NETCONN_EVT_RCVPLUS) {
+            conn->socket--;
+        }
+    } else {
+        wifi_socket_t *s = &common_hal_wifi_radio_obj.sockets[conn->socket];
+        switch (evt) {
+            case NETCONN_EVT_RCVPLUS:
+                s->rcvevent++;
+                break;
+            case NETCONN_EVT_RCVMINUS:
+                s->rcvevent--;
+                break;
+            case NETCONN_EVT_SENDPLUS:
+                s->sendevent = 1;
+                break;
+            case NETCONN_EVT_SENDMINUS:
+                s->sendevent = 0;
+                break;
+            case NETCONN_EVT_ERROR:
+                s->errevent = 1;
+                break;
+        }
+    }
+    SYS_ARCH_UNPROTECT(lev);
+}
+
+STATIC int socket_register(wifi_radio_obj_t *self, struct netconn *conn, int *_errno) {
+    for (int i = 0; i < WIFI_SOCKET_COUNT; i++) {
+        wifi_socket_t *s = &self->sockets[i];
+        if (s->conn != NULL) {
+            continue;
+        }
+        netconn_set_nonblocking(conn, 1);
+        SYS_ARCH_DECL_PROTECT(lev);
+        SYS_ARCH_PROTECT(lev);
+        s->conn = conn;
+        s->rx_pbuf = NULL;
+        s->rx_offset = 0;
+        s->rx_closed = false;
+        s->rcvevent = -1 - conn->socket;
+        s->sendevent = 1;
+        s->errevent = 0;
+        conn->socket = i;
+        SYS_ARCH_UNPROTECT(lev);
+        return i;
+    }
+    *_errno = MP_EMFILE;
+    return -1;
+}
+
+STATIC void socket_free(wifi_socket_t *s) {
+    if (s->conn == NULL) {
+        return;
+    }
+    if (s->rx_pbuf != NULL) {
+        pbuf_free(s->rx_pbuf);
+        s->rx_pbuf = NULL;
+    }
+    // Let TCP close gracefully rather than abort when the FIN can't be
+    // queued straight away.
+    netconn_set_nonblocking(s->conn, 0);
+    netconn_delete(s->conn);
+    s->conn = NULL;
+}
+
+STATIC void socket_close_all(wifi_radio_obj_t *self) {
+    for (int i = 0; i < WIFI_SOCKET_COUNT; i++) {
+        socket_free(&self->sockets[i]);
+    }
+}
+
+STATIC wifi_socket_t *get_socket(mod_network_socket_obj_t *socket) {
+    return &common_hal_wifi_radio_obj.sockets[socket->u_param.fileno];
+}
+
+// Waits a little for a socket that would block. Returns false, with _errno
+// set, once the socket's timeout has run out.
+STATIC bool socket_wait(mod_network_socket_obj_t *socket, uint64_t start, int *_errno) {
+    mp_uint_t timeout_ms = socket->timeout;
+    if (timeout_ms == 0) {
+        *_errno = MP_EAGAIN;
+        return false;
+    }
+    if (timeout_ms != (mp_uint_t)-1 && supervisor_ticks_ms64() - start >= timeout_ms) {
+        *_errno = MP_ETIMEDOUT;
+        return false;
+    }
+    if (mp_hal_is_interrupted()) {
+        *_errno = MP_EINTR;
+        return false;
+    }
+    mp_hal_delay_ms(1);
+    return true;
+}
+
+STATIC void ip_to_bytes(const ip_addr_t *addr, byte *ip) {
+    const ip4_addr_t *addr4 = ip_2_ip4(addr);
+    ip[0] = ip4_addr1(addr4);
+    ip[1] = ip4_addr2(addr4);
+    ip[2] = ip4_addr3(addr4);
+    ip[3] = ip4_addr4(addr4);
+}
+
+int common_hal_wifi_radio_gethostbyname(mp_obj_t nic, const char *name, mp_uint_t len, uint8_t *ip_out) {
+    char host[DNS_MAX_NAME_LENGTH + 1];
+    if (len > DNS_MAX_NAME_LENGTH) {
+        return -2;
+    }
+    memcpy(host, name, len);
+    host[len] = '\0';
+    ip_addr_t addr;
+    if (netconn_gethostbyname(host, &addr) != ERR_OK) {
+        return -2;
+    }
+    ip_to_bytes(&addr, ip_out);
+    return 0;
+}
+
+int common_hal_wifi_radio_socket_socket(mod_network_socket_obj_t *socket, int *_errno) {
+    if (socket->u_param.domain != MOD_NETWORK_AF_INET) {
+        *_errno = MP_EAFNOSUPPORT;
+        return -1;
+    }
+
+    enum netconn_type type;
+    switch (socket->u_param.type) {
+        case MOD_NETWORK_SOCK_STREAM: type = NETCONN_TCP; break;
+        case MOD_NETWORK_SOCK_DGRAM: type = NETCONN_UDP; break;
+        default: *_errno = MP_EINVAL; return -1;
+    }
+
+    struct netconn *conn = netconn_new_with_callback(type, socket_event_callback);
+    if (conn == NULL) {
+        *_errno = MP_ENOMEM;
+        return -1;
+    }
+    int fd = socket_register(&common_hal_wifi_radio_obj, conn, _errno);
+    if (fd < 0) {
+        netconn_delete(conn);
+        return -1;
+    }
+    socket->u_param.fileno = fd;
+    return 0;
+}
+
+void common_hal_wifi_radio_socket_close(mod_network_socket_obj_t *socket) {
+    if (socket->u_param.fileno < 0) {
+        return;
+    }
+    socket_free(get_socket(socket));
+    socket->u_param.fileno = -1;
+}
+
+int common_hal_wifi_radio_socket_bind(mod_network_socket_obj_t *socket, byte *ip, mp_uint_t port, int *_errno) {
+    ip_addr_t addr;
+    if (ip == NULL) {
+        ip_addr_set_any(false, &addr);
+    } else {
+        IP_ADDR4(&addr, ip[0], ip[1], ip[2], ip[3]);
+    }
+    err_t err = netconn_bind(get_socket(socket)->conn, &addr, port);
+    if (err != ERR_OK) {
+        *_errno = error_to_errno(err);
+        return -1;
+    }
+    return 0;
+}
+
+int common_hal_wifi_radio_socket_listen(mod_network_socket_obj_t *socket, mp_int_t backlog, int *_errno) {
+    if (backlog < 1) {
+        backlog = 1;
+    }
+    err_t err = netconn_listen_with_backlog(get_socket(socket)->conn, backlog > 0xff ? 0xff : backlog);
+    if (err != ERR_OK) {
+        *_errno = error_to_errno(err);
+        return -1;
+    }
+    return 0;
+}
+
+int common_hal_wifi_radio_socket_accept(mod_network_socket_obj_t *socket, mod_network_socket_obj_t *socket2, byte *ip, mp_uint_t *port, int *_errno) {
+    wifi_socket_t *s = get_socket(socket);
+    struct netconn *newconn;
+    uint64_t start = supervisor_ticks_ms64();
+    for (;;) {
+        err_t err = netconn_accept(s->conn, &newconn);
+        if (err == ERR_OK) {
+            break;
+        }
+        if (err != ERR_WOULDBLOCK) {
+            *_errno = error_to_errno(err);
+            return -1;
+        }
+        if (!socket_wait(socket, start, _errno)) {
+            return -1;
+        }
+    }
+
+    int fd = socket_register(&common_hal_wifi_radio_obj, newconn, _errno);
+    if (fd < 0) {
+        netconn_delete(newconn);
+        return -1;
+    }
+    socket2->u_param.fileno = fd;
+
+    ip_addr_t addr;
+    ip_addr_set_zero(&addr);
+    u16_t peer_port = 0;
+    netconn_peer(newconn, &addr, &peer_port);
+    ip_to_bytes(&addr, ip);
+    *port = peer_port;
+    return 0;
+}
+
+int common_hal_wifi_radio_socket_connect(mod_network_socket_obj_t *socket, byte *ip, mp_uint_t port, int *_errno) {
+    wifi_socket_t *s = get_socket(socket);
+    ip_addr_t addr;
+    IP_ADDR4(&addr, ip[0], ip[1], ip[2], ip[3]);
+    err_t err = netconn_connect(s->conn, &addr, port);
+    if (err == ERR_OK) {
+        // UDP, or already connected
+        return 0;
+    }
+    if (err != ERR_INPROGRESS) {
+        *_errno = error_to_errno(err);
+        return -1;
+    }
+
+    uint64_t start = supervisor_ticks_ms64();
+    while (s->conn->state == NETCONN_CONNECT) {
+        if (!socket_wait(socket, start, _errno)) {
+            if (*_errno == MP_EAGAIN) {
+                *_errno = MP_EINPROGRESS;
+            }
+            return -1;
+        }
+    }
+    err = netconn_err(s->conn);
+    if (err != ERR_OK) {
+        // A refused connection shows up as a reset
+        *_errno = err == ERR_RST ? MP_ECONNREFUSED : error_to_errno(err);
+        return -1;
+    }
+    return 0;
+}
+
+STATIC mp_uint_t udp_send(mod_network_socket_obj_t *socket, const byte *buf, mp_uint_t len, const ip_addr_t *addr, mp_uint_t port, int *_errno) {
+    struct netbuf *nb = netbuf_new();
+    if (nb == NULL) {
+        *_errno = MP_ENOMEM;
+        return -1;
+    }
+    // Send from the caller's buffer; the stack copies it if the packet has to
+    // wait for ARP, and the driver copies it into its own TX buffer.
+    err_t err = netbuf_ref(nb, buf, len);
+    if (err == ERR_OK) {
+        if (addr == NULL) {
+            err = netconn_send(get_socket(socket)->conn, nb);
+        } else {
+            err = netconn_sendto(get_socket(socket)->conn, nb, addr, port);
+        }
+    }
+    netbuf_delete(nb);
+    if (err != ERR_OK) {
+        *_errno = error_to_errno(err);
+        return -1;
+    }
+    return len;
+}
+
+mp_uint_t common_hal_wifi_radio_socket_send(mod_network_socket_obj_t *socket, const byte *buf, mp_uint_t len, int *_errno) {
+    if (socket->u_param.type == MOD_NETWORK_SOCK_DGRAM) {
+        return udp_send(socket, buf, len, NULL, 0, _errno);
+    }
+    wifi_socket_t *s = get_socket(socket);
+    uint64_t start = supervisor_ticks_ms64();
+    for (;;) {
+        size_t written = 0;
+        err_t err = netconn_write_partly(s->conn, buf, len, NETCONN_COPY | NETCONN_DONTBLOCK, &written);
+        if (err == ERR_OK) {
+            return written;
+        }
+        if (err != ERR_WOULDBLOCK) {
+            *_errno = error_to_errno(err);
+            return -1;
+        }
+        if (!socket_wait(socket, start, _errno)) {
+            return -1;
+        }
+    }
+}
+
+mp_uint_t common_hal_wifi_radio_socket_recv(mod_network_socket_obj_t *socket, byte *buf, mp_uint_t len, int *_errno) {
+    wifi_socket_t *s = get_socket(socket);
+    if (socket->u_param.type == MOD_NETWORK_SOCK_DGRAM) {
+        byte ip[MOD_NETWORK_IPADDR_BUF_SIZE];
+        mp_uint_t port;
+        return common_hal_wifi_radio_socket_recvfrom(socket, buf, len, ip, &port, _errno);
+    }
+
+    if (s->rx_pbuf == NULL) {
+        uint64_t start = supervisor_ticks_ms64();
+        for (;;) {
+            // Hold on to the pbuf chain and ack it ourselves only once it
+            // has been read, so the window tracks what Python has consumed.
+            err_t err = netconn_recv_tcp_pbuf_flags(s->conn, &s->rx_pbuf, NETCONN_DONTBLOCK | NETCONN_NOAUTORCVD);
+            if (err == ERR_OK) {
+                s->rx_offset = 0;
+                break;
+            }
+            if (err == ERR_CLSD) {
+                // EOF; lwIP only signals it once, so remember it for poll
+                s->rx_closed = true;
+                return 0;
+            }
+            if (err != ERR_WOULDBLOCK) {
+                *_errno = error_to_errno(err);
+                return -1;
+            }
+            if (!socket_wait(socket, start, _errno)) {
+                return -1;
+            }
+        }
+    }
+
+    if (len > 0xffff) {
+        len = 0xffff;
+    }
+    u16_t n = pbuf_copy_partial(s->rx_pbuf, buf, len, s->rx_offset);
+    s->rx_offset += n;
+    if (s->rx_offset >= s->rx_pbuf->tot_len) {
+        u16_t consumed = s->rx_pbuf->tot_len;
+        pbuf_free(s->rx_pbuf);
+        s->rx_pbuf = NULL;
+        s->rx_offset = 0;
+        netconn_tcp_recvd(s->conn, consumed);
+    }
+    return n;
+}
+
+mp_uint_t common_hal_wifi_radio_socket_sendto(mod_network_socket_obj_t *socket, const byte *buf, mp_uint_t len, byte *ip, mp_uint_t port, int *_errno) {
+    if (socket->u_param.type != MOD_NETWORK_SOCK_DGRAM) {
+        return common_hal_wifi_radio_socket_send(socket, buf, len, _errno);
+    }
+    ip_addr_t addr;
+    IP_ADDR4(&addr, ip[0], ip[1], ip[2], ip[3]);
+    return udp_send(socket, buf, len, &addr, port, _errno);
+}
+
+mp_uint_t common_hal_wifi_radio_socket_recvfrom(mod_network_socket_obj_t *socket, byte *buf, mp_uint_t len, byte *ip, mp_uint_t *port, int *_errno) {
+    wifi_socket_t *s = get_socket(socket);
+    if (socket->u_param.type != MOD_NETWORK_SOCK_DGRAM) {
+        mp_uint_t ret = common_hal_wifi_radio_socket_recv(socket, buf, len, _errno);
+        if (ret != (mp_uint_t)-1) {
+            ip_addr_t addr;
+            ip_addr_set_zero(&addr);
+            u16_t peer_port = 0;
+            netconn_peer(s->conn, &addr, &peer_port);
+            ip_to_bytes(&addr, ip);
+            *port = peer_port;
+        }
+        return ret;
+    }
+
+    struct netbuf *nb;
+    uint64_t start = supervisor_ticks_ms64();
+    for (;;) {
+        err_t err = netconn_recv_udp_raw_netbuf_flags(s->conn, &nb, NETCONN_DONTBLOCK);
+        if (err == ERR_OK) {
+            break;
+        }
+        if (err != ERR_WOULDBLOCK) {
+            *_errno = error_to_errno(err);
+            return -1;
+        }
+        if (!socket_wait(socket, start, _errno)) {
+            return -1;
+        }
+    }
+
+    // Whatever doesn't fit is dropped, as for any datagram socket.
+    if (len > 0xffff) {
+        len = 0xffff;
+    }
+    u16_t n = netbuf_copy(nb, buf, len);
+    ip_to_bytes(netbuf_fromaddr(nb), ip);
+    *port = netbuf_fromport(nb);
+    netbuf_delete(nb);
+    return n;
+}
+
+int common_hal_wifi_radio_socket_setsockopt(mod_network_socket_obj_t *socket, mp_uint_t level, mp_uint_t opt, const void *optval, mp_uint_t optlen, int *_errno) {
+    wifi_socket_t *s = get_socket(socket);
+    if (level == WIFI_SOL_SOCKET && opt == WIFI_SO_REUSEADDR && optlen == sizeof(mp_int_t)) {
+        // Only the application touches an unbound pcb, so this is safe
+        // without going through the lwIP task.
+        if (s->conn->pcb.ip == NULL || s->conn->pcb.ip->local_port != 0) {
+            *_errno = MP_EINVAL;
+            return -1;
+        }
+        if (*(const mp_int_t*)optval) {
+            ip_set_option(s->conn->pcb.ip, SOF_REUSEADDR);
+        } else {
+            ip_reset_option(s->conn->pcb.ip, SOF_REUSEADDR);
+        }
+        return 0;
+    }
+    *_errno = MP_EOPNOTSUPP;
+    return -1;
+}
+
+int common_hal_wifi_radio_socket_settimeout(mod_network_socket_obj_t *socket, mp_uint_t timeout_ms, int *_errno) {
+    // socket->timeout is applied by socket_wait()
+    return 0;
+}
+
+int common_hal_wifi_radio_socket_ioctl(mod_network_socket_obj_t *socket, mp_uint_t request, mp_uint_t arg, int *_errno) {
+    if (request != MP_STREAM_POLL) {
+        *_errno = MP_EINVAL;
+        return -1;
+    }
+    wifi_socket_t *s = get_socket(socket);
+    mp_uint_t ret = 0;
+    if ((arg & MP_STREAM_POLL_RD) && (s->rx_pbuf != NULL || s->rcvevent > 0 || s->rx_closed)) {
+        ret |= MP_STREAM_POLL_RD;
+    }
+    if ((arg & MP_STREAM_POLL_WR) && s->sendevent && s->conn->state != NETCONN_CONNECT) {
+        ret |= MP_STREAM_POLL_WR;
+    }
+    if (s->errevent) {
+        ret |= MP_STREAM_POLL_ERR;
+    }
+    return ret;
+}
+
+void common_hal_wifi_radio_socket_deinit(mod_network_socket_obj_t *socket) {
+    socket_close_all(&common_hal_wifi_radio_obj);
+}
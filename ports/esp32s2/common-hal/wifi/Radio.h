@@ -0,0 +1,80 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_ESP32S2_COMMON_HAL_WIFI_RADIO_H
+#define MICROPY_INCLUDED_ESP32S2_COMMON_HAL_WIFI_RADIO_H
+
+#include "py/obj.h"
+
+#include "esp_event.h"
+#include "esp_netif.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "lwip/api.h"
+#include "sdkconfig.h"
+
+// Event group bits
+#define WIFI_CONNECTED_BIT BIT0
+#define WIFI_DISCONNECTED_BIT BIT1
+
+// lwIP can't allocate more netconns than this anyway.
+#define WIFI_SOCKET_COUNT (CONFIG_LWIP_MAX_SOCKETS)
+
+typedef struct {
+    struct netconn *conn;
+    // TCP data handed over by lwIP that hasn't been read yet. It is copied
+    // straight out of the pbuf chain into the caller's buffer, and the TCP
+    // window is only reopened once the whole chain has been consumed.
+    struct pbuf *rx_pbuf;
+    u16_t rx_offset;
+    bool rx_closed;
+    // Updated from the lwIP task by the netconn callback, like the fields of
+    // the same names in lwIP's own socket layer.
+    volatile s16_t rcvevent;
+    volatile u8_t sendevent;
+    volatile u8_t errevent;
+} wifi_socket_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    esp_netif_t *netif;
+    esp_netif_t *ap_netif;
+    esp_event_handler_instance_t handler_instance_all_wifi;
+    esp_event_handler_instance_t handler_instance_got_ip;
+    EventGroupHandle_t event_group_handle;
+    StaticEventGroup_t event_group;
+    uint8_t retries_left;
+    uint8_t last_disconnect_reason;
+    bool initialized;
+    bool started;
+    bool ap_started;
+    bool connecting;
+    wifi_socket_t sockets[WIFI_SOCKET_COUNT];
+} wifi_radio_obj_t;
+
+void common_hal_wifi_init(wifi_radio_obj_t *self);
+
+#endif // MICROPY_INCLUDED_ESP32S2_COMMON_HAL_WIFI_RADIO_H
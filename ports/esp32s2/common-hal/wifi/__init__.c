@@ -0,0 +1,121 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/wifi/__init__.h"
+#include "shared-bindings/wifi/Radio.h"
+
+#include "py/runtime.h"
+#include "py/mperrno.h"
+
+#include "esp_log.h"
+#include "esp_wifi.h"
+
+static const char* TAG = "wifi";
+
+// The radio's state doesn't live on the heap so that the driver can keep
+// referencing it across VM resets.
+wifi_radio_obj_t common_hal_wifi_radio_obj = {
+    .base = { .type = (mp_obj_type_t*)&wifi_radio_type },
+};
+
+STATIC void event_handler(void* arg, esp_event_base_t event_base,
+                          int32_t event_id, void* event_data) {
+    wifi_radio_obj_t* radio = arg;
+    if (event_base == WIFI_EVENT) {
+        switch (event_id) {
+            case WIFI_EVENT_STA_DISCONNECTED: {
+                wifi_event_sta_disconnected_t* d = (wifi_event_sta_disconnected_t*) event_data;
+                radio->last_disconnect_reason = d->reason;
+                ESP_LOGW(TAG, "disconnected, reason %d", d->reason);
+                // A wrong password won't get any better by retrying.
+                if (radio->connecting && radio->retries_left > 0 &&
+                    d->reason != WIFI_REASON_AUTH_FAIL &&
+                    d->reason != WIFI_REASON_HANDSHAKE_TIMEOUT &&
+                    d->reason != WIFI_REASON_4WAY_HANDSHAKE_TIMEOUT) {
+                    radio->retries_left--;
+                    esp_wifi_connect();
+                    return;
+                }
+                radio->connecting = false;
+                xEventGroupClearBits(radio->event_group_handle, WIFI_CONNECTED_BIT);
+                xEventGroupSetBits(radio->event_group_handle, WIFI_DISCONNECTED_BIT);
+                break;
+            }
+            case WIFI_EVENT_STA_STOP:
+                xEventGroupClearBits(radio->event_group_handle, WIFI_CONNECTED_BIT);
+                break;
+            default:
+                break;
+        }
+    } else if (event_base == IP_EVENT && event_id == IP_EVENT_STA_GOT_IP) {
+        radio->connecting = false;
+        xEventGroupClearBits(radio->event_group_handle, WIFI_DISCONNECTED_BIT);
+        xEventGroupSetBits(radio->event_group_handle, WIFI_CONNECTED_BIT);
+    }
+}
+
+// Brings up the netif layer and the driver the first time the radio is used,
+// rather than at boot, so boards that never touch wifi don't pay its RAM.
+void common_hal_wifi_init(wifi_radio_obj_t *self) {
+    if (self->initialized) {
+        return;
+    }
+    ESP_ERROR_CHECK(esp_netif_init());
+    ESP_ERROR_CHECK(esp_event_loop_create_default());
+    self->netif = esp_netif_create_default_wifi_sta();
+    self->ap_netif = esp_netif_create_default_wifi_ap();
+    self->event_group_handle = xEventGroupCreateStatic(&self->event_group);
+
+    ESP_ERROR_CHECK(esp_event_handler_instance_register(WIFI_EVENT,
+                                                        ESP_EVENT_ANY_ID,
+                                                        &event_handler,
+                                                        self,
+                                                        &self->handler_instance_all_wifi));
+    ESP_ERROR_CHECK(esp_event_handler_instance_register(IP_EVENT,
+                                                        IP_EVENT_STA_GOT_IP,
+                                                        &event_handler,
+                                                        self,
+                                                        &self->handler_instance_got_ip));
+
+    wifi_init_config_t config = WIFI_INIT_CONFIG_DEFAULT();
+    esp_err_t result = esp_wifi_init(&config);
+    if (result == ESP_ERR_NO_MEM) {
+        mp_raise_OSError(MP_ENOMEM);
+    } else if (result != ESP_OK) {
+        mp_raise_OSError(MP_EIO);
+    }
+    // Credentials come from code.py each time, so keep them out of flash.
+    esp_wifi_set_storage(WIFI_STORAGE_RAM);
+    self->initialized = true;
+}
+
+void wifi_reset(void) {
+    wifi_radio_obj_t* radio = &common_hal_wifi_radio_obj;
+    if (!radio->initialized) {
+        return;
+    }
+    common_hal_wifi_radio_set_enabled(radio, false);
+}
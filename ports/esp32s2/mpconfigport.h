@@ -34,6 +34,14 @@
 #define MICROPY_PY_UJSON            (0)
 #define MICROPY_USE_INTERNAL_PRINTF      (0)
 
+// hashlib runs on the SHA accelerator, see mphalport.c
+#define MICROPY_PY_UHASHLIB                 (1)
+#define MICROPY_PY_UHASHLIB_SHA1            (1)
+#define MICROPY_PY_UHASHLIB_SHA256_HW       (1)
+#define MICROPY_PY_UHASHLIB_SHA1_HW         (1)
+
+#include "sdkconfig.h"
+
 #include "py/circuitpy_mpconfig.h"
 
 
@@ -42,5 +50,29 @@
 #define MICROPY_NLR_SETJMP                  (1)
 #define CIRCUITPY_DEFAULT_STACK_SIZE        0x6000
 
+// Modules with PSRAM add it to the heap as a second area. Large buffers are
+// placed there first, while small objects stay in the faster internal SRAM.
+#ifdef CONFIG_SPIRAM
+#define MICROPY_GC_SPLIT_HEAP               (1)
+#endif
+
+// The LX7 core uses the windowed ABI, so @native and @micropython.viper code
+// goes through the Xtensa-Windowed emitter rather than the Thumb one.
+#undef MICROPY_EMIT_INLINE_THUMB
+#undef MICROPY_EMIT_THUMB
+#define MICROPY_EMIT_INLINE_THUMB           (0)
+#define MICROPY_EMIT_THUMB                  (0)
+#define MICROPY_EMIT_XTENSAWIN              (CIRCUITPY_ENABLE_MPY_NATIVE)
+
+// Native code is emitted into the GC heap, which sits in internal SRAM, and is
+// run through the instruction bus alias of that same memory.
+#undef MICROPY_MAKE_POINTER_CALLABLE
+#define MICROPY_MAKE_POINTER_CALLABLE(p) esp_native_code_callable(p)
+void *esp_native_code_callable(const void *p);
+
+// Only internal SRAM is executable, so native code is allocated long lived,
+// which keeps it out of the PSRAM area of the heap.
+#define MP_PLAT_ALLOC_EXEC(min_size, ptr, size) do { *ptr = m_new_ll(byte, min_size); *size = min_size; } while (0)
+
 
 #endif  // __INCLUDED_ESP32S2_MPCONFIGPORT_H
@@ -30,8 +30,21 @@ CIRCUITPY_ROTARYIO = 0
 CIRCUITPY_RTC = 0
 CIRCUITPY_TOUCHIO = 0
 
+# Wifi and sockets on ESP-IDF's lwIP
+CIRCUITPY_NETWORK = 1
+CIRCUITPY_WIFI = 1
+
 # Enable USB support
 CIRCUITPY_USB_HID = 1
 CIRCUITPY_USB_MIDI = 1
 
+# @native and @micropython.viper via the Xtensa-Windowed emitter
+CIRCUITPY_ENABLE_MPY_NATIVE = 1
+
+# _thread on FreeRTOS tasks
+CIRCUITPY_THREAD = 1
+
+# ULP-RISC-V coprocessor programs
+CIRCUITPY_ESPULP = 1
+
 CIRCUITPY_MODULE ?= none
@@ -32,6 +32,7 @@
 #include "py/gc.h"
 
 #include "esp-idf/components/xtensa/include/esp_debug_helpers.h"
+#include "esp-idf/components/soc/include/soc/soc_memory_layout.h"
 
 void mp_hal_delay_us(mp_uint_t delay) {
     mp_hal_delay_ms(delay / 1000);
@@ -58,3 +59,58 @@ mp_uint_t cpu_get_regs_and_sp(mp_uint_t *regs, uint8_t reg_count) {
     xthal_window_spill();
     return (mp_uint_t) __builtin_frame_address(0);
 }
+
+void *esp_native_code_callable(const void *p) {
+    // Internal SRAM is mapped onto both the data and instruction buses. The
+    // heap lives on the data side so translate to where the CPU can fetch
+    // instructions from it.
+    if (esp_ptr_in_diram_dram(p)) {
+        return esp_ptr_diram_dram_to_iram(p);
+    }
+    return (void*) p;
+}
+
+#if MICROPY_PY_UHASHLIB_SHA256_HW || MICROPY_PY_UHASHLIB_SHA1_HW
+// ESP-IDF's mbedtls runs SHA on the accelerator (CONFIG_MBEDTLS_HARDWARE_SHA).
+// It takes the engine for each update and keeps the state in the context, and
+// falls back to software while another context is using the engine.
+#include "extmod/moduhashlib.h"
+#include "mbedtls/sha1.h"
+#include "mbedtls/sha256.h"
+#endif
+
+#if MICROPY_PY_UHASHLIB_SHA256_HW
+const size_t mp_hal_sha256_context_size = sizeof(mbedtls_sha256_context);
+
+void mp_hal_sha256_init(void *ctx) {
+    mbedtls_sha256_init(ctx);
+    mbedtls_sha256_starts_ret(ctx, 0);
+}
+
+void mp_hal_sha256_update(void *ctx, const uint8_t *data, size_t len) {
+    mbedtls_sha256_update_ret(ctx, data, len);
+}
+
+void mp_hal_sha256_final(void *ctx, uint8_t *digest) {
+    mbedtls_sha256_finish_ret(ctx, digest);
+    mbedtls_sha256_free(ctx);
+}
+#endif
+
+#if MICROPY_PY_UHASHLIB_SHA1_HW
+const size_t mp_hal_sha1_context_size = sizeof(mbedtls_sha1_context);
+
+void mp_hal_sha1_init(void *ctx) {
+    mbedtls_sha1_init(ctx);
+    mbedtls_sha1_starts_ret(ctx);
+}
+
+void mp_hal_sha1_update(void *ctx, const uint8_t *data, size_t len) {
+    mbedtls_sha1_update_ret(ctx, data, len);
+}
+
+void mp_hal_sha1_final(void *ctx, uint8_t *digest) {
+    mbedtls_sha1_finish_ret(ctx, digest);
+    mbedtls_sha1_free(ctx);
+}
+#endif
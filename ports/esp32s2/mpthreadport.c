@@ -0,0 +1,192 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2017 Damien P. George on behalf of Pycom Ltd
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/runtime.h"
+#include "py/gc.h"
+#include "py/mperrno.h"
+#include "py/mpthread.h"
+#include "supervisor/port.h"
+
+#include "freertos/task.h"
+
+#if MICROPY_PY_THREAD
+
+#define MP_THREAD_MIN_STACK_SIZE (4 * 1024)
+#define MP_THREAD_DEFAULT_STACK_SIZE (MP_THREAD_MIN_STACK_SIZE + 1024)
+
+// Slot 0 of the thread local storage belongs to the IDF's pthread component.
+#define MP_THREAD_TLS_INDEX (1)
+
+// this structure forms a linked list, one node per active thread
+typedef struct _thread_t {
+    TaskHandle_t id;        // FreeRTOS task handle
+    int ready;              // whether the thread is ready and running
+    void *(*entry)(void*);  // entry point of the thread
+    void *arg;              // thread Python args, a GC root pointer
+    void *stack;            // pointer to the stack
+    size_t stack_len;       // number of words in the stack
+    struct _thread_t *next;
+} thread_t;
+
+// the mutex controls access to the linked list
+STATIC mp_thread_mutex_t thread_mutex;
+STATIC thread_t thread_entry0;
+STATIC thread_t *thread = NULL; // root pointer, handled by mp_thread_gc_others
+
+void mp_thread_init(void) {
+    mp_thread_set_state(&mp_state_ctx.thread);
+    // create the first entry in the linked list of all threads, for the main task
+    thread_entry0.id = xTaskGetCurrentTaskHandle();
+    thread_entry0.ready = 1;
+    thread_entry0.entry = NULL;
+    thread_entry0.arg = NULL;
+    thread_entry0.stack = port_stack_get_limit();
+    thread_entry0.stack_len = port_stack_get_top() - port_stack_get_limit();
+    thread_entry0.next = NULL;
+    mp_thread_mutex_init(&thread_mutex);
+    thread = &thread_entry0;
+}
+
+void mp_thread_gc_others(void) {
+    mp_thread_mutex_lock(&thread_mutex, 1);
+    for (thread_t *th = thread; th != NULL; th = th->next) {
+        gc_collect_root((void**)&th, 1);
+        gc_collect_root(&th->arg, 1); // probably not needed
+        if (th->id == xTaskGetCurrentTaskHandle()) {
+            continue;
+        }
+        if (!th->ready) {
+            continue;
+        }
+        gc_collect_root(th->stack, th->stack_len);
+    }
+    mp_thread_mutex_unlock(&thread_mutex);
+}
+
+mp_state_thread_t *mp_thread_get_state(void) {
+    return pvTaskGetThreadLocalStoragePointer(NULL, MP_THREAD_TLS_INDEX);
+}
+
+void mp_thread_set_state(void *state) {
+    vTaskSetThreadLocalStoragePointer(NULL, MP_THREAD_TLS_INDEX, state);
+}
+
+void mp_thread_start(void) {
+    mp_thread_mutex_lock(&thread_mutex, 1);
+    for (thread_t *th = thread; th != NULL; th = th->next) {
+        if (th->id == xTaskGetCurrentTaskHandle()) {
+            th->ready = 1;
+            break;
+        }
+    }
+    mp_thread_mutex_unlock(&thread_mutex);
+}
+
+STATIC void freertos_entry(void *arg) {
+    thread_t *th = arg;
+    th->entry(th->arg);
+    vTaskDelete(NULL);
+    for (;;) {
+    }
+}
+
+void mp_thread_create(void *(*entry)(void*), void *arg, size_t *stack_size) {
+    if (*stack_size == 0) {
+        *stack_size = MP_THREAD_DEFAULT_STACK_SIZE; // default stack size
+    } else if (*stack_size < MP_THREAD_MIN_STACK_SIZE) {
+        *stack_size = MP_THREAD_MIN_STACK_SIZE; // minimum stack size
+    }
+
+    // allocate the linked-list node (must be outside thread_mutex lock)
+    thread_t *th = m_new_obj(thread_t);
+    th->ready = 0;
+    th->entry = entry;
+    th->arg = arg;
+
+    mp_thread_mutex_lock(&thread_mutex, 1);
+
+    // create the thread at the same priority as the main task, so they share the CPU
+    BaseType_t result = xTaskCreate(freertos_entry, "mp_thread", *stack_size / sizeof(StackType_t),
+        th, uxTaskPriorityGet(NULL), &th->id);
+    if (result != pdPASS) {
+        mp_thread_mutex_unlock(&thread_mutex);
+        mp_raise_OSError(MP_ENOMEM);
+    }
+
+    // add thread to linked list of all threads
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wcast-align"
+    th->stack = pxTaskGetStackStart(th->id);
+    #pragma GCC diagnostic pop
+    th->stack_len = *stack_size / sizeof(uintptr_t);
+    th->next = thread;
+    thread = th;
+
+    // adjust the stack_size to provide room to recover from hitting the limit
+    *stack_size -= 1024;
+
+    mp_thread_mutex_unlock(&thread_mutex);
+}
+
+void mp_thread_finish(void) {
+    // The thread won't touch the heap again, so drop it from the list and
+    // let the GC reclaim its node.
+    mp_thread_mutex_lock(&thread_mutex, 1);
+    for (thread_t **th = &thread; *th != NULL; th = &(*th)->next) {
+        if ((*th)->id == xTaskGetCurrentTaskHandle()) {
+            *th = (*th)->next;
+            break;
+        }
+    }
+    mp_thread_mutex_unlock(&thread_mutex);
+}
+
+// Stops every thread but the main one, before its heap goes away.  The main
+// task holds the GIL here, so the others are blocked on it or on I/O.
+void mp_thread_deinit(void) {
+    mp_thread_mutex_lock(&thread_mutex, 1);
+    for (thread_t *th = thread; th != NULL; th = th->next) {
+        if (th != &thread_entry0) {
+            vTaskDelete(th->id);
+        }
+    }
+    thread = &thread_entry0;
+    mp_thread_mutex_unlock(&thread_mutex);
+}
+
+void mp_thread_mutex_init(mp_thread_mutex_t *mutex) {
+    mutex->handle = xSemaphoreCreateMutexStatic(&mutex->buffer);
+}
+
+int mp_thread_mutex_lock(mp_thread_mutex_t *mutex, int wait) {
+    return pdTRUE == xSemaphoreTake(mutex->handle, wait ? portMAX_DELAY : 0);
+}
+
+void mp_thread_mutex_unlock(mp_thread_mutex_t *mutex) {
+    xSemaphoreGive(mutex->handle);
+}
+
+#endif // MICROPY_PY_THREAD
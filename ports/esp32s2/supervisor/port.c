@@ -35,11 +35,27 @@
 #include "freertos/task.h"
 
 #include "common-hal/microcontroller/Pin.h"
+#if CIRCUITPY_WIFI
+#include "shared-bindings/wifi/__init__.h"
+#endif
+
+#if CIRCUITPY_ESPULP
+#include "bindings/espulp/ULP.h"
+#endif
+#include "py/mpstate.h"
+#include "py/mpthread.h"
 #include "supervisor/memory.h"
+#include "supervisor/shared/perf.h"
 #include "supervisor/shared/tick.h"
 
 #include "esp_log.h"
 
+#ifdef CONFIG_SPIRAM
+#include "esp32s2/spiram.h"
+#include "soc/soc.h"
+#include "xtensa/hal.h"
+#endif
+
 static const char* TAG = "CircuitPython";
 
 STATIC esp_timer_handle_t _tick_timer;
@@ -66,6 +82,14 @@ safe_mode_t port_init(void) {
 void reset_port(void) {
 
     reset_all_pins();
+
+#if CIRCUITPY_WIFI
+    wifi_reset();
+#endif
+
+#if CIRCUITPY_ESPULP
+    espulp_reset();
+#endif
 }
 
 void reset_to_bootloader(void) {
@@ -84,6 +108,23 @@ uint32_t *port_heap_get_top(void) {
     return heap + sizeof(heap) / sizeof(heap[0]);
 }
 
+#if MICROPY_GC_SPLIT_HEAP
+bool port_heap_get_extra(uint32_t **bottom, uint32_t **top) {
+    // PSRAM is mapped in but not handed to the IDF heap (SPIRAM_USE_MEMMAP),
+    // so all of it can go to the Python heap.
+    size_t size = esp_spiram_get_size();
+    if (size > SOC_EXTRAM_DATA_HIGH - SOC_EXTRAM_DATA_LOW) {
+        size = SOC_EXTRAM_DATA_HIGH - SOC_EXTRAM_DATA_LOW;
+    }
+    if (size == 0) {
+        return false;
+    }
+    *bottom = (uint32_t*) SOC_EXTRAM_DATA_LOW;
+    *top = (uint32_t*) (SOC_EXTRAM_DATA_LOW + size);
+    return true;
+}
+#endif
+
 uint32_t *port_stack_get_limit(void) {
     #pragma GCC diagnostic push
     #pragma GCC diagnostic ignored "-Wcast-align"
@@ -126,6 +167,12 @@ uint64_t port_get_raw_ticks(uint8_t* subticks) {
     return (uint64_t)tv_now.tv_sec * 1024L + all_subticks / 32;
 }
 
+#if CIRCUITPY_PERF_COUNTERS
+uint32_t port_get_cycle_count(void) {
+    return xthal_get_ccount();
+}
+#endif
+
 // Enable 1/1024 second tick.
 void port_enable_tick(void) {
     esp_err_t result = esp_timer_start_periodic(_tick_timer, 1000000 / 1024);
@@ -156,7 +203,23 @@ void port_sleep_until_interrupt(void) {
     if (sleep_time_duration == 0) {
         return;
     }
+    #if MICROPY_PY_THREAD_GIL && MICROPY_PY_THREAD_GIL_RELEASE_IO
+    // Let other threads run while this one sleeps. Take a copy of the wake up
+    // time first because they may set their own. There is no GIL to release
+    // until the first VM has started.
+    TickType_t wake_from = sleep_time_set;
+    TickType_t duration = sleep_time_duration;
+    bool release_gil = MP_STATE_VM(gil_mutex).handle != NULL;
+    if (release_gil) {
+        MP_THREAD_GIL_EXIT();
+    }
+    vTaskDelayUntil(&wake_from, duration);
+    if (release_gil) {
+        MP_THREAD_GIL_ENTER();
+    }
+    #else
     vTaskDelayUntil(&sleep_time_set, sleep_time_duration);
+    #endif
 }
 
 
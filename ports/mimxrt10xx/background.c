@@ -28,6 +28,7 @@
 
 //#include "audio_dma.h"
 #include "supervisor/filesystem.h"
+#include "supervisor/shared/background_tasks.h"
 #include "supervisor/shared/tick.h"
 #include "supervisor/usb.h"
 
@@ -40,42 +41,48 @@
 #include "shared-module/displayio/__init__.h"
 #endif
 
-volatile uint64_t last_finished_tick = 0;
-
 bool stack_ok_so_far = true;
 
-static bool running_background_tasks = false;
-
-void background_tasks_reset(void) {
-    running_background_tasks = false;
-}
+#if CIRCUITPY_AUDIOIO || CIRCUITPY_AUDIOBUSIO
+STATIC background_task_t audio_dma_task = BACKGROUND_TASK(audio_dma_background, BACKGROUND_TASK_PRIORITY_AUDIO, 1);
+#endif
+STATIC background_task_t usb_task = BACKGROUND_TASK(usb_background, BACKGROUND_TASK_PRIORITY_USB, 1);
+#if CIRCUITPY_NETWORK
+STATIC background_task_t network_task = BACKGROUND_TASK(network_module_background, BACKGROUND_TASK_PRIORITY_NETWORK, 8);
+#endif
+STATIC background_task_t filesystem_task = BACKGROUND_TASK(filesystem_background, BACKGROUND_TASK_PRIORITY_FILESYSTEM, 16);
+#if CIRCUITPY_DISPLAYIO
+STATIC background_task_t displayio_task = BACKGROUND_TASK(displayio_background, BACKGROUND_TASK_PRIORITY_DISPLAY, 16);
+#endif
 
-void PLACE_IN_ITCM(run_background_tasks)(void) {
-    // Don't call ourselves recursively.
-    if (running_background_tasks) {
-        return;
-    }
-    assert_heap_ok();
-    running_background_tasks = true;
+STATIC bool tasks_registered = false;
 
+STATIC void register_background_tasks(void) {
     #if CIRCUITPY_AUDIOIO || CIRCUITPY_AUDIOBUSIO
-    audio_dma_background();
+    supervisor_background_task_register(&audio_dma_task);
     #endif
+    supervisor_background_task_register(&usb_task);
+    #if CIRCUITPY_NETWORK
+    supervisor_background_task_register(&network_task);
+    #endif
+    supervisor_background_task_register(&filesystem_task);
     #if CIRCUITPY_DISPLAYIO
-    displayio_background();
+    supervisor_background_task_register(&displayio_task);
     #endif
+    tasks_registered = true;
+}
 
-    #if CIRCUITPY_NETWORK
-    network_module_background();
-    #endif
-    filesystem_background();
-    usb_background();
-    running_background_tasks = false;
-    assert_heap_ok();
+void background_tasks_reset(void) {
+    supervisor_background_tasks_reset();
+}
 
-    last_finished_tick = supervisor_ticks_ms64();
+void PLACE_IN_ITCM(run_background_tasks)(void) {
+    if (!tasks_registered) {
+        register_background_tasks();
+    }
+    supervisor_background_tasks_run();
 }
 
 bool background_tasks_ok(void) {
-    return supervisor_ticks_ms64() - last_finished_tick < 1000;
+    return supervisor_background_tasks_ok();
 }
@@ -213,6 +213,14 @@ uint16_t common_hal_pulseio_pulsein_popleft(pulseio_pulsein_obj_t* self) {
     return 0;
 }
 
+uint16_t common_hal_pulseio_pulsein_readinto(pulseio_pulsein_obj_t* self, uint16_t* buffer, uint16_t len) {
+    return 0;
+}
+
+uint32_t common_hal_pulseio_pulsein_get_dropped(pulseio_pulsein_obj_t* self) {
+    return 0;
+}
+
 uint16_t common_hal_pulseio_pulsein_get_maxlen(pulseio_pulsein_obj_t* self) {
 //    return self->maxlen;
     return 0;
@@ -205,3 +205,8 @@ void common_hal_pulseio_pulseout_send(pulseio_pulseout_obj_t* self, uint16_t* pu
 //    tc_disable_interrupts(pulseout_tc_index);
 //    active_pincfg = NULL;
 }
+
+bool common_hal_pulseio_pulseout_get_busy(pulseio_pulseout_obj_t* self) {
+    // send waits until the pulses are out.
+    return false;
+}
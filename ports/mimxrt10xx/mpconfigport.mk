@@ -20,6 +20,9 @@ USB_MSC_MAX_PACKET_SIZE = 512
 
 INTERNAL_FLASH_FILESYSTEM = 1
 
+# Run the call path, lookups and GC from ITCM instead of FlexSPI flash
+CIRCUITPY_ITCM_HOT_PATHS ?= 1
+
 CIRCUITPY_AUDIOIO = 0
 CIRCUITPY_AUDIOBUSIO = 0
 CIRCUITPY_FREQUENCYIO = 0
@@ -26,6 +26,7 @@
 
 #include "py/runtime.h"
 #include "supervisor/filesystem.h"
+#include "supervisor/shared/background_tasks.h"
 #include "supervisor/usb.h"
 #include "supervisor/shared/stack.h"
 
@@ -35,6 +36,7 @@
 
 #if CIRCUITPY_AUDIOBUSIO
 #include "common-hal/audiobusio/I2SOut.h"
+#include "common-hal/audiobusio/PDMIn.h"
 #endif
 
 #if CIRCUITPY_AUDIOPWMIO
@@ -46,36 +48,52 @@
 #include "common-hal/_bleio/bonding.h"
 #endif
 
-static bool running_background_tasks = false;
-
-void background_tasks_reset(void) {
-    running_background_tasks = false;
-}
-
-void run_background_tasks(void) {
-    // Don't call ourselves recursively.
-    if (running_background_tasks) {
-        return;
-    }
-    running_background_tasks = true;
-    filesystem_background();
-    usb_background();
+STATIC background_task_t usb_task = BACKGROUND_TASK(usb_background, BACKGROUND_TASK_PRIORITY_USB, 1);
 #if CIRCUITPY_AUDIOPWMIO
-    audiopwmout_background();
+STATIC background_task_t audiopwmout_task = BACKGROUND_TASK(audiopwmout_background, BACKGROUND_TASK_PRIORITY_AUDIO, 1);
 #endif
 #if CIRCUITPY_AUDIOBUSIO
-    i2s_background();
+STATIC background_task_t i2s_task = BACKGROUND_TASK(i2s_background, BACKGROUND_TASK_PRIORITY_AUDIO, 1);
+STATIC background_task_t pdmin_task = BACKGROUND_TASK(pdmin_background, BACKGROUND_TASK_PRIORITY_AUDIO, 1);
 #endif
-
 #if CIRCUITPY_BLEIO
-    supervisor_bluetooth_background();
-    bonding_background();
+STATIC background_task_t bluetooth_task = BACKGROUND_TASK(supervisor_bluetooth_background, BACKGROUND_TASK_PRIORITY_BLE, 4);
+STATIC background_task_t bonding_task = BACKGROUND_TASK(bonding_background, BACKGROUND_TASK_PRIORITY_BLE, 4);
 #endif
+STATIC background_task_t filesystem_task = BACKGROUND_TASK(filesystem_background, BACKGROUND_TASK_PRIORITY_FILESYSTEM, 16);
+#if CIRCUITPY_DISPLAYIO
+STATIC background_task_t displayio_task = BACKGROUND_TASK(displayio_background, BACKGROUND_TASK_PRIORITY_DISPLAY, 16);
+#endif
+
+STATIC bool tasks_registered = false;
 
+STATIC void register_background_tasks(void) {
+    supervisor_background_task_register(&usb_task);
+    #if CIRCUITPY_AUDIOPWMIO
+    supervisor_background_task_register(&audiopwmout_task);
+    #endif
+    #if CIRCUITPY_AUDIOBUSIO
+    supervisor_background_task_register(&i2s_task);
+    supervisor_background_task_register(&pdmin_task);
+    #endif
+    #if CIRCUITPY_BLEIO
+    supervisor_background_task_register(&bluetooth_task);
+    supervisor_background_task_register(&bonding_task);
+    #endif
+    supervisor_background_task_register(&filesystem_task);
     #if CIRCUITPY_DISPLAYIO
-    displayio_background();
+    supervisor_background_task_register(&displayio_task);
     #endif
-    running_background_tasks = false;
+    tasks_registered = true;
+}
 
-    assert_heap_ok();
+void background_tasks_reset(void) {
+    supervisor_background_tasks_reset();
+}
+
+void run_background_tasks(void) {
+    if (!tasks_registered) {
+        register_background_tasks();
+    }
+    supervisor_background_tasks_run();
 }
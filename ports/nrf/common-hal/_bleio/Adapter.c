@@ -64,6 +64,14 @@
 #define BLEIO_HVN_TX_QUEUE_SIZE 9
 #endif
 
+#ifndef BLEIO_WRITE_CMD_TX_QUEUE_SIZE
+#define BLEIO_WRITE_CMD_TX_QUEUE_SIZE BLE_GATTC_WRITE_CMD_TX_QUEUE_SIZE_DEFAULT
+#endif
+
+#ifndef BLEIO_GAP_EVENT_LENGTH
+#define BLEIO_GAP_EVENT_LENGTH BLE_GAP_EVENT_LENGTH_DEFAULT
+#endif
+
 #ifndef BLEIO_CENTRAL_ROLE_COUNT
 #define BLEIO_CENTRAL_ROLE_COUNT 4
 #endif
@@ -133,8 +141,8 @@ STATIC uint32_t ble_stack_enable(void) {
     // about 9000 bytes when .hvn_tx_queue_size is 10
     ble_conf.conn_cfg.params.gap_conn_cfg.conn_count = BLEIO_TOTAL_CONNECTION_COUNT;
     // Event length here can influence throughput so perhaps make multiple connection profiles
-    // available.
-    ble_conf.conn_cfg.params.gap_conn_cfg.event_length = BLE_GAP_EVENT_LENGTH_DEFAULT;
+    // available. Boards with RAM to spare for the SD can raise BLEIO_GAP_EVENT_LENGTH.
+    ble_conf.conn_cfg.params.gap_conn_cfg.event_length = BLEIO_GAP_EVENT_LENGTH;
     err_code = sd_ble_cfg_set(BLE_CONN_CFG_GAP, &ble_conf, app_ram_start);
     if (err_code != NRF_SUCCESS) {
         return err_code;
@@ -163,6 +171,18 @@ STATIC uint32_t ble_stack_enable(void) {
         return err_code;
     }
 
+    #if BLEIO_WRITE_CMD_TX_QUEUE_SIZE != BLE_GATTC_WRITE_CMD_TX_QUEUE_SIZE_DEFAULT
+    // Writes without response queued by a PacketBuffer acting as a client. Like
+    // hvn_tx_queue_size, each increment costs a full ATT_MTU buffer of SD RAM.
+    memset(&ble_conf, 0, sizeof(ble_conf));
+    ble_conf.conn_cfg.conn_cfg_tag = BLE_CONN_CFG_TAG_CUSTOM;
+    ble_conf.conn_cfg.params.gattc_conn_cfg.write_cmd_tx_queue_size = BLEIO_WRITE_CMD_TX_QUEUE_SIZE;
+    err_code = sd_ble_cfg_set(BLE_CONN_CFG_GATTC, &ble_conf, app_ram_start);
+    if (err_code != NRF_SUCCESS) {
+        return err_code;
+    }
+    #endif
+
     // Set ATT_MTU so that the maximum MTU we can negotiate is up to the full characteristic size.
     memset(&ble_conf, 0, sizeof(ble_conf));
     ble_conf.conn_cfg.conn_cfg_tag = BLE_CONN_CFG_TAG_CUSTOM;
@@ -221,6 +241,17 @@ STATIC uint32_t ble_stack_enable(void) {
    return err_code;
 }
 
+// Ask for the 2M PHY and the longest data length the SD supports, so that each connection event
+// can carry more, larger packets. The peer may refuse, which is fine, so errors are ignored.
+STATIC void request_fast_link(uint16_t conn_handle) {
+    ble_gap_phys_t const phys = {
+        .rx_phys = BLE_GAP_PHY_2MBPS,
+        .tx_phys = BLE_GAP_PHY_2MBPS,
+    };
+    sd_ble_gap_phy_update(conn_handle, &phys);
+    sd_ble_gap_data_length_update(conn_handle, NULL, NULL);
+}
+
 STATIC bool adapter_on_ble_evt(ble_evt_t *ble_evt, void *self_in) {
     bleio_adapter_obj_t *self = (bleio_adapter_obj_t*)self_in;
 
@@ -246,6 +277,12 @@ STATIC bool adapter_on_ble_evt(ble_evt_t *ble_evt, void *self_in) {
             connection->connection_obj = mp_const_none;
             connection->pair_status = PAIR_NOT_PAIRED;
             connection->mtu = 0;
+            // Every connection starts on the 1M PHY with 27 byte link layer packets.
+            connection->max_tx_octets = 27;
+            connection->tx_phy = BLE_GAP_PHY_1MBPS;
+            connection->rx_phy = BLE_GAP_PHY_1MBPS;
+            connection->phy_updating = false;
+            connection->pending_notify_count = 0;
 
             ble_drv_add_event_handler_entry(&connection->handler_entry, connection_on_ble_evt, connection);
             self->connection_objs = NULL;
@@ -266,6 +303,8 @@ STATIC bool adapter_on_ble_evt(ble_evt_t *ble_evt, void *self_in) {
                 conn_params.min_conn_interval > connected->conn_params.max_conn_interval) {
                 sd_ble_gap_conn_param_update(ble_evt->evt.gap_evt.conn_handle, &conn_params);
             }
+            // Don't wait for the central to ask for a faster link.
+            request_fast_link(ble_evt->evt.gap_evt.conn_handle);
             self->current_advertising_data = NULL;
             break;
         }
@@ -437,14 +476,14 @@ STATIC bool scan_on_ble_evt(ble_evt_t *ble_evt, void *scan_results_in) {
     return true;
 }
 
-mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self, uint8_t* prefixes, size_t prefix_length, bool extended, mp_int_t buffer_size, mp_float_t timeout, mp_float_t interval, mp_float_t window, mp_int_t minimum_rssi, bool active) {
+mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self, uint8_t* prefixes, size_t prefix_length, bool extended, mp_int_t buffer_size, mp_float_t timeout, mp_float_t interval, mp_float_t window, mp_int_t minimum_rssi, bool active, uint8_t* addresses, size_t address_count, uint32_t duplicate_window_ms) {
     if (self->scan_results != NULL) {
         if (!shared_module_bleio_scanresults_get_done(self->scan_results)) {
             mp_raise_bleio_BluetoothError(translate("Scan already in progess. Stop with stop_scan."));
         }
         self->scan_results = NULL;
     }
-    self->scan_results = shared_module_bleio_new_scanresults(buffer_size, prefixes, prefix_length, minimum_rssi);
+    self->scan_results = shared_module_bleio_new_scanresults(buffer_size, prefixes, prefix_length, minimum_rssi, addresses, address_count, duplicate_window_ms);
     size_t max_packet_size = extended ? BLE_GAP_SCAN_BUFFER_EXTENDED_MAX_SUPPORTED : BLE_GAP_SCAN_BUFFER_MAX;
     uint8_t *raw_data = m_malloc(sizeof(ble_data_t) + max_packet_size, false);
     ble_data_t * sd_data = (ble_data_t *) raw_data;
@@ -564,13 +603,8 @@ mp_obj_t common_hal_bleio_adapter_connect(bleio_adapter_obj_t *self, bleio_addre
 
     // Negotiate for better PHY, larger MTU and data lengths since we are the central. These are
     // nice-to-haves so ignore any errors.
-    ble_gap_phys_t const phys = {
-        .rx_phys = BLE_GAP_PHY_AUTO,
-        .tx_phys = BLE_GAP_PHY_AUTO,
-    };
-    sd_ble_gap_phy_update(conn_handle, &phys);
+    request_fast_link(conn_handle);
     sd_ble_gattc_exchange_mtu_request(conn_handle, BLE_GATTS_VAR_ATTR_LEN_MAX);
-    sd_ble_gap_data_length_update(conn_handle, NULL, NULL);
 
     // Make the connection object and return it.
     for (size_t i = 0; i < BLEIO_TOTAL_CONNECTION_COUNT; i++) {
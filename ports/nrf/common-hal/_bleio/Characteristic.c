@@ -172,7 +172,9 @@ void common_hal_bleio_characteristic_set_value(bleio_characteristic_obj_t *self,
                 }
 
                 // It's possible that both notify and indicate are set.
-                if (notify && (cccd & BLE_GATT_HVX_NOTIFICATION)) {
+                if (notify && (cccd & BLE_GATT_HVX_NOTIFICATION) &&
+                    !bleio_connection_notify(connection, self->handle, bufinfo->len)) {
+                    // Too many notifications are waiting already, so wait for this one to send.
                     characteristic_gatts_notify_indicate(self->handle, conn_handle, bufinfo, BLE_GATT_HVX_NOTIFICATION);
                 }
                 if (indicate && (cccd & BLE_GATT_HVX_INDICATION)) {
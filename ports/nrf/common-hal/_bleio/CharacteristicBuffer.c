@@ -41,11 +41,9 @@
 #include "common-hal/_bleio/CharacteristicBuffer.h"
 
 // Push all the data onto the ring buffer. When the buffer is full, new bytes will be dropped.
+// The event handler is the only producer, so no critical region is needed.
 STATIC void write_to_ringbuf(bleio_characteristic_buffer_obj_t *self, uint8_t *data, uint16_t len) {
-    uint8_t is_nested_critical_region;
-    sd_nvic_critical_region_enter(&is_nested_critical_region);
     ringbuf_put_n(&self->ringbuf, data, len);
-    sd_nvic_critical_region_exit(is_nested_critical_region);
 }
 
 STATIC bool characteristic_buffer_on_ble_evt(ble_evt_t *ble_evt, void *param) {
@@ -108,32 +106,17 @@ uint32_t common_hal_bleio_characteristic_buffer_read(bleio_characteristic_buffer
         }
     }
 
-    // Copy received data. Lock out write interrupt handler while copying.
-    uint8_t is_nested_critical_region;
-    sd_nvic_critical_region_enter(&is_nested_critical_region);
-
-    uint32_t num_bytes_read = ringbuf_get_n(&self->ringbuf, data, len);
-
-    // Writes now OK.
-    sd_nvic_critical_region_exit(is_nested_critical_region);
-
-    return num_bytes_read;
+    // Copy received data. The ring buffer is safe to read while the event
+    // handler writes to it.
+    return ringbuf_get_n(&self->ringbuf, data, len);
 }
 
 uint32_t common_hal_bleio_characteristic_buffer_rx_characters_available(bleio_characteristic_buffer_obj_t *self) {
-    uint8_t is_nested_critical_region;
-    sd_nvic_critical_region_enter(&is_nested_critical_region);
-    uint16_t count = ringbuf_num_filled(&self->ringbuf);
-    sd_nvic_critical_region_exit(is_nested_critical_region);
-    return count;
+    return ringbuf_num_filled(&self->ringbuf);
 }
 
 void common_hal_bleio_characteristic_buffer_clear_rx_buffer(bleio_characteristic_buffer_obj_t *self) {
-    // prevent conflict with uart irq
-    uint8_t is_nested_critical_region;
-    sd_nvic_critical_region_enter(&is_nested_critical_region);
     ringbuf_clear(&self->ringbuf);
-    sd_nvic_critical_region_exit(is_nested_critical_region);
 }
 
 bool common_hal_bleio_characteristic_buffer_deinited(bleio_characteristic_buffer_obj_t *self) {
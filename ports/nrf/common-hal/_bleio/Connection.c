@@ -33,6 +33,7 @@
 #include "ble.h"
 #include "ble_drv.h"
 #include "ble_hci.h"
+#include "nrf_nvic.h"
 #include "nrf_soc.h"
 #include "lib/utils/interrupt_char.h"
 #include "py/gc.h"
@@ -80,6 +81,67 @@ static volatile bool m_discovery_successful;
 static bleio_service_obj_t *m_char_discovery_service;
 static bleio_characteristic_obj_t *m_desc_discovery_characteristic;
 
+STATIC uint32_t connection_notify_now(bleio_connection_internal_t *self, uint16_t handle, uint16_t len) {
+    // NULL data sends the current attribute value, which is always the latest one set.
+    ble_gatts_hvx_params_t hvx_params = {
+        .handle = handle,
+        .type = BLE_GATT_HVX_NOTIFICATION,
+        .offset = 0,
+        .p_len = &len,
+        .p_data = NULL,
+    };
+    return sd_ble_gatts_hvx(self->conn_handle, &hvx_params);
+}
+
+// Called when the SD's TX queue has room again. Sends pending notifications in the order they
+// were first queued.
+STATIC void connection_flush_notifications(bleio_connection_internal_t *self) {
+    size_t sent = 0;
+    while (sent < self->pending_notify_count) {
+        uint32_t err_code = connection_notify_now(self, self->pending_notify_handles[sent], self->pending_notify_lens[sent]);
+        if (err_code == NRF_ERROR_RESOURCES) {
+            break;
+        }
+        // Anything else, such as the peer having disabled notifications, drops the notification.
+        sent++;
+    }
+    self->pending_notify_count -= sent;
+    memmove(self->pending_notify_handles, self->pending_notify_handles + sent, self->pending_notify_count * sizeof(uint16_t));
+    memmove(self->pending_notify_lens, self->pending_notify_lens + sent, self->pending_notify_count * sizeof(uint16_t));
+}
+
+// Notify the peer of a local characteristic's value, which must already be in the attribute
+// table. If the SD's TX queue is full, the notification is queued and sent when there is room;
+// if one is already queued for the handle it will carry the new value, so nothing more is
+// needed. Returns false if the notification could be neither sent nor queued.
+bool bleio_connection_notify(bleio_connection_internal_t *self, uint16_t handle, uint16_t len) {
+    bool ok = true;
+    uint8_t is_nested_critical_region;
+    sd_nvic_critical_region_enter(&is_nested_critical_region);
+    size_t i;
+    for (i = 0; i < self->pending_notify_count; i++) {
+        if (self->pending_notify_handles[i] == handle) {
+            self->pending_notify_lens[i] = len;
+            break;
+        }
+    }
+    if (i == self->pending_notify_count) {
+        // Don't overtake notifications that are already waiting.
+        uint32_t err_code = self->pending_notify_count > 0 ? NRF_ERROR_RESOURCES : connection_notify_now(self, handle, len);
+        if (err_code == NRF_ERROR_RESOURCES) {
+            if (self->pending_notify_count < BLEIO_PENDING_NOTIFY_COUNT) {
+                self->pending_notify_handles[self->pending_notify_count] = handle;
+                self->pending_notify_lens[self->pending_notify_count] = len;
+                self->pending_notify_count++;
+            } else {
+                ok = false;
+            }
+        }
+    }
+    sd_nvic_critical_region_exit(is_nested_critical_region);
+    return ok;
+}
+
 bool connection_on_ble_evt(ble_evt_t *ble_evt, void *self_in) {
     bleio_connection_internal_t *self = (bleio_connection_internal_t*)self_in;
 
@@ -107,6 +169,12 @@ bool connection_on_ble_evt(ble_evt_t *ble_evt, void *self_in) {
         }
 
         case BLE_GAP_EVT_PHY_UPDATE: { // 0x22
+            ble_gap_evt_phy_update_t *result = &ble_evt->evt.gap_evt.params.phy_update;
+            if (result->status == BLE_HCI_STATUS_CODE_SUCCESS) {
+                self->tx_phy = result->tx_phy;
+                self->rx_phy = result->rx_phy;
+            }
+            self->phy_updating = false;
             break;
         }
 
@@ -116,6 +184,7 @@ bool connection_on_ble_evt(ble_evt_t *ble_evt, void *self_in) {
             break;
 
         case BLE_GAP_EVT_DATA_LENGTH_UPDATE: { // 0x24
+            self->max_tx_octets = ble_evt->evt.gap_evt.params.data_length_update.effective_params.max_tx_octets;
             break;
         }
 
@@ -202,8 +271,12 @@ bool connection_on_ble_evt(ble_evt_t *ble_evt, void *self_in) {
         }
         #endif
 
-        case BLE_GATTS_EVT_HVN_TX_COMPLETE: // Capture this for now. 0x55
-            break;
+        case BLE_GATTS_EVT_HVN_TX_COMPLETE: // 0x55
+            if (self->pending_notify_count > 0) {
+                connection_flush_notifications(self);
+            }
+            // Return false so PacketBuffers waiting for room in the queue get this event as well.
+            return false;
         case BLE_GAP_EVT_CONN_PARAM_UPDATE_REQUEST: {
             self->conn_params_updating = true;
             ble_gap_evt_conn_param_update_request_t *request =
@@ -377,16 +450,73 @@ mp_int_t common_hal_bleio_connection_get_max_packet_length(bleio_connection_inte
 }
 
 void common_hal_bleio_connection_set_connection_interval(bleio_connection_internal_t *self, mp_float_t new_interval) {
+    common_hal_bleio_connection_update_parameters(self, new_interval, new_interval,
+        common_hal_bleio_connection_get_peripheral_latency(self),
+        common_hal_bleio_connection_get_supervision_timeout(self));
+}
+
+mp_int_t common_hal_bleio_connection_get_peripheral_latency(bleio_connection_internal_t *self) {
+    while (self->conn_params_updating && !mp_hal_is_interrupted()) {
+        RUN_BACKGROUND_TASKS;
+    }
+    return self->conn_params.slave_latency;
+}
+
+mp_float_t common_hal_bleio_connection_get_supervision_timeout(bleio_connection_internal_t *self) {
+    while (self->conn_params_updating && !mp_hal_is_interrupted()) {
+        RUN_BACKGROUND_TASKS;
+    }
+    return 0.01f * self->conn_params.conn_sup_timeout;
+}
+
+// Intervals are in milliseconds and the supervision timeout in seconds. The SD checks that the
+// combination is valid.
+void common_hal_bleio_connection_update_parameters(bleio_connection_internal_t *self, mp_float_t min_interval, mp_float_t max_interval, mp_int_t latency, mp_float_t supervision_timeout) {
+    ble_gap_conn_params_t conn_params = {
+        .min_conn_interval = min_interval / 1.25f,
+        .max_conn_interval = max_interval / 1.25f,
+        .slave_latency = latency,
+        .conn_sup_timeout = supervision_timeout / 0.01f,
+    };
     self->conn_params_updating = true;
-    uint16_t interval = new_interval / 1.25f;
-    self->conn_params.min_conn_interval = interval;
-    self->conn_params.max_conn_interval = interval;
     uint32_t status = NRF_ERROR_BUSY;
     while (status == NRF_ERROR_BUSY) {
-        status = sd_ble_gap_conn_param_update(self->conn_handle, &self->conn_params);
+        status = sd_ble_gap_conn_param_update(self->conn_handle, &conn_params);
         RUN_BACKGROUND_TASKS;
     }
+    if (status != NRF_SUCCESS) {
+        self->conn_params_updating = false;
+    }
     check_nrf_error(status);
+    memcpy(&self->conn_params, &conn_params, sizeof(ble_gap_conn_params_t));
+}
+
+mp_int_t common_hal_bleio_connection_get_phy(bleio_connection_internal_t *self) {
+    while (self->phy_updating && !mp_hal_is_interrupted()) {
+        RUN_BACKGROUND_TASKS;
+    }
+    return self->tx_phy;
+}
+
+void common_hal_bleio_connection_set_phy(bleio_connection_internal_t *self, mp_int_t phy) {
+    ble_gap_phys_t const phys = {
+        .rx_phys = phy,
+        .tx_phys = phy,
+    };
+    self->phy_updating = true;
+    uint32_t status = NRF_ERROR_BUSY;
+    while (status == NRF_ERROR_BUSY) {
+        status = sd_ble_gap_phy_update(self->conn_handle, &phys);
+        RUN_BACKGROUND_TASKS;
+    }
+    if (status != NRF_SUCCESS) {
+        self->phy_updating = false;
+    }
+    check_nrf_error(status);
+}
+
+mp_int_t common_hal_bleio_connection_get_data_length(bleio_connection_internal_t *self) {
+    return self->max_tx_octets;
 }
 
 // service_uuid may be NULL, to discover all services.
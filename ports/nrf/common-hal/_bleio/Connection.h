@@ -40,6 +40,11 @@
 #include "shared-module/_bleio/Address.h"
 #include "common-hal/_bleio/Service.h"
 
+// Number of notifications per connection that can wait for room in the SD's TX queue.
+#ifndef BLEIO_PENDING_NOTIFY_COUNT
+#define BLEIO_PENDING_NOTIFY_COUNT (8)
+#endif
+
 typedef enum {
     PAIR_NOT_PAIRED,
     PAIR_WAITING,
@@ -67,6 +72,16 @@ typedef struct {
     ble_gap_conn_params_t conn_params;
     volatile bool conn_params_updating;
     uint16_t mtu;
+    // Negotiated link layer data length and PHYs (BLE_GAP_PHY_*).
+    uint16_t max_tx_octets;
+    uint8_t tx_phy;
+    uint8_t rx_phy;
+    volatile bool phy_updating;
+    // Characteristic values whose notification didn't fit in the SD's TX queue. Each is sent from
+    // the attribute table once there is room, so updates made meanwhile are coalesced into one.
+    uint16_t pending_notify_handles[BLEIO_PENDING_NOTIFY_COUNT];
+    uint16_t pending_notify_lens[BLEIO_PENDING_NOTIFY_COUNT];
+    volatile uint8_t pending_notify_count;
     // Request that CCCD values for this conenction be saved, using sys_attr values.
     volatile bool do_bond_cccds;
     // Request that security key info for this connection be saved.
@@ -84,6 +99,7 @@ typedef struct {
 } bleio_connection_obj_t;
 
 bool connection_on_ble_evt(ble_evt_t *ble_evt, void *self_in);
+bool bleio_connection_notify(bleio_connection_internal_t *self, uint16_t handle, uint16_t len);
 
 uint16_t bleio_connection_get_conn_handle(bleio_connection_obj_t *self);
 mp_obj_t bleio_connection_new_from_internal(bleio_connection_internal_t* connection);
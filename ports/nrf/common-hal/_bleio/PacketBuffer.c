@@ -32,6 +32,7 @@
 #include "nrf_nvic.h"
 
 #include "lib/utils/interrupt_char.h"
+#include "py/objtuple.h"
 #include "py/runtime.h"
 #include "py/stream.h"
 
@@ -55,19 +56,24 @@ STATIC void write_to_ringbuf(bleio_packet_buffer_obj_t *self, uint8_t *data, uin
         for (uint16_t i = 0; i < packet_length; i++) {
             ringbuf_get(&self->ringbuf);
         }
-        // set an overflow flag?
+        self->packets_dropped++;
     }
     ringbuf_put_n(&self->ringbuf, (uint8_t*) &len, sizeof(uint16_t));
     ringbuf_put_n(&self->ringbuf, data, len);
+    self->packets_received++;
+    self->bytes_received += len;
     sd_nvic_critical_region_exit(is_nested_critical_region);
 }
 
 STATIC uint32_t queue_next_write(bleio_packet_buffer_obj_t *self) {
-    // Queue up the next outgoing buffer. We use two, one that has been passed to the SD for
-    // transmission (when packet_queued is true) and the other is `pending` and can still be
-    // modified. By primarily appending to the `pending` buffer we can reduce the protocol overhead
+    // Queue up the next outgoing buffer. We use two, one that was last passed to the SD for
+    // transmission and the other is `pending` and can still be modified. Notifications and writes
+    // without response are copied into the SD's TX queue, so we hand over a packet whenever there
+    // is one pending, rather than waiting for the previous one to complete, and keep the queue
+    // full so several packets go out per connection event. When the queue is full (or a write
+    // request or indication is still outstanding) the SD refuses the packet and we keep appending
+    // to `pending` until the next complete event retries it, which reduces the protocol overhead
     // of the lower level link and ATT layers.
-    self->packet_queued = false;
     if (self->pending_size > 0) {
         uint16_t conn_handle = self->conn_handle;
         uint32_t err_code;
@@ -97,9 +103,10 @@ STATIC uint32_t queue_next_write(bleio_packet_buffer_obj_t *self) {
             // complete event triggers another attempt.
             return err_code;
         }
+        self->packets_sent++;
+        self->bytes_sent += self->pending_size;
         self->pending_size = 0;
         self->pending_index = (self->pending_index + 1) % 2;
-        self->packet_queued = true;
     }
     return NRF_SUCCESS;
 }
@@ -176,7 +183,10 @@ STATIC bool packet_buffer_on_ble_server_evt(ble_evt_t *ble_evt, void *param) {
                 self->conn_handle = BLE_CONN_HANDLE_INVALID;
             }
         }
-        case BLE_GATTS_EVT_HVN_TX_COMPLETE: {
+        case BLE_GATTS_EVT_HVN_TX_COMPLETE:
+        case BLE_GATTS_EVT_HVC: {
+            // Other PacketBuffers on the connection may also be waiting for room in the SD's
+            // queue, so don't claim the event.
             queue_next_write(self);
         }
         default:
@@ -211,8 +221,13 @@ void common_hal_bleio_packet_buffer_construct(
         }
     }
 
+    self->packets_sent = 0;
+    self->bytes_sent = 0;
+    self->packets_received = 0;
+    self->bytes_received = 0;
+    self->packets_dropped = 0;
+
     if (outgoing) {
-        self->packet_queued = false;
         self->pending_index = 0;
         self->pending_size = 0;
         self->outgoing[0] = m_malloc(characteristic->max_length, false);
@@ -324,12 +339,12 @@ mp_int_t common_hal_bleio_packet_buffer_write(bleio_packet_buffer_obj_t *self, u
     self->pending_size += len;
     num_bytes_written += len;
 
+    // Hand the packet to the SD straight away if its queue has room. If not, it stays pending and
+    // is sent from the next TX complete event.
+    queue_next_write(self);
+
     sd_nvic_critical_region_exit(is_nested_critical_region);
 
-    // If no writes are queued then sneak in this data.
-    if (!self->packet_queued) {
-        queue_next_write(self);
-    }
     return num_bytes_written;
 }
 
@@ -395,6 +410,17 @@ mp_int_t common_hal_bleio_packet_buffer_get_outgoing_packet_length(bleio_packet_
     return self->characteristic->max_length;
 }
 
+mp_obj_tuple_t *common_hal_bleio_packet_buffer_get_statistics(bleio_packet_buffer_obj_t *self) {
+    mp_obj_t items[] = {
+        mp_obj_new_int_from_uint(self->packets_sent),
+        mp_obj_new_int_from_uint(self->bytes_sent),
+        mp_obj_new_int_from_uint(self->packets_received),
+        mp_obj_new_int_from_uint(self->bytes_received),
+        mp_obj_new_int_from_uint(self->packets_dropped),
+    };
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+}
+
 bool common_hal_bleio_packet_buffer_deinited(bleio_packet_buffer_obj_t *self) {
     return self->characteristic == NULL;
 }
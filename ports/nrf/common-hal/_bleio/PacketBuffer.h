@@ -47,7 +47,12 @@ typedef struct {
     uint8_t pending_index;
     uint8_t write_type;
     bool client;
-    bool packet_queued;
+    // Running totals, readable through PacketBuffer.statistics.
+    uint32_t packets_sent;
+    uint32_t bytes_sent;
+    uint32_t packets_received;
+    uint32_t bytes_received;
+    uint32_t packets_dropped;
 } bleio_packet_buffer_obj_t;
 
 #endif // MICROPY_INCLUDED_NRF_COMMON_HAL_BLEIO_PACKETBUFFER_H
@@ -108,6 +108,7 @@ void choose_i2s_clocking(audiobusio_i2sout_obj_t *self, uint32_t sample_rate) {
 }
 
 static void i2s_buffer_fill(audiobusio_i2sout_obj_t* self) {
+    uint64_t noticed = audiocore_stats_now();
     void *buffer = self->buffers[self->next_buffer];
     void *buffer_start = buffer;
     NRF_I2S->TXD.PTR = (uintptr_t)buffer;
@@ -117,9 +118,11 @@ static void i2s_buffer_fill(audiobusio_i2sout_obj_t* self) {
     while (!self->paused && !self->stopping && bytesleft) {
         if (self->sample_data == self->sample_end) {
             uint32_t sample_buffer_length;
+            uint64_t started = audiocore_stats_now();
             audioio_get_buffer_result_t get_buffer_result =
                 audiosample_get_buffer(self->sample, false, 0,
                                        &self->sample_data, &sample_buffer_length);
+            audiocore_stats_got_buffer(&self->stats, started);
             self->sample_end = self->sample_data + sample_buffer_length;
             if (get_buffer_result == GET_BUFFER_DONE) {
                 if (self->loop) {
@@ -184,8 +187,9 @@ static void i2s_buffer_fill(audiobusio_i2sout_obj_t* self) {
         uint32_t *be = (uint32_t*)(buffer + bytesleft);
         for (; bp != be; )
             *bp++ = self->hold_value;
-        return;
     }
+    audiocore_stats_filled(&self->stats, noticed,
+        self->buffer_length / self->bytes_per_sample / self->channel_count);
 }
 
 void common_hal_audiobusio_i2sout_construct(audiobusio_i2sout_obj_t* self,
@@ -212,6 +216,7 @@ void common_hal_audiobusio_i2sout_construct(audiobusio_i2sout_obj_t* self,
     NRF_I2S->CONFIG.ALIGN = I2S_CONFIG_ALIGN_ALIGN_Left;
     NRF_I2S->CONFIG.FORMAT = left_justified ? I2S_CONFIG_FORMAT_FORMAT_Aligned
                                     : I2S_CONFIG_FORMAT_FORMAT_I2S;
+    audiocore_stats_init(&self->stats, 0);
 
     supervisor_enable_tick();
 }
@@ -247,6 +252,8 @@ void common_hal_audiobusio_i2sout_play(audiobusio_i2sout_obj_t* self,
     uint32_t sample_rate = audiosample_sample_rate(sample);
     self->bytes_per_sample = audiosample_bits_per_sample(sample) / 8;
 
+    // I2S is signed, so samples that can produce it are copied without conversion.
+    audiosample_set_output_signed(sample, true);
     uint32_t max_buffer_length;
     bool single_buffer, samples_signed;
     audiosample_get_buffer_structure(sample, /* single channel */ true,
@@ -284,6 +291,7 @@ void common_hal_audiobusio_i2sout_play(audiobusio_i2sout_obj_t* self,
     self->playing = true;
     self->paused = false;
     self->stopping = false;
+    audiocore_stats_init(&self->stats, sample_rate);
     i2s_buffer_fill(self);
 
     NRF_I2S->RXTXD.MAXCNT = self->buffer_length / 4;
@@ -293,6 +301,7 @@ void common_hal_audiobusio_i2sout_play(audiobusio_i2sout_obj_t* self,
     NRF_I2S->ENABLE = I2S_ENABLE_ENABLE_Enabled;
 
     NRF_I2S->TASKS_START = 1;
+    audiocore_stats_started(&self->stats);
 
     i2s_background();
 }
@@ -309,6 +318,13 @@ bool common_hal_audiobusio_i2sout_get_paused(audiobusio_i2sout_obj_t* self) {
     return self->paused;
 }
 
+void common_hal_audiobusio_i2sout_get_stats(audiobusio_i2sout_obj_t* self, audiocore_stats_t* stats, bool reset) {
+    audiocore_stats_merge(stats, &self->stats);
+    if (reset) {
+        audiocore_stats_clear(&self->stats);
+    }
+}
+
 void common_hal_audiobusio_i2sout_stop(audiobusio_i2sout_obj_t* self) {
     NRF_I2S->TASKS_STOP = 1;
     self->stopping = true;
@@ -332,6 +348,9 @@ void i2s_background(void) {
         } else {
             NRF_I2S->TASKS_STOP = 1;
         }
+    } else if (instance && instance->playing && !instance->paused && !instance->stopping) {
+        // Nothing is due, so give the sample time to read ahead.
+        audiosample_prefetch(instance->sample);
     }
 }
 
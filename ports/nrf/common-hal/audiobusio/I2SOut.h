@@ -28,6 +28,7 @@
 #define MICROPY_INCLUDED_NRF_COMMON_HAL_AUDIOBUSIO_I2SOUT_H
 
 #include "py/obj.h"
+#include "shared-module/audiocore/__init__.h"
 
 typedef struct {
     mp_obj_base_t base;
@@ -55,6 +56,7 @@ typedef struct {
     bool loop : 1;
     bool samples_signed : 1;
     bool single_buffer : 1;
+    audiocore_stats_t stats;
 } audiobusio_i2sout_obj_t;
 
 void i2s_reset(void);
@@ -34,6 +34,21 @@ NRF_PDM_Type *nrf_pdm = NRF_PDM;
 
 static uint32_t dummy_buffer[4];
 
+// Values in each half of the raw buffer while streaming.
+#define STREAM_VALUES_PER_BUFFER 256
+
+static audiobusio_pdmin_obj_t *streaming_instance;
+
+static void set_mode(audiobusio_pdmin_obj_t* self) {
+    // Note: Adafruit's module has SELECT pulled to GND, which makes the DATA
+    // valid when the CLK is low, therefore it must be sampled on the rising edge.
+    if (self->mono) {
+        nrf_pdm->MODE = PDM_MODE_OPERATION_Stereo | PDM_MODE_EDGE_LeftRising;
+    } else {
+        nrf_pdm->MODE = PDM_MODE_OPERATION_Mono | PDM_MODE_EDGE_LeftRising;
+    }
+}
+
 // Caller validates that pins are free.
 void common_hal_audiobusio_pdmin_construct(audiobusio_pdmin_obj_t* self,
                                            const mcu_pin_obj_t* clock_pin,
@@ -73,6 +88,7 @@ bool common_hal_audiobusio_pdmin_deinited(audiobusio_pdmin_obj_t* self) {
 }
 
 void common_hal_audiobusio_pdmin_deinit(audiobusio_pdmin_obj_t* self) {
+    common_hal_audiobusio_pdmin_stop_stream(self);
     nrf_pdm->ENABLE = 0;
 
     reset_pin_number(self->clock_pin_number);
@@ -91,13 +107,7 @@ uint32_t common_hal_audiobusio_pdmin_get_sample_rate(audiobusio_pdmin_obj_t* sel
 
 uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t* self,
         uint16_t* output_buffer, uint32_t output_buffer_length) {
-    // Note: Adafruit's module has SELECT pulled to GND, which makes the DATA
-    // valid when the CLK is low, therefore it must be sampled on the rising edge.
-    if (self->mono) {
-        nrf_pdm->MODE = PDM_MODE_OPERATION_Stereo | PDM_MODE_EDGE_LeftRising;
-    } else {
-        nrf_pdm->MODE = PDM_MODE_OPERATION_Mono | PDM_MODE_EDGE_LeftRising;
-    }
+    set_mode(self);
 
     // step 1. Redirect to real buffer
     nrf_pdm->SAMPLE.PTR = (uintptr_t)output_buffer;
@@ -127,3 +137,92 @@ uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t* se
         return (output_buffer_length / 4) * 4;
     }
 }
+
+void common_hal_audiobusio_pdmin_start_stream(audiobusio_pdmin_obj_t* self,
+        uint32_t block_length, uint8_t block_count) {
+    if (streaming_instance != NULL) {
+        mp_raise_RuntimeError(translate("Device in use"));
+    }
+    audiobusio_pdmstream_construct(&self->stream, block_length * sizeof(uint16_t), block_count);
+    self->raw_buffer = m_malloc(2 * STREAM_VALUES_PER_BUFFER * sizeof(int16_t), false);
+    if (self->raw_buffer == NULL) {
+        audiobusio_pdmstream_deinit(&self->stream);
+        mp_raise_msg(&mp_type_MemoryError, translate("Couldn't allocate input buffer"));
+    }
+    set_mode(self);
+
+    // The PDM never stops, so queue the first half and wait for the dummy
+    // buffer to finish. From then on, each STARTED event means EasyDMA moved
+    // on to the queued half and the next pointer can be queued.
+    nrf_pdm->SAMPLE.PTR = (uintptr_t)self->raw_buffer;
+    nrf_pdm->SAMPLE.MAXCNT = STREAM_VALUES_PER_BUFFER;
+    mp_hal_delay_us(200);
+    nrf_pdm->EVENTS_STARTED = 0;
+    self->filling = 0;
+    nrf_pdm->SAMPLE.PTR = (uintptr_t)(self->raw_buffer + STREAM_VALUES_PER_BUFFER);
+
+    streaming_instance = self;
+}
+
+static void stop_streaming(void) {
+    // Registers are double buffered, so this takes effect after the current half.
+    nrf_pdm->SAMPLE.PTR = (uintptr_t)&dummy_buffer;
+    nrf_pdm->SAMPLE.MAXCNT = 1;
+    mp_hal_delay_us(STREAM_VALUES_PER_BUFFER * 1000000 / 16000 + 200);
+    streaming_instance = NULL;
+}
+
+void common_hal_audiobusio_pdmin_stop_stream(audiobusio_pdmin_obj_t* self) {
+    if (streaming_instance != self) {
+        return;
+    }
+    stop_streaming();
+    audiobusio_pdmstream_deinit(&self->stream);
+    self->raw_buffer = NULL;
+}
+
+bool common_hal_audiobusio_pdmin_get_streaming(audiobusio_pdmin_obj_t* self) {
+    return audiobusio_pdmstream_active(&self->stream);
+}
+
+uint8_t* common_hal_audiobusio_pdmin_read_block(audiobusio_pdmin_obj_t* self, uint32_t* length) {
+    *length = self->stream.block_size;
+    return audiobusio_pdmstream_read(&self->stream);
+}
+
+uint32_t common_hal_audiobusio_pdmin_get_overruns(audiobusio_pdmin_obj_t* self) {
+    return self->stream.overruns;
+}
+
+void pdmin_background(void) {
+    audiobusio_pdmin_obj_t* self = streaming_instance;
+    if (self == NULL || !nrf_pdm->EVENTS_STARTED) {
+        return;
+    }
+    nrf_pdm->EVENTS_STARTED = 0;
+    // EasyDMA moved on to the queued half, so the one it was filling is done
+    // and becomes the next one queued.
+    uint8_t finished = self->filling;
+    self->filling = 1 - finished;
+    int16_t* buffer = self->raw_buffer + finished * STREAM_VALUES_PER_BUFFER;
+    nrf_pdm->SAMPLE.PTR = (uintptr_t)buffer;
+
+    uint32_t values_done = 0;
+    while (values_done < STREAM_VALUES_PER_BUFFER) {
+        uint32_t space;
+        uint16_t* output = (uint16_t*)(void*) audiobusio_pdmstream_write_pointer(&self->stream, &space);
+        uint32_t count = MIN(space / sizeof(uint16_t), STREAM_VALUES_PER_BUFFER - values_done);
+        for (uint32_t i = 0; i < count; i++) {
+            // They want unsigned, as record() gives them.
+            output[i] = buffer[values_done + i] + 32768;
+        }
+        audiobusio_pdmstream_commit(&self->stream, count * sizeof(uint16_t));
+        values_done += count;
+    }
+}
+
+void pdmin_reset(void) {
+    if (streaming_instance != NULL) {
+        stop_streaming();
+    }
+}
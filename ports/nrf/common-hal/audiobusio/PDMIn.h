@@ -30,11 +30,18 @@
 #include "common-hal/microcontroller/Pin.h"
 
 #include "py/obj.h"
+#include "shared-module/audiobusio/PDMStream.h"
 
 typedef struct {
     mp_obj_base_t base;
+    audiobusio_pdmstream_t stream;
+    int16_t* raw_buffer; // Two halves that EasyDMA fills in turn
     uint8_t clock_pin_number, data_pin_number;
+    uint8_t filling; // Half EasyDMA is writing now
     bool mono;
 } audiobusio_pdmin_obj_t;
 
+void pdmin_reset(void);
+void pdmin_background(void);
+
 #endif
@@ -97,9 +97,11 @@ STATIC void fill_buffers(audiopwmio_pwmaudioout_obj_t *self, int buf) {
     uint16_t *dev_buffer = self->buffers[buf];
     uint8_t *buffer;
     uint32_t buffer_length;
+    uint64_t started = audiocore_stats_now();
     audioio_get_buffer_result_t get_buffer_result =
         audiosample_get_buffer(self->sample, false, 0,
                                &buffer, &buffer_length);
+    audiocore_stats_got_buffer(&self->stats, started);
     if (get_buffer_result == GET_BUFFER_ERROR) {
         common_hal_audiopwmio_pwmaudioout_stop(self);
         return;
@@ -131,6 +133,7 @@ STATIC void fill_buffers(audiopwmio_pwmaudioout_obj_t *self, int buf) {
     }
     self->pwm->SEQ[buf].PTR = (intptr_t)self->buffers[buf];
     self->pwm->SEQ[buf].CNT = num_samples*2;
+    audiocore_stats_filled(&self->stats, started, num_samples);
 
     if (self->loop && get_buffer_result == GET_BUFFER_DONE) {
         audiosample_reset_buffer(self->sample, false, 0);
@@ -168,6 +171,13 @@ void audiopwmout_background() {
         !NVIC_GetPendingIRQ(PWM1_IRQn) &&
         !NVIC_GetPendingIRQ(PWM2_IRQn) &&
         !NVIC_GetPendingIRQ(PWM3_IRQn)) {
+        // Nothing is due, so give the samples time to read ahead.
+        for (size_t i=0; i < MP_ARRAY_SIZE(active_audio); i++) {
+            audiopwmio_pwmaudioout_obj_t *self = active_audio[i];
+            if (self && !self->paused && !self->stopping) {
+                audiosample_prefetch(self->sample);
+            }
+        }
         return;
     }
     // Check our objects because the PWM could be active for some other reason.
@@ -204,6 +214,7 @@ void common_hal_audiopwmio_pwmaudioout_construct(audiopwmio_pwmaudioout_obj_t* s
     }
 
     self->quiescent_value = quiescent_value >> 8;
+    audiocore_stats_init(&self->stats, 0);
 
     self->pwm->ENABLE = 1;
     // TODO: Ramp from 0 to quiescent value
@@ -275,6 +286,7 @@ void common_hal_audiopwmio_pwmaudioout_play(audiopwmio_pwmaudioout_obj_t* self,
     activate_audiopwmout_obj(self);
     self->stopping = false;
     self->pwm->SHORTS = NRF_PWM_SHORT_LOOPSDONE_SEQSTART0_MASK;
+    audiocore_stats_init(&self->stats, sample_rate);
     fill_buffers(self, 0);
     self->pwm->SEQ[1].PTR = self->pwm->SEQ[0].PTR;
     self->pwm->SEQ[1].CNT = self->pwm->SEQ[0].CNT;
@@ -287,6 +299,7 @@ void common_hal_audiopwmio_pwmaudioout_play(audiopwmio_pwmaudioout_obj_t* self,
     // We don't enable them in the NVIC because we don't actually want an interrupt routine to run.
     self->pwm->INTENSET = PWM_INTENSET_SEQSTARTED0_Msk | PWM_INTENSET_SEQSTARTED1_Msk;
     self->pwm->TASKS_SEQSTART[0] = 1;
+    audiocore_stats_started(&self->stats);
     self->playing = true;
     self->paused = false;
 }
@@ -335,6 +348,7 @@ void common_hal_audiopwmio_pwmaudioout_pause(audiopwmio_pwmaudioout_obj_t* self)
 
 void common_hal_audiopwmio_pwmaudioout_resume(audiopwmio_pwmaudioout_obj_t* self) {
     self->paused = false;
+    audiocore_stats_resync(&self->stats);
     self->pwm->SHORTS = NRF_PWM_SHORT_LOOPSDONE_SEQSTART0_MASK;
     if (self->pwm->EVENTS_STOPPED) {
         self->pwm->EVENTS_STOPPED = 0;
@@ -345,3 +359,10 @@ void common_hal_audiopwmio_pwmaudioout_resume(audiopwmio_pwmaudioout_obj_t* self
 bool common_hal_audiopwmio_pwmaudioout_get_paused(audiopwmio_pwmaudioout_obj_t* self) {
     return self->paused;
 }
+
+void common_hal_audiopwmio_pwmaudioout_get_stats(audiopwmio_pwmaudioout_obj_t* self, audiocore_stats_t* stats, bool reset) {
+    audiocore_stats_merge(stats, &self->stats);
+    if (reset) {
+        audiocore_stats_clear(&self->stats);
+    }
+}
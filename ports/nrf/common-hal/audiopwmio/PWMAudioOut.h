@@ -28,6 +28,7 @@
 #define MICROPY_INCLUDED_NRF_COMMON_HAL_AUDIOPWM_AUDIOOUT_H
 
 #include "common-hal/microcontroller/Pin.h"
+#include "shared-module/audiocore/__init__.h"
 
 typedef struct {
     mp_obj_base_t base;
@@ -52,6 +53,7 @@ typedef struct {
     bool loop;
     bool signed_to_unsigned;
     bool single_buffer;
+    audiocore_stats_t stats;
 } audiopwmio_pwmaudioout_obj_t;
 
 void audiopwmout_reset(void);
@@ -246,14 +246,10 @@ size_t common_hal_busio_uart_read(busio_uart_obj_t *self, uint8_t *data, size_t
         }
     }
 
-    // prevent conflict with uart irq
-    NVIC_DisableIRQ(nrfx_get_irq_number(self->uarte->p_reg));
-
-    // Copy as much received data as available, up to len bytes.
+    // Copy as much received data as available, up to len bytes. The irq is
+    // the only writer, so it doesn't need to be disabled.
     size_t rx_bytes = ringbuf_get_n(&self->ringbuf, data, len);
 
-    NVIC_EnableIRQ(nrfx_get_irq_number(self->uarte->p_reg));
-
     return rx_bytes;
 }
 
@@ -97,16 +97,45 @@ static NRF_PWM_Type* find_free_pwm (void) {
     return NULL;
 }
 
+// The PWM device still sending pixels_pattern_heap after a background write.
+static NRF_PWM_Type* background_pwm = NULL;
+
+// Disconnects the PWM device once its sequence is over so that it can be found
+// free next time.
+static void release_pwm(NRF_PWM_Type* pwm) {
+    nrf_pwm_event_clear(pwm, NRF_PWM_EVENT_SEQEND0);
+    nrf_pwm_disable(pwm);
+    nrf_pwm_pins_set(pwm, (uint32_t[]) {0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL} );
+}
+
 static size_t pixels_pattern_heap_size = 0;
 // Called during reset_port() to free the pattern buffer
 void neopixel_write_reset(void) {
+    if (background_pwm != NULL) {
+        nrf_pwm_task_trigger(background_pwm, NRF_PWM_TASK_STOP);
+        release_pwm(background_pwm);
+        background_pwm = NULL;
+    }
     MP_STATE_VM(pixels_pattern_heap) = NULL;
     pixels_pattern_heap_size = 0;
 }
 
 uint64_t next_start_raw_ticks = 0;
 
-void common_hal_neopixel_write (const digitalio_digitalinout_obj_t* digitalinout, uint8_t *pixels, uint32_t numBytes) {
+bool common_hal_neopixel_write_get_busy(void) {
+    if (background_pwm == NULL) {
+        return false;
+    }
+    if (!nrf_pwm_event_check(background_pwm, NRF_PWM_EVENT_SEQEND0)) {
+        return true;
+    }
+    release_pwm(background_pwm);
+    background_pwm = NULL;
+    next_start_raw_ticks = port_get_raw_ticks(NULL) + 4;
+    return false;
+}
+
+static void neopixel_write(const digitalio_digitalinout_obj_t* digitalinout, uint8_t *pixels, uint32_t numBytes, bool background) {
     // To support both the SoftDevice + Neopixels we use the EasyDMA
     // feature from the NRF52. However this technique implies to
     // generate a pattern and store it on the memory. The actual
@@ -133,11 +162,18 @@ void common_hal_neopixel_write (const digitalio_digitalinout_obj_t* digitalinout
     // PATTERN_SIZE is a multiple of 4, so we don't need round up to make sure one_pixel is large enough.
     uint32_t stack_pixels[PATTERN_SIZE(3 * STACK_PIXELS) / sizeof(uint32_t)];
 
+    // A background write keeps sending from pixels_pattern_heap, so its pattern can't be
+    // replaced, or its PWM device picked, until it is done.
+    while (common_hal_neopixel_write_get_busy()) {
+        RUN_BACKGROUND_TASKS;
+    }
+
     NRF_PWM_Type* pwm = find_free_pwm();
 
     // only malloc if there is PWM device available
     if ( pwm != NULL ) {
-        if (pattern_size <= sizeof(stack_pixels)) {
+        // The stack is gone by the time a background write finishes.
+        if (pattern_size <= sizeof(stack_pixels) && !background) {
             pixels_pattern = (uint16_t *) stack_pixels;
         } else {
             uint8_t sd_en = 0;
@@ -237,20 +273,23 @@ void common_hal_neopixel_write (const digitalio_digitalinout_obj_t* digitalinout
         nrf_pwm_event_clear(pwm, NRF_PWM_EVENT_SEQEND0);
         nrf_pwm_task_trigger(pwm, NRF_PWM_TASK_SEQSTART0);
 
+        // The pattern is in the heap so the sequence can finish on its own.
+        // common_hal_neopixel_write_get_busy() releases the device after.
+        if (background) {
+            background_pwm = pwm;
+            return;
+        }
+
         // But we have to wait for the flag to be set.
         while ( !nrf_pwm_event_check(pwm, NRF_PWM_EVENT_SEQEND0) ) {
             RUN_BACKGROUND_TASKS;
         }
 
-        // Before leave we clear the flag for the event.
-        nrf_pwm_event_clear(pwm, NRF_PWM_EVENT_SEQEND0);
-
         // We need to disable the device and disconnect
         // all the outputs before leave or the device will not
         // be selected on the next call.
         // TODO: Check if disabling the device causes performance issues.
-        nrf_pwm_disable(pwm);
-        nrf_pwm_pins_set(pwm, (uint32_t[]) {0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL} );
+        release_pwm(pwm);
 
     } // End of DMA implementation
     // ---------------------------------------------------------------------
@@ -324,3 +363,11 @@ void common_hal_neopixel_write (const digitalio_digitalinout_obj_t* digitalinout
     // Update the next start.
     next_start_raw_ticks = port_get_raw_ticks(NULL) + 4;
 }
+
+void common_hal_neopixel_write(const digitalio_digitalinout_obj_t* digitalinout, uint8_t *pixels, uint32_t numBytes) {
+    neopixel_write(digitalinout, pixels, numBytes, false);
+}
+
+void common_hal_neopixel_write_background(const digitalio_digitalinout_obj_t* digitalinout, uint8_t *pixels, uint32_t numBytes) {
+    neopixel_write(digitalinout, pixels, numBytes, true);
+}
@@ -32,22 +32,31 @@
 
 #include "peripherals/nrf/nvm.h"
 
+#define NO_CACHE (0xffffffff)
+
+// Writes are gathered in a copy of one flash page, since we can only clear a
+// whole page at a time. It only goes out to the flash when a write moves on
+// to another page, on flush() and at reset, so a run of small assignments
+// costs one erase.
+static uint8_t nvm_cache[FLASH_PAGE_SIZE] __attribute__((aligned(4)));
+static uint32_t nvm_cache_addr = NO_CACHE;
+
 uint32_t common_hal_nvm_bytearray_get_length(nvm_bytearray_obj_t *self) {
     return self->len;
 }
 
-static bool write_page(uint32_t page_addr, uint32_t offset, uint32_t len, uint8_t *bytes) {
-    // Write a whole page to flash, buffering it first and then erasing and rewriting
-    // it since we can only clear a whole page at a time.
+bool nvm_bytearray_flush(void) {
+    if (nvm_cache_addr == NO_CACHE) {
+        return true;
+    }
+    uint32_t page_addr = nvm_cache_addr;
+    nvm_cache_addr = NO_CACHE;
 
-    if (offset == 0 && len == FLASH_PAGE_SIZE) {
-        return nrf_nvm_safe_flash_page_write(page_addr, bytes);
-    } else {
-        uint8_t buffer[FLASH_PAGE_SIZE];
-        memcpy(buffer, (uint8_t *)page_addr, FLASH_PAGE_SIZE);
-        memcpy(buffer + offset, bytes, len);
-        return nrf_nvm_safe_flash_page_write(page_addr, buffer);
+    // Skip if data is the same
+    if (memcmp(nvm_cache, (uint8_t *)page_addr, FLASH_PAGE_SIZE) == 0) {
+        return true;
     }
+    return nrf_nvm_safe_flash_page_write(page_addr, nvm_cache);
 }
 
 bool common_hal_nvm_bytearray_set_bytes(nvm_bytearray_obj_t *self,
@@ -59,8 +68,16 @@ bool common_hal_nvm_bytearray_set_bytes(nvm_bytearray_obj_t *self,
 
     while (len) {
         uint32_t write_len = MIN(len, FLASH_PAGE_SIZE - offset);
-        if (!write_page(page_addr, offset, write_len, values)) {
-            return false;
+        // Unchanged bytes don't need the page to be cached.
+        if (page_addr != nvm_cache_addr && memcmp(values, (uint8_t *)page_addr + offset, write_len) != 0) {
+            if (!nvm_bytearray_flush()) {
+                return false;
+            }
+            memcpy(nvm_cache, (uint8_t *)page_addr, FLASH_PAGE_SIZE);
+            nvm_cache_addr = page_addr;
+        }
+        if (page_addr == nvm_cache_addr) {
+            memcpy(nvm_cache + offset, values, write_len);
         }
         len -= write_len;
         values += write_len;
@@ -70,7 +87,21 @@ bool common_hal_nvm_bytearray_set_bytes(nvm_bytearray_obj_t *self,
     return true;
 }
 
+bool common_hal_nvm_bytearray_flush(nvm_bytearray_obj_t *self) {
+    return nvm_bytearray_flush();
+}
+
 void common_hal_nvm_bytearray_get_bytes(nvm_bytearray_obj_t *self,
     uint32_t start_index, uint32_t len, uint8_t* values) {
-    memcpy(values, self->start_address + start_index, len);
+    uint32_t address = (uint32_t) self->start_address + start_index;
+    memcpy(values, (uint8_t *)address, len);
+    if (nvm_cache_addr == NO_CACHE) {
+        return;
+    }
+    // Overlay whatever is still waiting in the cache.
+    uint32_t start = MAX(address, nvm_cache_addr);
+    uint32_t end = MIN(address + len, nvm_cache_addr + FLASH_PAGE_SIZE);
+    if (start < end) {
+        memcpy(values + (start - address), nvm_cache + (start - nvm_cache_addr), end - start);
+    }
 }
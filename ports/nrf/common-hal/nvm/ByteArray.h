@@ -35,4 +35,7 @@ typedef struct {
     uint32_t len;
 } nvm_bytearray_obj_t;
 
+// Write out any cached changes. Returns false if the write failed.
+bool nvm_bytearray_flush(void);
+
 #endif // MICROPY_INCLUDED_NRF_COMMON_HAL_NVM_BYTEARRAY_H
@@ -51,8 +51,6 @@ STATIC NRF_PWM_Type* pwms[] = {
 #endif
 };
 
-#define CHANNELS_PER_PWM 4
-
 STATIC uint16_t pwm_seq[MP_ARRAY_SIZE(pwms)][CHANNELS_PER_PWM];
 
 static uint8_t never_reset_pwm[MP_ARRAY_SIZE(pwms)];
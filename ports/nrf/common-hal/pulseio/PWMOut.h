@@ -30,6 +30,8 @@
 #include "nrfx_pwm.h"
 #include "py/obj.h"
 
+#define CHANNELS_PER_PWM 4
+
 typedef struct {
     mp_obj_base_t base;
     NRF_PWM_Type* pwm;
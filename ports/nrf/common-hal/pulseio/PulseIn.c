@@ -101,7 +101,8 @@ static void _pulsein_handler(nrfx_gpiote_pin_t pin, nrf_gpiote_polarity_t action
         if (self->len < self->maxlen) {
             self->len++;
         } else {
-            self->start++;
+            self->start = (self->start + 1) % self->maxlen;
+            self->dropped++;
         }
     }
 
@@ -162,6 +163,7 @@ void common_hal_pulseio_pulsein_construct(pulseio_pulsein_obj_t* self, const mcu
     self->idle_state = idle_state;
     self->start = 0;
     self->len = 0;
+    self->dropped = 0;
     self->first_edge = true;
     self->paused = false;
     self->last_overflow = 0;
@@ -253,6 +255,7 @@ void common_hal_pulseio_pulsein_clear(pulseio_pulsein_obj_t* self) {
 
     self->start = 0;
     self->len = 0;
+    self->dropped = 0;
 
     if ( !self->paused ) {
         nrfx_gpiote_in_event_enable(self->pin, true);
@@ -302,6 +305,29 @@ uint16_t common_hal_pulseio_pulsein_popleft(pulseio_pulsein_obj_t* self) {
     return value;
 }
 
+uint16_t common_hal_pulseio_pulsein_readinto(pulseio_pulsein_obj_t* self, uint16_t* buffer, uint16_t len) {
+    if ( !self->paused ) {
+        nrfx_gpiote_in_event_disable(self->pin);
+    }
+
+    uint16_t count = MIN(len, self->len);
+    uint16_t first = MIN(count, self->maxlen - self->start);
+    memcpy(buffer, self->buffer + self->start, first * sizeof(uint16_t));
+    memcpy(buffer + first, self->buffer, (count - first) * sizeof(uint16_t));
+    self->start = (self->start + count) % self->maxlen;
+    self->len -= count;
+
+    if ( !self->paused ) {
+        nrfx_gpiote_in_event_enable(self->pin, true);
+    }
+
+    return count;
+}
+
+uint32_t common_hal_pulseio_pulsein_get_dropped(pulseio_pulsein_obj_t* self) {
+    return self->dropped;
+}
+
 uint16_t common_hal_pulseio_pulsein_get_maxlen(pulseio_pulsein_obj_t* self) {
     return self->maxlen;
 }
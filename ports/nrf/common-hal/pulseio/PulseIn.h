@@ -44,6 +44,7 @@ typedef struct {
 
     volatile uint16_t start;
     volatile uint16_t len;
+    volatile uint32_t dropped;
     volatile size_t last_overflow;
     volatile size_t last_count;
 } pulseio_pulsein_obj_t;
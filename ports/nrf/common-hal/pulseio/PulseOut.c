@@ -27,97 +27,130 @@
 #include "common-hal/pulseio/PulseOut.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #include "py/mpconfig.h"
 #include "nrf/pins.h"
-#include "nrf/timers.h"
+#include "nrf_gpio.h"
 #include "py/gc.h"
 #include "py/runtime.h"
 #include "shared-bindings/pulseio/PulseOut.h"
 #include "shared-bindings/pulseio/PWMOut.h"
 #include "supervisor/shared/translate.h"
 
-// A single timer is shared amongst all PulseOut objects under the assumption that
-// the code is single threaded.
-static uint8_t refcount = 0;
-
-static nrfx_timer_t *timer = NULL;
-
-static uint16_t *pulse_array = NULL;
-static volatile uint16_t pulse_array_index = 0;
-static uint16_t pulse_array_length;
+// The pulses are played by the carrier's own PWM. SEQ[0] holds the carrier on
+// and SEQ[1] holds it off, and each is repeated (REFRESH) for as many carrier
+// periods as its pulse lasts. The PWM alternates between the two by itself,
+// so every edge lands on a carrier period boundary whatever else is running.
+// The interrupt at the end of each sequence only has to set up the length of
+// the pulse after next, while the other sequence plays.
+//
+// Only one send runs at a time, under the assumption that the code is single
+// threaded. MP_STATE_PORT(pulseout_sending) keeps it alive until it's done.
+static pulseio_pulseout_obj_t *volatile active_pulseout = NULL;
+static volatile uint16_t next_pulse;
+
+static uint16_t seq_on[CHANNELS_PER_PWM];
+static uint16_t seq_off[CHANNELS_PER_PWM];
+// The PWMOut sequence to go back to afterwards.
+static uint32_t pwmout_seq;
 
 static void turn_on(pulseio_pulseout_obj_t *pulseout) {
-    pulseout->pwmout->pwm->PSEL.OUT[0] = pulseout->pwmout->pin_number;
+    pulseout->pwmout->pwm->PSEL.OUT[pulseout->pwmout->channel] = pulseout->pwmout->pin_number;
 }
 
 static void turn_off(pulseio_pulseout_obj_t *pulseout) {
     // Disconnect pin from PWM.
-    pulseout->pwmout->pwm->PSEL.OUT[0] = 0xffffffff;
+    pulseout->pwmout->pwm->PSEL.OUT[pulseout->pwmout->channel] = 0xffffffff;
     // Make sure pin is low.
     nrf_gpio_pin_clear(pulseout->pwmout->pin_number);
 }
 
-static void start_timer(void) {
-    nrfx_timer_clear(timer);
-    // true enables interrupt.
-    nrfx_timer_compare(timer, NRF_TIMER_CC_CHANNEL0, pulse_array[pulse_array_index], true);
-    nrfx_timer_resume(timer);
+static uint32_t pulse_refresh(pulseio_pulseout_obj_t *pulseout, uint16_t pulse) {
+    // Extra sequences past the last pulse hold the carrier off for one period.
+    return pulse < pulseout->refresh_length ? pulseout->refresh[pulse] : 0;
 }
 
-static void pulseout_event_handler(nrf_timer_event_t event_type, void *p_context) {
-    pulseio_pulseout_obj_t *pulseout = (pulseio_pulseout_obj_t*) p_context;
-    if (event_type != NRF_TIMER_EVENT_COMPARE0) {
-        // Spurious event.
-        return;
-    }
-    nrfx_timer_pause(timer);
-
-    pulse_array_index++;
+static void finish_send(pulseio_pulseout_obj_t *pulseout) {
+    NRF_PWM_Type *pwm = pulseout->pwmout->pwm;
+    pwm->INTENCLR = PWM_INTENCLR_SEQEND0_Msk | PWM_INTENCLR_SEQEND1_Msk | PWM_INTENCLR_LOOPSDONE_Msk;
+    NVIC_DisableIRQ(nrfx_get_irq_number(pwm));
+    turn_off(pulseout);
+
+    // Go back to the PWMOut values for the other channels.
+    pwm->LOOP = 0;
+    pwm->SEQ[0].PTR = pwmout_seq;
+    pwm->SEQ[0].REFRESH = 0;
+    pwm->SEQ[1].PTR = 0;
+    pwm->SEQ[1].CNT = 0;
+    pwm->SEQ[1].REFRESH = 0;
+    pwm->TASKS_SEQSTART[0] = 1;
+
+    active_pulseout = NULL;
+}
 
-    // No more pulses. Turn off output and don't restart.
-    if (pulse_array_index >= pulse_array_length) {
-        turn_off(pulseout);
+static void pulseout_pwm_interrupt_handler(NRF_PWM_Type *pwm) {
+    pulseio_pulseout_obj_t *pulseout = active_pulseout;
+    if (pulseout == NULL || pulseout->pwmout->pwm != pwm) {
         return;
     }
-
-    // Alternate on and off, starting with on.
-    if (pulse_array_index % 2 == 0) {
-        turn_on(pulseout);
-    } else {
-        turn_off(pulseout);
+    bool done = false;
+    for (size_t seq = 0; seq < 2; seq++) {
+        if (pwm->EVENTS_SEQEND[seq]) {
+            pwm->EVENTS_SEQEND[seq] = 0;
+            // The other sequence is playing now, so this one can take the
+            // pulse after it. Without a loop SEQ[0] was the only pulse.
+            pwm->SEQ[seq].REFRESH = pulse_refresh(pulseout, next_pulse);
+            next_pulse++;
+            done = done || pwm->LOOP == 0;
+        }
+    }
+    if (pwm->EVENTS_LOOPSDONE) {
+        pwm->EVENTS_LOOPSDONE = 0;
+        done = true;
     }
+    if (done) {
+        finish_send(pulseout);
+    }
+}
 
-    // Count up to the next given value.
-    start_timer();
+#if NRFX_CHECK(NRFX_PWM0_ENABLED)
+void PWM0_IRQHandler(void) {
+    pulseout_pwm_interrupt_handler(NRF_PWM0);
+}
+#endif
+#if NRFX_CHECK(NRFX_PWM1_ENABLED)
+void PWM1_IRQHandler(void) {
+    pulseout_pwm_interrupt_handler(NRF_PWM1);
+}
+#endif
+#if NRFX_CHECK(NRFX_PWM2_ENABLED)
+void PWM2_IRQHandler(void) {
+    pulseout_pwm_interrupt_handler(NRF_PWM2);
 }
+#endif
+#if NRFX_CHECK(NRFX_PWM3_ENABLED)
+void PWM3_IRQHandler(void) {
+    pulseout_pwm_interrupt_handler(NRF_PWM3);
+}
+#endif
 
 void pulseout_reset() {
-    if (timer != NULL) {
-        nrf_peripherals_free_timer(timer);
+    // The PWMs themselves are reset by pwmout_reset.
+    if (active_pulseout != NULL) {
+        NVIC_DisableIRQ(nrfx_get_irq_number(active_pulseout->pwmout->pwm));
     }
-    refcount = 0;
+    active_pulseout = NULL;
+    MP_STATE_PORT(pulseout_sending) = MP_OBJ_NULL;
 }
 
 void common_hal_pulseio_pulseout_construct(pulseio_pulseout_obj_t* self,
                                            const pulseio_pwmout_obj_t* carrier) {
-    if (refcount == 0) {
-        timer = nrf_peripherals_allocate_timer_or_throw();
-    }
-    refcount++;
-
-    nrfx_timer_config_t timer_config = {
-        // PulseOut durations are in microseconds, so this is convenient.
-        .frequency = NRF_TIMER_FREQ_1MHz,
-        .mode = NRF_TIMER_MODE_TIMER,
-        .bit_width = NRF_TIMER_BIT_WIDTH_32,
-        .interrupt_priority = NRFX_TIMER_DEFAULT_CONFIG_IRQ_PRIORITY,
-        .p_context = self,
-    };
-
     self->pwmout = carrier;
+    self->refresh = NULL;
+    self->refresh_length = 0;
+    self->refresh_size = 0;
 
-    nrfx_timer_init(timer, &timer_config, &pulseout_event_handler);
     turn_off(self);
 }
 
@@ -129,31 +162,80 @@ void common_hal_pulseio_pulseout_deinit(pulseio_pulseout_obj_t* self) {
     if (common_hal_pulseio_pulseout_deinited(self)) {
         return;
     }
+    if (active_pulseout == self) {
+        NVIC_DisableIRQ(nrfx_get_irq_number(self->pwmout->pwm));
+        finish_send(self);
+        MP_STATE_PORT(pulseout_sending) = MP_OBJ_NULL;
+    }
     turn_on(self);
     self->pwmout = NULL;
 
-    refcount--;
-    if (refcount == 0) {
-        nrf_peripherals_free_timer(timer);
+    m_del(uint32_t, self->refresh, self->refresh_size);
+    self->refresh = NULL;
+    self->refresh_length = 0;
+    self->refresh_size = 0;
+}
+
+static void wait_for_send(void) {
+    while (active_pulseout != NULL) {
+        // Do other things while we wait. The PWM sends the signal.
+        RUN_BACKGROUND_TASKS;
     }
+    MP_STATE_PORT(pulseout_sending) = MP_OBJ_NULL;
 }
 
 void common_hal_pulseio_pulseout_send(pulseio_pulseout_obj_t* self, uint16_t* pulses, uint16_t length) {
-    pulse_array = pulses;
-    pulse_array_index = 0;
-    pulse_array_length = length;
+    wait_for_send();
+    if (length == 0) {
+        return;
+    }
 
-    nrfx_timer_enable(timer);
+    NRF_PWM_Type *pwm = self->pwmout->pwm;
+    // Length of a carrier period in 16MHz ticks.
+    uint32_t period = (uint32_t) pwm->COUNTERTOP << pwm->PRESCALER;
 
-    turn_on(self);
-    // Count up to the next given value.
-    start_timer();
-
-    while(pulse_array_index < length) {
-        // Do other things while we wait. The interrupts will handle sending the
-        // signal.
-        RUN_BACKGROUND_TASKS;
+    if (self->refresh_size < length) {
+        self->refresh = m_renew(uint32_t, self->refresh, self->refresh_size, length);
+        self->refresh_size = length;
     }
+    self->refresh_length = length;
+    for (uint16_t i = 0; i < length; i++) {
+        uint32_t periods = ((uint32_t) pulses[i] * 16 + period / 2) / period;
+        self->refresh[i] = periods > 0 ? periods - 1 : 0;
+    }
+
+    // Both sequences carry the PWMOut values of the PWM's other channels.
+    pwmout_seq = pwm->SEQ[0].PTR;
+    memcpy(seq_on, (uint16_t *) pwmout_seq, sizeof(seq_on));
+    memcpy(seq_off, seq_on, sizeof(seq_off));
+    seq_off[self->pwmout->channel] = 1 << 15;
+
+    pwm->SEQ[0].PTR = (uint32_t) seq_on;
+    pwm->SEQ[0].CNT = CHANNELS_PER_PWM;
+    pwm->SEQ[0].REFRESH = pulse_refresh(self, 0);
+    pwm->SEQ[1].PTR = (uint32_t) seq_off;
+    pwm->SEQ[1].CNT = CHANNELS_PER_PWM;
+    pwm->SEQ[1].REFRESH = pulse_refresh(self, 1);
+    // Each loop plays one on and one off pulse. A single pulse needs no loop.
+    pwm->LOOP = length > 1 ? (length + 1) / 2 : 0;
+    next_pulse = 2;
+
+    pwm->EVENTS_SEQEND[0] = 0;
+    pwm->EVENTS_SEQEND[1] = 0;
+    pwm->EVENTS_LOOPSDONE = 0;
+    MP_STATE_PORT(pulseout_sending) = MP_OBJ_FROM_PTR(self);
+    active_pulseout = self;
+
+    IRQn_Type irq = nrfx_get_irq_number(pwm);
+    NVIC_ClearPendingIRQ(irq);
+    NVIC_SetPriority(irq, 7);
+    NVIC_EnableIRQ(irq);
+    pwm->INTENSET = PWM_INTENSET_SEQEND0_Msk | PWM_INTENSET_SEQEND1_Msk | PWM_INTENSET_LOOPSDONE_Msk;
+
+    turn_on(self);
+    pwm->TASKS_SEQSTART[0] = 1;
+}
 
-    nrfx_timer_disable(timer);
+bool common_hal_pulseio_pulseout_get_busy(pulseio_pulseout_obj_t* self) {
+    return active_pulseout == self;
 }
@@ -35,6 +35,10 @@
 typedef struct {
     mp_obj_base_t base;
     const pulseio_pwmout_obj_t *pwmout;
+    // REFRESH value of each pulse of the send in progress.
+    uint32_t *refresh;
+    uint16_t refresh_length;
+    uint16_t refresh_size;
 } pulseio_pulseout_obj_t;
 
 void pulseout_reset(void);
@@ -26,6 +26,7 @@
 
 #include "common-hal/rotaryio/IncrementalEncoder.h"
 #include "nrfx_gpiote.h"
+#include "nrf.h"
 
 #include "py/runtime.h"
 
@@ -34,6 +35,83 @@
 // obj array to map pin number -> self since nrfx hide the mapping
 static rotaryio_incrementalencoder_obj_t *_objs[NUMBER_OF_PINS];
 
+// There is one QDEC, which decodes the first encoder in hardware. Later
+// encoders fall back to pin change interrupts.
+static rotaryio_incrementalencoder_obj_t *_qdec_obj;
+
+// Steps the position by whole detents, with the same damping as the pin
+// interrupt decoder.
+static void _add_quarters(rotaryio_incrementalencoder_obj_t *self, int32_t quarters) {
+    int32_t quarter = self->quarter + quarters;
+    while (quarter >= 4) {
+        self->position++;
+        quarter -= 4;
+    }
+    while (quarter <= -4) {
+        self->position--;
+        quarter += 4;
+    }
+    self->quarter = quarter;
+}
+
+// The QDEC accumulates transitions itself and only interrupts once a report
+// period of samples, when the accumulator is moved to ACCREAD and cleared.
+void QDEC_IRQHandler(void) {
+    if (NRF_QDEC->EVENTS_REPORTRDY) {
+        NRF_QDEC->EVENTS_REPORTRDY = 0;
+        if (_qdec_obj != NULL) {
+            _add_quarters(_qdec_obj, (int32_t) NRF_QDEC->ACCREAD);
+        }
+    }
+}
+
+static void _qdec_start(rotaryio_incrementalencoder_obj_t *self) {
+    _qdec_obj = self;
+    nrf_gpio_cfg_input(self->pin_a, NRF_GPIO_PIN_PULLUP);
+    nrf_gpio_cfg_input(self->pin_b, NRF_GPIO_PIN_PULLUP);
+    NRF_QDEC->PSEL.A = self->pin_a;
+    NRF_QDEC->PSEL.B = self->pin_b;
+    NRF_QDEC->PSEL.LED = 0xFFFFFFFF;
+    // Sample as fast as possible, and fold the accumulator into the position
+    // as rarely as possible, without the 1024 count accumulator overflowing.
+    NRF_QDEC->SAMPLEPER = QDEC_SAMPLEPER_SAMPLEPER_128us;
+    NRF_QDEC->REPORTPER = QDEC_REPORTPER_REPORTPER_280Smpl;
+    NRF_QDEC->DBFEN = 0;
+    NRF_QDEC->SHORTS = QDEC_SHORTS_REPORTRDY_READCLRACC_Msk;
+    NRF_QDEC->INTENSET = QDEC_INTENSET_REPORTRDY_Msk;
+    NVIC_SetPriority(QDEC_IRQn, 7);
+    NVIC_ClearPendingIRQ(QDEC_IRQn);
+    NVIC_EnableIRQ(QDEC_IRQn);
+    NRF_QDEC->ENABLE = 1;
+    NRF_QDEC->TASKS_START = 1;
+}
+
+static void _qdec_stop(void) {
+    NRF_QDEC->TASKS_STOP = 1;
+    NRF_QDEC->ENABLE = 0;
+    NRF_QDEC->INTENCLR = QDEC_INTENCLR_REPORTRDY_Msk;
+    NRF_QDEC->SHORTS = 0;
+    NVIC_DisableIRQ(QDEC_IRQn);
+    NRF_QDEC->PSEL.A = 0xFFFFFFFF;
+    NRF_QDEC->PSEL.B = 0xFFFFFFFF;
+    _qdec_obj = NULL;
+}
+
+// Folds the transitions the QDEC has seen since its last report into the
+// position.
+static void _qdec_sync(rotaryio_incrementalencoder_obj_t *self) {
+    NVIC_DisableIRQ(QDEC_IRQn);
+    NRF_QDEC->TASKS_READCLRACC = 1;
+    _add_quarters(self, (int32_t) NRF_QDEC->ACCREAD);
+    NVIC_EnableIRQ(QDEC_IRQn);
+}
+
+void incrementalencoder_reset(void) {
+    if (_qdec_obj != NULL) {
+        _qdec_stop();
+    }
+}
+
 static void _intr_handler(nrfx_gpiote_pin_t pin, nrf_gpiote_polarity_t action) {
     rotaryio_incrementalencoder_obj_t *self = _objs[pin];
     if (!self) return;
@@ -65,6 +143,17 @@ void common_hal_rotaryio_incrementalencoder_construct(rotaryio_incrementalencode
 
     self->pin_a = pin_a->number;
     self->pin_b = pin_b->number;
+    self->quarter = 0;
+    self->position = 0;
+
+    if (_qdec_obj == NULL) {
+        self->uses_qdec = true;
+        _qdec_start(self);
+        claim_pin(pin_a);
+        claim_pin(pin_b);
+        return;
+    }
+    self->uses_qdec = false;
 
     _objs[self->pin_a] = self;
     _objs[self->pin_b] = self;
@@ -93,13 +182,17 @@ void common_hal_rotaryio_incrementalencoder_deinit(rotaryio_incrementalencoder_o
     if (common_hal_rotaryio_incrementalencoder_deinited(self)) {
         return;
     }
-    _objs[self->pin_a] = NULL;
-    _objs[self->pin_b] = NULL;
-
-    nrfx_gpiote_in_event_disable(self->pin_a);
-    nrfx_gpiote_in_event_disable(self->pin_b);
-    nrfx_gpiote_in_uninit(self->pin_a);
-    nrfx_gpiote_in_uninit(self->pin_b);
+    if (self->uses_qdec) {
+        _qdec_stop();
+    } else {
+        _objs[self->pin_a] = NULL;
+        _objs[self->pin_b] = NULL;
+
+        nrfx_gpiote_in_event_disable(self->pin_a);
+        nrfx_gpiote_in_event_disable(self->pin_b);
+        nrfx_gpiote_in_uninit(self->pin_a);
+        nrfx_gpiote_in_uninit(self->pin_b);
+    }
     reset_pin_number(self->pin_a);
     reset_pin_number(self->pin_b);
     self->pin_a = NO_PIN;
@@ -107,6 +200,9 @@ void common_hal_rotaryio_incrementalencoder_deinit(rotaryio_incrementalencoder_o
 }
 
 mp_int_t common_hal_rotaryio_incrementalencoder_get_position(rotaryio_incrementalencoder_obj_t* self) {
+    if (self->uses_qdec) {
+        _qdec_sync(self);
+    }
     return self->position;
 }
 
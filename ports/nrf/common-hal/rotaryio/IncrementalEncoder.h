@@ -37,10 +37,13 @@ typedef struct {
     uint8_t pin_b;
     uint8_t state;
     int8_t quarter;
+    // The QDEC peripheral decodes the pins, rather than pin interrupts.
+    bool uses_qdec;
     mp_int_t position;
 } rotaryio_incrementalencoder_obj_t;
 
 
 void incrementalencoder_interrupt_handler(uint8_t channel);
+void incrementalencoder_reset(void);
 
 #endif // MICROPY_INCLUDED_NRF_COMMON_HAL_ROTARYIO_INCREMENTALENCODER_H
@@ -71,6 +71,9 @@
 // 24kiB stack
 #define CIRCUITPY_DEFAULT_STACK_SIZE            0x6000
 
+// neopixel_write sends pixels from a PWM sequence.
+#define CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND     (1)
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // This also includes mpconfigboard.h.
@@ -184,6 +187,7 @@
 #define MICROPY_PORT_ROOT_POINTERS \
     CIRCUITPY_COMMON_ROOT_POINTERS \
     uint16_t* pixels_pattern_heap; \
+    mp_obj_t pulseout_sending; \
     ble_drv_evt_handler_entry_t* ble_drv_evt_handler_entries; \
 
 
@@ -39,6 +39,9 @@ CIRCUITPY_FRAMEBUFFERIO ?= 1
 CIRCUITPY_COUNTIO = 0
 CIRCUITPY_WATCHDOG ?= 1
 
+# aesio encrypts on the ECB peripheral
+CIRCUITPY_AESIO_HW ?= 1
+
 # nRF52840-specific
 
 ifeq ($(MCU_CHIP),nrf52840)
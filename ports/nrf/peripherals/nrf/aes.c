@@ -0,0 +1,92 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "py/mpconfig.h"
+
+#if CIRCUITPY_AESIO && CIRCUITPY_AESIO_HW
+
+#include "nrf.h"
+
+#include "shared-module/aesio/__init__.h"
+
+#ifdef BLUETOOTH_SD
+#include "nrf_sdm.h"
+#include "nrf_soc.h"
+#endif
+
+// The ECB peripheral reads the key and cleartext from, and writes the
+// ciphertext back to, this block of RAM. It only encrypts, with 128 bit keys.
+typedef struct {
+    uint8_t key[16];
+    uint8_t cleartext[16];
+    uint8_t ciphertext[16];
+} ecb_data_t;
+
+bool aesio_hw_encrypt_block(const uint8_t *key, uint8_t *block) {
+    #ifdef BLUETOOTH_SD
+    // The SoftDevice owns ECB while it's enabled, so go through it.
+    uint8_t sd_en = 0;
+    (void) sd_softdevice_is_enabled(&sd_en);
+    if (sd_en) {
+        nrf_ecb_hal_data_t ecb;
+        memcpy(ecb.key, key, sizeof(ecb.key));
+        memcpy(ecb.cleartext, block, sizeof(ecb.cleartext));
+        bool ok = sd_ecb_block_encrypt(&ecb) == NRF_SUCCESS;
+        if (ok) {
+            memcpy(block, ecb.ciphertext, sizeof(ecb.ciphertext));
+        }
+        memset(&ecb, 0, sizeof(ecb));
+        return ok;
+    }
+    #endif
+
+    ecb_data_t data;
+    memcpy(data.key, key, sizeof(data.key));
+    memcpy(data.cleartext, block, sizeof(data.cleartext));
+
+    NRF_ECB->EVENTS_ENDECB = 0;
+    NRF_ECB->EVENTS_ERRORECB = 0;
+    NRF_ECB->ECBDATAPTR = (uint32_t) &data;
+    NRF_ECB->TASKS_STARTECB = 1;
+    while (NRF_ECB->EVENTS_ENDECB == 0 && NRF_ECB->EVENTS_ERRORECB == 0) {
+    }
+    // ERRORECB means the radio's CCM or AAR took the AES core part way through.
+    bool ok = NRF_ECB->EVENTS_ENDECB != 0;
+    NRF_ECB->EVENTS_ENDECB = 0;
+    NRF_ECB->EVENTS_ERRORECB = 0;
+
+    if (ok) {
+        memcpy(block, data.ciphertext, sizeof(data.ciphertext));
+    }
+    memset(&data, 0, sizeof(data));
+    return ok;
+}
+
+#endif
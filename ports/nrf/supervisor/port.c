@@ -48,8 +48,10 @@
 #include "common-hal/pulseio/PWMOut.h"
 #include "common-hal/pulseio/PulseOut.h"
 #include "common-hal/pulseio/PulseIn.h"
+#include "common-hal/rotaryio/IncrementalEncoder.h"
 #include "common-hal/rtc/RTC.h"
 #include "common-hal/neopixel_write/__init__.h"
+#include "common-hal/nvm/ByteArray.h"
 #include "common-hal/watchdog/WatchDogTimer.h"
 
 #include "shared-bindings/microcontroller/__init__.h"
@@ -59,6 +61,7 @@
 
 #ifdef CIRCUITPY_AUDIOBUSIO
 #include "common-hal/audiobusio/I2SOut.h"
+#include "common-hal/audiobusio/PDMIn.h"
 #endif
 
 #ifdef CIRCUITPY_AUDIOPWMIO
@@ -168,6 +171,10 @@ safe_mode_t port_init(void) {
 }
 
 void reset_port(void) {
+#if CIRCUITPY_NVM
+    nvm_bytearray_flush();
+#endif
+
 #ifdef CIRCUITPY_GAMEPAD_TICKS
     gamepad_reset();
 #endif
@@ -184,6 +191,7 @@ void reset_port(void) {
 
 #if CIRCUITPY_AUDIOBUSIO
     i2s_reset();
+    pdmin_reset();
 #endif
 
 #if CIRCUITPY_AUDIOPWMIO
@@ -197,6 +205,10 @@ void reset_port(void) {
     pulsein_reset();
 #endif
 
+#if CIRCUITPY_ROTARYIO
+    incrementalencoder_reset();
+#endif
+
 #if CIRCUITPY_RTC
     rtc_reset();
 #endif
@@ -26,6 +26,7 @@
 
 #include "py/runtime.h"
 #include "supervisor/filesystem.h"
+#include "supervisor/shared/background_tasks.h"
 #include "supervisor/usb.h"
 #include "supervisor/shared/stack.h"
 
@@ -33,28 +34,34 @@
 #include "shared-module/displayio/__init__.h"
 #endif
 
-static bool running_background_tasks = false;
-
-void background_tasks_reset(void) {
-    running_background_tasks = false;
-}
+STATIC background_task_t filesystem_task = BACKGROUND_TASK(filesystem_background, BACKGROUND_TASK_PRIORITY_FILESYSTEM, 16);
+#if USB_AVAILABLE
+STATIC background_task_t usb_task = BACKGROUND_TASK(usb_background, BACKGROUND_TASK_PRIORITY_USB, 1);
+#endif
+#if CIRCUITPY_DISPLAYIO
+STATIC background_task_t displayio_task = BACKGROUND_TASK(displayio_background, BACKGROUND_TASK_PRIORITY_DISPLAY, 16);
+#endif
 
-void run_background_tasks(void) {
-    // Don't call ourselves recursively.
-    if (running_background_tasks) {
-        return;
-    }
-    running_background_tasks = true;
-    filesystem_background();
+STATIC bool tasks_registered = false;
 
+STATIC void register_background_tasks(void) {
     #if USB_AVAILABLE
-    usb_background();
+    supervisor_background_task_register(&usb_task);
     #endif
-
+    supervisor_background_task_register(&filesystem_task);
     #if CIRCUITPY_DISPLAYIO
-    displayio_background();
+    supervisor_background_task_register(&displayio_task);
     #endif
-    running_background_tasks = false;
+    tasks_registered = true;
+}
 
-    assert_heap_ok();
+void background_tasks_reset(void) {
+    supervisor_background_tasks_reset();
+}
+
+void run_background_tasks(void) {
+    if (!tasks_registered) {
+        register_background_tasks();
+    }
+    supervisor_background_tasks_run();
 }
@@ -218,7 +218,7 @@ void common_hal_busio_uart_construct(busio_uart_obj_t *self,
     // Init buffer for rx and claim pins
     if (self->rx != NULL) {
         if (receiver_buffer != NULL) {
-            self->ringbuf = (ringbuf_t){ receiver_buffer, receiver_buffer_size };
+            ringbuf_init(&self->ringbuf, receiver_buffer, receiver_buffer_size);
         } else {
             if (!ringbuf_alloc(&self->ringbuf, receiver_buffer_size, true)) {
                 mp_raise_ValueError(translate("UART Buffer allocation error"));
@@ -304,11 +304,9 @@ size_t common_hal_busio_uart_read(busio_uart_obj_t *self, uint8_t *data, size_t
         }
     }
 
-    // Halt reception
-    HAL_NVIC_DisableIRQ(self->irq);
-    // Copy as much received data as available, up to len bytes.
+    // Copy as much received data as available, up to len bytes. The irq is
+    // the only writer, so reception doesn't need to be halted.
     size_t rx_bytes = ringbuf_get_n(&self->ringbuf, data, len);
-    HAL_NVIC_EnableIRQ(self->irq);
 
     if (rx_bytes == 0) {
         *errcode = EAGAIN;
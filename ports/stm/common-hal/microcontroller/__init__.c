@@ -77,6 +77,9 @@ void common_hal_mcu_on_next_reset(mcu_runmode_t runmode) {
 }
 
 void common_hal_mcu_reset(void) {
+#if CIRCUITPY_NVM
+    nvm_bytearray_flush();
+#endif
     filesystem_flush(); //TODO: implement as part of flash improvements
     NVIC_SystemReset();
 }
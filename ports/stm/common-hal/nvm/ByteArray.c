@@ -33,29 +33,39 @@
 #include <stdint.h>
 #include <string.h>
 
+// Writes are gathered in a copy of the whole nvm. It only goes out to the
+// flash on flush() and at reset, so a run of small assignments costs one
+// sector erase.
+STATIC uint8_t nvm_cache[NVM_BYTEARRAY_BUFFER_SIZE];
+// The flash the cache holds, or NULL when nothing is cached.
+STATIC uint8_t *nvm_cache_addr = NULL;
+
 uint32_t common_hal_nvm_bytearray_get_length(nvm_bytearray_obj_t *self) {
     return self->len;
 }
 
-bool common_hal_nvm_bytearray_set_bytes(nvm_bytearray_obj_t *self,
-        uint32_t start_index, uint8_t* values, uint32_t len) {
-    // Copy flash to buffer
-    uint8_t buffer[self->len];
-    memcpy(buffer, self->start_address, self->len);
+bool nvm_bytearray_flush(void) {
+    if (nvm_cache_addr == NULL) {
+        return true;
+    }
+    uint32_t flash_addr = (uint32_t)nvm_cache_addr;
+    nvm_cache_addr = NULL;
 
-    // Set bytes in buffer
-    memmove(buffer + start_index, values, len);
+    if (memcmp(nvm_cache, (uint8_t *)flash_addr, NVM_BYTEARRAY_BUFFER_SIZE) == 0) {
+        return true;
+    }
 
     // Erase flash sector
     HAL_FLASH_Unlock();
     __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_EOP | FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR | FLASH_FLAG_PGAERR | FLASH_FLAG_PGSERR );
     FLASH_Erase_Sector(CIRCUITPY_INTERNAL_NVM_SECTOR, VOLTAGE_RANGE_3);
 
-    // Write bytes to flash
-    uint32_t i;
-    uint32_t flash_addr = (uint32_t)self->start_address;
-    for (i = 0; i < self->len; i++, flash_addr++) {
-        if (HAL_FLASH_Program(FLASH_TYPEPROGRAM_BYTE, flash_addr, buffer[i]) != HAL_OK) {
+    // Write bytes to flash. Erased flash already reads 0xff.
+    for (uint32_t i = 0; i < NVM_BYTEARRAY_BUFFER_SIZE; i++, flash_addr++) {
+        if (nvm_cache[i] == 0xff) {
+            continue;
+        }
+        if (HAL_FLASH_Program(FLASH_TYPEPROGRAM_BYTE, flash_addr, nvm_cache[i]) != HAL_OK) {
             HAL_FLASH_Lock();
             return false;
         }
@@ -66,8 +76,34 @@ bool common_hal_nvm_bytearray_set_bytes(nvm_bytearray_obj_t *self,
     return true;
 }
 
-// NVM memory is memory mapped so reading it is easy.
+bool common_hal_nvm_bytearray_set_bytes(nvm_bytearray_obj_t *self,
+        uint32_t start_index, uint8_t* values, uint32_t len) {
+    if (nvm_cache_addr != self->start_address) {
+        // Unchanged bytes don't need to be cached.
+        if (memcmp(values, self->start_address + start_index, len) == 0) {
+            return true;
+        }
+        if (!nvm_bytearray_flush()) {
+            return false;
+        }
+        // Copy flash to buffer
+        memcpy(nvm_cache, self->start_address, self->len);
+        nvm_cache_addr = self->start_address;
+    }
+
+    // Set bytes in buffer
+    memmove(nvm_cache + start_index, values, len);
+    return true;
+}
+
+bool common_hal_nvm_bytearray_flush(nvm_bytearray_obj_t *self) {
+    return nvm_bytearray_flush();
+}
+
+// NVM memory is memory mapped so reading it is easy, apart from what's
+// still in the cache.
 void common_hal_nvm_bytearray_get_bytes(nvm_bytearray_obj_t *self,
     uint32_t start_index, uint32_t len, uint8_t* values) {
-    memcpy(values, self->start_address + start_index, len);
+    uint8_t *src = nvm_cache_addr == self->start_address ? nvm_cache : self->start_address;
+    memcpy(values, src + start_index, len);
 }
@@ -25,6 +25,8 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "genhdr/mpversion.h"
 #include "py/mpconfig.h"
 #include "py/objstr.h"
@@ -71,8 +73,8 @@ bool common_hal_os_urandom(uint8_t *buffer, uint32_t length) {
     handle.Instance = RNG;
     if (HAL_RNG_Init(&handle) != HAL_OK) mp_raise_ValueError(translate("RNG Init Error"));
 
-    //Assign bytes
-    for (uint i = 0; i < length; i++) {
+    //Assign bytes, four from each 32 bit random number
+    while (length > 0) {
         uint32_t temp;
         uint32_t start = HAL_GetTick();
         //the HAL function has a timeout, but it isn't long enough, and isn't adjustable
@@ -81,7 +83,10 @@ bool common_hal_os_urandom(uint8_t *buffer, uint32_t length) {
         if (HAL_RNG_GenerateRandomNumber(&handle, &temp) != HAL_OK) {
             mp_raise_ValueError(translate("Random number generation error"));
         }
-        *buffer = (uint8_t)temp;
+        uint32_t n = MIN(length, sizeof(temp));
+        memcpy(buffer, &temp, n);
+        buffer += n;
+        length -= n;
     }
 
     //shut down the peripheral
@@ -88,7 +88,8 @@ static void pulsein_handler(uint8_t num) {
         if (self->len < self->maxlen) {
             self->len++;
         } else {
-            self->start++;
+            self->start = (self->start + 1) % self->maxlen;
+            self->dropped++;
         }
     }
 
@@ -136,6 +137,7 @@ void common_hal_pulseio_pulsein_construct(pulseio_pulsein_obj_t* self, const mcu
     self->idle_state = idle_state;
     self->start = 0;
     self->len = 0;
+    self->dropped = 0;
     self->first_edge = true;
     self->paused = false;
     self->last_count = 0;
@@ -237,6 +239,7 @@ void common_hal_pulseio_pulsein_clear(pulseio_pulsein_obj_t* self) {
     HAL_NVIC_DisableIRQ(self->irq);
     self->start = 0;
     self->len = 0;
+    self->dropped = 0;
     HAL_NVIC_EnableIRQ(self->irq);
 }
 
@@ -267,6 +270,23 @@ uint16_t common_hal_pulseio_pulsein_popleft(pulseio_pulsein_obj_t* self) {
     return value;
 }
 
+uint16_t common_hal_pulseio_pulsein_readinto(pulseio_pulsein_obj_t* self, uint16_t* buffer, uint16_t len) {
+    HAL_NVIC_DisableIRQ(self->irq);
+    uint16_t count = MIN(len, self->len);
+    uint16_t first = MIN(count, self->maxlen - self->start);
+    memcpy(buffer, self->buffer + self->start, first * sizeof(uint16_t));
+    memcpy(buffer + first, self->buffer, (count - first) * sizeof(uint16_t));
+    self->start = (self->start + count) % self->maxlen;
+    self->len -= count;
+    HAL_NVIC_EnableIRQ(self->irq);
+
+    return count;
+}
+
+uint32_t common_hal_pulseio_pulsein_get_dropped(pulseio_pulsein_obj_t* self) {
+    return self->dropped;
+}
+
 uint16_t common_hal_pulseio_pulsein_get_maxlen(pulseio_pulsein_obj_t* self) {
     return self->maxlen;
 }
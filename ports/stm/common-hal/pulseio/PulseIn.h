@@ -45,6 +45,7 @@ typedef struct {
 
     volatile uint16_t start;
     volatile uint16_t len;
+    volatile uint32_t dropped;
     volatile uint32_t last_overflow;
     volatile uint16_t last_count;
 } pulseio_pulsein_obj_t;
@@ -211,3 +211,8 @@ void TIM7_IRQHandler(void)
         }
     }
 }
+
+bool common_hal_pulseio_pulseout_get_busy(pulseio_pulseout_obj_t* self) {
+    // send waits until the pulses are out.
+    return false;
+}
@@ -42,6 +42,9 @@
 #include "common-hal/pulseio/PulseOut.h"
 #include "common-hal/pulseio/PulseIn.h"
 #endif
+#if CIRCUITPY_NVM
+#include "common-hal/nvm/ByteArray.h"
+#endif
 
 #include "clocks.h"
 #include "gpio.h"
@@ -218,6 +221,9 @@ void SysTick_Handler(void) {
 }
 
 void reset_port(void) {
+#if CIRCUITPY_NVM
+    nvm_bytearray_flush();
+#endif
     reset_all_pins();
 #if CIRCUITPY_BUSIO
     i2c_reset();
@@ -402,6 +402,10 @@ STATIC mp_obj_t extra_coverage(void) {
         for (int i = 0; i < 5; ++i) {
             mp_printf(&mp_plat_print, "sched(%d)=%d\n", i, mp_sched_schedule(MP_OBJ_FROM_PTR(&mp_builtin_print_obj), MP_OBJ_NEW_SMALL_INT(i)));
         }
+        mp_printf(&mp_plat_print, "dropped=%d\n", (int)mp_sched_num_dropped());
+
+        // a duplicate of a pending callback is coalesced even when full
+        mp_printf(&mp_plat_print, "coalesce=%d\n", mp_sched_schedule_ex(MP_OBJ_FROM_PTR(&mp_builtin_print_obj), MP_OBJ_NEW_SMALL_INT(1), MP_SCHED_FLAG_COALESCE));
 
         // test nested locking/unlocking
         mp_sched_lock();
@@ -418,6 +422,15 @@ STATIC mp_obj_t extra_coverage(void) {
         while (mp_sched_num_pending()) {
             mp_handle_pending();
         }
+
+        // urgent callbacks run first
+        mp_sched_lock();
+        mp_sched_schedule(MP_OBJ_FROM_PTR(&mp_builtin_print_obj), MP_OBJ_NEW_SMALL_INT(5));
+        mp_sched_schedule_ex(MP_OBJ_FROM_PTR(&mp_builtin_print_obj), MP_OBJ_NEW_SMALL_INT(6), MP_SCHED_FLAG_URGENT);
+        mp_sched_schedule_ex(MP_OBJ_FROM_PTR(&mp_builtin_print_obj), MP_OBJ_NEW_SMALL_INT(5), MP_SCHED_FLAG_COALESCE);
+        mp_sched_unlock();
+        mp_handle_pending();
+        mp_printf(&mp_plat_print, "pending=%d\n", mp_sched_num_pending());
     }
 
     mp_obj_streamtest_t *s = m_new_obj(mp_obj_streamtest_t);
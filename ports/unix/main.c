@@ -34,6 +34,7 @@
 #include <ctype.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <fcntl.h>
 #include <errno.h>
 #include <signal.h>
 
@@ -46,6 +47,7 @@
 #include "py/stackctrl.h"
 #include "py/mphal.h"
 #include "py/mpthread.h"
+#include "py/persistentcode.h"
 #include "extmod/misc.h"
 #include "extmod/vfs.h"
 #include "extmod/vfs_posix.h"
@@ -127,22 +129,36 @@ STATIC int execute_from_lexer(int source_kind, const void *source, mp_parse_inpu
         }
         #endif
 
-        mp_parse_tree_t parse_tree = mp_parse(lex, input_kind);
-
-        #if defined(MICROPY_UNIX_COVERAGE)
-        // allow to print the parse tree in the coverage build
-        if (mp_verbose_flag >= 3) {
-            printf("----------------\n");
-            mp_parse_node_print(parse_tree.root, 0);
-            printf("----------------\n");
-        }
+        #if MICROPY_COMP_INCREMENTAL
+        // -v prints the parse tree or bytecode of the script as a whole
+        if (input_kind == MP_PARSE_FILE_INPUT && mp_verbose_flag == 0) {
+            mp_obj_t funs = mp_compile_incremental(lex, emit_opt);
+            if (!compile_only) {
+                mp_call_incremental(funs);
+            }
+        } else
         #endif
+        {
+            mp_parse_tree_t parse_tree = mp_parse(lex, input_kind);
+
+            #if defined(MICROPY_UNIX_COVERAGE)
+            // allow to print the parse tree in the coverage build
+            if (mp_verbose_flag >= 3) {
+                printf("----------------\n");
+                mp_parse_node_print(parse_tree.root, 0);
+                printf("----------------\n");
+            }
+            #endif
 
-        mp_obj_t module_fun = mp_compile(&parse_tree, source_name, emit_opt, is_repl);
+            mp_obj_t module_fun = mp_compile(&parse_tree, source_name, emit_opt, is_repl);
+
+            if (!compile_only) {
+                // execute it
+                mp_call_function_0(module_fun);
+            }
+        }
 
         if (!compile_only) {
-            // execute it
-            mp_call_function_0(module_fun);
             // check for pending exception
             if (MP_STATE_VM(mp_pending_exception) != MP_OBJ_NULL) {
                 mp_obj_t obj = MP_STATE_VM(mp_pending_exception);
@@ -439,8 +455,17 @@ MP_NOINLINE int main_(int argc, char **argv) {
     pre_process_options(argc, argv);
 
 #if MICROPY_ENABLE_GC
+    #if MICROPY_GC_SPLIT_HEAP
+    // Give the GC the heap as two separate areas, the way a board with
+    // external RAM would, so that the split heap code gets exercised.
+    char *heap = malloc(heap_size / 2);
+    gc_init(heap, heap + heap_size / 2);
+    char *heap_extra = malloc(heap_size / 2);
+    gc_add(heap_extra, heap_extra + heap_size / 2);
+    #else
     char *heap = malloc(heap_size);
     gc_init(heap, heap + heap_size);
+    #endif
 #endif
 
     #if MICROPY_ENABLE_PYSTACK
@@ -665,6 +690,9 @@ MP_NOINLINE int main_(int argc, char **argv) {
     // We don't really need to free memory since we are about to exit the
     // process, but doing so helps to find memory leaks.
     free(heap);
+    #if MICROPY_GC_SPLIT_HEAP
+    free(heap_extra);
+    #endif
 #endif
 
     //printf("total bytes = %d\n", m_get_total_bytes_allocated());
@@ -685,6 +713,44 @@ uint mp_import_stat(const char *path) {
 }
 #endif
 
+#if MICROPY_PERSISTENT_CODE_LOAD_XIP
+// The file is read into the heap rather than mapped: a mapping would never be
+// released, and its constants would change, or fault with SIGBUS, if the file
+// were rewritten or truncated while the module is loaded.  The constants share
+// this one copy, which the GC frees once none of them is left.
+const byte *mp_import_map_file(const char *path, size_t *len, void **owner) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    struct stat st;
+    byte *buf = NULL;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        buf = m_new_maybe(byte, st.st_size);
+    }
+    size_t n = 0;
+    while (buf != NULL && n < (size_t)st.st_size) {
+        ssize_t r = read(fd, buf + n, st.st_size - n);
+        if (r < 0 && errno == EINTR) {
+            continue;
+        }
+        if (r < 0) {
+            m_del(byte, buf, st.st_size);
+            buf = NULL;
+        } else if (r == 0) {
+            // truncated since fstat, load what there is
+            break;
+        } else {
+            n += r;
+        }
+    }
+    close(fd);
+    *len = n;
+    *owner = buf;
+    return buf;
+}
+#endif
+
 void nlr_jump_fail(void *val) {
     printf("FATAL: uncaught NLR %p\n", val);
     exit(1);
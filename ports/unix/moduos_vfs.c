@@ -71,6 +71,9 @@ STATIC const mp_rom_map_elem_t uos_vfs_module_globals_table[] = {
     #if MICROPY_VFS_FAT
     { MP_ROM_QSTR(MP_QSTR_VfsFat), MP_ROM_PTR(&mp_fat_vfs_type) },
     #endif
+    #if MICROPY_VFS_RAMBLOCKDEV
+    { MP_ROM_QSTR(MP_QSTR_RAMBlockDevice), MP_ROM_PTR(&mp_type_vfs_ramblockdev) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(uos_vfs_module_globals, uos_vfs_module_globals_table);
@@ -32,6 +32,11 @@
 #include <stdio.h>
 #include <errno.h>
 #include <poll.h>
+#include <string.h>
+#include <unistd.h>
+#if MICROPY_PY_USELECT_EPOLL
+#include <sys/epoll.h>
+#endif
 
 #include "py/runtime.h"
 #include "py/obj.h"
@@ -49,21 +54,6 @@ extern const mp_obj_type_t mp_type_socket;
 // Flags for poll()
 #define FLAG_ONESHOT (1)
 
-/// \class Poll - poll class
-
-typedef struct _mp_obj_poll_t {
-    mp_obj_base_t base;
-    unsigned short alloc;
-    unsigned short len;
-    struct pollfd *entries;
-    mp_obj_t *obj_map;
-    short iter_cnt;
-    short iter_idx;
-    int flags;
-    // callee-owned tuple
-    mp_obj_t ret_tuple;
-} mp_obj_poll_t;
-
 STATIC int get_fd(mp_obj_t fdlike) {
     int fd;
     // Shortcut for fdfile compatible types
@@ -80,6 +70,297 @@ STATIC int get_fd(mp_obj_t fdlike) {
     return fd;
 }
 
+/// \class Poll - poll class
+
+#if MICROPY_PY_USELECT_EPOLL
+
+// What is registered for an fd. The entries are indexed by fd.
+typedef struct _poll_entry_t {
+    // The registered object, or MP_OBJ_NULL if the fd isn't registered.
+    mp_obj_t obj;
+    short events;
+    // epoll can't wait on fds such as regular files, which poll(2) always reports as ready.
+    bool always_ready;
+} poll_entry_t;
+
+typedef struct _mp_obj_poll_t {
+    mp_obj_base_t base;
+    int epoll_fd;
+    size_t entries_alloc;
+    poll_entry_t *entries;
+    // The number of registered fds, and how many of them are always ready.
+    size_t len;
+    size_t always_ready_len;
+    // Filled in by each wait with the fds that are ready.
+    size_t events_alloc;
+    struct epoll_event *events;
+    int iter_cnt;
+    int iter_idx;
+    int flags;
+    // callee-owned tuple
+    mp_obj_t ret_tuple;
+} mp_obj_poll_t;
+
+STATIC int poll_epoll_ctl(mp_obj_poll_t *self, int op, int fd, short events) {
+    struct epoll_event event = { .events = events, .data.fd = fd };
+    return epoll_ctl(self->epoll_fd, op, fd, &event);
+}
+
+STATIC poll_entry_t *poll_find(mp_obj_poll_t *self, int fd) {
+    if (fd < 0 || (size_t)fd >= self->entries_alloc || self->entries[fd].obj == MP_OBJ_NULL) {
+        return NULL;
+    }
+    return &self->entries[fd];
+}
+
+// Sets the events of a registered fd. An fd that was closed and reopened has dropped out of the
+// epoll set, so it is added back.
+STATIC void poll_set_events(mp_obj_poll_t *self, poll_entry_t *entry, int fd, short events) {
+    entry->events = events;
+    if (!entry->always_ready && poll_epoll_ctl(self, EPOLL_CTL_MOD, fd, events) == -1) {
+        int res = poll_epoll_ctl(self, EPOLL_CTL_ADD, fd, events);
+        RAISE_ERRNO(res, errno);
+    }
+}
+
+/// \method register(obj[, eventmask])
+STATIC mp_obj_t poll_register(size_t n_args, const mp_obj_t *args) {
+    mp_obj_poll_t *self = MP_OBJ_TO_PTR(args[0]);
+    int fd = get_fd(args[1]);
+    if (fd < 0) {
+        mp_raise_ValueError(NULL);
+    }
+
+    mp_uint_t flags;
+    if (n_args == 3) {
+        flags = mp_obj_get_int(args[2]);
+    } else {
+        flags = POLLIN | POLLOUT;
+    }
+
+    poll_entry_t *entry = poll_find(self, fd);
+    if (entry != NULL) {
+        poll_set_events(self, entry, fd, flags);
+        return mp_const_false;
+    }
+
+    if ((size_t)fd >= self->entries_alloc) {
+        size_t new_alloc = MAX(self->entries_alloc * 2, (size_t)fd + 1);
+        self->entries = m_renew(poll_entry_t, self->entries, self->entries_alloc, new_alloc);
+        memset(self->entries + self->entries_alloc, 0, (new_alloc - self->entries_alloc) * sizeof(poll_entry_t));
+        self->entries_alloc = new_alloc;
+    }
+    // One more than the number of fds so a wait always has room for a ready one.
+    if (self->len + 2 > self->events_alloc) {
+        size_t new_alloc = MAX(self->events_alloc * 2, self->len + 2);
+        self->events = m_renew(struct epoll_event, self->events, self->events_alloc, new_alloc);
+        self->events_alloc = new_alloc;
+    }
+
+    entry = &self->entries[fd];
+    entry->always_ready = false;
+    if (poll_epoll_ctl(self, EPOLL_CTL_ADD, fd, flags) == -1) {
+        if (errno == EEXIST) {
+            // Still in the set from before it was closed and reopened.
+            poll_epoll_ctl(self, EPOLL_CTL_MOD, fd, flags);
+        } else if (errno == EPERM) {
+            entry->always_ready = true;
+            self->always_ready_len++;
+        } else {
+            RAISE_ERRNO(-1, errno);
+        }
+    }
+    entry->obj = args[1];
+    entry->events = flags;
+    self->len++;
+    return mp_const_true;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(poll_register_obj, 2, 3, poll_register);
+
+/// \method unregister(obj)
+STATIC mp_obj_t poll_unregister(mp_obj_t self_in, mp_obj_t obj_in) {
+    mp_obj_poll_t *self = MP_OBJ_TO_PTR(self_in);
+    int fd = get_fd(obj_in);
+    poll_entry_t *entry = poll_find(self, fd);
+    if (entry != NULL) {
+        if (entry->always_ready) {
+            self->always_ready_len--;
+        } else {
+            // This fails if the fd has been closed, which has removed it already.
+            poll_epoll_ctl(self, EPOLL_CTL_DEL, fd, 0);
+        }
+        entry->obj = MP_OBJ_NULL;
+        self->len--;
+    }
+
+    // TODO raise KeyError if obj didn't exist in map
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(poll_unregister_obj, poll_unregister);
+
+/// \method modify(obj, eventmask)
+STATIC mp_obj_t poll_modify(mp_obj_t self_in, mp_obj_t obj_in, mp_obj_t eventmask_in) {
+    mp_obj_poll_t *self = MP_OBJ_TO_PTR(self_in);
+    int fd = get_fd(obj_in);
+    poll_entry_t *entry = poll_find(self, fd);
+    if (entry != NULL) {
+        poll_set_events(self, entry, fd, mp_obj_get_int(eventmask_in));
+    }
+
+    // TODO raise KeyError if obj didn't exist in map
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_3(poll_modify_obj, poll_modify);
+
+STATIC int poll_poll_internal(size_t n_args, const mp_obj_t *args) {
+    mp_obj_poll_t *self = MP_OBJ_TO_PTR(args[0]);
+
+    // work out timeout (it's given already in ms)
+    int timeout = -1;
+    int flags = 0;
+    if (n_args >= 2) {
+        if (args[1] != mp_const_none) {
+            mp_int_t timeout_i = mp_obj_get_int(args[1]);
+            if (timeout_i >= 0) {
+                timeout = timeout_i;
+            }
+        }
+        if (n_args >= 3) {
+            flags = mp_obj_get_int(args[2]);
+        }
+    }
+
+    self->flags = flags;
+
+    if (self->always_ready_len > 0) {
+        timeout = 0;
+    }
+    int max_events = self->events_alloc - self->always_ready_len;
+    int n_ready = epoll_wait(self->epoll_fd, self->events, max_events, timeout);
+    RAISE_ERRNO(n_ready, errno);
+
+    if (self->always_ready_len > 0) {
+        // Only fds that epoll can't wait on need a scan.
+        for (size_t fd = 0; fd < self->entries_alloc; fd++) {
+            poll_entry_t *entry = &self->entries[fd];
+            short revents = entry->events & (POLLIN | POLLOUT);
+            if (entry->obj != MP_OBJ_NULL && entry->always_ready && revents != 0) {
+                self->events[n_ready].events = revents;
+                self->events[n_ready].data.fd = fd;
+                n_ready++;
+            }
+        }
+    }
+    return n_ready;
+}
+
+// Fills in t with the object and events of the index'th ready fd.
+STATIC void poll_get_ready(mp_obj_poll_t *self, int index, mp_obj_tuple_t *t) {
+    int fd = self->events[index].data.fd;
+    poll_entry_t *entry = &self->entries[fd];
+    t->items[1] = MP_OBJ_NEW_SMALL_INT(self->events[index].events);
+    if (entry->obj == MP_OBJ_NULL) {
+        // Unregistered while iterating over the results.
+        t->items[0] = MP_OBJ_NEW_SMALL_INT(fd);
+        return;
+    }
+    t->items[0] = entry->obj;
+    if (self->flags & FLAG_ONESHOT) {
+        poll_set_events(self, entry, fd, 0);
+    }
+}
+
+/// \method poll([timeout])
+/// Timeout is in milliseconds.
+STATIC mp_obj_t poll_poll(size_t n_args, const mp_obj_t *args) {
+    int n_ready = poll_poll_internal(n_args, args);
+
+    if (n_ready == 0) {
+        return mp_const_empty_tuple;
+    }
+
+    mp_obj_poll_t *self = MP_OBJ_TO_PTR(args[0]);
+
+    mp_obj_list_t *ret_list = MP_OBJ_TO_PTR(mp_obj_new_list(n_ready, NULL));
+    for (int i = 0; i < n_ready; i++) {
+        mp_obj_tuple_t *t = MP_OBJ_TO_PTR(mp_obj_new_tuple(2, NULL));
+        poll_get_ready(self, i, t);
+        ret_list->items[i] = MP_OBJ_FROM_PTR(t);
+    }
+
+    return MP_OBJ_FROM_PTR(ret_list);
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(poll_poll_obj, 1, 3, poll_poll);
+
+STATIC mp_obj_t poll_ipoll(size_t n_args, const mp_obj_t *args) {
+    mp_obj_poll_t *self = MP_OBJ_TO_PTR(args[0]);
+
+    if (self->ret_tuple == MP_OBJ_NULL) {
+        self->ret_tuple = mp_obj_new_tuple(2, NULL);
+    }
+
+    int n_ready = poll_poll_internal(n_args, args);
+    self->iter_cnt = n_ready;
+    self->iter_idx = 0;
+
+    return args[0];
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(poll_ipoll_obj, 1, 3, poll_ipoll);
+
+STATIC mp_obj_t poll_iternext(mp_obj_t self_in) {
+    mp_obj_poll_t *self = MP_OBJ_TO_PTR(self_in);
+
+    if (self->iter_idx >= self->iter_cnt) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+
+    mp_obj_tuple_t *t = MP_OBJ_TO_PTR(self->ret_tuple);
+    poll_get_ready(self, self->iter_idx++, t);
+    return MP_OBJ_FROM_PTR(t);
+}
+
+STATIC mp_obj_t poll_del(mp_obj_t self_in) {
+    mp_obj_poll_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->epoll_fd >= 0) {
+        close(self->epoll_fd);
+        self->epoll_fd = -1;
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(poll_del_obj, poll_del);
+
+#if DEBUG
+STATIC mp_obj_t poll_dump(mp_obj_t self_in) {
+    mp_obj_poll_t *self = MP_OBJ_TO_PTR(self_in);
+
+    for (size_t fd = 0; fd < self->entries_alloc; fd++) {
+        poll_entry_t *entry = &self->entries[fd];
+        if (entry->obj != MP_OBJ_NULL) {
+            printf("fd: %d ev: %x obj: %p%s\n", (int)fd, entry->events, entry->obj,
+                entry->always_ready ? " always ready" : "");
+        }
+    }
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(poll_dump_obj, poll_dump);
+#endif
+
+#else
+
+typedef struct _mp_obj_poll_t {
+    mp_obj_base_t base;
+    unsigned short alloc;
+    unsigned short len;
+    struct pollfd *entries;
+    mp_obj_t *obj_map;
+    short iter_cnt;
+    short iter_idx;
+    int flags;
+    // callee-owned tuple
+    mp_obj_t ret_tuple;
+} mp_obj_poll_t;
+
 /// \method register(obj[, eventmask])
 STATIC mp_obj_t poll_register(size_t n_args, const mp_obj_t *args) {
     mp_obj_poll_t *self = MP_OBJ_TO_PTR(args[0]);
@@ -298,12 +579,17 @@ STATIC mp_obj_t poll_dump(mp_obj_t self_in) {
 MP_DEFINE_CONST_FUN_OBJ_1(poll_dump_obj, poll_dump);
 #endif
 
+#endif // MICROPY_PY_USELECT_EPOLL
+
 STATIC const mp_rom_map_elem_t poll_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_register), MP_ROM_PTR(&poll_register_obj) },
     { MP_ROM_QSTR(MP_QSTR_unregister), MP_ROM_PTR(&poll_unregister_obj) },
     { MP_ROM_QSTR(MP_QSTR_modify), MP_ROM_PTR(&poll_modify_obj) },
     { MP_ROM_QSTR(MP_QSTR_poll), MP_ROM_PTR(&poll_poll_obj) },
     { MP_ROM_QSTR(MP_QSTR_ipoll), MP_ROM_PTR(&poll_ipoll_obj) },
+    #if MICROPY_PY_USELECT_EPOLL
+    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&poll_del_obj) },
+    #endif
     #if DEBUG
     { MP_ROM_QSTR(MP_QSTR_dump), MP_ROM_PTR(&poll_dump_obj) },
     #endif
@@ -323,13 +609,29 @@ STATIC mp_obj_t select_poll(size_t n_args, const mp_obj_t *args) {
     if (n_args > 0) {
         alloc = mp_obj_get_int(args[0]);
     }
+    #if MICROPY_PY_USELECT_EPOLL
+    // The finaliser closes the epoll fd.
+    mp_obj_poll_t *poll = m_new_obj_with_finaliser(mp_obj_poll_t);
+    poll->base.type = &mp_type_poll;
+    poll->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    RAISE_ERRNO(poll->epoll_fd, errno);
+    // alloc is taken as how many fds will be registered.
+    poll->entries_alloc = alloc + 4;
+    poll->entries = m_new0(poll_entry_t, poll->entries_alloc);
+    poll->len = 0;
+    poll->always_ready_len = 0;
+    poll->events_alloc = alloc + 1;
+    poll->events = m_new(struct epoll_event, poll->events_alloc);
+    #else
     mp_obj_poll_t *poll = m_new_obj(mp_obj_poll_t);
     poll->base.type = &mp_type_poll;
     poll->entries = m_new(struct pollfd, alloc);
     poll->alloc = alloc;
     poll->len = 0;
     poll->obj_map = NULL;
+    #endif
     poll->iter_cnt = 0;
+    poll->iter_idx = 0;
     poll->ret_tuple = MP_OBJ_NULL;
     return MP_OBJ_FROM_PTR(poll);
 }
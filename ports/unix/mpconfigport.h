@@ -28,6 +28,7 @@
 
 #define MICROPY_ALLOC_PATH_MAX      (PATH_MAX)
 #define MICROPY_PERSISTENT_CODE_LOAD (1)
+#define MICROPY_PERSISTENT_CODE_LOAD_XIP (1)
 #if !defined(MICROPY_EMIT_X64) && defined(__x86_64__)
     #define MICROPY_EMIT_X64        (1)
 #endif
@@ -38,12 +39,18 @@
     #define MICROPY_EMIT_THUMB      (1)
     #define MICROPY_MAKE_POINTER_CALLABLE(p) ((void*)((mp_uint_t)(p) | 1))
 #endif
+// mp_float_t is a double, which only fits in a machine word on 64-bit hosts.
+#if !defined(MICROPY_EMIT_NATIVE_FLOAT) && defined(__x86_64__)
+    #define MICROPY_EMIT_NATIVE_FLOAT (MICROPY_EMIT_X64)
+#endif
 // Some compilers define __thumb2__ and __arm__ at the same time, let
 // autodetected thumb2 emitter have priority.
 #if !defined(MICROPY_EMIT_ARM) && defined(__arm__) && !defined(__thumb2__)
     #define MICROPY_EMIT_ARM        (1)
 #endif
 #define MICROPY_COMP_MODULE_CONST   (1)
+#define MICROPY_COMP_CONST_STR      (1)
+#define MICROPY_COMP_INCREMENTAL    (1)
 #define MICROPY_COMP_TRIPLE_TUPLE_ASSIGN (1)
 #define MICROPY_COMP_RETURN_IF_EXPR (1)
 #define MICROPY_ENABLE_GC           (1)
@@ -56,6 +63,7 @@
 // check stdout a chance to pass, etc.
 #define MICROPY_DEBUG_PRINTER_DEST  mp_stderr_print
 #define MICROPY_READER_POSIX        (1)
+#define MICROPY_READER_BUF_SIZE     (256)
 #define MICROPY_USE_READLINE_HISTORY (1)
 #define MICROPY_HELPER_REPL         (1)
 #define MICROPY_REPL_EMACS_KEYS     (1)
@@ -67,17 +75,46 @@
 #define MICROPY_STREAMS_NON_BLOCK   (1)
 #define MICROPY_STREAMS_POSIX_API   (1)
 #define MICROPY_OPT_COMPUTED_GOTO   (1)
+#define MICROPY_OPT_FUSED_COMPARE_JUMP (1)
+#define MICROPY_OPT_BC_PEEPHOLE (1)
+#define MICROPY_OPT_FAST_RAISE (1)
+#define MICROPY_OPT_FAST_FOR_ITER (1)
+#define MICROPY_OPT_FAST_CALL_SETUP (1)
+#define MICROPY_OPT_QUICKEN_SMALL_INT_OPS (1)
 #ifndef MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE
 #define MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE (1)
 #endif
+#define MICROPY_OPT_TYPE_ATTR_CACHE (1)
+#define MICROPY_OPT_KWARGS_NO_INTERN (1)
+#define MICROPY_GC_IDLE_COLLECT     (1)
+#define MICROPY_GC_LAZY_SWEEP       (1)
+#define MICROPY_ENABLE_SCHEDULER    (1)
+#define MICROPY_GC_DEFERRED_FINALISER (1)
+#define MICROPY_OPT_BOUND_METH_CACHE (1)
+#define MICROPY_OPT_GLOBAL_LOOKUP_CACHE (1)
+#define MICROPY_OPT_LIST_TIMSORT (1)
+#define MICROPY_OPT_FAST_NUM_FORMAT (1)
+#define MICROPY_OPT_FAST_NUM_PARSE (1)
+#define MICROPY_OPT_LEXER_FAST_SCAN (1)
+#define MICROPY_OPT_MAP_COMPACT (1)
+#ifndef MICROPY_OPT_MAP_LOOKUP_CACHE
+#define MICROPY_OPT_MAP_LOOKUP_CACHE (1)
+#endif
+#define MICROPY_OPT_MPZ_KARATSUBA (1)
+#define MICROPY_OPT_MPZ_MONTGOMERY (1)
+#define MICROPY_OPT_FAST_SUBBYTES (1)
+#define MICROPY_OPT_STR_SLICE (1)
+#define MICROPY_OPT_STR_BUILDER (1)
 #define MICROPY_CAN_OVERRIDE_BUILTINS (1)
 #define MICROPY_PY_FUNCTION_ATTRS   (1)
 #define MICROPY_PY_DESCRIPTORS      (1)
+#define MICROPY_PY_SLOTS            (1)
 #define MICROPY_PY_BUILTINS_STR_UNICODE (1)
 #define MICROPY_PY_BUILTINS_STR_CENTER (1)
 #define MICROPY_PY_BUILTINS_STR_PARTITION (1)
 #define MICROPY_PY_BUILTINS_STR_SPLITLINES (1)
 #define MICROPY_PY_BUILTINS_MEMORYVIEW (1)
+#define MICROPY_PY_BUILTINS_MEMORYVIEW_CAST (1)
 #define MICROPY_PY_BUILTINS_FROZENSET (1)
 #define MICROPY_PY_BUILTINS_COMPILE (1)
 #define MICROPY_PY_BUILTINS_NOTIMPLEMENTED (1)
@@ -88,6 +125,7 @@
 #define MICROPY_PY_ALL_SPECIAL_METHODS (1)
 #define MICROPY_PY_REVERSE_SPECIAL_METHODS (1)
 #define MICROPY_PY_ARRAY_SLICE_ASSIGN (1)
+#define MICROPY_PY_ARRAY_ELEMENTWISE_OPS (1)
 #define MICROPY_PY_BUILTINS_SLICE_ATTRS (1)
 #define MICROPY_PY_SYS_EXIT         (1)
 #if defined(__APPLE__) && defined(__MACH__)
@@ -100,6 +138,7 @@
 #define MICROPY_PY_SYS_EXC_INFO     (1)
 #define MICROPY_PY_COLLECTIONS_DEQUE (1)
 #define MICROPY_PY_COLLECTIONS_ORDEREDDICT (1)
+#define MICROPY_PY_COLLECTIONS_NAMEDTUPLE__MAKE (1)
 #ifndef MICROPY_PY_MATH_SPECIAL_FUNCTIONS
 #define MICROPY_PY_MATH_SPECIAL_FUNCTIONS (1)
 #endif
@@ -108,6 +147,8 @@
 #define MICROPY_PY_IO_FILEIO        (1)
 #define MICROPY_PY_GC_COLLECT_RETVAL (1)
 #define MICROPY_MODULE_FROZEN_STR   (1)
+#define MICROPY_MODULE_FROZEN_INDEX (1)
+#define MICROPY_QSTR_HASH_INDEX     (1)
 
 #ifndef MICROPY_STACKLESS
 #define MICROPY_STACKLESS           (0)
@@ -120,10 +161,15 @@
 #define MICROPY_PY_UERRNO           (1)
 #define MICROPY_PY_UCTYPES          (1)
 #define MICROPY_PY_UZLIB            (1)
+#define MICROPY_PY_UZLIB_COMPRESS   (1)
 #define MICROPY_PY_UJSON            (1)
+#define MICROPY_PY_UJSON_ITERLOAD   (1)
 #define MICROPY_PY_URE              (1)
+#define MICROPY_PY_URE_PIKEVM       (1)
+#define MICROPY_PY_URE_CACHE_SIZE   (8)
 #define MICROPY_PY_UHEAPQ           (1)
 #define MICROPY_PY_UTIMEQ           (1)
+#define MICROPY_PY_UASYNCIO         (1)
 #define MICROPY_PY_UHASHLIB         (1)
 #if MICROPY_PY_USSL
 #define MICROPY_PY_UHASHLIB_SHA1    (1)
@@ -134,6 +180,10 @@
 #ifndef MICROPY_PY_USELECT_POSIX
 #define MICROPY_PY_USELECT_POSIX    (1)
 #endif
+// Waits with epoll(7) so a poll call costs time only for the fds that are ready.
+#ifndef MICROPY_PY_USELECT_EPOLL
+#define MICROPY_PY_USELECT_EPOLL    (defined(__linux__))
+#endif
 #define MICROPY_PY_WEBSOCKET        (1)
 #define MICROPY_PY_MACHINE          (1)
 #define MICROPY_PY_MACHINE_PULSE    (1)
@@ -273,6 +323,10 @@ void mp_unix_mark_exec(void);
 #define MICROPY_PLAT_DEV_MEM  (1)
 #endif
 
+// Decode translated messages with the lookup table and cache, as full
+// CircuitPython builds do
+#define CIRCUITPY_FAST_TRANSLATE (1)
+
 // Assume that select() call, interrupted with a signal, and erroring
 // with EINTR, updates remaining timeout value.
 #define MICROPY_SELECT_REMAINING_TIME (1)
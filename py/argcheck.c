@@ -28,6 +28,7 @@
 #include <assert.h>
 
 #include "py/runtime.h"
+#include "py/objstr.h"
 
 #include "supervisor/shared/translate.h"
 
@@ -85,8 +86,51 @@ void mp_arg_check_num_kw_array(size_t n_args, size_t n_kw, size_t n_args_min, si
     }
 }
 
+// Puts the value of each keyword argument in the out_vals slot of the allowed
+// argument it names, and MP_OBJ_NULL in the slots of the rest. This is one pass
+// over the given keywords comparing qstrs, instead of a map lookup for every
+// allowed argument. Returns how many keywords were matched.
+STATIC size_t mp_arg_match_kws(size_t n_pos, mp_map_t *kws, size_t n_allowed, const mp_arg_t *allowed, mp_arg_val_t *out_vals) {
+    for (size_t i = n_pos; i < n_allowed; i++) {
+        out_vals[i].u_obj = MP_OBJ_NULL;
+    }
+    size_t kws_found = 0;
+    for (size_t j = 0; j < kws->alloc; j++) {
+        if (!MP_MAP_SLOT_IS_FILLED(kws, j)) {
+            continue;
+        }
+        mp_obj_t key = kws->table[j].key;
+        qstr qst;
+        if (MP_OBJ_IS_QSTR(key)) {
+            qst = MP_OBJ_QSTR_VALUE(key);
+        } else if (MP_OBJ_IS_STR(key)) {
+            // A name that was never interned can't be one of the allowed ones.
+            GET_STR_DATA_LEN(key, str, len);
+            qst = qstr_find_strn((const char*)str, len);
+            if (qst == MP_QSTR_NULL) {
+                continue;
+            }
+        } else {
+            continue;
+        }
+        // Keywords naming an argument that was given positionally are left
+        // unmatched, so they are reported as extra.
+        for (size_t i = n_pos; i < n_allowed; i++) {
+            if (allowed[i].qst == qst) {
+                out_vals[i].u_obj = kws->table[j].value;
+                kws_found++;
+                break;
+            }
+        }
+    }
+    return kws_found;
+}
+
 void mp_arg_parse_all(size_t n_pos, const mp_obj_t *pos, mp_map_t *kws, size_t n_allowed, const mp_arg_t *allowed, mp_arg_val_t *out_vals) {
     size_t pos_found = 0, kws_found = 0;
+    if (kws->used > 0) {
+        kws_found = mp_arg_match_kws(n_pos, kws, n_allowed, allowed, out_vals);
+    }
     for (size_t i = 0; i < n_allowed; i++) {
         mp_obj_t given_arg;
         if (i < n_pos) {
@@ -96,8 +140,8 @@ void mp_arg_parse_all(size_t n_pos, const mp_obj_t *pos, mp_map_t *kws, size_t n
             pos_found++;
             given_arg = pos[i];
         } else {
-            mp_map_elem_t *kw = mp_map_lookup(kws, MP_OBJ_NEW_QSTR(allowed[i].qst), MP_MAP_LOOKUP);
-            if (kw == NULL) {
+            given_arg = kws->used > 0 ? out_vals[i].u_obj : MP_OBJ_NULL;
+            if (given_arg == MP_OBJ_NULL) {
                 if (allowed[i].flags & MP_ARG_REQUIRED) {
                     if (MICROPY_ERROR_REPORTING == MICROPY_ERROR_REPORTING_TERSE) {
                         mp_arg_error_terse_mismatch();
@@ -108,9 +152,6 @@ void mp_arg_parse_all(size_t n_pos, const mp_obj_t *pos, mp_map_t *kws, size_t n
                 }
                 out_vals[i] = allowed[i].defval;
                 continue;
-            } else {
-                kws_found++;
-                given_arg = kw->value;
             }
         }
         if ((allowed[i].flags & MP_ARG_KIND_MASK) == MP_ARG_BOOL) {
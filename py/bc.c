@@ -33,6 +33,7 @@
 #include "py/bc0.h"
 #include "py/bc.h"
 
+#include "supervisor/linker.h"
 #include "supervisor/shared/translate.h"
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
@@ -72,6 +73,76 @@ const byte *mp_decode_uint_skip(const byte *ptr) {
     return ptr;
 }
 
+// Decode the prelude of the function the given code state is executing: stores
+// the bytecode offset of code_state->ip, as counted by the line number table,
+// in *bc_out and the function name and source file in *block_name and
+// *source_file, and returns a pointer to the line number table.
+STATIC const byte *code_state_get_location(const mp_code_state_t *code_state, size_t *bc_out, qstr *block_name, qstr *source_file) {
+    const byte *ip = code_state->fun_bc->bytecode;
+    ip = mp_decode_uint_skip(ip); // skip n_state
+    ip = mp_decode_uint_skip(ip); // skip n_exc_stack
+    ip++; // skip scope_params
+    ip++; // skip n_pos_args
+    ip++; // skip n_kwonly_args
+    ip++; // skip n_def_pos_args
+    size_t bc = code_state->ip - ip;
+    size_t code_info_size = mp_decode_uint_value(ip);
+    ip = mp_decode_uint_skip(ip); // skip code_info_size
+    bc -= code_info_size;
+    #if MICROPY_PERSISTENT_CODE
+    *block_name = ip[0] | (ip[1] << 8);
+    *source_file = ip[2] | (ip[3] << 8);
+    ip += 4;
+    #else
+    *block_name = mp_decode_uint_value(ip);
+    ip = mp_decode_uint_skip(ip);
+    *source_file = mp_decode_uint_value(ip);
+    ip = mp_decode_uint_skip(ip);
+    #endif
+    *bc_out = bc;
+    return ip;
+}
+
+// Like mp_code_state_get_source_line() but returns the bytecode offset, which
+// takes constant time to work out.
+size_t mp_code_state_get_bc_offset(const mp_code_state_t *code_state, qstr *block_name, qstr *source_file) {
+    size_t bc;
+    code_state_get_location(code_state, &bc, block_name, source_file);
+    return bc;
+}
+
+// Work out where in the source code the given code state is currently
+// executing: returns the source line of the instruction at code_state->ip and
+// stores the function name and source file in *block_name and *source_file.
+size_t mp_code_state_get_source_line(const mp_code_state_t *code_state, qstr *block_name, qstr *source_file) {
+    size_t bc;
+    const byte *ip = code_state_get_location(code_state, &bc, block_name, source_file);
+    size_t source_line = 1;
+    size_t c;
+    while ((c = *ip)) {
+        size_t b, l;
+        if ((c & 0x80) == 0) {
+            // 0b0LLBBBBB encoding
+            b = c & 0x1f;
+            l = c >> 5;
+            ip += 1;
+        } else {
+            // 0b1LLLBBBB 0bLLLLLLLL encoding (l's LSB in second byte)
+            b = c & 0xf;
+            l = ((c << 4) & 0x700) | ip[1];
+            ip += 2;
+        }
+        if (bc >= b) {
+            bc -= b;
+            source_line += l;
+        } else {
+            // found source line corresponding to bytecode offset
+            break;
+        }
+    }
+    return source_line;
+}
+
 STATIC NORETURN void fun_pos_args_mismatch(mp_obj_fun_bc_t *f, size_t expected, size_t given) {
 #if MICROPY_ERROR_REPORTING == MICROPY_ERROR_REPORTING_TERSE
     // generic message, used also for other argument issues
@@ -107,7 +178,7 @@ STATIC void dump_args(const mp_obj_t *a, size_t sz) {
 //    - code_state->fun_bc should contain a pointer to the function object
 //    - code_state->ip should contain the offset in bytes from the pointer
 //      code_state->fun_bc->bytecode to the entry n_state (0 for bytecode, non-zero for native)
-void mp_setup_code_state(mp_code_state_t *code_state, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+void PLACE_IN_ITCM_HOT(mp_setup_code_state)(mp_code_state_t *code_state, size_t n_args, size_t n_kw, const mp_obj_t *args) {
     // This function is pretty complicated.  It's main aim is to be efficient in speed and RAM
     // usage for the common case of positional only args.
 
@@ -132,6 +203,22 @@ void mp_setup_code_state(mp_code_state_t *code_state, size_t n_args, size_t n_kw
     code_state->sp = &code_state->state[0] - 1;
     code_state->exc_sp = (mp_exc_stack_t*)(code_state->state + n_state) - 1;
 
+    #if MICROPY_OPT_FAST_CALL_SETUP
+    // Fast path for the most common call: exactly the positional args the
+    // function takes and nothing else, so there are no defaults, *args,
+    // **kwargs or keyword-only args to sort out. Only the slots below the
+    // args need zeroing since the args overwrite the rest.
+    if (n_args == n_pos_args && n_kw == 0 && n_kwonly_args == 0
+        && (scope_flags & (MP_SCOPE_FLAG_VARARGS | MP_SCOPE_FLAG_VARKEYWORDS | MP_SCOPE_FLAG_DEFKWARGS)) == 0) {
+        memset(code_state->state, 0, (n_state - n_args) * sizeof(*code_state->state));
+        mp_obj_t *fastn = &code_state->state[n_state - 1];
+        for (size_t i = 0; i < n_args; i++) {
+            fastn[-i] = args[i];
+        }
+        goto prelude;
+    }
+    #endif
+
     // zero out the local stack to begin with
     memset(code_state->state, 0, n_state * sizeof(*code_state->state));
 
@@ -192,6 +279,18 @@ void mp_setup_code_state(mp_code_state_t *code_state, size_t n_args, size_t n_kw
         for (size_t i = 0; i < n_kw; i++) {
             // the keys in kwargs are expected to be qstr objects
             mp_obj_t wanted_arg_name = kwargs[2 * i];
+            #if MICROPY_OPT_KWARGS_NO_INTERN
+            // A str key has no qstr so can't match any argument name.
+            if (MP_OBJ_IS_STR(wanted_arg_name) && !MP_OBJ_IS_QSTR(wanted_arg_name)) {
+                if ((scope_flags & MP_SCOPE_FLAG_VARKEYWORDS) == 0) {
+                    // Only intern the name to report it.
+                    wanted_arg_name = mp_obj_str_intern(wanted_arg_name);
+                    goto unexpected_kw;
+                }
+                mp_obj_dict_store(dict, wanted_arg_name, kwargs[2 * i + 1]);
+                continue;
+            }
+            #endif
             if(MP_UNLIKELY(!MP_OBJ_IS_QSTR(wanted_arg_name))) {
                 #if MICROPY_ERROR_REPORTING == MICROPY_ERROR_REPORTING_TERSE
                     mp_raise_TypeError(translate("unexpected keyword argument"));
@@ -211,6 +310,9 @@ void mp_setup_code_state(mp_code_state_t *code_state, size_t n_args, size_t n_kw
             }
             // Didn't find name match with positional args
             if ((scope_flags & MP_SCOPE_FLAG_VARKEYWORDS) == 0) {
+                #if MICROPY_OPT_KWARGS_NO_INTERN
+            unexpected_kw:
+                #endif
                 #if MICROPY_ERROR_REPORTING == MICROPY_ERROR_REPORTING_TERSE
                     mp_raise_TypeError(translate("unexpected keyword argument"));
                 #else
@@ -273,6 +375,9 @@ continue2:;
         }
     }
 
+    #if MICROPY_OPT_FAST_CALL_SETUP
+prelude:;
+    #endif
     // get the ip and skip argument names
     const byte *ip = code_state->ip;
 
@@ -297,10 +402,12 @@ continue2:;
 #if MICROPY_PERSISTENT_CODE_LOAD || MICROPY_PERSISTENT_CODE_SAVE
 
 // The following table encodes the number of bytes that a specific opcode
-// takes up.  There are 3 special opcodes that always have an extra byte:
+// takes up.  There are 5 special opcodes that always have an extra byte:
 //     MP_BC_MAKE_CLOSURE
 //     MP_BC_MAKE_CLOSURE_DEFARGS
 //     MP_BC_RAISE_VARARGS
+//     MP_BC_COMPARE_POP_JUMP_IF_TRUE (the comparison operator)
+//     MP_BC_COMPARE_POP_JUMP_IF_FALSE (the comparison operator)
 // There are 4 special opcodes that have an extra byte only when
 // MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE is enabled:
 //     MP_BC_LOAD_NAME
@@ -328,7 +435,7 @@ STATIC const byte opcode_format_table[64] = {
     OC4(U, U, U, U), // 0x2c-0x2f
     OC4(B, B, B, B), // 0x30-0x33
     OC4(B, O, O, O), // 0x34-0x37
-    OC4(O, O, U, U), // 0x38-0x3b
+    OC4(O, O, O, O), // 0x38-0x3b
     OC4(U, O, B, O), // 0x3c-0x3f
     OC4(O, B, B, O), // 0x40-0x43
     OC4(B, B, O, B), // 0x44-0x47
@@ -402,6 +509,8 @@ uint mp_opcode_format(const byte *ip, size_t *opcode_size) {
             *ip == MP_BC_RAISE_VARARGS
             || *ip == MP_BC_MAKE_CLOSURE
             || *ip == MP_BC_MAKE_CLOSURE_DEFARGS
+            || *ip == MP_BC_COMPARE_POP_JUMP_IF_TRUE
+            || *ip == MP_BC_COMPARE_POP_JUMP_IF_FALSE
             #if MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE
             || *ip == MP_BC_LOAD_NAME
             || *ip == MP_BC_LOAD_GLOBAL
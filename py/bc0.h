@@ -70,6 +70,8 @@
 #define MP_BC_POP_JUMP_IF_FALSE  (0x37) // rel byte code offset, 16-bit signed, in excess
 #define MP_BC_JUMP_IF_TRUE_OR_POP    (0x38) // rel byte code offset, 16-bit signed, in excess
 #define MP_BC_JUMP_IF_FALSE_OR_POP   (0x39) // rel byte code offset, 16-bit signed, in excess
+#define MP_BC_COMPARE_POP_JUMP_IF_TRUE  (0x3a) // byte, rel byte code offset, 16-bit signed, in excess
+#define MP_BC_COMPARE_POP_JUMP_IF_FALSE (0x3b) // byte, rel byte code offset, 16-bit signed, in excess
 #define MP_BC_SETUP_WITH         (0x3d) // rel byte code offset, 16-bit unsigned
 #define MP_BC_WITH_CLEANUP       (0x3e)
 #define MP_BC_SETUP_EXCEPT       (0x3f) // rel byte code offset, 16-bit unsigned
@@ -116,4 +118,17 @@
 #define MP_BC_UNARY_OP_MULTI             (0xd0) // + op(<MP_UNARY_OP_NUM_BYTECODE)
 #define MP_BC_BINARY_OP_MULTI            (0xd7) // + op(<MP_BINARY_OP_NUM_BYTECODE)
 
+// Specialised forms of some opcodes for small int operands.  These are never
+// emitted by the compiler: the VM rewrites the generic opcode in place the first
+// time it sees small int operands, and they fall back to the generic operation
+// when the operands turn out to be something else.
+#define MP_BC_BINARY_OP_SMALL_INT_LESS             (0xf8)
+#define MP_BC_BINARY_OP_SMALL_INT_MORE             (0xf9)
+#define MP_BC_BINARY_OP_SMALL_INT_EQUAL            (0xfa)
+#define MP_BC_BINARY_OP_SMALL_INT_INPLACE_ADD      (0xfb)
+#define MP_BC_BINARY_OP_SMALL_INT_INPLACE_SUBTRACT (0xfc)
+#define MP_BC_BINARY_OP_SMALL_INT_ADD              (0xfd)
+#define MP_BC_BINARY_OP_SMALL_INT_SUBTRACT         (0xfe)
+#define MP_BC_LOAD_SUBSCR_SMALL_INT                (0xff) // list or tuple indexed by small int
+
 #endif // MICROPY_INCLUDED_PY_BC0_H
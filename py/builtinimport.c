@@ -191,6 +191,190 @@ STATIC void do_execute_raw_code(mp_obj_t module_obj, mp_raw_code_t *raw_code, co
 }
 #endif
 
+#if MICROPY_MODULE_MPY_CACHE
+
+#if MICROPY_VFS
+#include "extmod/vfs.h"
+#include "py/stream.h"
+#elif defined(__i386__) || defined(__x86_64__) || defined(__unix__)
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#else
+#error MICROPY_MODULE_MPY_CACHE not implemented for this platform
+#endif
+
+// A cache file is this header followed by the .mpy data.  The header records
+// the size and mtime of the .py file that the cache was compiled from, both as
+// 32-bit little endian, so that editing the source invalidates the cache.
+#define MPY_CACHE_HEADER_SIZE (10)
+
+// Fills in the cache header for the given source file.  Returns false if the
+// source can't be stat'd, in which case the cache isn't used.
+STATIC bool mpy_cache_make_header(const char *path, byte *header) {
+    mp_uint_t size, mtime;
+    #if MICROPY_VFS
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) != 0) {
+        return false;
+    }
+    mp_obj_t *items;
+    mp_obj_get_array_fixed_n(mp_vfs_stat(mp_obj_new_str(path, strlen(path))), 10, &items);
+    size = mp_obj_get_int_truncated(items[6]);
+    mtime = mp_obj_get_int_truncated(items[8]);
+    nlr_pop();
+    #else
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        return false;
+    }
+    size = st.st_size;
+    mtime = st.st_mtime;
+    #endif
+    header[0] = 'C';
+    header[1] = 'M';
+    for (int i = 0; i < 4; ++i) {
+        header[2 + i] = size >> (8 * i);
+        header[6 + i] = mtime >> (8 * i);
+    }
+    return true;
+}
+
+// Fills in the path of the cache for the given .py file, which is the
+// MICROPY_MODULE_MPY_CACHE_DIR directory next to it, holding files with the
+// same name except for an .mpy extension.  The directory path is the part of
+// the result before the returned length.
+STATIC size_t mpy_cache_path(vstr_t *cache, const char *path, size_t len) {
+    const char *name = path + len;
+    while (name > path && name[-1] != PATH_SEP_CHAR) {
+        --name;
+    }
+    vstr_add_strn(cache, path, name - path);
+    vstr_add_str(cache, MICROPY_MODULE_MPY_CACHE_DIR);
+    size_t dir_len = cache->len;
+    vstr_add_char(cache, PATH_SEP_CHAR);
+    // the name ends in ".py", keep the dot and replace the extension
+    vstr_add_strn(cache, name, path + len - name - 2);
+    vstr_add_str(cache, "mpy");
+    return dir_len;
+}
+
+// Loads the cached raw code for a source file, or returns NULL if there is no
+// cache, it was compiled from a different version of the source or it can't
+// be loaded by this VM.
+STATIC mp_raw_code_t *mpy_cache_load(const char *cache_path, const byte *header) {
+    mp_reader_t reader;
+    bool volatile opened = false;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) != 0) {
+        // mp_raw_code_load only closes the reader when it succeeds
+        if (opened) {
+            reader.close(reader.data);
+        }
+        return NULL;
+    }
+    mp_reader_new_file(&reader, cache_path);
+    opened = true;
+    for (size_t i = 0; i < MPY_CACHE_HEADER_SIZE; ++i) {
+        if (reader.readbyte(reader.data) != header[i]) {
+            reader.close(reader.data);
+            nlr_pop();
+            return NULL;
+        }
+    }
+    mp_raw_code_t *raw_code = mp_raw_code_load(&reader);
+    nlr_pop();
+    return raw_code;
+}
+
+#if !MICROPY_VFS
+STATIC void mpy_cache_fd_print_strn(void *env, const char *str, size_t len) {
+    if (write((intptr_t)env, str, len) != (ssize_t)len) {
+        mp_raise_OSError(errno);
+    }
+}
+#endif
+
+// Writes the cache for a source file.  Any error is ignored, so a read-only
+// filesystem just means that the source is compiled on every import.
+STATIC void mpy_cache_save(vstr_t *cache, size_t dir_len, const byte *header, mp_raw_code_t *raw_code) {
+    const char *cache_path = vstr_null_terminated_str(cache);
+    #if MICROPY_VFS
+    mp_obj_t path_obj = mp_obj_new_str(cache_path, cache->len);
+    mp_obj_t volatile file = MP_OBJ_NULL;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        // ignore the error if the cache directory already exists
+        nlr_buf_t nlr_mkdir;
+        if (nlr_push(&nlr_mkdir) == 0) {
+            mp_vfs_mkdir(mp_obj_new_str(cache_path, dir_len));
+            nlr_pop();
+        }
+        mp_obj_t args[2] = { path_obj, MP_OBJ_NEW_QSTR(MP_QSTR_wb) };
+        file = mp_vfs_open(2, args, (mp_map_t*)&mp_const_empty_map);
+        mp_print_t print = {MP_OBJ_TO_PTR(file), mp_stream_write_adaptor};
+        print.print_strn(print.data, (const char*)header, MPY_CACHE_HEADER_SIZE);
+        mp_raw_code_save(raw_code, &print);
+        mp_stream_close(file);
+        nlr_pop();
+    } else if (file != MP_OBJ_NULL) {
+        // don't leave a partial cache behind, eg if the code can't be saved
+        if (nlr_push(&nlr) == 0) {
+            mp_stream_close(file);
+            mp_vfs_remove(path_obj);
+            nlr_pop();
+        }
+    }
+    #else
+    cache->buf[dir_len] = '\0';
+    mkdir(cache->buf, 0777);
+    cache->buf[dir_len] = PATH_SEP_CHAR;
+    int fd = open(cache_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return;
+    }
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_print_t print = {(void*)(intptr_t)fd, mpy_cache_fd_print_strn};
+        print.print_strn(print.data, (const char*)header, MPY_CACHE_HEADER_SIZE);
+        mp_raw_code_save(raw_code, &print);
+        nlr_pop();
+        close(fd);
+    } else {
+        // don't leave a partial cache behind, eg if the code can't be saved
+        close(fd);
+        unlink(cache_path);
+    }
+    #endif
+}
+
+// Loads a .py file, using its .mpy cache when that is up to date and
+// otherwise compiling the source and writing the result to the cache.
+STATIC void do_load_cached(mp_obj_t module_obj, const char *file_str, size_t file_len) {
+    byte header[MPY_CACHE_HEADER_SIZE];
+    if (!mpy_cache_make_header(file_str, header)) {
+        do_load_from_lexer(module_obj, mp_lexer_new_from_file(file_str));
+        return;
+    }
+
+    vstr_t cache;
+    vstr_init(&cache, file_len + sizeof(MICROPY_MODULE_MPY_CACHE_DIR) + 3);
+    size_t dir_len = mpy_cache_path(&cache, file_str, file_len);
+    mp_raw_code_t *raw_code = mpy_cache_load(vstr_null_terminated_str(&cache), header);
+    if (raw_code == NULL) {
+        mp_lexer_t *lex = mp_lexer_new_from_file(file_str);
+        qstr source_name = lex->source_name;
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        raw_code = mp_compile_to_raw_code(&parse_tree, source_name, MP_EMIT_OPT_NONE, false);
+        mpy_cache_save(&cache, dir_len, header, raw_code);
+    }
+    vstr_clear(&cache);
+    do_execute_raw_code(module_obj, raw_code, file_str);
+}
+
+#endif // MICROPY_MODULE_MPY_CACHE
+
 STATIC void do_load(mp_obj_t module_obj, vstr_t *file) {
     #if MICROPY_MODULE_FROZEN || MICROPY_PERSISTENT_CODE_LOAD || MICROPY_ENABLE_COMPILER
     char *file_str = vstr_null_terminated_str(file);
@@ -232,7 +416,18 @@ STATIC void do_load(mp_obj_t module_obj, vstr_t *file) {
     // the correct format and, if so, load and execute the file.
     #if MICROPY_PERSISTENT_CODE_LOAD
     if (file_str[file->len - 3] == 'm') {
-        mp_raw_code_t *raw_code = mp_raw_code_load_file(file_str);
+        mp_raw_code_t *raw_code;
+        #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+        size_t len;
+        void *owner;
+        const byte *buf = mp_import_map_file(file_str, &len, &owner);
+        if (buf != NULL) {
+            raw_code = mp_raw_code_load_rom(buf, len, owner);
+        } else
+        #endif
+        {
+            raw_code = mp_raw_code_load_file(file_str);
+        }
         do_execute_raw_code(module_obj, raw_code, file_str);
         return;
     }
@@ -241,8 +436,12 @@ STATIC void do_load(mp_obj_t module_obj, vstr_t *file) {
     // If we can compile scripts then load the file and compile and execute it.
     #if MICROPY_ENABLE_COMPILER
     {
+        #if MICROPY_MODULE_MPY_CACHE
+        do_load_cached(module_obj, file_str, file->len);
+        #else
         mp_lexer_t *lex = mp_lexer_new_from_file(file_str);
         do_load_from_lexer(module_obj, lex);
+        #endif
         return;
     }
     #else
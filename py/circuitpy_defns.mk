@@ -76,6 +76,9 @@ ifneq ($(FROZEN_MPY_DIRS),)
 CFLAGS += -DMICROPY_QSTR_EXTRA_POOL=mp_qstr_frozen_const_pool
 CFLAGS += -DMICROPY_MODULE_FROZEN_MPY
 CFLAGS += -Wno-error=lto-type-mismatch
+ifeq ($(CIRCUITPY_FROZEN_MPY_COMPRESSED),1)
+MPY_TOOL_FLAGS += --compress
+endif
 endif
 
 
@@ -116,6 +119,9 @@ endif
 ifeq ($(CIRCUITPY_AUDIOCORE),1)
 SRC_PATTERNS += audiocore/%
 endif
+ifeq ($(CIRCUITPY_AUDIOFILTERS),1)
+SRC_PATTERNS += audiofilters/%
+endif
 ifeq ($(CIRCUITPY_AUDIOMIXER),1)
 SRC_PATTERNS += audiomixer/%
 endif
@@ -165,6 +171,9 @@ endif
 ifeq ($(CIRCUITPY_I2CSLAVE),1)
 SRC_PATTERNS += i2cslave/%
 endif
+ifeq ($(CIRCUITPY_KEYPAD),1)
+SRC_PATTERNS += keypad/%
+endif
 ifeq ($(CIRCUITPY_MATH),1)
 SRC_PATTERNS += math/%
 endif
@@ -198,6 +207,9 @@ endif
 ifeq ($(CIRCUITPY_PS2IO),1)
 SRC_PATTERNS += ps2io/%
 endif
+ifeq ($(CIRCUITPY_PROFILER),1)
+SRC_PATTERNS += profiler/%
+endif
 ifeq ($(CIRCUITPY_RANDOM),1)
 SRC_PATTERNS += random/%
 endif
@@ -231,6 +243,9 @@ endif
 ifeq ($(CIRCUITPY_UHEAP),1)
 SRC_PATTERNS += uheap/%
 endif
+ifeq ($(CIRCUITPY_USB_BULK),1)
+SRC_PATTERNS += usb_bulk/%
+endif
 ifeq ($(CIRCUITPY_USB_HID),1)
 SRC_PATTERNS += usb_hid/%
 endif
@@ -243,6 +258,9 @@ endif
 ifeq ($(CIRCUITPY_WATCHDOG),1)
 SRC_PATTERNS += watchdog/%
 endif
+ifeq ($(CIRCUITPY_WIFI),1)
+SRC_PATTERNS += wifi/%
+endif
 ifeq ($(CIRCUITPY_PEW),1)
 SRC_PATTERNS += _pew/%
 endif
@@ -307,6 +325,8 @@ SRC_COMMON_HAL_ALL = \
 	watchdog/__init__.c \
 	watchdog/WatchDogMode.c \
 	watchdog/WatchDogTimer.c \
+	wifi/__init__.c \
+	wifi/Radio.c \
 
 SRC_COMMON_HAL = $(filter $(SRC_PATTERNS), $(SRC_COMMON_HAL_ALL))
 
@@ -342,9 +362,14 @@ SRC_SHARED_MODULE_ALL = \
 	_stage/__init__.c \
 	audiopwmio/__init__.c \
 	audioio/__init__.c \
+	audiobusio/PDMStream.c \
 	audiocore/__init__.c \
+	audiocore/ADPCM.c \
 	audiocore/RawSample.c \
 	audiocore/WaveFile.c \
+	audiofilters/__init__.c \
+	audiofilters/Biquad.c \
+	audiofilters/FIR.c \
 	audiomixer/__init__.c \
 	audiomixer/Mixer.c \
 	audiomixer/MixerVoice.c \
@@ -368,6 +393,7 @@ SRC_SHARED_MODULE_ALL = \
 	displayio/OnDiskBitmap.c \
 	displayio/Palette.c \
 	displayio/Shape.c \
+	displayio/TextLayer.c \
 	displayio/TileGrid.c \
 	displayio/__init__.c \
     vectorio/Circle.c \
@@ -376,6 +402,7 @@ SRC_SHARED_MODULE_ALL = \
     vectorio/VectorShape.c \
     vectorio/__init__.c \
 	fontio/BuiltinFont.c \
+	fontio/PackedFont.c \
 	fontio/__init__.c \
 	framebufferio/FramebufferDisplay.c \
 	framebufferio/__init__.c \
@@ -383,13 +410,21 @@ SRC_SHARED_MODULE_ALL = \
 	gamepad/__init__.c \
 	gamepadshift/GamePadShift.c \
 	gamepadshift/__init__.c \
+	keypad/__init__.c \
+	keypad/Event.c \
+	keypad/EventQueue.c \
+	keypad/KeyMatrix.c \
+	keypad/Keys.c \
+	keypad/ShiftRegisterKeys.c \
 	os/__init__.c \
+	profiler/__init__.c \
 	random/__init__.c \
 	socket/__init__.c \
 	network/__init__.c \
 	rgbmatrix/RGBMatrix.c \
 	rgbmatrix/__init__.c \
 	storage/__init__.c \
+	struct/Struct.c \
 	struct/__init__.c \
 	time/__init__.c \
 	terminalio/Terminal.c \
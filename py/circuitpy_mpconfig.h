@@ -54,6 +54,7 @@
 #define MICROPY_CAN_OVERRIDE_BUILTINS    (1)
 #define MICROPY_COMP_CONST               (1)
 #define MICROPY_COMP_DOUBLE_TUPLE_ASSIGN (1)
+#define MICROPY_COMP_INCREMENTAL         (1)
 #define MICROPY_COMP_MODULE_CONST        (1)
 #define MICROPY_COMP_TRIPLE_TUPLE_ASSIGN (0)
 #define MICROPY_DEBUG_PRINTERS           (0)
@@ -68,13 +69,23 @@
 #define MICROPY_FLOAT_HIGH_QUALITY_HASH  (0)
 #define MICROPY_FLOAT_IMPL               (MICROPY_FLOAT_IMPL_FLOAT)
 #define MICROPY_GC_ALLOC_THRESHOLD       (0)
+#define MICROPY_GC_IDLE_COLLECT          (1)
+#define MICROPY_GC_LAZY_SWEEP            (CIRCUITPY_FULL_BUILD)
 #define MICROPY_HELPER_LEXER_UNIX        (0)
 #define MICROPY_HELPER_REPL              (1)
 #define MICROPY_KBD_EXCEPTION            (1)
 #define MICROPY_MEM_STATS                (0)
 #define MICROPY_MODULE_BUILTIN_INIT      (1)
+#define MICROPY_MODULE_FROZEN_INDEX      (1)
+#define MICROPY_MODULE_FROZEN_MPY_COMPRESSED (CIRCUITPY_FROZEN_MPY_COMPRESSED)
 #define MICROPY_NONSTANDARD_TYPECODES    (0)
 #define MICROPY_OPT_COMPUTED_GOTO        (1)
+#define MICROPY_OPT_FUSED_COMPARE_JUMP   (1)
+#define MICROPY_OPT_BC_PEEPHOLE          (1)
+#define MICROPY_OPT_FAST_RAISE           (1)
+#define MICROPY_OPT_FAST_FOR_ITER        (1)
+#define MICROPY_OPT_FAST_CALL_SETUP      (1)
+#define MICROPY_OPT_QUICKEN_SMALL_INT_OPS (1)
 #define MICROPY_PERSISTENT_CODE_LOAD     (1)
 
 #define MICROPY_PY_ARRAY                 (1)
@@ -100,7 +111,9 @@
 
 #define MICROPY_PY_CMATH                 (0)
 #define MICROPY_PY_COLLECTIONS           (1)
+#define MICROPY_PY_COLLECTIONS_NAMEDTUPLE__MAKE (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_DESCRIPTORS           (1)
+#define MICROPY_PY_SLOTS                 (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_IO_FILEIO             (1)
 #define MICROPY_PY_GC                    (1)
 // Supplanted by shared-bindings/math
@@ -111,12 +124,14 @@
 #define MICROPY_PY_SYS                   (1)
 #define MICROPY_PY_SYS_MAXSIZE           (1)
 #define MICROPY_PY_SYS_STDFILES          (1)
+#define MICROPY_PY_THREAD                (CIRCUITPY_THREAD)
 // Supplanted by shared-bindings/random
 #define MICROPY_PY_URANDOM               (0)
 #define MICROPY_PY_URANDOM_EXTRA_FUNCS   (0)
 #define MICROPY_PY___FILE__              (1)
 
 #define MICROPY_QSTR_BYTES_IN_HASH       (1)
+#define MICROPY_QSTR_HASH_INDEX          (CIRCUITPY_FULL_BUILD)
 #define MICROPY_REPL_AUTO_INDENT         (1)
 #define MICROPY_REPL_EVENT_DRIVEN        (0)
 #define MICROPY_STACK_CHECK              (1)
@@ -133,6 +148,8 @@
 #define MICROPY_FATFS_USE_LABEL       (1)
 #define MICROPY_FATFS_RPATH           (2)
 #define MICROPY_FATFS_MULTI_PARTITION (1)
+// Lets data loggers preallocate a contiguous file with file.preallocate().
+#define MICROPY_FATFS_USE_EXPAND      (CIRCUITPY_FULL_BUILD)
 
 // Only enable this if you really need it. It allocates a byte cache of this size.
 // #define MICROPY_FATFS_MAX_SS           (4096)
@@ -142,6 +159,12 @@
 #define MICROPY_VFS                 (1)
 #define MICROPY_VFS_FAT             (MICROPY_VFS)
 #define MICROPY_READER_VFS          (MICROPY_VFS)
+#define MICROPY_READER_BUF_SIZE     (CIRCUITPY_FULL_BUILD ? 512 : 24)
+#if CIRCUITPY_FULL_BUILD
+#define MICROPY_VFS_FAT_READ_AHEAD_SIZE (1024)
+#endif
+// Lets code mount a RAM-backed filesystem for scratch files.
+#define MICROPY_VFS_RAMBLOCKDEV     (CIRCUITPY_FULL_BUILD)
 
 // type definitions for the specific machine
 
@@ -185,7 +208,27 @@ typedef long mp_off_t;
 #define MICROPY_BUILTIN_METHOD_CHECK_SELF_ARG (CIRCUITPY_FULL_BUILD)
 #define MICROPY_CPYTHON_COMPAT                (CIRCUITPY_FULL_BUILD)
 #define MICROPY_COMP_FSTRING_LITERAL          (MICROPY_CPYTHON_COMPAT)
+#define MICROPY_MODULE_MPY_CACHE              (CIRCUITPY_FULL_BUILD)
 #define MICROPY_MODULE_WEAK_LINKS             (CIRCUITPY_FULL_BUILD)
+#define MICROPY_PY_UJSON_ITERLOAD             (CIRCUITPY_FULL_BUILD)
+#define MICROPY_PY_ARRAY_ELEMENTWISE_OPS      (CIRCUITPY_FULL_BUILD)
+#define MICROPY_PY_BUILTINS_MEMORYVIEW_CAST   (CIRCUITPY_FULL_BUILD)
+#define MICROPY_OPT_TYPE_ATTR_CACHE           (CIRCUITPY_FULL_BUILD)
+#define MICROPY_OPT_KWARGS_NO_INTERN          (1)
+#define MICROPY_OPT_BOUND_METH_CACHE          (CIRCUITPY_FULL_BUILD)
+#define MICROPY_OPT_GLOBAL_LOOKUP_CACHE       (CIRCUITPY_FULL_BUILD)
+#define MICROPY_OPT_LIST_TIMSORT              (CIRCUITPY_FULL_BUILD)
+#define MICROPY_OPT_FAST_NUM_FORMAT           (CIRCUITPY_FULL_BUILD)
+#define MICROPY_OPT_FAST_NUM_PARSE            (CIRCUITPY_FULL_BUILD)
+#define MICROPY_OPT_LEXER_FAST_SCAN           (1)
+#define MICROPY_OPT_MAP_COMPACT               (CIRCUITPY_FULL_BUILD)
+#define MICROPY_OPT_MAP_LOOKUP_CACHE          (CIRCUITPY_FULL_BUILD)
+#define MICROPY_OPT_MPZ_KARATSUBA             (CIRCUITPY_FULL_BUILD)
+#define MICROPY_OPT_MPZ_MONTGOMERY            (CIRCUITPY_FULL_BUILD)
+#define MICROPY_OPT_FAST_SUBBYTES             (CIRCUITPY_FULL_BUILD)
+#define MICROPY_OPT_STR_SLICE                 (CIRCUITPY_FULL_BUILD)
+#define MICROPY_OPT_STR_BUILDER               (CIRCUITPY_FULL_BUILD)
+#define MICROPY_PERSISTENT_CODE_SAVE          (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_ALL_SPECIAL_METHODS        (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_COMPLEX           (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_FROZENSET         (CIRCUITPY_FULL_BUILD)
@@ -201,6 +244,11 @@ typedef long mp_off_t;
 #define MICROPY_PY_URE_MATCH_GROUPS           (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_URE_MATCH_SPAN_START_END   (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_URE_SUB                    (CIRCUITPY_FULL_BUILD)
+#define MICROPY_PY_URE_PIKEVM                 (CIRCUITPY_FULL_BUILD)
+#define MICROPY_PY_URE_CACHE_SIZE             (CIRCUITPY_FULL_BUILD ? 4 : 0)
+#ifndef MICROPY_PY_USELECT
+#define MICROPY_PY_USELECT                    (CIRCUITPY_FULL_BUILD)
+#endif
 
 // LONGINT_IMPL_xxx are defined in the Makefile.
 //
@@ -253,10 +301,27 @@ extern const struct _mp_obj_module_t audiobusio_module;
 #if CIRCUITPY_AUDIOCORE
 #define AUDIOCORE_MODULE         { MP_OBJ_NEW_QSTR(MP_QSTR_audiocore), (mp_obj_t)&audiocore_module },
 extern const struct _mp_obj_module_t audiocore_module;
+// Blocks a WaveFile reads ahead of playback by default, from background
+// tasks, so a slow filesystem read doesn't starve the audio output.
+#ifndef CIRCUITPY_AUDIOCORE_WAVEFILE_READ_AHEAD
+#define CIRCUITPY_AUDIOCORE_WAVEFILE_READ_AHEAD (2)
+#endif
+// Audio outputs time how long filling each buffer takes and how close it
+// comes to the hardware running out, for audiocore.stats().
+#ifndef CIRCUITPY_AUDIOCORE_STATS
+#define CIRCUITPY_AUDIOCORE_STATS (CIRCUITPY_FULL_BUILD)
+#endif
 #else
 #define AUDIOCORE_MODULE
 #endif
 
+#if CIRCUITPY_AUDIOFILTERS
+#define AUDIOFILTERS_MODULE       { MP_OBJ_NEW_QSTR(MP_QSTR_audiofilters), (mp_obj_t)&audiofilters_module },
+extern const struct _mp_obj_module_t audiofilters_module;
+#else
+#define AUDIOFILTERS_MODULE
+#endif
+
 #if CIRCUITPY_AUDIOIO
 #define AUDIOIO_MODULE         { MP_OBJ_NEW_QSTR(MP_QSTR_audioio), (mp_obj_t)&audioio_module },
 extern const struct _mp_obj_module_t audioio_module;
@@ -274,6 +339,16 @@ extern const struct _mp_obj_module_t audiomixer_module;
 #if CIRCUITPY_AUDIOMP3
 #define AUDIOMP3_MODULE         { MP_OBJ_NEW_QSTR(MP_QSTR_audiomp3), (mp_obj_t)&audiomp3_module },
 extern const struct _mp_obj_module_t audiomp3_module;
+// Frames a MP3Decoder decodes ahead of playback by default, from background
+// tasks, so that decoding is spread out rather than done in a burst per frame.
+#ifndef CIRCUITPY_AUDIOMP3_READ_AHEAD
+#define CIRCUITPY_AUDIOMP3_READ_AHEAD (1)
+#endif
+// Bytes of the file a MP3Decoder buffers for the decoder. It is refilled once
+// it is half empty, so half of it should hold the largest frame to be played.
+#ifndef CIRCUITPY_AUDIOMP3_INBUF_SIZE
+#define CIRCUITPY_AUDIOMP3_INBUF_SIZE (2048)
+#endif
 #else
 #define AUDIOMP3_MODULE
 #endif
@@ -323,6 +398,11 @@ extern const struct _mp_obj_module_t board_module;
 #if CIRCUITPY_BUSIO
 extern const struct _mp_obj_module_t busio_module;
 #define BUSIO_MODULE           { MP_OBJ_NEW_QSTR(MP_QSTR_busio), (mp_obj_t)&busio_module },
+// Ports that can run an SPI transfer with DMA set this so that busio.SPI
+// can start a transfer and return while it is still going.
+#ifndef CIRCUITPY_BUSIO_SPI_BACKGROUND
+#define CIRCUITPY_BUSIO_SPI_BACKGROUND (0)
+#endif
 #else
 #define BUSIO_MODULE
 #endif
@@ -351,6 +431,40 @@ extern const struct _mp_obj_module_t terminalio_module;
 #ifndef CIRCUITPY_DISPLAY_LIMIT
 #define CIRCUITPY_DISPLAY_LIMIT (1)
 #endif
+// Size, in uint32_ts, of the stack buffer a display area is rendered into before
+// it's sent. Boards with RAM to spare can use larger chunks, so fewer are sent.
+#ifndef CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE
+#define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (128)
+#endif
+// Most areas refreshed separately per frame. More dirty areas than this are
+// merged together before they're sent.
+#ifndef CIRCUITPY_DISPLAY_REFRESH_AREA_LIMIT
+#define CIRCUITPY_DISPLAY_REFRESH_AREA_LIMIT (8)
+#endif
+// Roughly what setting up another window costs, in pixels sent. Two areas are
+// refreshed as one when their union adds no more than this many pixels.
+#ifndef CIRCUITPY_DISPLAY_AREA_OVERHEAD_PIXELS
+#define CIRCUITPY_DISPLAY_AREA_OVERHEAD_PIXELS (64)
+#endif
+// Milliseconds left for other background tasks and user code after each auto
+// refresh, even when a frame takes longer to draw than the frame rate allows.
+#ifndef CIRCUITPY_DISPLAY_FRAME_GAP_MS
+#define CIRCUITPY_DISPLAY_FRAME_GAP_MS (4)
+#endif
+// Console output shown on the display is gathered in a buffer this big and
+// drawn at most once every CIRCUITPY_TERMINAL_MS_PER_RENDER, so printing a lot
+// doesn't redraw the display for every line.
+#ifndef CIRCUITPY_TERMINAL_BUFFER_SIZE
+#define CIRCUITPY_TERMINAL_BUFFER_SIZE (256)
+#endif
+#ifndef CIRCUITPY_TERMINAL_MS_PER_RENDER
+#define CIRCUITPY_TERMINAL_MS_PER_RENDER (100)
+#endif
+// Ports whose ParallelBus can stream pixels in the background set this, and
+// provide common_hal_displayio_parallelbus_send_async and _wait_for_send.
+#ifndef CIRCUITPY_DISPLAYIO_PARALLELBUS_DMA
+#define CIRCUITPY_DISPLAYIO_PARALLELBUS_DMA (0)
+#endif
 #else
 #define DISPLAYIO_MODULE
 #define FONTIO_MODULE
@@ -408,6 +522,15 @@ extern const struct _mp_obj_module_t i2cslave_module;
 #define I2CSLAVE_MODULE
 #endif
 
+#if CIRCUITPY_KEYPAD
+extern const struct _mp_obj_module_t keypad_module;
+#define KEYPAD_MODULE          { MP_OBJ_NEW_QSTR(MP_QSTR_keypad), (mp_obj_t)&keypad_module },
+#define KEYPAD_ROOT_POINTERS mp_obj_t keypad_scanners_list;
+#else
+#define KEYPAD_MODULE
+#define KEYPAD_ROOT_POINTERS
+#endif
+
 #if CIRCUITPY_MATH
 extern const struct _mp_obj_module_t math_module;
 #define MATH_MODULE            { MP_OBJ_NEW_QSTR(MP_QSTR_math), (mp_obj_t)&math_module },
@@ -432,6 +555,11 @@ extern const struct _mp_obj_module_t microcontroller_module;
 #if CIRCUITPY_NEOPIXEL_WRITE
 extern const struct _mp_obj_module_t neopixel_write_module;
 #define NEOPIXEL_WRITE_MODULE  { MP_OBJ_NEW_QSTR(MP_QSTR_neopixel_write),(mp_obj_t)&neopixel_write_module },
+// Ports that can clock out pixels with DMA set this so that neopixel_write
+// can return while the pixels are still being sent.
+#ifndef CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND
+#define CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND (0)
+#endif
 #else
 #define NEOPIXEL_WRITE_MODULE
 #endif
@@ -445,6 +573,8 @@ extern const struct _mp_obj_module_t socket_module;
 #if MICROPY_PY_WIZNET5K
     extern const struct _mp_obj_module_t wiznet_module;
     #define WIZNET_MODULE        { MP_OBJ_NEW_QSTR(MP_QSTR_wiznet), (mp_obj_t)&wiznet_module },
+#else
+    #define WIZNET_MODULE
 #endif
 #else
 #define NETWORK_MODULE
@@ -502,6 +632,14 @@ extern const struct _mp_obj_module_t ps2io_module;
 #define PS2IO_MODULE
 #endif
 
+#if CIRCUITPY_PROFILER
+extern const struct _mp_obj_module_t profiler_module;
+#define PROFILER_MODULE      { MP_OBJ_NEW_QSTR(MP_QSTR_profiler), (mp_obj_t)&profiler_module },
+#define MICROPY_TRACK_CODE_STATE (1)
+#else
+#define PROFILER_MODULE
+#endif
+
 #if CIRCUITPY_RANDOM
 extern const struct _mp_obj_module_t random_module;
 #define RANDOM_MODULE          { MP_OBJ_NEW_QSTR(MP_QSTR_random), (mp_obj_t)&random_module },
@@ -530,6 +668,20 @@ extern const struct _mp_obj_module_t samd_module;
 #define SAMD_MODULE
 #endif
 
+#if CIRCUITPY_ESPULP
+extern const struct _mp_obj_module_t espulp_module;
+#define ESPULP_MODULE          { MP_OBJ_NEW_QSTR(MP_QSTR_espulp),(mp_obj_t)&espulp_module },
+#else
+#define ESPULP_MODULE
+#endif
+
+#if CIRCUITPY_SUBCORE
+extern const struct _mp_obj_module_t subcore_module;
+#define SUBCORE_MODULE         { MP_OBJ_NEW_QSTR(MP_QSTR_subcore),(mp_obj_t)&subcore_module },
+#else
+#define SUBCORE_MODULE
+#endif
+
 #if CIRCUITPY_STAGE
 extern const struct _mp_obj_module_t stage_module;
 #define STAGE_MODULE           { MP_OBJ_NEW_QSTR(MP_QSTR__stage), (mp_obj_t)&stage_module },
@@ -574,13 +726,25 @@ extern const struct _mp_obj_module_t touchio_module;
 #define TOUCHIO_MODULE
 #endif
 
+#if CIRCUITPY_GC_TRACE
+#define MICROPY_GC_TRACE (1)
+#endif
+
 #if CIRCUITPY_UHEAP
 extern const struct _mp_obj_module_t uheap_module;
 #define UHEAP_MODULE           { MP_OBJ_NEW_QSTR(MP_QSTR_uheap),(mp_obj_t)&uheap_module },
+#define MICROPY_GC_ALLOC_PROFILE (1)
 #else
 #define UHEAP_MODULE
 #endif
 
+#if CIRCUITPY_USB_BULK
+extern const struct _mp_obj_module_t usb_bulk_module;
+#define USB_BULK_MODULE        { MP_OBJ_NEW_QSTR(MP_QSTR_usb_bulk),(mp_obj_t)&usb_bulk_module },
+#else
+#define USB_BULK_MODULE
+#endif
+
 #if CIRCUITPY_USB_HID
 extern const struct _mp_obj_module_t usb_hid_module;
 #define USB_HID_MODULE         { MP_OBJ_NEW_QSTR(MP_QSTR_usb_hid),(mp_obj_t)&usb_hid_module },
@@ -632,6 +796,12 @@ extern const struct _mp_obj_module_t ustack_module;
 #define RE_MODULE
 #endif
 
+#if MICROPY_PY_USELECT
+#define SELECT_MODULE { MP_ROM_QSTR(MP_QSTR_select), MP_ROM_PTR(&mp_module_uselect) },
+#else
+#define SELECT_MODULE
+#endif
+
 // This is not a top-level module; it's microcontroller.watchdog.
 #if CIRCUITPY_WATCHDOG
 extern const struct _mp_obj_module_t watchdog_module;
@@ -640,6 +810,13 @@ extern const struct _mp_obj_module_t watchdog_module;
 #define WATCHDOG_MODULE
 #endif
 
+#if CIRCUITPY_WIFI
+extern const struct _mp_obj_module_t wifi_module;
+#define WIFI_MODULE { MP_ROM_QSTR(MP_QSTR_wifi), MP_ROM_PTR(&wifi_module) },
+#else
+#define WIFI_MODULE
+#endif
+
 // Define certain native modules with weak links so they can be replaced with Python
 // implementations. This list may grow over time.
 #define MICROPY_PORT_BUILTIN_MODULE_WEAK_LINKS \
@@ -663,6 +840,7 @@ extern const struct _mp_obj_module_t watchdog_module;
     ANALOGIO_MODULE \
     AUDIOBUSIO_MODULE \
     AUDIOCORE_MODULE \
+    AUDIOFILTERS_MODULE \
     AUDIOIO_MODULE \
     AUDIOMIXER_MODULE \
     AUDIOMP3_MODULE \
@@ -678,12 +856,14 @@ extern const struct _mp_obj_module_t watchdog_module;
       TERMINALIO_MODULE \
       VECTORIO_MODULE \
     ERRNO_MODULE \
+    ESPULP_MODULE \
     FRAMEBUFFERIO_MODULE \
     FREQUENCYIO_MODULE \
     GAMEPAD_MODULE \
     GAMEPADSHIFT_MODULE \
     I2CSLAVE_MODULE \
     JSON_MODULE \
+    KEYPAD_MODULE \
     MATH_MODULE \
     _EVE_MODULE \
     MICROCONTROLLER_MODULE \
@@ -694,6 +874,7 @@ extern const struct _mp_obj_module_t watchdog_module;
     PEW_MODULE \
     PIXELBUF_MODULE \
     PS2IO_MODULE \
+    PROFILER_MODULE \
     PULSEIO_MODULE \
     RANDOM_MODULE \
     RE_MODULE \
@@ -701,16 +882,20 @@ extern const struct _mp_obj_module_t watchdog_module;
     ROTARYIO_MODULE \
     RTC_MODULE \
     SAMD_MODULE \
+    SELECT_MODULE \
     STAGE_MODULE \
     STORAGE_MODULE \
     STRUCT_MODULE \
+    SUBCORE_MODULE \
     SUPERVISOR_MODULE \
     TOUCHIO_MODULE \
     UHEAP_MODULE \
+    USB_BULK_MODULE \
     USB_HID_MODULE \
     USB_MIDI_MODULE \
     USTACK_MODULE \
     WATCHDOG_MODULE \
+    WIFI_MODULE \
 
 // If weak links are enabled, just include strong links in the main list of modules,
 // and also include the underscore alternate names.
@@ -737,6 +922,7 @@ extern const struct _mp_obj_module_t watchdog_module;
     vstr_t *repl_line; \
     mp_obj_t rtc_time_source; \
     GAMEPAD_ROOT_POINTERS \
+    KEYPAD_ROOT_POINTERS \
     mp_obj_t pew_singleton; \
     mp_obj_t terminal_tilegrid_tiles; \
     BOARD_UART_ROOT_POINTER \
@@ -752,6 +938,10 @@ void supervisor_run_background_tasks_if_tick(void);
 #define MICROPY_VM_HOOK_LOOP RUN_BACKGROUND_TASKS;
 #define MICROPY_VM_HOOK_RETURN RUN_BACKGROUND_TASKS;
 
+// Called by uselect between polls of its streams.
+void supervisor_event_poll_hook(void);
+#define MICROPY_EVENT_POLL_HOOK supervisor_event_poll_hook();
+
 // CIRCUITPY_AUTORELOAD_DELAY_MS = 0 will completely disable autoreload.
 #ifndef CIRCUITPY_AUTORELOAD_DELAY_MS
 #define CIRCUITPY_AUTORELOAD_DELAY_MS 500
@@ -761,6 +951,37 @@ void supervisor_run_background_tasks_if_tick(void);
 #define CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS 1000
 #endif
 
+// Longest time, in microseconds, spent marking in one incremental GC slice
+// while idle. Only used when MICROPY_GC_INCREMENTAL is enabled.
+#ifndef CIRCUITPY_GC_INCREMENTAL_BUDGET_US
+#define CIRCUITPY_GC_INCREMENTAL_BUDGET_US 1000
+#endif
+
+// Shortest mp_hal_delay_ms, in milliseconds, that may run a full collection
+// when one is due. Only used when MICROPY_GC_IDLE_COLLECT is enabled.
+#ifndef CIRCUITPY_GC_IDLE_COLLECT_MIN_DELAY_MS
+#define CIRCUITPY_GC_IDLE_COLLECT_MIN_DELAY_MS 10
+#endif
+
+// Time, in microseconds, after which a background pass only runs the tasks
+// that have reached their deadline.
+#ifndef CIRCUITPY_BACKGROUND_TASKS_BUDGET_US
+#define CIRCUITPY_BACKGROUND_TASKS_BUDGET_US 500
+#endif
+
+// Stop the tick in mp_hal_delay_ms while it is only needed to count down to
+// deadlines, such as autoreload and filesystem flushes.
+#ifndef CIRCUITPY_TICKLESS_IDLE
+#define CIRCUITPY_TICKLESS_IDLE (1)
+#endif
+
+// Keep frozen modules, and the heap they live on, across soft reloads so the
+// next VM doesn't have to import them again. Module state then survives a
+// reload, so this is off unless a board opts in.
+#ifndef CIRCUITPY_MODULE_SNAPSHOT
+#define CIRCUITPY_MODULE_SNAPSHOT (0)
+#endif
+
 #define CIRCUITPY_BOOT_OUTPUT_FILE "/boot_out.txt"
 
 #define CIRCUITPY_VERBOSE_BLE 0
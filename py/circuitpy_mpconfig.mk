@@ -36,6 +36,10 @@ CFLAGS += -DCIRCUITPY_FULL_BUILD=$(CIRCUITPY_FULL_BUILD)
 CIRCUITPY_AESIO ?= 0
 CFLAGS += -DCIRCUITPY_AESIO=$(CIRCUITPY_AESIO)
 
+# Whether the port provides aesio_hw_encrypt_block() for aesio
+CIRCUITPY_AESIO_HW ?= 0
+CFLAGS += -DCIRCUITPY_AESIO_HW=$(CIRCUITPY_AESIO_HW)
+
 CIRCUITPY_ANALOGIO ?= 1
 CFLAGS += -DCIRCUITPY_ANALOGIO=$(CIRCUITPY_ANALOGIO)
 
@@ -63,6 +67,15 @@ CFLAGS += -DCIRCUITPY_AUDIOCORE=$(CIRCUITPY_AUDIOCORE)
 CIRCUITPY_AUDIOMIXER ?= $(CIRCUITPY_AUDIOIO)
 CFLAGS += -DCIRCUITPY_AUDIOMIXER=$(CIRCUITPY_AUDIOMIXER)
 
+ifndef CIRCUITPY_AUDIOFILTERS
+ifeq ($(CIRCUITPY_FULL_BUILD),1)
+CIRCUITPY_AUDIOFILTERS = $(CIRCUITPY_AUDIOMIXER)
+else
+CIRCUITPY_AUDIOFILTERS = 0
+endif
+endif
+CFLAGS += -DCIRCUITPY_AUDIOFILTERS=$(CIRCUITPY_AUDIOFILTERS)
+
 ifndef CIRCUITPY_AUDIOMP3
 ifeq ($(CIRCUITPY_FULL_BUILD),1)
 CIRCUITPY_AUDIOMP3 = $(CIRCUITPY_AUDIOCORE)
@@ -109,6 +122,9 @@ CFLAGS += -DCIRCUITPY_GAMEPAD=$(CIRCUITPY_GAMEPAD)
 CIRCUITPY_GAMEPADSHIFT ?= 0
 CFLAGS += -DCIRCUITPY_GAMEPADSHIFT=$(CIRCUITPY_GAMEPADSHIFT)
 
+CIRCUITPY_KEYPAD ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_KEYPAD=$(CIRCUITPY_KEYPAD)
+
 CIRCUITPY_I2CSLAVE ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_I2CSLAVE=$(CIRCUITPY_I2CSLAVE)
 
@@ -163,6 +179,21 @@ CFLAGS += -DCIRCUITPY_RTC=$(CIRCUITPY_RTC)
 CIRCUITPY_SAMD ?= 0
 CFLAGS += -DCIRCUITPY_SAMD=$(CIRCUITPY_SAMD)
 
+# Place the hot paths listed in supervisor/linker.h in ITCM, on ports that
+# have tightly coupled memory with room for them.
+CIRCUITPY_ITCM_HOT_PATHS ?= 0
+CFLAGS += -DCIRCUITPY_ITCM_HOT_PATHS=$(CIRCUITPY_ITCM_HOT_PATHS)
+
+# CIRCUITPY_ESPULP is handled in the esp32s2 tree.
+# Only for chips with a ULP-RISC-V coprocessor.
+CIRCUITPY_ESPULP ?= 0
+CFLAGS += -DCIRCUITPY_ESPULP=$(CIRCUITPY_ESPULP)
+
+# CIRCUITPY_SUBCORE is handled in the cxd56 tree.
+# Only for the CXD5602 and its ASMP framework.
+CIRCUITPY_SUBCORE ?= 0
+CFLAGS += -DCIRCUITPY_SUBCORE=$(CIRCUITPY_SUBCORE)
+
 # Currently always off.
 CIRCUITPY_STAGE ?= 0
 CFLAGS += -DCIRCUITPY_STAGE=$(CIRCUITPY_STAGE)
@@ -196,6 +227,9 @@ CFLAGS += -DCIRCUITPY_USB_HID=$(CIRCUITPY_USB_HID)
 CIRCUITPY_USB_MIDI ?= 1
 CFLAGS += -DCIRCUITPY_USB_MIDI=$(CIRCUITPY_USB_MIDI)
 
+CIRCUITPY_USB_BULK ?= 0
+CFLAGS += -DCIRCUITPY_USB_BULK=$(CIRCUITPY_USB_BULK)
+
 CIRCUITPY_PEW ?= 0
 CFLAGS += -DCIRCUITPY_PEW=$(CIRCUITPY_PEW)
 
@@ -232,6 +266,38 @@ CFLAGS += -DCIRCUITPY_ULAB=$(CIRCUITPY_ULAB)
 CIRCUITPY_WATCHDOG ?= 0
 CFLAGS += -DCIRCUITPY_WATCHDOG=$(CIRCUITPY_WATCHDOG)
 
+# Statistical profiler sampling the running bytecode from the supervisor tick
+CIRCUITPY_PROFILER ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_PROFILER=$(CIRCUITPY_PROFILER)
+
+# Cycle counters for the background tasks and garbage collection, read with
+# supervisor.perf_counters()
+CIRCUITPY_PERF_COUNTERS ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_PERF_COUNTERS=$(CIRCUITPY_PERF_COUNTERS)
+
+# Stream heap activity out of the board's GC_TRACE_UART_TX pin for
+# tools/gc_activity.py. For debugging only.
+CIRCUITPY_GC_TRACE ?= 0
+CFLAGS += -DCIRCUITPY_GC_TRACE=$(CIRCUITPY_GC_TRACE)
+
+# Decode translated messages with a lookup table, and keep the last few
+# decompressed ones in RAM, so that raising exceptions stays cheap.
+CIRCUITPY_FAST_TRANSLATE ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_FAST_TRANSLATE=$(CIRCUITPY_FAST_TRANSLATE)
+
+# Native wifi radio. Its sockets go through the network and socket modules.
+CIRCUITPY_WIFI ?= 0
+CFLAGS += -DCIRCUITPY_WIFI=$(CIRCUITPY_WIFI)
+
+# _thread, for ports that run on an RTOS and provide an mpthreadport
+CIRCUITPY_THREAD ?= 0
+CFLAGS += -DCIRCUITPY_THREAD=$(CIRCUITPY_THREAD)
+
 # Enabled micropython.native decorator (experimental)
 CIRCUITPY_ENABLE_MPY_NATIVE ?= 0
 CFLAGS += -DCIRCUITPY_ENABLE_MPY_NATIVE=$(CIRCUITPY_ENABLE_MPY_NATIVE)
+
+# Store frozen libraries deflate-compressed and inflate each one into the heap
+# when it's imported. Saves flash on boards that are short of it.
+CIRCUITPY_FROZEN_MPY_COMPRESSED ?= 0
+CFLAGS += -DCIRCUITPY_FROZEN_MPY_COMPRESSED=$(CIRCUITPY_FROZEN_MPY_COMPRESSED)
@@ -92,6 +92,8 @@ typedef enum {
 #define NATIVE_EMITTER(f) emit_native_arm_##f
 #elif MICROPY_EMIT_XTENSA
 #define NATIVE_EMITTER(f) emit_native_xtensa_##f
+#elif MICROPY_EMIT_XTENSAWIN
+#define NATIVE_EMITTER(f) emit_native_xtensawin_##f
 #else
 #error "unknown native emitter"
 #endif
@@ -214,6 +216,21 @@ STATIC void apply_to_single_or_list(compiler_t *comp, mp_parse_node_t pn, pn_kin
     }
 }
 
+#if MICROPY_COMP_UNREACHABLE_CODE
+// Whether control never goes past this statement to the next one.
+STATIC bool node_is_unconditional_jump(mp_parse_node_t pn) {
+    if (MP_PARSE_NODE_IS_STRUCT_KIND(pn, PN_simple_stmt_2)) {
+        // a; b; return: look at the last small statement
+        mp_parse_node_struct_t *pns = (mp_parse_node_struct_t*)pn;
+        pn = pns->nodes[MP_PARSE_NODE_STRUCT_NUM_NODES(pns) - 1];
+    }
+    return MP_PARSE_NODE_IS_STRUCT_KIND(pn, PN_return_stmt)
+        || MP_PARSE_NODE_IS_STRUCT_KIND(pn, PN_raise_stmt)
+        || MP_PARSE_NODE_IS_STRUCT_KIND(pn, PN_break_stmt)
+        || MP_PARSE_NODE_IS_STRUCT_KIND(pn, PN_continue_stmt);
+}
+#endif
+
 STATIC void compile_generic_all_nodes(compiler_t *comp, mp_parse_node_struct_t *pns) {
     int num_nodes = MP_PARSE_NODE_STRUCT_NUM_NODES(pns);
     for (int i = 0; i < num_nodes; i++) {
@@ -223,6 +240,14 @@ STATIC void compile_generic_all_nodes(compiler_t *comp, mp_parse_node_struct_t *
             compile_error_set_line(comp, pns->nodes[i]);
             return;
         }
+        #if MICROPY_COMP_UNREACHABLE_CODE
+        // Nothing after a return, raise, break or continue in the same block
+        // can run, so don't emit it. The scope pass still sees it, so names
+        // assigned there are still local and errors in it are still raised.
+        if (comp->pass > MP_PASS_SCOPE && node_is_unconditional_jump(pns->nodes[i])) {
+            return;
+        }
+        #endif
     }
 }
 
@@ -3518,4 +3543,29 @@ mp_obj_t mp_compile(mp_parse_tree_t *parse_tree, qstr source_file, uint emit_opt
     return mp_make_function_from_raw_code(rc, MP_OBJ_NULL, MP_OBJ_NULL);
 }
 
+#if MICROPY_COMP_INCREMENTAL
+
+#if MICROPY_ENABLE_DOC_STRING
+#error "MICROPY_COMP_INCREMENTAL can't find the module doc string"
+#endif
+
+typedef struct _compile_incremental_t {
+    qstr source_file;
+    uint emit_opt;
+    mp_obj_t funs;
+} compile_incremental_t;
+
+STATIC void compile_incremental_stmt(void *env, mp_parse_tree_t *parse_tree) {
+    compile_incremental_t *ci = env;
+    mp_obj_list_append(ci->funs, mp_compile(parse_tree, ci->source_file, ci->emit_opt, false));
+}
+
+mp_obj_t mp_compile_incremental(mp_lexer_t *lex, uint emit_opt) {
+    compile_incremental_t ci = {lex->source_name, emit_opt, mp_obj_new_list(0, NULL)};
+    mp_parse_incremental(lex, compile_incremental_stmt, &ci);
+    return ci.funs;
+}
+
+#endif
+
 #endif // MICROPY_ENABLE_COMPILER
@@ -48,6 +48,17 @@ mp_obj_t mp_compile(mp_parse_tree_t *parse_tree, qstr source_file, uint emit_opt
 mp_raw_code_t *mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, uint emit_opt, bool is_repl);
 #endif
 
+#if MICROPY_COMP_INCREMENTAL
+// parse and compile file input a top-level statement at a time
+// returns a list of module functions, one for each statement, for mp_call_incremental
+// the compiler will raise an exception if an error occurred
+// the compiler will free the lexer before it returns
+mp_obj_t mp_compile_incremental(mp_lexer_t *lex, uint emit_opt);
+
+// this is implemented in runtime.c
+void mp_call_incremental(mp_obj_t funs);
+#endif
+
 // this is implemented in runtime.c
 mp_obj_t mp_parse_compile_execute(mp_lexer_t *lex, mp_parse_input_kind_t parse_input_kind, mp_obj_dict_t *globals, mp_obj_dict_t *locals);
 
@@ -58,12 +58,33 @@ struct _emit_t {
     mp_uint_t max_num_labels;
     mp_uint_t *label_offsets;
 
+    #if MICROPY_OPT_BC_PEEPHOLE
+    // for each label, the label it unconditionally jumps to, if that's all
+    // the code at the label does (or it shares its offset with that label)
+    mp_uint_t *label_jumps;
+    // the label assigned last, and the offset it was assigned at
+    mp_uint_t last_label;
+    size_t last_label_offset;
+    // offsets and operand of the last store of a local, if it can still be
+    // turned into a DUP_TOP before the store by a load of the same local
+    size_t store_local_offset;
+    size_t store_local_end;
+    mp_uint_t store_local_num;
+    int store_local_kind;
+    #endif
+
     size_t code_info_offset;
     size_t code_info_size;
     size_t bytecode_offset;
     size_t bytecode_size;
     byte *code_base; // stores both byte code and code info
 
+    #if MICROPY_OPT_FUSED_COMPARE_JUMP
+    // offset and operator of the last comparison, if it can still be fused with a jump
+    size_t compare_offset;
+    mp_binary_op_t compare_op;
+    #endif
+
     #if MICROPY_PERSISTENT_CODE
     uint16_t ct_cur_obj;
     uint16_t ct_num_obj;
@@ -80,10 +101,16 @@ emit_t *emit_bc_new(void) {
 void emit_bc_set_max_num_labels(emit_t *emit, mp_uint_t max_num_labels) {
     emit->max_num_labels = max_num_labels;
     emit->label_offsets = m_new(mp_uint_t, emit->max_num_labels);
+    #if MICROPY_OPT_BC_PEEPHOLE
+    emit->label_jumps = m_new(mp_uint_t, emit->max_num_labels);
+    #endif
 }
 
 void emit_bc_free(emit_t *emit) {
     m_del(mp_uint_t, emit->label_offsets, emit->max_num_labels);
+    #if MICROPY_OPT_BC_PEEPHOLE
+    m_del(mp_uint_t, emit->label_jumps, emit->max_num_labels);
+    #endif
     m_del_obj(emit_t, emit);
 }
 
@@ -278,6 +305,20 @@ STATIC void emit_write_bytecode_byte_raw_code(emit_t *emit, byte b, mp_raw_code_
     #endif
 }
 
+#if MICROPY_OPT_BC_PEEPHOLE
+// Follow a label through the unconditional jumps found at it, so that a jump
+// to a jump goes straight to the final destination.  The number of steps is
+// bounded because a jump may lead back to itself, eg in "while 1: pass".
+STATIC mp_uint_t emit_bc_jump_destination(emit_t *emit, mp_uint_t label) {
+    for (int i = 0; i < 8 && emit->label_jumps[label] != (mp_uint_t)-1; i++) {
+        label = emit->label_jumps[label];
+    }
+    return label;
+}
+#else
+#define emit_bc_jump_destination(emit, label) (label)
+#endif
+
 // unsigned labels are relative to ip following this instruction, stored as 16 bits
 STATIC void emit_write_bytecode_byte_unsigned_label(emit_t *emit, byte b1, mp_uint_t label) {
     mp_uint_t bytecode_offset;
@@ -298,7 +339,7 @@ STATIC void emit_write_bytecode_byte_signed_label(emit_t *emit, byte b1, mp_uint
     if (emit->pass < MP_PASS_EMIT) {
         bytecode_offset = 0;
     } else {
-        bytecode_offset = emit->label_offsets[label] - emit->bytecode_offset - 3 + 0x8000;
+        bytecode_offset = emit->label_offsets[emit_bc_jump_destination(emit, label)] - emit->bytecode_offset - 3 + 0x8000;
     }
     byte *c = emit_get_cur_to_write_bytecode(emit, 3);
     c[0] = b1;
@@ -306,6 +347,22 @@ STATIC void emit_write_bytecode_byte_signed_label(emit_t *emit, byte b1, mp_uint
     c[2] = bytecode_offset >> 8;
 }
 
+#if MICROPY_OPT_FUSED_COMPARE_JUMP
+STATIC void emit_write_bytecode_byte_byte_signed_label(emit_t *emit, byte b1, byte b2, mp_uint_t label) {
+    int bytecode_offset;
+    if (emit->pass < MP_PASS_EMIT) {
+        bytecode_offset = 0;
+    } else {
+        bytecode_offset = emit->label_offsets[emit_bc_jump_destination(emit, label)] - emit->bytecode_offset - 4 + 0x8000;
+    }
+    byte *c = emit_get_cur_to_write_bytecode(emit, 4);
+    c[0] = b1;
+    c[1] = b2;
+    c[2] = bytecode_offset;
+    c[3] = bytecode_offset >> 8;
+}
+#endif
+
 void mp_emit_bc_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scope) {
     emit->pass = pass;
     emit->stack_size = 0;
@@ -321,6 +378,17 @@ void mp_emit_bc_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scope) {
     #endif
     emit->bytecode_offset = 0;
     emit->code_info_offset = 0;
+    #if MICROPY_OPT_FUSED_COMPARE_JUMP
+    emit->compare_offset = (size_t)-1;
+    #endif
+    #if MICROPY_OPT_BC_PEEPHOLE
+    // jumps are threaded using what the earlier passes found at each label
+    if (pass < MP_PASS_EMIT && emit->label_jumps != NULL) {
+        memset(emit->label_jumps, -1, emit->max_num_labels * sizeof(mp_uint_t));
+    }
+    emit->last_label_offset = (size_t)-1;
+    emit->store_local_end = (size_t)-1;
+    #endif
 
     // Write local state size and exception stack size.
     {
@@ -502,6 +570,22 @@ void mp_emit_bc_label_assign(emit_t *emit, mp_uint_t l) {
         // ensure label offset has not changed from MP_PASS_CODE_SIZE to MP_PASS_EMIT
         assert(emit->label_offsets[l] == emit->bytecode_offset);
     }
+    #if MICROPY_OPT_FUSED_COMPARE_JUMP
+    // a jump to here may arrive without the comparison, so it can't be fused
+    emit->compare_offset = (size_t)-1;
+    #endif
+    #if MICROPY_OPT_BC_PEEPHOLE
+    if (emit->pass < MP_PASS_EMIT) {
+        if (emit->last_label_offset == emit->bytecode_offset) {
+            // two labels at the same place
+            emit->label_jumps[emit->last_label] = l;
+        }
+        emit->last_label = l;
+        emit->last_label_offset = emit->bytecode_offset;
+    }
+    // likewise a jump to here may arrive without the value of the store
+    emit->store_local_end = (size_t)-1;
+    #endif
 }
 
 void mp_emit_bc_import(emit_t *emit, qstr qst, int kind) {
@@ -556,11 +640,42 @@ void mp_emit_bc_load_null(emit_t *emit) {
     emit_write_bytecode_byte(emit, MP_BC_LOAD_NULL);
 }
 
+STATIC void emit_write_store_local(emit_t *emit, mp_uint_t local_num, int kind) {
+    #if MICROPY_OPT_BC_PEEPHOLE
+    emit->store_local_offset = emit->bytecode_offset;
+    emit->store_local_num = local_num;
+    emit->store_local_kind = kind;
+    #endif
+    if (kind == MP_EMIT_IDOP_LOCAL_FAST && local_num <= 15) {
+        emit_write_bytecode_byte(emit, MP_BC_STORE_FAST_MULTI + local_num);
+    } else {
+        emit_write_bytecode_byte_uint(emit, MP_BC_STORE_FAST_N + kind, local_num);
+    }
+    #if MICROPY_OPT_BC_PEEPHOLE
+    emit->store_local_end = emit->bytecode_offset;
+    #endif
+}
+
 void mp_emit_bc_load_local(emit_t *emit, qstr qst, mp_uint_t local_num, int kind) {
     MP_STATIC_ASSERT(MP_BC_LOAD_FAST_N + MP_EMIT_IDOP_LOCAL_FAST == MP_BC_LOAD_FAST_N);
     MP_STATIC_ASSERT(MP_BC_LOAD_FAST_N + MP_EMIT_IDOP_LOCAL_DEREF == MP_BC_LOAD_DEREF);
     (void)qst;
     emit_bc_pre(emit, 1);
+    #if MICROPY_OPT_BC_PEEPHOLE
+    // If the previous opcode stored this same local then keep a copy of the
+    // value on the stack before the store instead of loading it back.  The
+    // store may end up attributed to the next source line, but it can't raise.
+    if (emit->store_local_end == emit->bytecode_offset
+        && emit->store_local_num == local_num && emit->store_local_kind == kind) {
+        emit->bytecode_offset = emit->store_local_offset;
+        // the copy is made while the value is still there to be stored
+        mp_emit_bc_adjust_stack_size(emit, 1);
+        mp_emit_bc_adjust_stack_size(emit, -1);
+        emit_write_bytecode_byte(emit, MP_BC_DUP_TOP);
+        emit_write_store_local(emit, local_num, kind);
+        return;
+    }
+    #endif
     if (kind == MP_EMIT_IDOP_LOCAL_FAST && local_num <= 15) {
         emit_write_bytecode_byte(emit, MP_BC_LOAD_FAST_MULTI + local_num);
     } else {
@@ -625,11 +740,7 @@ void mp_emit_bc_store_local(emit_t *emit, qstr qst, mp_uint_t local_num, int kin
     MP_STATIC_ASSERT(MP_BC_STORE_FAST_N + MP_EMIT_IDOP_LOCAL_DEREF == MP_BC_STORE_DEREF);
     (void)qst;
     emit_bc_pre(emit, -1);
-    if (kind == MP_EMIT_IDOP_LOCAL_FAST && local_num <= 15) {
-        emit_write_bytecode_byte(emit, MP_BC_STORE_FAST_MULTI + local_num);
-    } else {
-        emit_write_bytecode_byte_uint(emit, MP_BC_STORE_FAST_N + kind, local_num);
-    }
+    emit_write_store_local(emit, local_num, kind);
 }
 
 void mp_emit_bc_store_global(emit_t *emit, qstr qst, int kind) {
@@ -680,11 +791,29 @@ void mp_emit_bc_rot_three(emit_t *emit) {
 
 void mp_emit_bc_jump(emit_t *emit, mp_uint_t label) {
     emit_bc_pre(emit, 0);
+    #if MICROPY_OPT_BC_PEEPHOLE
+    if (emit->pass < MP_PASS_EMIT && emit->last_label_offset == emit->bytecode_offset) {
+        // nothing but this jump between the last label and its destination
+        emit->label_jumps[emit->last_label] = label;
+    }
+    #endif
     emit_write_bytecode_byte_signed_label(emit, MP_BC_JUMP, label);
 }
 
 void mp_emit_bc_pop_jump_if(emit_t *emit, bool cond, mp_uint_t label) {
     emit_bc_pre(emit, -1);
+    #if MICROPY_OPT_FUSED_COMPARE_JUMP
+    // If the previous opcode was a comparison, and no label or line number
+    // was recorded since, then replace it with the fused compare-and-jump.
+    if (emit->compare_offset + 1 == emit->bytecode_offset
+        && emit->last_source_line_offset <= emit->compare_offset) {
+        emit->bytecode_offset = emit->compare_offset;
+        emit_write_bytecode_byte_byte_signed_label(emit,
+            cond ? MP_BC_COMPARE_POP_JUMP_IF_TRUE : MP_BC_COMPARE_POP_JUMP_IF_FALSE,
+            emit->compare_op, label);
+        return;
+    }
+    #endif
     if (cond) {
         emit_write_bytecode_byte_signed_label(emit, MP_BC_POP_JUMP_IF_TRUE, label);
     } else {
@@ -786,6 +915,12 @@ void mp_emit_bc_binary_op(emit_t *emit, mp_binary_op_t op) {
         op = MP_BINARY_OP_IS;
     }
     emit_bc_pre(emit, -1);
+    #if MICROPY_OPT_FUSED_COMPARE_JUMP
+    if (op >= MP_BINARY_OP_LESS && op <= MP_BINARY_OP_NOT_EQUAL) {
+        emit->compare_offset = emit->bytecode_offset;
+        emit->compare_op = op;
+    }
+    #endif
     emit_write_bytecode_byte(emit, MP_BC_BINARY_OP_MULTI + op);
     if (invert) {
         emit_bc_pre(emit, 0);
@@ -307,6 +307,22 @@ STATIC uint32_t get_arg_i(emit_inline_asm_t *emit, const char *op, mp_parse_node
     return i;
 }
 
+#if MICROPY_EMIT_INLINE_THUMB_DSP
+STATIC int get_arg_i_range(emit_inline_asm_t *emit, const char *op, mp_parse_node_t pn, int min, int max) {
+    mp_obj_t o;
+    if (!mp_parse_node_get_int_maybe(pn, &o)) {
+        emit_inline_thumb_error_exc(emit, mp_obj_new_exception_msg_varg(&mp_type_SyntaxError, translate("'%s' expects an integer"), op));
+        return min;
+    }
+    int i = mp_obj_get_int_truncated(o);
+    if (i < min || i > max) {
+        emit_inline_thumb_error_exc(emit, mp_obj_new_exception_msg_varg(&mp_type_SyntaxError, translate("'%s' integer %d is not within range %d..%d"), op, i, min, max));
+        return min;
+    }
+    return i;
+}
+#endif
+
 STATIC bool get_arg_addr(emit_inline_asm_t *emit, const char *op, mp_parse_node_t pn, mp_parse_node_t *pn_base, mp_parse_node_t *pn_offset) {
     if (!MP_PARSE_NODE_IS_STRUCT_KIND(pn, PN_atom_bracket)) {
         goto bad_arg;
@@ -401,13 +417,242 @@ STATIC const format_9_10_op_t format_9_10_op_table[] = {
 
 #if MICROPY_EMIT_INLINE_THUMB_FLOAT
 // actual opcodes are: 0xee00 | op.hi_nibble, 0x0a00 | op.lo_nibble
-typedef struct _format_vfp_op_t { byte op; char name[3]; } format_vfp_op_t;
+typedef struct _format_vfp_op_t { byte op; char name[5]; } format_vfp_op_t;
 STATIC const format_vfp_op_t format_vfp_op_table[] = {
     { 0x30, "add" },
     { 0x34, "sub" },
     { 0x20, "mul" },
     { 0x80, "div" },
+    { 0x00, "mla" },
+    { 0x04, "mls" },
+    { 0x24, "nmul" },
+    { 0x14, "nmla" },
+    { 0x10, "nmls" },
+    { 0xa0, "fma" },
+    { 0xa4, "fms" },
+    { 0x94, "fnma" },
+    { 0x90, "fnms" },
+};
+#endif
+
+#if MICROPY_EMIT_INLINE_THUMB_DSP
+// name is actually a qstr, which should fit in 16 bits
+typedef struct _format_dsp_op_t { uint16_t name; uint16_t op_hi; uint16_t op_lo; } format_dsp_op_t;
+
+// op(rd, rn, rm) is encoded as (op_hi | rn), (op_lo | rd << 8 | rm)
+STATIC const format_dsp_op_t format_dsp_3reg_op_table[] = {
+    // parallel add and subtract, plain, saturating and halving
+    { MP_QSTR_sadd16, 0xfa90, 0xf000 },
+    { MP_QSTR_ssub16, 0xfad0, 0xf000 },
+    { MP_QSTR_sasx, 0xfaa0, 0xf000 },
+    { MP_QSTR_ssax, 0xfae0, 0xf000 },
+    { MP_QSTR_sadd8, 0xfa80, 0xf000 },
+    { MP_QSTR_ssub8, 0xfac0, 0xf000 },
+    { MP_QSTR_qadd16, 0xfa90, 0xf010 },
+    { MP_QSTR_qsub16, 0xfad0, 0xf010 },
+    { MP_QSTR_qasx, 0xfaa0, 0xf010 },
+    { MP_QSTR_qsax, 0xfae0, 0xf010 },
+    { MP_QSTR_qadd8, 0xfa80, 0xf010 },
+    { MP_QSTR_qsub8, 0xfac0, 0xf010 },
+    { MP_QSTR_shadd16, 0xfa90, 0xf020 },
+    { MP_QSTR_shsub16, 0xfad0, 0xf020 },
+    { MP_QSTR_shadd8, 0xfa80, 0xf020 },
+    { MP_QSTR_shsub8, 0xfac0, 0xf020 },
+    { MP_QSTR_uadd16, 0xfa90, 0xf040 },
+    { MP_QSTR_usub16, 0xfad0, 0xf040 },
+    { MP_QSTR_uasx, 0xfaa0, 0xf040 },
+    { MP_QSTR_usax, 0xfae0, 0xf040 },
+    { MP_QSTR_uadd8, 0xfa80, 0xf040 },
+    { MP_QSTR_usub8, 0xfac0, 0xf040 },
+    { MP_QSTR_uqadd16, 0xfa90, 0xf050 },
+    { MP_QSTR_uqsub16, 0xfad0, 0xf050 },
+    { MP_QSTR_uqadd8, 0xfa80, 0xf050 },
+    { MP_QSTR_uqsub8, 0xfac0, 0xf050 },
+    { MP_QSTR_uhadd16, 0xfa90, 0xf060 },
+    { MP_QSTR_uhsub16, 0xfad0, 0xf060 },
+    { MP_QSTR_uhadd8, 0xfa80, 0xf060 },
+    { MP_QSTR_uhsub8, 0xfac0, 0xf060 },
+    // 32-bit saturating arithmetic, op(rd, rm, rn) as in the ARM syntax
+    { MP_QSTR_qadd, 0xfa80, 0xf080 },
+    { MP_QSTR_qdadd, 0xfa80, 0xf090 },
+    { MP_QSTR_qsub, 0xfa80, 0xf0a0 },
+    { MP_QSTR_qdsub, 0xfa80, 0xf0b0 },
+    // select bytes using the GE flags set by the parallel ops above
+    { MP_QSTR_sel, 0xfaa0, 0xf080 },
+    // multiplies, which are the accumulating forms below with ra = r15
+    { MP_QSTR_smulbb, 0xfb10, 0xf000 },
+    { MP_QSTR_smulbt, 0xfb10, 0xf010 },
+    { MP_QSTR_smultb, 0xfb10, 0xf020 },
+    { MP_QSTR_smultt, 0xfb10, 0xf030 },
+    { MP_QSTR_smulwb, 0xfb30, 0xf000 },
+    { MP_QSTR_smulwt, 0xfb30, 0xf010 },
+    { MP_QSTR_smuad, 0xfb20, 0xf000 },
+    { MP_QSTR_smuadx, 0xfb20, 0xf010 },
+    { MP_QSTR_smusd, 0xfb40, 0xf000 },
+    { MP_QSTR_smusdx, 0xfb40, 0xf010 },
+    { MP_QSTR_smmul, 0xfb50, 0xf000 },
+    { MP_QSTR_smmulr, 0xfb50, 0xf010 },
+    { MP_QSTR_usad8, 0xfb70, 0xf000 },
+};
+
+// op(rd, rn, rm, ra) is encoded as (op_hi | rn), (op_lo | ra << 12 | rd << 8 | rm);
+// the long forms, with bit 7 set in op_hi, are op(rdlo, rdhi, rn, rm)
+STATIC const format_dsp_op_t format_dsp_4reg_op_table[] = {
+    { MP_QSTR_smlabb, 0xfb10, 0x0000 },
+    { MP_QSTR_smlabt, 0xfb10, 0x0010 },
+    { MP_QSTR_smlatb, 0xfb10, 0x0020 },
+    { MP_QSTR_smlatt, 0xfb10, 0x0030 },
+    { MP_QSTR_smlawb, 0xfb30, 0x0000 },
+    { MP_QSTR_smlawt, 0xfb30, 0x0010 },
+    { MP_QSTR_smlad, 0xfb20, 0x0000 },
+    { MP_QSTR_smladx, 0xfb20, 0x0010 },
+    { MP_QSTR_smlsd, 0xfb40, 0x0000 },
+    { MP_QSTR_smlsdx, 0xfb40, 0x0010 },
+    { MP_QSTR_smmla, 0xfb50, 0x0000 },
+    { MP_QSTR_smmlar, 0xfb50, 0x0010 },
+    { MP_QSTR_smmls, 0xfb60, 0x0000 },
+    { MP_QSTR_smmlsr, 0xfb60, 0x0010 },
+    { MP_QSTR_usada8, 0xfb70, 0x0000 },
+    { MP_QSTR_smlald, 0xfbc0, 0x00c0 },
+    { MP_QSTR_smlaldx, 0xfbc0, 0x00d0 },
+    { MP_QSTR_smlsld, 0xfbd0, 0x00c0 },
+    { MP_QSTR_smlsldx, 0xfbd0, 0x00d0 },
+};
+
+// op(rd, rm[, rot]) when the low nibble of op_hi is 0xf, else op(rd, rn, rm[, rot]),
+// encoded as (op_hi | rn), (0xf080 | rd << 8 | rot / 8 << 4 | rm)
+STATIC const format_dsp_op_t format_dsp_extend_op_table[] = {
+    { MP_QSTR_sxtb16, 0xfa2f, 0 },
+    { MP_QSTR_uxtb16, 0xfa3f, 0 },
+    { MP_QSTR_sxtab16, 0xfa20, 0 },
+    { MP_QSTR_uxtab16, 0xfa30, 0 },
+    { MP_QSTR_sxtab, 0xfa40, 0 },
+    { MP_QSTR_uxtab, 0xfa50, 0 },
+    { MP_QSTR_sxtah, 0xfa00, 0 },
+    { MP_QSTR_uxtah, 0xfa10, 0 },
 };
+
+// Emit an instruction from the ARMv7E-M DSP extension, returning false if op
+// isn't one of them.
+STATIC bool emit_inline_thumb_dsp_op(emit_inline_asm_t *emit, qstr op, const char *op_str, mp_uint_t n_args, mp_parse_node_t *pn_args) {
+    if (n_args == 3) {
+        for (mp_uint_t i = 0; i < MP_ARRAY_SIZE(format_dsp_3reg_op_table); i++) {
+            const format_dsp_op_t *f = &format_dsp_3reg_op_table[i];
+            if (op == f->name) {
+                mp_uint_t rd = get_arg_reg(emit, op_str, pn_args[0], 15);
+                mp_uint_t rn = get_arg_reg(emit, op_str, pn_args[1], 15);
+                mp_uint_t rm = get_arg_reg(emit, op_str, pn_args[2], 15);
+                if (f->op_hi == 0xfa80 && (f->op_lo & 0x0080)) {
+                    // qadd and friends take their operands the other way round
+                    mp_uint_t r = rn;
+                    rn = rm;
+                    rm = r;
+                }
+                asm_thumb_op32(&emit->as, f->op_hi | rn, f->op_lo | (rd << 8) | rm);
+                return true;
+            }
+        }
+    } else if (n_args == 4) {
+        for (mp_uint_t i = 0; i < MP_ARRAY_SIZE(format_dsp_4reg_op_table); i++) {
+            const format_dsp_op_t *f = &format_dsp_4reg_op_table[i];
+            if (op == f->name) {
+                mp_uint_t r0 = get_arg_reg(emit, op_str, pn_args[0], 15);
+                mp_uint_t r1 = get_arg_reg(emit, op_str, pn_args[1], 15);
+                mp_uint_t r2 = get_arg_reg(emit, op_str, pn_args[2], 15);
+                mp_uint_t r3 = get_arg_reg(emit, op_str, pn_args[3], 15);
+                if (f->op_hi & 0x0080) {
+                    // rdlo, rdhi, rn, rm
+                    asm_thumb_op32(&emit->as, f->op_hi | r2, f->op_lo | (r0 << 12) | (r1 << 8) | r3);
+                } else {
+                    // rd, rn, rm, ra
+                    asm_thumb_op32(&emit->as, f->op_hi | r1, f->op_lo | (r3 << 12) | (r0 << 8) | r2);
+                }
+                return true;
+            }
+        }
+    }
+
+    for (mp_uint_t i = 0; i < MP_ARRAY_SIZE(format_dsp_extend_op_table); i++) {
+        const format_dsp_op_t *f = &format_dsp_extend_op_table[i];
+        if (op == f->name) {
+            mp_uint_t n_regs = (f->op_hi & 0xf) == 0xf ? 2 : 3;
+            if (n_args != n_regs && n_args != n_regs + 1) {
+                return false;
+            }
+            mp_uint_t rd = get_arg_reg(emit, op_str, pn_args[0], 15);
+            mp_uint_t rn = n_regs == 3 ? get_arg_reg(emit, op_str, pn_args[1], 15) : 0;
+            mp_uint_t rm = get_arg_reg(emit, op_str, pn_args[n_regs - 1], 15);
+            mp_uint_t rot = 0;
+            if (n_args > n_regs) {
+                rot = get_arg_i(emit, op_str, pn_args[n_regs], 0x18);
+            }
+            asm_thumb_op32(&emit->as, f->op_hi | rn, 0xf080 | (rd << 8) | (rot << 1) | rm);
+            return true;
+        }
+    }
+
+    if ((op == MP_QSTR_ssat || op == MP_QSTR_usat) && (n_args == 3 || n_args == 4)) {
+        // op(rd, sat, rn[, shift]) where a positive shift is LSL and a negative one ASR
+        bool is_signed = op == MP_QSTR_ssat;
+        mp_uint_t rd = get_arg_reg(emit, op_str, pn_args[0], 15);
+        mp_uint_t sat = is_signed
+            ? get_arg_i_range(emit, op_str, pn_args[1], 1, 32) - 1
+            : get_arg_i_range(emit, op_str, pn_args[1], 0, 31);
+        mp_uint_t rn = get_arg_reg(emit, op_str, pn_args[2], 15);
+        int shift = 0;
+        if (n_args == 4) {
+            shift = get_arg_i_range(emit, op_str, pn_args[3], -31, 31);
+        }
+        mp_uint_t sh = 0;
+        if (shift < 0) {
+            sh = 1;
+            shift = -shift;
+        }
+        asm_thumb_op32(&emit->as,
+            (is_signed ? 0xf300 : 0xf380) | (sh << 5) | rn,
+            ((shift & 0x1c) << 10) | (rd << 8) | ((shift & 3) << 6) | sat);
+        return true;
+    }
+
+    if ((op == MP_QSTR_ssat16 || op == MP_QSTR_usat16) && n_args == 3) {
+        // op(rd, sat, rn)
+        bool is_signed = op == MP_QSTR_ssat16;
+        mp_uint_t rd = get_arg_reg(emit, op_str, pn_args[0], 15);
+        mp_uint_t sat = is_signed
+            ? get_arg_i_range(emit, op_str, pn_args[1], 1, 16) - 1
+            : get_arg_i_range(emit, op_str, pn_args[1], 0, 15);
+        mp_uint_t rn = get_arg_reg(emit, op_str, pn_args[2], 15);
+        asm_thumb_op32(&emit->as, (is_signed ? 0xf320 : 0xf3a0) | rn, (rd << 8) | sat);
+        return true;
+    }
+
+    if ((op == MP_QSTR_pkhbt || op == MP_QSTR_pkhtb) && (n_args == 3 || n_args == 4)) {
+        // pkhbt(rd, rn, rm[, lsl]) and pkhtb(rd, rn, rm[, asr])
+        mp_uint_t rd = get_arg_reg(emit, op_str, pn_args[0], 15);
+        mp_uint_t rn = get_arg_reg(emit, op_str, pn_args[1], 15);
+        mp_uint_t rm = get_arg_reg(emit, op_str, pn_args[2], 15);
+        mp_uint_t shift = 0;
+        if (n_args == 4) {
+            shift = get_arg_i_range(emit, op_str, pn_args[3], 0, 31);
+        }
+        mp_uint_t tb = 0;
+        if (op == MP_QSTR_pkhtb) {
+            if (shift == 0) {
+                // an unshifted pkhtb is the same as pkhbt with the sources swapped
+                mp_uint_t r = rn;
+                rn = rm;
+                rm = r;
+            } else {
+                tb = 1;
+            }
+        }
+        asm_thumb_op32(&emit->as, 0xeac0 | rn,
+            ((shift & 0x1c) << 10) | (rd << 8) | ((shift & 3) << 6) | (tb << 5) | rm);
+        return true;
+    }
+
+    return false;
+}
 #endif
 
 // shorthand alias for whether we allow ARMv7-M instructions
@@ -447,12 +692,31 @@ STATIC void emit_inline_thumb_op(emit_inline_asm_t *emit, qstr op, mp_uint_t n_a
                 op_code_hi = 0xeeb1;
                 op_code = 0x0a40;
                 goto op_vfp_twoargs;
+            } else if (op == MP_QSTR_vabs) {
+                op_code_hi = 0xeeb0;
+                goto op_vfp_twoargs;
             } else if (op == MP_QSTR_vcvt_f32_s32) {
                 op_code_hi = 0xeeb8; // int to float
                 goto op_vfp_twoargs;
+            } else if (op == MP_QSTR_vcvt_f32_u32) {
+                op_code_hi = 0xeeb8; // unsigned int to float
+                op_code = 0x0a40;
+                goto op_vfp_twoargs;
             } else if (op == MP_QSTR_vcvt_s32_f32) {
                 op_code_hi = 0xeebd; // float to int
                 goto op_vfp_twoargs;
+            } else if (op == MP_QSTR_vcvt_u32_f32) {
+                op_code_hi = 0xeebc; // float to unsigned int
+                goto op_vfp_twoargs;
+            } else if (op == MP_QSTR_vmsr) {
+                const char *reg_str0 = get_arg_str(pn_args[0]);
+                if (strcmp(reg_str0, "FPSCR") == 0) {
+                    // ARM reg to FP status
+                    mp_uint_t reg_src = get_arg_reg(emit, op_str, pn_args[1], 14);
+                    asm_thumb_op32(&emit->as, 0xeee1, 0x0a10 | (reg_src << 12));
+                } else {
+                    goto unknown_op;
+                }
             } else if (op == MP_QSTR_vmrs) {
                 mp_uint_t reg_dest;
                 const char *reg_str0 = get_arg_str(pn_args[0]);
@@ -468,6 +732,12 @@ STATIC void emit_inline_thumb_op(emit_inline_asm_t *emit, qstr op, mp_uint_t n_a
                 } else {
                     goto unknown_op;
                 }
+            } else if (op == MP_QSTR_vmov && get_arg_str(pn_args[0])[0] == 's'
+                && get_arg_str(pn_args[1])[0] == 's') {
+                // FP reg to FP reg
+                op_code_hi = 0xeeb0;
+                op_code = 0x0a40;
+                goto op_vfp_twoargs;
             } else if (op == MP_QSTR_vmov) {
                 op_code_hi = 0xee00;
                 mp_uint_t r_arm, vm;
@@ -505,7 +775,7 @@ STATIC void emit_inline_thumb_op(emit_inline_asm_t *emit, qstr op, mp_uint_t n_a
         } else if (n_args == 3) {
             // search table for arith ops
             for (mp_uint_t i = 0; i < MP_ARRAY_SIZE(format_vfp_op_table); i++) {
-                if (strncmp(op_str + 1, format_vfp_op_table[i].name, 3) == 0 && op_str[4] == '\0') {
+                if (strcmp(op_str + 1, format_vfp_op_table[i].name) == 0) {
                     mp_uint_t op_code_hi = 0xee00 | (format_vfp_op_table[i].op & 0xf0);
                     mp_uint_t op_code = 0x0a00 | ((format_vfp_op_table[i].op & 0x0f) << 4);
                     mp_uint_t vd = get_arg_vfpreg(emit, op_str, pn_args[0]);
@@ -523,6 +793,11 @@ STATIC void emit_inline_thumb_op(emit_inline_asm_t *emit, qstr op, mp_uint_t n_a
         }
     } else
     #endif
+    #if MICROPY_EMIT_INLINE_THUMB_DSP
+    if (ARMV7M && emit_inline_thumb_dsp_op(emit, op, op_str, n_args, pn_args)) {
+        return;
+    } else
+    #endif
     if (n_args == 0) {
         if (op == MP_QSTR_nop) {
             asm_thumb_op16(&emit->as, ASM_THUMB_OP_NOP);
@@ -73,6 +73,9 @@
 #ifndef N_XTENSA
     #define N_XTENSA (0)
 #endif
+#ifndef N_XTENSAWIN
+    #define N_XTENSAWIN (0)
+#endif
 
 // wrapper around everything in this file
 #if N_X64 || N_X86 || N_THUMB || N_ARM || N_XTENSA
@@ -84,6 +87,16 @@
         ASM_MOV_LOCAL_REG((as), (local_num), (reg_temp)); \
     } while (false)
 
+// Registers holding this function's incoming args and its return value.  Only
+// the windowed Xtensa ABI sees these in different registers to its callees.
+#ifndef REG_PARENT_RET
+#define REG_PARENT_RET REG_RET
+#define REG_PARENT_ARG_1 REG_ARG_1
+#define REG_PARENT_ARG_2 REG_ARG_2
+#define REG_PARENT_ARG_3 REG_ARG_3
+#define REG_PARENT_ARG_4 REG_ARG_4
+#endif
+
 #define EMIT_NATIVE_VIPER_TYPE_ERROR(emit, ...) do { \
         *emit->error_slot = mp_obj_new_exception_msg_varg(&mp_type_ViperTypeError, __VA_ARGS__); \
     } while (0)
@@ -105,11 +118,13 @@ typedef enum {
     VTYPE_PTR8 = 0x00 | MP_NATIVE_TYPE_PTR8,
     VTYPE_PTR16 = 0x00 | MP_NATIVE_TYPE_PTR16,
     VTYPE_PTR32 = 0x00 | MP_NATIVE_TYPE_PTR32,
+    VTYPE_FLOAT = 0x00 | MP_NATIVE_TYPE_FLOAT,
 
     VTYPE_PTR_NONE = 0x50 | MP_NATIVE_TYPE_PTR,
 
     VTYPE_UNBOUND = 0x60 | MP_NATIVE_TYPE_OBJ,
     VTYPE_BUILTIN_CAST = 0x70 | MP_NATIVE_TYPE_OBJ,
+    VTYPE_BUILTIN_INTRINSIC = 0x80 | MP_NATIVE_TYPE_OBJ,
 } vtype_kind_t;
 
 STATIC qstr vtype_to_qstr(vtype_kind_t vtype) {
@@ -122,10 +137,37 @@ STATIC qstr vtype_to_qstr(vtype_kind_t vtype) {
         case VTYPE_PTR8: return MP_QSTR_ptr8;
         case VTYPE_PTR16: return MP_QSTR_ptr16;
         case VTYPE_PTR32: return MP_QSTR_ptr32;
+        #if MICROPY_EMIT_NATIVE_FLOAT
+        case VTYPE_FLOAT: return MP_QSTR_float;
+        #endif
         case VTYPE_PTR_NONE: default: return MP_QSTR_None;
     }
 }
 
+#if MICROPY_EMIT_NATIVE_VIPER_INTRINSICS
+// viper builtins that take machine words and call a C helper directly
+// if nbytes is non-zero it is passed to the helper after the other arguments
+typedef struct _viper_intrinsic_t {
+    uint16_t name;
+    uint8_t fun_kind;
+    uint8_t n_args;
+    uint8_t nbytes;
+    uint8_t ret_vtype;
+} viper_intrinsic_t;
+
+STATIC const viper_intrinsic_t viper_intrinsic_table[] = {
+    { MP_QSTR_memcpy, MP_F_MEMCPY, 3, 0, VTYPE_PTR_NONE },
+    { MP_QSTR_memmove, MP_F_MEMMOVE, 3, 0, VTYPE_PTR_NONE },
+    { MP_QSTR_memset, MP_F_MEMSET, 3, 0, VTYPE_PTR_NONE },
+    { MP_QSTR_bswap16, MP_F_NATIVE_BSWAP, 1, 2, VTYPE_INT },
+    { MP_QSTR_bswap32, MP_F_NATIVE_BSWAP, 1, 4, VTYPE_INT },
+    { MP_QSTR_load16_unaligned, MP_F_NATIVE_LOAD_UNALIGNED, 1, 2, VTYPE_INT },
+    { MP_QSTR_load32_unaligned, MP_F_NATIVE_LOAD_UNALIGNED, 1, 4, VTYPE_INT },
+    { MP_QSTR_store16_unaligned, MP_F_NATIVE_STORE_UNALIGNED, 2, 2, VTYPE_PTR_NONE },
+    { MP_QSTR_store32_unaligned, MP_F_NATIVE_STORE_UNALIGNED, 2, 4, VTYPE_PTR_NONE },
+};
+#endif
+
 typedef struct _stack_info_t {
     vtype_kind_t vtype;
     stack_info_kind_t kind;
@@ -196,6 +238,9 @@ STATIC void emit_native_set_native_type(emit_t *emit, mp_uint_t op, mp_uint_t ar
                 case MP_QSTR_ptr8: type = VTYPE_PTR8; break;
                 case MP_QSTR_ptr16: type = VTYPE_PTR16; break;
                 case MP_QSTR_ptr32: type = VTYPE_PTR32; break;
+                #if MICROPY_EMIT_NATIVE_FLOAT
+                case MP_QSTR_float: type = VTYPE_FLOAT; break;
+                #endif
                 default: EMIT_NATIVE_VIPER_TYPE_ERROR(emit, translate("unknown type '%q'"), arg2); return;
             }
             if (op == MP_EMIT_NATIVE_TYPE_RETURN) {
@@ -310,16 +355,19 @@ STATIC void emit_native_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scop
             }
         }
         #else
-        for (int i = 0; i < scope->num_pos_args; i++) {
+        // go from the last arg down so that, where the incoming arg registers
+        // overlap the local registers (windowed Xtensa), none is overwritten
+        // before it is read
+        for (int i = scope->num_pos_args - 1; i >= 0; i--) {
             if (i == 0) {
-                ASM_MOV_REG_REG(emit->as, REG_LOCAL_1, REG_ARG_1);
+                ASM_MOV_REG_REG(emit->as, REG_LOCAL_1, REG_PARENT_ARG_1);
             } else if (i == 1) {
-                ASM_MOV_REG_REG(emit->as, REG_LOCAL_2, REG_ARG_2);
+                ASM_MOV_REG_REG(emit->as, REG_LOCAL_2, REG_PARENT_ARG_2);
             } else if (i == 2) {
-                ASM_MOV_REG_REG(emit->as, REG_LOCAL_3, REG_ARG_3);
+                ASM_MOV_REG_REG(emit->as, REG_LOCAL_3, REG_PARENT_ARG_3);
             } else {
                 assert(i == 3); // should be true; max 4 args is checked above
-                ASM_MOV_LOCAL_REG(emit->as, i - REG_LOCAL_NUM, REG_ARG_4);
+                ASM_MOV_LOCAL_REG(emit->as, i - REG_LOCAL_NUM, REG_PARENT_ARG_4);
             }
         }
         #endif
@@ -345,10 +393,14 @@ STATIC void emit_native_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scop
         asm_x86_mov_arg_to_r32(emit->as, 1, REG_ARG_2);
         asm_x86_mov_arg_to_r32(emit->as, 2, REG_ARG_3);
         asm_x86_mov_arg_to_r32(emit->as, 3, REG_ARG_4);
+        #elif N_XTENSAWIN
+        ASM_MOV_REG_REG(emit->as, REG_ARG_2, REG_PARENT_ARG_2);
+        ASM_MOV_REG_REG(emit->as, REG_ARG_3, REG_PARENT_ARG_3);
+        ASM_MOV_REG_REG(emit->as, REG_ARG_4, REG_PARENT_ARG_4);
         #endif
 
         // set code_state.fun_bc
-        ASM_MOV_LOCAL_REG(emit->as, offsetof(mp_code_state_t, fun_bc) / sizeof(uintptr_t), REG_ARG_1);
+        ASM_MOV_LOCAL_REG(emit->as, offsetof(mp_code_state_t, fun_bc) / sizeof(uintptr_t), REG_PARENT_ARG_1);
 
         // set code_state.ip (offset from start of this function to prelude info)
         // XXX this encoding may change size
@@ -1005,7 +1057,20 @@ STATIC void emit_native_load_global(emit_t *emit, qstr qst, int kind) {
             } else if (qst == MP_QSTR_ptr32) {
                 emit_post_push_imm(emit, VTYPE_BUILTIN_CAST, VTYPE_PTR32);
                 return;
+            #if MICROPY_EMIT_NATIVE_FLOAT
+            } else if (qst == MP_QSTR_float) {
+                emit_post_push_imm(emit, VTYPE_BUILTIN_CAST, VTYPE_FLOAT);
+                return;
+            #endif
+            }
+            #if MICROPY_EMIT_NATIVE_VIPER_INTRINSICS
+            for (size_t i = 0; i < MP_ARRAY_SIZE(viper_intrinsic_table); i++) {
+                if (qst == viper_intrinsic_table[i].name) {
+                    emit_post_push_imm(emit, VTYPE_BUILTIN_INTRINSIC, i);
+                    return;
+                }
             }
+            #endif
         }
     }
     emit_call_with_imm_arg(emit, MP_F_LOAD_NAME + kind, qst, REG_ARG_1);
@@ -1787,6 +1852,17 @@ STATIC void emit_native_unary_op(emit_t *emit, mp_unary_op_t op) {
     if (vtype == VTYPE_PYOBJ) {
         emit_call_with_imm_arg(emit, MP_F_UNARY_OP, op, REG_ARG_1);
         emit_post_push_reg(emit, VTYPE_PYOBJ, REG_RET);
+    #if MICROPY_EMIT_NATIVE_FLOAT
+    } else if (vtype == VTYPE_FLOAT && op == MP_UNARY_OP_POSITIVE) {
+        emit_post_push_reg(emit, VTYPE_FLOAT, REG_ARG_2);
+    } else if (vtype == VTYPE_FLOAT && op == MP_UNARY_OP_NEGATIVE) {
+        // negate as -1 * x, which also gets the sign of zero right
+        need_reg_all(emit);
+        ASM_MOV_REG_REG(emit->as, REG_ARG_3, REG_ARG_2);
+        ASM_MOV_REG_IMM(emit->as, REG_ARG_2, -1);
+        emit_call_with_imm_arg(emit, MP_F_FLOAT_BINARY_OP, MP_BINARY_OP_MULTIPLY | MP_NATIVE_FLOAT_LHS_INT, REG_ARG_1);
+        emit_post_push_reg(emit, VTYPE_FLOAT, REG_RET);
+    #endif
     } else {
         adjust_stack(emit, 1);
         EMIT_NATIVE_VIPER_TYPE_ERROR(emit,
@@ -1794,6 +1870,18 @@ STATIC void emit_native_unary_op(emit_t *emit, mp_unary_op_t op) {
     }
 }
 
+#if MICROPY_EMIT_NATIVE_FLOAT
+// convert the object at the given stack depth to an unboxed float, in place
+STATIC void emit_native_convert_to_float(emit_t *emit, mp_uint_t depth) {
+    need_stack_settled(emit);
+    mp_uint_t local_num = emit->stack_start + emit->stack_size - 1 - depth;
+    ASM_MOV_REG_LOCAL(emit->as, REG_ARG_1, local_num);
+    emit_call_with_imm_arg(emit, MP_F_CONVERT_OBJ_TO_NATIVE, VTYPE_FLOAT, REG_ARG_2); // arg2 = type
+    ASM_MOV_LOCAL_REG(emit->as, local_num, REG_RET);
+    peek_stack(emit, depth)->vtype = VTYPE_FLOAT;
+}
+#endif
+
 STATIC void emit_native_binary_op(emit_t *emit, mp_binary_op_t op) {
     DEBUG_printf("binary_op(" UINT_FMT ")\n", op);
     vtype_kind_t vtype_lhs = peek_vtype(emit, 1);
@@ -1948,6 +2036,39 @@ STATIC void emit_native_binary_op(emit_t *emit, mp_binary_op_t op) {
             EMIT_NATIVE_VIPER_TYPE_ERROR(emit,
                 translate("binary op %q not implemented"), mp_binary_op_method_name[op]);
         }
+    #if MICROPY_EMIT_NATIVE_FLOAT
+    } else if ((vtype_lhs == VTYPE_FLOAT || vtype_rhs == VTYPE_FLOAT)
+               && (vtype_lhs == VTYPE_FLOAT || vtype_lhs == VTYPE_INT || vtype_lhs == VTYPE_PYOBJ)
+               && (vtype_rhs == VTYPE_FLOAT || vtype_rhs == VTYPE_INT || vtype_rhs == VTYPE_PYOBJ)) {
+        // as for integers, inplace and normal ops are equivalent
+        if (MP_BINARY_OP_INPLACE_OR <= op && op <= MP_BINARY_OP_INPLACE_POWER) {
+            op += MP_BINARY_OP_OR - MP_BINARY_OP_INPLACE_OR;
+        }
+        bool is_compare = MP_BINARY_OP_LESS <= op && op <= MP_BINARY_OP_NOT_EQUAL;
+        if (!(is_compare || op == MP_BINARY_OP_ADD || op == MP_BINARY_OP_SUBTRACT
+              || op == MP_BINARY_OP_MULTIPLY || op == MP_BINARY_OP_TRUE_DIVIDE)) {
+            adjust_stack(emit, -1);
+            EMIT_NATIVE_VIPER_TYPE_ERROR(emit,
+                translate("binary op %q not implemented"), mp_binary_op_method_name[op]);
+            return;
+        }
+        // unbox object operands (eg float constants) in place, ints are converted by the helper
+        if (vtype_lhs == VTYPE_PYOBJ) {
+            emit_native_convert_to_float(emit, 1);
+        }
+        if (vtype_rhs == VTYPE_PYOBJ) {
+            emit_native_convert_to_float(emit, 0);
+        }
+        emit_pre_pop_reg_reg(emit, &vtype_rhs, REG_ARG_3, &vtype_lhs, REG_ARG_2);
+        if (vtype_lhs == VTYPE_INT) {
+            op |= MP_NATIVE_FLOAT_LHS_INT;
+        }
+        if (vtype_rhs == VTYPE_INT) {
+            op |= MP_NATIVE_FLOAT_RHS_INT;
+        }
+        emit_call_with_imm_arg(emit, MP_F_FLOAT_BINARY_OP, op, REG_ARG_1);
+        emit_post_push_reg(emit, is_compare ? VTYPE_BOOL : VTYPE_FLOAT, REG_RET);
+    #endif
     } else if (vtype_lhs == VTYPE_PYOBJ && vtype_rhs == VTYPE_PYOBJ) {
         emit_pre_pop_reg_reg(emit, &vtype_rhs, REG_ARG_3, &vtype_lhs, REG_ARG_2);
         bool invert = false;
@@ -2106,6 +2227,52 @@ STATIC void emit_native_make_closure(emit_t *emit, scope_t *scope, mp_uint_t n_c
     emit_post_push_reg(emit, VTYPE_PYOBJ, REG_RET);
 }
 
+#if MICROPY_EMIT_NATIVE_VIPER_INTRINSICS
+STATIC void emit_native_call_intrinsic(emit_t *emit, mp_uint_t n_positional, mp_uint_t n_keyword, mp_uint_t star_flags) {
+    const viper_intrinsic_t *intr = &viper_intrinsic_table[peek_stack(emit, n_positional + 2 * n_keyword)->data.u_imm];
+    if (n_keyword != 0 || star_flags || n_positional != intr->n_args) {
+        EMIT_NATIVE_VIPER_TYPE_ERROR(emit,
+            translate("%q() takes %d positional arguments but %d were given"),
+            intr->name, intr->n_args, n_positional);
+        // keep the stack balanced, the error is raised when compilation finishes
+        adjust_stack(emit, -(1 + n_positional + 2 * n_keyword + (star_flags ? 2 : 0)));
+        emit_post_push_imm(emit, VTYPE_PTR_NONE, 0);
+        return;
+    }
+
+    // the arguments must already be machine words, there is no implicit conversion
+    for (mp_uint_t i = 0; i < n_positional; i++) {
+        vtype_kind_t vtype = peek_vtype(emit, i);
+        if (vtype == VTYPE_PYOBJ || vtype == VTYPE_UNBOUND
+            || vtype == VTYPE_BUILTIN_CAST || vtype == VTYPE_BUILTIN_INTRINSIC
+            #if MICROPY_EMIT_NATIVE_FLOAT
+            || vtype == VTYPE_FLOAT
+            #endif
+            ) {
+            EMIT_NATIVE_VIPER_TYPE_ERROR(emit,
+                translate("can't pass '%q' to %q()"), vtype_to_qstr(vtype), intr->name);
+        }
+    }
+
+    static const int arg_regs[] = {REG_ARG_1, REG_ARG_2, REG_ARG_3};
+    for (mp_uint_t i = n_positional; i-- > 0;) {
+        vtype_kind_t vtype;
+        emit_pre_pop_reg(emit, &vtype, arg_regs[i]);
+    }
+    emit_pre_pop_discard(emit); // the intrinsic itself
+    if (intr->nbytes != 0) {
+        emit_call_with_imm_arg(emit, intr->fun_kind, intr->nbytes, arg_regs[n_positional]);
+    } else {
+        emit_call(emit, intr->fun_kind);
+    }
+    if (intr->ret_vtype == VTYPE_PTR_NONE) {
+        emit_post_push_imm(emit, VTYPE_PTR_NONE, 0);
+    } else {
+        emit_post_push_reg(emit, intr->ret_vtype, REG_RET);
+    }
+}
+#endif
+
 STATIC void emit_native_call_function(emit_t *emit, mp_uint_t n_positional, mp_uint_t n_keyword, mp_uint_t star_flags) {
     DEBUG_printf("call_function(n_pos=" UINT_FMT ", n_kw=" UINT_FMT ", star_flags=" UINT_FMT ")\n", n_positional, n_keyword, star_flags);
 
@@ -2120,6 +2287,23 @@ STATIC void emit_native_call_function(emit_t *emit, mp_uint_t n_positional, mp_u
         assert(!star_flags);
         DEBUG_printf("  cast to %d\n", vtype_fun);
         vtype_kind_t vtype_cast = peek_stack(emit, 1)->data.u_imm;
+        #if MICROPY_EMIT_NATIVE_FLOAT
+        vtype_kind_t vtype_arg = peek_vtype(emit, 0);
+        if (vtype_cast == VTYPE_FLOAT
+            ? (vtype_arg != VTYPE_PYOBJ && vtype_arg != VTYPE_FLOAT && vtype_arg != VTYPE_BUILTIN_CAST)
+            : vtype_arg == VTYPE_FLOAT) {
+            // casting between a float and a machine word changes the representation,
+            // so go via an object (which doesn't need to allocate for a small int)
+            vtype_kind_t vtype;
+            emit_pre_pop_reg(emit, &vtype, REG_ARG_1);
+            emit_pre_pop_discard(emit);
+            emit_call_with_imm_arg(emit, MP_F_CONVERT_NATIVE_TO_OBJ, vtype, REG_ARG_2); // arg2 = type
+            ASM_MOV_REG_REG(emit->as, REG_ARG_1, REG_RET);
+            emit_call_with_imm_arg(emit, MP_F_CONVERT_OBJ_TO_NATIVE, vtype_cast, REG_ARG_2); // arg2 = type
+            emit_post_push_reg(emit, vtype_cast, REG_RET);
+            return;
+        }
+        #endif
         switch (peek_vtype(emit, 0)) {
             case VTYPE_PYOBJ: {
                 vtype_kind_t vtype;
@@ -2137,6 +2321,9 @@ STATIC void emit_native_call_function(emit_t *emit, mp_uint_t n_positional, mp_u
             case VTYPE_PTR16:
             case VTYPE_PTR32:
             case VTYPE_PTR_NONE:
+            #if MICROPY_EMIT_NATIVE_FLOAT
+            case VTYPE_FLOAT:
+            #endif
                 emit_fold_stack_top(emit, REG_ARG_1);
                 emit_post_top_set_vtype(emit, vtype_cast);
                 break;
@@ -2144,6 +2331,10 @@ STATIC void emit_native_call_function(emit_t *emit, mp_uint_t n_positional, mp_u
                 // this can happen when casting a cast: int(int)
                 mp_raise_NotImplementedError(translate("casting"));
         }
+    #if MICROPY_EMIT_NATIVE_VIPER_INTRINSICS
+    } else if (vtype_fun == VTYPE_BUILTIN_INTRINSIC) {
+        emit_native_call_intrinsic(emit, n_positional, n_keyword, star_flags);
+    #endif
     } else {
         assert(vtype_fun == VTYPE_PYOBJ);
         if (star_flags) {
@@ -2180,13 +2371,13 @@ STATIC void emit_native_return_value(emit_t *emit) {
         if (peek_vtype(emit, 0) == VTYPE_PTR_NONE) {
             emit_pre_pop_discard(emit);
             if (emit->return_vtype == VTYPE_PYOBJ) {
-                ASM_MOV_REG_IMM(emit->as, REG_RET, (mp_uint_t)mp_const_none);
+                ASM_MOV_REG_IMM(emit->as, REG_PARENT_RET, (mp_uint_t)mp_const_none);
             } else {
-                ASM_MOV_REG_IMM(emit->as, REG_RET, 0);
+                ASM_MOV_REG_IMM(emit->as, REG_PARENT_RET, 0);
             }
         } else {
             vtype_kind_t vtype;
-            emit_pre_pop_reg(emit, &vtype, REG_RET);
+            emit_pre_pop_reg(emit, &vtype, REG_PARENT_RET);
             if (vtype != emit->return_vtype) {
                 EMIT_NATIVE_VIPER_TYPE_ERROR(emit,
                     translate("return expected '%q' but got '%q'"),
@@ -2195,7 +2386,7 @@ STATIC void emit_native_return_value(emit_t *emit) {
         }
     } else {
         vtype_kind_t vtype;
-        emit_pre_pop_reg(emit, &vtype, REG_RET);
+        emit_pre_pop_reg(emit, &vtype, REG_PARENT_RET);
         assert(vtype == VTYPE_PYOBJ);
     }
     emit->last_emit_was_return_value = true;
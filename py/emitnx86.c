@@ -59,6 +59,17 @@ STATIC byte mp_f_n_args[MP_F_NUMBER_OF] = {
     [MP_F_SETUP_CODE_STATE] = 5,
     [MP_F_SMALL_INT_FLOOR_DIVIDE] = 2,
     [MP_F_SMALL_INT_MODULO] = 2,
+    #if MICROPY_EMIT_NATIVE_FLOAT
+    [MP_F_FLOAT_BINARY_OP] = 3,
+    #endif
+    #if MICROPY_EMIT_NATIVE_VIPER_INTRINSICS
+    [MP_F_MEMCPY] = 3,
+    [MP_F_MEMMOVE] = 3,
+    [MP_F_MEMSET] = 3,
+    [MP_F_NATIVE_BSWAP] = 2,
+    [MP_F_NATIVE_LOAD_UNALIGNED] = 2,
+    [MP_F_NATIVE_STORE_UNALIGNED] = 3,
+    #endif
 };
 
 #define N_X86 (1)
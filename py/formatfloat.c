@@ -73,6 +73,8 @@ static inline int fp_signbit(float x) { union floatbits fb = {x}; return fb.u &
 #define fp_isinf(x) isinf(x)
 static inline int fp_iszero(float x) { union floatbits fb = {x}; return fb.u == 0; }
 static inline int fp_isless1(float x) { union floatbits fb = {x}; return fb.u < 0x3f800000; }
+#define FPUINT uint32_t
+#define FPFRAC_BITS 23
 
 #elif MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_DOUBLE
 
@@ -86,6 +88,8 @@ static inline int fp_isless1(float x) { union floatbits fb = {x}; return fb.u <
 #define fp_isinf(x) isinf(x)
 #define fp_iszero(x) (x == 0)
 #define fp_isless1(x) (x < 1.0)
+#define FPUINT uint64_t
+#define FPFRAC_BITS 52
 
 #endif
 
@@ -328,6 +332,26 @@ int mp_format_float(FPTYPE f, char *buf, size_t buf_size, char fmt, int prec, ch
     }
 
     // Print the digits of the mantissa
+    #if MICROPY_OPT_FAST_NUM_FORMAT
+    {
+        // f is below 16, so its fractional part is held exactly by an integer
+        // scaled by 2^FPFRAC_BITS.  Each digit is then one integer multiply by
+        // 10, which is cheaper than the float arithmetic and doesn't round.
+        int32_t d = (int32_t)f;
+        FPUINT frac = (FPUINT)((f - (FPTYPE)d) * (FPTYPE)((FPUINT)1 << FPFRAC_BITS));
+        for (int i = 0; i < num_digits; ++i, --dec) {
+            *s++ = '0' + d;
+            if (dec == 0 && prec > 0) {
+                *s++ = '.';
+            }
+            frac *= 10;
+            d = (int32_t)(frac >> FPFRAC_BITS);
+            frac &= ((FPUINT)1 << FPFRAC_BITS) - 1;
+        }
+        // Leave the digit to round by in f for the code below
+        f = (FPTYPE)d;
+    }
+    #else
     for (int i = 0; i < num_digits; ++i, --dec) {
         int32_t d = (int32_t)f;
         if (d < 0) {
@@ -341,6 +365,7 @@ int mp_format_float(FPTYPE f, char *buf, size_t buf_size, char fmt, int prec, ch
         f -= (FPTYPE)d;
         f *= FPCONST(10.0);
     }
+    #endif
 
     // Round
     // If we print non-exponential format (i.e. 'f'), but a digit we're going
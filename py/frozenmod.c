@@ -31,6 +31,55 @@
 #include "py/lexer.h"
 #include "py/frozenmod.h"
 
+#if MICROPY_MODULE_FROZEN_INDEX
+
+// The frozen name lists come with a minimal perfect hash index generated by
+// tools/frozenindex.py, laid out as:
+//   [num_buckets, num_slots, seed[num_buckets]..., slot[num_slots]...]
+// Each slot is the index of a module, with MP_FROZEN_INDEX_DIR set if the key
+// is a directory containing that module.
+#define MP_FROZEN_INDEX_DIR (0x8000)
+#define MP_FROZEN_INDEX_HASH_INIT (5381)
+
+// This must match hash_name in tools/frozenindex.py.
+STATIC uint32_t mp_frozen_index_hash(uint32_t h, const char *str, size_t len) {
+    for (const byte *s = (const byte*)str, *top = s + len; s < top; s++) {
+        h = (h * 33) ^ *s;
+    }
+    h ^= h >> 16;
+    h *= 0x45d9f3b;
+    h ^= h >> 16;
+    return h;
+}
+
+// Look up str in the index.  Returns the module index (possibly with
+// MP_FROZEN_INDEX_DIR set), or -1 if str is neither a frozen module nor a
+// directory containing one.
+STATIC int mp_frozen_index_lookup(const uint16_t *index, const char *names,
+    const uint32_t *name_offsets, const char *str, size_t len) {
+    size_t num_buckets = index[0];
+    size_t num_slots = index[1];
+    if (num_slots == 0) {
+        return -1;
+    }
+    const uint16_t *seeds = index + 2;
+    const uint16_t *slots = seeds + num_buckets;
+    uint32_t seed = seeds[mp_frozen_index_hash(MP_FROZEN_INDEX_HASH_INIT, str, len) % num_buckets];
+    int slot = slots[mp_frozen_index_hash(seed, str, len) % num_slots];
+
+    // The hash maps any string to some slot, so check that it's really a match.
+    const char *name = names + name_offsets[slot & ~MP_FROZEN_INDEX_DIR];
+    if (strncmp(name, str, len) != 0) {
+        return -1;
+    }
+    if (name[len] == ((slot & MP_FROZEN_INDEX_DIR) ? '/' : 0)) {
+        return slot;
+    }
+    return -1;
+}
+
+#endif
+
 #if MICROPY_MODULE_FROZEN_STR
 
 #ifndef MICROPY_MODULE_FROZEN_LEXER
@@ -42,6 +91,11 @@ mp_lexer_t *MICROPY_MODULE_FROZEN_LEXER(qstr src_name, const char *str, mp_uint_
 extern const char mp_frozen_str_names[];
 extern const uint32_t mp_frozen_str_sizes[];
 extern const char mp_frozen_str_content[];
+#if MICROPY_MODULE_FROZEN_INDEX
+extern const uint32_t mp_frozen_str_name_offsets[];
+extern const uint32_t mp_frozen_str_content_offsets[];
+extern const uint16_t mp_frozen_str_index[];
+#endif
 
 // str_len is length of str. *len is set on on output to size of content
 const char *mp_find_frozen_str(const char *str, size_t str_len, size_t *len) {
@@ -51,6 +105,15 @@ const char *mp_find_frozen_str(const char *str, size_t str_len, size_t *len) {
         str_len = str_len - MP_FROZEN_FAKE_DIR_SLASH_LENGTH;
     }
 
+    #if MICROPY_MODULE_FROZEN_INDEX
+    int i = mp_frozen_index_lookup(mp_frozen_str_index, mp_frozen_str_names,
+        mp_frozen_str_name_offsets, str, str_len);
+    if (i < 0 || (i & MP_FROZEN_INDEX_DIR)) {
+        return NULL;
+    }
+    *len = mp_frozen_str_sizes[i];
+    return mp_frozen_str_content + mp_frozen_str_content_offsets[i];
+    #else
     const char *name = mp_frozen_str_names;
 
     size_t offset = 0;
@@ -64,6 +127,7 @@ const char *mp_find_frozen_str(const char *str, size_t str_len, size_t *len) {
         offset += mp_frozen_str_sizes[i] + 1;
     }
     return NULL;
+    #endif
 }
 
 STATIC mp_lexer_t *mp_lexer_frozen_str(const char *str, size_t str_len) {
@@ -85,24 +149,117 @@ STATIC mp_lexer_t *mp_lexer_frozen_str(const char *str, size_t str_len) {
 #include "py/emitglue.h"
 
 extern const char mp_frozen_mpy_names[];
-extern const mp_raw_code_t *const mp_frozen_mpy_content[];
+#if MICROPY_MODULE_FROZEN_INDEX
+extern const uint32_t mp_frozen_mpy_name_offsets[];
+extern const uint16_t mp_frozen_mpy_index[];
+#endif
 
-STATIC const mp_raw_code_t *mp_find_frozen_mpy(const char *str, size_t str_len) {
+// Returns the index of the frozen module called str, or -1 if there isn't one.
+STATIC int mp_find_frozen_mpy_index(const char *str, size_t str_len) {
+    #if MICROPY_MODULE_FROZEN_INDEX
+    int i = mp_frozen_index_lookup(mp_frozen_mpy_index, mp_frozen_mpy_names,
+        mp_frozen_mpy_name_offsets, str, str_len);
+    if (i < 0 || (i & MP_FROZEN_INDEX_DIR)) {
+        return -1;
+    }
+    return i;
+    #else
     const char *name = mp_frozen_mpy_names;
-    for (size_t i = 0; *name != 0; i++) {
+    for (int i = 0; *name != 0; i++) {
         size_t l = strlen(name);
         if (l == str_len && !memcmp(str, name, l)) {
-            return mp_frozen_mpy_content[i];
+            return i;
         }
         name += l + 1;
     }
-    return NULL;
+    return -1;
+    #endif
 }
 
+#if MICROPY_MODULE_FROZEN_MPY_COMPRESSED
+
+#include "py/persistentcode.h"
+#include "py/runtime.h"
+#include "py/mperrno.h"
+
+#define UZLIB_CONF_PARANOID_CHECKS (1)
+#include "../lib/uzlib/src/tinf.h"
+
+// Each module is a raw deflate stream of its .mpy file, compressed against a
+// preset dictionary that all the modules share.  tools/mpy-tool.py --compress
+// generates these.
+extern const uint32_t mp_frozen_mpyz_dict_len;
+extern const uint8_t mp_frozen_mpyz_dict[];
+extern const uint32_t mp_frozen_mpyz_sizes[];
+extern const uint32_t mp_frozen_mpyz_offsets[];
+extern const uint8_t mp_frozen_mpyz_content[];
+
+STATIC const mp_raw_code_t *mp_find_frozen_mpy(const char *str, size_t str_len) {
+    int i = mp_find_frozen_mpy_index(str, str_len);
+    if (i < 0) {
+        return NULL;
+    }
+
+    // Inflate straight after a copy of the dictionary, so that matches which
+    // reach back into the dictionary find it just before the output.
+    size_t dict_len = mp_frozen_mpyz_dict_len;
+    size_t len = mp_frozen_mpyz_sizes[i];
+    byte *buf = m_new(byte, dict_len + len);
+    memcpy(buf, mp_frozen_mpyz_dict, dict_len);
+
+    TINF_DATA d;
+    memset(&d, 0, sizeof(d));
+    uzlib_uncompress_init(&d, NULL, 0);
+    d.source = mp_frozen_mpyz_content + mp_frozen_mpyz_offsets[i];
+    d.source_limit = mp_frozen_mpyz_content + mp_frozen_mpyz_offsets[i + 1];
+    d.dest = buf + dict_len;
+    d.dest_limit = buf + dict_len + len;
+    int st = uzlib_uncompress(&d);
+    if (st < 0 || d.dest != d.dest_limit) {
+        m_del(byte, buf, dict_len + len);
+        mp_raise_OSError(MP_EINVAL);
+    }
+
+    // The loader copies everything it keeps, so the buffer can go straight away.
+    mp_raw_code_t *rc = mp_raw_code_load_mem(buf + dict_len, len);
+    m_del(byte, buf, dict_len + len);
+    return rc;
+}
+
+#if !MICROPY_PY_UZLIB
+// extmod/moduzlib.c compiles the decompressor in when it's enabled.
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#include "../lib/uzlib/src/tinflate.c"
+#endif
+
+#else
+
+extern const mp_raw_code_t *const mp_frozen_mpy_content[];
+
+STATIC const mp_raw_code_t *mp_find_frozen_mpy(const char *str, size_t str_len) {
+    int i = mp_find_frozen_mpy_index(str, str_len);
+    return i < 0 ? NULL : mp_frozen_mpy_content[i];
+}
+
+#endif // MICROPY_MODULE_FROZEN_MPY_COMPRESSED
+
 #endif
 
 #if MICROPY_MODULE_FROZEN
 
+#if MICROPY_MODULE_FROZEN_INDEX
+
+STATIC mp_import_stat_t mp_frozen_stat_helper(const uint16_t *index, const char *names,
+    const uint32_t *name_offsets, const char *str) {
+    int i = mp_frozen_index_lookup(index, names, name_offsets, str, strlen(str));
+    if (i < 0) {
+        return MP_IMPORT_STAT_NO_EXIST;
+    }
+    return (i & MP_FROZEN_INDEX_DIR) ? MP_IMPORT_STAT_DIR : MP_IMPORT_STAT_FILE;
+}
+
+#else
+
 STATIC mp_import_stat_t mp_frozen_stat_helper(const char *name, const char *str) {
     size_t len = strlen(str);
 
@@ -120,18 +277,28 @@ STATIC mp_import_stat_t mp_frozen_stat_helper(const char *name, const char *str)
     return MP_IMPORT_STAT_NO_EXIST;
 }
 
+#endif
+
 mp_import_stat_t mp_frozen_stat(const char *str) {
     mp_import_stat_t stat;
 
     #if MICROPY_MODULE_FROZEN_STR
+    #if MICROPY_MODULE_FROZEN_INDEX
+    stat = mp_frozen_stat_helper(mp_frozen_str_index, mp_frozen_str_names, mp_frozen_str_name_offsets, str);
+    #else
     stat = mp_frozen_stat_helper(mp_frozen_str_names, str);
+    #endif
     if (stat != MP_IMPORT_STAT_NO_EXIST) {
         return stat;
     }
     #endif
 
     #if MICROPY_MODULE_FROZEN_MPY
+    #if MICROPY_MODULE_FROZEN_INDEX
+    stat = mp_frozen_stat_helper(mp_frozen_mpy_index, mp_frozen_mpy_names, mp_frozen_mpy_name_offsets, str);
+    #else
     stat = mp_frozen_stat_helper(mp_frozen_mpy_names, str);
+    #endif
     if (stat != MP_IMPORT_STAT_NO_EXIST) {
         return stat;
     }
@@ -28,9 +28,11 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "py/bc.h"
 #include "py/gc.h"
 #include "py/runtime.h"
 
+#include "supervisor/linker.h"
 #include "supervisor/shared/safe_mode.h"
 
 #if MICROPY_ENABLE_GC
@@ -67,26 +69,65 @@
 #define BLOCKS_PER_ATB (4)
 
 #define BLOCK_SHIFT(block) (2 * ((block) & (BLOCKS_PER_ATB - 1)))
-#define ATB_GET_KIND(block) ((MP_STATE_MEM(gc_alloc_table_start)[(block) / BLOCKS_PER_ATB] >> BLOCK_SHIFT(block)) & 3)
-#define ATB_ANY_TO_FREE(block) do { MP_STATE_MEM(gc_alloc_table_start)[(block) / BLOCKS_PER_ATB] &= (~(AT_MARK << BLOCK_SHIFT(block))); } while (0)
-#define ATB_FREE_TO_HEAD(block) do { MP_STATE_MEM(gc_alloc_table_start)[(block) / BLOCKS_PER_ATB] |= (AT_HEAD << BLOCK_SHIFT(block)); } while (0)
-#define ATB_FREE_TO_TAIL(block) do { MP_STATE_MEM(gc_alloc_table_start)[(block) / BLOCKS_PER_ATB] |= (AT_TAIL << BLOCK_SHIFT(block)); } while (0)
-#define ATB_HEAD_TO_MARK(block) do { MP_STATE_MEM(gc_alloc_table_start)[(block) / BLOCKS_PER_ATB] |= (AT_MARK << BLOCK_SHIFT(block)); } while (0)
-#define ATB_MARK_TO_HEAD(block) do { MP_STATE_MEM(gc_alloc_table_start)[(block) / BLOCKS_PER_ATB] &= (~(AT_TAIL << BLOCK_SHIFT(block))); } while (0)
-
-#define BLOCK_FROM_PTR(ptr) (((byte*)(ptr) - MP_STATE_MEM(gc_pool_start)) / BYTES_PER_BLOCK)
-#define PTR_FROM_BLOCK(block) (((block) * BYTES_PER_BLOCK + (uintptr_t)MP_STATE_MEM(gc_pool_start)))
+#define ATB_GET_KIND(area, block) (((area)->gc_alloc_table_start[(block) / BLOCKS_PER_ATB] >> BLOCK_SHIFT(block)) & 3)
+#define ATB_ANY_TO_FREE(area, block) do { (area)->gc_alloc_table_start[(block) / BLOCKS_PER_ATB] &= (~(AT_MARK << BLOCK_SHIFT(block))); } while (0)
+#define ATB_FREE_TO_HEAD(area, block) do { (area)->gc_alloc_table_start[(block) / BLOCKS_PER_ATB] |= (AT_HEAD << BLOCK_SHIFT(block)); } while (0)
+#define ATB_FREE_TO_TAIL(area, block) do { (area)->gc_alloc_table_start[(block) / BLOCKS_PER_ATB] |= (AT_TAIL << BLOCK_SHIFT(block)); } while (0)
+#define ATB_HEAD_TO_MARK(area, block) do { (area)->gc_alloc_table_start[(block) / BLOCKS_PER_ATB] |= (AT_MARK << BLOCK_SHIFT(block)); } while (0)
+#define ATB_MARK_TO_HEAD(area, block) do { (area)->gc_alloc_table_start[(block) / BLOCKS_PER_ATB] &= (~(AT_TAIL << BLOCK_SHIFT(block))); } while (0)
+// True if any of the four blocks of an ATB is free.
+#define ATB_HAS_FREE(a) ((((a) | ((a) >> 1)) & 0x55) != 0x55)
+
+#define BLOCK_FROM_PTR(area, ptr) (((byte*)(ptr) - (area)->gc_pool_start) / BYTES_PER_BLOCK)
+#define PTR_FROM_BLOCK(area, block) (((block) * BYTES_PER_BLOCK + (uintptr_t)(area)->gc_pool_start))
 #define ATB_FROM_BLOCK(bl) ((bl) / BLOCKS_PER_ATB)
 
+#if MICROPY_GC_SPLIT_HEAP
+#define NEXT_AREA(area) ((area)->next)
+#define PTR_AREA(ptr) gc_get_ptr_area(ptr)
+// The area of a pointer that is already known to be the head of a block.
+#define HEAP_PTR_AREA(ptr) gc_get_ptr_area(ptr)
+#else
+#define NEXT_AREA(area) (NULL)
+#define PTR_AREA(ptr) (VERIFY_PTR(ptr) ? &MP_STATE_MEM(area) : NULL)
+#define HEAP_PTR_AREA(ptr) (&MP_STATE_MEM(area))
+#endif
+#define MAIN_AREA (&MP_STATE_MEM(area))
+
 #if MICROPY_ENABLE_FINALISER
 // FTB = finaliser table byte
 // if set, then the corresponding block may have a finaliser
 
 #define BLOCKS_PER_FTB (8)
 
-#define FTB_GET(block) ((MP_STATE_MEM(gc_finaliser_table_start)[(block) / BLOCKS_PER_FTB] >> ((block) & 7)) & 1)
-#define FTB_SET(block) do { MP_STATE_MEM(gc_finaliser_table_start)[(block) / BLOCKS_PER_FTB] |= (1 << ((block) & 7)); } while (0)
-#define FTB_CLEAR(block) do { MP_STATE_MEM(gc_finaliser_table_start)[(block) / BLOCKS_PER_FTB] &= (~(1 << ((block) & 7))); } while (0)
+#define FTB_GET(area, block) (((area)->gc_finaliser_table_start[(block) / BLOCKS_PER_FTB] >> ((block) & 7)) & 1)
+#define FTB_SET(area, block) do { (area)->gc_finaliser_table_start[(block) / BLOCKS_PER_FTB] |= (1 << ((block) & 7)); } while (0)
+#define FTB_CLEAR(area, block) do { (area)->gc_finaliser_table_start[(block) / BLOCKS_PER_FTB] &= (~(1 << ((block) & 7))); } while (0)
+#endif
+
+#if MICROPY_GC_INCREMENTAL
+// States of an incremental collection.
+#define GC_INCREMENTAL_IDLE (0)
+#define GC_INCREMENTAL_ROOTS (1) // gc_collect() is pushing roots instead of tracing them
+#define GC_INCREMENTAL_MARK (2)  // roots are pushed, marking proceeds in steps
+
+// Outside of gc_collect() a head can only be marked by an incremental cycle.
+#define GC_INCREMENTAL_MARKED(area, block) (MP_STATE_MEM(gc_incremental_state) == GC_INCREMENTAL_MARK && ATB_GET_KIND(area, block) == AT_MARK)
+#else
+#define GC_INCREMENTAL_MARKED(area, block) (false)
+#endif
+
+#if MICROPY_GC_DEFERRED_FINALISER && !(MICROPY_ENABLE_FINALISER && MICROPY_ENABLE_SCHEDULER)
+#error MICROPY_GC_DEFERRED_FINALISER requires MICROPY_ENABLE_FINALISER and MICROPY_ENABLE_SCHEDULER
+#endif
+
+#if MICROPY_GC_LAZY_SWEEP
+// Outside of gc_collect() a head is also marked if it is live and a lazy sweep
+// hasn't reached it yet.
+#define GC_MARKED_HEAD(area, block) (GC_INCREMENTAL_MARKED(area, block) || \
+    (MP_STATE_MEM(gc_sweep_pending) && ATB_GET_KIND(area, block) == AT_MARK))
+#else
+#define GC_MARKED_HEAD(area, block) GC_INCREMENTAL_MARKED(area, block)
 #endif
 
 #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
@@ -108,8 +149,64 @@ void __attribute__ ((noinline)) gc_log_change(uint32_t start_block, uint32_t len
 #pragma GCC pop_options
 #endif
 
+#if MICROPY_GC_TRACE
+#define GC_TRACE(kind, area, block, n_blocks) gc_trace_event((kind), (void *)PTR_FROM_BLOCK(area, block), (n_blocks))
+#else
+#define GC_TRACE(kind, area, block, n_blocks)
+#endif
+
+#if MICROPY_GC_ALLOC_PROFILE
+// Charge n_bytes to the bytecode location currently being executed. Each
+// location gets a slot in the fixed size profile table; when the table is full
+// the slot with the fewest bytes is given up to the new location.
+STATIC void gc_profile_record(size_t n_bytes) {
+    qstr block_name = MP_QSTR_NULL;
+    qstr source_file = MP_QSTR_NULL;
+    size_t line = 0;
+    const mp_code_state_t *code_state = MP_STATE_THREAD(current_code_state);
+    if (code_state != NULL) {
+        line = mp_code_state_get_source_line(code_state, &block_name, &source_file);
+    }
+
+    mp_gc_profile_entry_t *entry = NULL;
+    mp_gc_profile_entry_t *smallest = &MP_STATE_MEM(gc_profile)[0];
+    for (size_t i = 0; i < MICROPY_GC_ALLOC_PROFILE_ENTRIES; i++) {
+        mp_gc_profile_entry_t *e = &MP_STATE_MEM(gc_profile)[i];
+        if (e->count > 0 && e->line == line && e->block_name == block_name && e->source_file == source_file) {
+            entry = e;
+            break;
+        }
+        if (e->bytes < smallest->bytes) {
+            smallest = e;
+        }
+    }
+    if (entry == NULL) {
+        entry = smallest;
+        entry->block_name = block_name;
+        entry->source_file = source_file;
+        entry->line = line;
+        entry->count = 0;
+        entry->bytes = 0;
+    }
+    entry->count++;
+    entry->bytes += n_bytes;
+}
+
+void gc_profile_enable(bool enable) {
+    MP_STATE_MEM(gc_profile_enabled) = enable;
+}
+
+bool gc_profile_is_enabled(void) {
+    return MP_STATE_MEM(gc_profile_enabled);
+}
+
+void gc_profile_reset(void) {
+    memset(MP_STATE_MEM(gc_profile), 0, sizeof(MP_STATE_MEM(gc_profile)));
+}
+#endif
+
 // TODO waste less memory; currently requires that all entries in alloc_table have a corresponding block in pool
-void gc_init(void *start, void *end) {
+STATIC void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     // align end pointer on block boundary
     end = (void*)((uintptr_t)end & (~(BYTES_PER_BLOCK - 1)));
     DEBUG_printf("Initializing GC heap: %p..%p = " UINT_FMT " bytes\n", start, end, (byte*)end - (byte*)start);
@@ -121,48 +218,74 @@ void gc_init(void *start, void *end) {
     // => T = A * (1 + BLOCKS_PER_ATB / BLOCKS_PER_FTB + BLOCKS_PER_ATB * BYTES_PER_BLOCK)
     size_t total_byte_len = (byte*)end - (byte*)start;
 #if MICROPY_ENABLE_FINALISER
-    MP_STATE_MEM(gc_alloc_table_byte_len) = total_byte_len * BITS_PER_BYTE / (BITS_PER_BYTE + BITS_PER_BYTE * BLOCKS_PER_ATB / BLOCKS_PER_FTB + BITS_PER_BYTE * BLOCKS_PER_ATB * BYTES_PER_BLOCK);
+    area->gc_alloc_table_byte_len = total_byte_len * BITS_PER_BYTE / (BITS_PER_BYTE + BITS_PER_BYTE * BLOCKS_PER_ATB / BLOCKS_PER_FTB + BITS_PER_BYTE * BLOCKS_PER_ATB * BYTES_PER_BLOCK);
 #else
-    MP_STATE_MEM(gc_alloc_table_byte_len) = total_byte_len / (1 + BITS_PER_BYTE / 2 * BYTES_PER_BLOCK);
+    area->gc_alloc_table_byte_len = total_byte_len / (1 + BITS_PER_BYTE / 2 * BYTES_PER_BLOCK);
 #endif
 
-    MP_STATE_MEM(gc_alloc_table_start) = (byte*)start;
+    area->gc_alloc_table_start = (byte*)start;
 
 #if MICROPY_ENABLE_FINALISER
-    size_t gc_finaliser_table_byte_len = (MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB + BLOCKS_PER_FTB - 1) / BLOCKS_PER_FTB;
-    MP_STATE_MEM(gc_finaliser_table_start) = MP_STATE_MEM(gc_alloc_table_start) + MP_STATE_MEM(gc_alloc_table_byte_len);
+    size_t gc_finaliser_table_byte_len = (area->gc_alloc_table_byte_len * BLOCKS_PER_ATB + BLOCKS_PER_FTB - 1) / BLOCKS_PER_FTB;
+    area->gc_finaliser_table_start = area->gc_alloc_table_start + area->gc_alloc_table_byte_len;
 #endif
 
-    size_t gc_pool_block_len = MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB;
-    MP_STATE_MEM(gc_pool_start) = (byte*)end - gc_pool_block_len * BYTES_PER_BLOCK;
-    MP_STATE_MEM(gc_pool_end) = end;
+    size_t gc_pool_block_len = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+    area->gc_pool_start = (byte*)end - gc_pool_block_len * BYTES_PER_BLOCK;
+    area->gc_pool_end = end;
 
 #if MICROPY_ENABLE_FINALISER
-    assert(MP_STATE_MEM(gc_pool_start) >= MP_STATE_MEM(gc_finaliser_table_start) + gc_finaliser_table_byte_len);
+    assert(area->gc_pool_start >= area->gc_finaliser_table_start + gc_finaliser_table_byte_len);
 #endif
 
     // clear ATBs
-    memset(MP_STATE_MEM(gc_alloc_table_start), 0, MP_STATE_MEM(gc_alloc_table_byte_len));
+    memset(area->gc_alloc_table_start, 0, area->gc_alloc_table_byte_len);
 
 #if MICROPY_ENABLE_FINALISER
     // clear FTBs
-    memset(MP_STATE_MEM(gc_finaliser_table_start), 0, gc_finaliser_table_byte_len);
+    memset(area->gc_finaliser_table_start, 0, gc_finaliser_table_byte_len);
 #endif
 
+    #if MICROPY_GC_SPLIT_HEAP
+    area->next = NULL;
+    area->gc_first_free_atb_index = 0;
+    #endif
+    area->gc_overflow_lo = SIZE_MAX;
+    area->gc_overflow_hi = 0;
+
+    DEBUG_printf("GC layout:\n");
+    DEBUG_printf("  alloc table at %p, length " UINT_FMT " bytes, " UINT_FMT " blocks\n", area->gc_alloc_table_start, area->gc_alloc_table_byte_len, area->gc_alloc_table_byte_len * BLOCKS_PER_ATB);
+#if MICROPY_ENABLE_FINALISER
+    DEBUG_printf("  finaliser table at %p, length " UINT_FMT " bytes, " UINT_FMT " blocks\n", area->gc_finaliser_table_start, gc_finaliser_table_byte_len, gc_finaliser_table_byte_len * BLOCKS_PER_FTB);
+#endif
+    DEBUG_printf("  pool at %p, length " UINT_FMT " bytes, " UINT_FMT " blocks\n", area->gc_pool_start, gc_pool_block_len * BYTES_PER_BLOCK, gc_pool_block_len);
+}
+
+void gc_init(void *start, void *end) {
+    gc_setup_area(MAIN_AREA, start, end);
+
     // Set first free ATB index to the start of the heap.
     for (size_t i = 0; i < MICROPY_ATB_INDICES; i++) {
         MP_STATE_MEM(gc_first_free_atb_index)[i] = 0;
     }
 
     // Set last free ATB index to the end of the heap.
-    MP_STATE_MEM(gc_last_free_atb_index) = MP_STATE_MEM(gc_alloc_table_byte_len) - 1;
+    MP_STATE_MEM(gc_last_free_atb_index) = MAIN_AREA->gc_alloc_table_byte_len - 1;
 
     // Set the lowest long lived ptr to the end of the heap to start. This will be lowered as long
     // lived objects are allocated.
-    MP_STATE_MEM(gc_lowest_long_lived_ptr) = (void*) PTR_FROM_BLOCK(MP_STATE_MEM(gc_alloc_table_byte_len * BLOCKS_PER_ATB));
+    MP_STATE_MEM(gc_lowest_long_lived_ptr) = (void*) PTR_FROM_BLOCK(MAIN_AREA, MAIN_AREA->gc_alloc_table_byte_len * BLOCKS_PER_ATB);
 
     // unlock the GC
     MP_STATE_MEM(gc_lock_depth) = 0;
+    MP_STATE_MEM(gc_stack_overflow) = 0;
+    MP_STATE_MEM(gc_stack_overflow_count) = 0;
+    MP_STATE_MEM(gc_rescan_area) = NULL;
+    MP_STATE_MEM(gc_spill) = NULL;
+    MP_STATE_MEM(gc_spill_len) = 0;
+    MP_STATE_MEM(gc_spill_cap) = 0;
+    MP_STATE_MEM(gc_spill_spare) = NULL;
+    MP_STATE_MEM(gc_spill_area) = NULL;
 
     // allow auto collection
     MP_STATE_MEM(gc_auto_collect_enabled) = true;
@@ -173,25 +296,83 @@ void gc_init(void *start, void *end) {
     MP_STATE_MEM(gc_alloc_amount) = 0;
     #endif
 
+    #if MICROPY_GC_LAZY_SWEEP
+    MP_STATE_MEM(gc_sweep_pending) = false;
+    MP_STATE_MEM(gc_sweep_lazily) = false;
+    #endif
+
+    #if MICROPY_GC_DEFERRED_FINALISER
+    MP_STATE_MEM(gc_finaliser_len) = 0;
+    MP_STATE_MEM(gc_finalise_now) = false;
+    memset(MP_STATE_VM(gc_finaliser_queue), 0, sizeof(MP_STATE_VM(gc_finaliser_queue)));
+    #endif
+
+    #if MICROPY_GC_IDLE_COLLECT
+    // Nothing is known about the heap use yet, so start at the smallest budget.
+    MP_STATE_MEM(gc_idle_alloc_amount) = 0;
+    MP_STATE_MEM(gc_idle_budget) = MICROPY_GC_IDLE_COLLECT_MIN_ALLOC;
+    MP_STATE_MEM(gc_idle_shift) = 0;
+    MP_STATE_MEM(gc_idle_missed) = false;
+    #endif
+
+    #if MICROPY_GC_INCREMENTAL
+    MP_STATE_MEM(gc_incremental_state) = GC_INCREMENTAL_IDLE;
+    MP_STATE_MEM(gc_incremental_alloc_amount) = 0;
+    #endif
+
+    #if MICROPY_GC_ALLOC_PROFILE
+    MP_STATE_MEM(gc_profile_enabled) = false;
+    gc_profile_reset();
+    #endif
+
     #if MICROPY_PY_THREAD
     mp_thread_mutex_init(&MP_STATE_MEM(gc_mutex));
     #endif
 
     MP_STATE_MEM(permanent_pointers) = NULL;
+}
 
-    DEBUG_printf("GC layout:\n");
-    DEBUG_printf("  alloc table at %p, length " UINT_FMT " bytes, " UINT_FMT " blocks\n", MP_STATE_MEM(gc_alloc_table_start), MP_STATE_MEM(gc_alloc_table_byte_len), MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB);
-#if MICROPY_ENABLE_FINALISER
-    DEBUG_printf("  finaliser table at %p, length " UINT_FMT " bytes, " UINT_FMT " blocks\n", MP_STATE_MEM(gc_finaliser_table_start), gc_finaliser_table_byte_len, gc_finaliser_table_byte_len * BLOCKS_PER_FTB);
-#endif
-    DEBUG_printf("  pool at %p, length " UINT_FMT " bytes, " UINT_FMT " blocks\n", MP_STATE_MEM(gc_pool_start), gc_pool_block_len * BYTES_PER_BLOCK, gc_pool_block_len);
+#if MICROPY_GC_SPLIT_HEAP
+void gc_add(void *start, void *end) {
+    // The area's own state is kept at the start of the memory it manages.
+    mp_state_mem_area_t *area = (mp_state_mem_area_t*)(((uintptr_t)start + sizeof(void*) - 1) & ~(sizeof(void*) - 1));
+    void *tables = area + 1;
+    if ((byte*)end <= (byte*)tables + BYTES_PER_BLOCK * 2) {
+        return;
+    }
+    gc_setup_area(area, tables, end);
+
+    GC_ENTER();
+    mp_state_mem_area_t *prev = MAIN_AREA;
+    while (prev->next != NULL) {
+        prev = prev->next;
+    }
+    prev->next = area;
+    GC_EXIT();
 }
 
+mp_state_mem_area_t *gc_get_ptr_area(const void *ptr) {
+    if (((uintptr_t)(ptr) & (BYTES_PER_BLOCK - 1)) != 0) {
+        return NULL;
+    }
+    for (mp_state_mem_area_t *area = MAIN_AREA; area != NULL; area = area->next) {
+        if (ptr >= (void*)area->gc_pool_start && ptr < (void*)area->gc_pool_end) {
+            return area;
+        }
+    }
+    return NULL;
+}
+#else
+mp_state_mem_area_t *gc_get_ptr_area(const void *ptr) {
+    return PTR_AREA(ptr);
+}
+#endif
+
 void gc_deinit(void) {
     // Run any finalizers before we stop using the heap.
     gc_sweep_all();
 
-    MP_STATE_MEM(gc_pool_start) = 0;
+    MAIN_AREA->gc_pool_start = 0;
 }
 
 void gc_lock(void) {
@@ -218,11 +399,175 @@ bool gc_is_locked(void) {
 #endif
 #endif
 
+// Widen the area's overflow window to cover blocks lo up to hi.
+STATIC void gc_overflow_window_add(mp_state_mem_area_t *area, size_t lo, size_t hi) {
+    if (lo >= hi) {
+        return;
+    }
+    if (lo < area->gc_overflow_lo) {
+        area->gc_overflow_lo = lo;
+    }
+    if (hi > area->gc_overflow_hi) {
+        area->gc_overflow_hi = hi;
+    }
+    MP_STATE_MEM(gc_stack_overflow) = 1;
+}
+
+// Maximum number of free blocks borrowed at a time to hold spilled heads.
+#define GC_SPILL_CHUNK_BLOCKS (8)
+
+// Number of words in the spill chunk.
+STATIC size_t gc_spill_chunk_words(void **chunk) {
+    mp_state_mem_area_t *area = HEAP_PTR_AREA(chunk);
+    size_t block = BLOCK_FROM_PTR(area, chunk);
+    size_t n_blocks = 0;
+    do {
+        n_blocks += 1;
+    } while (ATB_GET_KIND(area, block + n_blocks) == AT_TAIL);
+    return n_blocks * BYTES_PER_BLOCK / sizeof(void*);
+}
+
+// Borrow a run of free blocks to hold spilled heads, or return NULL if the
+// heap has none left. The search only moves forward during a collection.
+STATIC void **gc_spill_borrow(void) {
+    mp_state_mem_area_t *area = MP_STATE_MEM(gc_spill_area);
+    size_t block = MP_STATE_MEM(gc_spill_block);
+    for (; area != NULL; area = NEXT_AREA(area), block = 0) {
+        size_t total_blocks = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+        while (block < total_blocks) {
+            if (block % BLOCKS_PER_ATB == 0 && !ATB_HAS_FREE(area->gc_alloc_table_start[block / BLOCKS_PER_ATB])) {
+                block += BLOCKS_PER_ATB;
+                continue;
+            }
+            if (ATB_GET_KIND(area, block) != AT_FREE) {
+                block++;
+                continue;
+            }
+            // A head that nothing points to, so it can't be mistaken for a
+            // live object, and the sweep would free it if it were left.
+            size_t n_blocks = 1;
+            ATB_FREE_TO_HEAD(area, block);
+            #if MICROPY_ENABLE_FINALISER
+            FTB_CLEAR(area, block);
+            #endif
+            while (n_blocks < GC_SPILL_CHUNK_BLOCKS && block + n_blocks < total_blocks &&
+                ATB_GET_KIND(area, block + n_blocks) == AT_FREE) {
+                ATB_FREE_TO_TAIL(area, block + n_blocks);
+                n_blocks++;
+            }
+            MP_STATE_MEM(gc_spill_area) = area;
+            MP_STATE_MEM(gc_spill_block) = block + n_blocks;
+            return (void**)PTR_FROM_BLOCK(area, block);
+        }
+    }
+    MP_STATE_MEM(gc_spill_area) = NULL;
+    return NULL;
+}
+
+STATIC bool gc_spill_push(void *ptr) {
+    if (MP_STATE_MEM(gc_spill_len) == MP_STATE_MEM(gc_spill_cap)) {
+        void **chunk = MP_STATE_MEM(gc_spill_spare);
+        if (chunk != NULL) {
+            MP_STATE_MEM(gc_spill_spare) = chunk[0];
+        } else {
+            chunk = gc_spill_borrow();
+            if (chunk == NULL) {
+                return false;
+            }
+        }
+        chunk[0] = MP_STATE_MEM(gc_spill);
+        MP_STATE_MEM(gc_spill) = chunk;
+        MP_STATE_MEM(gc_spill_len) = 1;
+        MP_STATE_MEM(gc_spill_cap) = gc_spill_chunk_words(chunk);
+    }
+    MP_STATE_MEM(gc_spill)[MP_STATE_MEM(gc_spill_len)++] = ptr;
+    return true;
+}
+
+// Returns the most recently spilled head, or NULL if there are none.
+STATIC void *gc_spill_pop(void) {
+    void **chunk = MP_STATE_MEM(gc_spill);
+    if (chunk == NULL) {
+        return NULL;
+    }
+    if (MP_STATE_MEM(gc_spill_len) == 1) {
+        // This chunk is empty, so move it to the spares. The one below is full.
+        MP_STATE_MEM(gc_spill) = chunk[0];
+        chunk[0] = MP_STATE_MEM(gc_spill_spare);
+        MP_STATE_MEM(gc_spill_spare) = chunk;
+        chunk = MP_STATE_MEM(gc_spill);
+        if (chunk == NULL) {
+            MP_STATE_MEM(gc_spill_len) = 0;
+            MP_STATE_MEM(gc_spill_cap) = 0;
+            return NULL;
+        }
+        MP_STATE_MEM(gc_spill_cap) = gc_spill_chunk_words(chunk);
+        MP_STATE_MEM(gc_spill_len) = MP_STATE_MEM(gc_spill_cap);
+    }
+    return chunk[--MP_STATE_MEM(gc_spill_len)];
+}
+
+STATIC void gc_spill_free_chunks(void **chunk) {
+    while (chunk != NULL) {
+        void **next = chunk[0];
+        mp_state_mem_area_t *area = HEAP_PTR_AREA(chunk);
+        size_t block = BLOCK_FROM_PTR(area, chunk);
+        do {
+            ATB_ANY_TO_FREE(area, block);
+            block++;
+        } while (ATB_GET_KIND(area, block) == AT_TAIL);
+        chunk = next;
+    }
+}
+
+// Give the borrowed blocks back once marking is over.
+STATIC void gc_spill_release(void) {
+    gc_spill_free_chunks(MP_STATE_MEM(gc_spill));
+    gc_spill_free_chunks(MP_STATE_MEM(gc_spill_spare));
+    MP_STATE_MEM(gc_spill) = NULL;
+    MP_STATE_MEM(gc_spill_len) = 0;
+    MP_STATE_MEM(gc_spill_cap) = 0;
+    MP_STATE_MEM(gc_spill_spare) = NULL;
+}
+
+// Start borrowing from the lowest free block a collection can find.
+STATIC void gc_spill_reset(void) {
+    MP_STATE_MEM(gc_spill_area) = MAIN_AREA;
+    MP_STATE_MEM(gc_spill_block) = MP_STATE_MEM(gc_first_free_atb_index)[0] * BLOCKS_PER_ATB;
+}
+
+// The marked head at block couldn't be pushed because the mark stack is full.
+// It is spilled into borrowed heap blocks so each block is still scanned only
+// once. If the heap has no free block left, it is dropped instead, and later
+// only the window around the dropped blocks is rescanned; a block the rescan
+// in progress has yet to reach needs no window at all.
+STATIC void gc_stack_overflowed(mp_state_mem_area_t *area, size_t block) {
+    MP_STATE_MEM(gc_stack_overflow_count)++;
+    if (gc_spill_push((void*)PTR_FROM_BLOCK(area, block))) {
+        return;
+    }
+    if (area == MP_STATE_MEM(gc_rescan_area) &&
+        block >= MP_STATE_MEM(gc_rescan_block) && block < MP_STATE_MEM(gc_rescan_end)) {
+        return;
+    }
+    gc_overflow_window_add(area, block, block + 1);
+}
+
+// Start rescanning the area's overflow window, leaving it empty for blocks
+// dropped from now on.
+STATIC void gc_rescan_take_window(mp_state_mem_area_t *area) {
+    MP_STATE_MEM(gc_rescan_area) = area;
+    MP_STATE_MEM(gc_rescan_block) = area->gc_overflow_lo;
+    MP_STATE_MEM(gc_rescan_end) = area->gc_overflow_hi;
+    area->gc_overflow_lo = SIZE_MAX;
+    area->gc_overflow_hi = 0;
+}
+
 // Take the given block as the topmost block on the stack. Check all it's
 // children: mark the unmarked child blocks and put those newly marked
 // blocks on the stack. When all children have been checked, pop off the
 // topmost block on the stack and repeat with that one.
-STATIC void gc_mark_subtree(size_t block) {
+STATIC void PLACE_IN_ITCM_HOT(gc_mark_subtree)(mp_state_mem_area_t *area, size_t block) {
     // Start with the block passed in the argument.
     size_t sp = 0;
     for (;;) {
@@ -230,64 +575,119 @@ STATIC void gc_mark_subtree(size_t block) {
         size_t n_blocks = 0;
         do {
             n_blocks += 1;
-        } while (ATB_GET_KIND(block + n_blocks) == AT_TAIL);
+        } while (ATB_GET_KIND(area, block + n_blocks) == AT_TAIL);
 
         // check this block's children
-        void **ptrs = (void**)PTR_FROM_BLOCK(block);
+        void **ptrs = (void**)PTR_FROM_BLOCK(area, block);
         for (size_t i = n_blocks * BYTES_PER_BLOCK / sizeof(void*); i > 0; i--, ptrs++) {
             void *ptr = *ptrs;
-            if (VERIFY_PTR(ptr)) {
+            mp_state_mem_area_t *ptr_area = PTR_AREA(ptr);
+            if (ptr_area != NULL) {
                 // Mark and push this pointer
-                size_t childblock = BLOCK_FROM_PTR(ptr);
-                if (ATB_GET_KIND(childblock) == AT_HEAD) {
+                size_t childblock = BLOCK_FROM_PTR(ptr_area, ptr);
+                if (ATB_GET_KIND(ptr_area, childblock) == AT_HEAD) {
                     // an unmarked head, mark it, and push it on gc stack
                     TRACE_MARK(childblock, ptr);
-                    ATB_HEAD_TO_MARK(childblock);
+                    ATB_HEAD_TO_MARK(ptr_area, childblock);
                     if (sp < MICROPY_ALLOC_GC_STACK_SIZE) {
-                        MP_STATE_MEM(gc_stack)[sp++] = childblock;
+                        MP_STATE_MEM(gc_stack)[sp++] = ptr;
                     } else {
-                        MP_STATE_MEM(gc_stack_overflow) = 1;
+                        gc_stack_overflowed(ptr_area, childblock);
                     }
                 }
             }
         }
 
         // Are there any blocks on the stack?
-        if (sp == 0) {
-            break; // No, stack is empty, we're done.
+        void *ptr;
+        if (sp > 0) {
+            // pop the next block off the stack
+            ptr = MP_STATE_MEM(gc_stack)[--sp];
+        } else {
+            // then take the ones spilled from it
+            ptr = gc_spill_pop();
+            if (ptr == NULL) {
+                break; // No, stack is empty, we're done.
+            }
         }
-
-        // pop the next block off the stack
-        block = MP_STATE_MEM(gc_stack)[--sp];
+        area = HEAP_PTR_AREA(ptr);
+        block = BLOCK_FROM_PTR(area, ptr);
     }
 }
 
 STATIC void gc_deal_with_stack_overflow(void) {
+    // heads left spilled by an incremental cycle
+    void *ptr = gc_spill_pop();
+    if (ptr != NULL) {
+        mp_state_mem_area_t *area = HEAP_PTR_AREA(ptr);
+        gc_mark_subtree(area, BLOCK_FROM_PTR(area, ptr));
+    }
+
     while (MP_STATE_MEM(gc_stack_overflow)) {
         MP_STATE_MEM(gc_stack_overflow) = 0;
 
-        // scan entire memory looking for blocks which have been marked but not their children
-        for (size_t block = 0; block < MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB; block++) {
-            // trace (again) if mark bit set
-            if (ATB_GET_KIND(block) == AT_MARK) {
-                gc_mark_subtree(block);
+        // scan each area's overflow window for blocks which have been marked
+        // but not their children; only blocks dropped behind the rescan need
+        // another pass
+        for (mp_state_mem_area_t *area = MAIN_AREA; area != NULL; area = NEXT_AREA(area)) {
+            gc_rescan_take_window(area);
+            while (MP_STATE_MEM(gc_rescan_block) < MP_STATE_MEM(gc_rescan_end)) {
+                size_t block = MP_STATE_MEM(gc_rescan_block)++;
+                // trace (again) if mark bit set
+                if (ATB_GET_KIND(area, block) == AT_MARK) {
+                    gc_mark_subtree(area, block);
+                }
             }
         }
+        MP_STATE_MEM(gc_rescan_area) = NULL;
     }
 }
 
-STATIC void gc_sweep(void) {
-    #if MICROPY_PY_GC_COLLECT_RETVAL
-    MP_STATE_MEM(gc_collected) = 0;
+// Record a run of free blocks left by the sweep. Runs are seen in increasing
+// order so the first one long enough for a size bucket is where gc_alloc
+// should start looking for that size.
+STATIC void gc_sweep_free_run(mp_state_mem_area_t *area, size_t start_block, size_t n_free) {
+    size_t atb = start_block / BLOCKS_PER_ATB;
+    #if MICROPY_GC_SPLIT_HEAP
+    if (area != MAIN_AREA) {
+        if (atb < area->gc_first_free_atb_index) {
+            area->gc_first_free_atb_index = atb;
+        }
+        return;
+    }
+    #else
+    (void)area;
     #endif
+    size_t n_buckets = MIN(n_free, MICROPY_ATB_INDICES);
+    for (size_t bucket = 0; bucket < n_buckets; bucket++) {
+        if (atb < MP_STATE_MEM(gc_first_free_atb_index)[bucket]) {
+            MP_STATE_MEM(gc_first_free_atb_index)[bucket] = atb;
+        }
+    }
+}
+
+// Sweep the blocks of an area from *block_io up to end, carrying on past end
+// to the last tail of a dead object so that a sweep never stops inside one.
+// *n_free_io is the length of the run of free blocks ending just before the
+// first block, and is updated to the run ending at the final *block_io.
+// Returns the number of free blocks in the runs that were completed.
+STATIC size_t PLACE_IN_ITCM_HOT(gc_sweep_blocks)(mp_state_mem_area_t *area, size_t *block_io, size_t end, size_t *n_free_io) {
+    size_t n_free = *n_free_io;
+    size_t total_free = 0;
     // free unmarked heads and their tails
     int free_tail = 0;
-    for (size_t block = 0; block < MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB; block++) {
-        switch (ATB_GET_KIND(block)) {
+    size_t total_blocks = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+    size_t block = *block_io;
+    for (; block < total_blocks && (block < end || (free_tail && ATB_GET_KIND(area, block) == AT_TAIL)); block++) {
+        switch (ATB_GET_KIND(area, block)) {
+            case AT_FREE:
+                n_free++;
+                break;
+
             case AT_HEAD:
 #if MICROPY_ENABLE_FINALISER
-                if (FTB_GET(block)) {
-                    mp_obj_base_t *obj = (mp_obj_base_t*)PTR_FROM_BLOCK(block);
+                if (FTB_GET(area, block)) {
+                    mp_obj_base_t *obj = (mp_obj_base_t*)PTR_FROM_BLOCK(area, block);
                     if (obj->type != NULL) {
                         // if the object has a type then see if it has a __del__ method
                         mp_obj_t dest[2];
@@ -304,50 +704,229 @@ STATIC void gc_sweep(void) {
                         }
                     }
                     // clear finaliser flag
-                    FTB_CLEAR(block);
+                    FTB_CLEAR(area, block);
                 }
 #endif
                 free_tail = 1;
-                ATB_ANY_TO_FREE(block);
+                ATB_ANY_TO_FREE(area, block);
                 #if CLEAR_ON_SWEEP
-                memset((void*)PTR_FROM_BLOCK(block), 0, BYTES_PER_BLOCK);
+                memset((void*)PTR_FROM_BLOCK(area, block), 0, BYTES_PER_BLOCK);
                 #endif
-                DEBUG_printf("gc_sweep(%x)\n", PTR_FROM_BLOCK(block));
+                DEBUG_printf("gc_sweep(%x)\n", PTR_FROM_BLOCK(area, block));
 
                 #ifdef LOG_HEAP_ACTIVITY
                 gc_log_change(block, 0);
                 #endif
+                GC_TRACE(GC_TRACE_SWEEP, area, block, 0);
                 #if MICROPY_PY_GC_COLLECT_RETVAL
                 MP_STATE_MEM(gc_collected)++;
                 #endif
+                n_free++;
                 break;
 
             case AT_TAIL:
                 if (free_tail) {
-                    ATB_ANY_TO_FREE(block);
+                    ATB_ANY_TO_FREE(area, block);
                     #if CLEAR_ON_SWEEP
-                    memset((void*)PTR_FROM_BLOCK(block), 0, BYTES_PER_BLOCK);
+                    memset((void*)PTR_FROM_BLOCK(area, block), 0, BYTES_PER_BLOCK);
                     #endif
+                    n_free++;
                 }
                 break;
 
             case AT_MARK:
-                ATB_MARK_TO_HEAD(block);
+                ATB_MARK_TO_HEAD(area, block);
                 free_tail = 0;
+                if (n_free > 0) {
+                    gc_sweep_free_run(area, block - n_free, n_free);
+                    total_free += n_free;
+                    n_free = 0;
+                }
                 break;
         }
     }
+    *block_io = block;
+    *n_free_io = n_free;
+    return total_free;
+}
+
+// Returns the number of free blocks in the area after sweeping it.
+STATIC size_t gc_sweep_area(mp_state_mem_area_t *area) {
+    size_t total_blocks = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+    size_t block = 0;
+    size_t n_free = 0;
+    size_t total_free = gc_sweep_blocks(area, &block, total_blocks, &n_free);
+    if (n_free > 0) {
+        gc_sweep_free_run(area, total_blocks - n_free, n_free);
+        total_free += n_free;
+    }
+    return total_free;
+}
+
+// Long lived objects that have died (for example the globals of a module
+// that was removed from sys.modules) leave the bottom of the long lived
+// area empty. Move the boundary up to the lowest block still in use so
+// that the space goes back to short lived allocations instead of
+// triggering early collections when they reach the old boundary.
+STATIC void gc_sweep_long_lived_boundary(void) {
+    size_t total_blocks = MAIN_AREA->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+    size_t block = BLOCK_FROM_PTR(MAIN_AREA, MP_STATE_MEM(gc_lowest_long_lived_ptr));
+    while (block < total_blocks && ATB_GET_KIND(MAIN_AREA, block) == AT_FREE) {
+        block++;
+    }
+    MP_STATE_MEM(gc_lowest_long_lived_ptr) = (void*) PTR_FROM_BLOCK(MAIN_AREA, block);
+}
+
+// Returns the number of free blocks in the heap after sweeping it.
+STATIC size_t gc_sweep(void) {
+    #if MICROPY_PY_GC_COLLECT_RETVAL
+    MP_STATE_MEM(gc_collected) = 0;
+    #endif
+    // Rebuild the per-size first free indices as we go. A bucket with no run
+    // long enough is left past the end of the table.
+    for (size_t i = 0; i < MICROPY_ATB_INDICES; i++) {
+        MP_STATE_MEM(gc_first_free_atb_index)[i] = MAIN_AREA->gc_alloc_table_byte_len;
+    }
+    size_t total_free = 0;
+    for (mp_state_mem_area_t *area = MAIN_AREA; area != NULL; area = NEXT_AREA(area)) {
+        #if MICROPY_GC_SPLIT_HEAP
+        area->gc_first_free_atb_index = area->gc_alloc_table_byte_len;
+        #endif
+        total_free += gc_sweep_area(area);
+    }
+    gc_sweep_long_lived_boundary();
+    return total_free;
+}
+
+#if MICROPY_GC_LAZY_SWEEP
+// Start a sweep that later allocations carry out bit by bit. The extra areas
+// are still swept at once. The first free indices aren't reset, as they stay
+// valid lower bounds while sweeping only adds free blocks. Returns the number
+// of free blocks in the extra areas.
+STATIC size_t gc_sweep_lazy_start(void) {
+    #if MICROPY_PY_GC_COLLECT_RETVAL
+    MP_STATE_MEM(gc_collected) = 0;
+    #endif
+    size_t total_free = 0;
+    #if MICROPY_GC_SPLIT_HEAP
+    for (mp_state_mem_area_t *area = MAIN_AREA->next; area != NULL; area = area->next) {
+        area->gc_first_free_atb_index = area->gc_alloc_table_byte_len;
+        total_free += gc_sweep_area(area);
+    }
+    #endif
+    MP_STATE_MEM(gc_sweep_pending) = true;
+    MP_STATE_MEM(gc_sweep_block) = 0;
+    MP_STATE_MEM(gc_sweep_n_free) = 0;
+    MP_STATE_MEM(gc_sweep_total_free) = total_free;
+    return total_free;
+}
+
+STATIC void gc_sweep_lazy_step(size_t n_blocks);
+#endif
+
+#if MICROPY_GC_IDLE_COLLECT
+// Work out how much may be allocated before the next idle collection. A
+// collection forced by a failed allocation means idle ones came too late, so
+// the budget halves; an idle collection lets it double again, up to half of
+// the free heap. The budget is set once the sweep has counted the free heap.
+STATIC void gc_idle_collected(void) {
+    if (MP_STATE_MEM(gc_idle_missed)) {
+        if (MP_STATE_MEM(gc_idle_shift) < 8) {
+            MP_STATE_MEM(gc_idle_shift)++;
+        }
+    } else if (MP_STATE_MEM(gc_idle_alloc_amount) >= MP_STATE_MEM(gc_idle_budget)) {
+        if (MP_STATE_MEM(gc_idle_shift) > 0) {
+            MP_STATE_MEM(gc_idle_shift)--;
+        }
+    }
+    MP_STATE_MEM(gc_idle_missed) = false;
+    MP_STATE_MEM(gc_idle_alloc_amount) = 0;
+}
+
+STATIC void gc_idle_set_budget(size_t free_blocks) {
+    MP_STATE_MEM(gc_idle_budget) = MAX(free_blocks >> (1 + MP_STATE_MEM(gc_idle_shift)),
+        (size_t)MICROPY_GC_IDLE_COLLECT_MIN_ALLOC);
+}
+
+bool gc_collect_idle_due(void) {
+    return MP_STATE_MEM(gc_auto_collect_enabled) &&
+        MP_STATE_MEM(gc_lock_depth) == 0 &&
+        MP_STATE_MEM(gc_idle_alloc_amount) >= MP_STATE_MEM(gc_idle_budget);
+}
+
+bool gc_collect_idle(void) {
+    #if MICROPY_GC_LAZY_SWEEP
+    // Idle time is also a good time to finish a sweep.
+    GC_ENTER();
+    if (MP_STATE_MEM(gc_sweep_pending) && MP_STATE_MEM(gc_lock_depth) == 0) {
+        MP_STATE_MEM(gc_lock_depth)++;
+        gc_sweep_lazy_step(SIZE_MAX);
+        MP_STATE_MEM(gc_lock_depth)--;
+    }
+    GC_EXIT();
+    #endif
+    if (!gc_collect_idle_due()) {
+        return false;
+    }
+    gc_collect();
+    return true;
 }
+#endif
+
+#if MICROPY_GC_LAZY_SWEEP
+// Sweep about n_blocks more of the main area, finishing the sweep if that
+// reaches the end. The caller holds the GC lock, as a collection would, so
+// that finalisers run while sweeping can't allocate.
+STATIC void gc_sweep_lazy_step(size_t n_blocks) {
+    mp_state_mem_area_t *area = MAIN_AREA;
+    size_t total_blocks = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+    size_t end = MP_STATE_MEM(gc_sweep_block) + MIN(n_blocks, total_blocks - MP_STATE_MEM(gc_sweep_block));
+    MP_STATE_MEM(gc_sweep_total_free) += gc_sweep_blocks(area, &MP_STATE_MEM(gc_sweep_block), end, &MP_STATE_MEM(gc_sweep_n_free));
+    if (MP_STATE_MEM(gc_sweep_block) < total_blocks) {
+        return;
+    }
+    size_t n_free = MP_STATE_MEM(gc_sweep_n_free);
+    if (n_free > 0) {
+        gc_sweep_free_run(area, total_blocks - n_free, n_free);
+        MP_STATE_MEM(gc_sweep_total_free) += n_free;
+    }
+    MP_STATE_MEM(gc_sweep_pending) = false;
+    gc_sweep_long_lived_boundary();
+    #if MICROPY_GC_IDLE_COLLECT
+    gc_idle_set_budget(MP_STATE_MEM(gc_sweep_total_free));
+    #endif
+}
+#endif
+
+#if MICROPY_GC_INCREMENTAL
+// Push a marked block whose children still need to be scanned by a later step.
+STATIC void gc_incremental_push(void *ptr) {
+    if (MP_STATE_MEM(gc_incremental_sp) < MICROPY_ALLOC_GC_STACK_SIZE) {
+        MP_STATE_MEM(gc_stack)[MP_STATE_MEM(gc_incremental_sp)++] = ptr;
+    } else {
+        mp_state_mem_area_t *area = HEAP_PTR_AREA(ptr);
+        gc_stack_overflowed(area, BLOCK_FROM_PTR(area, ptr));
+    }
+}
+#endif
 
 // Mark can handle NULL pointers because it verifies the pointer is within the heap bounds.
-STATIC void gc_mark(void* ptr) {
-    if (VERIFY_PTR(ptr)) {
-        size_t block = BLOCK_FROM_PTR(ptr);
-        if (ATB_GET_KIND(block) == AT_HEAD) {
+STATIC void PLACE_IN_ITCM_HOT(gc_mark)(void* ptr) {
+    mp_state_mem_area_t *area = PTR_AREA(ptr);
+    if (area != NULL) {
+        size_t block = BLOCK_FROM_PTR(area, ptr);
+        if (ATB_GET_KIND(area, block) == AT_HEAD) {
             // An unmarked head: mark it, and mark all its children
             TRACE_MARK(block, ptr);
-            ATB_HEAD_TO_MARK(block);
-            gc_mark_subtree(block);
+            ATB_HEAD_TO_MARK(area, block);
+            #if MICROPY_GC_INCREMENTAL
+            if (MP_STATE_MEM(gc_incremental_state) == GC_INCREMENTAL_ROOTS) {
+                // Leave the children for gc_collect_incremental_step.
+                gc_incremental_push(ptr);
+                return;
+            }
+            #endif
+            gc_mark_subtree(area, block);
         }
     }
 }
@@ -355,10 +934,53 @@ STATIC void gc_mark(void* ptr) {
 void gc_collect_start(void) {
     GC_ENTER();
     MP_STATE_MEM(gc_lock_depth)++;
+    #if MICROPY_GC_LAZY_SWEEP
+    // The marks left by the last collection must all be gone before marking.
+    if (MP_STATE_MEM(gc_sweep_pending)) {
+        gc_sweep_lazy_step(SIZE_MAX);
+    }
+    #endif
+    #if MICROPY_OPT_BOUND_METH_CACHE
+    memset(MP_STATE_VM(bound_meth_cache), 0, sizeof(MP_STATE_VM(bound_meth_cache)));
+    #endif
+    #if MICROPY_GC_TRACE
+    // Describe the heap with every collection so a trace can be picked up
+    // part way through.
+    for (mp_state_mem_area_t *area = MAIN_AREA; area != NULL; area = NEXT_AREA(area)) {
+        GC_TRACE(GC_TRACE_AREA, area, 0, area->gc_alloc_table_byte_len * BLOCKS_PER_ATB);
+    }
+    gc_trace_event(GC_TRACE_COLLECT_START, NULL, 0);
+    #endif
     #if MICROPY_GC_ALLOC_THRESHOLD
     MP_STATE_MEM(gc_alloc_amount) = 0;
     #endif
-    MP_STATE_MEM(gc_stack_overflow) = 0;
+    #if MICROPY_GC_INCREMENTAL
+    if (MP_STATE_MEM(gc_incremental_state) == GC_INCREMENTAL_MARK) {
+        // Finish the incremental cycle as a regular collection. Everything
+        // marked so far is kept and the roots are traced again to pick up
+        // anything that changed since the cycle started. Blocks that were
+        // still waiting to be scanned are spilled.
+        MP_STATE_MEM(gc_incremental_state) = GC_INCREMENTAL_IDLE;
+        for (size_t i = 0; i < MP_STATE_MEM(gc_incremental_sp); i++) {
+            void *ptr = MP_STATE_MEM(gc_stack)[i];
+            if (!gc_spill_push(ptr)) {
+                mp_state_mem_area_t *area = HEAP_PTR_AREA(ptr);
+                size_t block = BLOCK_FROM_PTR(area, ptr);
+                gc_overflow_window_add(area, block, block + 1);
+            }
+        }
+        MP_STATE_MEM(gc_incremental_sp) = 0;
+        mp_state_mem_area_t *area = MP_STATE_MEM(gc_rescan_area);
+        if (area != NULL) {
+            gc_overflow_window_add(area, MP_STATE_MEM(gc_rescan_block), MP_STATE_MEM(gc_rescan_end));
+            MP_STATE_MEM(gc_rescan_area) = NULL;
+        }
+    } else
+    #endif
+    {
+        MP_STATE_MEM(gc_stack_overflow) = 0;
+        gc_spill_reset();
+    }
 
     // Trace root pointers.  This relies on the root pointers being organised
     // correctly in the mp_state_ctx structure.  We scan nlr_top, dict_locals,
@@ -381,43 +1003,302 @@ void gc_collect_ptr(void *ptr) {
     gc_mark(ptr);
 }
 
-void gc_collect_root(void **ptrs, size_t len) {
+void PLACE_IN_ITCM_HOT(gc_collect_root)(void **ptrs, size_t len) {
     for (size_t i = 0; i < len; i++) {
         void *ptr = ptrs[i];
         gc_mark(ptr);
     }
 }
 
+#if MICROPY_GC_DEFERRED_FINALISER
+STATIC mp_obj_t gc_finaliser_run(mp_obj_t arg);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(gc_finaliser_run_obj, gc_finaliser_run);
+
+// Run the finalisers that collections have queued, most recently queued
+// first. The objects are no longer referenced afterwards, so a later
+// collection frees them without finalising them again.
+STATIC mp_obj_t gc_finaliser_run(mp_obj_t arg) {
+    (void)arg;
+    while (MP_STATE_MEM(gc_finaliser_len) > 0) {
+        size_t i = --MP_STATE_MEM(gc_finaliser_len);
+        mp_obj_t obj = MP_STATE_VM(gc_finaliser_queue)[i];
+        MP_STATE_VM(gc_finaliser_queue)[i] = MP_OBJ_NULL;
+        mp_obj_t dest[2];
+        mp_load_method_maybe(obj, MP_QSTR___del__, dest);
+        if (dest[0] != MP_OBJ_NULL) {
+            mp_call_function_1_protected(dest[0], dest[1]);
+        }
+    }
+    return mp_const_none;
+}
+
+void gc_run_finalisers(void) {
+    mp_sched_lock();
+    gc_finaliser_run(mp_const_none);
+    mp_sched_unlock();
+}
+
+// Queue dead objects that have a finaliser, while there is room, and mark
+// them and everything they reference so that the sweep keeps it all for the
+// finaliser to use. An object reachable from another queued one stays marked
+// and is only finalised after that one is gone. The rest are finalised by the
+// sweep as usual.
+STATIC void gc_finaliser_queue_dead(void) {
+    size_t queued = MP_STATE_MEM(gc_finaliser_len);
+    for (mp_state_mem_area_t *area = MAIN_AREA; area != NULL; area = NEXT_AREA(area)) {
+        size_t total_blocks = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+        for (size_t block = 0; block < total_blocks && queued < MICROPY_GC_DEFERRED_FINALISER_DEPTH; block++) {
+            if (area->gc_finaliser_table_start[block / BLOCKS_PER_FTB] == 0) {
+                // Skip the rest of a byte without finalisers.
+                block |= BLOCKS_PER_FTB - 1;
+                continue;
+            }
+            if (!FTB_GET(area, block) || ATB_GET_KIND(area, block) != AT_HEAD) {
+                continue;
+            }
+            mp_obj_base_t *obj = (mp_obj_base_t*)PTR_FROM_BLOCK(area, block);
+            if (obj->type == NULL) {
+                continue;
+            }
+            FTB_CLEAR(area, block);
+            MP_STATE_VM(gc_finaliser_queue)[queued++] = MP_OBJ_FROM_PTR(obj);
+            ATB_HEAD_TO_MARK(area, block);
+            gc_mark_subtree(area, block);
+        }
+    }
+    if (queued > MP_STATE_MEM(gc_finaliser_len)) {
+        MP_STATE_MEM(gc_finaliser_len) = queued;
+        gc_deal_with_stack_overflow();
+    }
+    if (queued > 0) {
+        // Retried by the next collection if the scheduler is full.
+        mp_sched_schedule_ex(MP_OBJ_FROM_PTR(&gc_finaliser_run_obj), mp_const_none, MP_SCHED_FLAG_COALESCE);
+    }
+}
+#endif
+
 void gc_collect_end(void) {
+    #if MICROPY_GC_INCREMENTAL
+    if (MP_STATE_MEM(gc_incremental_state) == GC_INCREMENTAL_ROOTS) {
+        // Roots are pushed; the mark phase continues in gc_collect_incremental_step.
+        MP_STATE_MEM(gc_incremental_state) = GC_INCREMENTAL_MARK;
+        #if MICROPY_GC_TRACE
+        gc_trace_event(GC_TRACE_COLLECT_END, NULL, 0);
+        #endif
+        MP_STATE_MEM(gc_lock_depth)--;
+        GC_EXIT();
+        return;
+    }
+    MP_STATE_MEM(gc_incremental_alloc_amount) = 0;
+    #endif
     gc_deal_with_stack_overflow();
-    gc_sweep();
-    for (size_t i = 0; i < MICROPY_ATB_INDICES; i++) {
-        MP_STATE_MEM(gc_first_free_atb_index)[i] = 0;
+    #if MICROPY_GC_DEFERRED_FINALISER
+    if (!MP_STATE_MEM(gc_finalise_now)) {
+        gc_finaliser_queue_dead();
+    }
+    #endif
+    gc_spill_release();
+    #if MICROPY_GC_LAZY_SWEEP
+    if (MP_STATE_MEM(gc_sweep_lazily)) {
+        gc_sweep_lazy_start();
+        #if MICROPY_GC_IDLE_COLLECT
+        gc_idle_collected();
+        #endif
+    } else
+    #endif
+    {
+        // gc_sweep also resets the first free ATB indices.
+        size_t free_blocks = gc_sweep();
+        #if MICROPY_GC_IDLE_COLLECT
+        gc_idle_collected();
+        gc_idle_set_budget(free_blocks);
+        #else
+        (void)free_blocks;
+        #endif
     }
-    MP_STATE_MEM(gc_last_free_atb_index) = MP_STATE_MEM(gc_alloc_table_byte_len) - 1;
+    #if MICROPY_GC_DEFERRED_FINALISER
+    MP_STATE_MEM(gc_finalise_now) = false;
+    #endif
+    MP_STATE_MEM(gc_last_free_atb_index) = MAIN_AREA->gc_alloc_table_byte_len - 1;
+    #if MICROPY_GC_TRACE
+    gc_trace_event(GC_TRACE_COLLECT_END, NULL, 0);
+    #endif
     MP_STATE_MEM(gc_lock_depth)--;
     GC_EXIT();
 }
 
-void gc_sweep_all(void) {
+#if MICROPY_GC_INCREMENTAL
+bool gc_collect_incremental_wanted(void) {
+    #if MICROPY_GC_IDLE_COLLECT
+    return gc_collect_idle_due();
+    #else
+    return MP_STATE_MEM(gc_auto_collect_enabled) &&
+        MP_STATE_MEM(gc_lock_depth) == 0 &&
+        MP_STATE_MEM(gc_incremental_alloc_amount) >= MICROPY_GC_INCREMENTAL_MIN_ALLOC;
+    #endif
+}
+
+bool gc_collect_incremental_in_progress(void) {
+    return MP_STATE_MEM(gc_incremental_state) != GC_INCREMENTAL_IDLE;
+}
+
+void gc_collect_incremental_start(void) {
+    if (MP_STATE_MEM(gc_incremental_state) != GC_INCREMENTAL_IDLE ||
+        MP_STATE_MEM(gc_lock_depth) > 0) {
+        return;
+    }
+    MP_STATE_MEM(gc_incremental_state) = GC_INCREMENTAL_ROOTS;
+    MP_STATE_MEM(gc_incremental_sp) = 0;
+    // The port's gc_collect() provides the roots. While in the ROOTS state
+    // they are only marked and pushed, and gc_collect_end() returns without
+    // sweeping.
+    gc_collect();
+}
+
+bool gc_collect_incremental_step(size_t max_blocks) {
+    GC_ENTER();
+    if (MP_STATE_MEM(gc_incremental_state) != GC_INCREMENTAL_MARK) {
+        GC_EXIT();
+        return true;
+    }
+    while (max_blocks > 0) {
+        if (MP_STATE_MEM(gc_incremental_sp) == 0) {
+            void *ptr = gc_spill_pop();
+            if (ptr != NULL) {
+                MP_STATE_MEM(gc_stack)[MP_STATE_MEM(gc_incremental_sp)++] = ptr;
+                continue;
+            }
+            mp_state_mem_area_t *area = MP_STATE_MEM(gc_rescan_area);
+            if (area == NULL) {
+                if (!MP_STATE_MEM(gc_stack_overflow)) {
+                    // Nothing left to scan.
+                    GC_EXIT();
+                    return true;
+                }
+                // Some marked blocks were dropped from the stack. Walk the
+                // overflow windows and push their marked blocks again.
+                MP_STATE_MEM(gc_stack_overflow) = 0;
+                area = MAIN_AREA;
+                gc_rescan_take_window(area);
+            }
+            size_t block = MP_STATE_MEM(gc_rescan_block);
+            size_t end = MP_STATE_MEM(gc_rescan_end);
+            for (; block < end && max_blocks > 0 &&
+                MP_STATE_MEM(gc_incremental_sp) < MICROPY_ALLOC_GC_STACK_SIZE; block++) {
+                if (ATB_GET_KIND(area, block) == AT_MARK) {
+                    gc_incremental_push((void*)PTR_FROM_BLOCK(area, block));
+                    max_blocks--;
+                }
+            }
+            MP_STATE_MEM(gc_rescan_block) = block;
+            if (block >= end) {
+                if (NEXT_AREA(area) != NULL) {
+                    gc_rescan_take_window(NEXT_AREA(area));
+                } else {
+                    MP_STATE_MEM(gc_rescan_area) = NULL;
+                }
+            }
+            continue;
+        }
+
+        void *block_ptr = MP_STATE_MEM(gc_stack)[--MP_STATE_MEM(gc_incremental_sp)];
+        mp_state_mem_area_t *area = HEAP_PTR_AREA(block_ptr);
+        size_t block = BLOCK_FROM_PTR(area, block_ptr);
+        size_t n_blocks = 0;
+        do {
+            n_blocks += 1;
+        } while (ATB_GET_KIND(area, block + n_blocks) == AT_TAIL);
+
+        void **ptrs = (void**)block_ptr;
+        for (size_t i = n_blocks * BYTES_PER_BLOCK / sizeof(void*); i > 0; i--, ptrs++) {
+            void *ptr = *ptrs;
+            mp_state_mem_area_t *ptr_area = PTR_AREA(ptr);
+            if (ptr_area != NULL) {
+                size_t childblock = BLOCK_FROM_PTR(ptr_area, ptr);
+                if (ATB_GET_KIND(ptr_area, childblock) == AT_HEAD) {
+                    TRACE_MARK(childblock, ptr);
+                    ATB_HEAD_TO_MARK(ptr_area, childblock);
+                    gc_incremental_push(ptr);
+                }
+            }
+        }
+        max_blocks = n_blocks >= max_blocks ? 0 : max_blocks - n_blocks;
+    }
+    GC_EXIT();
+    return false;
+}
+
+void gc_collect_incremental_abort(void) {
+    GC_ENTER();
+    if (MP_STATE_MEM(gc_incremental_state) == GC_INCREMENTAL_IDLE) {
+        GC_EXIT();
+        return;
+    }
+    // Turn every MARK (0b11) back into HEAD (0b01) four blocks at a time.
+    for (mp_state_mem_area_t *area = MAIN_AREA; area != NULL; area = NEXT_AREA(area)) {
+        byte *atb = area->gc_alloc_table_start;
+        for (size_t i = 0; i < area->gc_alloc_table_byte_len; i++) {
+            atb[i] &= ~((atb[i] & 0x55) << 1);
+        }
+    }
+    for (mp_state_mem_area_t *area = MAIN_AREA; area != NULL; area = NEXT_AREA(area)) {
+        area->gc_overflow_lo = SIZE_MAX;
+        area->gc_overflow_hi = 0;
+    }
+    gc_spill_release();
+    MP_STATE_MEM(gc_incremental_state) = GC_INCREMENTAL_IDLE;
+    MP_STATE_MEM(gc_incremental_sp) = 0;
+    MP_STATE_MEM(gc_rescan_area) = NULL;
+    MP_STATE_MEM(gc_stack_overflow) = 0;
+    GC_EXIT();
+}
+#endif
+
+void gc_collect_start_without_roots(void) {
+    #if MICROPY_GC_INCREMENTAL
+    // Drop any marks so that everything not marked from now on is swept.
+    gc_collect_incremental_abort();
+    #endif
+    #if MICROPY_GC_DEFERRED_FINALISER
+    // Queued objects aren't roots here, so finalise them now, and have this
+    // sweep run finalisers straight away.
+    gc_run_finalisers();
+    MP_STATE_MEM(gc_finalise_now) = true;
+    #endif
     GC_ENTER();
     MP_STATE_MEM(gc_lock_depth)++;
+    #if MICROPY_GC_LAZY_SWEEP
+    if (MP_STATE_MEM(gc_sweep_pending)) {
+        gc_sweep_lazy_step(SIZE_MAX);
+    }
+    #endif
     MP_STATE_MEM(gc_stack_overflow) = 0;
+    #if MICROPY_OPT_BOUND_METH_CACHE
+    memset(MP_STATE_VM(bound_meth_cache), 0, sizeof(MP_STATE_VM(bound_meth_cache)));
+    #endif
+}
+
+void gc_sweep_all(void) {
+    gc_collect_start_without_roots();
     gc_collect_end();
 }
 
-void gc_info(gc_info_t *info) {
-    GC_ENTER();
-    info->total = MP_STATE_MEM(gc_pool_end) - MP_STATE_MEM(gc_pool_start);
+STATIC void gc_info_clear(gc_info_t *info) {
+    info->total = 0;
     info->used = 0;
     info->free = 0;
     info->max_free = 0;
     info->num_1block = 0;
     info->num_2block = 0;
     info->max_block = 0;
+}
+
+// Add the blocks of one area to info, with used and free still in blocks.
+STATIC void gc_info_add_area(mp_state_mem_area_t *area, gc_info_t *info) {
+    info->total += area->gc_pool_end - area->gc_pool_start;
     bool finish = false;
     for (size_t block = 0, len = 0, len_free = 0; !finish;) {
-        size_t kind = ATB_GET_KIND(block);
+        size_t kind = ATB_GET_KIND(area, block);
         switch (kind) {
             case AT_FREE:
                 info->free += 1;
@@ -426,6 +1307,7 @@ void gc_info(gc_info_t *info) {
                 break;
 
             case AT_HEAD:
+            case AT_MARK: // only seen during an incremental collection
                 info->used += 1;
                 len = 1;
                 break;
@@ -434,20 +1316,16 @@ void gc_info(gc_info_t *info) {
                 info->used += 1;
                 len += 1;
                 break;
-
-            case AT_MARK:
-                // shouldn't happen
-                break;
         }
 
         block++;
-        finish = (block == MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB);
+        finish = (block == area->gc_alloc_table_byte_len * BLOCKS_PER_ATB);
         // Get next block type if possible
         if (!finish) {
-            kind = ATB_GET_KIND(block);
+            kind = ATB_GET_KIND(area, block);
         }
 
-        if (finish || kind == AT_FREE || kind == AT_HEAD) {
+        if (finish || kind == AT_FREE || kind == AT_HEAD || kind == AT_MARK) {
             if (len == 1) {
                 info->num_1block += 1;
             } else if (len == 2) {
@@ -456,7 +1334,7 @@ void gc_info(gc_info_t *info) {
             if (len > info->max_block) {
                 info->max_block = len;
             }
-            if (finish || kind == AT_HEAD) {
+            if (finish || kind == AT_HEAD || kind == AT_MARK) {
                 if (len_free > info->max_free) {
                     info->max_free = len_free;
                 }
@@ -464,19 +1342,159 @@ void gc_info(gc_info_t *info) {
             }
         }
     }
+}
 
+void gc_info(gc_info_t *info) {
+    GC_ENTER();
+    gc_info_clear(info);
+    for (mp_state_mem_area_t *area = MAIN_AREA; area != NULL; area = NEXT_AREA(area)) {
+        gc_info_add_area(area, info);
+    }
+    info->used *= BYTES_PER_BLOCK;
+    info->free *= BYTES_PER_BLOCK;
+    GC_EXIT();
+}
+
+bool gc_area_info(size_t index, gc_info_t *info) {
+    GC_ENTER();
+    mp_state_mem_area_t *area = MAIN_AREA;
+    for (; area != NULL && index > 0; index--) {
+        area = NEXT_AREA(area);
+    }
+    if (area == NULL) {
+        GC_EXIT();
+        return false;
+    }
+    gc_info_clear(info);
+    gc_info_add_area(area, info);
     info->used *= BYTES_PER_BLOCK;
     info->free *= BYTES_PER_BLOCK;
     GC_EXIT();
+    return true;
 }
 
 bool gc_alloc_possible(void) {
-    return MP_STATE_MEM(gc_pool_start) != 0;
+    return MAIN_AREA->gc_pool_start != 0;
+}
+
+// Look for a run of n_blocks free blocks in the main area. Short lived
+// allocations are searched for from the bottom up and long lived ones from the
+// top down. Until there has been a collection the search stops where the other
+// section starts, so that a collect gets the chance to find space closer by.
+STATIC bool gc_alloc_find_main(size_t n_blocks, bool long_lived, bool collected, size_t *start_block) {
+    mp_state_mem_area_t *area = MAIN_AREA;
+    size_t found_block = 0xffffffff;
+    size_t n_free = 0;
+    bool keep_looking = true;
+    size_t crossover_block = BLOCK_FROM_PTR(area, MP_STATE_MEM(gc_lowest_long_lived_ptr));
+    int8_t direction = 1;
+    size_t bucket = MIN(n_blocks, MICROPY_ATB_INDICES) - 1;
+    size_t first_free = MP_STATE_MEM(gc_first_free_atb_index)[bucket];
+    size_t start = first_free;
+    if (long_lived) {
+        direction = -1;
+        start = MP_STATE_MEM(gc_last_free_atb_index);
+    }
+    // look for a run of n_blocks available blocks
+    for (size_t i = start; keep_looking && first_free <= i && i <= MP_STATE_MEM(gc_last_free_atb_index); i += direction) {
+        byte a = area->gc_alloc_table_start[i];
+        // Four ATB states are packed into a single byte.
+        int j = 0;
+        if (direction == -1) {
+            j = 3;
+        }
+        for (; keep_looking && 0 <= j && j <= 3; j += direction) {
+            if ((a & (0x3 << (j * 2))) == 0) {
+                if (++n_free >= n_blocks) {
+                    found_block = i * BLOCKS_PER_ATB + j;
+                    keep_looking = false;
+                }
+            } else {
+                if (!collected) {
+                    size_t block = i * BLOCKS_PER_ATB + j;
+                    if ((direction == 1 && block >= crossover_block) ||
+                            (direction == -1 && block < crossover_block)) {
+                        keep_looking = false;
+                    }
+                }
+                n_free = 0;
+            }
+        }
+    }
+    if (n_free < n_blocks) {
+        return false;
+    }
+    assert(found_block != 0xffffffff);
+
+    // Found free space ending at found_block inclusive.
+    // Also, set last free ATB index to block after last block we found, for start of
+    // next scan. Also, whenever we free or shrink a block we must check if this index needs
+    // adjusting (see gc_realloc and gc_free).
+    if (!long_lived) {
+        *start_block = found_block - n_free + 1;
+        if (n_blocks < MICROPY_ATB_INDICES) {
+            size_t next_free_atb = (found_block + n_blocks) / BLOCKS_PER_ATB;
+            // Update all atb indices for larger blocks too.
+            for (size_t i = n_blocks - 1; i < MICROPY_ATB_INDICES; i++) {
+                MP_STATE_MEM(gc_first_free_atb_index)[i] = next_free_atb;
+            }
+        }
+    } else {
+        *start_block = found_block;
+        // Always update the bounds of the long lived area because we assume it is contiguous. (It
+        // can still be reset by a sweep.)
+        MP_STATE_MEM(gc_last_free_atb_index) = (found_block - 1) / BLOCKS_PER_ATB;
+    }
+    return true;
+}
+
+#if MICROPY_GC_SPLIT_HEAP
+// Move the first free hint of an extra area past the ATBs that are full.
+STATIC void gc_skip_full_atbs(mp_state_mem_area_t *area) {
+    while (area->gc_first_free_atb_index < area->gc_alloc_table_byte_len &&
+        !ATB_HAS_FREE(area->gc_alloc_table_start[area->gc_first_free_atb_index])) {
+        area->gc_first_free_atb_index++;
+    }
+}
+
+// Look for the first run of n_blocks free blocks in the areas added with
+// gc_add(). These only hold short lived data, at least as far as placement
+// goes, so there are no sections to keep apart.
+STATIC mp_state_mem_area_t *gc_alloc_find_extra(size_t n_blocks, size_t *start_block) {
+    for (mp_state_mem_area_t *area = MAIN_AREA->next; area != NULL; area = area->next) {
+        size_t total_blocks = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+        size_t n_free = 0;
+        for (size_t block = area->gc_first_free_atb_index * BLOCKS_PER_ATB; block < total_blocks; block++) {
+            if (ATB_GET_KIND(area, block) != AT_FREE) {
+                n_free = 0;
+                continue;
+            }
+            if (++n_free < n_blocks) {
+                continue;
+            }
+            *start_block = block - n_free + 1;
+            return area;
+        }
+    }
+    return NULL;
+}
+#endif
+
+// Collect because gc_alloc needs room. With a lazy sweep, the allocations
+// that follow do the sweeping.
+STATIC void gc_collect_for_alloc(void) {
+    #if MICROPY_GC_LAZY_SWEEP
+    MP_STATE_MEM(gc_sweep_lazily) = true;
+    gc_collect();
+    MP_STATE_MEM(gc_sweep_lazily) = false;
+    #else
+    gc_collect();
+    #endif
 }
 
 // We place long lived objects at the end of the heap rather than the start. This reduces
 // fragmentation by localizing the heap churn to one portion of memory (the start of the heap.)
-void *gc_alloc(size_t n_bytes, bool has_finaliser, bool long_lived) {
+void *PLACE_IN_ITCM_HOT(gc_alloc)(size_t n_bytes, bool has_finaliser, bool long_lived) {
     size_t n_blocks = ((n_bytes + BYTES_PER_BLOCK - 1) & (~(BYTES_PER_BLOCK - 1))) / BYTES_PER_BLOCK;
     DEBUG_printf("gc_alloc(" UINT_FMT " bytes -> " UINT_FMT " blocks)\n", n_bytes, n_blocks);
 
@@ -485,7 +1503,7 @@ void *gc_alloc(size_t n_bytes, bool has_finaliser, bool long_lived) {
         return NULL;
     }
 
-    if (MP_STATE_MEM(gc_pool_start) == 0) {
+    if (MAIN_AREA->gc_pool_start == 0) {
         reset_into_safe_mode(GC_ALLOC_OUTSIDE_VM);
     }
 
@@ -497,65 +1515,62 @@ void *gc_alloc(size_t n_bytes, bool has_finaliser, bool long_lived) {
         return NULL;
     }
 
-    size_t found_block = 0xffffffff;
-    size_t end_block;
+    mp_state_mem_area_t *area = MAIN_AREA;
     size_t start_block;
-    size_t n_free;
     bool collected = !MP_STATE_MEM(gc_auto_collect_enabled);
 
+    #if MICROPY_GC_LAZY_SWEEP
+    // Every allocation does a bit of a pending sweep, so that it finishes.
+    size_t sweep_blocks = MICROPY_GC_LAZY_SWEEP_BLOCKS;
+    if (MP_STATE_MEM(gc_sweep_pending)) {
+        MP_STATE_MEM(gc_lock_depth)++;
+        gc_sweep_lazy_step(sweep_blocks);
+        MP_STATE_MEM(gc_lock_depth)--;
+    }
+    #endif
+
     #if MICROPY_GC_ALLOC_THRESHOLD
     if (!collected && MP_STATE_MEM(gc_alloc_amount) >= MP_STATE_MEM(gc_alloc_threshold)) {
         GC_EXIT();
-        gc_collect();
+        gc_collect_for_alloc();
         collected = 1;
         GC_ENTER();
     }
     #endif
 
-    bool keep_looking = true;
-
-    // When we start searching on the other side of the crossover block we make sure to
-    // perform a collect. That way we'll get the closest free block in our section.
-    size_t crossover_block = BLOCK_FROM_PTR(MP_STATE_MEM(gc_lowest_long_lived_ptr));
-    while (keep_looking) {
-        int8_t direction = 1;
-        size_t bucket = MIN(n_blocks, MICROPY_ATB_INDICES) - 1;
-        size_t first_free = MP_STATE_MEM(gc_first_free_atb_index)[bucket];
-        size_t start = first_free;
-        if (long_lived) {
-            direction = -1;
-            start = MP_STATE_MEM(gc_last_free_atb_index);
+    #if MICROPY_GC_SPLIT_HEAP
+    // Large buffers go to the extra areas first. Other short lived allocations
+    // prefer the main area and only spill over once a collection didn't help.
+    // Long lived ones always stay in the main area.
+    bool prefer_extra = !long_lived && n_bytes >= MICROPY_GC_SPLIT_HEAP_LARGE_ALLOC;
+    #endif
+    for (;;) {
+        #if MICROPY_GC_SPLIT_HEAP
+        if (prefer_extra && (area = gc_alloc_find_extra(n_blocks, &start_block)) != NULL) {
+            break;
         }
-        n_free = 0;
-        // look for a run of n_blocks available blocks
-        for (size_t i = start; keep_looking && first_free <= i && i <= MP_STATE_MEM(gc_last_free_atb_index); i += direction) {
-            byte a = MP_STATE_MEM(gc_alloc_table_start)[i];
-            // Four ATB states are packed into a single byte.
-            int j = 0;
-            if (direction == -1) {
-                j = 3;
-            }
-            for (; keep_looking && 0 <= j && j <= 3; j += direction) {
-                if ((a & (0x3 << (j * 2))) == 0) {
-                    if (++n_free >= n_blocks) {
-                        found_block = i * BLOCKS_PER_ATB + j;
-                        keep_looking = false;
-                    }
-                } else {
-                    if (!collected) {
-                        size_t block = i * BLOCKS_PER_ATB + j;
-                        if ((direction == 1 && block >= crossover_block) ||
-                                (direction == -1 && block < crossover_block)) {
-                            keep_looking = false;
-                        }
-                    }
-                    n_free = 0;
-                }
-            }
+        area = MAIN_AREA;
+        #endif
+        if (gc_alloc_find_main(n_blocks, long_lived, collected, &start_block)) {
+            break;
         }
-        if (n_free >= n_blocks) {
+        #if MICROPY_GC_SPLIT_HEAP
+        if (!prefer_extra && !long_lived && collected && (area = gc_alloc_find_extra(n_blocks, &start_block)) != NULL) {
             break;
         }
+        area = MAIN_AREA;
+        #endif
+
+        #if MICROPY_GC_LAZY_SWEEP
+        if (MP_STATE_MEM(gc_sweep_pending)) {
+            // Sweep on, twice as far each time, until the allocation fits.
+            MP_STATE_MEM(gc_lock_depth)++;
+            gc_sweep_lazy_step(sweep_blocks);
+            MP_STATE_MEM(gc_lock_depth)--;
+            sweep_blocks *= 2;
+            continue;
+        }
+        #endif
 
         GC_EXIT();
         // nothing found!
@@ -563,52 +1578,51 @@ void *gc_alloc(size_t n_bytes, bool has_finaliser, bool long_lived) {
             return NULL;
         }
         DEBUG_printf("gc_alloc(" UINT_FMT "): no free mem, triggering GC\n", n_bytes);
-        gc_collect();
+        #if MICROPY_GC_IDLE_COLLECT
+        MP_STATE_MEM(gc_idle_missed) = true;
+        #endif
+        gc_collect_for_alloc();
         collected = true;
         // Try again since we've hopefully freed up space.
-        keep_looking = true;
         GC_ENTER();
     }
-    assert(found_block != 0xffffffff);
-
-    // Found free space ending at found_block inclusive.
-    // Also, set last free ATB index to block after last block we found, for start of
-    // next scan. Also, whenever we free or shrink a block we must check if this index needs
-    // adjusting (see gc_realloc and gc_free).
-    if (!long_lived) {
-        end_block = found_block;
-        start_block = found_block - n_free + 1;
-        if (n_blocks < MICROPY_ATB_INDICES) {
-            size_t next_free_atb = (found_block + n_blocks) / BLOCKS_PER_ATB;
-            // Update all atb indices for larger blocks too.
-            for (size_t i = n_blocks - 1; i < MICROPY_ATB_INDICES; i++) {
-                MP_STATE_MEM(gc_first_free_atb_index)[i] = next_free_atb;
-            }
-        }
-    } else {
-        start_block = found_block;
-        end_block = found_block + n_free - 1;
-        // Always update the bounds of the long lived area because we assume it is contiguous. (It
-        // can still be reset by a sweep.)
-        MP_STATE_MEM(gc_last_free_atb_index) = (found_block - 1) / BLOCKS_PER_ATB;
-    }
+    size_t end_block = start_block + n_blocks - 1;
 
     #ifdef LOG_HEAP_ACTIVITY
     gc_log_change(start_block, end_block - start_block + 1);
     #endif
+    GC_TRACE(GC_TRACE_ALLOC, area, start_block, n_blocks);
+
+    #if MICROPY_GC_ALLOC_PROFILE
+    if (MP_STATE_MEM(gc_profile_enabled)) {
+        gc_profile_record((end_block - start_block + 1) * BYTES_PER_BLOCK);
+    }
+    #endif
 
     // mark first block as used head
-    ATB_FREE_TO_HEAD(start_block);
+    ATB_FREE_TO_HEAD(area, start_block);
+    #if MICROPY_GC_LAZY_SWEEP
+    if (MP_STATE_MEM(gc_sweep_pending) && area == MAIN_AREA && start_block >= MP_STATE_MEM(gc_sweep_block)) {
+        // The sweep hasn't got here yet, so mark the block for it to keep.
+        ATB_HEAD_TO_MARK(area, start_block);
+    }
+    #endif
 
     // mark rest of blocks as used tail
     // TODO for a run of many blocks can make this more efficient
     for (size_t bl = start_block + 1; bl <= end_block; bl++) {
-        ATB_FREE_TO_TAIL(bl);
+        ATB_FREE_TO_TAIL(area, bl);
     }
 
+    #if MICROPY_GC_SPLIT_HEAP
+    if (area != MAIN_AREA) {
+        gc_skip_full_atbs(area);
+    }
+    #endif
+
     // get pointer to first block
     // we must create this pointer before unlocking the GC so a collection can find it
-    void *ret_ptr = (void*)(MP_STATE_MEM(gc_pool_start) + start_block * BYTES_PER_BLOCK);
+    void *ret_ptr = (void*)(area->gc_pool_start + start_block * BYTES_PER_BLOCK);
     DEBUG_printf("gc_alloc(%p)\n", ret_ptr);
 
     // If the allocation was long live then update the lowest value. Its used to trigger early
@@ -622,6 +1636,20 @@ void *gc_alloc(size_t n_bytes, bool has_finaliser, bool long_lived) {
     MP_STATE_MEM(gc_alloc_amount) += n_blocks;
     #endif
 
+    #if MICROPY_GC_IDLE_COLLECT
+    MP_STATE_MEM(gc_idle_alloc_amount) += n_blocks;
+    #endif
+
+    #if MICROPY_GC_INCREMENTAL
+    MP_STATE_MEM(gc_incremental_alloc_amount) += n_blocks;
+    if (MP_STATE_MEM(gc_incremental_state) == GC_INCREMENTAL_MARK) {
+        // Write barrier: new blocks are allocated marked and pushed so that
+        // whatever gets stored in them is scanned before the cycle ends.
+        ATB_HEAD_TO_MARK(area, start_block);
+        gc_incremental_push(ret_ptr);
+    }
+    #endif
+
     GC_EXIT();
 
     #if MICROPY_GC_CONSERVATIVE_CLEAR
@@ -642,7 +1670,7 @@ void *gc_alloc(size_t n_bytes, bool has_finaliser, bool long_lived) {
         ((mp_obj_base_t*)ret_ptr)->type = NULL;
         // set mp_obj flag only if it has a finaliser
         GC_ENTER();
-        FTB_SET(start_block);
+        FTB_SET(area, start_block);
         GC_EXIT();
     }
     #else
@@ -681,34 +1709,46 @@ void gc_free(void *ptr) {
     if (ptr == NULL) {
         GC_EXIT();
     } else {
-        if (MP_STATE_MEM(gc_pool_start) == 0) {
+        if (MAIN_AREA->gc_pool_start == 0) {
             reset_into_safe_mode(GC_ALLOC_OUTSIDE_VM);
         }
         // get the GC block number corresponding to this pointer
-        assert(VERIFY_PTR(ptr));
-        size_t start_block = BLOCK_FROM_PTR(ptr);
-        assert(ATB_GET_KIND(start_block) == AT_HEAD);
+        mp_state_mem_area_t *area = PTR_AREA(ptr);
+        assert(area != NULL);
+        size_t start_block = BLOCK_FROM_PTR(area, ptr);
+        assert(ATB_GET_KIND(area, start_block) == AT_HEAD || GC_MARKED_HEAD(area, start_block));
 
         #if MICROPY_ENABLE_FINALISER
-        FTB_CLEAR(start_block);
+        FTB_CLEAR(area, start_block);
         #endif
 
         // free head and all of its tail blocks
         #ifdef LOG_HEAP_ACTIVITY
         gc_log_change(start_block, 0);
         #endif
+        GC_TRACE(GC_TRACE_FREE, area, start_block, 0);
         size_t block = start_block;
         do {
-            ATB_ANY_TO_FREE(block);
+            ATB_ANY_TO_FREE(area, block);
             block += 1;
-        } while (ATB_GET_KIND(block) == AT_TAIL);
+        } while (ATB_GET_KIND(area, block) == AT_TAIL);
+
+        size_t new_free_atb = start_block / BLOCKS_PER_ATB;
+        #if MICROPY_GC_SPLIT_HEAP
+        if (area != MAIN_AREA) {
+            if (new_free_atb < area->gc_first_free_atb_index) {
+                area->gc_first_free_atb_index = new_free_atb;
+            }
+            GC_EXIT();
+            return;
+        }
+        #endif
 
         // Update the first free pointer for our size only. Not much calls gc_free directly so there
         // is decent chance we'll want to allocate this size again. By only updating the specific
         // size we don't risk something smaller fitting in.
         size_t n_blocks = block - start_block;
         size_t bucket = MIN(n_blocks, MICROPY_ATB_INDICES) - 1;
-        size_t new_free_atb = start_block / BLOCKS_PER_ATB;
         if (new_free_atb < MP_STATE_MEM(gc_first_free_atb_index)[bucket]) {
             MP_STATE_MEM(gc_first_free_atb_index)[bucket] = new_free_atb;
         }
@@ -727,14 +1767,15 @@ void gc_free(void *ptr) {
 
 size_t gc_nbytes(const void *ptr) {
     GC_ENTER();
-    if (VERIFY_PTR(ptr)) {
-        size_t block = BLOCK_FROM_PTR(ptr);
-        if (ATB_GET_KIND(block) == AT_HEAD) {
+    mp_state_mem_area_t *area = PTR_AREA(ptr);
+    if (area != NULL) {
+        size_t block = BLOCK_FROM_PTR(area, ptr);
+        if (ATB_GET_KIND(area, block) == AT_HEAD || GC_MARKED_HEAD(area, block)) {
             // work out number of consecutive blocks in the chain starting with this on
             size_t n_blocks = 0;
             do {
                 n_blocks += 1;
-            } while (ATB_GET_KIND(block + n_blocks) == AT_TAIL);
+            } while (ATB_GET_KIND(area, block + n_blocks) == AT_TAIL);
             GC_EXIT();
             return n_blocks * BYTES_PER_BLOCK;
         }
@@ -748,8 +1789,9 @@ size_t gc_nbytes(const void *ptr) {
 bool gc_has_finaliser(const void *ptr) {
 #if MICROPY_ENABLE_FINALISER
     GC_ENTER();
-    if (VERIFY_PTR(ptr)) {
-        bool has_finaliser = FTB_GET(BLOCK_FROM_PTR(ptr));
+    mp_state_mem_area_t *area = PTR_AREA(ptr);
+    if (area != NULL) {
+        bool has_finaliser = FTB_GET(area, BLOCK_FROM_PTR(area, ptr));
         GC_EXIT();
         return has_finaliser;
     }
@@ -767,6 +1809,13 @@ void *gc_make_long_lived(void *old_ptr) {
     if (old_ptr >= MP_STATE_MEM(gc_lowest_long_lived_ptr)) {
         return old_ptr;
     }
+    #if MICROPY_GC_SPLIT_HEAP
+    // Leave objects in the extra areas where they are. They are mostly large
+    // buffers that would crowd the main area.
+    if (HEAP_PTR_AREA(old_ptr) != MAIN_AREA) {
+        return old_ptr;
+    }
+    #endif
     size_t n_bytes = gc_nbytes(old_ptr);
     if (n_bytes == 0) {
         return old_ptr;
@@ -840,9 +1889,10 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
     }
 
     // get the GC block number corresponding to this pointer
-    assert(VERIFY_PTR(ptr));
-    size_t block = BLOCK_FROM_PTR(ptr);
-    assert(ATB_GET_KIND(block) == AT_HEAD);
+    mp_state_mem_area_t *area = PTR_AREA(ptr);
+    assert(area != NULL);
+    size_t block = BLOCK_FROM_PTR(area, ptr);
+    assert(ATB_GET_KIND(area, block) == AT_HEAD || GC_MARKED_HEAD(area, block));
 
     // compute number of new blocks that are requested
     size_t new_blocks = (n_bytes + BYTES_PER_BLOCK - 1) / BYTES_PER_BLOCK;
@@ -855,9 +1905,9 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
     // efficiently shrink it (see below for shrinking code).
     size_t n_free   = 0;
     size_t n_blocks = 1; // counting HEAD block
-    size_t max_block = MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB;
+    size_t max_block = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
     for (size_t bl = block + n_blocks; bl < max_block; bl++) {
-        byte block_type = ATB_GET_KIND(bl);
+        byte block_type = ATB_GET_KIND(area, bl);
         if (block_type == AT_TAIL) {
             n_blocks++;
             continue;
@@ -883,17 +1933,26 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
     if (new_blocks < n_blocks) {
         // free unneeded tail blocks
         for (size_t bl = block + new_blocks, count = n_blocks - new_blocks; count > 0; bl++, count--) {
-            ATB_ANY_TO_FREE(bl);
+            ATB_ANY_TO_FREE(area, bl);
         }
 
         // set the last_free pointer to end of this block if it's earlier in the heap
         size_t new_free_atb = (block + new_blocks) / BLOCKS_PER_ATB;
-        size_t bucket = MIN(n_blocks - new_blocks, MICROPY_ATB_INDICES) - 1;
-        if (new_free_atb < MP_STATE_MEM(gc_first_free_atb_index)[bucket]) {
-            MP_STATE_MEM(gc_first_free_atb_index)[bucket] = new_free_atb;
-        }
-        if (new_free_atb > MP_STATE_MEM(gc_last_free_atb_index)) {
-            MP_STATE_MEM(gc_last_free_atb_index) = new_free_atb;
+        #if MICROPY_GC_SPLIT_HEAP
+        if (area != MAIN_AREA) {
+            if (new_free_atb < area->gc_first_free_atb_index) {
+                area->gc_first_free_atb_index = new_free_atb;
+            }
+        } else
+        #endif
+        {
+            size_t bucket = MIN(n_blocks - new_blocks, MICROPY_ATB_INDICES) - 1;
+            if (new_free_atb < MP_STATE_MEM(gc_first_free_atb_index)[bucket]) {
+                MP_STATE_MEM(gc_first_free_atb_index)[bucket] = new_free_atb;
+            }
+            if (new_free_atb > MP_STATE_MEM(gc_last_free_atb_index)) {
+                MP_STATE_MEM(gc_last_free_atb_index) = new_free_atb;
+            }
         }
 
         GC_EXIT();
@@ -905,6 +1964,7 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
         #ifdef LOG_HEAP_ACTIVITY
         gc_log_change(block, new_blocks);
         #endif
+        GC_TRACE(GC_TRACE_ALLOC, area, block, new_blocks);
 
         return ptr_in;
     }
@@ -913,10 +1973,29 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
     if (new_blocks <= n_blocks + n_free) {
         // mark few more blocks as used tail
         for (size_t bl = block + n_blocks; bl < block + new_blocks; bl++) {
-            assert(ATB_GET_KIND(bl) == AT_FREE);
-            ATB_FREE_TO_TAIL(bl);
+            assert(ATB_GET_KIND(area, bl) == AT_FREE);
+            ATB_FREE_TO_TAIL(area, bl);
         }
 
+        #if MICROPY_GC_SPLIT_HEAP
+        if (area != MAIN_AREA) {
+            gc_skip_full_atbs(area);
+        }
+        #endif
+
+        #if MICROPY_GC_INCREMENTAL
+        if (GC_INCREMENTAL_MARKED(area, block)) {
+            // The block may already have been scanned at its old size.
+            gc_incremental_push(ptr);
+        }
+        #endif
+
+        #if MICROPY_GC_ALLOC_PROFILE
+        if (MP_STATE_MEM(gc_profile_enabled)) {
+            gc_profile_record((new_blocks - n_blocks) * BYTES_PER_BLOCK);
+        }
+        #endif
+
         GC_EXIT();
 
         #if MICROPY_GC_CONSERVATIVE_CLEAR
@@ -934,12 +2013,13 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
         #ifdef LOG_HEAP_ACTIVITY
         gc_log_change(block, new_blocks);
         #endif
+        GC_TRACE(GC_TRACE_ALLOC, area, block, new_blocks);
 
         return ptr_in;
     }
 
     #if MICROPY_ENABLE_FINALISER
-    bool ftb_state = FTB_GET(block);
+    bool ftb_state = FTB_GET(area, block);
     #else
     bool ftb_state = false;
     #endif
@@ -1003,30 +2083,25 @@ void gc_dump_info(void) {
         (uint)info.total, (uint)info.used, (uint)info.free);
     mp_printf(&mp_plat_print, " No. of 1-blocks: %u, 2-blocks: %u, max blk sz: %u, max free sz: %u\n",
            (uint)info.num_1block, (uint)info.num_2block, (uint)info.max_block, (uint)info.max_free);
+    mp_printf(&mp_plat_print, " Mark stack overflows: %u\n", (uint)MP_STATE_MEM(gc_stack_overflow_count));
 }
 
-void gc_dump_alloc_table(void) {
-    GC_ENTER();
+STATIC void gc_dump_area_alloc_table(mp_state_mem_area_t *area) {
     static const size_t DUMP_BYTES_PER_LINE = 64;
-    #if !EXTENSIVE_HEAP_PROFILING
-    // When comparing heap output we don't want to print the starting
-    // pointer of the heap because it changes from run to run.
-    mp_printf(&mp_plat_print, "GC memory layout; from %p:", MP_STATE_MEM(gc_pool_start));
-    #endif
-    for (size_t bl = 0; bl < MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB; bl++) {
+    for (size_t bl = 0; bl < area->gc_alloc_table_byte_len * BLOCKS_PER_ATB; bl++) {
         if (bl % DUMP_BYTES_PER_LINE == 0) {
             // a new line of blocks
             {
                 // check if this line contains only free blocks
                 size_t bl2 = bl;
-                while (bl2 < MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB && ATB_GET_KIND(bl2) == AT_FREE) {
+                while (bl2 < area->gc_alloc_table_byte_len * BLOCKS_PER_ATB && ATB_GET_KIND(area, bl2) == AT_FREE) {
                     bl2++;
                 }
                 if (bl2 - bl >= 2 * DUMP_BYTES_PER_LINE) {
                     // there are at least 2 lines containing only free blocks, so abbreviate their printing
                     mp_printf(&mp_plat_print, "\n       (%u lines all free)", (uint)(bl2 - bl) / DUMP_BYTES_PER_LINE);
                     bl = bl2 & (~(DUMP_BYTES_PER_LINE - 1));
-                    if (bl >= MP_STATE_MEM(gc_alloc_table_byte_len) * BLOCKS_PER_ATB) {
+                    if (bl >= area->gc_alloc_table_byte_len * BLOCKS_PER_ATB) {
                         // got to end of heap
                         break;
                     }
@@ -1038,7 +2113,7 @@ void gc_dump_alloc_table(void) {
             mp_printf(&mp_plat_print, "\n%05x: ", (uint)((bl * BYTES_PER_BLOCK) & (uint32_t)0xfffff));
         }
         int c = ' ';
-        switch (ATB_GET_KIND(bl)) {
+        switch (ATB_GET_KIND(area, bl)) {
             case AT_FREE: c = '.'; break;
             /* this prints out if the object is reachable from BSS or STACK (for unix only)
             case AT_HEAD: {
@@ -1070,7 +2145,7 @@ void gc_dump_alloc_table(void) {
             case AT_HEAD: {
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wcast-align"
-                void **ptr = (void**)(MP_STATE_MEM(gc_pool_start) + bl * BYTES_PER_BLOCK);
+                void **ptr = (void**)(area->gc_pool_start + bl * BYTES_PER_BLOCK);
 #pragma GCC diagnostic pop
                 if (*ptr == &mp_type_tuple) { c = 'T'; }
                 else if (*ptr == &mp_type_list) { c = 'L'; }
@@ -1114,7 +2189,19 @@ void gc_dump_alloc_table(void) {
         }
         mp_printf(&mp_plat_print, "%c", c);
     }
-    mp_print_str(&mp_plat_print, "\n");
+}
+
+void gc_dump_alloc_table(void) {
+    GC_ENTER();
+    for (mp_state_mem_area_t *area = MAIN_AREA; area != NULL; area = NEXT_AREA(area)) {
+        #if !EXTENSIVE_HEAP_PROFILING
+        // When comparing heap output we don't want to print the starting
+        // pointer of the heap because it changes from run to run.
+        mp_printf(&mp_plat_print, "GC memory layout; from %p:", area->gc_pool_start);
+        #endif
+        gc_dump_area_alloc_table(area);
+        mp_print_str(&mp_plat_print, "\n");
+    }
     GC_EXIT();
 }
 
@@ -36,13 +36,27 @@
 #define BYTES_PER_BLOCK (MICROPY_BYTES_PER_GC_BLOCK)
 
 // ptr should be of type void*
+#if MICROPY_GC_SPLIT_HEAP
+#define VERIFY_PTR(ptr) (gc_get_ptr_area(ptr) != NULL)
+#else
 #define VERIFY_PTR(ptr) ( \
         ((uintptr_t)(ptr) & (BYTES_PER_BLOCK - 1)) == 0      /* must be aligned on a block */ \
-        && ptr >= (void*)MP_STATE_MEM(gc_pool_start)     /* must be above start of pool */ \
-        && ptr < (void*)MP_STATE_MEM(gc_pool_end)        /* must be below end of pool */ \
+        && ptr >= (void*)MP_STATE_MEM(area).gc_pool_start     /* must be above start of pool */ \
+        && ptr < (void*)MP_STATE_MEM(area).gc_pool_end        /* must be below end of pool */ \
     )
+#endif
 
 void gc_init(void *start, void *end);
+
+#if MICROPY_GC_SPLIT_HEAP
+// Add another area of memory to the heap. Large short lived allocations are
+// placed in it first and other short lived ones once the main area is full.
+// Long lived allocations always stay in the main area.
+void gc_add(void *start, void *end);
+#endif
+
+// Return the heap area that ptr points to the start of a block in, or NULL.
+mp_state_mem_area_t *gc_get_ptr_area(const void *ptr);
 void gc_deinit(void);
 
 // These lock/unlock functions can be nested.
@@ -57,6 +71,62 @@ void gc_collect_start(void);
 void gc_collect_ptr(void *ptr);
 void gc_collect_root(void **ptrs, size_t len);
 void gc_collect_end(void);
+// Like gc_collect_start, but without tracing the root pointers.  Only what is
+// passed to gc_collect_ptr or gc_collect_root before gc_collect_end survives,
+// and finalisers run for everything else as in gc_sweep_all.
+void gc_collect_start_without_roots(void);
+
+#if MICROPY_GC_INCREMENTAL
+// Incremental collection. gc_collect_incremental_start() gathers the roots via
+// gc_collect() and gc_collect_incremental_step() then marks at most max_blocks
+// worth of the heap, returning true once marking is complete. A following
+// gc_collect() rescans the roots and sweeps. Nothing apart from the GC itself
+// may change heap pointers between steps, so a cycle that cannot be finished
+// before Python code resumes must be dropped with gc_collect_incremental_abort().
+bool gc_collect_incremental_wanted(void);
+bool gc_collect_incremental_in_progress(void);
+void gc_collect_incremental_start(void);
+bool gc_collect_incremental_step(size_t max_blocks);
+void gc_collect_incremental_abort(void);
+#endif
+
+#if MICROPY_GC_DEFERRED_FINALISER
+// Run the finalisers of dead objects that sweeps have queued. They otherwise
+// run from the scheduler.
+void gc_run_finalisers(void);
+#endif
+
+#if MICROPY_GC_IDLE_COLLECT
+// Whether enough has been allocated since the last collection that one should
+// be run at the next idle moment.
+bool gc_collect_idle_due(void);
+// Run a full collection if one is due. Returns true if it collected.
+bool gc_collect_idle(void);
+#endif
+
+#if MICROPY_GC_ALLOC_PROFILE
+// Allocation profiling. While enabled, every allocation is charged to the
+// bytecode location that made it, in MP_STATE_MEM(gc_profile).
+void gc_profile_enable(bool enable);
+bool gc_profile_is_enabled(void);
+void gc_profile_reset(void);
+#endif
+
+#if MICROPY_GC_TRACE
+// Heap activity trace. The port provides gc_trace_event(), which is called
+// with the heap lock held and so must not allocate. For AREA events ptr is the
+// start of an area and n_blocks its size; for ALLOC it is the new size of the
+// allocation at ptr. Collection events have no ptr.
+enum {
+    GC_TRACE_AREA,
+    GC_TRACE_ALLOC,
+    GC_TRACE_FREE,
+    GC_TRACE_SWEEP,
+    GC_TRACE_COLLECT_START,
+    GC_TRACE_COLLECT_END,
+};
+void gc_trace_event(uint8_t kind, const void *ptr, size_t n_blocks);
+#endif
 
 // Is the gc heap available?
 bool gc_alloc_possible(void);
@@ -86,6 +156,9 @@ typedef struct _gc_info_t {
 } gc_info_t;
 
 void gc_info(gc_info_t *info);
+// Like gc_info but for one area of the heap only, numbered from 0 for the
+// main area in the order they were added. Returns false if there is no such area.
+bool gc_area_info(size_t index, gc_info_t *info);
 void gc_dump_info(void);
 void gc_dump_alloc_table(void);
 
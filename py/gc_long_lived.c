@@ -102,6 +102,7 @@ mp_obj_dict_t *make_dict_long_lived(mp_obj_dict_t *dict, uint8_t max_depth) {
     // Update all of the references first so that we reduce the chance of references to the old
     // copies.
     dict->map.table = gc_make_long_lived(dict->map.table);
+    MP_MAP_KEYS_CHANGED(&dict->map);
     for (size_t i = 0; i < dict->map.alloc; i++) {
         if (MP_MAP_SLOT_IS_FILLED(&dict->map, i)) {
             mp_obj_t value = dict->map.table[i].value;
@@ -115,6 +116,18 @@ mp_obj_dict_t *make_dict_long_lived(mp_obj_dict_t *dict, uint8_t max_depth) {
 }
 
 mp_obj_str_t *make_str_long_lived(mp_obj_str_t *str) {
+    #if MICROPY_OPT_STR_SLICE
+    if (mp_obj_str_is_slice(MP_OBJ_FROM_PTR(str))) {
+        mp_obj_str_slice_t *slice = (mp_obj_str_slice_t *) str;
+        if (slice->kind == MP_OBJ_STR_SLICE_COPY) {
+            slice->owner = gc_make_long_lived(slice->owner);
+            str->data = slice->owner;
+        }
+        // Shared data stays where it is, the other objects using it may
+        // still point at it.
+        return gc_make_long_lived(str);
+    }
+    #endif
     str->data = gc_make_long_lived((byte *) str->data);
     return gc_make_long_lived(str);
 }
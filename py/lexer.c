@@ -129,9 +129,11 @@ STATIC bool is_head_of_identifier(mp_lexer_t *lex) {
     return is_letter(lex) || lex->chr0 == '_' || lex->chr0 >= 0x80;
 }
 
+#if !MICROPY_OPT_LEXER_FAST_SCAN
 STATIC bool is_tail_of_identifier(mp_lexer_t *lex) {
     return is_head_of_identifier(lex) || is_digit(lex);
 }
+#endif
 
 #if MICROPY_COMP_FSTRING_LITERAL
 STATIC void swap_char_banks(mp_lexer_t *lex) {
@@ -158,6 +160,23 @@ STATIC void swap_char_banks(mp_lexer_t *lex) {
 }
 #endif
 
+STATIC unichar read_char(mp_lexer_t *lex) {
+    #if MICROPY_OPT_LEXER_FAST_SCAN
+    if (lex->reader.readchunk != NULL) {
+        if (lex->src_cur == lex->src_end) {
+            size_t len;
+            lex->src_cur = lex->reader.readchunk(lex->reader.data, &len);
+            lex->src_end = lex->src_cur + len;
+            if (len == 0) {
+                return MP_LEXER_EOF;
+            }
+        }
+        return *lex->src_cur++;
+    }
+    #endif
+    return lex->reader.readbyte(lex->reader.data);
+}
+
 STATIC void next_char(mp_lexer_t *lex) {
     if (lex->chr0 == '\n') {
         // a new line
@@ -184,7 +203,7 @@ STATIC void next_char(mp_lexer_t *lex) {
     } else
 #endif
     {
-        lex->chr2 = lex->reader.readbyte(lex->reader.data);
+        lex->chr2 = read_char(lex);
     }
 
     if (lex->chr1 == '\r') {
@@ -192,7 +211,7 @@ STATIC void next_char(mp_lexer_t *lex) {
         lex->chr1 = '\n';
         if (lex->chr2 == '\n') {
             // CR LF is a single new line, throw out the extra LF
-            lex->chr2 = lex->reader.readbyte(lex->reader.data);
+            lex->chr2 = read_char(lex);
         }
     }
 
@@ -209,6 +228,71 @@ STATIC void next_char(mp_lexer_t *lex) {
 #endif
 }
 
+#if MICROPY_OPT_LEXER_FAST_SCAN
+typedef enum {
+    LEX_RUN_IDENT,
+    LEX_RUN_DIGIT,
+    LEX_RUN_SPACE,
+    LEX_RUN_COMMENT,
+} lex_run_t;
+
+// Characters in a run each take one column, so newlines, CR and tabs are
+// never part of one.
+STATIC bool is_run_char(unichar c, lex_run_t run) {
+    if (c > 0xff) {
+        return false;
+    }
+    switch (run) {
+        case LEX_RUN_IDENT:
+            return unichar_isident(c) || c >= 0x80;
+        case LEX_RUN_DIGIT:
+            return unichar_isdigit(c);
+        case LEX_RUN_SPACE:
+            return c == ' ';
+        default:
+            return c != '\n' && c != '\r' && c != '\t';
+    }
+}
+
+// Move past the run of characters starting at chr0, adding them to the token
+// text if add is true.  Once chr0, chr1 and chr2 are all in the run, the rest
+// of it is found in the reader's buffer and taken in one go, then chr0-chr2
+// are reloaded as at the start of the input.
+STATIC void next_char_run(mp_lexer_t *lex, lex_run_t run, bool add) {
+    while (is_run_char(lex->chr0, run)) {
+        if (is_run_char(lex->chr1, run) && is_run_char(lex->chr2, run)
+            && lex->src_cur < lex->src_end
+            #if MICROPY_COMP_FSTRING_LITERAL
+            && !lex->vstr_postfix_processing
+            #endif
+            ) {
+            const byte *p = lex->src_cur;
+            while (p < lex->src_end && is_run_char(*p, run)) {
+                ++p;
+            }
+            if (add) {
+                vstr_add_byte(&lex->vstr, lex->chr0);
+                vstr_add_byte(&lex->vstr, lex->chr1);
+                vstr_add_byte(&lex->vstr, lex->chr2);
+                vstr_add_strn(&lex->vstr, (const char*)lex->src_cur, p - lex->src_cur);
+            }
+            // the three next_char calls count for chr0-chr2
+            lex->column += p - lex->src_cur;
+            lex->src_cur = p;
+            lex->chr0 = lex->chr1 = lex->chr2 = 0;
+            next_char(lex);
+            next_char(lex);
+            next_char(lex);
+        } else {
+            if (add) {
+                vstr_add_byte(&lex->vstr, lex->chr0);
+            }
+            next_char(lex);
+        }
+    }
+}
+#endif
+
 STATIC void indent_push(mp_lexer_t *lex, size_t indent) {
     if (lex->num_indent_level >= lex->alloc_indent_level) {
         lex->indent_level = m_renew(uint16_t, lex->indent_level, lex->alloc_indent_level, lex->alloc_indent_level + MICROPY_ALLOC_LEXEL_INDENT_INC);
@@ -523,10 +607,22 @@ STATIC bool skip_whitespace(mp_lexer_t *lex, bool stop_at_newline) {
             had_physical_newline = true;
             next_char(lex);
         } else if (is_whitespace(lex)) {
+            #if MICROPY_OPT_LEXER_FAST_SCAN
+            if (is_char(lex, ' ')) {
+                next_char_run(lex, LEX_RUN_SPACE, false);
+                continue;
+            }
+            #endif
             next_char(lex);
         } else if (is_char(lex, '#')) {
             next_char(lex);
             while (!is_end(lex) && !is_physical_newline(lex)) {
+                #if MICROPY_OPT_LEXER_FAST_SCAN
+                next_char_run(lex, LEX_RUN_COMMENT, false);
+                if (is_end(lex) || is_physical_newline(lex)) {
+                    break;
+                }
+                #endif
                 next_char(lex);
             }
             // had_physical_newline will be set on next loop
@@ -692,10 +788,14 @@ void mp_lexer_to_next(mp_lexer_t *lex) {
         next_char(lex);
 
         // get tail chars
+        #if MICROPY_OPT_LEXER_FAST_SCAN
+        next_char_run(lex, LEX_RUN_IDENT, true);
+        #else
         while (!is_end(lex) && is_tail_of_identifier(lex)) {
             vstr_add_byte(&lex->vstr, CUR_CHAR(lex));
             next_char(lex);
         }
+        #endif
 
         // Check if the name is a keyword.
         // We also check for __debug__ here and convert it to its value.  This is
@@ -733,6 +833,12 @@ void mp_lexer_to_next(mp_lexer_t *lex) {
 
         // get tail chars
         while (!is_end(lex)) {
+            #if MICROPY_OPT_LEXER_FAST_SCAN
+            if (is_digit(lex)) {
+                next_char_run(lex, LEX_RUN_DIGIT, true);
+                continue;
+            }
+            #endif
             if (!forced_integer && is_char_or(lex, 'e', 'E')) {
                 lex->tok_kind = MP_TOKEN_FLOAT_OR_IMAG;
                 vstr_add_char(&lex->vstr, 'e');
@@ -829,6 +935,9 @@ mp_lexer_t *mp_lexer_new(qstr src_name, mp_reader_t reader) {
 
     lex->source_name = src_name;
     lex->reader = reader;
+    #if MICROPY_OPT_LEXER_FAST_SCAN
+    lex->src_cur = lex->src_end = NULL;
+    #endif
     lex->line = 1;
     lex->column = (size_t)-2; // account for 3 dummy bytes
     lex->emit_dent = 0;
@@ -158,6 +158,10 @@ typedef struct _mp_lexer_t {
     mp_reader_t reader;         // stream source
 
     unichar chr0, chr1, chr2;   // current cached characters from source
+#if MICROPY_OPT_LEXER_FAST_SCAN
+    const byte *src_cur;        // bytes following chr2 taken from the reader
+    const byte *src_end;
+#endif
 #if MICROPY_COMP_FSTRING_LITERAL
     unichar chr3, chr4, chr5;   // current cached characters from alt source
 #endif
@@ -85,6 +85,54 @@ def compute_hash(qstr, bytes_hash):
     # Make sure that valid hash is never zero, zero means "hash not computed"
     return (hash & ((1 << (8 * bytes_hash)) - 1)) or 1
 
+# this must match qstr_index_hash in qstr.c
+def compute_index_hash(seed, qbytes):
+    hash = seed
+    for b in bytearray(qbytes):
+        hash = ((hash * 33) ^ b) & 0xffffffff
+    hash ^= hash >> 16
+    hash = (hash * 0x45d9f3b) & 0xffffffff
+    hash ^= hash >> 16
+    return hash
+
+INDEX_HASH_INIT = 5381
+
+# Build a minimal perfect hash over the given list of byte strings, using the
+# "hash and displace" method: each key is first hashed to a bucket, then every
+# bucket gets a seed such that hashing its keys with that seed sends them to
+# distinct, still-free slots.  The result is laid out as
+#   [num_buckets, num_slots, seed[num_buckets]..., slot[num_slots]...]
+# where each slot holds the value for the key that maps to it.
+def make_perfect_hash(keys, values):
+    if not keys:
+        return [1, 0, 0]
+    num_slots = len(keys)
+    num_buckets = (num_slots + 3) // 4
+    while True:
+        buckets = [[] for _ in range(num_buckets)]
+        for k, v in zip(keys, values):
+            buckets[compute_index_hash(INDEX_HASH_INIT, k) % num_buckets].append((k, v))
+        seeds = [0] * num_buckets
+        slots = [None] * num_slots
+        # place the largest buckets first, while there is still plenty of room
+        for b in sorted(range(num_buckets), key=lambda b: -len(buckets[b])):
+            bucket = buckets[b]
+            if not bucket:
+                continue
+            for seed in range(1, 0x10000):
+                pos = [compute_index_hash(seed, k) % num_slots for k, v in bucket]
+                if len(set(pos)) == len(pos) and all(slots[p] is None for p in pos):
+                    break
+            else:
+                break
+            seeds[b] = seed
+            for p, (k, v) in zip(pos, bucket):
+                slots[p] = v
+        else:
+            return [num_buckets, num_slots] + seeds + slots
+        # some bucket could not be placed; retry with smaller buckets
+        num_buckets += 1
+
 def translate(translation_file, i18ns):
     with open(translation_file, "rb") as f:
         table = gettext.GNUTranslations(f)
@@ -136,12 +184,35 @@ def compute_huffman_coding(translations, qstrs, compression_filename):
     print("//", values, lengths)
     values_type = "uint16_t" if max(ord(u) for u in values) > 255 else "uint8_t"
     max_translation_encoded_length = max(len(translation.encode("utf-8")) for original,translation in translations)
+    decode_table_bits, decode_table = compute_decode_table(values, canonical)
     with open(compression_filename, "w") as f:
         f.write("const uint8_t lengths[] = {{ {} }};\n".format(", ".join(map(str, lengths))))
         f.write("const {} values[] = {{ {} }};\n".format(values_type, ", ".join(str(ord(u)) for u in values)))
         f.write("#define compress_max_length_bits ({})\n".format(max_translation_encoded_length.bit_length()))
+        f.write("#define compress_decode_table_bits ({})\n".format(decode_table_bits))
+        f.write("const uint16_t decode_table[] = {{ {} }};\n".format(", ".join(map(str, decode_table))))
     return values, lengths
 
+# The decode table is indexed by the next decode_table_bits bits of the
+# encoded string.  An entry is (code length << 12) | index into values for a
+# code that fits in those bits, or 0 if the code is longer and has to be
+# decoded a bit at a time.
+DECODE_TABLE_BITS = 8
+
+def compute_decode_table(values, canonical):
+    if len(values) >= (1 << 12):
+        return 0, [0]
+    table = [0] * (1 << DECODE_TABLE_BITS)
+    for i, ch in enumerate(values):
+        code = canonical[ch]
+        l = len(code)
+        if l > DECODE_TABLE_BITS:
+            break
+        first = int(code, 2) << (DECODE_TABLE_BITS - l)
+        for j in range(first, first + (1 << (DECODE_TABLE_BITS - l))):
+            table[j] = (l << 12) | i
+    return DECODE_TABLE_BITS, table
+
 def decompress(encoding_table, encoded, encoded_length_bits):
     values, lengths = encoding_table
     dec = []
@@ -390,6 +461,15 @@ def print_qstr_data(encoding_table, qcfgs, qstrs, i18ns):
         print("TRANSLATION(\"{}\", {}) // {}".format(original, ", ".join(["{:d}".format(x) for x in compressed]), decompressed))
         total_text_size += len(translation.encode("utf-8"))
 
+    # perfect hash index of the pool (which starts with MP_QSTR_NULL), used by qstr_find_strn
+    qstr_list = [bytes_cons(qstr, 'utf8') for order, ident, qstr in sorted(qstrs.values(), key=lambda x: x[0])]
+    index = make_perfect_hash(qstr_list, range(1, len(qstr_list) + 1))
+    print()
+    print('#ifdef QSTR_INDEX')
+    for i in range(0, len(index), 16):
+        print('QSTR_INDEX(%s)' % ', '.join('%u' % v for v in index[i:i + 16]))
+    print('#endif')
+
     print()
     print("// {} bytes worth of qstr".format(total_qstr_size))
     print("// {} bytes worth of translations".format(total_text_size))
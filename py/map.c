@@ -78,18 +78,85 @@ STATIC size_t get_hash_alloc_greater_or_equal_to(size_t x) {
 /******************************************************************************/
 /* map                                                                        */
 
+#if MICROPY_OPT_MAP_COMPACT
+
+// A compact map's table holds alloc entries, filled densely in the order they
+// were added and with deleted ones left as MP_OBJ_SENTINEL, so code that walks
+// the table using MP_MAP_SLOT_IS_FILLED sees no difference.  The table is
+// followed by this header and a power-of-2 sized index of hash slots, kept at
+// most 2/3 full so probes stay short and there is always an empty slot to end
+// one.  A used slot holds the position of its entry plus one.
+typedef struct _map_compact_t {
+    size_t filled; // entries used so far, including deleted ones
+    size_t mask; // number of index slots minus one
+    uint16_t index[];
+} map_compact_t;
+
+#define COMPACT_SLOT_EMPTY (0)
+#define COMPACT_SLOT_DELETED (0xffff)
+
+static inline map_compact_t *map_compact(const mp_map_t *map) {
+    return (map_compact_t*)&map->table[map->alloc];
+}
+
+STATIC size_t map_compact_num_slots(size_t n) {
+    size_t num_slots = 8;
+    while (num_slots < n + n / 2) {
+        num_slots <<= 1;
+    }
+    return num_slots;
+}
+
+#endif
+
+// The map is only modified once the allocation has succeeded.
+STATIC void mp_map_alloc_table(mp_map_t *map, size_t n) {
+    #if MICROPY_OPT_MAP_COMPACT
+    // positions stored in the index must stay below COMPACT_SLOT_DELETED
+    if (n >= MICROPY_OPT_MAP_COMPACT_MIN_ALLOC && n < COMPACT_SLOT_DELETED) {
+        size_t num_slots = map_compact_num_slots(n);
+        map->table = m_malloc0(n * sizeof(mp_map_elem_t) + sizeof(map_compact_t) + num_slots * sizeof(uint16_t), false);
+        map->alloc = n;
+        map->is_compact = 1;
+        map_compact(map)->mask = num_slots - 1;
+        return;
+    }
+    #endif
+    map->table = m_new0(mp_map_elem_t, n);
+    map->alloc = n;
+    map->is_compact = 0;
+}
+
 void mp_map_init(mp_map_t *map, size_t n) {
     if (n == 0) {
         map->alloc = 0;
         map->table = NULL;
+        map->is_compact = 0;
     } else {
-        map->alloc = n;
-        map->table = m_new0(mp_map_elem_t, map->alloc);
+        mp_map_alloc_table(map, n);
     }
     map->used = 0;
     map->all_keys_are_qstrs = 1;
     map->is_fixed = 0;
     map->is_ordered = 0;
+    map->versioned = 0;
+}
+
+// Initialise map with the same contents and layout as src, which can't be fixed.
+void mp_map_init_copy(mp_map_t *map, const mp_map_t *src) {
+    mp_map_init(map, src->alloc);
+    size_t num_bytes = src->alloc * sizeof(mp_map_elem_t);
+    #if MICROPY_OPT_MAP_COMPACT
+    if (src->is_compact && !src->is_ordered) {
+        num_bytes += sizeof(map_compact_t) + (map_compact(src)->mask + 1) * sizeof(uint16_t);
+    }
+    #endif
+    if (num_bytes > 0) {
+        memcpy(map->table, src->table, num_bytes);
+    }
+    map->used = src->used;
+    map->all_keys_are_qstrs = src->all_keys_are_qstrs;
+    map->is_ordered = src->is_ordered;
 }
 
 void mp_map_init_fixed_table(mp_map_t *map, size_t n, const mp_obj_t *table) {
@@ -98,6 +165,8 @@ void mp_map_init_fixed_table(mp_map_t *map, size_t n, const mp_obj_t *table) {
     map->all_keys_are_qstrs = 1;
     map->is_fixed = 1;
     map->is_ordered = 1;
+    map->versioned = 0;
+    map->is_compact = 0;
     map->table = (mp_map_elem_t*)table;
 }
 
@@ -107,6 +176,7 @@ void mp_map_deinit(mp_map_t *map) {
         m_del(mp_map_elem_t, map->table, map->alloc);
     }
     map->used = map->alloc = 0;
+    MP_MAP_KEYS_CHANGED(map);
 }
 
 void mp_map_clear(mp_map_t *map) {
@@ -117,20 +187,29 @@ void mp_map_clear(mp_map_t *map) {
     map->used = 0;
     map->all_keys_are_qstrs = 1;
     map->is_fixed = 0;
+    map->is_compact = 0;
     map->table = NULL;
+    MP_MAP_KEYS_CHANGED(map);
 }
 
 STATIC void mp_map_rehash(mp_map_t *map) {
     size_t old_alloc = map->alloc;
-    size_t new_alloc = get_hash_alloc_greater_or_equal_to(map->alloc + 1);
+    size_t min_alloc = map->alloc;
+    #if MICROPY_OPT_MAP_COMPACT
+    // a compact table fills up with deleted entries too, so size on live ones,
+    // but still grow if deletes didn't free at least half of it so that
+    // steady adds and deletes don't rehash every few insertions
+    if (map->is_compact && map->used < map->alloc / 2) {
+        min_alloc = map->used;
+    }
+    #endif
+    size_t new_alloc = get_hash_alloc_greater_or_equal_to(min_alloc + 1);
     DEBUG_printf("mp_map_rehash(%p): " UINT_FMT " -> " UINT_FMT "\n", map, old_alloc, new_alloc);
     mp_map_elem_t *old_table = map->table;
-    mp_map_elem_t *new_table = m_new0(mp_map_elem_t, new_alloc);
-    // If we reach this point, table resizing succeeded, now we can edit the old map.
-    map->alloc = new_alloc;
+    // If mp_map_alloc_table succeeds, table resizing succeeded, now we can edit the old map.
+    mp_map_alloc_table(map, new_alloc);
     map->used = 0;
     map->all_keys_are_qstrs = 1;
-    map->table = new_table;
     for (size_t i = 0; i < old_alloc; i++) {
         if (old_table[i].key != MP_OBJ_NULL && old_table[i].key != MP_OBJ_SENTINEL) {
             mp_map_lookup(map, old_table[i].key, MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)->value = old_table[i].value;
@@ -139,6 +218,67 @@ STATIC void mp_map_rehash(mp_map_t *map) {
     m_del(mp_map_elem_t, old_table, old_alloc);
 }
 
+#if MICROPY_OPT_MAP_COMPACT
+STATIC mp_map_elem_t *mp_map_lookup_compact(mp_map_t *map, mp_obj_t index, mp_uint_t hash, bool compare_only_ptrs, mp_map_lookup_kind_t lookup_kind) {
+    map_compact_t *c = map_compact(map);
+    size_t pos = hash & c->mask;
+    uint16_t *avail_slot = NULL;
+    for (;;) {
+        size_t slot = c->index[pos];
+        if (slot == COMPACT_SLOT_EMPTY) {
+            // found empty slot, so index is not in table
+            if (lookup_kind != MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
+                return NULL;
+            }
+            if (c->filled == map->alloc) {
+                // no room for another entry, rehash and add to the new table
+                mp_map_rehash(map);
+                return mp_map_lookup(map, index, lookup_kind);
+            }
+            if (avail_slot == NULL) {
+                avail_slot = &c->index[pos];
+            }
+            mp_map_elem_t *elem = &map->table[c->filled++];
+            *avail_slot = c->filled;
+            map->used++;
+            MP_MAP_KEYS_CHANGED(map);
+            elem->key = index;
+            elem->value = MP_OBJ_NULL;
+            if (!MP_OBJ_IS_QSTR(index)) {
+                map->all_keys_are_qstrs = 0;
+            }
+            return elem;
+        } else if (slot == COMPACT_SLOT_DELETED) {
+            // found deleted slot, remember for later
+            if (avail_slot == NULL) {
+                avail_slot = &c->index[pos];
+            }
+        } else {
+            mp_map_elem_t *elem = &map->table[slot - 1];
+            // the entry may have been deleted by dict.popitem without clearing its slot
+            if (elem->key == index || (!compare_only_ptrs && elem->key != MP_OBJ_SENTINEL && mp_obj_equal(elem->key, index))) {
+                if (lookup_kind == MP_MAP_LOOKUP_REMOVE_IF_FOUND) {
+                    // delete the entry, keeping elem->value so that caller can access it if needed
+                    map->used--;
+                    MP_MAP_KEYS_CHANGED(map);
+                    c->index[pos] = COMPACT_SLOT_DELETED;
+                    elem->key = MP_OBJ_SENTINEL;
+                }
+                return elem;
+            }
+        }
+        pos = (pos + 1) & c->mask;
+    }
+}
+#endif
+
+#if MICROPY_OPT_MAP_LOOKUP_CACHE
+STATIC uint8_t *map_lookup_cache_entry(const mp_map_t *map, mp_obj_t index) {
+    size_t hash = ((uintptr_t)map / sizeof(mp_obj_t)) ^ ((uintptr_t)index >> 2);
+    return &MP_STATE_VM(map_lookup_cache)[hash & (MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE - 1)];
+}
+#endif
+
 // MP_MAP_LOOKUP behaviour:
 //  - returns NULL if not found, else the slot it was found in with key,value non-null
 // MP_MAP_LOOKUP_ADD_IF_NOT_FOUND behaviour:
@@ -170,13 +310,27 @@ mp_map_elem_t *PLACE_IN_ITCM(mp_map_lookup)(mp_map_t *map, mp_obj_t index, mp_ma
 
     // if the map is an ordered array then we must do a brute force linear search
     if (map->is_ordered) {
+        #if MICROPY_OPT_MAP_LOOKUP_CACHE
+        // Try the position the key was last found at; keys are unique, so if
+        // the very same object is there then it's the one the search would find.
+        uint8_t *cached = map_lookup_cache_entry(map, index);
+        if (lookup_kind != MP_MAP_LOOKUP_REMOVE_IF_FOUND && *cached < map->used && map->table[*cached].key == index) {
+            return &map->table[*cached];
+        }
+        #endif
         for (mp_map_elem_t *elem = &map->table[0], *top = &map->table[map->used]; elem < top; elem++) {
             if (elem->key == index || (!compare_only_ptrs && mp_obj_equal(elem->key, index))) {
+                #if MICROPY_OPT_MAP_LOOKUP_CACHE
+                if (elem - map->table < 256) {
+                    *cached = elem - map->table;
+                }
+                #endif
                 #if MICROPY_PY_COLLECTIONS_ORDEREDDICT
                 if (MP_UNLIKELY(lookup_kind == MP_MAP_LOOKUP_REMOVE_IF_FOUND)) {
                     // remove the found element by moving the rest of the array down
                     mp_obj_t value = elem->value;
                     --map->used;
+                    MP_MAP_KEYS_CHANGED(map);
                     memmove(elem, elem + 1, (top - elem - 1) * sizeof(*elem));
                     // put the found element after the end so the caller can access it if needed
                     elem = &map->table[map->used];
@@ -199,6 +353,7 @@ mp_map_elem_t *PLACE_IN_ITCM(mp_map_lookup)(mp_map_t *map, mp_obj_t index, mp_ma
         }
         mp_map_elem_t *elem = map->table + map->used++;
         elem->key = index;
+        MP_MAP_KEYS_CHANGED(map);
         if (!MP_OBJ_IS_QSTR(index)) {
             map->all_keys_are_qstrs = 0;
         }
@@ -226,6 +381,12 @@ mp_map_elem_t *PLACE_IN_ITCM(mp_map_lookup)(mp_map_t *map, mp_obj_t index, mp_ma
         hash = MP_OBJ_SMALL_INT_VALUE(mp_unary_op(MP_UNARY_OP_HASH, index));
     }
 
+    #if MICROPY_OPT_MAP_COMPACT
+    if (map->is_compact) {
+        return mp_map_lookup_compact(map, index, hash, compare_only_ptrs, lookup_kind);
+    }
+    #endif
+
     size_t pos = hash % map->alloc;
     size_t start_pos = pos;
     mp_map_elem_t *avail_slot = NULL;
@@ -235,6 +396,7 @@ mp_map_elem_t *PLACE_IN_ITCM(mp_map_lookup)(mp_map_t *map, mp_obj_t index, mp_ma
             // found NULL slot, so index is not in table
             if (lookup_kind == MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
                 map->used += 1;
+                MP_MAP_KEYS_CHANGED(map);
                 if (avail_slot == NULL) {
                     avail_slot = slot;
                 }
@@ -258,6 +420,7 @@ mp_map_elem_t *PLACE_IN_ITCM(mp_map_lookup)(mp_map_t *map, mp_obj_t index, mp_ma
             if (lookup_kind == MP_MAP_LOOKUP_REMOVE_IF_FOUND) {
                 // delete element in this slot
                 map->used--;
+                MP_MAP_KEYS_CHANGED(map);
                 if (map->table[(pos + 1) % map->alloc].key == MP_OBJ_NULL) {
                     // optimisation if next slot is empty
                     slot->key = MP_OBJ_NULL;
@@ -278,6 +441,7 @@ mp_map_elem_t *PLACE_IN_ITCM(mp_map_lookup)(mp_map_t *map, mp_obj_t index, mp_ma
                 if (avail_slot != NULL) {
                     // there was an available slot, so use that
                     map->used++;
+                    MP_MAP_KEYS_CHANGED(map);
                     avail_slot->key = index;
                     avail_slot->value = MP_OBJ_NULL;
                     if (!MP_OBJ_IS_QSTR(index)) {
@@ -287,6 +451,11 @@ mp_map_elem_t *PLACE_IN_ITCM(mp_map_lookup)(mp_map_t *map, mp_obj_t index, mp_ma
                 } else {
                     // not enough room in table, rehash it
                     mp_map_rehash(map);
+                    #if MICROPY_OPT_MAP_COMPACT
+                    if (map->is_compact) {
+                        return mp_map_lookup_compact(map, index, hash, compare_only_ptrs, lookup_kind);
+                    }
+                    #endif
                     // restart the search for the new element
                     start_pos = pos = hash % map->alloc;
                 }
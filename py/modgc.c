@@ -27,6 +27,7 @@
 #include "py/mpstate.h"
 #include "py/obj.h"
 #include "py/gc.h"
+#include "py/runtime.h"
 
 #if MICROPY_PY_GC && MICROPY_ENABLE_GC
 
@@ -60,21 +61,39 @@ STATIC mp_obj_t gc_isenabled(void) {
 }
 MP_DEFINE_CONST_FUN_OBJ_0(gc_isenabled_obj, gc_isenabled);
 
-// mem_free(): return the number of bytes of available heap RAM
-STATIC mp_obj_t gc_mem_free(void) {
+// Fill in info for the whole heap, or for one area of it if given.
+STATIC void gc_get_info(size_t n_args, const mp_obj_t *args, gc_info_t *info) {
+    if (n_args == 0) {
+        gc_info(info);
+    } else if (!gc_area_info(mp_obj_get_int(args[0]), info)) {
+        mp_raise_IndexError(translate("index out of range"));
+    }
+}
+
+// mem_free([area]): return the number of bytes of available heap RAM
+STATIC mp_obj_t gc_mem_free(size_t n_args, const mp_obj_t *args) {
     gc_info_t info;
-    gc_info(&info);
+    gc_get_info(n_args, args, &info);
     return MP_OBJ_NEW_SMALL_INT(info.free);
 }
-MP_DEFINE_CONST_FUN_OBJ_0(gc_mem_free_obj, gc_mem_free);
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_mem_free_obj, 0, 1, gc_mem_free);
 
-// mem_alloc(): return the number of bytes of heap RAM that are allocated
-STATIC mp_obj_t gc_mem_alloc(void) {
+// mem_alloc([area]): return the number of bytes of heap RAM that are allocated
+STATIC mp_obj_t gc_mem_alloc(size_t n_args, const mp_obj_t *args) {
     gc_info_t info;
-    gc_info(&info);
+    gc_get_info(n_args, args, &info);
     return MP_OBJ_NEW_SMALL_INT(info.used);
 }
-MP_DEFINE_CONST_FUN_OBJ_0(gc_mem_alloc_obj, gc_mem_alloc);
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_mem_alloc_obj, 0, 1, gc_mem_alloc);
+
+#if MICROPY_GC_IDLE_COLLECT
+// idle(): hint that now is a cheap time to collect; collects if one is due
+// and returns whether it did
+STATIC mp_obj_t gc_idle(void) {
+    return mp_obj_new_bool(gc_collect_idle());
+}
+MP_DEFINE_CONST_FUN_OBJ_0(gc_idle_obj, gc_idle);
+#endif
 
 #if MICROPY_GC_ALLOC_THRESHOLD
 STATIC mp_obj_t gc_threshold(size_t n_args, const mp_obj_t *args) {
@@ -103,6 +122,9 @@ STATIC const mp_rom_map_elem_t mp_module_gc_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_isenabled), MP_ROM_PTR(&gc_isenabled_obj) },
     { MP_ROM_QSTR(MP_QSTR_mem_free), MP_ROM_PTR(&gc_mem_free_obj) },
     { MP_ROM_QSTR(MP_QSTR_mem_alloc), MP_ROM_PTR(&gc_mem_alloc_obj) },
+    #if MICROPY_GC_IDLE_COLLECT
+    { MP_ROM_QSTR(MP_QSTR_idle), MP_ROM_PTR(&gc_idle_obj) },
+    #endif
     #if MICROPY_GC_ALLOC_THRESHOLD
     { MP_ROM_QSTR(MP_QSTR_threshold), MP_ROM_PTR(&gc_threshold_obj) },
     #endif
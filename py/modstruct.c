@@ -30,6 +30,8 @@
 
 #include "py/runtime.h"
 #include "py/builtin.h"
+#include "py/objlist.h"
+#include "py/objproperty.h"
 #include "py/objtuple.h"
 #include "py/binary.h"
 #include "py/parsenum.h"
@@ -259,6 +261,250 @@ STATIC mp_obj_t struct_pack_into(size_t n_args, const mp_obj_t *args) {
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_pack_into_obj, 3, MP_OBJ_FUN_ARGS_MAX, struct_pack_into);
 
+// struct.Struct parses its format once, into a list of fields that pack and
+// unpack then walk without looking at the format string again.
+
+typedef struct _struct_field_t {
+    char code;
+    mp_uint_t count; // repeat count, or length for 's'
+} struct_field_t;
+
+typedef struct _mp_obj_struct_t {
+    mp_obj_base_t base;
+    mp_obj_t format;
+    char fmt_type;
+    size_t size;
+    size_t num_items;
+    size_t num_fields;
+    struct_field_t fields[];
+} mp_obj_struct_t;
+
+STATIC mp_obj_t struct_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
+    mp_arg_check_num(n_args, kw_args, 1, 1, false);
+    const char *fmt = mp_obj_str_get_str(args[0]);
+    size_t size;
+    size_t num_items = calc_size_items(fmt, &size);
+    char fmt_type = get_fmt_type(&fmt);
+    size_t num_fields = 0;
+    for (const char *f = fmt; *f; f++) {
+        num_fields += !unichar_isdigit(*f);
+    }
+
+    mp_obj_struct_t *o = m_new_obj_var(mp_obj_struct_t, struct_field_t, num_fields);
+    o->base.type = type;
+    o->format = args[0];
+    o->fmt_type = fmt_type;
+    o->size = size;
+    o->num_items = num_items;
+    o->num_fields = num_fields;
+    for (struct_field_t *field = o->fields; *fmt; fmt++, field++) {
+        field->count = 1;
+        if (unichar_isdigit(*fmt)) {
+            field->count = get_fmt_num(&fmt);
+        }
+        field->code = *fmt;
+    }
+    return MP_OBJ_FROM_PTR(o);
+}
+
+STATIC void struct_unpack_fields(mp_obj_struct_t *self, byte *p, mp_obj_t *items) {
+    const struct_field_t *field = self->fields;
+    for (size_t i = 0; i < self->num_items; field++) {
+        if (field->code == 's') {
+            items[i++] = mp_obj_new_bytes(p, field->count);
+            p += field->count;
+        } else {
+            for (mp_uint_t cnt = field->count; cnt > 0; cnt--) {
+                mp_obj_t item = mp_binary_get_val(self->fmt_type, field->code, &p);
+                // Pad bytes ('x') are just skipped.
+                if (field->code != 'x') {
+                    items[i++] = item;
+                }
+            }
+        }
+    }
+}
+
+// This function assumes there is enough room in p to store all the values
+STATIC void struct_pack_fields(mp_obj_struct_t *self, byte *p, size_t n_args, const mp_obj_t *args) {
+    const struct_field_t *field = self->fields;
+    const struct_field_t *end = field + self->num_fields;
+    for (size_t i = 0; i < n_args && field < end; field++) {
+        if (field->code == 's') {
+            mp_buffer_info_t bufinfo;
+            mp_get_buffer_raise(args[i++], &bufinfo, MP_BUFFER_READ);
+            mp_uint_t to_copy = MIN(bufinfo.len, field->count);
+            memcpy(p, bufinfo.buf, to_copy);
+            memset(p + to_copy, 0, field->count - to_copy);
+            p += field->count;
+        } else {
+            // If we run out of args then we just finish; CPython would raise struct.error
+            for (mp_uint_t cnt = field->count; cnt > 0 && i < n_args; cnt--) {
+                mp_binary_set_val(self->fmt_type, field->code, args[i], &p);
+                // Pad bytes don't have a corresponding argument.
+                if (field->code != 'x') {
+                    i++;
+                }
+            }
+        }
+    }
+}
+
+// Resolve a buffer and a (possibly negative) offset into a pointer, checking
+// that there is room for the whole struct from there.
+STATIC byte *struct_get_buffer(mp_obj_struct_t *self, mp_obj_t buf_in, mp_int_t offset, mp_uint_t flags) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, flags);
+    if (offset < 0) {
+        // negative offsets are relative to the end of the buffer
+        offset += bufinfo.len;
+    }
+    if (offset < 0 || (size_t)offset + self->size > bufinfo.len) {
+        mp_raise_ValueError(translate("buffer too small"));
+    }
+    return (byte*)bufinfo.buf + offset;
+}
+
+STATIC mp_obj_t struct_obj_pack(size_t n_args, const mp_obj_t *args) {
+    mp_obj_struct_t *self = MP_OBJ_TO_PTR(args[0]);
+    vstr_t vstr;
+    vstr_init_len(&vstr, self->size);
+    memset(vstr.buf, 0, self->size);
+    struct_pack_fields(self, (byte*)vstr.buf, n_args - 1, &args[1]);
+    return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_obj_pack_obj, 1, MP_OBJ_FUN_ARGS_MAX, struct_obj_pack);
+
+STATIC mp_obj_t struct_obj_pack_into(size_t n_args, const mp_obj_t *args) {
+    mp_obj_struct_t *self = MP_OBJ_TO_PTR(args[0]);
+    byte *p = struct_get_buffer(self, args[1], mp_obj_get_int(args[2]), MP_BUFFER_WRITE);
+    struct_pack_fields(self, p, n_args - 3, &args[3]);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_obj_pack_into_obj, 3, MP_OBJ_FUN_ARGS_MAX, struct_obj_pack_into);
+
+// unpack and unpack_from are the same, as for the module-level functions.
+// If out is given it must be a list with one slot per item, and the values
+// are stored in it instead of in a new tuple.
+STATIC mp_obj_t struct_obj_unpack_from(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_offset, ARG_out };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_offset, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_obj_struct_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    byte *p = struct_get_buffer(self, args[ARG_buffer].u_obj, args[ARG_offset].u_int, MP_BUFFER_READ);
+    mp_obj_t out = args[ARG_out].u_obj;
+    if (out == mp_const_none) {
+        out = mp_obj_new_tuple(self->num_items, NULL);
+        struct_unpack_fields(self, p, ((mp_obj_tuple_t*)MP_OBJ_TO_PTR(out))->items);
+    } else {
+        if (!MP_OBJ_IS_TYPE(out, &mp_type_list)) {
+            mp_raise_TypeError(NULL);
+        }
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_list_get(out, &len, &items);
+        if (len != self->num_items) {
+            mp_raise_ValueError_varg(translate("requested length %d but object has length %d"), self->num_items, len);
+        }
+        struct_unpack_fields(self, p, items);
+    }
+    return out;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(struct_obj_unpack_from_obj, 2, struct_obj_unpack_from);
+
+typedef struct _mp_obj_struct_it_t {
+    mp_obj_base_t base;
+    mp_fun_1_t iternext;
+    mp_obj_struct_t *self;
+    mp_obj_t buffer;
+    size_t offset;
+} mp_obj_struct_it_t;
+
+STATIC mp_obj_t struct_it_iternext(mp_obj_t self_in) {
+    mp_obj_struct_it_t *it = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(it->buffer, &bufinfo, MP_BUFFER_READ);
+    if (it->self->size == 0 || it->offset + it->self->size > bufinfo.len) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+    mp_obj_tuple_t *res = MP_OBJ_TO_PTR(mp_obj_new_tuple(it->self->num_items, NULL));
+    struct_unpack_fields(it->self, (byte*)bufinfo.buf + it->offset, res->items);
+    it->offset += it->self->size;
+    return MP_OBJ_FROM_PTR(res);
+}
+
+STATIC mp_obj_t struct_obj_iter_unpack(mp_obj_t self_in, mp_obj_t buffer) {
+    mp_obj_struct_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_READ);
+    if (self->size == 0 || bufinfo.len % self->size != 0) {
+        mp_raise_ValueError(translate("buffer size must match format"));
+    }
+    mp_obj_struct_it_t *it = m_new_obj(mp_obj_struct_it_t);
+    it->base.type = &mp_type_polymorph_iter;
+    it->iternext = struct_it_iternext;
+    it->self = self;
+    it->buffer = buffer;
+    it->offset = 0;
+    return MP_OBJ_FROM_PTR(it);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(struct_obj_iter_unpack_obj, struct_obj_iter_unpack);
+
+#if MICROPY_PY_BUILTINS_PROPERTY
+STATIC mp_obj_t struct_obj_get_format(mp_obj_t self_in) {
+    mp_obj_struct_t *self = MP_OBJ_TO_PTR(self_in);
+    return self->format;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(struct_obj_get_format_obj, struct_obj_get_format);
+
+STATIC const mp_obj_property_t struct_obj_format_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&struct_obj_get_format_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+STATIC mp_obj_t struct_obj_get_size(mp_obj_t self_in) {
+    mp_obj_struct_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(self->size);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(struct_obj_get_size_obj, struct_obj_get_size);
+
+STATIC const mp_obj_property_t struct_obj_size_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&struct_obj_get_size_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+#endif
+
+STATIC const mp_rom_map_elem_t struct_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_pack), MP_ROM_PTR(&struct_obj_pack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pack_into), MP_ROM_PTR(&struct_obj_pack_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack), MP_ROM_PTR(&struct_obj_unpack_from_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack_from), MP_ROM_PTR(&struct_obj_unpack_from_obj) },
+    { MP_ROM_QSTR(MP_QSTR_iter_unpack), MP_ROM_PTR(&struct_obj_iter_unpack_obj) },
+    #if MICROPY_PY_BUILTINS_PROPERTY
+    { MP_ROM_QSTR(MP_QSTR_format), MP_ROM_PTR(&struct_obj_format_obj) },
+    { MP_ROM_QSTR(MP_QSTR_size), MP_ROM_PTR(&struct_obj_size_obj) },
+    #endif
+};
+
+STATIC MP_DEFINE_CONST_DICT(struct_locals_dict, struct_locals_dict_table);
+
+STATIC const mp_obj_type_t struct_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Struct,
+    .make_new = struct_make_new,
+    .locals_dict = (void*)&struct_locals_dict,
+};
+
 STATIC const mp_rom_map_elem_t mp_module_struct_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_ustruct) },
     { MP_ROM_QSTR(MP_QSTR_calcsize), MP_ROM_PTR(&struct_calcsize_obj) },
@@ -266,6 +512,7 @@ STATIC const mp_rom_map_elem_t mp_module_struct_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_pack_into), MP_ROM_PTR(&struct_pack_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_unpack), MP_ROM_PTR(&struct_unpack_from_obj) },
     { MP_ROM_QSTR(MP_QSTR_unpack_from), MP_ROM_PTR(&struct_unpack_from_obj) },
+    { MP_ROM_QSTR(MP_QSTR_Struct), MP_ROM_PTR(&struct_type) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_struct_globals, mp_module_struct_globals_table);
@@ -150,6 +150,9 @@ typedef struct _thread_entry_args_t {
     mp_obj_dict_t *dict_locals;
     mp_obj_dict_t *dict_globals;
     size_t stack_size;
+    #if MICROPY_ENABLE_PYSTACK
+    uint8_t *pystack;
+    #endif
     mp_obj_t fun;
     size_t n_args;
     size_t n_kw;
@@ -168,15 +171,22 @@ STATIC void *thread_entry(void *args_in) {
     mp_stack_set_limit(args->stack_size);
 
     #if MICROPY_ENABLE_PYSTACK
-    // TODO threading and pystack is not fully supported, for now just make a small stack
-    mp_obj_t mini_pystack[128];
-    mp_pystack_init(mini_pystack, &mini_pystack[128]);
+    // each thread gets its own pystack, which the caller allocated on the heap
+    mp_pystack_init(args->pystack, args->pystack + MICROPY_PY_THREAD_PYSTACK_SIZE);
     #endif
 
     // set locals and globals from the calling context
     mp_locals_set(args->dict_locals);
     mp_globals_set(args->dict_globals);
 
+    #if MICROPY_TRACK_CODE_STATE
+    ts.current_code_state = NULL;
+    #endif
+
+    #if MICROPY_OPT_FAST_RAISE
+    mp_init_stop_iteration();
+    #endif
+
     MP_THREAD_GIL_ENTER();
 
     // signal that we are set up and running
@@ -262,6 +272,11 @@ STATIC mp_obj_t mod_thread_start_new_thread(size_t n_args, const mp_obj_t *args)
     // set the stack size to use
     th_args->stack_size = thread_stack_size;
 
+    #if MICROPY_ENABLE_PYSTACK
+    // allocate the pystack here so that running out of memory raises in the caller
+    th_args->pystack = m_new(uint8_t, MICROPY_PY_THREAD_PYSTACK_SIZE);
+    #endif
+
     // set the function for thread entry
     th_args->fun = args[0];
 
@@ -127,6 +127,100 @@
 #define MICROPY_GC_ALLOC_THRESHOLD (1)
 #endif
 
+// Support incremental marking. When enabled, a collection can be started with
+// gc_collect_incremental_start() and its mark phase split into bounded steps
+// with gc_collect_incremental_step(). The mutator must not run between steps;
+// callers are expected to drive this from idle time and to abort the cycle
+// with gc_collect_incremental_abort() before returning to Python code.
+#ifndef MICROPY_GC_INCREMENTAL
+#define MICROPY_GC_INCREMENTAL (0)
+#endif
+
+// Minimum number of blocks allocated since the last collection before
+// gc_collect_incremental_wanted() reports that a new cycle is worthwhile.
+#ifndef MICROPY_GC_INCREMENTAL_MIN_ALLOC
+#define MICROPY_GC_INCREMENTAL_MIN_ALLOC (64)
+#endif
+
+// Support collecting at idle moments, in mp_hal_delay_ms and gc.idle(), before
+// a failed allocation forces a collection in the middle of other work. A
+// collection is due once the blocks allocated since the last one exceed a
+// budget taken from the heap left free by that collection. The budget shrinks
+// each time a failed allocation collects first and grows back as idle
+// collections keep up.
+#ifndef MICROPY_GC_IDLE_COLLECT
+#define MICROPY_GC_IDLE_COLLECT (0)
+#endif
+
+// Smallest budget, in blocks, between idle collections.
+#ifndef MICROPY_GC_IDLE_COLLECT_MIN_ALLOC
+#define MICROPY_GC_IDLE_COLLECT_MIN_ALLOC (64)
+#endif
+
+// Whether a collection started by gc_alloc leaves most of the sweep for later:
+// each allocation that follows sweeps MICROPY_GC_LAZY_SWEEP_BLOCKS more of the
+// main area, and one that doesn't fit keeps sweeping until it does. Explicit
+// and idle collections still sweep straight away, as do the extra areas.
+#ifndef MICROPY_GC_LAZY_SWEEP
+#define MICROPY_GC_LAZY_SWEEP (0)
+#endif
+
+// Number of blocks each allocation sweeps while a lazy sweep is pending.
+#ifndef MICROPY_GC_LAZY_SWEEP_BLOCKS
+#define MICROPY_GC_LAZY_SWEEP_BLOCKS (256)
+#endif
+
+// Whether the __del__ finalisers of dead objects are queued and run from the
+// scheduler, where they may allocate, instead of inside the collector. A
+// queued object, and what it references, is kept until its finaliser has run.
+// Finalisers that don't fit in the queue run in the sweep as before. Requires
+// MICROPY_ENABLE_SCHEDULER.
+#ifndef MICROPY_GC_DEFERRED_FINALISER
+#define MICROPY_GC_DEFERRED_FINALISER (0)
+#endif
+
+// Number of finalisers that can be waiting to run.
+#ifndef MICROPY_GC_DEFERRED_FINALISER_DEPTH
+#define MICROPY_GC_DEFERRED_FINALISER_DEPTH (16)
+#endif
+
+// Whether the heap can span more than one area of memory. Areas other than the
+// one given to gc_init() are added with gc_add(), for example external PSRAM
+// next to internal SRAM.
+#ifndef MICROPY_GC_SPLIT_HEAP
+#define MICROPY_GC_SPLIT_HEAP (0)
+#endif
+
+// Allocations of at least this many bytes are placed in the areas added with
+// gc_add() before the main area. Smaller ones only go there once a collection
+// has failed to make room for them in the main area.
+#ifndef MICROPY_GC_SPLIT_HEAP_LARGE_ALLOC
+#define MICROPY_GC_SPLIT_HEAP_LARGE_ALLOC (1024)
+#endif
+
+// Whether to support recording heap allocations per bytecode location
+// (function name + source line), for finding code that churns the heap
+#ifndef MICROPY_GC_ALLOC_PROFILE
+#define MICROPY_GC_ALLOC_PROFILE (0)
+#endif
+
+// Number of distinct allocation sites tracked by the allocation profiler
+#ifndef MICROPY_GC_ALLOC_PROFILE_ENTRIES
+#define MICROPY_GC_ALLOC_PROFILE_ENTRIES (16)
+#endif
+
+// Whether to report allocations, frees and collections to the port's
+// gc_trace_event(), so heap activity can be followed on a running device
+#ifndef MICROPY_GC_TRACE
+#define MICROPY_GC_TRACE (0)
+#endif
+
+// Whether to keep a pointer to the bytecode each thread is executing in
+// MP_STATE_THREAD(current_code_state), so profilers can attribute work to it
+#ifndef MICROPY_TRACK_CODE_STATE
+#define MICROPY_TRACK_CODE_STATE (MICROPY_GC_ALLOC_PROFILE)
+#endif
+
 // Number of bytes to allocate initially when creating new chunks to store
 // interned string data.  Smaller numbers lead to more chunks being needed
 // and more wastage at the end of the chunk.  Larger numbers lead to wasted
@@ -221,6 +315,13 @@
 #define MICROPY_QSTR_BYTES_IN_HASH (2)
 #endif
 
+// Whether to look up qstrs through hash indexes rather than by scanning each
+// pool: a perfect hash (generated by makeqstrdata.py) for the ROM pools, and
+// a small open-addressed table alongside each dynamically allocated pool
+#ifndef MICROPY_QSTR_HASH_INDEX
+#define MICROPY_QSTR_HASH_INDEX (0)
+#endif
+
 // Avoid using C stack when making Python function calls. C stack still
 // may be used if there's no free heap.
 #ifndef MICROPY_STACKLESS
@@ -265,6 +366,15 @@
 #define MICROPY_PERSISTENT_CODE_SAVE (0)
 #endif
 
+// Whether .mpy files that the port can hand over whole (see mp_import_map_file)
+// are loaded in place: their str/bytes constants share that data instead of
+// each being copied.  The bytecode itself is still copied as it is patched on
+// load.
+// Requires MICROPY_OPT_STR_SLICE.
+#ifndef MICROPY_PERSISTENT_CODE_LOAD_XIP
+#define MICROPY_PERSISTENT_CODE_LOAD_XIP (0)
+#endif
+
 // Whether generated code can persist independently of the VM/runtime instance
 // This is enabled automatically when needed by other features
 #ifndef MICROPY_PERSISTENT_CODE
@@ -301,6 +411,18 @@
 #define MICROPY_EMIT_INLINE_THUMB_FLOAT (1)
 #endif
 
+// Whether to enable the ARMv7E-M DSP extension (SIMD, saturating and
+// multiply-accumulate instructions) in the Thumb2 inline assembler.  By
+// default it follows what the compiler says about the target, since only
+// Cortex-M4 and M7 class cores have these instructions.
+#ifndef MICROPY_EMIT_INLINE_THUMB_DSP
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+#define MICROPY_EMIT_INLINE_THUMB_DSP (MICROPY_EMIT_INLINE_THUMB_ARMV7M)
+#else
+#define MICROPY_EMIT_INLINE_THUMB_DSP (0)
+#endif
+#endif
+
 // Whether to emit ARM native code
 #ifndef MICROPY_EMIT_ARM
 #define MICROPY_EMIT_ARM (0)
@@ -316,8 +438,13 @@
 #define MICROPY_EMIT_INLINE_XTENSA (0)
 #endif
 
+// Whether to emit Xtensa-Windowed native code (eg ESP32-S2)
+#ifndef MICROPY_EMIT_XTENSAWIN
+#define MICROPY_EMIT_XTENSAWIN (0)
+#endif
+
 // Convenience definition for whether any native emitter is enabled
-#define MICROPY_EMIT_NATIVE (MICROPY_EMIT_X64 || MICROPY_EMIT_X86 || MICROPY_EMIT_THUMB || MICROPY_EMIT_ARM || MICROPY_EMIT_XTENSA)
+#define MICROPY_EMIT_NATIVE (MICROPY_EMIT_X64 || MICROPY_EMIT_X86 || MICROPY_EMIT_THUMB || MICROPY_EMIT_ARM || MICROPY_EMIT_XTENSA || MICROPY_EMIT_XTENSAWIN)
 
 // Convenience definition for whether any inline assembler emitter is enabled
 #define MICROPY_EMIT_INLINE_ASM (MICROPY_EMIT_INLINE_THUMB || MICROPY_EMIT_INLINE_XTENSA)
@@ -359,6 +486,18 @@
 #define MICROPY_COMP_CONST (1)
 #endif
 
+// Whether const() also accepts str and bytes values, and constant str or
+// bytes concatenation like "a" + B is folded
+#ifndef MICROPY_COMP_CONST_STR
+#define MICROPY_COMP_CONST_STR (0)
+#endif
+
+// Whether "from module import NAME" can bring in consts of another module,
+// registered in MP_STATE_VM(comp_const_modules) (eg by mpy-cross -c)
+#ifndef MICROPY_COMP_CONST_IMPORT
+#define MICROPY_COMP_CONST_IMPORT (0)
+#endif
+
 // Whether to enable optimisation of: a, b = c, d
 // Costs 124 bytes (Thumb2)
 #ifndef MICROPY_COMP_DOUBLE_TUPLE_ASSIGN
@@ -371,6 +510,12 @@
 #define MICROPY_COMP_TRIPLE_TUPLE_ASSIGN (0)
 #endif
 
+// Whether to skip the code that follows a return, raise, break or continue
+// in the same block, which can never run
+#ifndef MICROPY_COMP_UNREACHABLE_CODE
+#define MICROPY_COMP_UNREACHABLE_CODE (1)
+#endif
+
 // Whether to enable optimisation of: return a if b else c
 // Costs about 80 bytes (Thumb2) and saves 2 bytes of bytecode for each use
 #ifndef MICROPY_COMP_RETURN_IF_EXPR
@@ -382,6 +527,21 @@
 #define MICROPY_COMP_FSTRING_LITERAL (1)
 #endif
 
+// Whether file input (modules, scripts and exec) is parsed and compiled a few
+// top-level statements at a time, freeing their parse tree before parsing the
+// next ones, so that compiling needs memory for the parse tree of the largest
+// statement rather than that of the whole file.  All statements are compiled
+// before the first one runs.  Not supported with doc strings.
+#ifndef MICROPY_COMP_INCREMENTAL
+#define MICROPY_COMP_INCREMENTAL (0)
+#endif
+
+// Size in bytes of parse tree after which the statements parsed so far are
+// compiled, with MICROPY_COMP_INCREMENTAL.  Larger groups have less overhead.
+#ifndef MICROPY_COMP_INCREMENTAL_TREE_SIZE
+#define MICROPY_COMP_INCREMENTAL_TREE_SIZE (2048)
+#endif
+
 /*****************************************************************************/
 /* Internal debugging stuff                                                  */
 
@@ -413,6 +573,61 @@
 #define MICROPY_OPT_COMPUTED_GOTO (0)
 #endif
 
+// Whether the bytecode compiler fuses a comparison followed by a conditional
+// jump into a single opcode, which also skips creating the bool result.  Saved
+// .mpy files that may use the fused opcodes are marked with a feature flag and
+// only load on a VM that has them.
+#ifndef MICROPY_OPT_FUSED_COMPARE_JUMP
+#define MICROPY_OPT_FUSED_COMPARE_JUMP (0)
+#endif
+
+// Whether the bytecode emitter does simple peephole optimisations: a jump to
+// an unconditional jump goes straight to its destination, and storing a local
+// then loading it again becomes a DUP_TOP before the store.  No new opcodes
+// are used, so .mpy files built with it load on any VM.
+#ifndef MICROPY_OPT_BC_PEEPHOLE
+#define MICROPY_OPT_BC_PEEPHOLE (0)
+#endif
+
+// Whether the VM rewrites binary operations and subscripts that it sees
+// executed on small ints with specialised opcodes that handle them inline.
+// Requires bytecode to be in RAM, which includes frozen bytecode.
+#ifndef MICROPY_OPT_QUICKEN_SMALL_INT_OPS
+#define MICROPY_OPT_QUICKEN_SMALL_INT_OPS (0)
+#endif
+
+// Whether raising the most frequent exceptions avoids allocating: StopIteration
+// without args (a bare "raise StopIteration", an exhausted generator, next() on
+// an exhausted iterator) reuses one instance per thread together with its
+// traceback storage, and OSError(EAGAIN) and OSError(ETIMEDOUT) share constant
+// args tuples.  Handlers that keep such a StopIteration then all see the same
+// object, with the traceback of the latest raise.
+#ifndef MICROPY_OPT_FAST_RAISE
+#define MICROPY_OPT_FAST_RAISE (0)
+#endif
+
+// Whether FOR_ITER steps range, list, tuple and bytes iterators inline, and
+// resumes generators directly, instead of going through the type's iternext
+#ifndef MICROPY_OPT_FAST_FOR_ITER
+#define MICROPY_OPT_FAST_FOR_ITER (0)
+#endif
+
+// Whether setting up a call given exactly its positional args skips the
+// generic handling of defaults, *args, **kwargs and keyword-only args
+#ifndef MICROPY_OPT_FAST_CALL_SETUP
+#define MICROPY_OPT_FAST_CALL_SETUP (0)
+#endif
+
+// Whether the keys of a **kwargs mapping that don't already name a qstr are
+// passed to the callee as str objects instead of being interned.  Interned
+// names are never freed, so without this every distinct key ever passed with
+// ** (such as from parsed JSON) stays allocated until soft reset.  A str key
+// can't name a positional or keyword-only argument, so it can only end up in
+// the callee's own **kwargs dict.
+#ifndef MICROPY_OPT_KWARGS_NO_INTERN
+#define MICROPY_OPT_KWARGS_NO_INTERN (0)
+#endif
+
 // Whether to cache result of map lookups in LOAD_NAME, LOAD_GLOBAL, LOAD_ATTR,
 // STORE_ATTR bytecodes.  Uses 1 byte extra RAM for each of these opcodes and
 // uses a bit of extra code ROM, but greatly improves lookup speed.
@@ -420,12 +635,169 @@
 #define MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE (0)
 #endif
 
+// Whether to cache the result of looking up an attribute in the class of an
+// instance, keyed on the type and attribute name.  Saves walking the MRO on
+// every method call.  Any store to a class attribute invalidates the cache.
+#ifndef MICROPY_OPT_TYPE_ATTR_CACHE
+#define MICROPY_OPT_TYPE_ATTR_CACHE (0)
+#endif
+
+// Number of entries in the type attribute cache, must be a power of 2
+#ifndef MICROPY_OPT_TYPE_ATTR_CACHE_SIZE
+#define MICROPY_OPT_TYPE_ATTR_CACHE_SIZE (32)
+#endif
+
+// Whether loading a method without calling it, such as to pass it as a
+// callback, hands out a recently made bound method for the same object and
+// function instead of allocating a new one.  The cache is emptied by every
+// collection so it never keeps an object alive.
+#ifndef MICROPY_OPT_BOUND_METH_CACHE
+#define MICROPY_OPT_BOUND_METH_CACHE (0)
+#endif
+
+// Number of entries in the bound method cache, must be a power of 2
+#ifndef MICROPY_OPT_BOUND_METH_CACHE_SIZE
+#define MICROPY_OPT_BOUND_METH_CACHE_SIZE (8)
+#endif
+
+// Whether large hash maps switch to a compact layout: the entries are kept
+// densely, in the order they were added, and are found through a separate
+// index of 16-bit slots that is never more than 2/3 full.  Probing the index
+// doesn't touch the entries, so lookups in big dicts miss the cache less and
+// no longer slow down as the table fills.
+#ifndef MICROPY_OPT_MAP_COMPACT
+#define MICROPY_OPT_MAP_COMPACT (0)
+#endif
+
+// Number of entries from which a map uses the compact layout
+#ifndef MICROPY_OPT_MAP_COMPACT_MIN_ALLOC
+#define MICROPY_OPT_MAP_COMPACT_MIN_ALLOC (64)
+#endif
+
+// Whether to remember where a key was last found in an ordered map, such as
+// the ROM globals table of a native module or the locals of a native type,
+// keyed on the map and the key.  A hit is only used if the key is still at
+// that position, so this needs no invalidation, and it saves the linear scan
+// of ordered maps on hot paths like board.D13.
+#ifndef MICROPY_OPT_MAP_LOOKUP_CACHE
+#define MICROPY_OPT_MAP_LOOKUP_CACHE (0)
+#endif
+
+// Number of entries in the map lookup cache, must be a power of 2
+#ifndef MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE
+#define MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE (128)
+#endif
+
+// Whether to remember where a global or builtin name was found, keyed on the
+// globals dict and the name, so that loading a builtin doesn't first have to
+// miss in the globals dict.  Adding or removing a name in any module's globals
+// or in the builtins invalidates the cache.
+#ifndef MICROPY_OPT_GLOBAL_LOOKUP_CACHE
+#define MICROPY_OPT_GLOBAL_LOOKUP_CACHE (0)
+#endif
+
+// Number of entries in the global lookup cache, must be a power of 2
+#ifndef MICROPY_OPT_GLOBAL_LOOKUP_CACHE_SIZE
+#define MICROPY_OPT_GLOBAL_LOOKUP_CACHE_SIZE (32)
+#endif
+
+// Whether list.sort is a stable timsort: it finds runs that are already in
+// order and merges them, so sorted or reversed input takes n - 1 comparisons,
+// and a key function is called once per item rather than per comparison.  It
+// needs a temporary buffer of 1.5 words per item, or 3 with a key function,
+// and falls back to the in-place quicksort if that can't be allocated.
+#ifndef MICROPY_OPT_LIST_TIMSORT
+#define MICROPY_OPT_LIST_TIMSORT (0)
+#endif
+
+// Whether ints are converted to decimal two digits at a time using a 200 byte
+// table of digit pairs, rather than one division per digit, and float digits
+// are taken from the mantissa as a fixed-point integer rather than with a
+// float multiply and subtract per digit.
+#ifndef MICROPY_OPT_FAST_NUM_FORMAT
+#define MICROPY_OPT_FAST_NUM_FORMAT (0)
+#endif
+
+// Whether decimal ints are parsed 8 digits at a time where the string allows,
+// and whether float literals whose digits fit exactly in the mantissa, with a
+// small exponent, are converted with a single multiply or divide by an exact
+// power of 10 (so they are correctly rounded) rather than by calling pow().
+#ifndef MICROPY_OPT_FAST_NUM_PARSE
+#define MICROPY_OPT_FAST_NUM_PARSE (0)
+#endif
+
+// Whether the lexer takes its input a buffer at a time from readers that can
+// provide it, and scans runs of identifier characters, digits, spaces and
+// comment text straight from that buffer instead of one character at a time.
+#ifndef MICROPY_OPT_LEXER_FAST_SCAN
+#define MICROPY_OPT_LEXER_FAST_SCAN (0)
+#endif
+
 // Whether to use fast versions of bitwise operations (and, or, xor) when the
 // arguments are both positive.  Increases Thumb2 code size by about 250 bytes.
 #ifndef MICROPY_OPT_MPZ_BITWISE
 #define MICROPY_OPT_MPZ_BITWISE (0)
 #endif
 
+// Whether to multiply large mpz integers using Karatsuba's method, which
+// turns one multiplication into three of half the size.
+#ifndef MICROPY_OPT_MPZ_KARATSUBA
+#define MICROPY_OPT_MPZ_KARATSUBA (0)
+#endif
+
+// Number of digits in both operands above which Karatsuba is used, must be at least 4
+#ifndef MICROPY_OPT_MPZ_KARATSUBA_THRESHOLD
+#define MICROPY_OPT_MPZ_KARATSUBA_THRESHOLD (32)
+#endif
+
+// Whether pow(a, b, m) with an odd modulus uses Montgomery multiplication,
+// which avoids a division for every step of the exponentiation.
+#ifndef MICROPY_OPT_MPZ_MONTGOMERY
+#define MICROPY_OPT_MPZ_MONTGOMERY (0)
+#endif
+
+// Number of digits a modulus must have to use Montgomery multiplication
+#ifndef MICROPY_OPT_MPZ_MONTGOMERY_MIN_DIG
+#define MICROPY_OPT_MPZ_MONTGOMERY_MIN_DIG (2)
+#endif
+
+// Whether substring search (str.find, in, split, replace, count) uses memchr
+// to find candidates and a Horspool skip table for long haystacks, instead of
+// comparing the needle at every position.  Uses 256 bytes of stack for the table.
+#ifndef MICROPY_OPT_FAST_SUBBYTES
+#define MICROPY_OPT_FAST_SUBBYTES (0)
+#endif
+
+// Haystack length from which the Horspool search is used
+#ifndef MICROPY_OPT_FAST_SUBBYTES_HORSPOOL_MIN
+#define MICROPY_OPT_FAST_SUBBYTES_HORSPOOL_MIN (64)
+#endif
+
+// Whether str/bytes slicing, split, partition and strip return objects that
+// share the data of the original instead of copying it.  The result is one
+// allocation instead of two, but keeps the original alive.  Needs the GC.
+#ifndef MICROPY_OPT_STR_SLICE
+#define MICROPY_OPT_STR_SLICE (0)
+#endif
+
+// Shortest result that shares data; anything shorter is copied
+#ifndef MICROPY_OPT_STR_SLICE_MIN_LEN
+#define MICROPY_OPT_STR_SLICE_MIN_LEN (8)
+#endif
+
+// Whether vstr buffers (used by io.StringIO, print to a str, json.dumps, etc)
+// grow geometrically, and s += t on a long str/bytes leaves room to append in
+// place, so that building a long string piece by piece is not quadratic.
+// The s += t part needs MICROPY_OPT_STR_SLICE.
+#ifndef MICROPY_OPT_STR_BUILDER
+#define MICROPY_OPT_STR_BUILDER (0)
+#endif
+
+// Shortest result of s += t that is built with room to spare
+#ifndef MICROPY_OPT_STR_BUILDER_MIN_LEN
+#define MICROPY_OPT_STR_BUILDER_MIN_LEN (128)
+#endif
+
 /*****************************************************************************/
 /* Python internal features                                                  */
 
@@ -446,6 +818,12 @@
 #define MICROPY_READER_VFS (0)
 #endif
 
+// Number of bytes the POSIX and VFS file readers fetch at a time.  A multiple
+// of the filesystem block size (usually 512) keeps the reads block aligned.
+#ifndef MICROPY_READER_BUF_SIZE
+#define MICROPY_READER_BUF_SIZE (24)
+#endif
+
 // Number of VFS mounts to persist across soft-reset.
 #ifndef MICROPY_FATFS_NUM_PERSISTENT
 #define MICROPY_FATFS_NUM_PERSISTENT (0)
@@ -613,6 +991,20 @@ typedef double mp_float_t;
 #define MICROPY_PY_BUILTINS_FLOAT (0)
 #endif
 
+// Whether viper code supports the "float" type, which keeps float values
+// unboxed in machine words.  It needs an mp_float_t to fit in an mp_uint_t,
+// so ports with double precision floats on a 64-bit machine must enable it.
+#ifndef MICROPY_EMIT_NATIVE_FLOAT
+#define MICROPY_EMIT_NATIVE_FLOAT (MICROPY_EMIT_NATIVE && MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT)
+#endif
+
+// Whether viper code has the memcpy/memmove/memset, bswap16/bswap32 and
+// loadN_unaligned/storeN_unaligned intrinsics, which call C helpers directly
+// with machine word arguments.
+#ifndef MICROPY_EMIT_NATIVE_VIPER_INTRINSICS
+#define MICROPY_EMIT_NATIVE_VIPER_INTRINSICS (MICROPY_EMIT_NATIVE)
+#endif
+
 #ifndef MICROPY_PY_BUILTINS_COMPLEX
 #define MICROPY_PY_BUILTINS_COMPLEX (MICROPY_PY_BUILTINS_FLOAT)
 #endif
@@ -671,11 +1063,37 @@ typedef double mp_float_t;
 #define MICROPY_MODULE_FROZEN_MPY (0)
 #endif
 
+// Whether frozen .mpy files are stored deflate-compressed (by mpy-tool.py
+// --compress) and inflated into the heap when imported, trading RAM and
+// import time for flash.  Requires MICROPY_PERSISTENT_CODE_LOAD and lib/uzlib.
+#ifndef MICROPY_MODULE_FROZEN_MPY_COMPRESSED
+#define MICROPY_MODULE_FROZEN_MPY_COMPRESSED (0)
+#endif
+
 // Convenience macro for whether frozen modules are supported
 #ifndef MICROPY_MODULE_FROZEN
 #define MICROPY_MODULE_FROZEN (MICROPY_MODULE_FROZEN_STR || MICROPY_MODULE_FROZEN_MPY)
 #endif
 
+// Whether to find frozen modules through the perfect hash index generated by
+// tools/frozenindex.py, rather than by scanning the list of names
+#ifndef MICROPY_MODULE_FROZEN_INDEX
+#define MICROPY_MODULE_FROZEN_INDEX (0)
+#endif
+
+// Whether importing a .py file caches its compiled bytecode as a .mpy file in
+// a MICROPY_MODULE_MPY_CACHE_DIR directory next to it, and later imports load
+// the cache instead while the source size and mtime are unchanged.  Requires
+// MICROPY_PERSISTENT_CODE_LOAD and MICROPY_PERSISTENT_CODE_SAVE.
+#ifndef MICROPY_MODULE_MPY_CACHE
+#define MICROPY_MODULE_MPY_CACHE (0)
+#endif
+
+// Name of the directory that holds the .mpy cache of the .py files next to it
+#ifndef MICROPY_MODULE_MPY_CACHE_DIR
+#define MICROPY_MODULE_MPY_CACHE_DIR ".mpycache"
+#endif
+
 // Whether you can override builtins in the builtins module
 #ifndef MICROPY_CAN_OVERRIDE_BUILTINS
 #define MICROPY_CAN_OVERRIDE_BUILTINS (0)
@@ -705,9 +1123,9 @@ typedef double mp_float_t;
 #define MICROPY_ENABLE_SCHEDULER (0)
 #endif
 
-// Maximum number of entries in the scheduler
+// Maximum number of entries in the scheduler's queue
 #ifndef MICROPY_SCHEDULER_DEPTH
-#define MICROPY_SCHEDULER_DEPTH (4)
+#define MICROPY_SCHEDULER_DEPTH (16)
 #endif
 
 // Support for generic VFS sub-system
@@ -725,6 +1143,18 @@ typedef double mp_float_t;
 #define MICROPY_VFS_FAT (0)
 #endif
 
+// Size of the buffer that files opened for reading on a VFS FAT use to read
+// ahead of small reads such as readline(). 0 means no buffer.
+#ifndef MICROPY_VFS_FAT_READ_AHEAD_SIZE
+#define MICROPY_VFS_FAT_READ_AHEAD_SIZE (0)
+#endif
+
+// Support for RAMBlockDevice, a block device held in RAM that VfsFat can be
+// mounted on for scratch files
+#ifndef MICROPY_VFS_RAMBLOCKDEV
+#define MICROPY_VFS_RAMBLOCKDEV (0)
+#endif
+
 /*****************************************************************************/
 /* Fine control over Python builtins, classes, modules, etc                  */
 
@@ -754,6 +1184,12 @@ typedef double mp_float_t;
 #define MICROPY_PY_DELATTR_SETATTR (0)
 #endif
 
+// Whether a class may define __slots__, giving its instances a fixed table of
+// attributes stored in the instance itself instead of a growable map
+#ifndef MICROPY_PY_SLOTS
+#define MICROPY_PY_SLOTS (0)
+#endif
+
 // Support for async/await/async for/async with
 #ifndef MICROPY_PY_ASYNC_AWAIT
 #define MICROPY_PY_ASYNC_AWAIT (1)
@@ -808,6 +1244,11 @@ typedef double mp_float_t;
 #define MICROPY_PY_BUILTINS_MEMORYVIEW (0)
 #endif
 
+// Whether to support memoryview.cast() and memoryview.rebind()
+#ifndef MICROPY_PY_BUILTINS_MEMORYVIEW_CAST
+#define MICROPY_PY_BUILTINS_MEMORYVIEW_CAST (0)
+#endif
+
 // Whether to support set object
 #ifndef MICROPY_PY_BUILTINS_SET
 #define MICROPY_PY_BUILTINS_SET (1)
@@ -976,6 +1417,12 @@ typedef double mp_float_t;
 #define MICROPY_PY_ARRAY_SLICE_ASSIGN (0)
 #endif
 
+// Whether to support the in-place elementwise methods of array and bytearray
+// (fill, ixor, iand, ior, add, scale, sum, min and max)
+#ifndef MICROPY_PY_ARRAY_ELEMENTWISE_OPS
+#define MICROPY_PY_ARRAY_ELEMENTWISE_OPS (0)
+#endif
+
 // Whether to support nonstandard typecodes "O", "P" and "S"
 // in array and struct modules.
 #ifndef MICROPY_NONSTANDARD_TYPECODES
@@ -1008,6 +1455,11 @@ typedef double mp_float_t;
 #define MICROPY_PY_COLLECTIONS_NAMEDTUPLE__ASDICT (0)
 #endif
 
+// Whether to provide the _make classmethod for namedtuple
+#ifndef MICROPY_PY_COLLECTIONS_NAMEDTUPLE__MAKE
+#define MICROPY_PY_COLLECTIONS_NAMEDTUPLE__MAKE (0)
+#endif
+
 // Whether to provide "math" module
 #ifndef MICROPY_PY_MATH
 #define MICROPY_PY_MATH (1)
@@ -1164,6 +1616,18 @@ typedef double mp_float_t;
 #define MICROPY_PY_THREAD_GIL_VM_DIVISOR (32)
 #endif
 
+// Whether ports release the GIL while a thread blocks on a sleep or I/O wait
+// that doesn't touch the VM, so other threads can run in the meantime
+#ifndef MICROPY_PY_THREAD_GIL_RELEASE_IO
+#define MICROPY_PY_THREAD_GIL_RELEASE_IO (MICROPY_PY_THREAD_GIL)
+#endif
+
+// Size in bytes of the pystack given to each new thread, when
+// MICROPY_ENABLE_PYSTACK is enabled
+#ifndef MICROPY_PY_THREAD_PYSTACK_SIZE
+#define MICROPY_PY_THREAD_PYSTACK_SIZE (1024)
+#endif
+
 // Extended modules
 
 #ifndef MICROPY_PY_UCTYPES
@@ -1174,10 +1638,21 @@ typedef double mp_float_t;
 #define MICROPY_PY_UZLIB (0)
 #endif
 
+// Whether uzlib provides compress and CompressIO as well as decompression
+#ifndef MICROPY_PY_UZLIB_COMPRESS
+#define MICROPY_PY_UZLIB_COMPRESS (0)
+#endif
+
 #ifndef MICROPY_PY_UJSON
 #define MICROPY_PY_UJSON (0)
 #endif
 
+// Whether to provide ujson.iterload, which walks a document as it is read
+// and yields its values one at a time instead of building it in memory
+#ifndef MICROPY_PY_UJSON_ITERLOAD
+#define MICROPY_PY_UJSON_ITERLOAD (0)
+#endif
+
 #ifndef CIRCUITPY_ULAB
 #define CIRCUITPY_ULAB (0)
 #endif
@@ -1198,6 +1673,18 @@ typedef double mp_float_t;
 #define MICROPY_PY_URE_SUB (0)
 #endif
 
+// Whether ure.compile accepts ure.LINEAR, to match with the pike VM, which
+// takes linear time on any pattern, instead of by backtracking
+#ifndef MICROPY_PY_URE_PIKEVM
+#define MICROPY_PY_URE_PIKEVM (0)
+#endif
+
+// Number of compiled patterns that ure.match/search/sub keep for reuse, most
+// recently used first (0 to recompile the pattern every call)
+#ifndef MICROPY_PY_URE_CACHE_SIZE
+#define MICROPY_PY_URE_CACHE_SIZE (0)
+#endif
+
 #ifndef MICROPY_PY_UHEAPQ
 #define MICROPY_PY_UHEAPQ (0)
 #endif
@@ -1207,6 +1694,11 @@ typedef double mp_float_t;
 #define MICROPY_PY_UTIMEQ (0)
 #endif
 
+// Task and TaskQueue for the uasyncio package (needs MICROPY_PY_ASYNC_AWAIT)
+#ifndef MICROPY_PY_UASYNCIO
+#define MICROPY_PY_UASYNCIO (0)
+#endif
+
 #ifndef MICROPY_PY_UHASHLIB
 #define MICROPY_PY_UHASHLIB (0)
 #endif
@@ -1219,6 +1711,16 @@ typedef double mp_float_t;
 #define MICROPY_PY_UHASHLIB_SHA256 (1)
 #endif
 
+// Whether uhashlib.sha256 and uhashlib.sha1 use a hashing engine provided by
+// the port, through the functions declared in extmod/moduhashlib.h
+#ifndef MICROPY_PY_UHASHLIB_SHA256_HW
+#define MICROPY_PY_UHASHLIB_SHA256_HW (0)
+#endif
+
+#ifndef MICROPY_PY_UHASHLIB_SHA1_HW
+#define MICROPY_PY_UHASHLIB_SHA1_HW (0)
+#endif
+
 #ifndef MICROPY_PY_UBINASCII
 #define MICROPY_PY_UBINASCII (0)
 #endif
@@ -1260,6 +1762,12 @@ typedef double mp_float_t;
 #define MICROPY_PY_USSL_FINALISER (0)
 #endif
 
+// Number of client TLS sessions (mbedtls only) kept for resumption, keyed by
+// server_hostname; 0 disables the cache
+#ifndef MICROPY_PY_USSL_SESSION_CACHE
+#define MICROPY_PY_USSL_SESSION_CACHE (2)
+#endif
+
 #ifndef MICROPY_PY_WEBSOCKET
 #define MICROPY_PY_WEBSOCKET (0)
 #endif
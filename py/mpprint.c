@@ -125,6 +125,46 @@ int mp_print_strn(const mp_print_t *print, const char *str, size_t len, int flag
 // print the prefix of a non-base-10 number, so we don't need code for this.
 #define SUPPORT_INT_BASE_PREFIX (0)
 
+#if MICROPY_OPT_FAST_NUM_FORMAT
+static const char mp_dec_pairs[200] =
+    "00010203040506070809101112131415161718192021222324"
+    "25262728293031323334353637383940414243444546474849"
+    "50515253545556575859606162636465666768697071727374"
+    "75767778798081828384858687888990919293949596979899";
+
+// Write x in decimal into the characters ending just before end, and return a
+// pointer to the first digit.  Digits are produced in pairs, using 32-bit
+// arithmetic once the value fits.  Zero writes no digits at all, so callers
+// that want a "0" must add it themselves.
+char *mp_format_dec(char *end, uint64_t x) {
+    while (x > 0xffffffff) {
+        uint64_t q = x / 100000000;
+        uint32_t r = (uint32_t)(x - q * 100000000);
+        x = q;
+        for (int i = 0; i < 4; ++i) {
+            const char *p = &mp_dec_pairs[(r % 100) * 2];
+            r /= 100;
+            *(--end) = p[1];
+            *(--end) = p[0];
+        }
+    }
+    uint32_t v = (uint32_t)x;
+    while (v >= 100) {
+        const char *p = &mp_dec_pairs[(v % 100) * 2];
+        v /= 100;
+        *(--end) = p[1];
+        *(--end) = p[0];
+    }
+    if (v >= 10) {
+        *(--end) = mp_dec_pairs[v * 2 + 1];
+        *(--end) = mp_dec_pairs[v * 2];
+    } else if (v != 0) {
+        *(--end) = '0' + v;
+    }
+    return end;
+}
+#endif
+
 // This function is used exclusively by mp_vprintf to format ints.
 // It needs to be a separate function to mp_print_mp_int, since converting to a mp_int looses the MSB.
 STATIC int mp_print_int(const mp_print_t *print, mp_uint_t x, int sgn, int base, int base_char, int flags, char fill, int width) {
@@ -145,6 +185,10 @@ STATIC int mp_print_int(const mp_print_t *print, mp_uint_t x, int sgn, int base,
 
     if (x == 0) {
         *(--b) = '0';
+    #if MICROPY_OPT_FAST_NUM_FORMAT
+    } else if (base == 10) {
+        b = mp_format_dec(b, x);
+    #endif
     } else {
         do {
             int c = x % base;
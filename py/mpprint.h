@@ -66,6 +66,10 @@ int mp_print_strn(const mp_print_t *print, const char *str, size_t len, int flag
 int mp_print_float(const mp_print_t *print, mp_float_t f, char fmt, int flags, char fill, int width, int prec);
 #endif
 
+#if MICROPY_OPT_FAST_NUM_FORMAT
+char *mp_format_dec(char *end, uint64_t x);
+#endif
+
 int mp_printf(const mp_print_t *print, const char *fmt, ...);
 #ifdef va_start
 int mp_vprintf(const mp_print_t *print, const char *fmt, va_list args);
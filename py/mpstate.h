@@ -55,17 +55,57 @@ extern mp_dynamic_compiler_t mp_dynamic_compiler;
 #define MP_SCHED_LOCKED (-1)
 #define MP_SCHED_PENDING (0) // 0 so it's a quick check in the VM
 
+// Flags for mp_sched_schedule_ex
+#define MP_SCHED_FLAG_URGENT (0x01) // run before callbacks that are already pending
+#define MP_SCHED_FLAG_COALESCE (0x02) // don't queue it again if it's already pending
+
 typedef struct _mp_sched_item_t {
     mp_obj_t func;
     mp_obj_t arg;
 } mp_sched_item_t;
 
-// This structure hold information about the memory allocation system.
-typedef struct _mp_state_mem_t {
-    #if MICROPY_MEM_STATS
-    size_t total_bytes_allocated;
-    size_t current_bytes_allocated;
-    size_t peak_bytes_allocated;
+#if MICROPY_OPT_TYPE_ATTR_CACHE
+// The result of looking up attr in the class of an instance of type.
+typedef struct _mp_type_attr_cache_entry_t {
+    const mp_obj_type_t *type;
+    mp_obj_t member;
+    qstr attr;
+    // Whether member is a method which must be bound to the instance.
+    bool bind;
+    size_t version;
+} mp_type_attr_cache_entry_t;
+#endif
+
+#if MICROPY_OPT_GLOBAL_LOOKUP_CACHE
+// Where qst was found when it was loaded with map as the globals: either in
+// map itself or in the builtins.
+typedef struct _mp_global_lookup_cache_entry_t {
+    const mp_map_t *map;
+    mp_map_elem_t *elem;
+    qstr qst;
+    size_t version;
+} mp_global_lookup_cache_entry_t;
+#endif
+
+#if MICROPY_GC_ALLOC_PROFILE
+// Allocations recorded against one bytecode location.
+typedef struct _mp_gc_profile_entry_t {
+    qstr block_name;
+    qstr source_file;
+    size_t line;
+    size_t count;
+    size_t bytes;
+} mp_gc_profile_entry_t;
+#endif
+
+// This structure holds the tables and the pool of one area of the heap.
+typedef struct _mp_state_mem_area_t {
+    #if MICROPY_GC_SPLIT_HEAP
+    // Areas added with gc_add(), in the order they were added.
+    struct _mp_state_mem_area_t *next;
+    // The lowest ATB that may have a free block. The main area keeps a finer
+    // grained index per allocation size in mp_state_mem_t instead.
+    size_t gc_first_free_atb_index;
     #endif
 
     byte *gc_alloc_table_start;
@@ -76,10 +116,48 @@ typedef struct _mp_state_mem_t {
     byte *gc_pool_start;
     byte *gc_pool_end;
 
+    // Marked heads whose children were dropped from the full mark stack all
+    // lie in blocks gc_overflow_lo up to gc_overflow_hi, which is empty when
+    // gc_overflow_lo >= gc_overflow_hi.
+    size_t gc_overflow_lo;
+    size_t gc_overflow_hi;
+} mp_state_mem_area_t;
+
+// This structure hold information about the memory allocation system.
+typedef struct _mp_state_mem_t {
+    #if MICROPY_MEM_STATS
+    size_t total_bytes_allocated;
+    size_t current_bytes_allocated;
+    size_t peak_bytes_allocated;
+    #endif
+
+    // The area given to gc_init(). Long lived objects are only placed here.
+    mp_state_mem_area_t area;
+
     void *gc_lowest_long_lived_ptr;
 
+    // Set when some area has a non-empty overflow window.
     int gc_stack_overflow;
-    size_t gc_stack[MICROPY_ALLOC_GC_STACK_SIZE];
+    // Number of blocks dropped from the full mark stack, for mem_info.
+    size_t gc_stack_overflow_count;
+    // Heads of blocks that are marked but whose children are not yet.
+    void *gc_stack[MICROPY_ALLOC_GC_STACK_SIZE];
+    // Heads that don't fit on gc_stack spill into a stack of chunks borrowed
+    // from free heap blocks, gc_spill being the top one. The first word of a
+    // chunk links to the one below it. Emptied chunks are kept on a list of
+    // spares, and all of them are given back before the sweep.
+    void **gc_spill;
+    size_t gc_spill_len; // words of gc_spill in use, counting the link
+    size_t gc_spill_cap;
+    void **gc_spill_spare;
+    // Where to look for the next free block to borrow; NULL if none are left.
+    mp_state_mem_area_t *gc_spill_area;
+    size_t gc_spill_block;
+    // The overflow window being rescanned: blocks gc_rescan_block up to
+    // gc_rescan_end of gc_rescan_area, which is NULL between rescans.
+    mp_state_mem_area_t *gc_rescan_area;
+    size_t gc_rescan_block;
+    size_t gc_rescan_end;
     uint16_t gc_lock_depth;
 
     // This variable controls auto garbage collection.  If set to false then the
@@ -92,6 +170,49 @@ typedef struct _mp_state_mem_t {
     size_t gc_alloc_threshold;
     #endif
 
+    #if MICROPY_GC_LAZY_SWEEP
+    // A sweep of the main area left for allocations to do. Blocks from
+    // gc_sweep_block on haven't been swept yet, and the gc_sweep_n_free blocks
+    // before it are free.
+    bool gc_sweep_pending;
+    // Set while gc_alloc collects, so that the collection sweeps lazily.
+    bool gc_sweep_lazily;
+    size_t gc_sweep_block;
+    size_t gc_sweep_n_free;
+    size_t gc_sweep_total_free;
+    #endif
+
+    #if MICROPY_GC_DEFERRED_FINALISER
+    // Number of objects in MP_STATE_VM(gc_finaliser_queue).
+    size_t gc_finaliser_len;
+    // Set while a sweep must run finalisers instead of queueing them.
+    bool gc_finalise_now;
+    #endif
+
+    #if MICROPY_GC_IDLE_COLLECT
+    // Blocks allocated since the last collection, and how many may be before
+    // an idle collection is due.
+    size_t gc_idle_alloc_amount;
+    size_t gc_idle_budget;
+    // The budget is the free heap shifted right by 1 + gc_idle_shift.
+    uint8_t gc_idle_shift;
+    // Set while gc_alloc collects because it ran out of memory.
+    bool gc_idle_missed;
+    #endif
+
+    #if MICROPY_GC_INCREMENTAL
+    // State of an in-progress incremental collection. Marked blocks waiting to
+    // have their children scanned are kept in gc_stack[0:gc_incremental_sp].
+    uint8_t gc_incremental_state;
+    size_t gc_incremental_sp;
+    size_t gc_incremental_alloc_amount;
+    #endif
+
+    #if MICROPY_GC_ALLOC_PROFILE
+    bool gc_profile_enabled;
+    mp_gc_profile_entry_t gc_profile[MICROPY_GC_ALLOC_PROFILE_ENTRIES];
+    #endif
+
     size_t gc_first_free_atb_index[MICROPY_ATB_INDICES];
     size_t gc_last_free_atb_index;
 
@@ -148,7 +269,12 @@ typedef struct _mp_state_vm_t {
     volatile mp_obj_t mp_pending_exception;
 
     #if MICROPY_ENABLE_SCHEDULER
-    mp_sched_item_t sched_stack[MICROPY_SCHEDULER_DEPTH];
+    mp_sched_item_t sched_queue[MICROPY_SCHEDULER_DEPTH];
+    #endif
+
+    #if MICROPY_GC_DEFERRED_FINALISER
+    // dead objects waiting for their finaliser to be run by the scheduler
+    mp_obj_t gc_finaliser_queue[MICROPY_GC_DEFERRED_FINALISER_DEPTH];
     #endif
 
     // current exception being handled, for sys.exc_info()
@@ -159,6 +285,12 @@ typedef struct _mp_state_vm_t {
     // dictionary for the __main__ module
     mp_obj_dict_t dict_main;
 
+    #if MICROPY_OPT_TYPE_ATTR_CACHE
+    // Also keeps the cached types and members alive, so an entry can never
+    // refer to memory that has been reused.
+    mp_type_attr_cache_entry_t type_attr_cache[MICROPY_OPT_TYPE_ATTR_CACHE_SIZE];
+    #endif
+
     // these two lists must be initialised per port, after the call to mp_init
     mp_obj_list_t mp_sys_path_obj;
     mp_obj_list_t mp_sys_argv_obj;
@@ -168,6 +300,13 @@ typedef struct _mp_state_vm_t {
     mp_obj_dict_t *mp_module_builtins_override_dict;
     #endif
 
+    #if MICROPY_COMP_CONST_IMPORT
+    // maps a module name to a dict of the public consts of that module
+    mp_obj_dict_t *comp_const_modules;
+    // if set, the parser stores the public consts of the module it parses here
+    mp_obj_dict_t *comp_const_export;
+    #endif
+
     // include any root pointers defined by a port
     MICROPY_PORT_ROOT_POINTERS
 
@@ -182,6 +321,11 @@ typedef struct _mp_state_vm_t {
     mp_obj_t dupterm_arr_obj;
     #endif
 
+    #if MICROPY_PY_URE && MICROPY_PY_URE_CACHE_SIZE
+    // pairs of pattern string and compiled regex, most recently used first
+    mp_obj_t ure_cache[2 * MICROPY_PY_URE_CACHE_SIZE];
+    #endif
+
     #if MICROPY_PY_LWIP_SLIP
     mp_obj_t lwip_slip_stream;
     #endif
@@ -215,9 +359,36 @@ typedef struct _mp_state_vm_t {
     mp_int_t mp_emergency_exception_buf_size;
     #endif
 
+    #if MICROPY_OPT_TYPE_ATTR_CACHE
+    // Entries are only valid if their version matches this one.
+    size_t type_attr_cache_version;
+    #endif
+
+    #if MICROPY_OPT_BOUND_METH_CACHE
+    // Not scanned by the GC, which clears it instead at the start of every
+    // collection.
+    mp_obj_t bound_meth_cache[MICROPY_OPT_BOUND_METH_CACHE_SIZE];
+    #endif
+
+    #if MICROPY_OPT_MAP_LOOKUP_CACHE
+    // Position (if below 256) at which a key was last found in an ordered map.
+    uint8_t map_lookup_cache[MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE];
+    #endif
+
+    #if MICROPY_OPT_GLOBAL_LOOKUP_CACHE
+    // Not scanned by the GC: an entry is only used while no versioned map
+    // has changed its keys, which keeps its map and element alive.
+    mp_global_lookup_cache_entry_t global_lookup_cache[MICROPY_OPT_GLOBAL_LOOKUP_CACHE_SIZE];
+    size_t global_lookup_version;
+    #endif
+
     #if MICROPY_ENABLE_SCHEDULER
     volatile int16_t sched_state;
-    uint16_t sched_sp;
+    // sched_queue is a ring of sched_len items starting at sched_idx
+    uint16_t sched_idx;
+    uint16_t sched_len;
+    // number of callbacks that didn't fit in sched_queue
+    mp_uint_t sched_dropped;
     #endif
 
     #if MICROPY_PY_THREAD_GIL
@@ -246,6 +417,12 @@ typedef struct _mp_state_thread_t {
     uint8_t *pystack_cur;
     #endif
 
+    #if MICROPY_TRACK_CODE_STATE
+    // The bytecode being executed, so allocations and samples can be
+    // attributed to it.
+    struct _mp_code_state_t *current_code_state;
+    #endif
+
     ////////////////////////////////////////////////////////////
     // START ROOT POINTER SECTION
     // Everything that needs GC scanning must start here, and
@@ -256,6 +433,11 @@ typedef struct _mp_state_thread_t {
     mp_obj_dict_t *dict_globals;
 
     nlr_buf_t *nlr_top;
+
+    #if MICROPY_OPT_FAST_RAISE
+    // exception object of type StopIteration, reused for raises without args
+    mp_obj_exception_t stop_iteration;
+    #endif
 } mp_state_thread_t;
 
 // This structure combines the above 3 structures.
@@ -271,6 +453,10 @@ extern mp_state_ctx_t mp_state_ctx;
 #define MP_STATE_VM(x) (mp_state_ctx.vm.x)
 #define MP_STATE_MEM(x) (mp_state_ctx.mem.x)
 
+// The main thread's state, for code such as interrupt handlers that may run
+// on a different thread.
+#define MP_STATE_MAIN_THREAD(x) (mp_state_ctx.thread.x)
+
 #if MICROPY_PY_THREAD
 extern mp_state_thread_t *mp_thread_get_state(void);
 #define MP_STATE_THREAD(x) (mp_thread_get_state()->x)
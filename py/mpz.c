@@ -449,6 +449,172 @@ STATIC size_t mpn_mul(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *
     return ilen;
 }
 
+#if MICROPY_OPT_MPZ_KARATSUBA || MICROPY_OPT_MPZ_MONTGOMERY
+
+/* computes i = i + j
+   assumes ilen >= jlen; assumes the sum fits in ilen digits (a final carry is dropped)
+*/
+STATIC void mpn_add_to(mpz_dig_t *idig, size_t ilen, const mpz_dig_t *jdig, size_t jlen) {
+    mpz_dbl_dig_t carry = 0;
+
+    for (ilen -= jlen; jlen > 0; --jlen, ++idig, ++jdig) {
+        carry += (mpz_dbl_dig_t)*idig + (mpz_dbl_dig_t)*jdig;
+        *idig = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+    }
+
+    for (; carry != 0 && ilen > 0; --ilen, ++idig) {
+        carry += *idig;
+        *idig = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+    }
+}
+
+/* computes i = i - j
+   assumes ilen >= jlen; assumes i >= j
+*/
+STATIC void mpn_sub_from(mpz_dig_t *idig, size_t ilen, const mpz_dig_t *jdig, size_t jlen) {
+    mpz_dbl_dig_signed_t borrow = 0;
+
+    for (ilen -= jlen; jlen > 0; --jlen, ++idig, ++jdig) {
+        borrow += (mpz_dbl_dig_t)*idig - (mpz_dbl_dig_t)*jdig; // will overflow if DIG_SIZE >= MPZ_DBL_DIG_SIZE/2
+        *idig = borrow & DIG_MASK;
+        borrow >>= DIG_SIZE;
+    }
+
+    for (; borrow != 0 && ilen > 0; --ilen, ++idig) {
+        borrow += *idig;
+        *idig = borrow & DIG_MASK;
+        borrow >>= DIG_SIZE;
+    }
+}
+
+#endif
+
+#if MICROPY_OPT_MPZ_KARATSUBA
+
+/* returns the number of scratch digits needed by mpn_mul_karatsuba when
+   multiplying numbers of at most n digits
+*/
+STATIC size_t mpn_mul_karatsuba_scratch(size_t n) {
+    size_t s = 0;
+    while (n >= MICROPY_OPT_MPZ_KARATSUBA_THRESHOLD) {
+        size_t m = (n + 1) / 2;
+        s += 4 * (m + 1);
+        n = m + 1;
+    }
+    return s;
+}
+
+/* computes i = j * k using Karatsuba's method above the threshold
+   fills in all jlen + klen digits of i (which may not be normalised)
+   assumes j, k don't overlap i; j, k need not be normalised
+   can have j, k point to same memory
+   scratch must hold mpn_mul_karatsuba_scratch(max(jlen, klen)) digits
+*/
+STATIC void mpn_mul_karatsuba(mpz_dig_t *idig, const mpz_dig_t *jdig, size_t jlen, const mpz_dig_t *kdig, size_t klen, mpz_dig_t *scratch) {
+    if (jlen < klen) {
+        const mpz_dig_t *t = jdig; jdig = kdig; kdig = t;
+        size_t tl = jlen; jlen = klen; klen = tl;
+    }
+
+    if (klen < MICROPY_OPT_MPZ_KARATSUBA_THRESHOLD) {
+        memset(idig, 0, (jlen + klen) * sizeof(mpz_dig_t));
+        mpn_mul(idig, (mpz_dig_t *)jdig, jlen, (mpz_dig_t *)kdig, klen);
+        return;
+    }
+
+    size_t m = (jlen + 1) / 2;
+
+    if (klen <= m) {
+        // unbalanced: multiply k by klen-sized pieces of j and accumulate
+        memset(idig, 0, (jlen + klen) * sizeof(mpz_dig_t));
+        mpz_dig_t *t = scratch;
+        for (size_t off = 0; off < jlen; off += klen) {
+            size_t n = jlen - off < klen ? jlen - off : klen;
+            mpn_mul_karatsuba(t, jdig + off, n, kdig, klen, scratch + 2 * klen);
+            mpn_add_to(idig + off, jlen + klen - off, t, n + klen);
+        }
+        return;
+    }
+
+    // j = j1 * B^m + j0, k = k1 * B^m + k0, with 0 < klen - m <= jlen - m <= m
+    // z0 = j0 * k0 goes in the low 2m digits of i, z2 = j1 * k1 in the upper digits
+    mpn_mul_karatsuba(idig, jdig, m, kdig, m, scratch);
+    mpn_mul_karatsuba(idig + 2 * m, jdig + m, jlen - m, kdig + m, klen - m, scratch);
+
+    // z1 = (j0 + j1) * (k0 + k1) - z0 - z2
+    mpz_dig_t *sj = scratch;
+    mpz_dig_t *sk = sj + m + 1;
+    mpz_dig_t *z1 = sk + m + 1;
+    memcpy(sj, jdig, m * sizeof(mpz_dig_t));
+    sj[m] = 0;
+    mpn_add_to(sj, m + 1, jdig + m, jlen - m);
+    memcpy(sk, kdig, m * sizeof(mpz_dig_t));
+    sk[m] = 0;
+    mpn_add_to(sk, m + 1, kdig + m, klen - m);
+    mpn_mul_karatsuba(z1, sj, m + 1, sk, m + 1, z1 + 2 * (m + 1));
+    mpn_sub_from(z1, 2 * (m + 1), idig, 2 * m);
+    mpn_sub_from(z1, 2 * (m + 1), idig + 2 * m, jlen + klen - 2 * m);
+
+    // i += z1 * B^m; the top digits of z1 are zero when they don't fit
+    size_t z1len = mpn_remove_trailing_zeros(z1, z1 + 2 * (m + 1));
+    mpn_add_to(idig + m, jlen + klen - m, z1, z1len);
+}
+
+#endif
+
+#if MICROPY_OPT_MPZ_MONTGOMERY
+
+/* computes r = a * b / B^n mod m, with B = 2^DIG_SIZE
+   assumes a, b < m are n digits each (zero padded); assumes m is odd and normalised
+   minv = -1/m mod B; t must hold 2n + 1 digits
+   can have r, a, b point to same memory
+*/
+STATIC void mpn_mul_mont(mpz_dig_t *rdig, const mpz_dig_t *adig, const mpz_dig_t *bdig, const mpz_dig_t *mdig, size_t n, mpz_dig_t minv, mpz_dig_t *t, mpz_dig_t *scratch) {
+    #if MICROPY_OPT_MPZ_KARATSUBA
+    mpn_mul_karatsuba(t, adig, n, bdig, n, scratch);
+    #else
+    (void)scratch;
+    memset(t, 0, 2 * n * sizeof(mpz_dig_t));
+    mpn_mul(t, (mpz_dig_t *)adig, n, (mpz_dig_t *)bdig, n);
+    #endif
+    t[2 * n] = 0;
+
+    // add multiples of m to clear the low n digits of t
+    for (size_t i = 0; i < n; ++i) {
+        mpz_dig_t u = ((mpz_dbl_dig_t)t[i] * minv) & DIG_MASK;
+        mpz_dbl_dig_t carry = 0;
+        for (size_t j = 0; j < n; ++j) {
+            carry += (mpz_dbl_dig_t)t[i + j] + (mpz_dbl_dig_t)u * (mpz_dbl_dig_t)mdig[j]; // will never overflow so long as DIG_SIZE <= 8*sizeof(mpz_dbl_dig_t)/2
+            t[i + j] = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+        for (mpz_dig_t *d = t + i + n; carry != 0; ++d) {
+            carry += *d;
+            *d = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+    }
+
+    // the result t / B^n is < 2m, so at most one subtraction is needed
+    mpz_dig_t *hi = t + n;
+    bool ge = hi[n] != 0;
+    if (!ge) {
+        size_t i = n;
+        while (i > 0 && hi[i - 1] == mdig[i - 1]) {
+            --i;
+        }
+        ge = i == 0 || hi[i - 1] > mdig[i - 1];
+    }
+    if (ge) {
+        mpn_sub_from(hi, n + 1, mdig, n);
+    }
+    memcpy(rdig, hi, n * sizeof(mpz_dig_t));
+}
+
+#endif
+
 /* natural_div - quo * den + new_num = old_num (ie num is replaced with rem)
    assumes den != 0
    assumes num_dig has enough memory to be extended by 1 digit
@@ -1313,8 +1479,20 @@ void mpz_mul_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
     }
 
     mpz_need_dig(dest, lhs->len + rhs->len); // min mem l+r-1, max mem l+r
-    memset(dest->dig, 0, dest->alloc * sizeof(mpz_dig_t));
-    dest->len = mpn_mul(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len);
+    #if MICROPY_OPT_MPZ_KARATSUBA
+    if (lhs->len >= MICROPY_OPT_MPZ_KARATSUBA_THRESHOLD && rhs->len >= MICROPY_OPT_MPZ_KARATSUBA_THRESHOLD) {
+        size_t n = MAX(lhs->len, rhs->len);
+        size_t scratch_len = mpn_mul_karatsuba_scratch(n);
+        mpz_dig_t *scratch = m_new(mpz_dig_t, scratch_len);
+        mpn_mul_karatsuba(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len, scratch);
+        m_del(mpz_dig_t, scratch, scratch_len);
+        dest->len = mpn_remove_trailing_zeros(dest->dig, dest->dig + lhs->len + rhs->len);
+    } else
+    #endif
+    {
+        memset(dest->dig, 0, dest->alloc * sizeof(mpz_dig_t));
+        dest->len = mpn_mul(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len);
+    }
 
     if (lhs->neg == rhs->neg) {
         dest->neg = 0;
@@ -1359,6 +1537,82 @@ void mpz_pow_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
     mpz_free(n);
 }
 
+#if MICROPY_OPT_MPZ_MONTGOMERY
+
+/* computes dest = (lhs ** rhs) % mod using Montgomery multiplication
+   assumes rhs > 0; assumes mod > 1 and is odd
+   can have dest, lhs, rhs the same; mod can't be the same as dest
+*/
+STATIC void mpz_pow3_mont(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t *mod) {
+    size_t n = mod->len;
+
+    // minv = -1/mod mod B, by Newton's iteration (each step doubles the correct bits)
+    mpz_dig_t m0 = mod->dig[0];
+    mpz_dig_t minv = 1;
+    for (unsigned int bits = 1; bits < DIG_SIZE; bits *= 2) {
+        minv = ((mpz_dbl_dig_t)minv * (2 - (mpz_dbl_dig_t)m0 * minv)) & DIG_MASK;
+    }
+    minv = (-(mpz_dbl_dig_t)minv) & DIG_MASK;
+
+    // work buffer: x (n), acc (n), t (2n + 1), then any multiplication scratch
+    size_t scratch_len = 0;
+    #if MICROPY_OPT_MPZ_KARATSUBA
+    scratch_len = mpn_mul_karatsuba_scratch(n);
+    #endif
+    size_t work_len = 4 * n + 1 + scratch_len;
+    mpz_dig_t *work = m_new(mpz_dig_t, work_len);
+    mpz_dig_t *x = work;
+    mpz_dig_t *acc = x + n;
+    mpz_dig_t *t = acc + n;
+
+    // x = (lhs % mod) * B^n % mod, the base in Montgomery form
+    mpz_t quo; mpz_init_zero(&quo);
+    mpz_t rem; mpz_init_zero(&rem);
+    mpz_divmod_inpl(&quo, &rem, lhs, mod);
+    mpz_shl_inpl(&rem, &rem, n * DIG_SIZE);
+    mpz_divmod_inpl(&quo, &rem, &rem, mod);
+    memset(x, 0, n * sizeof(mpz_dig_t));
+    memcpy(x, rem.dig, rem.len * sizeof(mpz_dig_t));
+    mpz_deinit(&quo);
+    mpz_deinit(&rem);
+
+    // left-to-right binary exponentiation, starting below the top set bit of rhs
+    memcpy(acc, x, n * sizeof(mpz_dig_t));
+    size_t i = rhs->len - 1;
+    mpz_dig_t bit = DIG_MSB;
+    while ((rhs->dig[i] & bit) == 0) {
+        bit >>= 1;
+    }
+    for (;;) {
+        bit >>= 1;
+        if (bit == 0) {
+            if (i == 0) {
+                break;
+            }
+            --i;
+            bit = DIG_MSB;
+        }
+        mpn_mul_mont(acc, acc, acc, mod->dig, n, minv, t, t + 2 * n + 1);
+        if ((rhs->dig[i] & bit) != 0) {
+            mpn_mul_mont(acc, acc, x, mod->dig, n, minv, t, t + 2 * n + 1);
+        }
+    }
+
+    // convert out of Montgomery form by multiplying by 1
+    memset(x, 0, n * sizeof(mpz_dig_t));
+    x[0] = 1;
+    mpn_mul_mont(acc, acc, x, mod->dig, n, minv, t, t + 2 * n + 1);
+
+    mpz_need_dig(dest, n);
+    memcpy(dest->dig, acc, n * sizeof(mpz_dig_t));
+    dest->len = mpn_remove_trailing_zeros(dest->dig, dest->dig + n);
+    dest->neg = 0;
+
+    m_del(mpz_dig_t, work, work_len);
+}
+
+#endif
+
 /* computes dest = (lhs ** rhs) % mod
    can have dest, lhs, rhs the same; mod can't be the same as dest
 */
@@ -1374,6 +1628,13 @@ void mpz_pow3_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t
         return;
     }
 
+    #if MICROPY_OPT_MPZ_MONTGOMERY
+    if (mod->neg == 0 && (mod->dig[0] & 1) != 0 && mod->len >= MICROPY_OPT_MPZ_MONTGOMERY_MIN_DIG) {
+        mpz_pow3_mont(dest, lhs, rhs, mod);
+        return;
+    }
+    #endif
+
     mpz_t *x = mpz_clone(lhs);
     mpz_t *n = mpz_clone(rhs);
     mpz_t quo; mpz_init_zero(&quo);
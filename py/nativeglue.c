@@ -39,6 +39,28 @@
 #define DEBUG_printf(...) (void)0
 #endif
 
+#if MICROPY_EMIT_NATIVE_FLOAT
+
+// viper "float" values are held in a machine word as the raw bits of an mp_float_t
+typedef union _native_float_t {
+    mp_uint_t u;
+    mp_float_t f;
+} native_float_t;
+
+STATIC mp_float_t native_to_float(mp_uint_t val) {
+    native_float_t nf = { .u = val };
+    return nf.f;
+}
+
+STATIC mp_uint_t native_from_float(mp_float_t f) {
+    MP_STATIC_ASSERT(sizeof(mp_float_t) <= sizeof(mp_uint_t));
+    native_float_t nf = { .u = 0 };
+    nf.f = f;
+    return nf.u;
+}
+
+#endif
+
 #if MICROPY_EMIT_NATIVE
 
 // convert a MicroPython object to a valid native value based on type
@@ -49,6 +71,9 @@ mp_uint_t mp_convert_obj_to_native(mp_obj_t obj, mp_uint_t type) {
         case MP_NATIVE_TYPE_BOOL:
         case MP_NATIVE_TYPE_INT:
         case MP_NATIVE_TYPE_UINT: return mp_obj_get_int_truncated(obj);
+        #if MICROPY_EMIT_NATIVE_FLOAT
+        case MP_NATIVE_TYPE_FLOAT: return native_from_float(mp_obj_get_float(obj));
+        #endif
         default: { // cast obj to a pointer
             mp_buffer_info_t bufinfo;
             if (mp_get_buffer(obj, &bufinfo, MP_BUFFER_RW)) {
@@ -73,6 +98,9 @@ mp_obj_t mp_convert_native_to_obj(mp_uint_t val, mp_uint_t type) {
         case MP_NATIVE_TYPE_BOOL: return mp_obj_new_bool(val);
         case MP_NATIVE_TYPE_INT: return mp_obj_new_int(val);
         case MP_NATIVE_TYPE_UINT: return mp_obj_new_int_from_uint(val);
+        #if MICROPY_EMIT_NATIVE_FLOAT
+        case MP_NATIVE_TYPE_FLOAT: return mp_obj_new_float(native_to_float(val));
+        #endif
         default: // a pointer
             // we return just the value of the pointer as an integer
             return mp_obj_new_int_from_uint(val);
@@ -97,6 +125,41 @@ void mp_native_raise(mp_obj_t o) {
     }
 }
 
+#if MICROPY_EMIT_NATIVE_FLOAT
+
+// binary op on unboxed viper floats, so arithmetic doesn't allocate
+// the low bits of op are an mp_binary_op_t, and the MP_NATIVE_FLOAT_xxx_INT
+// flags say that lhs and/or rhs is a machine int that must be converted first
+// comparisons return a bool, all other ops return the raw bits of a float
+mp_uint_t mp_native_float_binary_op(mp_uint_t op, mp_uint_t lhs_in, mp_uint_t rhs_in) {
+    mp_float_t lhs = (op & MP_NATIVE_FLOAT_LHS_INT) ? (mp_float_t)(mp_int_t)lhs_in : native_to_float(lhs_in);
+    mp_float_t rhs = (op & MP_NATIVE_FLOAT_RHS_INT) ? (mp_float_t)(mp_int_t)rhs_in : native_to_float(rhs_in);
+    switch (op & 0xff) {
+        case MP_BINARY_OP_ADD: lhs += rhs; break;
+        case MP_BINARY_OP_SUBTRACT: lhs -= rhs; break;
+        case MP_BINARY_OP_MULTIPLY: lhs *= rhs; break;
+        case MP_BINARY_OP_TRUE_DIVIDE:
+            if (rhs == 0) {
+                mp_raise_msg(&mp_type_ZeroDivisionError, translate("division by zero"));
+            }
+            lhs /= rhs;
+            break;
+        case MP_BINARY_OP_LESS: return lhs < rhs;
+        case MP_BINARY_OP_MORE: return lhs > rhs;
+        case MP_BINARY_OP_EQUAL: return lhs == rhs;
+        case MP_BINARY_OP_LESS_EQUAL: return lhs <= rhs;
+        case MP_BINARY_OP_MORE_EQUAL: return lhs >= rhs;
+        case MP_BINARY_OP_NOT_EQUAL: return lhs != rhs;
+        default:
+            // the emitter only generates the ops above
+            assert(0);
+            break;
+    }
+    return native_from_float(lhs);
+}
+
+#endif
+
 // wrapper that handles iterator buffer
 STATIC mp_obj_t mp_native_getiter(mp_obj_t obj, mp_obj_iter_buf_t *iter) {
     if (iter == NULL) {
@@ -123,6 +186,42 @@ STATIC mp_obj_t mp_native_iternext(mp_obj_iter_buf_t *iter) {
     return mp_iternext(obj);
 }
 
+#if MICROPY_EMIT_NATIVE_VIPER_INTRINSICS
+
+// helpers for the viper intrinsics, nbytes is 2 or 4
+// the byte shuffles are written so the compiler can turn them into rev/bswap
+STATIC mp_uint_t mp_native_bswap(mp_uint_t val, mp_uint_t nbytes) {
+    if (nbytes == 2) {
+        return ((val & 0xff) << 8) | ((val >> 8) & 0xff);
+    }
+    uint32_t x = val;
+    return (x << 24) | ((x & 0xff00) << 8) | ((x >> 8) & 0xff00) | (x >> 24);
+}
+
+// memcpy does an unaligned access where the CPU allows it, and bytewise otherwise
+STATIC mp_uint_t mp_native_load_unaligned(const void *ptr, mp_uint_t nbytes) {
+    if (nbytes == 2) {
+        uint16_t x;
+        memcpy(&x, ptr, sizeof(x));
+        return x;
+    }
+    uint32_t x;
+    memcpy(&x, ptr, sizeof(x));
+    return x;
+}
+
+STATIC void mp_native_store_unaligned(void *ptr, mp_uint_t val, mp_uint_t nbytes) {
+    if (nbytes == 2) {
+        uint16_t x = val;
+        memcpy(ptr, &x, sizeof(x));
+    } else {
+        uint32_t x = val;
+        memcpy(ptr, &x, sizeof(x));
+    }
+}
+
+#endif
+
 // these must correspond to the respective enum in runtime0.h
 void *const mp_fun_table[MP_F_NUMBER_OF] = {
     mp_convert_obj_to_native,
@@ -173,6 +272,17 @@ void *const mp_fun_table[MP_F_NUMBER_OF] = {
     mp_setup_code_state,
     mp_small_int_floor_divide,
     mp_small_int_modulo,
+#if MICROPY_EMIT_NATIVE_FLOAT
+    mp_native_float_binary_op,
+#endif
+#if MICROPY_EMIT_NATIVE_VIPER_INTRINSICS
+    memcpy,
+    memmove,
+    memset,
+    mp_native_bswap,
+    mp_native_load_unaligned,
+    mp_native_store_unaligned,
+#endif
 };
 
 /*
@@ -32,7 +32,9 @@
 #include "py/obj.h"
 #include "py/objtype.h"
 #include "py/objint.h"
+#include "py/objlist.h"
 #include "py/objstr.h"
+#include "py/objtuple.h"
 #include "py/qstr.h"
 #include "py/runtime.h"
 #include "py/stackctrl.h"
@@ -42,7 +44,7 @@
 #include "supervisor/shared/stack.h"
 #include "supervisor/shared/translate.h"
 
-mp_obj_type_t *mp_obj_get_type(mp_const_obj_t o_in) {
+mp_obj_type_t *PLACE_IN_ITCM_HOT(mp_obj_get_type)(mp_const_obj_t o_in) {
     if (MP_OBJ_IS_SMALL_INT(o_in)) {
         return (mp_obj_type_t*)&mp_type_int;
     } else if (MP_OBJ_IS_QSTR(o_in)) {
@@ -488,7 +490,70 @@ mp_obj_t mp_obj_len_maybe(mp_obj_t o_in) {
     }
 }
 
-mp_obj_t mp_obj_subscr(mp_obj_t base, mp_obj_t index, mp_obj_t value) {
+// Estimate how many items iterating over o will produce, without consuming
+// any of them.  Sized objects report their length, and the builtin iterators
+// that can work it out report what they have left.  Returns 0 if the count
+// isn't known.  The result is only a hint for preallocating storage: callers
+// must still cope with getting more or fewer items.
+size_t mp_obj_length_hint(mp_obj_t o) {
+    mp_obj_t len = mp_obj_len_maybe(o);
+    if (len != MP_OBJ_NULL) {
+        return MP_OBJ_IS_SMALL_INT(len) && MP_OBJ_SMALL_INT_VALUE(len) > 0 ? MP_OBJ_SMALL_INT_VALUE(len) : 0;
+    }
+    if (!MP_OBJ_IS_OBJ(o)) {
+        return 0;
+    }
+    const mp_obj_type_t *type = ((mp_obj_base_t*)MP_OBJ_TO_PTR(o))->type;
+    if (type == &mp_type_range_it) {
+        mp_obj_range_it_t *r = MP_OBJ_TO_PTR(o);
+        if (r->step > 0 && r->cur < r->stop) {
+            return ((mp_uint_t)r->stop - (mp_uint_t)r->cur - 1) / (mp_uint_t)r->step + 1;
+        } else if (r->step < 0 && r->cur > r->stop) {
+            return ((mp_uint_t)r->cur - (mp_uint_t)r->stop - 1) / (0 - (mp_uint_t)r->step) + 1;
+        }
+    } else if (type == &mp_type_polymorph_iter) {
+        mp_fun_1_t iternext = ((mp_obj_list_it_t*)MP_OBJ_TO_PTR(o))->iternext;
+        if (iternext == mp_obj_list_it_iternext) {
+            mp_obj_list_it_t *it = MP_OBJ_TO_PTR(o);
+            mp_obj_list_t *list = MP_OBJ_TO_PTR(it->list);
+            return it->cur < list->len ? list->len - it->cur : 0;
+        } else if (iternext == mp_obj_tuple_it_iternext) {
+            mp_obj_tuple_it_t *it = MP_OBJ_TO_PTR(o);
+            return it->cur < it->tuple->len ? it->tuple->len - it->cur : 0;
+        } else if (iternext == mp_obj_bytes_it_iternext) {
+            mp_obj_str8_it_t *it = MP_OBJ_TO_PTR(o);
+            GET_STR_LEN(it->str, l);
+            return it->cur < l ? l - it->cur : 0;
+        }
+    } else if (type == &mp_type_map) {
+        return mp_obj_map_length_hint(o);
+    } else if (type == &mp_type_zip) {
+        return mp_obj_zip_length_hint(o);
+    #if MICROPY_PY_BUILTINS_ENUMERATE
+    } else if (type == &mp_type_enumerate) {
+        return mp_obj_enumerate_length_hint(o);
+    #endif
+    }
+    return 0;
+}
+
+// The shortest hint of n iterators, as map and zip stop at the shortest one.
+// Any iterator of unknown length makes the whole lot unknown.
+size_t mp_obj_length_hint_min(size_t n, const mp_obj_t *iters) {
+    size_t hint = 0;
+    for (size_t i = 0; i < n; i++) {
+        size_t h = mp_obj_length_hint(iters[i]);
+        if (h == 0) {
+            return 0;
+        }
+        if (i == 0 || h < hint) {
+            hint = h;
+        }
+    }
+    return hint;
+}
+
+mp_obj_t PLACE_IN_ITCM_HOT(mp_obj_subscr)(mp_obj_t base, mp_obj_t index, mp_obj_t value) {
     mp_obj_type_t *type = mp_obj_get_type(base);
 
     if (type->subscr != NULL) {
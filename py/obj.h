@@ -137,6 +137,11 @@ static inline bool MP_OBJ_IS_OBJ(mp_const_obj_t o)
 
 #elif MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_C
 
+// floats are stored in the object word, which only has room for single precision
+#if MICROPY_PY_BUILTINS_FLOAT && MICROPY_FLOAT_IMPL != MICROPY_FLOAT_IMPL_FLOAT
+#error "MICROPY_OBJ_REPR_C requires MICROPY_FLOAT_IMPL_FLOAT"
+#endif
+
 static inline bool MP_OBJ_IS_SMALL_INT(mp_const_obj_t o)
     { return ((((mp_int_t)(o)) & 1) != 0); }
 #define MP_OBJ_SMALL_INT_VALUE(o) (((mp_int_t)(o)) >> 1)
@@ -368,7 +373,9 @@ typedef struct _mp_map_t {
     size_t is_ordered : 1;  // an ordered array
     size_t scanning : 1;    // true if we're in the middle of scanning linked dictionaries,
                             // e.g., make_dict_long_lived()
-    size_t used : (8 * sizeof(size_t) - 4);
+    size_t versioned : 1;   // key changes bump MP_STATE_VM(global_lookup_version)
+    size_t is_compact : 1;  // dense table followed by a hash index, see map.c; ignored if ordered
+    size_t used : (8 * sizeof(size_t) - 6);
     size_t alloc;
     mp_map_elem_t *table;
 } mp_map_t;
@@ -385,8 +392,21 @@ extern const mp_map_t mp_const_empty_map;
 
 static inline bool MP_MAP_SLOT_IS_FILLED(const mp_map_t *map, size_t pos) { return ((map)->table[pos].key != MP_OBJ_NULL && (map)->table[pos].key != MP_OBJ_SENTINEL); }
 
+// Must be used wherever the set of keys of a map changes or its table moves,
+// so that cached pointers to the elements of versioned maps are dropped.
+#if MICROPY_OPT_GLOBAL_LOOKUP_CACHE
+#define MP_MAP_KEYS_CHANGED(map) do { \
+        if ((map)->versioned) { \
+            ++MP_STATE_VM(global_lookup_version); \
+        } \
+    } while (0)
+#else
+#define MP_MAP_KEYS_CHANGED(map) (void)0
+#endif
+
 void mp_map_init(mp_map_t *map, size_t n);
 void mp_map_init_fixed_table(mp_map_t *map, size_t n, const mp_obj_t *table);
+void mp_map_init_copy(mp_map_t *map, const mp_map_t *src);
 mp_map_t *mp_map_new(size_t n);
 void mp_map_deinit(mp_map_t *map);
 void mp_map_free(mp_map_t *map);
@@ -582,6 +602,16 @@ extern const mp_obj_type_t mp_type_stringio;
 extern const mp_obj_type_t mp_type_bytesio;
 extern const mp_obj_type_t mp_type_reversed;
 extern const mp_obj_type_t mp_type_polymorph_iter;
+extern const mp_obj_type_t mp_type_range_it;
+
+// The range iterator, which is also stepped inline by the VM's FOR_ITER
+typedef struct _mp_obj_range_it_t {
+    mp_obj_base_t base;
+    // TODO make these values generic objects or something
+    mp_int_t cur;
+    mp_int_t stop;
+    mp_int_t step;
+} mp_obj_range_it_t;
 
 // Exceptions
 extern const mp_obj_type_t mp_type_BaseException;
@@ -656,6 +686,7 @@ mp_obj_t mp_obj_new_int_from_float(mp_float_t val);
 mp_obj_t mp_obj_new_complex(mp_float_t real, mp_float_t imag);
 #endif
 mp_obj_t mp_obj_new_exception(const mp_obj_type_t *exc_type);
+mp_obj_t mp_obj_new_stop_iteration(void); // StopIteration without args, may be preallocated
 mp_obj_t mp_obj_new_exception_arg1(const mp_obj_type_t *exc_type, mp_obj_t arg);
 mp_obj_t mp_obj_new_exception_args(const mp_obj_type_t *exc_type, size_t n_args, const mp_obj_t *args);
 mp_obj_t mp_obj_new_exception_msg(const mp_obj_type_t *exc_type, const compressed_string_t *msg);
@@ -707,9 +738,16 @@ size_t mp_get_index(const mp_obj_type_t *type, size_t len, mp_obj_t index, bool
 mp_obj_t mp_obj_id(mp_obj_t o_in);
 mp_obj_t mp_obj_len(mp_obj_t o_in);
 mp_obj_t mp_obj_len_maybe(mp_obj_t o_in); // may return MP_OBJ_NULL
+size_t mp_obj_length_hint(mp_obj_t o); // returns 0 if not known
+size_t mp_obj_length_hint_min(size_t n, const mp_obj_t *iters);
 mp_obj_t mp_obj_subscr(mp_obj_t base, mp_obj_t index, mp_obj_t val);
 mp_obj_t mp_generic_unary_op(mp_unary_op_t op, mp_obj_t o_in);
 
+// map, zip, enumerate
+size_t mp_obj_map_length_hint(mp_obj_t self_in);
+size_t mp_obj_zip_length_hint(mp_obj_t self_in);
+size_t mp_obj_enumerate_length_hint(mp_obj_t self_in);
+
 // cell
 mp_obj_t mp_obj_cell_get(mp_obj_t self_in);
 void mp_obj_cell_set(mp_obj_t self_in, mp_obj_t obj);
@@ -733,6 +771,7 @@ mp_obj_t mp_obj_exception_get_value(mp_obj_t self_in);
 mp_obj_t mp_obj_exception_make_new(const mp_obj_type_t *type_in, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args);
 mp_obj_t mp_alloc_emergency_exception_buf(mp_obj_t size_in);
 void mp_init_emergency_exception_buf(void);
+void mp_init_stop_iteration(void);
 
 // str
 bool mp_obj_str_equal(mp_obj_t s1, mp_obj_t s2);
@@ -741,6 +780,7 @@ const char *mp_obj_str_get_str(mp_obj_t self_in); // use this only if you need t
 const char *mp_obj_str_get_data(mp_obj_t self_in, size_t *len);
 mp_obj_t mp_obj_str_intern(mp_obj_t str);
 mp_obj_t mp_obj_str_intern_checked(mp_obj_t obj);
+mp_obj_t mp_obj_str_find_interned_checked(mp_obj_t obj);
 void mp_str_print_quoted(const mp_print_t *print, const byte *str_data, size_t str_len, bool is_bytes);
 
 #if MICROPY_PY_BUILTINS_FLOAT
@@ -28,6 +28,7 @@
 #include <string.h>
 #include <assert.h>
 #include <stdint.h>
+#include <limits.h>
 
 #include "py/runtime.h"
 #include "py/binary.h"
@@ -134,27 +135,27 @@ STATIC mp_obj_t array_construct(char typecode, mp_obj_t initializer) {
         return MP_OBJ_FROM_PTR(o);
     }
 
-    size_t len;
-    // Try to create array of exact len if initializer len is known
-    mp_obj_t len_in = mp_obj_len_maybe(initializer);
-    if (len_in == MP_OBJ_NULL) {
-        len = 0;
-    } else {
-        len = MP_OBJ_SMALL_INT_VALUE(len_in);
-    }
-
+    // Try to create array of exact len if we can tell how many items are coming.
+    // The hint may be wrong, so append any extra items and give back any that
+    // weren't filled in.
+    size_t len = mp_obj_length_hint(initializer);
     mp_obj_array_t *array = array_new(typecode, len);
 
-    mp_obj_t iterable = mp_getiter(initializer, NULL);
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t iterable = mp_getiter(initializer, &iter_buf);
     mp_obj_t item;
     size_t i = 0;
     while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
-        if (len == 0) {
+        if (i >= len) {
             array_append(MP_OBJ_FROM_PTR(array), item);
         } else {
             mp_binary_set_val_array(typecode, array->items, i++, item);
         }
     }
+    if (i < len) {
+        array->free += len - i;
+        array->len = i;
+    }
 
     return MP_OBJ_FROM_PTR(array);
 }
@@ -219,6 +220,11 @@ STATIC mp_obj_t memoryview_make_new(const mp_obj_type_t *type_in, size_t n_args,
 
     mp_arg_check_num(n_args, kw_args, 1, 1, false);
 
+    #if MICROPY_OPT_STR_SLICE
+    // a slice's data doesn't start a GC chunk, see above, so copy it out
+    mp_obj_str_unslice(args[0]);
+    #endif
+
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(args[0], &bufinfo, MP_BUFFER_READ);
 
@@ -566,11 +572,368 @@ STATIC mp_obj_t array_decode(size_t n_args, const mp_obj_t *args) {
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(array_decode_obj, 1, 3, array_decode);
 #endif
 
+#if MICROPY_PY_ARRAY_ELEMENTWISE_OPS && (MICROPY_PY_ARRAY || MICROPY_PY_BUILTINS_BYTEARRAY)
+// Elementwise methods that work on an array or bytearray in place, for buffer
+// processing that would be slow as a Python loop.  Integer results saturate at
+// the limits of the element type rather than wrapping.
+
+// The integer typecodes: typecode, C type, min, max, and the type to sum in.
+#define ARRAY_INT_TYPES(X) \
+    X('b', int8_t, INT8_MIN, INT8_MAX, long long) \
+    X('B', uint8_t, 0, UINT8_MAX, unsigned long long) \
+    X('h', int16_t, INT16_MIN, INT16_MAX, long long) \
+    X('H', uint16_t, 0, UINT16_MAX, unsigned long long) \
+    X('i', int, INT_MIN, INT_MAX, long long) \
+    X('I', unsigned int, 0, UINT_MAX, unsigned long long) \
+    X('l', long, LONG_MIN, LONG_MAX, long long) \
+    X('L', unsigned long, 0, ULONG_MAX, unsigned long long)
+
+#if MICROPY_PY_BUILTINS_FLOAT
+#define ARRAY_FLOAT_TYPES(X) \
+    X('f', float) \
+    X('d', double)
+#else
+#define ARRAY_FLOAT_TYPES(X)
+#endif
+
+#define WORD_SIZE (sizeof(mp_uint_t))
+#define WORD_ALIGNED(p) (((uintptr_t)(p) & (WORD_SIZE - 1)) == 0)
+
+STATIC NORETURN void array_raise_unsupported(void) {
+    mp_raise_TypeError(translate("operation is not supported for given type"));
+}
+
+// bytearray has its own typecode, but its elements are the same as 'B'.
+STATIC char array_elem_typecode(char typecode) {
+    return typecode == BYTEARRAY_TYPECODE ? 'B' : typecode;
+}
+
+STATIC mp_obj_t array_fill(mp_obj_t self_in, mp_obj_t value) {
+    mp_obj_array_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->len == 0) {
+        return mp_const_none;
+    }
+    // Store one element, then keep doubling the filled part.
+    mp_binary_set_val_array(self->typecode, self->items, 0, value);
+    size_t sz = mp_binary_get_size('@', self->typecode, NULL);
+    byte *p = self->items;
+    size_t total = self->len * sz;
+    for (size_t done = sz; done < total;) {
+        size_t n = MIN(done, total - done);
+        memcpy(p + done, p, n);
+        done += n;
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(array_fill_obj, array_fill);
+
+// Bitwise ops on the raw bytes, a machine word at a time where the two buffers
+// have the same alignment.
+#define ARRAY_BITWISE_LOOP(op) \
+    if (WORD_ALIGNED((uintptr_t)dst ^ (uintptr_t)src)) { \
+        for (; len && !WORD_ALIGNED(dst); len--) { \
+            *dst++ op *src++; \
+        } \
+        mp_uint_t *wdst = (mp_uint_t*)(void*)dst; \
+        const mp_uint_t *wsrc = (const mp_uint_t*)(const void*)src; \
+        for (; len >= WORD_SIZE; len -= WORD_SIZE) { \
+            *wdst++ op *wsrc++; \
+        } \
+        dst = (byte*)wdst; \
+        src = (const byte*)wsrc; \
+    } \
+    while (len--) { \
+        *dst++ op *src++; \
+    }
+
+// The bytes of 'O', 'S' and 'P' elements are pointers, which mustn't be made
+// up from or leaked into other data.
+STATIC bool array_is_pointer_typecode(char typecode) {
+    return typecode == 'O' || typecode == 'S' || typecode == 'P';
+}
+
+STATIC mp_obj_t array_bitwise(mp_obj_t self_in, mp_obj_t other_in, mp_binary_op_t op) {
+    mp_buffer_info_t self_buf, other_buf;
+    mp_get_buffer_raise(self_in, &self_buf, MP_BUFFER_WRITE);
+    mp_get_buffer_raise(other_in, &other_buf, MP_BUFFER_READ);
+    if (array_is_pointer_typecode(self_buf.typecode)
+        || array_is_pointer_typecode(other_buf.typecode)) {
+        array_raise_unsupported();
+    }
+    if (self_buf.len != other_buf.len) {
+        mp_raise_ValueError(translate("buffers must be the same length"));
+    }
+    byte *dst = self_buf.buf;
+    const byte *src = other_buf.buf;
+    size_t len = self_buf.len;
+    if (op == MP_BINARY_OP_XOR) {
+        ARRAY_BITWISE_LOOP(^=)
+    } else if (op == MP_BINARY_OP_AND) {
+        ARRAY_BITWISE_LOOP(&=)
+    } else {
+        ARRAY_BITWISE_LOOP(|=)
+    }
+    return mp_const_none;
+}
+
+STATIC mp_obj_t array_ixor(mp_obj_t self_in, mp_obj_t other_in) {
+    return array_bitwise(self_in, other_in, MP_BINARY_OP_XOR);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(array_ixor_obj, array_ixor);
+
+STATIC mp_obj_t array_iand(mp_obj_t self_in, mp_obj_t other_in) {
+    return array_bitwise(self_in, other_in, MP_BINARY_OP_AND);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(array_iand_obj, array_iand);
+
+STATIC mp_obj_t array_ior(mp_obj_t self_in, mp_obj_t other_in) {
+    return array_bitwise(self_in, other_in, MP_BINARY_OP_OR);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(array_ior_obj, array_ior);
+
+// add(value) adds a number to every element, or adds another buffer of the
+// same typecode and length elementwise.
+STATIC mp_obj_t array_add(mp_obj_t self_in, mp_obj_t arg) {
+    mp_obj_array_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t n = self->len;
+    const void *other = NULL;
+    mp_buffer_info_t bufinfo;
+    if (mp_get_buffer(arg, &bufinfo, MP_BUFFER_READ)) {
+        if (array_elem_typecode(bufinfo.typecode) != array_elem_typecode(self->typecode)) {
+            array_raise_unsupported();
+        }
+        if (bufinfo.len != n * mp_binary_get_size('@', self->typecode, NULL)) {
+            mp_raise_ValueError(translate("buffers must be the same length"));
+        }
+        other = bufinfo.buf;
+    }
+    switch (array_elem_typecode(self->typecode)) {
+        #define ARRAY_ADD_INT(c, T, LO, HI, S) \
+        case c: { \
+            T *p = self->items; \
+            if (other != NULL) { \
+                const T *q = other; \
+                for (size_t i = 0; i < n; i++) { \
+                    T r; \
+                    if (__builtin_add_overflow(p[i], q[i], &r)) { \
+                        r = q[i] > 0 ? HI : LO; \
+                    } \
+                    p[i] = r; \
+                } \
+            } else { \
+                mp_int_t v = mp_obj_get_int(arg); \
+                for (size_t i = 0; i < n; i++) { \
+                    T r; \
+                    if (__builtin_add_overflow(p[i], v, &r)) { \
+                        r = v > 0 ? HI : LO; \
+                    } \
+                    p[i] = r; \
+                } \
+            } \
+            break; \
+        }
+        ARRAY_INT_TYPES(ARRAY_ADD_INT)
+        #define ARRAY_ADD_FLOAT(c, T) \
+        case c: { \
+            T *p = self->items; \
+            if (other != NULL) { \
+                const T *q = other; \
+                for (size_t i = 0; i < n; i++) { \
+                    p[i] += q[i]; \
+                } \
+            } else { \
+                T v = (T)mp_obj_get_float(arg); \
+                for (size_t i = 0; i < n; i++) { \
+                    p[i] += v; \
+                } \
+            } \
+            break; \
+        }
+        ARRAY_FLOAT_TYPES(ARRAY_ADD_FLOAT)
+        default:
+            array_raise_unsupported();
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(array_add_obj, array_add);
+
+// scale(mul, shift=0) sets every element to (element * mul) >> shift, which
+// does fixed-point scaling on integer arrays.  For float arrays mul may be a
+// float, and the shift divides by a power of two.
+STATIC mp_obj_t array_scale(size_t n_args, const mp_obj_t *args) {
+    mp_obj_array_t *self = MP_OBJ_TO_PTR(args[0]);
+    size_t n = self->len;
+    mp_int_t shift = n_args > 2 ? mp_obj_get_int(args[2]) : 0;
+    if (shift < 0) {
+        mp_raise_ValueError(translate("negative shift count"));
+    }
+    if (shift > 63) {
+        shift = 63;
+    }
+    switch (array_elem_typecode(self->typecode)) {
+        #define ARRAY_SCALE_INT(c, T, LO, HI, S) \
+        case c: { \
+            T *p = self->items; \
+            mp_int_t m = mp_obj_get_int(args[1]); \
+            for (size_t i = 0; i < n; i++) { \
+                long long t; \
+                T r; \
+                if (__builtin_mul_overflow(p[i], m, &t)) { \
+                    r = (p[i] > 0) == (m > 0) ? HI : LO; \
+                } else { \
+                    t >>= shift; \
+                    if (t < (long long)(LO)) { \
+                        r = LO; \
+                    } else if (t > 0 && (unsigned long long)t > (unsigned long long)(HI)) { \
+                        r = HI; \
+                    } else { \
+                        r = t; \
+                    } \
+                } \
+                p[i] = r; \
+            } \
+            break; \
+        }
+        ARRAY_INT_TYPES(ARRAY_SCALE_INT)
+        #define ARRAY_SCALE_FLOAT(c, T) \
+        case c: { \
+            T *p = self->items; \
+            T m = (T)(mp_obj_get_float(args[1]) / (mp_float_t)((uint64_t)1 << shift)); \
+            for (size_t i = 0; i < n; i++) { \
+                p[i] *= m; \
+            } \
+            break; \
+        }
+        ARRAY_FLOAT_TYPES(ARRAY_SCALE_FLOAT)
+        default:
+            array_raise_unsupported();
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(array_scale_obj, 2, 3, array_scale);
+
+// Sum of unsigned bytes, adding each pair of bytes in a word into 16 bit lanes
+// and only splitting the lanes apart every 128 words, before they can overflow.
+STATIC unsigned long long array_sum_bytes(const byte *p, size_t n) {
+    const mp_uint_t lo_bytes = ((mp_uint_t)-1 / 0xffff) * 0xff;
+    unsigned long long total = 0;
+    for (; n && !WORD_ALIGNED(p); n--) {
+        total += *p++;
+    }
+    const mp_uint_t *w = (const mp_uint_t*)(const void*)p;
+    while (n >= WORD_SIZE) {
+        size_t words = MIN(n / WORD_SIZE, 128);
+        n -= words * WORD_SIZE;
+        mp_uint_t acc = 0;
+        while (words--) {
+            mp_uint_t v = *w++;
+            acc += (v & lo_bytes) + ((v >> 8) & lo_bytes);
+        }
+        for (size_t bit = 0; bit < WORD_SIZE * 8; bit += 16) {
+            total += (acc >> bit) & 0xffff;
+        }
+    }
+    p = (const byte*)w;
+    while (n--) {
+        total += *p++;
+    }
+    return total;
+}
+
+STATIC mp_obj_t array_sum(mp_obj_t self_in) {
+    mp_obj_array_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t n = self->len;
+    char typecode = array_elem_typecode(self->typecode);
+    if (typecode == 'B') {
+        return mp_obj_new_int_from_ull(array_sum_bytes(self->items, n));
+    }
+    switch (typecode) {
+        #define ARRAY_SUM_INT(c, T, LO, HI, S) \
+        case c: { \
+            const T *p = self->items; \
+            S total = 0; \
+            for (size_t i = 0; i < n; i++) { \
+                total += p[i]; \
+            } \
+            if ((LO) < 0) { \
+                return mp_obj_new_int_from_ll(total); \
+            } \
+            return mp_obj_new_int_from_ull(total); \
+        }
+        ARRAY_INT_TYPES(ARRAY_SUM_INT)
+        #define ARRAY_SUM_FLOAT(c, T) \
+        case c: { \
+            const T *p = self->items; \
+            mp_float_t total = 0; \
+            for (size_t i = 0; i < n; i++) { \
+                total += (mp_float_t)p[i]; \
+            } \
+            return mp_obj_new_float(total); \
+        }
+        ARRAY_FLOAT_TYPES(ARRAY_SUM_FLOAT)
+        default:
+            array_raise_unsupported();
+    }
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(array_sum_obj, array_sum);
+
+// Returns the index of the smallest element, or the largest if want_max.
+STATIC size_t array_find_extreme(mp_obj_array_t *self, bool want_max) {
+    size_t n = self->len;
+    if (n == 0) {
+        mp_raise_ValueError(translate("arg is an empty sequence"));
+    }
+    size_t best = 0;
+    switch (array_elem_typecode(self->typecode)) {
+        #define ARRAY_EXTREME(c, T, ...) \
+        case c: { \
+            const T *p = self->items; \
+            for (size_t i = 1; i < n; i++) { \
+                if (want_max ? p[i] > p[best] : p[i] < p[best]) { \
+                    best = i; \
+                } \
+            } \
+            break; \
+        }
+        ARRAY_INT_TYPES(ARRAY_EXTREME)
+        ARRAY_FLOAT_TYPES(ARRAY_EXTREME)
+        default:
+            array_raise_unsupported();
+    }
+    return best;
+}
+
+STATIC mp_obj_t array_min(mp_obj_t self_in) {
+    mp_obj_array_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_binary_get_val_array(self->typecode, self->items, array_find_extreme(self, false));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(array_min_obj, array_min);
+
+STATIC mp_obj_t array_max(mp_obj_t self_in) {
+    mp_obj_array_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_binary_get_val_array(self->typecode, self->items, array_find_extreme(self, true));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(array_max_obj, array_max);
+
+#define ARRAY_ELEMENTWISE_LOCALS \
+    { MP_ROM_QSTR(MP_QSTR_fill), MP_ROM_PTR(&array_fill_obj) }, \
+    { MP_ROM_QSTR(MP_QSTR_ixor), MP_ROM_PTR(&array_ixor_obj) }, \
+    { MP_ROM_QSTR(MP_QSTR_iand), MP_ROM_PTR(&array_iand_obj) }, \
+    { MP_ROM_QSTR(MP_QSTR_ior), MP_ROM_PTR(&array_ior_obj) }, \
+    { MP_ROM_QSTR(MP_QSTR_add), MP_ROM_PTR(&array_add_obj) }, \
+    { MP_ROM_QSTR(MP_QSTR_scale), MP_ROM_PTR(&array_scale_obj) }, \
+    { MP_ROM_QSTR(MP_QSTR_sum), MP_ROM_PTR(&array_sum_obj) }, \
+    { MP_ROM_QSTR(MP_QSTR_min), MP_ROM_PTR(&array_min_obj) }, \
+    { MP_ROM_QSTR(MP_QSTR_max), MP_ROM_PTR(&array_max_obj) },
+#else
+#define ARRAY_ELEMENTWISE_LOCALS
+#endif
 
 #if MICROPY_PY_ARRAY
 STATIC const mp_rom_map_elem_t array_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_append), MP_ROM_PTR(&array_append_obj) },
     { MP_ROM_QSTR(MP_QSTR_extend), MP_ROM_PTR(&array_extend_obj) },
+    ARRAY_ELEMENTWISE_LOCALS
 };
 
 STATIC MP_DEFINE_CONST_DICT(array_locals_dict, array_locals_dict_table);
@@ -583,6 +946,7 @@ STATIC const mp_rom_map_elem_t bytearray_locals_dict_table[] = {
 #if MICROPY_CPYTHON_COMPAT
     { MP_ROM_QSTR(MP_QSTR_decode), MP_ROM_PTR(&array_decode_obj) },
 #endif
+    ARRAY_ELEMENTWISE_LOCALS
 };
 
 STATIC MP_DEFINE_CONST_DICT(bytearray_locals_dict, bytearray_locals_dict_table);
@@ -619,6 +983,99 @@ const mp_obj_type_t mp_type_bytearray = {
 };
 #endif
 
+#if MICROPY_PY_BUILTINS_MEMORYVIEW && MICROPY_PY_BUILTINS_MEMORYVIEW_CAST
+// Size of one element of the given typecode, checking that a view of that type
+// starting at the given address can be read with aligned accesses.  Only
+// numeric typecodes are allowed: the bytes being viewed could be anything, and
+// reading them as 'O' or 'S' would use them as object or string pointers.
+STATIC size_t memoryview_item_size(char typecode, const void *start) {
+    if (typecode != BYTEARRAY_TYPECODE
+        && (typecode == '\0' || strchr("bBhHiIlLqQfd", typecode) == NULL)) {
+        mp_raise_ValueError(translate("bad typecode"));
+    }
+    mp_uint_t align;
+    size_t sz = mp_binary_get_size('@', typecode, &align);
+    if (sz == 0) {
+        mp_raise_ValueError(translate("bad typecode"));
+    }
+    if ((uintptr_t)start & (align - 1)) {
+        mp_raise_ValueError(translate("memoryview is not aligned for typecode"));
+    }
+    return sz;
+}
+
+// memoryview.cast(typecode): a new view of the same bytes with a different
+// element type, no data is copied
+STATIC mp_obj_t memoryview_cast(mp_obj_t self_in, mp_obj_t typecode_in) {
+    mp_obj_array_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t typecode_len;
+    const char *typecode = mp_obj_str_get_data(typecode_in, &typecode_len);
+    if (typecode_len != 1) {
+        mp_raise_ValueError(translate("bad typecode"));
+    }
+    size_t old_sz = mp_binary_get_size('@', self->typecode & TYPECODE_MASK, NULL);
+    size_t offset = self->free * old_sz;
+    size_t nbytes = self->len * old_sz;
+    size_t sz = memoryview_item_size(*typecode, (byte*)self->items + offset);
+    if (offset % sz != 0 || nbytes % sz != 0) {
+        mp_raise_ValueError(translate("memoryview length must be a multiple of itemsize"));
+    }
+    mp_obj_array_t *res = m_new_obj(mp_obj_array_t);
+    *res = *self;
+    res->typecode = *typecode | (self->typecode & MP_OBJ_ARRAY_TYPECODE_FLAG_RW);
+    res->free = offset / sz;
+    res->len = nbytes / sz;
+    return MP_OBJ_FROM_PTR(res);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(memoryview_cast_obj, memoryview_cast);
+
+// memoryview.rebind(obj, start=0, end=None): point this view at elements
+// [start:end] of obj's buffer, keeping the view's typecode.  The view object
+// is reused, so moving a window across a buffer doesn't allocate.
+STATIC mp_obj_t memoryview_rebind(size_t n_args, const mp_obj_t *args) {
+    mp_obj_array_t *self = MP_OBJ_TO_PTR(args[0]);
+
+    #if MICROPY_OPT_STR_SLICE
+    // a slice's data doesn't start a GC chunk, see memoryview_make_new
+    mp_obj_str_unslice(args[1]);
+    #endif
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_READ);
+    char typecode = self->typecode & TYPECODE_MASK;
+    size_t n = bufinfo.len / memoryview_item_size(typecode, bufinfo.buf);
+
+    mp_int_t start = 0;
+    mp_int_t end = n;
+    if (n_args > 2) {
+        start = mp_obj_get_int(args[2]);
+    }
+    if (n_args > 3 && args[3] != mp_const_none) {
+        end = mp_obj_get_int(args[3]);
+    }
+    if (start < 0 || end < start || (size_t)end > n) {
+        mp_raise_ValueError(translate("memoryview bounds out of range"));
+    }
+
+    self->typecode = typecode;
+    if (mp_get_buffer(args[1], &bufinfo, MP_BUFFER_RW)) {
+        self->typecode |= MP_OBJ_ARRAY_TYPECODE_FLAG_RW;
+    }
+    self->items = bufinfo.buf;
+    self->free = start;
+    self->len = end - start;
+    return args[0];
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(memoryview_rebind_obj, 2, 4, memoryview_rebind);
+
+STATIC const mp_rom_map_elem_t memoryview_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_cast), MP_ROM_PTR(&memoryview_cast_obj) },
+    { MP_ROM_QSTR(MP_QSTR_rebind), MP_ROM_PTR(&memoryview_rebind_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(memoryview_locals_dict, memoryview_locals_dict_table);
+#endif
+
 #if MICROPY_PY_BUILTINS_MEMORYVIEW
 const mp_obj_type_t mp_type_memoryview = {
     { &mp_type_type },
@@ -629,6 +1086,9 @@ const mp_obj_type_t mp_type_memoryview = {
     .binary_op = array_binary_op,
     .subscr = array_subscr,
     .buffer_p = { .get_buffer = array_get_buffer },
+    #if MICROPY_PY_BUILTINS_MEMORYVIEW_CAST
+    .locals_dict = (mp_obj_dict_t*)&memoryview_locals_dict,
+    #endif
 };
 #endif
 
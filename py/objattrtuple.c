@@ -25,6 +25,7 @@
  */
 
 #include "py/objtuple.h"
+#include "py/objnamedtuple.h"
 
 #if MICROPY_PY_ATTRTUPLE || MICROPY_PY_COLLECTIONS
 
@@ -44,6 +45,25 @@ void mp_obj_attrtuple_print_helper(const mp_print_t *print, const qstr *fields,
     mp_print_str(print, ")");
 }
 
+// Returns the field names of a namedtuple or attrtuple, which are the same
+// length as the tuple itself, or NULL if the object is neither.  This lets
+// the VM cache the index of a field that a LOAD_ATTR opcode refers to.
+const qstr *mp_obj_attrtuple_get_fields(const mp_obj_type_t *type, mp_obj_t o_in) {
+    #if MICROPY_PY_COLLECTIONS
+    if (type->attr == namedtuple_attr) {
+        return ((const mp_obj_namedtuple_type_t*)type)->fields;
+    }
+    #endif
+    #if MICROPY_PY_ATTRTUPLE
+    if (type == &mp_type_attrtuple) {
+        mp_obj_tuple_t *o = MP_OBJ_TO_PTR(o_in);
+        return (const qstr*)MP_OBJ_TO_PTR(o->items[o->len]);
+    }
+    #endif
+    (void)o_in;
+    return NULL;
+}
+
 #endif
 
 #if MICROPY_PY_ATTRTUPLE
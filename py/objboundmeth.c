@@ -112,9 +112,24 @@ STATIC const mp_obj_type_t mp_type_bound_meth = {
 };
 
 mp_obj_t mp_obj_new_bound_meth(mp_obj_t meth, mp_obj_t self) {
+    #if MICROPY_OPT_BOUND_METH_CACHE
+    // A bound method never changes, so one can be shared by every load of the
+    // same method of the same object.
+    uintptr_t hash = ((uintptr_t)self >> 4) ^ ((uintptr_t)meth >> 2);
+    mp_obj_t *entry = &MP_STATE_VM(bound_meth_cache)[hash & (MICROPY_OPT_BOUND_METH_CACHE_SIZE - 1)];
+    if (*entry != MP_OBJ_NULL) {
+        mp_obj_bound_meth_t *cached = MP_OBJ_TO_PTR(*entry);
+        if (cached->meth == meth && cached->self == self) {
+            return *entry;
+        }
+    }
+    #endif
     mp_obj_bound_meth_t *o = m_new_obj(mp_obj_bound_meth_t);
     o->base.type = &mp_type_bound_meth;
     o->meth = meth;
     o->self = self;
+    #if MICROPY_OPT_BOUND_METH_CACHE
+    *entry = MP_OBJ_FROM_PTR(o);
+    #endif
     return MP_OBJ_FROM_PTR(o);
 }
@@ -32,6 +32,7 @@
 
 #if MICROPY_PY_COLLECTIONS_DEQUE
 
+#include "py/objlist.h"
 #include "py/runtime.h"
 
 typedef struct _mp_obj_deque_t {
@@ -42,48 +43,62 @@ typedef struct _mp_obj_deque_t {
     mp_obj_t *items;
     uint32_t flags;
     #define FLAG_CHECK_OVERFLOW 1
+    // Set when no maxlen was given, so the items grow as needed.
+    #define FLAG_GROWABLE 2
 } mp_obj_deque_t;
 
-STATIC mp_obj_t deque_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
-    mp_arg_check_num(n_args, kw_args, 2, 3, false);
+// The first allocation of a deque without maxlen, which holds one less item.
+#define DEQUE_MIN_ALLOC (4)
 
-    /* Initialization from existing sequence is not supported, so an empty
-       tuple must be passed as such. */
-    if (args[0] != mp_const_empty_tuple) {
-        mp_raise_ValueError(NULL);
-    }
+STATIC mp_obj_t deque_extend(mp_obj_t self_in, mp_obj_t arg_in);
 
-    // Protect against -1 leading to zero-length allocation and bad array access
-    mp_int_t maxlen = mp_obj_get_int(args[1]);
-    if (maxlen < 0) {
-        mp_raise_ValueError(NULL);
-    }
+STATIC mp_obj_t deque_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
+    mp_arg_check_num(n_args, kw_args, 0, 3, false);
 
     mp_obj_deque_t *o = m_new_obj(mp_obj_deque_t);
     o->base.type = type;
-    o->alloc = maxlen + 1;
+    o->flags = 0;
+
+    if (n_args > 2) {
+        o->flags = mp_obj_get_int(args[2]) & FLAG_CHECK_OVERFLOW;
+    }
+
+    if (n_args < 2 || args[1] == mp_const_none) {
+        o->flags |= FLAG_GROWABLE;
+        o->alloc = DEQUE_MIN_ALLOC;
+    } else {
+        // Protect against -1 leading to zero-length allocation and bad array access
+        mp_int_t maxlen = mp_obj_get_int(args[1]);
+        if (maxlen < 0) {
+            mp_raise_ValueError(NULL);
+        }
+        o->alloc = maxlen + 1;
+    }
     o->i_get = o->i_put = 0;
     o->items = m_new0(mp_obj_t, o->alloc);
 
-    if (n_args > 2) {
-        o->flags = mp_obj_get_int(args[2]);
+    if (n_args > 0 && args[0] != mp_const_empty_tuple) {
+        deque_extend(MP_OBJ_FROM_PTR(o), args[0]);
     }
 
     return MP_OBJ_FROM_PTR(o);
 }
 
+STATIC size_t deque_len(mp_obj_deque_t *self) {
+    ssize_t len = self->i_put - self->i_get;
+    if (len < 0) {
+        len += self->alloc;
+    }
+    return len;
+}
+
 STATIC mp_obj_t deque_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
     mp_obj_deque_t *self = MP_OBJ_TO_PTR(self_in);
     switch (op) {
         case MP_UNARY_OP_BOOL:
             return mp_obj_new_bool(self->i_get != self->i_put);
-        case MP_UNARY_OP_LEN: {
-            ssize_t len = self->i_put - self->i_get;
-            if (len < 0) {
-                len += self->alloc;
-            }
-            return MP_OBJ_NEW_SMALL_INT(len);
-        }
+        case MP_UNARY_OP_LEN:
+            return MP_OBJ_NEW_SMALL_INT(deque_len(self));
         #if MICROPY_PY_SYS_GETSIZEOF
         case MP_UNARY_OP_SIZEOF: {
             size_t sz = sizeof(*self) + sizeof(mp_obj_t) * self->alloc;
@@ -95,48 +110,165 @@ STATIC mp_obj_t deque_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
     }
 }
 
-STATIC mp_obj_t mp_obj_deque_append(mp_obj_t self_in, mp_obj_t arg) {
-    mp_obj_deque_t *self = MP_OBJ_TO_PTR(self_in);
-
-    size_t new_i_put = self->i_put + 1;
-    if (new_i_put == self->alloc) {
-        new_i_put = 0;
+// Makes room for len more items in a growable deque. The items are reallocated in place when the
+// heap allows and any that wrap around the old end are moved in one go.
+STATIC void deque_reserve(mp_obj_deque_t *self, size_t len) {
+    size_t needed = deque_len(self) + len + 1;
+    if (needed <= self->alloc) {
+        return;
     }
+    size_t old_alloc = self->alloc;
+    size_t new_alloc = MAX(old_alloc * 2, needed);
+    self->items = m_renew(mp_obj_t, self->items, old_alloc, new_alloc);
+    self->alloc = new_alloc;
+    if (self->i_put < self->i_get) {
+        // Move the items from i_get to the old end up to the new end.
+        size_t tail = old_alloc - self->i_get;
+        memmove(self->items + new_alloc - tail, self->items + self->i_get, tail * sizeof(mp_obj_t));
+        mp_seq_clear(self->items, self->i_get, new_alloc - tail, sizeof(*self->items));
+        self->i_get = new_alloc - tail;
+    } else {
+        mp_seq_clear(self->items, old_alloc, new_alloc, sizeof(*self->items));
+    }
+}
 
-    if (self->flags & FLAG_CHECK_OVERFLOW && new_i_put == self->i_get) {
-        mp_raise_msg(&mp_type_IndexError, translate("full"));
+// Adds len items at the end, with at most two copies. A full deque with a maxlen drops its
+// oldest items to make room, or raises if it checks for overflow.
+STATIC void deque_put(mp_obj_deque_t *self, const mp_obj_t *items, size_t len) {
+    size_t current = deque_len(self);
+    if (self->flags & FLAG_GROWABLE) {
+        deque_reserve(self, len);
+    }
+    size_t capacity = self->alloc - 1;
+    if (current + len > capacity) {
+        // Only a deque with a maxlen can be full.
+        if (self->flags & FLAG_CHECK_OVERFLOW) {
+            mp_raise_msg(&mp_type_IndexError, translate("full"));
+        }
+        if (len >= capacity) {
+            // Only the last items are kept.
+            items += len - capacity;
+            len = capacity;
+            self->i_get = self->i_put = 0;
+            current = 0;
+        }
     }
 
-    self->items[self->i_put] = arg;
-    self->i_put = new_i_put;
+    size_t first = MIN(len, self->alloc - self->i_put);
+    memcpy(self->items + self->i_put, items, first * sizeof(mp_obj_t));
+    memcpy(self->items, items + first, (len - first) * sizeof(mp_obj_t));
+    self->i_put += len;
+    if (self->i_put >= self->alloc) {
+        self->i_put -= self->alloc;
+    }
 
-    if (self->i_get == new_i_put) {
-        if (++self->i_get == self->alloc) {
+    if (current + len > capacity) {
+        // The oldest items were overwritten.
+        self->i_get = self->i_put + 1;
+        if (self->i_get == self->alloc) {
             self->i_get = 0;
         }
     }
+}
 
+STATIC mp_obj_t mp_obj_deque_append(mp_obj_t self_in, mp_obj_t arg) {
+    mp_obj_deque_t *self = MP_OBJ_TO_PTR(self_in);
+    deque_put(self, &arg, 1);
     return mp_const_none;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(deque_append_obj, mp_obj_deque_append);
 
-STATIC mp_obj_t deque_popleft(mp_obj_t self_in) {
+STATIC mp_obj_t deque_extend(mp_obj_t self_in, mp_obj_t arg_in) {
     mp_obj_deque_t *self = MP_OBJ_TO_PTR(self_in);
 
-    if (self->i_get == self->i_put) {
-        mp_raise_msg(&mp_type_IndexError, translate("empty"));
+    if (MP_OBJ_IS_TYPE(arg_in, &mp_type_tuple) || MP_OBJ_IS_TYPE(arg_in, &mp_type_list)) {
+        // Copy the items over all at once.
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_get_array(arg_in, &len, &items);
+        deque_put(self, items, len);
+        return mp_const_none;
+    }
+
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t iterable = mp_getiter(arg_in, &iter_buf);
+    if ((self->flags & (FLAG_GROWABLE | FLAG_CHECK_OVERFLOW)) == FLAG_CHECK_OVERFLOW) {
+        // Fail before adding anything when the length is known.  The items of an
+        // iterator of unknown length, eg a generator, are added one at a time
+        // until the deque is full, and those stay added.
+        size_t len = mp_obj_length_hint(arg_in);
+        if (len == 0) {
+            len = mp_obj_length_hint(iterable);
+        }
+        if (deque_len(self) + len > self->alloc - 1) {
+            mp_raise_msg(&mp_type_IndexError, translate("full"));
+        }
+    }
+    mp_obj_t item;
+    while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+        deque_put(self, &item, 1);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(deque_extend_obj, deque_extend);
+
+// Moves len items from the front into dest, with at most two copies.
+STATIC void deque_take(mp_obj_deque_t *self, mp_obj_t *dest, size_t len) {
+    size_t first = MIN(len, self->alloc - self->i_get);
+    memcpy(dest, self->items + self->i_get, first * sizeof(mp_obj_t));
+    mp_seq_clear(self->items, self->i_get, self->i_get + first, sizeof(*self->items));
+    memcpy(dest + first, self->items, (len - first) * sizeof(mp_obj_t));
+    mp_seq_clear(self->items, 0, len - first, sizeof(*self->items));
+    self->i_get += len;
+    if (self->i_get >= self->alloc) {
+        self->i_get -= self->alloc;
     }
+}
 
-    mp_obj_t ret = self->items[self->i_get];
-    self->items[self->i_get] = MP_OBJ_NULL;
+STATIC mp_obj_t deque_popleft(size_t n_args, const mp_obj_t *args) {
+    mp_obj_deque_t *self = MP_OBJ_TO_PTR(args[0]);
 
-    if (++self->i_get == self->alloc) {
-        self->i_get = 0;
+    if (n_args == 1) {
+        if (self->i_get == self->i_put) {
+            mp_raise_msg(&mp_type_IndexError, translate("empty"));
+        }
+        mp_obj_t ret;
+        deque_take(self, &ret, 1);
+        return ret;
     }
 
-    return ret;
+    // With a count, that many items are returned in a list.
+    mp_int_t len = mp_obj_get_int(args[1]);
+    if (len < 0) {
+        mp_raise_ValueError(NULL);
+    }
+    if ((size_t)len > deque_len(self)) {
+        mp_raise_msg(&mp_type_IndexError, translate("empty"));
+    }
+    mp_obj_list_t *list = MP_OBJ_TO_PTR(mp_obj_new_list(len, NULL));
+    deque_take(self, list->items, len);
+    return MP_OBJ_FROM_PTR(list);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(deque_popleft_obj, 1, 2, deque_popleft);
+
+STATIC mp_obj_t deque_subscr(mp_obj_t self_in, mp_obj_t index, mp_obj_t value) {
+    if (value == MP_OBJ_NULL) {
+        // delete not supported
+        return MP_OBJ_NULL;
+    }
+    mp_obj_deque_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t i = mp_get_index(self->base.type, deque_len(self), index, false) + self->i_get;
+    if (i >= self->alloc) {
+        i -= self->alloc;
+    }
+    if (value == MP_OBJ_SENTINEL) {
+        // load
+        return self->items[i];
+    }
+    // store
+    self->items[i] = value;
+    return mp_const_none;
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_1(deque_popleft_obj, deque_popleft);
 
 #if 0
 STATIC mp_obj_t deque_clear(mp_obj_t self_in) {
@@ -153,6 +285,7 @@ STATIC const mp_rom_map_elem_t deque_locals_dict_table[] = {
     #if 0
     { MP_ROM_QSTR(MP_QSTR_clear), MP_ROM_PTR(&deque_clear_obj) },
     #endif
+    { MP_ROM_QSTR(MP_QSTR_extend), MP_ROM_PTR(&deque_extend_obj) },
     { MP_ROM_QSTR(MP_QSTR_popleft), MP_ROM_PTR(&deque_popleft_obj) },
 };
 
@@ -163,6 +296,7 @@ const mp_obj_type_t mp_type_deque = {
     .name = MP_QSTR_deque,
     .make_new = deque_make_new,
     .unary_op = deque_unary_op,
+    .subscr = deque_subscr,
     .locals_dict = (mp_obj_dict_t*)&deque_locals_dict,
 };
 
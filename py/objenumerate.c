@@ -89,4 +89,9 @@ STATIC mp_obj_t enumerate_iternext(mp_obj_t self_in) {
     }
 }
 
+size_t mp_obj_enumerate_length_hint(mp_obj_t self_in) {
+    mp_obj_enumerate_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_length_hint(self->iter);
+}
+
 #endif // MICROPY_PY_BUILTINS_ENUMERATE
@@ -336,8 +336,55 @@ mp_obj_t mp_obj_new_exception(const mp_obj_type_t *exc_type) {
     return mp_obj_new_exception_args(exc_type, 0, NULL);
 }
 
+#if MICROPY_OPT_FAST_RAISE
+// Errors that non-blocking and timed out IO raise over and over, with the args
+// tuple they share.
+STATIC const mp_rom_obj_tuple_t eagain_args = {{&mp_type_tuple}, 1, {MP_ROM_INT(MP_EAGAIN)}};
+STATIC const mp_rom_obj_tuple_t etimedout_args = {{&mp_type_tuple}, 1, {MP_ROM_INT(MP_ETIMEDOUT)}};
+STATIC const mp_rom_obj_tuple_t *const common_errno_args[] = {
+    &eagain_args,
+    &etimedout_args,
+};
+
+void mp_init_stop_iteration(void) {
+    mp_obj_exception_t *o = &MP_STATE_THREAD(stop_iteration);
+    o->base.type = &mp_type_StopIteration;
+    o->traceback_alloc = 0;
+    o->traceback_len = 0;
+    o->traceback_data = NULL;
+    o->args = (mp_obj_tuple_t*)&mp_const_empty_tuple_obj;
+}
+#endif
+
+mp_obj_t mp_obj_new_stop_iteration(void) {
+    #if MICROPY_OPT_FAST_RAISE
+    mp_obj_exception_t *o = &MP_STATE_THREAD(stop_iteration);
+    #if MICROPY_ENABLE_EMERGENCY_EXCEPTION_BUF
+    if (o->traceback_data == (size_t*)MP_STATE_VM(mp_emergency_exception_buf)) {
+        // another exception may be using the emergency buffer by now
+        o->traceback_data = NULL;
+    }
+    #endif
+    // keep the traceback storage from the last raise, but start over in it
+    o->traceback_len = 0;
+    return MP_OBJ_FROM_PTR(o);
+    #else
+    return mp_obj_new_exception(&mp_type_StopIteration);
+    #endif
+}
+
 // "Optimized" version for common(?) case of having 1 exception arg
 mp_obj_t mp_obj_new_exception_arg1(const mp_obj_type_t *exc_type, mp_obj_t arg) {
+    #if MICROPY_OPT_FAST_RAISE
+    for (size_t i = 0; i < MP_ARRAY_SIZE(common_errno_args); i++) {
+        if (arg == common_errno_args[i]->items[0]) {
+            // tuples are immutable, so the args can be shared
+            mp_obj_exception_t *o = MP_OBJ_TO_PTR(mp_obj_new_exception(exc_type));
+            o->args = (mp_obj_tuple_t*)common_errno_args[i];
+            return MP_OBJ_FROM_PTR(o);
+        }
+    }
+    #endif
     return mp_obj_new_exception_args(exc_type, 1, &arg);
 }
 
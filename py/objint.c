@@ -264,6 +264,10 @@ char *mp_obj_int_formatted(char **buf, size_t *buf_size, size_t *fmt_size, mp_co
 
     if (num == 0) {
         *(--b) = '0';
+    #if MICROPY_OPT_FAST_NUM_FORMAT
+    } else if (base == 10 && !comma) {
+        b = mp_format_dec(b, (fmt_uint_t)num);
+    #endif
     } else {
         do {
             // The cast to fmt_uint_t is because num is positive and we want unsigned arithmetic
@@ -60,7 +60,17 @@ STATIC void list_print(const mp_print_t *print, mp_obj_t o_in, mp_print_kind_t k
 }
 
 STATIC mp_obj_t list_extend_from_iter(mp_obj_t list, mp_obj_t iterable) {
-    mp_obj_t iter = mp_getiter(iterable, NULL);
+    // Make room for all the items at once if we can tell how many are coming
+    mp_obj_list_t *self = MP_OBJ_TO_PTR(list);
+    size_t hint = mp_obj_length_hint(iterable);
+    if (hint > self->alloc - self->len) {
+        self->items = m_renew(mp_obj_t, self->items, self->alloc, self->len + hint);
+        mp_seq_clear(self->items, self->len, self->len + hint, sizeof(*self->items));
+        self->alloc = self->len + hint;
+    }
+
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t iter = mp_getiter(iterable, &iter_buf);
     mp_obj_t item;
     while ((item = mp_iternext(iter)) != MP_OBJ_STOP_ITERATION) {
         mp_obj_list_append(list, item);
@@ -85,7 +95,6 @@ STATIC mp_obj_t list_make_new(const mp_obj_type_t *type_in, size_t n_args, const
         case 1:
         default: {
             // make list from iterable
-            // TODO: optimize list/tuple
             mp_obj_t list = mp_obj_new_list(0, NULL);
             return list_extend_from_iter(list, args[0]);
         }
@@ -317,7 +326,232 @@ STATIC void mp_quicksort(mp_obj_t *head, mp_obj_t *tail, mp_obj_t key_fn, mp_obj
     }
 }
 
-// TODO Python defines sort to be stable but ours is not
+#if MICROPY_OPT_LIST_TIMSORT
+
+// Enough for any list that fits in memory, given that run lengths shrink at
+// least as fast as the Fibonacci numbers and all but the last are >= 32 long.
+#define LIST_SORT_MAX_RUNS (40)
+
+// The timsort works on elements of w words: the item alone, or the item's key
+// followed by the item. Elements are compared on their first word.
+typedef struct _list_sort_t {
+    mp_obj_t *tmp;
+    size_t w;
+    bool reverse;
+    size_t n_runs;
+    struct {
+        mp_obj_t *base;
+        size_t len;
+    } runs[LIST_SORT_MAX_RUNS];
+} list_sort_t;
+
+// Whether a sorts strictly before b.
+STATIC bool list_sort_lt(const list_sort_t *s, mp_obj_t a, mp_obj_t b) {
+    if (s->reverse) {
+        mp_obj_t t = a;
+        a = b;
+        b = t;
+    }
+    if (MP_OBJ_IS_SMALL_INT(a) && MP_OBJ_IS_SMALL_INT(b)) {
+        return MP_OBJ_SMALL_INT_VALUE(a) < MP_OBJ_SMALL_INT_VALUE(b);
+    }
+    return mp_obj_is_true(mp_binary_op(MP_BINARY_OP_LESS, a, b));
+}
+
+STATIC void list_sort_copy(const list_sort_t *s, mp_obj_t *dest, const mp_obj_t *src, size_t n) {
+    memmove(dest, src, n * s->w * sizeof(mp_obj_t));
+}
+
+// Number of elements of a[0:n] that sort before or equal to key, so that key
+// goes after them.
+STATIC size_t list_sort_upper(const list_sort_t *s, mp_obj_t key, const mp_obj_t *a, size_t n) {
+    size_t lo = 0;
+    while (lo < n) {
+        size_t mid = lo + (n - lo) / 2;
+        if (list_sort_lt(s, key, a[mid * s->w])) {
+            n = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+// Number of elements of a[0:n] that sort strictly before key.
+STATIC size_t list_sort_lower(const list_sort_t *s, mp_obj_t key, const mp_obj_t *a, size_t n) {
+    size_t lo = 0;
+    while (lo < n) {
+        size_t mid = lo + (n - lo) / 2;
+        if (list_sort_lt(s, a[mid * s->w], key)) {
+            lo = mid + 1;
+        } else {
+            n = mid;
+        }
+    }
+    return lo;
+}
+
+// Sort a[0:n] by binary insertion, given that a[0:sorted] is already sorted.
+// The element being inserted is held in tmp while the others move up.
+STATIC void list_sort_insertion(list_sort_t *s, mp_obj_t *a, size_t sorted, size_t n) {
+    size_t w = s->w;
+    for (size_t i = sorted; i < n; i++) {
+        size_t pos = list_sort_upper(s, a[i * w], a, i);
+        if (pos < i) {
+            list_sort_copy(s, s->tmp, &a[i * w], 1);
+            list_sort_copy(s, &a[(pos + 1) * w], &a[pos * w], i - pos);
+            list_sort_copy(s, &a[pos * w], s->tmp, 1);
+        }
+    }
+}
+
+// Length of the run at the start of a[0:n], reversing it if it's descending.
+// Only strictly descending runs are reversed, which keeps the sort stable.
+STATIC size_t list_sort_count_run(list_sort_t *s, mp_obj_t *a, size_t n) {
+    size_t w = s->w;
+    if (n < 2) {
+        return n;
+    }
+    size_t len = 2;
+    if (list_sort_lt(s, a[w], a[0])) {
+        while (len < n && list_sort_lt(s, a[len * w], a[(len - 1) * w])) {
+            len++;
+        }
+        for (size_t i = 0, j = len - 1; i < j; i++, j--) {
+            list_sort_copy(s, s->tmp, &a[i * w], 1);
+            list_sort_copy(s, &a[i * w], &a[j * w], 1);
+            list_sort_copy(s, &a[j * w], s->tmp, 1);
+        }
+    } else {
+        while (len < n && !list_sort_lt(s, a[len * w], a[(len - 1) * w])) {
+            len++;
+        }
+    }
+    return len;
+}
+
+// Merge runs i and i + 1, which are next to each other. Elements at the
+// start of the first run and the end of the second that are already in place
+// are left alone, and only the shorter of what remains is copied to tmp.
+STATIC void list_sort_merge_at(list_sort_t *s, size_t i) {
+    size_t w = s->w;
+    mp_obj_t *a = s->runs[i].base;
+    size_t na = s->runs[i].len;
+    mp_obj_t *b = s->runs[i + 1].base;
+    size_t nb = s->runs[i + 1].len;
+    s->runs[i].len = na + nb;
+    for (size_t j = i + 1; j + 1 < s->n_runs; j++) {
+        s->runs[j] = s->runs[j + 1];
+    }
+    s->n_runs--;
+
+    size_t k = list_sort_upper(s, b[0], a, na);
+    a += k * w;
+    na -= k;
+    if (na == 0) {
+        return;
+    }
+    nb = list_sort_lower(s, a[(na - 1) * w], b, nb);
+    if (nb == 0) {
+        return;
+    }
+
+    mp_obj_t *tmp = s->tmp;
+    if (na <= nb) {
+        // merge from the front, taking from b only when strictly before
+        list_sort_copy(s, tmp, a, na);
+        mp_obj_t *dest = a;
+        size_t ia = 0, ib = 0;
+        while (ia < na && ib < nb) {
+            if (list_sort_lt(s, b[ib * w], tmp[ia * w])) {
+                list_sort_copy(s, dest, &b[ib++ * w], 1);
+            } else {
+                list_sort_copy(s, dest, &tmp[ia++ * w], 1);
+            }
+            dest += w;
+        }
+        list_sort_copy(s, dest, &tmp[ia * w], na - ia);
+    } else {
+        // merge from the back, taking from a only when strictly after
+        list_sort_copy(s, tmp, b, nb);
+        mp_obj_t *dest = b + nb * w;
+        size_t ia = na, ib = nb;
+        while (ia > 0 && ib > 0) {
+            dest -= w;
+            if (list_sort_lt(s, tmp[(ib - 1) * w], a[(ia - 1) * w])) {
+                list_sort_copy(s, dest, &a[--ia * w], 1);
+            } else {
+                list_sort_copy(s, dest, &tmp[--ib * w], 1);
+            }
+        }
+        list_sort_copy(s, a, tmp, ib);
+    }
+}
+
+// Merge runs until the lengths on the run stack shrink at least as fast as
+// the Fibonacci numbers, which keeps merges balanced and the stack short.
+STATIC void list_sort_merge_collapse(list_sort_t *s) {
+    while (s->n_runs > 1) {
+        size_t n = s->n_runs - 2;
+        if ((n > 0 && s->runs[n - 1].len <= s->runs[n].len + s->runs[n + 1].len)
+            || (n > 1 && s->runs[n - 2].len <= s->runs[n - 1].len + s->runs[n].len)) {
+            if (s->runs[n - 1].len < s->runs[n + 1].len) {
+                n--;
+            }
+        } else if (s->runs[n].len > s->runs[n + 1].len) {
+            break;
+        }
+        list_sort_merge_at(s, n);
+    }
+}
+
+// Runs shorter than this are extended by insertion sort. Like CPython, pick a
+// value between 32 and 64 that makes n / min_run a power of 2 or just below.
+STATIC size_t list_sort_min_run(size_t n) {
+    size_t r = 0;
+    while (n >= 64) {
+        r |= n & 1;
+        n >>= 1;
+    }
+    return n + r;
+}
+
+// Stable sort of the n elements of a, using tmp to hold up to n / 2 of them.
+STATIC void list_timsort(mp_obj_t *a, size_t n, mp_obj_t *tmp, size_t w, bool reverse) {
+    list_sort_t s;
+    s.tmp = tmp;
+    s.w = w;
+    s.reverse = reverse;
+    s.n_runs = 0;
+    size_t min_run = list_sort_min_run(n);
+    while (n > 0) {
+        size_t len = list_sort_count_run(&s, a, n);
+        if (len < min_run) {
+            size_t forced = min_run < n ? min_run : n;
+            list_sort_insertion(&s, a, len, forced);
+            len = forced;
+        }
+        assert(s.n_runs < LIST_SORT_MAX_RUNS);
+        s.runs[s.n_runs].base = a;
+        s.runs[s.n_runs].len = len;
+        s.n_runs++;
+        list_sort_merge_collapse(&s);
+        a += len * w;
+        n -= len;
+    }
+    while (s.n_runs > 1) {
+        size_t i = s.n_runs - 2;
+        if (i > 0 && s.runs[i - 1].len < s.runs[i + 1].len) {
+            i--;
+        }
+        list_sort_merge_at(&s, i);
+    }
+}
+
+#endif
+
+// TODO Python defines sort to be stable but the quicksort is not, which is
+// only used without MICROPY_OPT_LIST_TIMSORT or if its buffer can't be allocated
 mp_obj_t mp_obj_list_sort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_key, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_PTR(&mp_const_none_obj)} },
@@ -335,8 +569,36 @@ mp_obj_t mp_obj_list_sort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_
     mp_obj_list_t *self = mp_instance_cast_to_native_base(pos_args[0], &mp_type_list);
 
     if (self->len > 1) {
-        mp_quicksort(self->items, self->items + self->len - 1,
-                     args.key.u_obj == mp_const_none ? MP_OBJ_NULL : args.key.u_obj,
+        mp_obj_t key_fn = args.key.u_obj == mp_const_none ? MP_OBJ_NULL : args.key.u_obj;
+        #if MICROPY_OPT_LIST_TIMSORT
+        // Sort a copy of the items, each after its key if there is a key
+        // function, so that keys are only computed once and an exception
+        // from a comparison leaves the list as it was.
+        size_t n = self->len;
+        size_t w = key_fn == MP_OBJ_NULL ? 1 : 2;
+        mp_obj_t *buf = m_new_maybe(mp_obj_t, (n + n / 2) * w);
+        if (buf != NULL) {
+            for (size_t i = 0; i < n; i++) {
+                buf[i * w + w - 1] = self->items[i];
+            }
+            if (key_fn != MP_OBJ_NULL) {
+                for (size_t i = 0; i < n; i++) {
+                    buf[i * 2] = mp_call_function_1(key_fn, buf[i * 2 + 1]);
+                }
+            }
+            list_timsort(buf, n, buf + n * w, w, args.reverse.u_bool);
+            // A key function or comparison that changed the length of the
+            // list wins over the sort.
+            if (self->len == n) {
+                for (size_t i = 0; i < n; i++) {
+                    self->items[i] = buf[i * w + w - 1];
+                }
+            }
+            m_del(mp_obj_t, buf, (n + n / 2) * w);
+            return mp_const_none;
+        }
+        #endif
+        mp_quicksort(self->items, self->items + self->len - 1, key_fn,
                      args.reverse.u_bool ? mp_const_false : mp_const_true);
     }
 
@@ -505,14 +767,7 @@ void mp_obj_list_store(mp_obj_t self_in, mp_obj_t index, mp_obj_t value) {
 /******************************************************************************/
 /* list iterator                                                              */
 
-typedef struct _mp_obj_list_it_t {
-    mp_obj_base_t base;
-    mp_fun_1_t iternext;
-    mp_obj_t list;
-    size_t cur;
-} mp_obj_list_it_t;
-
-STATIC mp_obj_t list_it_iternext(mp_obj_t self_in) {
+mp_obj_t mp_obj_list_it_iternext(mp_obj_t self_in) {
     mp_obj_list_it_t *self = MP_OBJ_TO_PTR(self_in);
     mp_obj_list_t *list = MP_OBJ_TO_PTR(self->list);
     if (self->cur < list->len) {
@@ -528,7 +783,7 @@ mp_obj_t mp_obj_new_list_iterator(mp_obj_t list, size_t cur, mp_obj_iter_buf_t *
     assert(sizeof(mp_obj_list_it_t) <= sizeof(mp_obj_iter_buf_t));
     mp_obj_list_it_t *o = (mp_obj_list_it_t*)iter_buf;
     o->base.type = &mp_type_polymorph_iter;
-    o->iternext = list_it_iternext;
+    o->iternext = mp_obj_list_it_iternext;
     o->list = list;
     o->cur = cur;
     return MP_OBJ_FROM_PTR(o);
@@ -64,6 +64,11 @@ STATIC mp_obj_t map_iternext(mp_obj_t self_in) {
     return mp_call_function_n_kw(self->fun, self->n_iters, 0, nextses);
 }
 
+size_t mp_obj_map_length_hint(mp_obj_t self_in) {
+    mp_obj_map_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_length_hint_min(self->n_iters, self->iters);
+}
+
 const mp_obj_type_t mp_type_map = {
     { &mp_type_type },
     .name = MP_QSTR_map,
@@ -63,6 +63,49 @@ STATIC mp_obj_t namedtuple_asdict(mp_obj_t self_in) {
 MP_DEFINE_CONST_FUN_OBJ_1(namedtuple_asdict_obj, namedtuple_asdict);
 #endif
 
+#if MICROPY_PY_COLLECTIONS_NAMEDTUPLE__MAKE
+// Fills the fields straight from the iterable, without making an
+// intermediate tuple of the arguments.
+STATIC mp_obj_t namedtuple_make(mp_obj_t type_in, mp_obj_t iterable) {
+    const mp_obj_namedtuple_type_t *type = MP_OBJ_TO_PTR(type_in);
+    if (type->base.make_new != namedtuple_make_new) {
+        // a user subclass, which may have its own constructor
+        size_t n_args;
+        mp_obj_t *args;
+        mp_obj_get_array(mp_call_function_1(MP_OBJ_FROM_PTR(&mp_type_tuple), iterable), &n_args, &args);
+        return mp_call_function_n_kw(type_in, n_args, 0, args);
+    }
+    size_t num_fields = type->n_fields;
+    mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(num_fields, NULL));
+    tuple->base.type = &type->base;
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t iter = mp_getiter(iterable, &iter_buf);
+    size_t n = 0;
+    mp_obj_t item;
+    while ((item = mp_iternext(iter)) != MP_OBJ_STOP_ITERATION) {
+        if (n < num_fields) {
+            tuple->items[n] = item;
+        }
+        n++;
+    }
+    if (n != num_fields) {
+        if (MICROPY_ERROR_REPORTING == MICROPY_ERROR_REPORTING_TERSE) {
+            mp_arg_error_terse_mismatch();
+        } else {
+            mp_raise_TypeError_varg(translate("function takes %d positional arguments but %d were given"), num_fields, n);
+        }
+    }
+    return MP_OBJ_FROM_PTR(tuple);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(namedtuple_make_fun_obj, namedtuple_make);
+STATIC MP_DEFINE_CONST_CLASSMETHOD_OBJ(namedtuple_make_obj, MP_ROM_PTR(&namedtuple_make_fun_obj));
+
+STATIC const mp_rom_map_elem_t namedtuple_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR__make), MP_ROM_PTR(&namedtuple_make_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(namedtuple_locals_dict, namedtuple_locals_dict_table);
+#endif
+
 void namedtuple_print(const mp_print_t *print, mp_obj_t o_in, mp_print_kind_t kind) {
     (void)kind;
     mp_obj_namedtuple_t *o = MP_OBJ_TO_PTR(o_in);
@@ -75,6 +118,13 @@ void namedtuple_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
     if (dest[0] == MP_OBJ_NULL) {
         // load attribute
         mp_obj_namedtuple_t *self = MP_OBJ_TO_PTR(self_in);
+        // Field names win over the methods, as they do in the field index
+        // cache of LOAD_ATTR in vm.c, which doesn't come here.
+        size_t id = mp_obj_namedtuple_find_field((mp_obj_namedtuple_type_t*)self->tuple.base.type, attr);
+        if (id != (size_t)-1) {
+            dest[0] = self->tuple.items[id];
+            return;
+        }
         #if MICROPY_PY_COLLECTIONS_NAMEDTUPLE__ASDICT
         if (attr == MP_QSTR__asdict) {
             dest[0] = MP_OBJ_FROM_PTR(&namedtuple_asdict_obj);
@@ -82,11 +132,13 @@ void namedtuple_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
             return;
         }
         #endif
-        size_t id = mp_obj_namedtuple_find_field((mp_obj_namedtuple_type_t*)self->tuple.base.type, attr);
-        if (id == (size_t)-1) {
+        #if MICROPY_PY_COLLECTIONS_NAMEDTUPLE__MAKE
+        if (attr == MP_QSTR__make && self->tuple.base.type->make_new == namedtuple_make_new) {
+            dest[0] = MP_OBJ_FROM_PTR(&namedtuple_make_fun_obj);
+            dest[1] = MP_OBJ_FROM_PTR(self->tuple.base.type);
             return;
         }
-        dest[0] = self->tuple.items[id];
+        #endif
     } else {
         // delete/store attribute
         // provide more detailed error message than we'd get by just returning
@@ -171,6 +223,9 @@ STATIC mp_obj_t mp_obj_new_namedtuple_type(qstr name, size_t n_fields, mp_obj_t
     o->base.subscr = mp_obj_tuple_subscr;
     o->base.getiter = mp_obj_tuple_getiter;
     o->base.parent = &mp_type_tuple;
+    #if MICROPY_PY_COLLECTIONS_NAMEDTUPLE__MAKE
+    o->base.locals_dict = (mp_obj_dict_t*)&namedtuple_locals_dict;
+    #endif
     return MP_OBJ_FROM_PTR(o);
 }
 
@@ -34,6 +34,7 @@
 #include "py/objtype.h"
 #include "py/runtime.h"
 #include "py/stackctrl.h"
+#include "py/gc.h"
 
 #include "supervisor/shared/translate.h"
 
@@ -180,6 +181,12 @@ mp_obj_t mp_obj_str_make_new(const mp_obj_type_t *type, size_t n_args, const mp_
                     return MP_OBJ_NEW_QSTR(q);
                 }
 
+                #if MICROPY_OPT_STR_SLICE
+                if (mp_obj_str_is_slice(args[0])) {
+                    return mp_obj_new_str_slice(type, args[0], str_data, str_len);
+                }
+                #endif
+
                 mp_obj_str_t *o = MP_OBJ_TO_PTR(mp_obj_new_str_copy(type, NULL, str_len));
                 o->data = str_data;
                 o->hash = str_hash;
@@ -221,6 +228,11 @@ STATIC mp_obj_t bytes_make_new(const mp_obj_type_t *type_in, size_t n_args, cons
         if (str_hash == 0) {
             str_hash = qstr_compute_hash(str_data, str_len);
         }
+        #if MICROPY_OPT_STR_SLICE
+        if (mp_obj_str_is_slice(args[0])) {
+            return mp_obj_new_str_slice(&mp_type_bytes, args[0], str_data, str_len);
+        }
+        #endif
         mp_obj_str_t *o = MP_OBJ_TO_PTR(mp_obj_new_str_copy(&mp_type_bytes, NULL, str_len));
         o->data = str_data;
         o->hash = str_hash;
@@ -256,14 +268,9 @@ STATIC mp_obj_t bytes_make_new(const mp_obj_type_t *type_in, size_t n_args, cons
     }
 
     vstr_t vstr;
-    // Try to create array of exact len if initializer len is known
-    mp_obj_t len_in = mp_obj_len_maybe(args[0]);
-    if (len_in == MP_OBJ_NULL) {
-        vstr_init(&vstr, 16);
-    } else {
-        mp_int_t len = MP_OBJ_SMALL_INT_VALUE(len_in);
-        vstr_init(&vstr, len);
-    }
+    // Allocate the whole buffer up front if we can tell how many bytes are coming
+    size_t hint = mp_obj_length_hint(args[0]);
+    vstr_init(&vstr, hint > 0 ? hint : 16);
 
     mp_obj_iter_buf_t iter_buf;
     mp_obj_t iterable = mp_getiter(args[0], &iter_buf);
@@ -284,10 +291,72 @@ wrong_args:
     mp_raise_TypeError(translate("wrong number of arguments"));
 }
 
+#if MICROPY_OPT_FAST_SUBBYTES
+// Boyer-Moore-Horspool search.  The window is compared starting from its
+// last byte (first when searching backwards), and on a mismatch it moves on
+// by the distance from that byte's nearest other occurrence in the needle.
+// Assumes hlen >= nlen >= 2.
+STATIC const byte *find_subbytes_horspool(const byte *haystack, size_t hlen, const byte *needle, size_t nlen, int direction) {
+    byte skip[256];
+    byte max_skip = nlen < 255 ? nlen : 255;
+    memset(skip, max_skip, sizeof(skip));
+    size_t pos;
+    if (direction > 0) {
+        for (size_t i = 0; i < nlen - 1; ++i) {
+            size_t d = nlen - 1 - i;
+            skip[needle[i]] = d < max_skip ? d : max_skip;
+        }
+        byte last = needle[nlen - 1];
+        for (pos = 0; pos <= hlen - nlen;) {
+            byte c = haystack[pos + nlen - 1];
+            if (c == last && memcmp(haystack + pos, needle, nlen - 1) == 0) {
+                return haystack + pos;
+            }
+            pos += skip[c];
+        }
+    } else {
+        for (size_t i = nlen - 1; i > 0; --i) {
+            skip[needle[i]] = i < max_skip ? i : max_skip;
+        }
+        byte first = needle[0];
+        for (pos = hlen - nlen;;) {
+            byte c = haystack[pos];
+            if (c == first && memcmp(haystack + pos + 1, needle + 1, nlen - 1) == 0) {
+                return haystack + pos;
+            }
+            if (pos < skip[c]) {
+                break;
+            }
+            pos -= skip[c];
+        }
+    }
+    return NULL;
+}
+#endif
+
 // like strstr but with specified length and allows \0 bytes
-// TODO replace with something more efficient/standard
 const byte *find_subbytes(const byte *haystack, size_t hlen, const byte *needle, size_t nlen, int direction) {
     if (hlen >= nlen) {
+        #if MICROPY_OPT_FAST_SUBBYTES
+        if (hlen >= MICROPY_OPT_FAST_SUBBYTES_HORSPOOL_MIN && nlen >= (direction > 0 ? 8 : 2)) {
+            return find_subbytes_horspool(haystack, hlen, needle, nlen, direction);
+        }
+        if (direction > 0 && nlen > 0) {
+            // let memchr find candidates for the first byte; it usually beats
+            // the skip table for short needles
+            const byte *h = haystack;
+            const byte *h_end = haystack + hlen - nlen + 1;
+            while ((h = memchr(h, needle[0], h_end - h)) != NULL) {
+                if (memcmp(h + 1, needle + 1, nlen - 1) == 0) {
+                    return h;
+                }
+                if (++h == h_end) {
+                    break;
+                }
+            }
+            return NULL;
+        }
+        #endif
         size_t str_index, str_index_end;
         if (direction > 0) {
             str_index = 0;
@@ -311,6 +380,60 @@ const byte *find_subbytes(const byte *haystack, size_t hlen, const byte *needle,
     return NULL;
 }
 
+#if MICROPY_OPT_STR_BUILDER && MICROPY_OPT_STR_SLICE
+// s += t with a long result builds it in a buffer with room to spare, and
+// returns a slice of that buffer.  The buffer records the length of the
+// longest string made in it so far, and if s is that string a later s += t
+// appends in place: no other string can see the bytes past the end of s.
+// Only strings made here are of kind MP_OBJ_STR_SLICE_BUILDER, and their
+// owner is the buffer and their data its start, so a builder string owns its
+// buffer exactly when its length is the buffer's used count.  The buffer
+// never moves: it is grown in place or not at all.
+typedef struct _str_builder_buf_t {
+    size_t used;
+    byte data[];
+} str_builder_buf_t;
+
+STATIC mp_obj_t str_inplace_add(const mp_obj_type_t *type, mp_obj_t lhs_in, const byte *lhs_data, size_t lhs_len, const byte *rhs_data, size_t rhs_len) {
+    size_t len = lhs_len + rhs_len;
+    str_builder_buf_t *buf = NULL;
+    if (mp_obj_str_is_slice(lhs_in)
+        && ((mp_obj_str_slice_t*)MP_OBJ_TO_PTR(lhs_in))->kind == MP_OBJ_STR_SLICE_BUILDER) {
+        buf = ((mp_obj_str_slice_t*)MP_OBJ_TO_PTR(lhs_in))->owner;
+        if (buf->used != lhs_len) {
+            // a shorter string made earlier in this buffer
+            buf = NULL;
+        } else {
+            size_t old_size = gc_nbytes(buf);
+            size_t new_size = sizeof(str_builder_buf_t) + len + len / 2;
+            if (old_size < sizeof(str_builder_buf_t) + len
+                && m_renew_maybe(byte, buf, old_size, new_size, false) == NULL) {
+                // can't grow in place, other strings point into this buffer
+                buf = NULL;
+            }
+        }
+    }
+    if (buf == NULL) {
+        if (len < MICROPY_OPT_STR_BUILDER_MIN_LEN) {
+            return MP_OBJ_NULL;
+        }
+        buf = m_malloc(sizeof(str_builder_buf_t) + len + len / 2, false);
+        memcpy(buf->data, lhs_data, lhs_len);
+    }
+    memcpy(buf->data + lhs_len, rhs_data, rhs_len);
+    buf->used = len;
+
+    mp_obj_str_slice_t *o = m_new_obj(mp_obj_str_slice_t);
+    o->str.base.type = type;
+    o->str.hash = 0; // computed when needed, hashing every step would be quadratic
+    o->str.len = len;
+    o->str.data = buf->data;
+    o->owner = buf;
+    o->kind = MP_OBJ_STR_SLICE_BUILDER;
+    return MP_OBJ_FROM_PTR(o);
+}
+#endif
+
 // Note: this function is used to check if an object is a str or bytes, which
 // works because both those types use it as their binary_op method.  Revisit
 // MP_OBJ_IS_STR_OR_BYTES if this fact changes.
@@ -397,6 +520,15 @@ mp_obj_t mp_obj_str_binary_op(mp_binary_op_t op, mp_obj_t lhs_in, mp_obj_t rhs_i
                 return lhs_in;
             }
 
+            #if MICROPY_OPT_STR_BUILDER && MICROPY_OPT_STR_SLICE
+            if (op == MP_BINARY_OP_INPLACE_ADD) {
+                mp_obj_t res = str_inplace_add(lhs_type, lhs_in, lhs_data, lhs_len, rhs_data, rhs_len);
+                if (res != MP_OBJ_NULL) {
+                    return res;
+                }
+            }
+            #endif
+
             vstr_t vstr;
             vstr_init_len(&vstr, lhs_len + rhs_len);
             memcpy(vstr.buf, lhs_data, lhs_len);
@@ -450,7 +582,7 @@ STATIC mp_obj_t bytes_subscr(mp_obj_t self_in, mp_obj_t index, mp_obj_t value) {
             if (!mp_seq_get_fast_slice_indexes(self_len, index, &slice)) {
                 mp_raise_NotImplementedError(translate("only slices with step=1 (aka None) are supported"));
             }
-            return mp_obj_new_str_of_type(type, self_data + slice.start, slice.stop - slice.start);
+            return mp_obj_new_str_slice(type, self_in, self_data + slice.start, slice.stop - slice.start);
         }
 #endif
         size_t index_val = mp_get_index(type, self_len, index, false);
@@ -539,7 +671,7 @@ mp_obj_t mp_obj_str_split(size_t n_args, const mp_obj_t *args) {
         while (s < top && splits != 0) {
             const byte *start = s;
             while (s < top && !unichar_isspace(*s)) s++;
-            mp_obj_list_append(res, mp_obj_new_str_of_type(self_type, start, s - start));
+            mp_obj_list_append(res, mp_obj_new_str_slice(self_type, args[0], start, s - start));
             if (s >= top) {
                 break;
             }
@@ -550,7 +682,7 @@ mp_obj_t mp_obj_str_split(size_t n_args, const mp_obj_t *args) {
         }
 
         if (s < top) {
-            mp_obj_list_append(res, mp_obj_new_str_of_type(self_type, s, top - s));
+            mp_obj_list_append(res, mp_obj_new_str_slice(self_type, args[0], s, top - s));
         }
 
     } else {
@@ -577,7 +709,7 @@ mp_obj_t mp_obj_str_split(size_t n_args, const mp_obj_t *args) {
                 }
                 s++;
             }
-            mp_obj_list_append(res, mp_obj_new_str_of_type(self_type, start, s - start));
+            mp_obj_list_append(res, mp_obj_new_str_slice(self_type, args[0], start, s - start));
             if (s >= top) {
                 break;
             }
@@ -617,7 +749,7 @@ STATIC mp_obj_t str_splitlines(size_t n_args, const mp_obj_t *pos_args, mp_map_t
                 match = 1;
                 break;
             } else if (*s == '\r') {
-                if (s[1] == '\n') {
+                if (s + 1 < top && s[1] == '\n') {
                     match = 2;
                 } else {
                     match = 1;
@@ -630,7 +762,7 @@ STATIC mp_obj_t str_splitlines(size_t n_args, const mp_obj_t *pos_args, mp_map_t
         if (args[ARG_keepends].u_bool) {
             sub_len += match;
         }
-        mp_obj_list_append(res, mp_obj_new_str_of_type(self_type, start, sub_len));
+        mp_obj_list_append(res, mp_obj_new_str_slice(self_type, pos_args[0], start, sub_len));
         s += match;
     }
 
@@ -684,10 +816,10 @@ STATIC mp_obj_t str_rsplit(size_t n_args, const mp_obj_t *args) {
                 s--;
             }
             if (s < beg || splits == 0) {
-                res->items[idx] = mp_obj_new_str_of_type(self_type, beg, last - beg);
+                res->items[idx] = mp_obj_new_str_slice(self_type, args[0], beg, last - beg);
                 break;
             }
-            res->items[idx--] = mp_obj_new_str_of_type(self_type, s + sep_len, last - s - sep_len);
+            res->items[idx--] = mp_obj_new_str_slice(self_type, args[0], s + sep_len, last - s - sep_len);
             last = s;
             splits--;
         }
@@ -871,7 +1003,7 @@ STATIC mp_obj_t str_uni_strip(int type, size_t n_args, const mp_obj_t *args) {
         assert(first_good_char_pos == 0);
         return args[0];
     }
-    return mp_obj_new_str_of_type(self_type, orig_str + first_good_char_pos, stripped_len);
+    return mp_obj_new_str_slice(self_type, args[0], orig_str + first_good_char_pos, stripped_len);
 }
 
 STATIC mp_obj_t str_strip(size_t n_args, const mp_obj_t *args) {
@@ -1120,6 +1252,12 @@ STATIC vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *ar
                 assert(conversion == 'r');
                 print_kind = PRINT_REPR;
             }
+            if (!format_spec) {
+                // Nothing to pad or truncate, so print straight into the
+                // result instead of going through a temporary string.
+                mp_obj_print_helper(&print, arg, print_kind);
+                continue;
+            }
             vstr_t arg_vstr;
             mp_print_t arg_print;
             vstr_init_print(&arg_vstr, 16, &arg_print);
@@ -1559,15 +1697,20 @@ not_enough_args:
             case 'r':
             case 's':
             {
-                vstr_t arg_vstr;
-                mp_print_t arg_print;
-                vstr_init_print(&arg_vstr, 16, &arg_print);
                 mp_print_kind_t print_kind = (*str == 'r' ? PRINT_REPR : PRINT_STR);
                 if (print_kind == PRINT_STR && is_bytes && MP_OBJ_IS_TYPE(arg, &mp_type_bytes)) {
                     // If we have something like b"%s" % b"1", bytes arg should be
                     // printed undecorated.
                     print_kind = PRINT_RAW;
                 }
+                if (prec < 0 && width <= 0) {
+                    // No padding or truncation, so skip the temporary string.
+                    mp_obj_print_helper(&print, arg, print_kind);
+                    break;
+                }
+                vstr_t arg_vstr;
+                mp_print_t arg_print;
+                vstr_init_print(&arg_vstr, 16, &arg_print);
                 mp_obj_print_helper(&arg_print, arg, print_kind);
                 uint vlen = arg_vstr.len;
                 if (prec < 0) {
@@ -1740,13 +1883,13 @@ STATIC mp_obj_t str_count(size_t n_args, const mp_obj_t *args) {
 
     // count the occurrences
     mp_int_t num_occurrences = 0;
-    for (const byte *haystack_ptr = start; haystack_ptr + needle_len <= end;) {
-        if (memcmp(haystack_ptr, needle, needle_len) == 0) {
-            num_occurrences++;
-            haystack_ptr += needle_len;
-        } else {
-            haystack_ptr = utf8_next_char(haystack_ptr);
+    for (const byte *haystack_ptr = start; haystack_ptr < end;) {
+        haystack_ptr = find_subbytes(haystack_ptr, end - haystack_ptr, needle, needle_len, 1);
+        if (haystack_ptr == NULL) {
+            break;
         }
+        num_occurrences++;
+        haystack_ptr += needle_len;
     }
 
     return MP_OBJ_NEW_SMALL_INT(num_occurrences);
@@ -1788,9 +1931,9 @@ STATIC mp_obj_t str_partitioner(mp_obj_t self_in, mp_obj_t arg, int direction) {
     const byte *position_ptr = find_subbytes(str, str_len, sep, sep_len, direction);
     if (position_ptr != NULL) {
         size_t position = position_ptr - str;
-        result[0] = mp_obj_new_str_of_type(self_type, str, position);
+        result[0] = mp_obj_new_str_slice(self_type, self_in, str, position);
         result[1] = arg;
-        result[2] = mp_obj_new_str_of_type(self_type, str + position + sep_len, str_len - position - sep_len);
+        result[2] = mp_obj_new_str_slice(self_type, self_in, str + position + sep_len, str_len - position - sep_len);
     }
 
     return mp_obj_new_tuple(3, result);
@@ -2041,6 +2184,75 @@ mp_obj_t mp_obj_new_str_of_type(const mp_obj_type_t *type, const byte* data, siz
     }
 }
 
+// Create a str/bytes object for data that lies within the data of parent, a
+// str/bytes object of the same type.  Same as mp_obj_new_str_of_type, except that
+// with MICROPY_OPT_STR_SLICE a long enough result shares the data of parent.
+mp_obj_t mp_obj_new_str_slice(const mp_obj_type_t *type, mp_obj_t parent, const byte* data, size_t len) {
+    #if MICROPY_OPT_STR_SLICE
+    if (len >= MICROPY_OPT_STR_SLICE_MIN_LEN) {
+        void *owner;
+        if (MP_OBJ_IS_QSTR(parent)) {
+            owner = NULL;
+        } else if (mp_obj_str_is_slice(parent)) {
+            // the data is inside the same block, whatever kind of slice parent is
+            owner = ((mp_obj_str_slice_t*)MP_OBJ_TO_PTR(parent))->owner;
+        } else {
+            // The data of a plain str/bytes object either starts a heap block
+            // or is static.
+            const byte *parent_data = ((mp_obj_str_t*)MP_OBJ_TO_PTR(parent))->data;
+            owner = gc_nbytes(parent_data) != 0 ? (void*)parent_data : NULL;
+        }
+        return mp_obj_new_str_shared(type, owner, data, len);
+    }
+    #else
+    (void)parent;
+    #endif
+    return mp_obj_new_str_of_type(type, data, len);
+}
+
+#if MICROPY_OPT_STR_SLICE
+mp_obj_t mp_obj_new_str_shared(const mp_obj_type_t *type, void *owner, const byte* data, size_t len) {
+    if (type == &mp_type_str) {
+        qstr q = qstr_find_strn((const char*)data, len);
+        if (q != MP_QSTR_NULL) {
+            return MP_OBJ_NEW_QSTR(q);
+        }
+    }
+    mp_obj_str_slice_t *o = m_new_obj(mp_obj_str_slice_t);
+    o->str.base.type = type;
+    o->str.hash = qstr_compute_hash(data, len);
+    o->str.len = len;
+    o->str.data = data;
+    o->owner = owner;
+    o->kind = MP_OBJ_STR_SLICE_SHARED;
+    return MP_OBJ_FROM_PTR(o);
+}
+
+// Slices are told apart from plain str/bytes objects by their size, which needs
+// a plain object to fill its GC blocks exactly.
+bool mp_obj_str_is_slice(mp_obj_t self_in) {
+    MP_STATIC_ASSERT(sizeof(mp_obj_str_t) % MICROPY_BYTES_PER_GC_BLOCK == 0);
+    return MP_OBJ_IS_OBJ(self_in) && MP_OBJ_IS_STR_OR_BYTES(self_in)
+        && gc_nbytes(MP_OBJ_TO_PTR(self_in)) >= sizeof(mp_obj_str_slice_t);
+}
+
+// Give a slice its own zero-terminated copy of its data, and let go of the
+// shared data.
+void mp_obj_str_unslice(mp_obj_t self_in) {
+    if (mp_obj_str_is_slice(self_in)) {
+        mp_obj_str_slice_t *o = MP_OBJ_TO_PTR(self_in);
+        if (o->kind != MP_OBJ_STR_SLICE_COPY) {
+            byte *p = m_new(byte, o->str.len + 1);
+            memcpy(p, o->str.data, o->str.len);
+            p[o->str.len] = '\0';
+            o->str.data = p;
+            o->owner = p;
+            o->kind = MP_OBJ_STR_SLICE_COPY;
+        }
+    }
+}
+#endif
+
 // Create a str using a qstr to store the data; may use existing or new qstr.
 mp_obj_t mp_obj_new_str_via_qstr(const char* data, size_t len) {
     return MP_OBJ_NEW_QSTR(qstr_from_strn(data, len));
@@ -2098,6 +2310,22 @@ mp_obj_t mp_obj_str_intern_checked(mp_obj_t obj) {
     return mp_obj_new_str_via_qstr((const char*)data, len);
 }
 
+// Like mp_obj_str_intern_checked, but never makes a new qstr: if none exists
+// with this data then the str object itself is returned.
+mp_obj_t mp_obj_str_find_interned_checked(mp_obj_t obj) {
+    size_t len;
+    const char *data = mp_obj_str_get_data(obj, &len);
+    qstr q = qstr_find_strn(data, len);
+    if (q != MP_QSTR_NULL) {
+        return MP_OBJ_NEW_QSTR(q);
+    }
+    if (!MP_OBJ_IS_STR(obj)) {
+        // bytes is accepted by mp_obj_str_get_data but isn't a valid name
+        return mp_obj_str_intern_checked(obj);
+    }
+    return obj;
+}
+
 mp_obj_t mp_obj_new_bytes(const byte* data, size_t len) {
     return mp_obj_new_str_copy(&mp_type_bytes, data, len);
 }
@@ -2157,6 +2385,9 @@ qstr mp_obj_str_get_qstr(mp_obj_t self_in) {
 // at the moment all strings are zero terminated to help with C ASCIIZ compatibility
 const char *mp_obj_str_get_str(mp_obj_t self_in) {
     if (MP_OBJ_IS_STR_OR_BYTES(self_in)) {
+        #if MICROPY_OPT_STR_SLICE
+        mp_obj_str_unslice(self_in);
+        #endif
         GET_STR_DATA_LEN(self_in, s, l);
         (void)l; // len unused
         return (const char*)s;
@@ -2189,13 +2420,6 @@ const byte *mp_obj_str_get_data_no_check(mp_obj_t self_in, size_t *len) {
 /******************************************************************************/
 /* str iterator                                                               */
 
-typedef struct _mp_obj_str8_it_t {
-    mp_obj_base_t base;
-    mp_fun_1_t iternext;
-    mp_obj_t str;
-    size_t cur;
-} mp_obj_str8_it_t;
-
 #if !MICROPY_PY_BUILTINS_STR_UNICODE
 STATIC mp_obj_t str_it_iternext(mp_obj_t self_in) {
     mp_obj_str8_it_t *self = MP_OBJ_TO_PTR(self_in);
@@ -2220,7 +2444,7 @@ STATIC mp_obj_t mp_obj_new_str_iterator(mp_obj_t str, mp_obj_iter_buf_t *iter_bu
 }
 #endif
 
-STATIC mp_obj_t bytes_it_iternext(mp_obj_t self_in) {
+mp_obj_t mp_obj_bytes_it_iternext(mp_obj_t self_in) {
     mp_obj_str8_it_t *self = MP_OBJ_TO_PTR(self_in);
     GET_STR_DATA_LEN(self->str, str, len);
     if (self->cur < len) {
@@ -2236,7 +2460,7 @@ mp_obj_t mp_obj_new_bytes_iterator(mp_obj_t str, mp_obj_iter_buf_t *iter_buf) {
     assert(sizeof(mp_obj_str8_it_t) <= sizeof(mp_obj_iter_buf_t));
     mp_obj_str8_it_t *o = (mp_obj_str8_it_t*)iter_buf;
     o->base.type = &mp_type_polymorph_iter;
-    o->iternext = bytes_it_iternext;
+    o->iternext = mp_obj_bytes_it_iternext;
     o->str = str;
     o->cur = 0;
     return MP_OBJ_FROM_PTR(o);
@@ -36,6 +36,14 @@ typedef struct _mp_obj_str_t {
     const byte *data;
 } mp_obj_str_t;
 
+// str and bytes iterator, used by mp_type_polymorph_iter
+typedef struct _mp_obj_str8_it_t {
+    mp_obj_base_t base;
+    mp_fun_1_t iternext;
+    mp_obj_t str;
+    size_t cur;
+} mp_obj_str8_it_t;
+
 #define MP_DEFINE_STR_OBJ(obj_name, str) mp_obj_str_t obj_name = {{&mp_type_str}, 0, sizeof(str) - 1, (const byte*)str}
 
 // use this macro to extract the string hash
@@ -67,7 +75,41 @@ mp_obj_t mp_obj_str_format(size_t n_args, const mp_obj_t *args, mp_map_t *kwargs
 mp_obj_t mp_obj_str_split(size_t n_args, const mp_obj_t *args);
 mp_obj_t mp_obj_new_str_copy(const mp_obj_type_t *type, const byte* data, size_t len);
 mp_obj_t mp_obj_new_str_of_type(const mp_obj_type_t *type, const byte* data, size_t len);
+mp_obj_t mp_obj_new_str_slice(const mp_obj_type_t *type, mp_obj_t parent, const byte* data, size_t len);
+
+#if MICROPY_OPT_STR_SLICE
+// How the data of a slice relates to its owner.
+typedef enum _mp_obj_str_slice_kind_t {
+    // Inside data that other objects may share, and not zero terminated.
+    MP_OBJ_STR_SLICE_SHARED,
+    // A zero terminated copy that only this slice uses.
+    MP_OBJ_STR_SLICE_COPY,
+    // The start of a buffer that s += t may append to, see str_inplace_add.
+    MP_OBJ_STR_SLICE_BUILDER,
+} mp_obj_str_slice_kind_t;
+
+// A str/bytes object whose data may lie inside data used by other objects.
+// It is a plain str/bytes object to the rest of the code.  owner is the heap
+// block that holds the data, which this reference keeps alive on its own: the
+// GC doesn't follow pointers into the middle of a block, and the object the
+// data was sliced from may be freed, or have its data moved by
+// make_str_long_lived, while the slice lives.  owner is NULL for data that is
+// never freed or changed, eg in ROM or the qstr pool.  Shared data is not zero
+// terminated, so mp_obj_str_get_str copies it out first.
+typedef struct _mp_obj_str_slice_t {
+    mp_obj_str_t str;
+    void *owner;
+    mp_obj_str_slice_kind_t kind;
+} mp_obj_str_slice_t;
+
+// Make a slice of len bytes at data, which lie within the heap block owner or,
+// if owner is NULL, in memory that is never freed or changed.
+mp_obj_t mp_obj_new_str_shared(const mp_obj_type_t *type, void *owner, const byte* data, size_t len);
+bool mp_obj_str_is_slice(mp_obj_t self_in);
+void mp_obj_str_unslice(mp_obj_t self_in);
+#endif
 
+mp_obj_t mp_obj_bytes_it_iternext(mp_obj_t self_in);
 mp_obj_t mp_obj_str_binary_op(mp_binary_op_t op, mp_obj_t lhs_in, mp_obj_t rhs_in);
 mp_int_t mp_obj_str_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags);
 
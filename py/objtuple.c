@@ -77,13 +77,15 @@ STATIC mp_obj_t mp_obj_tuple_make_new(const mp_obj_type_t *type_in, size_t n_arg
                 return args[0];
             }
 
-            // TODO optimise for cases where we know the length of the iterator
-
-            size_t alloc = 4;
+            size_t alloc = mp_obj_length_hint(args[0]);
+            if (alloc == 0) {
+                alloc = 4;
+            }
             size_t len = 0;
             mp_obj_t *items = m_new(mp_obj_t, alloc);
 
-            mp_obj_t iterable = mp_getiter(args[0], NULL);
+            mp_obj_iter_buf_t iter_buf;
+            mp_obj_t iterable = mp_getiter(args[0], &iter_buf);
             mp_obj_t item;
             while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
                 if (len >= alloc) {
@@ -273,14 +275,7 @@ void mp_obj_tuple_del(mp_obj_t self_in) {
 /******************************************************************************/
 /* tuple iterator                                                             */
 
-typedef struct _mp_obj_tuple_it_t {
-    mp_obj_base_t base;
-    mp_fun_1_t iternext;
-    mp_obj_tuple_t *tuple;
-    size_t cur;
-} mp_obj_tuple_it_t;
-
-STATIC mp_obj_t tuple_it_iternext(mp_obj_t self_in) {
+mp_obj_t mp_obj_tuple_it_iternext(mp_obj_t self_in) {
     mp_obj_tuple_it_t *self = MP_OBJ_TO_PTR(self_in);
     if (self->cur < self->tuple->len) {
         mp_obj_t o_out = self->tuple->items[self->cur];
@@ -295,7 +290,7 @@ mp_obj_t mp_obj_tuple_getiter(mp_obj_t o_in, mp_obj_iter_buf_t *iter_buf) {
     assert(sizeof(mp_obj_tuple_it_t) <= sizeof(mp_obj_iter_buf_t));
     mp_obj_tuple_it_t *o = (mp_obj_tuple_it_t*)iter_buf;
     o->base.type = &mp_type_polymorph_iter;
-    o->iternext = tuple_it_iternext;
+    o->iternext = mp_obj_tuple_it_iternext;
     o->tuple = MP_OBJ_TO_PTR(o_in);
     o->cur = 0;
     return MP_OBJ_FROM_PTR(o);
@@ -40,6 +40,13 @@ typedef struct _mp_rom_obj_tuple_t {
     mp_rom_obj_t items[];
 } mp_rom_obj_tuple_t;
 
+typedef struct _mp_obj_tuple_it_t {
+    mp_obj_base_t base;
+    mp_fun_1_t iternext;
+    mp_obj_tuple_t *tuple;
+    size_t cur;
+} mp_obj_tuple_it_t;
+
 extern const mp_obj_type_t mp_type_tuple;
 
 void mp_obj_tuple_print(const mp_print_t *print, mp_obj_t o_in, mp_print_kind_t kind);
@@ -47,6 +54,7 @@ mp_obj_t mp_obj_tuple_unary_op(mp_unary_op_t op, mp_obj_t self_in);
 mp_obj_t mp_obj_tuple_binary_op(mp_binary_op_t op, mp_obj_t lhs, mp_obj_t rhs);
 mp_obj_t mp_obj_tuple_subscr(mp_obj_t base, mp_obj_t index, mp_obj_t value);
 mp_obj_t mp_obj_tuple_getiter(mp_obj_t o_in, mp_obj_iter_buf_t *iter_buf);
+mp_obj_t mp_obj_tuple_it_iternext(mp_obj_t self_in);
 
 extern const mp_obj_type_t mp_type_attrtuple;
 
@@ -63,4 +71,8 @@ void mp_obj_attrtuple_print_helper(const mp_print_t *print, const qstr *fields,
 
 mp_obj_t mp_obj_new_attrtuple(const qstr *fields, size_t n, const mp_obj_t *items);
 
+#if MICROPY_PY_ATTRTUPLE || MICROPY_PY_COLLECTIONS
+const qstr *mp_obj_attrtuple_get_fields(const mp_obj_type_t *type, mp_obj_t o_in);
+#endif
+
 #endif // MICROPY_INCLUDED_PY_OBJTUPLE_H
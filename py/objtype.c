@@ -50,6 +50,8 @@
 
 #define TYPE_FLAG_IS_SUBCLASSED (0x0001)
 #define TYPE_FLAG_HAS_SPECIAL_ACCESSORS (0x0002)
+// Instances have a fixed table of the names in the class's __slots__ tuple.
+#define TYPE_FLAG_HAS_SLOTS (0x0004)
 
 STATIC mp_obj_t static_class_method_make_new(const mp_obj_type_t *self_in, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args);
 
@@ -103,9 +105,39 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_KW(native_base_init_wrapper_obj, 1, native_base_i
 #if !MICROPY_CPYTHON_COMPAT
 STATIC
 #endif
+#if MICROPY_PY_SLOTS
+// Returns the names of all the slots of instances of the type, including
+// those of its bases.
+STATIC mp_obj_tuple_t *instance_get_slots(const mp_obj_type_t *type) {
+    mp_map_elem_t *elem = mp_map_lookup(&type->locals_dict->map, MP_OBJ_NEW_QSTR(MP_QSTR___slots__), MP_MAP_LOOKUP);
+    return MP_OBJ_TO_PTR(elem->value);
+}
+#endif
+
 mp_obj_instance_t *mp_obj_new_instance(const mp_obj_type_t *class, const mp_obj_type_t **native_base) {
     size_t num_native_bases = instance_count_native_bases(class, native_base);
     assert(num_native_bases < 2);
+    #if MICROPY_PY_SLOTS
+    if (class->flags & TYPE_FLAG_HAS_SLOTS) {
+        // The slots are a fixed table after the native base, in the same
+        // block. Every name is always in the table and its value is
+        // MP_OBJ_NULL until it's assigned, so the table never changes shape
+        // and the slot a name is found in stays valid for caching.
+        mp_obj_tuple_t *slots = instance_get_slots(class);
+        mp_obj_instance_t *o = m_new_obj_var(mp_obj_instance_t, mp_obj_t, num_native_bases + 2 * slots->len);
+        o->base.type = class;
+        mp_obj_t *table = &o->subobj[num_native_bases];
+        for (size_t i = 0; i < slots->len; i++) {
+            table[2 * i] = slots->items[i];
+            table[2 * i + 1] = MP_OBJ_NULL;
+        }
+        mp_map_init_fixed_table(&o->members, slots->len, table);
+        if (num_native_bases != 0) {
+            o->subobj[0] = MP_OBJ_FROM_PTR(&native_base_init_wrapper_obj);
+        }
+        return o;
+    }
+    #endif
     mp_obj_instance_t *o = m_new_obj_var(mp_obj_instance_t, mp_obj_t, num_native_bases);
     o->base.type = class;
     mp_map_init(&o->members, 0);
@@ -585,13 +617,50 @@ retry:;
     return res;
 }
 
+#if MICROPY_OPT_TYPE_ATTR_CACHE
+STATIC mp_type_attr_cache_entry_t *type_attr_cache_entry(const mp_obj_type_t *type, qstr attr) {
+    size_t hash = ((uintptr_t)type / sizeof(mp_obj_t)) ^ attr;
+    return &MP_STATE_VM(type_attr_cache)[hash & (MICROPY_OPT_TYPE_ATTR_CACHE_SIZE - 1)];
+}
+
+// Remember the result of a class lookup for an instance, if it's one whose
+// meaning doesn't depend on the instance: either a plain method, which gets
+// bound to self, or a constant which the descriptor and property checks in
+// mp_obj_instance_load_attr would leave alone. Values found through a native
+// base are never cached because they may be computed by the native type.
+STATIC void type_attr_cache_store(mp_obj_t self_in, qstr attr, const mp_obj_t *dest) {
+    const mp_obj_type_t *type = mp_obj_get_type(self_in);
+    bool bind;
+    if (dest[1] == self_in && MP_OBJ_IS_TYPE(dest[0], &mp_type_fun_bc)) {
+        bind = true;
+    } else if (dest[1] == MP_OBJ_NULL
+        && (MP_OBJ_IS_SMALL_INT(dest[0]) || MP_OBJ_IS_QSTR(dest[0])
+            || dest[0] == mp_const_none || dest[0] == mp_const_false || dest[0] == mp_const_true)) {
+        const mp_obj_type_t *native_base;
+        if (instance_count_native_bases(type, &native_base) != 0) {
+            return;
+        }
+        bind = false;
+    } else {
+        return;
+    }
+    mp_type_attr_cache_entry_t *entry = type_attr_cache_entry(type, attr);
+    entry->type = type;
+    entry->member = dest[0];
+    entry->attr = attr;
+    entry->bind = bind;
+    entry->version = MP_STATE_VM(type_attr_cache_version);
+}
+#endif
+
 STATIC void mp_obj_instance_load_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
     // logic: look in instance members then class locals
     assert(mp_obj_is_instance_type(mp_obj_get_type(self_in)));
     mp_obj_instance_t *self = MP_OBJ_TO_PTR(self_in);
 
     mp_map_elem_t *elem = mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP);
-    if (elem != NULL) {
+    // A slot that hasn't been assigned yet has no value.
+    if (elem != NULL && elem->value != MP_OBJ_NULL) {
         // object member, always treated as a value
         dest[0] = elem->value;
         return;
@@ -604,7 +673,7 @@ STATIC void mp_obj_instance_load_attr(mp_obj_t self_in, qstr attr, mp_obj_t *des
         mp_map_t *map = &self->members;
         mp_obj_t attr_dict = mp_obj_new_dict(map->used);
         for (size_t i = 0; i < map->alloc; ++i) {
-            if (MP_MAP_SLOT_IS_FILLED(map, i)) {
+            if (MP_MAP_SLOT_IS_FILLED(map, i) && map->table[i].value != MP_OBJ_NULL) {
                 mp_obj_dict_store(attr_dict, map->table[i].key, map->table[i].value);
             }
         }
@@ -612,6 +681,17 @@ STATIC void mp_obj_instance_load_attr(mp_obj_t self_in, qstr attr, mp_obj_t *des
         return;
     }
 #endif
+    #if MICROPY_OPT_TYPE_ATTR_CACHE
+    mp_type_attr_cache_entry_t *entry = type_attr_cache_entry(self->base.type, attr);
+    if (entry->type == self->base.type && entry->attr == attr
+        && entry->version == MP_STATE_VM(type_attr_cache_version)) {
+        dest[0] = entry->member;
+        if (entry->bind) {
+            dest[1] = self_in;
+        }
+        return;
+    }
+    #endif
     struct class_lookup_data lookup = {
         .obj = self,
         .attr = attr,
@@ -622,6 +702,9 @@ STATIC void mp_obj_instance_load_attr(mp_obj_t self_in, qstr attr, mp_obj_t *des
     mp_obj_class_lookup(&lookup, self->base.type);
     mp_obj_t member = dest[0];
     if (member != MP_OBJ_NULL) {
+        #if MICROPY_OPT_TYPE_ATTR_CACHE
+        type_attr_cache_store(self_in, attr, dest);
+        #endif
         // changes here may may require changes to super_attr, below
         if (!(self->base.type->flags & TYPE_FLAG_HAS_SPECIAL_ACCESSORS)) {
             // Class doesn't have any special accessors to check so return straightaway
@@ -798,6 +881,19 @@ STATIC bool mp_obj_instance_store_attr(mp_obj_t self_in, qstr attr, mp_obj_t val
 
 skip_special_accessors:
 
+    #if MICROPY_PY_SLOTS
+    if (self->members.is_fixed) {
+        // Only the slots can be set or deleted, and they are never added or
+        // removed from the table.
+        mp_map_elem_t *elem = mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP);
+        if (elem == NULL || (value == MP_OBJ_NULL && elem->value == MP_OBJ_NULL)) {
+            return false;
+        }
+        elem->value = value;
+        return true;
+    }
+    #endif
+
     if (value == MP_OBJ_NULL) {
         // delete attribute
         mp_map_elem_t *elem = mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP_REMOVE_IF_FOUND);
@@ -1072,6 +1168,11 @@ STATIC void type_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
                 // can't apply delete/store to a fixed map
                 return;
             }
+            #if MICROPY_OPT_TYPE_ATTR_CACHE
+            // This class, or any class derived from it, may have cached lookups
+            // of the attribute, so invalidate them all.
+            MP_STATE_VM(type_attr_cache_version)++;
+            #endif
             if (dest[1] == MP_OBJ_NULL) {
                 // delete attribute
                 mp_map_elem_t *elem = mp_map_lookup(locals_map, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP_REMOVE_IF_FOUND);
@@ -1111,6 +1212,82 @@ const mp_obj_type_t mp_type_type = {
     .attr = type_attr,
 };
 
+#if MICROPY_PY_SLOTS
+STATIC void slots_add(mp_obj_t names, mp_obj_t name) {
+    mp_obj_list_t *list = MP_OBJ_TO_PTR(names);
+    for (size_t i = 0; i < list->len; i++) {
+        if (list->items[i] == name) {
+            return;
+        }
+    }
+    mp_obj_list_append(names, name);
+}
+
+// If the class defines __slots__ without "__dict__", and each base class that
+// isn't native does too, replaces __slots__ with a tuple of every slot name
+// including the bases' and marks the type so that its instances get a fixed
+// table of them.  "__weakref__" is accepted and ignored, as there are no weak
+// references.
+STATIC void type_setup_slots(mp_obj_type_t *type, size_t bases_len, const mp_obj_t *bases_items) {
+    mp_map_elem_t *elem = mp_map_lookup(&type->locals_dict->map, MP_OBJ_NEW_QSTR(MP_QSTR___slots__), MP_MAP_LOOKUP);
+    if (elem == NULL) {
+        return;
+    }
+    mp_obj_t own = mp_obj_new_list(0, NULL);
+    bool has_dict = false;
+    mp_obj_t iterable = elem->value;
+    if (MP_OBJ_IS_STR(iterable)) {
+        iterable = mp_obj_new_tuple(1, &iterable);
+    }
+    iterable = mp_getiter(iterable, NULL);
+    mp_obj_t item;
+    while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+        if (!MP_OBJ_IS_STR(item)) {
+            mp_raise_TypeError(translate("__slots__ items must be strings"));
+        }
+        qstr name = mp_obj_str_get_qstr(item);
+        if (name == MP_QSTR___dict__) {
+            has_dict = true;
+            continue;
+        }
+        if (name == MP_QSTR___weakref__) {
+            continue;
+        }
+        // A class attribute of the same name would be found for unset slots.
+        if (mp_map_lookup(&type->locals_dict->map, MP_OBJ_NEW_QSTR(name), MP_MAP_LOOKUP) != NULL) {
+            mp_raise_ValueError_varg(translate("'%q' in __slots__ conflicts with class variable"), name);
+        }
+        slots_add(own, MP_OBJ_NEW_QSTR(name));
+    }
+    if (has_dict) {
+        // Instances can get any attribute, so they need a map that grows.
+        return;
+    }
+    mp_obj_t names = mp_obj_new_list(0, NULL);
+    for (size_t i = 0; i < bases_len; i++) {
+        const mp_obj_type_t *base = MP_OBJ_TO_PTR(bases_items[i]);
+        if (!mp_obj_is_instance_type(base)) {
+            continue;
+        }
+        if (!(base->flags & TYPE_FLAG_HAS_SLOTS)) {
+            // Instances need a map for the base's attributes anyway.
+            return;
+        }
+        mp_obj_tuple_t *base_slots = instance_get_slots(base);
+        for (size_t j = 0; j < base_slots->len; j++) {
+            slots_add(names, base_slots->items[j]);
+        }
+    }
+    mp_obj_list_t *own_list = MP_OBJ_TO_PTR(own);
+    for (size_t i = 0; i < own_list->len; i++) {
+        slots_add(names, own_list->items[i]);
+    }
+    mp_obj_list_t *list = MP_OBJ_TO_PTR(names);
+    elem->value = mp_obj_new_tuple(list->len, list->items);
+    type->flags |= TYPE_FLAG_HAS_SLOTS;
+}
+#endif
+
 mp_obj_t mp_obj_new_type(qstr name, mp_obj_t bases_tuple, mp_obj_t locals_dict) {
     // Verify input objects have expected type
     if (!MP_OBJ_IS_TYPE(bases_tuple, &mp_type_tuple)) {
@@ -1203,6 +1380,10 @@ mp_obj_t mp_obj_new_type(qstr name, mp_obj_t bases_tuple, mp_obj_t locals_dict)
     }
     #endif
 
+    #if MICROPY_PY_SLOTS
+    type_setup_slots(o, bases_len, bases_items);
+    #endif
+
     mp_map_elem_t *elem = mp_map_lookup(locals_map, MP_OBJ_NEW_QSTR(MP_QSTR___new__), MP_MAP_LOOKUP);
     if (elem != NULL) {
         // __new__ slot exists; check if it is a function
@@ -67,6 +67,11 @@ STATIC mp_obj_t zip_iternext(mp_obj_t self_in) {
     return MP_OBJ_FROM_PTR(tuple);
 }
 
+size_t mp_obj_zip_length_hint(mp_obj_t self_in) {
+    mp_obj_zip_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_length_hint_min(self->n_iters, self->iters);
+}
+
 const mp_obj_type_t mp_type_zip = {
     { &mp_type_type },
     .name = MP_QSTR_zip,
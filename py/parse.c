@@ -350,6 +350,31 @@ bool mp_parse_node_get_int_maybe(mp_parse_node_t pn, mp_obj_t *o) {
     }
 }
 
+#if MICROPY_COMP_CONST_STR
+// Like mp_parse_node_get_int_maybe, but for str and bytes constants.
+STATIC bool parse_node_get_str_maybe(mp_parse_node_t pn, mp_obj_t *o) {
+    if (MP_PARSE_NODE_IS_LEAF(pn) && MP_PARSE_NODE_LEAF_KIND(pn) == MP_PARSE_NODE_STRING) {
+        *o = MP_OBJ_NEW_QSTR(MP_PARSE_NODE_LEAF_ARG(pn));
+        return true;
+    } else if (MP_PARSE_NODE_IS_LEAF(pn) && MP_PARSE_NODE_LEAF_KIND(pn) == MP_PARSE_NODE_BYTES) {
+        size_t len;
+        const byte *data = qstr_data(MP_PARSE_NODE_LEAF_ARG(pn), &len);
+        *o = mp_obj_new_bytes(data, len);
+        return true;
+    } else if (MP_PARSE_NODE_IS_STRUCT_KIND(pn, RULE_const_object)) {
+        mp_parse_node_struct_t *pns = (mp_parse_node_struct_t*)pn;
+        #if MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_D
+        *o = (uint64_t)pns->nodes[0] | ((uint64_t)pns->nodes[1] << 32);
+        #else
+        *o = (mp_obj_t)pns->nodes[0];
+        #endif
+        return MP_OBJ_IS_STR_OR_BYTES(*o);
+    } else {
+        return false;
+    }
+}
+#endif
+
 int mp_parse_node_extract_list(mp_parse_node_t *pn, size_t pn_kind, mp_parse_node_t **nodes) {
     if (MP_PARSE_NODE_IS_NULL(*pn)) {
         *nodes = NULL;
@@ -461,6 +486,22 @@ STATIC mp_parse_node_t make_node_const_object(parser_t *parser, size_t src_line,
     return (mp_parse_node_t)pn;
 }
 
+#if MICROPY_COMP_CONST_STR
+// Make a node for a str or bytes object the same way push_result_token does
+// for a literal: short ones become interned leaves, the rest const objects.
+STATIC mp_parse_node_t make_node_str(parser_t *parser, size_t src_line, mp_obj_t obj) {
+    if (MP_OBJ_IS_QSTR(obj)) {
+        return mp_parse_node_new_leaf(MP_PARSE_NODE_STRING, MP_OBJ_QSTR_VALUE(obj));
+    }
+    GET_STR_DATA_LEN(obj, data, len);
+    if (len <= MICROPY_ALLOC_PARSE_INTERN_STRING_LEN) {
+        qstr qst = qstr_from_strn((const char*)data, len);
+        return mp_parse_node_new_leaf(MP_OBJ_IS_STR(obj) ? MP_PARSE_NODE_STRING : MP_PARSE_NODE_BYTES, qst);
+    }
+    return make_node_const_object(parser, src_line, obj);
+}
+#endif
+
 STATIC mp_parse_node_t mp_parse_node_new_small_int_checked(parser_t *parser, mp_obj_t o_val) {
     (void)parser;
     mp_int_t val = MP_OBJ_SMALL_INT_VALUE(o_val);
@@ -488,6 +529,10 @@ STATIC void push_result_token(parser_t *parser, uint8_t rule_id) {
             && (elem = mp_map_lookup(&parser->consts, MP_OBJ_NEW_QSTR(id), MP_MAP_LOOKUP)) != NULL) {
             if (MP_OBJ_IS_SMALL_INT(elem->value)) {
                 pn = mp_parse_node_new_small_int_checked(parser, elem->value);
+            #if MICROPY_COMP_CONST_STR
+            } else if (MP_OBJ_IS_STR_OR_BYTES(elem->value)) {
+                pn = make_node_str(parser, lex->tok_line, elem->value);
+            #endif
             } else {
                 pn = make_node_const_object(parser, lex->tok_line, elem->value);
             }
@@ -614,6 +659,22 @@ STATIC bool fold_constants(parser_t *parser, uint8_t rule_id, size_t num_args) {
     // it does not do partial folding, eg 1 + 2 + x -> 3 + x
 
     mp_obj_t arg0;
+    #if MICROPY_COMP_CONST_STR
+    if (rule_id == RULE_arith_expr
+        && parse_node_get_str_maybe(peek_result(parser, num_args - 1), &arg0)) {
+        // folding for concatenation of str or bytes constants: "a" + B
+        const mp_obj_type_t *type = mp_obj_get_type(arg0);
+        for (ssize_t i = num_args - 2; i >= 1; i -= 2) {
+            mp_obj_t arg1;
+            if (!MP_PARSE_NODE_IS_TOKEN_KIND(peek_result(parser, i), MP_TOKEN_OP_PLUS)
+                || !parse_node_get_str_maybe(peek_result(parser, i - 1), &arg1)
+                || mp_obj_get_type(arg1) != type) {
+                return false;
+            }
+            arg0 = mp_binary_op(MP_BINARY_OP_ADD, arg0, arg1);
+        }
+    } else
+    #endif
     if (rule_id == RULE_expr
         || rule_id == RULE_xor_expr
         || rule_id == RULE_and_expr) {
@@ -684,6 +745,46 @@ STATIC bool fold_constants(parser_t *parser, uint8_t rule_id, size_t num_args) {
             }
             arg0 = mp_binary_op(op, arg0, arg1);
         }
+    } else if (rule_id == RULE_comparison) {
+        // folding for integer comparisons, including chained ones: < > == >= <= !=
+        // this lets "if DEBUG > 1:" with a const DEBUG drop the whole branch
+        mp_parse_node_t pn = peek_result(parser, num_args - 1);
+        if (!mp_parse_node_get_int_maybe(pn, &arg0)) {
+            return false;
+        }
+        bool result = true;
+        for (ssize_t i = num_args - 2; i >= 1; i -= 2) {
+            mp_parse_node_t pn_op = peek_result(parser, i);
+            if (!MP_PARSE_NODE_IS_TOKEN(pn_op)) {
+                // "not in" and "is"
+                return false;
+            }
+            mp_binary_op_t op;
+            switch (MP_PARSE_NODE_LEAF_ARG(pn_op)) {
+                case MP_TOKEN_OP_LESS: op = MP_BINARY_OP_LESS; break;
+                case MP_TOKEN_OP_MORE: op = MP_BINARY_OP_MORE; break;
+                case MP_TOKEN_OP_DBL_EQUAL: op = MP_BINARY_OP_EQUAL; break;
+                case MP_TOKEN_OP_LESS_EQUAL: op = MP_BINARY_OP_LESS_EQUAL; break;
+                case MP_TOKEN_OP_MORE_EQUAL: op = MP_BINARY_OP_MORE_EQUAL; break;
+                case MP_TOKEN_OP_NOT_EQUAL: op = MP_BINARY_OP_NOT_EQUAL; break;
+                default: return false; // "in"
+            }
+            mp_obj_t arg1;
+            if (!mp_parse_node_get_int_maybe(peek_result(parser, i - 1), &arg1)) {
+                return false;
+            }
+            if (result && mp_binary_op(op, arg0, arg1) == mp_const_false) {
+                // keep going: the rest still has to be constant to fold
+                result = false;
+            }
+            arg0 = arg1;
+        }
+        for (size_t i = num_args; i > 0; i--) {
+            pop_result(parser);
+        }
+        push_result_node(parser, mp_parse_node_new_leaf(MP_PARSE_NODE_TOKEN, result ? MP_TOKEN_KW_TRUE : MP_TOKEN_KW_FALSE));
+        return true;
+
     } else if (rule_id == RULE_factor_2) {
         // folding for unary ops: + - ~
         mp_parse_node_t pn = peek_result(parser, 0);
@@ -724,7 +825,11 @@ STATIC bool fold_constants(parser_t *parser, uint8_t rule_id, size_t num_args) {
                 // get the value
                 mp_parse_node_t pn_value = ((mp_parse_node_struct_t*)((mp_parse_node_struct_t*)pn1)->nodes[1])->nodes[0];
                 mp_obj_t value;
-                if (!mp_parse_node_get_int_maybe(pn_value, &value)) {
+                if (!mp_parse_node_get_int_maybe(pn_value, &value)
+                    #if MICROPY_COMP_CONST_STR
+                    && !parse_node_get_str_maybe(pn_value, &value)
+                    #endif
+                    ) {
                     mp_obj_t exc = mp_obj_new_exception_msg(&mp_type_SyntaxError,
                         translate("constant must be an integer"));
                     mp_obj_exception_add_traceback(exc, parser->lexer->source_name,
@@ -794,6 +899,10 @@ STATIC bool fold_constants(parser_t *parser, uint8_t rule_id, size_t num_args) {
     }
     if (MP_OBJ_IS_SMALL_INT(arg0)) {
         push_result_node(parser, mp_parse_node_new_small_int_checked(parser, arg0));
+    #if MICROPY_COMP_CONST_STR
+    } else if (MP_OBJ_IS_STR_OR_BYTES(arg0)) {
+        push_result_node(parser, make_node_str(parser, 0, arg0));
+    #endif
     } else {
         // TODO reuse memory for parse node struct?
         push_result_node(parser, make_node_const_object(parser, 0, arg0));
@@ -803,6 +912,48 @@ STATIC bool fold_constants(parser_t *parser, uint8_t rule_id, size_t num_args) {
 }
 #endif
 
+#if MICROPY_COMP_CONST_IMPORT
+// For "from <module> import <names>" where the public consts of <module> are
+// known (see mp_parse_const_modules) add the imported ones to the table of
+// dynamic constants, under the local name they are imported as.  The import
+// statement itself stays in the tree, so the names are still bound at runtime.
+STATIC void import_consts(parser_t *parser) {
+    mp_obj_dict_t *modules = MP_STATE_VM(comp_const_modules);
+    mp_parse_node_t pn_mod = peek_result(parser, 1);
+    mp_parse_node_t pn_names = peek_result(parser, 0);
+    if (modules == NULL || !MP_PARSE_NODE_IS_ID(pn_mod)) {
+        // relative and dotted module names aren't supported
+        return;
+    }
+    mp_map_elem_t *elem = mp_map_lookup(&modules->map, MP_OBJ_NEW_QSTR(MP_PARSE_NODE_LEAF_ARG(pn_mod)), MP_MAP_LOOKUP);
+    if (elem == NULL) {
+        return;
+    }
+    mp_map_t *mod_consts = mp_obj_dict_get_map(elem->value);
+    mp_parse_node_t *names;
+    size_t n = mp_parse_node_extract_list(&pn_names, RULE_import_as_names, &names);
+    for (size_t i = 0; i < n; i++) {
+        qstr name, local;
+        if (MP_PARSE_NODE_IS_ID(names[i])) {
+            name = local = MP_PARSE_NODE_LEAF_ARG(names[i]);
+        } else if (MP_PARSE_NODE_IS_STRUCT_KIND(names[i], RULE_import_as_name)) {
+            mp_parse_node_struct_t *pns = (mp_parse_node_struct_t*)names[i];
+            name = local = MP_PARSE_NODE_LEAF_ARG(pns->nodes[0]);
+            if (!MP_PARSE_NODE_IS_NULL(pns->nodes[1])) {
+                local = MP_PARSE_NODE_LEAF_ARG(pns->nodes[1]);
+            }
+        } else {
+            // import *
+            continue;
+        }
+        mp_map_elem_t *value = mp_map_lookup(mod_consts, MP_OBJ_NEW_QSTR(name), MP_MAP_LOOKUP);
+        if (value != NULL) {
+            mp_map_lookup(&parser->consts, MP_OBJ_NEW_QSTR(local), MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)->value = value->value;
+        }
+    }
+}
+#endif
+
 STATIC void push_result_rule(parser_t *parser, size_t src_line, uint8_t rule_id, size_t num_args) {
     // optimise away parenthesis around an expression if possible
     if (rule_id == RULE_atom_paren) {
@@ -818,6 +969,12 @@ STATIC void push_result_rule(parser_t *parser, size_t src_line, uint8_t rule_id,
         }
     }
 
+    #if MICROPY_COMP_CONST_IMPORT
+    if (rule_id == RULE_import_from) {
+        import_consts(parser);
+    }
+    #endif
+
     #if MICROPY_COMP_CONST_FOLDING
     if (fold_logical_constants(parser, rule_id, &num_args)) {
         // we folded this rule so return straight away
@@ -838,56 +995,51 @@ STATIC void push_result_rule(parser_t *parser, size_t src_line, uint8_t rule_id,
     push_result_node(parser, (mp_parse_node_t)pn);
 }
 
-mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
-
-    // initialise parser and allocate memory for its stacks
-
-    parser_t parser;
+STATIC void parser_init(parser_t *parser, mp_lexer_t *lex) {
+    // allocate memory for the parser stacks
 
-    parser.rule_stack_alloc = MICROPY_ALLOC_PARSE_RULE_INIT;
-    parser.rule_stack_top = 0;
-    parser.rule_stack = NULL;
-    while (parser.rule_stack_alloc > 1) {
-        parser.rule_stack = m_new_maybe(rule_stack_t, parser.rule_stack_alloc);
-        if (parser.rule_stack != NULL) {
+    parser->rule_stack_alloc = MICROPY_ALLOC_PARSE_RULE_INIT;
+    parser->rule_stack_top = 0;
+    parser->rule_stack = NULL;
+    while (parser->rule_stack_alloc > 1) {
+        parser->rule_stack = m_new_maybe(rule_stack_t, parser->rule_stack_alloc);
+        if (parser->rule_stack != NULL) {
             break;
         } else {
-            parser.rule_stack_alloc /= 2;
+            parser->rule_stack_alloc /= 2;
         }
     }
 
-    parser.result_stack_alloc = MICROPY_ALLOC_PARSE_RESULT_INIT;
-    parser.result_stack_top = 0;
-    parser.result_stack = NULL;
-    while (parser.result_stack_alloc > 1) {
-        parser.result_stack = m_new_maybe(mp_parse_node_t, parser.result_stack_alloc);
-        if (parser.result_stack != NULL) {
+    parser->result_stack_alloc = MICROPY_ALLOC_PARSE_RESULT_INIT;
+    parser->result_stack_top = 0;
+    parser->result_stack = NULL;
+    while (parser->result_stack_alloc > 1) {
+        parser->result_stack = m_new_maybe(mp_parse_node_t, parser->result_stack_alloc);
+        if (parser->result_stack != NULL) {
             break;
         } else {
-            parser.result_stack_alloc /= 2;
+            parser->result_stack_alloc /= 2;
         }
     }
-    if (parser.rule_stack == NULL || parser.result_stack == NULL) {
+    if (parser->rule_stack == NULL || parser->result_stack == NULL) {
         mp_raise_msg(&mp_type_MemoryError, translate("Unable to init parser"));
     }
 
-    parser.lexer = lex;
+    parser->lexer = lex;
 
-    parser.tree.chunk = NULL;
-    parser.cur_chunk = NULL;
+    parser->tree.chunk = NULL;
+    parser->cur_chunk = NULL;
 
     #if MICROPY_COMP_CONST
-    mp_map_init(&parser.consts, 0);
+    mp_map_init(&parser->consts, 0);
     #endif
+}
 
-    // work out the top-level rule to use, and push it on the stack
-    size_t top_level_rule;
-    switch (input_kind) {
-        case MP_PARSE_SINGLE_INPUT: top_level_rule = RULE_single_input; break;
-        case MP_PARSE_EVAL_INPUT: top_level_rule = RULE_eval_input; break;
-        default: top_level_rule = RULE_file_input;
-    }
-    push_rule(&parser, lex->tok_line, top_level_rule, 0);
+// Parses the given rule from the lexer, leaving its parse node on the result
+// stack.  Returns false on a syntax error.
+STATIC bool parse_rule(parser_t *parser, size_t top_level_rule, mp_parse_input_kind_t input_kind) {
+    mp_lexer_t *lex = parser->lexer;
+    push_rule(parser, lex->tok_line, top_level_rule, 0);
 
     // parse!
 
@@ -895,22 +1047,22 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
 
     for (;;) {
         next_rule:
-        if (parser.rule_stack_top == 0) {
+        if (parser->rule_stack_top == 0) {
             break;
         }
 
         // Pop the next rule to process it
         size_t i; // state for the current rule
         size_t rule_src_line; // source line for the first token matched by the current rule
-        uint8_t rule_id = pop_rule(&parser, &i, &rule_src_line);
+        uint8_t rule_id = pop_rule(parser, &i, &rule_src_line);
         uint8_t rule_act = rule_act_table[rule_id];
         const uint16_t *rule_arg = get_rule_arg(rule_id);
         size_t n = rule_act & RULE_ACT_ARG_MASK;
 
         #if 0
         // debugging
-        printf("depth=" UINT_FMT " ", parser.rule_stack_top);
-        for (int j = 0; j < parser.rule_stack_top; ++j) {
+        printf("depth=" UINT_FMT " ", parser->rule_stack_top);
+        for (int j = 0; j < parser->rule_stack_top; ++j) {
             printf(" ");
         }
         printf("%s n=" UINT_FMT " i=" UINT_FMT " bt=%d\n", rule_name_table[rule_id], n, i, backtrack);
@@ -928,16 +1080,16 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
                     uint16_t kind = rule_arg[i] & RULE_ARG_KIND_MASK;
                     if (kind == RULE_ARG_TOK) {
                         if (lex->tok_kind == (rule_arg[i] & RULE_ARG_ARG_MASK)) {
-                            push_result_token(&parser, rule_id);
+                            push_result_token(parser, rule_id);
                             mp_lexer_to_next(lex);
                             goto next_rule;
                         }
                     } else {
                         assert(kind == RULE_ARG_RULE);
                         if (i + 1 < n) {
-                            push_rule(&parser, rule_src_line, rule_id, i + 1); // save this or-rule
+                            push_rule(parser, rule_src_line, rule_id, i + 1); // save this or-rule
                         }
-                        push_rule_from_arg(&parser, rule_arg[i]); // push child of or-rule
+                        push_rule_from_arg(parser, rule_arg[i]); // push child of or-rule
                         goto next_rule;
                     }
                 }
@@ -951,13 +1103,13 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
                     assert(i > 0);
                     if ((rule_arg[i - 1] & RULE_ARG_KIND_MASK) == RULE_ARG_OPT_RULE) {
                         // an optional rule that failed, so continue with next arg
-                        push_result_node(&parser, MP_PARSE_NODE_NULL);
+                        push_result_node(parser, MP_PARSE_NODE_NULL);
                         backtrack = false;
                     } else {
                         // a mandatory rule that failed, so propagate backtrack
                         if (i > 1) {
                             // already eaten tokens so can't backtrack
-                            goto syntax_error;
+                            return false;
                         } else {
                             goto next_rule;
                         }
@@ -972,14 +1124,14 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
                         if (lex->tok_kind == tok_kind) {
                             // matched token
                             if (tok_kind == MP_TOKEN_NAME) {
-                                push_result_token(&parser, rule_id);
+                                push_result_token(parser, rule_id);
                             }
                             mp_lexer_to_next(lex);
                         } else {
                             // failed to match token
                             if (i > 0) {
                                 // already eaten tokens so can't backtrack
-                                goto syntax_error;
+                                return false;
                             } else {
                                 // this rule failed, so backtrack
                                 backtrack = true;
@@ -987,8 +1139,8 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
                             }
                         }
                     } else {
-                        push_rule(&parser, rule_src_line, rule_id, i + 1); // save this and-rule
-                        push_rule_from_arg(&parser, rule_arg[i]); // push child of and-rule
+                        push_rule(parser, rule_src_line, rule_id, i + 1); // save this and-rule
+                        push_rule_from_arg(parser, rule_arg[i]); // push child of and-rule
                         goto next_rule;
                     }
                 }
@@ -999,16 +1151,16 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
 
                 #if !MICROPY_ENABLE_DOC_STRING
                 // this code discards lonely statements, such as doc strings
-                if (input_kind != MP_PARSE_SINGLE_INPUT && rule_id == RULE_expr_stmt && peek_result(&parser, 0) == MP_PARSE_NODE_NULL) {
-                    mp_parse_node_t p = peek_result(&parser, 1);
+                if (input_kind != MP_PARSE_SINGLE_INPUT && rule_id == RULE_expr_stmt && peek_result(parser, 0) == MP_PARSE_NODE_NULL) {
+                    mp_parse_node_t p = peek_result(parser, 1);
                     if ((MP_PARSE_NODE_IS_LEAF(p) && !MP_PARSE_NODE_IS_ID(p))
                         || MP_PARSE_NODE_IS_STRUCT_KIND(p, RULE_const_object)) {
-                        pop_result(&parser); // MP_PARSE_NODE_NULL
-                        pop_result(&parser); // const expression (leaf or RULE_const_object)
+                        pop_result(parser); // MP_PARSE_NODE_NULL
+                        pop_result(parser); // const expression (leaf or RULE_const_object)
                         // Pushing the "pass" rule here will overwrite any RULE_const_object
                         // entry that was on the result stack, allowing the GC to reclaim
                         // the memory from the const object when needed.
-                        push_result_rule(&parser, rule_src_line, RULE_pass_stmt, 0);
+                        push_result_rule(parser, rule_src_line, RULE_pass_stmt, 0);
                         break;
                     }
                 }
@@ -1028,7 +1180,7 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
                         }
                     } else {
                         // rules are always pushed
-                        if (peek_result(&parser, i) != MP_PARSE_NODE_NULL) {
+                        if (peek_result(parser, i) != MP_PARSE_NODE_NULL) {
                             num_not_nil += 1;
                         }
                         i += 1;
@@ -1039,22 +1191,22 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
                     // this rule has only 1 argument and should not be emitted
                     mp_parse_node_t pn = MP_PARSE_NODE_NULL;
                     for (size_t x = 0; x < i; ++x) {
-                        mp_parse_node_t pn2 = pop_result(&parser);
+                        mp_parse_node_t pn2 = pop_result(parser);
                         if (pn2 != MP_PARSE_NODE_NULL) {
                             pn = pn2;
                         }
                     }
-                    push_result_node(&parser, pn);
+                    push_result_node(parser, pn);
                 } else {
                     // this rule must be emitted
 
                     if (rule_act & RULE_ACT_ADD_BLANK) {
                         // and add an extra blank node at the end (used by the compiler to store data)
-                        push_result_node(&parser, MP_PARSE_NODE_NULL);
+                        push_result_node(parser, MP_PARSE_NODE_NULL);
                         i += 1;
                     }
 
-                    push_result_rule(&parser, rule_src_line, rule_id, i);
+                    push_result_rule(parser, rule_src_line, rule_id, i);
                 }
                 break;
             }
@@ -1089,7 +1241,7 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
                                 backtrack = false;
                             } else {
                                 // list doesn't allowing trailing separator; fail
-                                goto syntax_error;
+                                return false;
                             }
                         } else {
                             // fail on separator; finish parsing list
@@ -1104,7 +1256,7 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
                                 if (i & 1 & n) {
                                     // separators which are tokens are not pushed to result stack
                                 } else {
-                                    push_result_token(&parser, rule_id);
+                                    push_result_token(parser, rule_id);
                                 }
                                 mp_lexer_to_next(lex);
                                 // got element of list, so continue parsing list
@@ -1117,8 +1269,8 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
                             }
                         } else {
                             assert((arg & RULE_ARG_KIND_MASK) == RULE_ARG_RULE);
-                            push_rule(&parser, rule_src_line, rule_id, i + 1); // save this list-rule
-                            push_rule_from_arg(&parser, arg); // push child of list-rule
+                            push_rule(parser, rule_src_line, rule_id, i + 1); // save this list-rule
+                            push_rule_from_arg(parser, arg); // push child of list-rule
                             goto next_rule;
                         }
                     }
@@ -1136,111 +1288,201 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
                     // list matched single item
                     if (had_trailing_sep) {
                         // if there was a trailing separator, make a list of a single item
-                        push_result_rule(&parser, rule_src_line, rule_id, i);
+                        push_result_rule(parser, rule_src_line, rule_id, i);
                     } else {
                         // just leave single item on stack (ie don't wrap in a list)
                     }
                 } else {
-                    push_result_rule(&parser, rule_src_line, rule_id, i);
+                    push_result_rule(parser, rule_src_line, rule_id, i);
                 }
                 break;
             }
         }
     }
 
-    #if MICROPY_COMP_CONST
-    mp_map_deinit(&parser.consts);
-    #endif
+    // a rule that failed at the top level is a syntax error too
+    return !backtrack;
+}
 
+STATIC void parser_finish_tree(parser_t *parser) {
     // truncate final chunk and link into chain of chunks
-    if (parser.cur_chunk != NULL) {
-        (void)m_renew_maybe(byte, parser.cur_chunk,
-            sizeof(mp_parse_chunk_t) + parser.cur_chunk->alloc,
-            sizeof(mp_parse_chunk_t) + parser.cur_chunk->union_.used,
+    if (parser->cur_chunk != NULL) {
+        (void)m_renew_maybe(byte, parser->cur_chunk,
+            sizeof(mp_parse_chunk_t) + parser->cur_chunk->alloc,
+            sizeof(mp_parse_chunk_t) + parser->cur_chunk->union_.used,
             false);
-        parser.cur_chunk->alloc = parser.cur_chunk->union_.used;
-        parser.cur_chunk->union_.next = parser.tree.chunk;
-        parser.tree.chunk = parser.cur_chunk;
+        parser->cur_chunk->alloc = parser->cur_chunk->union_.used;
+        parser->cur_chunk->union_.next = parser->tree.chunk;
+        parser->tree.chunk = parser->cur_chunk;
     }
+    parser->cur_chunk = NULL;
+}
 
-    if (
-        lex->tok_kind != MP_TOKEN_END // check we are at the end of the token stream
-        || parser.result_stack_top == 0 // check that we got a node (can fail on empty input)
-        ) {
-    syntax_error:;
-        mp_obj_t exc;
-        switch(lex->tok_kind) {
-            case MP_TOKEN_INDENT:
-                exc = mp_obj_new_exception_msg(&mp_type_IndentationError,
-                    translate("unexpected indent"));
-                break;
-            case MP_TOKEN_DEDENT_MISMATCH:
-                exc = mp_obj_new_exception_msg(&mp_type_IndentationError,
-                    translate("unindent does not match any outer indentation level"));
-                break;
+STATIC NORETURN void parser_raise_syntax_error(mp_lexer_t *lex) {
+    mp_obj_t exc;
+    switch(lex->tok_kind) {
+        case MP_TOKEN_INDENT:
+            exc = mp_obj_new_exception_msg(&mp_type_IndentationError,
+                translate("unexpected indent"));
+            break;
+        case MP_TOKEN_DEDENT_MISMATCH:
+            exc = mp_obj_new_exception_msg(&mp_type_IndentationError,
+                translate("unindent does not match any outer indentation level"));
+            break;
 #if MICROPY_COMP_FSTRING_LITERAL
 #if MICROPY_ERROR_REPORTING == MICROPY_ERROR_REPORTING_DETAILED
-            case MP_TOKEN_FSTRING_BACKSLASH:
-                exc = mp_obj_new_exception_msg(&mp_type_SyntaxError,
-                    translate("f-string expression part cannot include a backslash"));
-                break;
-            case MP_TOKEN_FSTRING_COMMENT:
-                exc = mp_obj_new_exception_msg(&mp_type_SyntaxError,
-                    translate("f-string expression part cannot include a '#'"));
-                break;
-            case MP_TOKEN_FSTRING_UNCLOSED:
-                exc = mp_obj_new_exception_msg(&mp_type_SyntaxError,
-                    translate("f-string: expecting '}'"));
-                break;
-            case MP_TOKEN_FSTRING_UNOPENED:
-                exc = mp_obj_new_exception_msg(&mp_type_SyntaxError,
-                    translate("f-string: single '}' is not allowed"));
-                break;
-            case MP_TOKEN_FSTRING_EMPTY_EXP:
-                exc = mp_obj_new_exception_msg(&mp_type_SyntaxError,
-                    translate("f-string: empty expression not allowed"));
-                break;
-            case MP_TOKEN_FSTRING_RAW:
-                exc = mp_obj_new_exception_msg(&mp_type_NotImplementedError,
-                    translate("raw f-strings are not implemented"));
-                break;
+        case MP_TOKEN_FSTRING_BACKSLASH:
+            exc = mp_obj_new_exception_msg(&mp_type_SyntaxError,
+                translate("f-string expression part cannot include a backslash"));
+            break;
+        case MP_TOKEN_FSTRING_COMMENT:
+            exc = mp_obj_new_exception_msg(&mp_type_SyntaxError,
+                translate("f-string expression part cannot include a '#'"));
+            break;
+        case MP_TOKEN_FSTRING_UNCLOSED:
+            exc = mp_obj_new_exception_msg(&mp_type_SyntaxError,
+                translate("f-string: expecting '}'"));
+            break;
+        case MP_TOKEN_FSTRING_UNOPENED:
+            exc = mp_obj_new_exception_msg(&mp_type_SyntaxError,
+                translate("f-string: single '}' is not allowed"));
+            break;
+        case MP_TOKEN_FSTRING_EMPTY_EXP:
+            exc = mp_obj_new_exception_msg(&mp_type_SyntaxError,
+                translate("f-string: empty expression not allowed"));
+            break;
+        case MP_TOKEN_FSTRING_RAW:
+            exc = mp_obj_new_exception_msg(&mp_type_NotImplementedError,
+                translate("raw f-strings are not implemented"));
+            break;
 #else
-            case MP_TOKEN_FSTRING_BACKSLASH:
-            case MP_TOKEN_FSTRING_COMMENT:
-            case MP_TOKEN_FSTRING_UNCLOSED:
-            case MP_TOKEN_FSTRING_UNOPENED:
-            case MP_TOKEN_FSTRING_EMPTY_EXP:
-            case MP_TOKEN_FSTRING_RAW:
-                exc = mp_obj_new_exception_msg(&mp_type_SyntaxError,
-                    translate("malformed f-string"));
-                break;
+        case MP_TOKEN_FSTRING_BACKSLASH:
+        case MP_TOKEN_FSTRING_COMMENT:
+        case MP_TOKEN_FSTRING_UNCLOSED:
+        case MP_TOKEN_FSTRING_UNOPENED:
+        case MP_TOKEN_FSTRING_EMPTY_EXP:
+        case MP_TOKEN_FSTRING_RAW:
+            exc = mp_obj_new_exception_msg(&mp_type_SyntaxError,
+                translate("malformed f-string"));
+            break;
 #endif
 #endif
-            default:
-                exc = mp_obj_new_exception_msg(&mp_type_SyntaxError,
-                    translate("invalid syntax"));
-                break;
+        default:
+            exc = mp_obj_new_exception_msg(&mp_type_SyntaxError,
+                translate("invalid syntax"));
+            break;
+    }
+    // add traceback to give info about file name and location
+    // we don't have a 'block' name, so just pass the NULL qstr to indicate this
+    mp_obj_exception_add_traceback(exc, lex->source_name, lex->tok_line, MP_QSTR_NULL);
+    nlr_raise(exc);
+}
+
+STATIC void parser_free(parser_t *parser) {
+    #if MICROPY_COMP_CONST
+    #if MICROPY_COMP_CONST_IMPORT
+    if (MP_STATE_VM(comp_const_export) != NULL) {
+        // hand the public consts of this module to whoever asked for them
+        for (size_t i = 0; i < parser->consts.alloc; i++) {
+            if (MP_MAP_SLOT_IS_FILLED(&parser->consts, i)
+                && qstr_str(MP_OBJ_QSTR_VALUE(parser->consts.table[i].key))[0] != '_') {
+                mp_obj_dict_store(MP_OBJ_FROM_PTR(MP_STATE_VM(comp_const_export)),
+                    parser->consts.table[i].key, parser->consts.table[i].value);
+            }
         }
-        // add traceback to give info about file name and location
-        // we don't have a 'block' name, so just pass the NULL qstr to indicate this
-        mp_obj_exception_add_traceback(exc, lex->source_name, lex->tok_line, MP_QSTR_NULL);
-        nlr_raise(exc);
+    }
+    #endif
+    mp_map_deinit(&parser->consts);
+    #endif
+
+    // free the memory that we don't need anymore
+    m_del(rule_stack_t, parser->rule_stack, parser->rule_stack_alloc);
+    m_del(mp_parse_node_t, parser->result_stack, parser->result_stack_alloc);
+
+    // we also free the lexer on behalf of the caller
+    mp_lexer_free(parser->lexer);
+}
+
+mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
+    parser_t parser;
+    parser_init(&parser, lex);
+
+    // work out the top-level rule to use and parse it
+    size_t top_level_rule;
+    switch (input_kind) {
+        case MP_PARSE_SINGLE_INPUT: top_level_rule = RULE_single_input; break;
+        case MP_PARSE_EVAL_INPUT: top_level_rule = RULE_eval_input; break;
+        default: top_level_rule = RULE_file_input;
+    }
+    bool ok = parse_rule(&parser, top_level_rule, input_kind);
+
+    parser_finish_tree(&parser);
+
+    if (!ok
+        || lex->tok_kind != MP_TOKEN_END // check we are at the end of the token stream
+        || parser.result_stack_top == 0 // check that we got a node (can fail on empty input)
+        ) {
+        parser_raise_syntax_error(lex);
     }
 
     // get the root parse node that we created
     assert(parser.result_stack_top == 1);
     parser.tree.root = parser.result_stack[0];
 
-    // free the memory that we don't need anymore
-    m_del(rule_stack_t, parser.rule_stack, parser.rule_stack_alloc);
-    m_del(mp_parse_node_t, parser.result_stack, parser.result_stack_alloc);
-
-    // we also free the lexer on behalf of the caller
-    mp_lexer_free(lex);
+    parser_free(&parser);
 
     return parser.tree;
 }
 
+#if MICROPY_COMP_INCREMENTAL
+STATIC size_t parser_tree_size(parser_t *parser) {
+    size_t size = 0;
+    if (parser->cur_chunk != NULL) {
+        size = parser->cur_chunk->union_.used;
+    }
+    for (mp_parse_chunk_t *chunk = parser->tree.chunk; chunk != NULL; chunk = chunk->union_.next) {
+        size += chunk->alloc;
+    }
+    return size;
+}
+
+void mp_parse_incremental(mp_lexer_t *lex, void (*stmt_fun)(void *env, mp_parse_tree_t *tree), void *env) {
+    parser_t parser;
+    parser_init(&parser, lex);
+
+    while (lex->tok_kind != MP_TOKEN_END) {
+        // parse top-level statements until their tree reaches the size limit
+        size_t src_line = lex->tok_line;
+        do {
+            bool ok = parse_rule(&parser, RULE_file_input_3, MP_PARSE_FILE_INPUT);
+            if (!ok || parser.result_stack_top == 0) {
+                parser_raise_syntax_error(lex);
+            }
+            if (MP_PARSE_NODE_IS_TOKEN_KIND(peek_result(&parser, 0), MP_TOKEN_NEWLINE)) {
+                pop_result(&parser);
+            }
+        } while (lex->tok_kind != MP_TOKEN_END && parser_tree_size(&parser) < MICROPY_COMP_INCREMENTAL_TREE_SIZE);
+
+        if (parser.result_stack_top > 1) {
+            push_result_rule(&parser, src_line, RULE_file_input_2, parser.result_stack_top);
+        }
+        parser_finish_tree(&parser);
+
+        // hand over the tree; the consts and the lexer carry on to the next statements
+        mp_parse_tree_t tree = parser.tree;
+        parser.tree.chunk = NULL;
+        if (parser.result_stack_top == 0) {
+            mp_parse_tree_clear(&tree);
+        } else {
+            tree.root = pop_result(&parser);
+            stmt_fun(env, &tree);
+        }
+    }
+
+    parser_free(&parser);
+}
+#endif
+
 void mp_parse_tree_clear(mp_parse_tree_t *tree) {
     mp_parse_chunk_t *chunk = tree->chunk;
     while (chunk != NULL) {
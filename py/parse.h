@@ -104,4 +104,13 @@ typedef struct _mp_parse_t {
 mp_parse_tree_t mp_parse(struct _mp_lexer_t *lex, mp_parse_input_kind_t input_kind);
 void mp_parse_tree_clear(mp_parse_tree_t *tree);
 
+#if MICROPY_COMP_INCREMENTAL
+// parse file input a few top-level statements at a time, passing the tree of
+// each group of statements to stmt_fun, which takes ownership of the tree and
+// must clear it
+// the parser will raise an exception if an error occurred
+// the parser will free the lexer before it returns
+void mp_parse_incremental(struct _mp_lexer_t *lex, void (*stmt_fun)(void *env, mp_parse_tree_t *tree), void *env);
+#endif
+
 #endif // MICROPY_INCLUDED_PY_PARSE_H
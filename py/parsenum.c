@@ -26,6 +26,7 @@
 
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "py/runtime.h"
 #include "py/parsenumbase.h"
@@ -48,6 +49,27 @@ STATIC NORETURN void raise_exc(mp_obj_t exc, mp_lexer_t *lex) {
     nlr_raise(exc);
 }
 
+#if MICROPY_OPT_FAST_NUM_PARSE && MP_ENDIANNESS_LITTLE
+#define PARSE_EIGHT_DIGITS (1)
+
+// If the 8 bytes at str are all decimal digits then return their value,
+// otherwise return -1.  The digits are checked and combined within one
+// 64-bit word, pairing up neighbours at each step.
+STATIC int32_t parse_eight_digits(const byte *str) {
+    uint64_t v;
+    memcpy(&v, str, sizeof(v));
+    if ((v & 0xf0f0f0f0f0f0f0f0) != 0x3030303030303030
+        || ((v + 0x0606060606060606) & 0xf0f0f0f0f0f0f0f0) != 0x3030303030303030) {
+        return -1;
+    }
+    v -= 0x3030303030303030;
+    v = (v * 10 + (v >> 8)) & 0x00ff00ff00ff00ff;
+    v = (v * 100 + (v >> 16)) & 0x0000ffff0000ffff;
+    v = (v * 10000 + (v >> 32)) & 0xffffffff;
+    return (int32_t)v;
+}
+#endif
+
 mp_obj_t mp_parse_num_integer(const char *restrict str_, size_t len, int base, mp_lexer_t *lex) {
     const byte *restrict str = (const byte *)str_;
     const byte *restrict top = str + len;
@@ -80,6 +102,19 @@ mp_obj_t mp_parse_num_integer(const char *restrict str_, size_t len, int base, m
     // string should be an integer number
     mp_int_t int_val = 0;
     const byte *restrict str_val_start = str;
+    #if PARSE_EIGHT_DIGITS
+    if (base == 10) {
+        // take whole groups of 8 digits while the result is sure to fit
+        while (top - str >= 8 && int_val <= (MP_SMALL_INT_MAX - 99999999) / 100000000) {
+            int32_t eight = parse_eight_digits(str);
+            if (eight < 0) {
+                break;
+            }
+            int_val = int_val * 100000000 + eight;
+            str += 8;
+        }
+    }
+    #endif
     for (; str < top; str++) {
         // get next digit as a value
         mp_uint_t dig = *str;
@@ -177,14 +212,22 @@ mp_obj_t mp_parse_num_decimal(const char *str, size_t len, bool allow_imag, bool
 
 // DEC_VAL_MAX only needs to be rough and is used to retain precision while not overflowing
 // SMALL_NORMAL_VAL is the smallest power of 10 that is still a normal float
+// EXACT_SIG_MAX and EXACT_EXP_MAX bound the integers and powers of 10 that are exact floats,
+// and EXACT_SIG_TYPE holds such an integer
 #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
 #define DEC_VAL_MAX 1e20F
 #define SMALL_NORMAL_VAL (1e-37F)
 #define SMALL_NORMAL_EXP (-37)
+#define EXACT_SIG_MAX ((uint32_t)1 << 24)
+#define EXACT_EXP_MAX (10)
+#define EXACT_SIG_TYPE uint32_t
 #elif MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_DOUBLE
 #define DEC_VAL_MAX 1e200
 #define SMALL_NORMAL_VAL (1e-307)
 #define SMALL_NORMAL_EXP (-307)
+#define EXACT_SIG_MAX ((uint64_t)1 << 53)
+#define EXACT_EXP_MAX (22)
+#define EXACT_SIG_TYPE uint64_t
 #endif
 
     const char *top = str + len;
@@ -233,10 +276,29 @@ mp_obj_t mp_parse_num_decimal(const char *str, size_t len, bool allow_imag, bool
         bool exp_neg = false;
         int exp_val = 0;
         int exp_extra = 0;
+        #if MICROPY_OPT_FAST_NUM_PARSE
+        // Accumulate the digits in an integer for as long as it is exactly
+        // representable, which is also when the float sum below is exact.
+        EXACT_SIG_TYPE sig = 0;
+        bool sig_exact = true;
+        #endif
         while (str < top) {
             unsigned int dig = *str++;
             if ('0' <= dig && dig <= '9') {
                 dig -= '0';
+                #if MICROPY_OPT_FAST_NUM_PARSE
+                if (sig_exact && in != PARSE_DEC_IN_EXP) {
+                    if (sig < (EXACT_SIG_MAX - 9) / 10) {
+                        sig = 10 * sig + dig;
+                        if (in == PARSE_DEC_IN_FRAC) {
+                            --exp_extra;
+                        }
+                        continue;
+                    }
+                    sig_exact = false;
+                    dec_val = (mp_float_t)sig;
+                }
+                #endif
                 if (in == PARSE_DEC_IN_EXP) {
                     // don't overflow exp_val when adding next digit, instead just truncate
                     // it and the resulting float will still be correct, either inf or 0.0
@@ -293,11 +355,32 @@ mp_obj_t mp_parse_num_decimal(const char *str, size_t len, bool allow_imag, bool
 
         // apply the exponent, making sure it's not a subnormal value
         exp_val += exp_extra;
-        if (exp_val < SMALL_NORMAL_EXP) {
-            exp_val -= SMALL_NORMAL_EXP;
-            dec_val *= SMALL_NORMAL_VAL;
+        #if MICROPY_OPT_FAST_NUM_PARSE
+        static const mp_float_t exact_pow10[EXACT_EXP_MAX + 1] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+            #if EXACT_EXP_MAX > 10
+            1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+            #endif
+        };
+        if (sig_exact) {
+            dec_val = (mp_float_t)sig;
+        }
+        if (sig_exact && -EXACT_EXP_MAX <= exp_val && exp_val <= EXACT_EXP_MAX) {
+            // both operands are exact so the result is correctly rounded
+            if (exp_val >= 0) {
+                dec_val *= exact_pow10[exp_val];
+            } else {
+                dec_val /= exact_pow10[-exp_val];
+            }
+        } else
+        #endif
+        {
+            if (exp_val < SMALL_NORMAL_EXP) {
+                exp_val -= SMALL_NORMAL_EXP;
+                dec_val *= SMALL_NORMAL_VAL;
+            }
+            dec_val *= MICROPY_FLOAT_C_FUN(pow)(10, exp_val);
         }
-        dec_val *= MICROPY_FLOAT_C_FUN(pow)(10, exp_val);
     }
 
     // negate value if needed
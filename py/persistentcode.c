@@ -49,10 +49,17 @@
     ((MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE) << 0) \
     | ((MICROPY_PY_BUILTINS_STR_UNICODE) << 1) \
     )
+
+// Set when the bytecode may contain the fused compare-and-jump opcodes.  This
+// flag is optional on load: a VM with the fused opcodes runs bytecode without
+// them too, but one without them can't load bytecode that uses them.
+#define MPY_FEATURE_FUSED_COMPARE_JUMP (1 << 2)
+
 // This is a version of the flags that can be configured at runtime.
 #define MPY_FEATURE_FLAGS_DYNAMIC ( \
     ((MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE_DYNAMIC) << 0) \
     | ((MICROPY_PY_BUILTINS_STR_UNICODE_DYNAMIC) << 1) \
+    | ((MICROPY_OPT_FUSED_COMPARE_JUMP && !MICROPY_DYNAMIC_COMPILER) ? MPY_FEATURE_FUSED_COMPARE_JUMP : 0) \
     )
 
 #if MICROPY_PERSISTENT_CODE_LOAD || (MICROPY_PERSISTENT_CODE_SAVE && !MICROPY_DYNAMIC_COMPILER)
@@ -106,6 +113,47 @@ STATIC void raise_corrupt_mpy(void) {
     mp_raise_RuntimeError(translate("Corrupt .mpy file"));
 }
 
+#if MICROPY_PERSISTENT_CODE_LOAD_XIP
+
+#include "py/objstr.h"
+
+// Reader for .mpy data in memory that stays valid, see mp_raw_code_load_rom.
+typedef struct _mp_reader_rom_t {
+    const byte *cur;
+    const byte *end;
+    void *owner;
+} mp_reader_rom_t;
+
+STATIC mp_uint_t mp_reader_rom_readbyte(void *data) {
+    mp_reader_rom_t *reader = (mp_reader_rom_t*)data;
+    if (reader->cur < reader->end) {
+        return *reader->cur++;
+    } else {
+        return MP_READER_EOF;
+    }
+}
+
+STATIC void mp_reader_rom_close(void *data) {
+    (void)data;
+}
+
+// If the reader reads from memory that stays valid, returns a pointer to the
+// next len bytes in place and skips over them, else returns NULL.
+STATIC const byte *read_rom(mp_reader_t *reader, size_t len) {
+    if (reader->readbyte != mp_reader_rom_readbyte) {
+        return NULL;
+    }
+    mp_reader_rom_t *rr = (mp_reader_rom_t*)reader->data;
+    if ((size_t)(rr->end - rr->cur) < len) {
+        raise_corrupt_mpy();
+    }
+    const byte *data = rr->cur;
+    rr->cur += len;
+    return data;
+}
+
+#endif
+
 STATIC int read_byte(mp_reader_t *reader) {
     mp_uint_t b = reader->readbyte(reader->data);
     if (b == MP_READER_EOF) {
@@ -115,6 +163,13 @@ STATIC int read_byte(mp_reader_t *reader) {
 }
 
 STATIC void read_bytes(mp_reader_t *reader, byte *buf, size_t len) {
+    #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+    const byte *data = read_rom(reader, len);
+    if (data != NULL) {
+        memcpy(buf, data, len);
+        return;
+    }
+    #endif
     while (len-- > 0) {
         mp_uint_t b =reader->readbyte(reader->data);
         if (b == MP_READER_EOF) {
@@ -141,6 +196,12 @@ STATIC size_t read_uint(mp_reader_t *reader) {
 
 STATIC qstr load_qstr(mp_reader_t *reader) {
     size_t len = read_uint(reader);
+    #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+    const byte *data = read_rom(reader, len);
+    if (data != NULL) {
+        return qstr_from_strn((const char*)data, len);
+    }
+    #endif
     char str[len];
     read_bytes(reader, (byte*)str, len);
     qstr qst = qstr_from_strn(str, len);
@@ -153,15 +214,30 @@ STATIC mp_obj_t load_obj(mp_reader_t *reader) {
         return MP_OBJ_FROM_PTR(&mp_const_ellipsis_obj);
     } else {
         size_t len = read_uint(reader);
-        vstr_t vstr;
-        vstr_init_len(&vstr, len);
-        read_bytes(reader, (byte*)vstr.buf, len);
-        if (obj_type == 's' || obj_type == 'b') {
-            return mp_obj_new_str_from_vstr(obj_type == 's' ? &mp_type_str : &mp_type_bytes, &vstr);
-        } else if (obj_type == 'i') {
-            return mp_parse_num_integer(vstr.buf, vstr.len, 10, NULL);
+        const char *data;
+        #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+        data = (const char*)read_rom(reader, len);
+        if (data != NULL) {
+            // str and bytes constants keep their data where it is
+            if (obj_type == 's' || obj_type == 'b') {
+                return mp_obj_new_str_shared(obj_type == 's' ? &mp_type_str : &mp_type_bytes,
+                    ((mp_reader_rom_t*)reader->data)->owner, (const byte*)data, len);
+            }
+        } else
+        #endif
+        {
+            vstr_t vstr;
+            vstr_init_len(&vstr, len);
+            read_bytes(reader, (byte*)vstr.buf, len);
+            if (obj_type == 's' || obj_type == 'b') {
+                return mp_obj_new_str_from_vstr(obj_type == 's' ? &mp_type_str : &mp_type_bytes, &vstr);
+            }
+            data = vstr.buf;
+        }
+        if (obj_type == 'i') {
+            return mp_parse_num_integer(data, len, 10, NULL);
         } else if (obj_type == 'f' || obj_type == 'c') {
-            return mp_parse_num_decimal(vstr.buf, vstr.len, obj_type == 'c', false, NULL);
+            return mp_parse_num_decimal(data, len, obj_type == 'c', false, NULL);
         }
     }
     raise_corrupt_mpy();
@@ -234,7 +310,8 @@ mp_raw_code_t *mp_raw_code_load(mp_reader_t *reader) {
     read_bytes(reader, header, sizeof(header));
     if (header[0] != 'M'
         || header[1] != MPY_VERSION
-        || header[2] != MPY_FEATURE_FLAGS
+        || (header[2] & ~MPY_FEATURE_FUSED_COMPARE_JUMP) != MPY_FEATURE_FLAGS
+        || ((header[2] & MPY_FEATURE_FUSED_COMPARE_JUMP) && !MICROPY_OPT_FUSED_COMPARE_JUMP)
         || header[3] > mp_small_int_bits()) {
         mp_raise_MpyError(translate("Incompatible .mpy file. Please update all .mpy files. See http://adafru.it/mpy-update for more info."));
     }
@@ -243,6 +320,14 @@ mp_raw_code_t *mp_raw_code_load(mp_reader_t *reader) {
     return rc;
 }
 
+#if MICROPY_PERSISTENT_CODE_LOAD_XIP
+mp_raw_code_t *mp_raw_code_load_rom(const byte *buf, size_t len, void *owner) {
+    mp_reader_rom_t rr = {buf, buf + len, owner};
+    mp_reader_t reader = {&rr, mp_reader_rom_readbyte, NULL, mp_reader_rom_close};
+    return mp_raw_code_load(&reader);
+}
+#endif
+
 mp_raw_code_t *mp_raw_code_load_mem(const byte *buf, size_t len) {
     mp_reader_t reader;
     mp_reader_new_mem(&reader, buf, len, 0);
@@ -413,6 +498,19 @@ void mp_raw_code_save_file(mp_raw_code_t *rc, const char *filename) {
     close(fd);
 }
 
+#elif MICROPY_VFS
+
+#include "extmod/vfs.h"
+#include "py/stream.h"
+
+void mp_raw_code_save_file(mp_raw_code_t *rc, const char *filename) {
+    mp_obj_t args[2] = { mp_obj_new_str(filename, strlen(filename)), MP_OBJ_NEW_QSTR(MP_QSTR_wb) };
+    mp_obj_t file = mp_vfs_open(2, args, (mp_map_t*)&mp_const_empty_map);
+    mp_print_t file_print = {MP_OBJ_TO_PTR(file), mp_stream_write_adaptor};
+    mp_raw_code_save(rc, &file_print);
+    mp_stream_close(file);
+}
+
 #else
 #error mp_raw_code_save_file not implemented for this platform
 #endif
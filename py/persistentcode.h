@@ -34,6 +34,21 @@ mp_raw_code_t *mp_raw_code_load(mp_reader_t *reader);
 mp_raw_code_t *mp_raw_code_load_mem(const byte *buf, size_t len);
 mp_raw_code_t *mp_raw_code_load_file(const char *filename);
 
+#if MICROPY_PERSISTENT_CODE_LOAD_XIP
+// Load .mpy data that stays unchanged for as long as the loaded code may run.
+// Its str/bytes constants are used in place.  owner is the heap block holding
+// buf, which those constants keep alive, or NULL if buf is never freed, eg
+// memory-mapped flash.
+mp_raw_code_t *mp_raw_code_load_rom(const byte *buf, size_t len, void *owner);
+
+// Ports with MICROPY_PERSISTENT_CODE_LOAD_XIP provide this.  It returns the data
+// of the given .mpy file, setting *len to its length and *owner as for
+// mp_raw_code_load_rom, or NULL to have the file read as usual.  The data must
+// not change afterwards, so files that can be rewritten should be copied to the
+// heap rather than mapped.
+const byte *mp_import_map_file(const char *path, size_t *len, void **owner);
+#endif
+
 void mp_raw_code_save(mp_raw_code_t *rc, mp_print_t *print);
 void mp_raw_code_save_file(mp_raw_code_t *rc, const char *filename);
 
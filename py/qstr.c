@@ -35,8 +35,8 @@
 
 #include "supervisor/linker.h"
 
-// NOTE: we are using linear arrays to store and search for qstr's (unique strings, interned strings)
-// ultimately we will replace this with a static hash table of some kind
+// NOTE: we are using linear arrays to store qstr's (unique strings, interned strings)
+// with MICROPY_QSTR_HASH_INDEX they are searched through hash indexes, otherwise linearly
 // also probably need to include the length in the string data, to allow null bytes in the string
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
@@ -83,13 +83,17 @@
 #define QSTR_EXIT()
 #endif
 
-// this must match the equivalent function in makeqstrdata.py
-mp_uint_t qstr_compute_hash(const byte *data, size_t len) {
+#define QSTR_HASH_INIT (5381)
+
+STATIC uint32_t qstr_hash_bytes(uint32_t hash, const byte *data, size_t len) {
     // djb2 algorithm; see http://www.cse.yorku.ca/~oz/hash.html
-    mp_uint_t hash = 5381;
     for (const byte *top = data + len; data < top; data++) {
         hash = ((hash << 5) + hash) ^ (*data); // hash * 33 ^ data
     }
+    return hash;
+}
+
+STATIC mp_uint_t qstr_mask_hash(uint32_t hash) {
     hash &= Q_HASH_MASK;
     // Make sure that valid hash is never zero, zero means "hash not computed"
     if (hash == 0) {
@@ -98,11 +102,66 @@ mp_uint_t qstr_compute_hash(const byte *data, size_t len) {
     return hash;
 }
 
+// this must match the equivalent function in makeqstrdata.py
+mp_uint_t qstr_compute_hash(const byte *data, size_t len) {
+    return qstr_mask_hash(qstr_hash_bytes(QSTR_HASH_INIT, data, len));
+}
+
+#if MICROPY_QSTR_HASH_INDEX
+
+// ROM pools carry a perfect hash generated by makeqstrdata.py, laid out as
+//   [num_buckets, num_slots, seed[num_buckets]..., slot[num_slots]...]
+// The full hash of a string picks its bucket, and hashing the string again
+// from that bucket's seed picks the slot, which holds the index of the only
+// qstr in the pool that could match.
+//
+// Dynamic pools are followed in memory by an open-addressed table of
+// 2 * alloc slots, each holding 1 + the index of a qstr in the pool (0 means
+// the slot is empty).
+
+#if MICROPY_QSTR_POOL_MAX_ENTRIES < 256
+typedef uint8_t qstr_slot_t;
+#else
+typedef uint16_t qstr_slot_t;
+#endif
+
+#define QSTR_POOL_SLOTS(pool) ((qstr_slot_t*)&(pool)->qstrs[(pool)->alloc])
+#define QSTR_POOL_NUM_SLOTS(pool) (2 * (pool)->alloc)
+
+// this must match compute_index_hash in makeqstrdata.py, given the djb2 hash
+STATIC uint32_t qstr_index_mix(uint32_t hash) {
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3b;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+#ifndef NO_QSTR
+STATIC const uint16_t mp_qstr_const_index[] = {
+#define QDEF(id, str)
+#define TRANSLATION(id, length, compressed...)
+#define QSTR_INDEX(...) __VA_ARGS__,
+#include "genhdr/qstrdefs.generated.h"
+#undef QSTR_INDEX
+#undef TRANSLATION
+#undef QDEF
+};
+#endif
+
+#endif // MICROPY_QSTR_HASH_INDEX
+
 const qstr_pool_t mp_qstr_const_pool = {
     NULL,               // no previous pool
     0,                  // no previous pool
     10,                 // set so that the first dynamically allocated pool is twice this size; must be <= the len (just below)
     MP_QSTRnumber_of,   // corresponds to number of strings in array just below
+    #if MICROPY_QSTR_HASH_INDEX
+    #ifndef NO_QSTR
+    mp_qstr_const_index,
+    #else
+    NULL,
+    #endif
+    #endif
     {
 #ifndef NO_QSTR
 #define QDEF(id, str) str,
@@ -141,7 +200,7 @@ STATIC const byte *find_qstr(qstr q) {
 }
 
 // qstr_mutex must be taken while in this function
-STATIC qstr qstr_add(const byte *q_ptr) {
+STATIC qstr qstr_add(const byte *q_ptr, uint32_t hash) {
     DEBUG_printf("QSTR: add hash=%d len=%d data=%.*s\n", Q_GET_HASH(q_ptr), Q_GET_LENGTH(q_ptr), Q_GET_LENGTH(q_ptr), Q_GET_DATA(q_ptr));
 
     // make sure we have room in the pool for a new qstr
@@ -150,7 +209,12 @@ STATIC qstr qstr_add(const byte *q_ptr) {
         if (new_pool_length > MICROPY_QSTR_POOL_MAX_ENTRIES) {
             new_pool_length = MICROPY_QSTR_POOL_MAX_ENTRIES;
         }
+        #if MICROPY_QSTR_HASH_INDEX
+        size_t n_bytes = sizeof(qstr_pool_t) + sizeof(const char*) * new_pool_length + sizeof(qstr_slot_t) * 2 * new_pool_length;
+        qstr_pool_t *pool = m_malloc_maybe(n_bytes, true);
+        #else
         qstr_pool_t *pool = m_new_ll_obj_var_maybe(qstr_pool_t, const char*, new_pool_length);
+        #endif
         if (pool == NULL) {
             QSTR_EXIT();
             m_malloc_fail(new_pool_length);
@@ -159,25 +223,81 @@ STATIC qstr qstr_add(const byte *q_ptr) {
         pool->total_prev_len = MP_STATE_VM(last_pool)->total_prev_len + MP_STATE_VM(last_pool)->len;
         pool->alloc = new_pool_length;
         pool->len = 0;
+        #if MICROPY_QSTR_HASH_INDEX
+        pool->index = NULL;
+        memset(QSTR_POOL_SLOTS(pool), 0, sizeof(qstr_slot_t) * QSTR_POOL_NUM_SLOTS(pool));
+        #endif
         MP_STATE_VM(last_pool) = pool;
         DEBUG_printf("QSTR: allocate new pool of size %d\n", MP_STATE_VM(last_pool)->alloc);
     }
 
     // add the new qstr
-    MP_STATE_VM(last_pool)->qstrs[MP_STATE_VM(last_pool)->len++] = q_ptr;
+    qstr_pool_t *pool = MP_STATE_VM(last_pool);
+    pool->qstrs[pool->len++] = q_ptr;
+
+    #if MICROPY_QSTR_HASH_INDEX
+    // and record it in the first free slot of the pool's table
+    qstr_slot_t *slots = QSTR_POOL_SLOTS(pool);
+    size_t num_slots = QSTR_POOL_NUM_SLOTS(pool);
+    size_t i = qstr_index_mix(hash) % num_slots;
+    while (slots[i] != 0) {
+        i = (i + 1) % num_slots;
+    }
+    slots[i] = pool->len;
+    #else
+    (void)hash;
+    #endif
 
     // return id for the newly-added qstr
     return MP_STATE_VM(last_pool)->total_prev_len + MP_STATE_VM(last_pool)->len - 1;
 }
 
-qstr qstr_find_strn(const char *str, size_t str_len) {
-    // work out hash of str
-    mp_uint_t str_hash = qstr_compute_hash((const byte*)str, str_len);
+STATIC bool qstr_matches(const byte *q, mp_uint_t str_hash, const char *str, size_t str_len) {
+    return Q_GET_HASH(q) == str_hash && Q_GET_LENGTH(q) == str_len && memcmp(Q_GET_DATA(q), str, str_len) == 0;
+}
+
+// hash is the full (unmasked) hash of str
+STATIC qstr qstr_find_strn_hashed(const char *str, size_t str_len, uint32_t hash) {
+    mp_uint_t str_hash = qstr_mask_hash(hash);
+
+    #if MICROPY_QSTR_HASH_INDEX
+    uint32_t index_hash = qstr_index_mix(hash);
+    bool rom = false;
+    #endif
 
     // search pools for the data
     for (qstr_pool_t *pool = MP_STATE_VM(last_pool); pool != NULL; pool = pool->prev) {
+        #if MICROPY_QSTR_HASH_INDEX
+        if (pool == &CONST_POOL) {
+            // this and all earlier pools are in ROM
+            rom = true;
+        }
+        if (!rom) {
+            const qstr_slot_t *slots = QSTR_POOL_SLOTS(pool);
+            size_t num_slots = QSTR_POOL_NUM_SLOTS(pool);
+            for (size_t i = index_hash % num_slots; slots[i] != 0; i = (i + 1) % num_slots) {
+                if (qstr_matches(pool->qstrs[slots[i] - 1], str_hash, str, str_len)) {
+                    return pool->total_prev_len + slots[i] - 1;
+                }
+            }
+            continue;
+        }
+        if (pool->index != NULL) {
+            const uint16_t *index = pool->index;
+            size_t num_buckets = index[0];
+            size_t num_slots = index[1];
+            if (num_slots != 0) {
+                uint32_t seed = index[2 + index_hash % num_buckets];
+                size_t i = index[2 + num_buckets + qstr_index_mix(qstr_hash_bytes(seed, (const byte*)str, str_len)) % num_slots];
+                if (qstr_matches(pool->qstrs[i], str_hash, str, str_len)) {
+                    return pool->total_prev_len + i;
+                }
+            }
+            continue;
+        }
+        #endif
         for (const byte **q = pool->qstrs, **q_top = pool->qstrs + pool->len; q < q_top; q++) {
-            if (Q_GET_HASH(*q) == str_hash && Q_GET_LENGTH(*q) == str_len && memcmp(Q_GET_DATA(*q), str, str_len) == 0) {
+            if (qstr_matches(*q, str_hash, str, str_len)) {
                 return pool->total_prev_len + (q - pool->qstrs);
             }
         }
@@ -187,6 +307,10 @@ qstr qstr_find_strn(const char *str, size_t str_len) {
     return 0;
 }
 
+qstr qstr_find_strn(const char *str, size_t str_len) {
+    return qstr_find_strn_hashed(str, str_len, qstr_hash_bytes(QSTR_HASH_INIT, (const byte*)str, str_len));
+}
+
 qstr qstr_from_str(const char *str) {
     return qstr_from_strn(str, strlen(str));
 }
@@ -194,7 +318,8 @@ qstr qstr_from_str(const char *str) {
 qstr qstr_from_strn(const char *str, size_t len) {
     assert(len < (1 << (8 * MICROPY_QSTR_BYTES_IN_LEN)));
     QSTR_ENTER();
-    qstr q = qstr_find_strn(str, len);
+    uint32_t hash = qstr_hash_bytes(QSTR_HASH_INIT, (const byte*)str, len);
+    qstr q = qstr_find_strn_hashed(str, len, hash);
     if (q == 0) {
         // qstr does not exist in interned pool so need to add it
 
@@ -239,12 +364,11 @@ qstr qstr_from_strn(const char *str, size_t len) {
         MP_STATE_VM(qstr_last_used) += n_bytes;
 
         // store the interned strings' data
-        mp_uint_t hash = qstr_compute_hash((const byte*)str, len);
-        Q_SET_HASH(q_ptr, hash);
+        Q_SET_HASH(q_ptr, qstr_mask_hash(hash));
         Q_SET_LENGTH(q_ptr, len);
         memcpy(q_ptr + MICROPY_QSTR_BYTES_IN_HASH + MICROPY_QSTR_BYTES_IN_LEN, str, len);
         q_ptr[MICROPY_QSTR_BYTES_IN_HASH + MICROPY_QSTR_BYTES_IN_LEN + len] = '\0';
-        q = qstr_add(q_ptr);
+        q = qstr_add(q_ptr, hash);
     }
     QSTR_EXIT();
     return q;
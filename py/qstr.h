@@ -52,6 +52,10 @@ typedef struct _qstr_pool_t {
     size_t total_prev_len;
     size_t alloc;
     size_t len;
+    #if MICROPY_QSTR_HASH_INDEX
+    // perfect hash index for a ROM pool (or NULL); see qstr_find_strn
+    const uint16_t *index;
+    #endif
     const byte *qstrs[];
 } qstr_pool_t;
 
@@ -47,6 +47,14 @@ STATIC mp_uint_t mp_reader_mem_readbyte(void *data) {
     }
 }
 
+STATIC const byte *mp_reader_mem_readchunk(void *data, size_t *len) {
+    mp_reader_mem_t *reader = (mp_reader_mem_t*)data;
+    const byte *buf = reader->cur;
+    *len = reader->end - buf;
+    reader->cur = reader->end;
+    return buf;
+}
+
 STATIC void mp_reader_mem_close(void *data) {
     mp_reader_mem_t *reader = (mp_reader_mem_t*)data;
     if (reader->free_len > 0) {
@@ -63,6 +71,7 @@ void mp_reader_new_mem(mp_reader_t *reader, const byte *buf, size_t len, size_t
     rm->end = buf + len;
     reader->data = rm;
     reader->readbyte = mp_reader_mem_readbyte;
+    reader->readchunk = mp_reader_mem_readchunk;
     reader->close = mp_reader_mem_close;
 }
 
@@ -77,7 +86,7 @@ typedef struct _mp_reader_posix_t {
     int fd;
     size_t len;
     size_t pos;
-    byte buf[20];
+    byte buf[MICROPY_READER_BUF_SIZE];
 } mp_reader_posix_t;
 
 STATIC mp_uint_t mp_reader_posix_readbyte(void *data) {
@@ -98,6 +107,22 @@ STATIC mp_uint_t mp_reader_posix_readbyte(void *data) {
     return reader->buf[reader->pos++];
 }
 
+STATIC const byte *mp_reader_posix_readchunk(void *data, size_t *len) {
+    mp_reader_posix_t *reader = (mp_reader_posix_t*)data;
+    if (reader->pos >= reader->len) {
+        int n = 0;
+        if (reader->len != 0) {
+            n = read(reader->fd, reader->buf, sizeof(reader->buf));
+        }
+        reader->len = n > 0 ? n : 0;
+        reader->pos = 0;
+    }
+    const byte *buf = reader->buf + reader->pos;
+    *len = reader->len - reader->pos;
+    reader->pos = reader->len;
+    return buf;
+}
+
 STATIC void mp_reader_posix_close(void *data) {
     mp_reader_posix_t *reader = (mp_reader_posix_t*)data;
     if (reader->close_fd) {
@@ -121,6 +146,7 @@ void mp_reader_new_file_from_fd(mp_reader_t *reader, int fd, bool close_fd) {
     rp->pos = 0;
     reader->data = rp;
     reader->readbyte = mp_reader_posix_readbyte;
+    reader->readchunk = mp_reader_posix_readchunk;
     reader->close = mp_reader_posix_close;
 }
 
@@ -33,9 +33,15 @@
 // it can be called again after returning MP_READER_EOF, and in that case must return MP_READER_EOF
 #define MP_READER_EOF ((mp_uint_t)(-1))
 
+// the readchunk function is optional and may be NULL; if given it must return
+// a pointer to the bytes that readbyte would return next, as many as are to
+// hand, and set *len to their number, consuming them
+// it returns *len == 0 only at the end of the stream, and the bytes stay valid
+// until the next call to any function of the reader
 typedef struct _mp_reader_t {
     void *data;
     mp_uint_t (*readbyte)(void *data);
+    const byte *(*readchunk)(void *data, size_t *len);
     void (*close)(void *data);
 } mp_reader_t;
 
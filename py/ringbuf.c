@@ -24,15 +24,35 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "ringbuf.h"
 
+// Orders the accesses to the buffer contents against the update of the index
+// that hands them over to the other side.
+#define RINGBUF_BARRIER() __sync_synchronize()
+
+// Uses the largest power of two that fits in size bytes of buf.
+void ringbuf_init(ringbuf_t *r, uint8_t *buf, size_t size) {
+    uint32_t pow2 = 1;
+    while (pow2 <= size / 2) {
+        pow2 <<= 1;
+    }
+    r->buf = buf;
+    r->size = pow2;
+    r->iget = r->iput = 0;
+}
+
 // Dynamic initialization. This should be accessible from a root pointer.
-// capacity is the number of bytes the ring buffer can hold. The actual
-// size of the buffer is one greater than that, due to how the buffer
-// handles empty and full statuses.
+// capacity is the number of bytes the ring buffer can hold. It's rounded up
+// to a power of two.
 bool ringbuf_alloc(ringbuf_t *r, size_t capacity, bool long_lived) {
-    r->buf = gc_alloc(capacity + 1, false, long_lived);
-    r->size = capacity +  1;
+    uint32_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    r->buf = gc_alloc(size, false, long_lived);
+    r->size = size;
     r->iget = r->iput = 0;
     return r->buf != NULL;
 }
@@ -44,72 +64,141 @@ void ringbuf_free(ringbuf_t *r) {
 }
 
 size_t ringbuf_capacity(ringbuf_t *r) {
-    return r->size - 1;
+    return r->size;
 }
 
 // Returns -1 if buffer is empty, else returns byte fetched.
 int ringbuf_get(ringbuf_t *r) {
-    if (r->iget == r->iput) {
+    uint32_t iget = r->iget;
+    if (iget == r->iput) {
         return -1;
     }
-    uint8_t v = r->buf[r->iget++];
-    if (r->iget >= r->size) {
-        r->iget = 0;
-    }
+    RINGBUF_BARRIER();
+    uint8_t v = r->buf[iget & (r->size - 1)];
+    RINGBUF_BARRIER();
+    r->iget = iget + 1;
     return v;
 }
 
 // Returns -1 if no room in buffer, else returns 0.
 int ringbuf_put(ringbuf_t *r, uint8_t v) {
-    uint32_t iput_new = r->iput + 1;
-    if (iput_new >= r->size) {
-        iput_new = 0;
-    }
-    if (iput_new == r->iget) {
+    uint32_t iput = r->iput;
+    if (iput - r->iget == r->size) {
         return -1;
     }
-    r->buf[r->iput] = v;
-    r->iput = iput_new;
+    RINGBUF_BARRIER();
+    r->buf[iput & (r->size - 1)] = v;
+    RINGBUF_BARRIER();
+    r->iput = iput + 1;
     return 0;
 }
 
 void ringbuf_clear(ringbuf_t *r) {
-    r->iput = r->iget = 0;
+    r->iget = r->iput;
 }
 
 // Number of free slots that can be written.
 size_t ringbuf_num_empty(ringbuf_t *r) {
-    return (r->size + r->iget - r->iput - 1) % r->size;
+    return r->size - (r->iput - r->iget);
 }
 
 // Number of bytes available to read.
 size_t ringbuf_num_filled(ringbuf_t *r) {
-    return (r->size + r->iput - r->iget) % r->size;
+    return r->iput - r->iget;
+}
+
+// Copies n bytes between the ring starting at index i and buf, in at most two
+// pieces for the wrap-around.
+STATIC void ringbuf_copy_out(ringbuf_t *r, uint32_t i, uint8_t *buf, size_t n) {
+    uint32_t start = i & (r->size - 1);
+    size_t first = r->size - start;
+    if (first > n) {
+        first = n;
+    }
+    memcpy(buf, r->buf + start, first);
+    memcpy(buf + first, r->buf, n - first);
 }
 
 // If the ring buffer fills up, not all bytes will be written.
 // Returns how many bytes were successfully written.
 size_t ringbuf_put_n(ringbuf_t* r, uint8_t* buf, size_t bufsize)
 {
-    for(size_t i=0; i < bufsize; i++) {
-        if ( ringbuf_put(r, buf[i]) < 0 ) {
-            // If ringbuf is full, give up and return how many bytes
-            // we wrote so far.
-            return i;
-        }
+    uint32_t iput = r->iput;
+    size_t empty = r->size - (iput - r->iget);
+    if (bufsize > empty) {
+        bufsize = empty;
+    }
+    RINGBUF_BARRIER();
+    uint32_t start = iput & (r->size - 1);
+    size_t first = r->size - start;
+    if (first > bufsize) {
+        first = bufsize;
     }
+    memcpy(r->buf + start, buf, first);
+    memcpy(r->buf, buf + first, bufsize - first);
+    RINGBUF_BARRIER();
+    r->iput = iput + bufsize;
     return bufsize;
 }
 
 // Returns how many bytes were fetched.
 size_t ringbuf_get_n(ringbuf_t* r, uint8_t* buf, size_t bufsize)
 {
-    for(size_t i=0; i < bufsize; i++) {
-        int b = ringbuf_get(r);
-        if (b < 0) {
-            return i;
-        }
-        buf[i] = b;
+    uint32_t iget = r->iget;
+    size_t filled = r->iput - iget;
+    if (bufsize > filled) {
+        bufsize = filled;
     }
+    RINGBUF_BARRIER();
+    ringbuf_copy_out(r, iget, buf, bufsize);
+    RINGBUF_BARRIER();
+    r->iget = iget + bufsize;
     return bufsize;
 }
+
+// Copies up to bufsize bytes, starting offset bytes after the next byte to be
+// read, without removing them from the buffer. Returns how many bytes were copied.
+size_t ringbuf_peek_n(ringbuf_t* r, uint8_t* buf, size_t bufsize, size_t offset)
+{
+    uint32_t iget = r->iget;
+    size_t filled = r->iput - iget;
+    if (offset >= filled) {
+        return 0;
+    }
+    if (bufsize > filled - offset) {
+        bufsize = filled - offset;
+    }
+    RINGBUF_BARRIER();
+    ringbuf_copy_out(r, iget + offset, buf, bufsize);
+    return bufsize;
+}
+
+size_t ringbuf_read_region(ringbuf_t *r, uint8_t **data) {
+    uint32_t iget = r->iget;
+    size_t filled = r->iput - iget;
+    uint32_t start = iget & (r->size - 1);
+    size_t contiguous = r->size - start;
+    RINGBUF_BARRIER();
+    *data = r->buf + start;
+    return filled < contiguous ? filled : contiguous;
+}
+
+void ringbuf_read_commit(ringbuf_t *r, size_t n) {
+    RINGBUF_BARRIER();
+    r->iget += n;
+}
+
+size_t ringbuf_write_region(ringbuf_t *r, uint8_t **data) {
+    uint32_t iput = r->iput;
+    size_t empty = r->size - (iput - r->iget);
+    uint32_t start = iput & (r->size - 1);
+    size_t contiguous = r->size - start;
+    RINGBUF_BARRIER();
+    *data = r->buf + start;
+    return empty < contiguous ? empty : contiguous;
+}
+
+void ringbuf_write_commit(ringbuf_t *r, size_t n) {
+    RINGBUF_BARRIER();
+    r->iput += n;
+}
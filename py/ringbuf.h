@@ -28,31 +28,46 @@
 
 #include "py/gc.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 
+// A single-producer, single-consumer ring buffer. The producer (typically an
+// interrupt handler) only writes iput and the consumer only writes iget, so
+// neither side needs to disable interrupts while the other runs. The indices
+// run freely and are masked by the power-of-two size when used.
 typedef struct _ringbuf_t {
     uint8_t *buf;
-    // Allocated size; capacity is one less. Don't reference this directly.
+    // Allocated size, always a power of two. Don't reference this directly.
     uint32_t size;
-    uint32_t iget;
-    uint32_t iput;
+    volatile uint32_t iget;
+    volatile uint32_t iput;
 } ringbuf_t;
 
-// Note that the capacity of the buffer is N-1!
-
 // Static initialization:
 // byte buf_array[N];
-// ringbuf_t buf = {buf_array, sizeof(buf_array)};
+// ringbuf_t buf;
+// ringbuf_init(&buf, buf_array, sizeof(buf_array));
 
+void ringbuf_init(ringbuf_t *r, uint8_t *buf, size_t size);
 bool ringbuf_alloc(ringbuf_t *r, size_t capacity, bool long_lived);
 void ringbuf_free(ringbuf_t *r);
 size_t ringbuf_capacity(ringbuf_t *r);
 int ringbuf_get(ringbuf_t *r);
 int ringbuf_put(ringbuf_t *r, uint8_t v);
+// Discards everything that has been written. Call it from the consumer.
 void ringbuf_clear(ringbuf_t *r);
 size_t ringbuf_num_empty(ringbuf_t *r);
 size_t ringbuf_num_filled(ringbuf_t *r);
 size_t ringbuf_put_n(ringbuf_t* r, uint8_t* buf, size_t bufsize);
 size_t ringbuf_get_n(ringbuf_t* r, uint8_t* buf, size_t bufsize);
+size_t ringbuf_peek_n(ringbuf_t* r, uint8_t* buf, size_t bufsize, size_t offset);
+
+// Zero-copy access. The region functions return the length of the largest
+// contiguous run that can be read or written in place at *data, and the
+// commit functions then mark n bytes of it as read or written.
+size_t ringbuf_read_region(ringbuf_t *r, uint8_t **data);
+void ringbuf_read_commit(ringbuf_t *r, size_t n);
+size_t ringbuf_write_region(ringbuf_t *r, uint8_t **data);
+void ringbuf_write_commit(ringbuf_t *r, size_t n);
 
 #endif // MICROPY_INCLUDED_PY_RINGBUF_H
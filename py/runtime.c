@@ -70,13 +70,19 @@ void mp_init(void) {
     MP_STATE_VM(mp_pending_exception) = MP_OBJ_NULL;
     #if MICROPY_ENABLE_SCHEDULER
     MP_STATE_VM(sched_state) = MP_SCHED_IDLE;
-    MP_STATE_VM(sched_sp) = 0;
+    MP_STATE_VM(sched_idx) = 0;
+    MP_STATE_VM(sched_len) = 0;
+    MP_STATE_VM(sched_dropped) = 0;
     #endif
 
 #if MICROPY_ENABLE_EMERGENCY_EXCEPTION_BUF
     mp_init_emergency_exception_buf();
 #endif
 
+    #if MICROPY_OPT_FAST_RAISE
+    mp_init_stop_iteration();
+    #endif
+
     #if MICROPY_KBD_EXCEPTION
     // initialise the exception object for raising KeyboardInterrupt
     MP_STATE_VM(mp_kbd_exception).base.type = &mp_type_KeyboardInterrupt;
@@ -97,16 +103,40 @@ void mp_init(void) {
     MICROPY_PORT_INIT_FUNC;
 #endif
 
+    #if MICROPY_TRACK_CODE_STATE
+    MP_STATE_THREAD(current_code_state) = NULL;
+    #endif
+
+    #if MICROPY_OPT_TYPE_ATTR_CACHE
+    memset(MP_STATE_VM(type_attr_cache), 0, sizeof(MP_STATE_VM(type_attr_cache)));
+    MP_STATE_VM(type_attr_cache_version) = 1;
+    #endif
+
+    #if MICROPY_OPT_BOUND_METH_CACHE
+    memset(MP_STATE_VM(bound_meth_cache), 0, sizeof(MP_STATE_VM(bound_meth_cache)));
+    #endif
+
+    #if MICROPY_OPT_GLOBAL_LOOKUP_CACHE
+    memset(MP_STATE_VM(global_lookup_cache), 0, sizeof(MP_STATE_VM(global_lookup_cache)));
+    MP_STATE_VM(global_lookup_version) = 1;
+    #endif
+
     #if MICROPY_ENABLE_COMPILER
     // optimization disabled by default
     MP_STATE_VM(mp_optimise_value) = 0;
     #endif
 
+    #if MICROPY_COMP_CONST_IMPORT
+    MP_STATE_VM(comp_const_modules) = NULL;
+    MP_STATE_VM(comp_const_export) = NULL;
+    #endif
+
     // init global module dict
     mp_obj_dict_init(&MP_STATE_VM(mp_loaded_modules_dict), 3);
 
     // initialise the __main__ module
     mp_obj_dict_init(&MP_STATE_VM(dict_main), 1);
+    MP_STATE_VM(dict_main).map.versioned = 1;
     mp_obj_dict_store(MP_OBJ_FROM_PTR(&MP_STATE_VM(dict_main)), MP_OBJ_NEW_QSTR(MP_QSTR___name__), MP_OBJ_NEW_QSTR(MP_QSTR___main__));
 
     // locals = globals for outer module (see Objects/frameobject.c/PyFrame_New())
@@ -125,6 +155,12 @@ void mp_init(void) {
     MP_STATE_VM(dupterm_arr_obj) = MP_OBJ_NULL;
     #endif
 
+    #if MICROPY_PY_URE && MICROPY_PY_URE_CACHE_SIZE
+    for (size_t i = 0; i < 2 * MICROPY_PY_URE_CACHE_SIZE; ++i) {
+        MP_STATE_VM(ure_cache[i]) = MP_OBJ_NULL;
+    }
+    #endif
+
     #ifdef MICROPY_FSUSERMOUNT
     // zero out the pointers to the user-mounted devices
     memset(MP_STATE_VM(fs_user_mount) + MICROPY_FATFS_NUM_PERSISTENT, 0,
@@ -161,21 +197,36 @@ mp_obj_t mp_load_name(qstr qst) {
     return mp_load_global(qst);
 }
 
-mp_obj_t mp_load_global(qstr qst) {
+#if MICROPY_OPT_GLOBAL_LOOKUP_CACHE
+STATIC mp_global_lookup_cache_entry_t *global_lookup_cache_entry(const mp_map_t *map, qstr qst) {
+    size_t hash = ((uintptr_t)map / sizeof(mp_obj_t)) ^ qst;
+    return &MP_STATE_VM(global_lookup_cache)[hash & (MICROPY_OPT_GLOBAL_LOOKUP_CACHE_SIZE - 1)];
+}
+#endif
+
+mp_obj_t PLACE_IN_ITCM_HOT(mp_load_global)(qstr qst) {
     // logic: search globals, builtins
     DEBUG_OP_printf("load global %s\n", qstr_str(qst));
-    mp_map_elem_t *elem = mp_map_lookup(&mp_globals_get()->map, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
+    mp_map_t *map = &mp_globals_get()->map;
+    #if MICROPY_OPT_GLOBAL_LOOKUP_CACHE
+    mp_global_lookup_cache_entry_t *entry = global_lookup_cache_entry(map, qst);
+    if (entry->map == map && entry->qst == qst
+        && entry->version == MP_STATE_VM(global_lookup_version)) {
+        return entry->elem->value;
+    }
+    #endif
+    mp_map_elem_t *elem = mp_map_lookup(map, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
     if (elem == NULL) {
         #if MICROPY_CAN_OVERRIDE_BUILTINS
         if (MP_STATE_VM(mp_module_builtins_override_dict) != NULL) {
             // lookup in additional dynamic table of builtins first
             elem = mp_map_lookup(&MP_STATE_VM(mp_module_builtins_override_dict)->map, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
-            if (elem != NULL) {
-                return elem->value;
-            }
         }
+        if (elem == NULL)
         #endif
-        elem = mp_map_lookup((mp_map_t*)&mp_module_builtins_globals.map, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
+        {
+            elem = mp_map_lookup((mp_map_t*)&mp_module_builtins_globals.map, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
+        }
         if (elem == NULL) {
             if (MICROPY_ERROR_REPORTING == MICROPY_ERROR_REPORTING_TERSE) {
                 mp_raise_msg(&mp_type_NameError, translate("name not defined"));
@@ -185,6 +236,16 @@ mp_obj_t mp_load_global(qstr qst) {
             }
         }
     }
+    #if MICROPY_OPT_GLOBAL_LOOKUP_CACHE
+    // only module globals are versioned; a dict passed to exec or eval could
+    // gain the name without the cache noticing
+    if (map->versioned) {
+        entry->map = map;
+        entry->elem = elem;
+        entry->qst = qst;
+        entry->version = MP_STATE_VM(global_lookup_version);
+    }
+    #endif
     return elem->value;
 }
 
@@ -610,7 +671,7 @@ mp_obj_t mp_call_function_2(mp_obj_t fun, mp_obj_t arg1, mp_obj_t arg2) {
 }
 
 // args contains, eg: arg0  arg1  key0  value0  key1  value1
-mp_obj_t mp_call_function_n_kw(mp_obj_t fun_in, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+mp_obj_t PLACE_IN_ITCM_HOT(mp_call_function_n_kw)(mp_obj_t fun_in, size_t n_args, size_t n_kw, const mp_obj_t *args) {
     // TODO improve this: fun object can specify its type and we parse here the arguments,
     // passing to the function arrays of fixed and keyword arguments
 
@@ -633,7 +694,7 @@ mp_obj_t mp_call_function_n_kw(mp_obj_t fun_in, size_t n_args, size_t n_kw, cons
 
 // args contains: fun  self/NULL  arg(0)  ...  arg(n_args-2)  arg(n_args-1)  kw_key(0)  kw_val(0)  ... kw_key(n_kw-1)  kw_val(n_kw-1)
 // if n_args==0 and n_kw==0 then there are only fun and self/NULL
-mp_obj_t mp_call_method_n_kw(size_t n_args, size_t n_kw, const mp_obj_t *args) {
+mp_obj_t PLACE_IN_ITCM_HOT(mp_call_method_n_kw)(size_t n_args, size_t n_kw, const mp_obj_t *args) {
     DEBUG_OP_printf("call method (fun=%p, self=%p, n_args=" UINT_FMT ", n_kw=" UINT_FMT ", args=%p)\n", args[0], args[1], n_args, n_kw, args);
     int adjust = (args[1] == MP_OBJ_NULL) ? 0 : 1;
     return mp_call_function_n_kw(args[0], n_args + adjust, n_kw, args + 2 - adjust);
@@ -759,7 +820,11 @@ void PLACE_IN_ITCM(mp_call_prepare_args_n_kw_var)(bool have_self, size_t n_args_
                 // the key must be a qstr, so intern it if it's a string
                 mp_obj_t key = map->table[i].key;
                 if (!MP_OBJ_IS_QSTR(key)) {
+                    #if MICROPY_OPT_KWARGS_NO_INTERN
+                    key = mp_obj_str_find_interned_checked(key);
+                    #else
                     key = mp_obj_str_intern_checked(key);
+                    #endif
                 }
                 args2[args2_len++] = key;
                 args2[args2_len++] = map->table[i].value;
@@ -773,7 +838,8 @@ void PLACE_IN_ITCM(mp_call_prepare_args_n_kw_var)(bool have_self, size_t n_args_
         // get the keys iterable
         mp_obj_t dest[3];
         mp_load_method(kw_dict, MP_QSTR_keys, dest);
-        mp_obj_t iterable = mp_getiter(mp_call_method_n_kw(0, 0, dest), NULL);
+        mp_obj_iter_buf_t iter_buf;
+        mp_obj_t iterable = mp_getiter(mp_call_method_n_kw(0, 0, dest), &iter_buf);
 
         mp_obj_t key;
         while ((key = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
@@ -789,7 +855,11 @@ void PLACE_IN_ITCM(mp_call_prepare_args_n_kw_var)(bool have_self, size_t n_args_
 
             // the key must be a qstr, so intern it if it's a string
             if (!MP_OBJ_IS_QSTR(key)) {
+                #if MICROPY_OPT_KWARGS_NO_INTERN
+                key = mp_obj_str_find_interned_checked(key);
+                #else
                 key = mp_obj_str_intern_checked(key);
+                #endif
             }
 
             // get the value corresponding to the key
@@ -891,7 +961,8 @@ void mp_unpack_ex(mp_obj_t seq_in, size_t num_in, mp_obj_t *items) {
         // items destination array, then the rest to a dynamically created list.  Once the
         // iterable is exhausted, we take from this list for the right part of the items.
         // TODO Improve to waste less memory in the dynamically created list.
-        mp_obj_t iterable = mp_getiter(seq_in, NULL);
+        mp_obj_iter_buf_t iter_buf;
+        mp_obj_t iterable = mp_getiter(seq_in, &iter_buf);
         mp_obj_t item;
         for (seq_len = 0; seq_len < num_left; seq_len++) {
             item = mp_iternext(iterable);
@@ -924,7 +995,7 @@ too_short:
     }
 }
 
-mp_obj_t mp_load_attr(mp_obj_t base, qstr attr) {
+mp_obj_t PLACE_IN_ITCM_HOT(mp_load_attr)(mp_obj_t base, qstr attr) {
     DEBUG_OP_printf("load attr %p.%s\n", base, qstr_str(attr));
     // use load_method
     mp_obj_t dest[2];
@@ -1051,7 +1122,7 @@ void mp_convert_member_lookup(mp_obj_t self, const mp_obj_type_t *type, mp_obj_t
 // no attribute found, returns:     dest[0] == MP_OBJ_NULL, dest[1] == MP_OBJ_NULL
 // normal attribute found, returns: dest[0] == <attribute>, dest[1] == MP_OBJ_NULL
 // method attribute found, returns: dest[0] == <method>,    dest[1] == <self>
-void mp_load_method_maybe(mp_obj_t obj, qstr attr, mp_obj_t *dest) {
+void PLACE_IN_ITCM_HOT(mp_load_method_maybe)(mp_obj_t obj, qstr attr, mp_obj_t *dest) {
     // clear output to indicate no attribute/method found yet
     dest[0] = MP_OBJ_NULL;
     dest[1] = MP_OBJ_NULL;
@@ -1087,7 +1158,7 @@ void mp_load_method_maybe(mp_obj_t obj, qstr attr, mp_obj_t *dest) {
     }
 }
 
-void mp_load_method(mp_obj_t base, qstr attr, mp_obj_t *dest) {
+void PLACE_IN_ITCM_HOT(mp_load_method)(mp_obj_t base, qstr attr, mp_obj_t *dest) {
     DEBUG_OP_printf("load method %p.%s\n", base, qstr_str(attr));
 
     mp_load_method_maybe(base, attr, dest);
@@ -1177,7 +1248,7 @@ void mp_store_attr(mp_obj_t base, qstr attr, mp_obj_t value) {
     }
 }
 
-mp_obj_t mp_getiter(mp_obj_t o_in, mp_obj_iter_buf_t *iter_buf) {
+mp_obj_t PLACE_IN_ITCM_HOT(mp_getiter)(mp_obj_t o_in, mp_obj_iter_buf_t *iter_buf) {
     assert(o_in);
     mp_obj_type_t *type = mp_obj_get_type(o_in);
 
@@ -1243,7 +1314,7 @@ mp_obj_t mp_iternext_allow_raise(mp_obj_t o_in) {
 
 // will always return MP_OBJ_STOP_ITERATION instead of raising StopIteration() (or any subclass thereof)
 // may raise other exceptions
-mp_obj_t mp_iternext(mp_obj_t o_in) {
+mp_obj_t PLACE_IN_ITCM_HOT(mp_iternext)(mp_obj_t o_in) {
     MP_STACK_CHECK(); // enumerate, filter, map and zip can recursively call mp_iternext
     mp_obj_type_t *type = mp_obj_get_type(o_in);
     if (type->iternext != NULL) {
@@ -1367,6 +1438,11 @@ mp_obj_t mp_make_raise_obj(mp_obj_t o) {
         // create and return a new exception instance by calling o
         // TODO could have an option to disable traceback, then builtin exceptions (eg TypeError)
         // could have const instances in ROM which we return here instead
+        #if MICROPY_OPT_FAST_RAISE
+        if (o == MP_OBJ_FROM_PTR(&mp_type_StopIteration)) {
+            return mp_obj_new_stop_iteration();
+        }
+        #endif
         return mp_call_function_n_kw(o, 0, 0, NULL);
     } else if (mp_obj_is_exception_instance(o)) {
         // o is an instance of an exception, so use it as the exception
@@ -1464,6 +1540,20 @@ void mp_import_all(mp_obj_t module) {
 #if MICROPY_ENABLE_COMPILER
 
 // this is implemented in this file so it can optimise access to locals/globals
+#if MICROPY_COMP_INCREMENTAL
+void mp_call_incremental(mp_obj_t funs) {
+    size_t n;
+    mp_obj_t *items;
+    mp_obj_list_get(funs, &n, &items);
+    for (size_t i = 0; i < n; ++i) {
+        mp_obj_t fun = items[i];
+        // drop the code of each statement once it has run
+        items[i] = mp_const_none;
+        mp_call_function_0(fun);
+    }
+}
+#endif
+
 mp_obj_t mp_parse_compile_execute(mp_lexer_t *lex, mp_parse_input_kind_t parse_input_kind, mp_obj_dict_t *globals, mp_obj_dict_t *locals) {
     // save context
     mp_obj_dict_t *volatile old_globals = mp_globals_get();
@@ -1475,6 +1565,16 @@ mp_obj_t mp_parse_compile_execute(mp_lexer_t *lex, mp_parse_input_kind_t parse_i
 
     nlr_buf_t nlr;
     if (nlr_push(&nlr) == 0) {
+        #if MICROPY_COMP_INCREMENTAL
+        if (parse_input_kind == MP_PARSE_FILE_INPUT && globals != NULL) {
+            mp_call_incremental(mp_compile_incremental(lex, MP_EMIT_OPT_NONE));
+            nlr_pop();
+            mp_globals_set(old_globals);
+            mp_locals_set(old_locals);
+            return mp_const_none;
+        }
+        #endif
+
         qstr source_name = lex->source_name;
         mp_parse_tree_t parse_tree = mp_parse(lex, parse_input_kind);
         mp_obj_t module_fun = mp_compile(&parse_tree, source_name, MP_EMIT_OPT_NONE, false);
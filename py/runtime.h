@@ -72,8 +72,10 @@ void mp_handle_pending_tail(mp_uint_t atomic_state);
 #if MICROPY_ENABLE_SCHEDULER
 void mp_sched_lock(void);
 void mp_sched_unlock(void);
-static inline unsigned int mp_sched_num_pending(void) { return MP_STATE_VM(sched_sp); }
-bool mp_sched_schedule(mp_obj_t function, mp_obj_t arg);
+static inline unsigned int mp_sched_num_pending(void) { return MP_STATE_VM(sched_len); }
+static inline mp_uint_t mp_sched_num_dropped(void) { return MP_STATE_VM(sched_dropped); }
+bool mp_sched_schedule_ex(mp_obj_t function, mp_obj_t arg, unsigned int flags);
+static inline bool mp_sched_schedule(mp_obj_t function, mp_obj_t arg) { return mp_sched_schedule_ex(function, arg, 0); }
 #endif
 
 // extra printing method specifically for mp_obj_t's which are integral type
@@ -185,6 +187,7 @@ mp_uint_t mp_convert_obj_to_native(mp_obj_t obj, mp_uint_t type);
 mp_obj_t mp_convert_native_to_obj(mp_uint_t val, mp_uint_t type);
 mp_obj_t mp_native_call_function_n_kw(mp_obj_t fun_in, size_t n_args_kw, const mp_obj_t *args);
 void mp_native_raise(mp_obj_t o);
+mp_uint_t mp_native_float_binary_op(mp_uint_t op, mp_uint_t lhs, mp_uint_t rhs);
 
 #define mp_sys_path (MP_OBJ_FROM_PTR(&MP_STATE_VM(mp_sys_path_obj)))
 #define mp_sys_argv (MP_OBJ_FROM_PTR(&MP_STATE_VM(mp_sys_argv_obj)))
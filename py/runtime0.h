@@ -43,6 +43,11 @@
 #define MP_NATIVE_TYPE_PTR8 (0x05)
 #define MP_NATIVE_TYPE_PTR16 (0x06)
 #define MP_NATIVE_TYPE_PTR32 (0x07)
+#define MP_NATIVE_TYPE_FLOAT (0x08)
+
+// flags or'd with the op passed to mp_native_float_binary_op
+#define MP_NATIVE_FLOAT_LHS_INT (0x100)
+#define MP_NATIVE_FLOAT_RHS_INT (0x200)
 
 typedef enum {
     // These ops may appear in the bytecode. Changing this group
@@ -193,6 +198,17 @@ typedef enum {
     MP_F_SETUP_CODE_STATE,
     MP_F_SMALL_INT_FLOOR_DIVIDE,
     MP_F_SMALL_INT_MODULO,
+#if MICROPY_EMIT_NATIVE_FLOAT
+    MP_F_FLOAT_BINARY_OP,
+#endif
+#if MICROPY_EMIT_NATIVE_VIPER_INTRINSICS
+    MP_F_MEMCPY,
+    MP_F_MEMMOVE,
+    MP_F_MEMSET,
+    MP_F_NATIVE_BSWAP,
+    MP_F_NATIVE_LOAD_UNALIGNED,
+    MP_F_NATIVE_STORE_UNALIGNED,
+#endif
     MP_F_NUMBER_OF,
 } mp_fun_kind_t;
 
@@ -47,17 +47,26 @@ void mp_handle_pending(void) {
     }
 }
 
+#define IDX_MASK(i) ((i) % MICROPY_SCHEDULER_DEPTH)
+
 // This function should only be called be mp_sched_handle_pending,
 // or by the VM's inlined version of that function.
+// It runs every callback that is pending on entry, so a burst of events is
+// handled in one go. Callbacks that they schedule run at the next check.
 void mp_handle_pending_tail(mp_uint_t atomic_state) {
     MP_STATE_VM(sched_state) = MP_SCHED_LOCKED;
-    if (MP_STATE_VM(sched_sp) > 0) {
-        mp_sched_item_t item = MP_STATE_VM(sched_stack)[--MP_STATE_VM(sched_sp)];
+    for (size_t n = MP_STATE_VM(sched_len); n > 0 && MP_STATE_VM(sched_len) > 0; n--) {
+        mp_sched_item_t *slot = &MP_STATE_VM(sched_queue)[MP_STATE_VM(sched_idx)];
+        mp_sched_item_t item = *slot;
+        // Release the references for the GC.
+        slot->func = slot->arg = MP_OBJ_NULL;
+        MP_STATE_VM(sched_idx) = IDX_MASK(MP_STATE_VM(sched_idx) + 1);
+        --MP_STATE_VM(sched_len);
         MICROPY_END_ATOMIC_SECTION(atomic_state);
         mp_call_function_1_protected(item.func, item.arg);
-    } else {
-        MICROPY_END_ATOMIC_SECTION(atomic_state);
+        atomic_state = MICROPY_BEGIN_ATOMIC_SECTION();
     }
+    MICROPY_END_ATOMIC_SECTION(atomic_state);
     mp_sched_unlock();
 }
 
@@ -84,19 +93,39 @@ void mp_sched_unlock(void) {
     MICROPY_END_ATOMIC_SECTION(atomic_state);
 }
 
-bool mp_sched_schedule(mp_obj_t function, mp_obj_t arg) {
+// Queues function(arg) to be called from the VM. Safe to call from an
+// interrupt handler. Returns false, and counts the callback as dropped, if
+// the queue is full.
+bool mp_sched_schedule_ex(mp_obj_t function, mp_obj_t arg, unsigned int flags) {
     mp_uint_t atomic_state = MICROPY_BEGIN_ATOMIC_SECTION();
-    bool ret;
-    if (MP_STATE_VM(sched_sp) < MICROPY_SCHEDULER_DEPTH) {
+    bool ret = true;
+    if (flags & MP_SCHED_FLAG_COALESCE) {
+        for (size_t i = 0; i < MP_STATE_VM(sched_len); i++) {
+            mp_sched_item_t *item = &MP_STATE_VM(sched_queue)[IDX_MASK(MP_STATE_VM(sched_idx) + i)];
+            if (item->func == function && item->arg == arg) {
+                // already pending
+                MICROPY_END_ATOMIC_SECTION(atomic_state);
+                return true;
+            }
+        }
+    }
+    if (MP_STATE_VM(sched_len) < MICROPY_SCHEDULER_DEPTH) {
         if (MP_STATE_VM(sched_state) == MP_SCHED_IDLE) {
             MP_STATE_VM(sched_state) = MP_SCHED_PENDING;
         }
-        MP_STATE_VM(sched_stack)[MP_STATE_VM(sched_sp)].func = function;
-        MP_STATE_VM(sched_stack)[MP_STATE_VM(sched_sp)].arg = arg;
-        ++MP_STATE_VM(sched_sp);
-        ret = true;
+        uint16_t iput;
+        if (flags & MP_SCHED_FLAG_URGENT) {
+            iput = IDX_MASK(MP_STATE_VM(sched_idx) + MICROPY_SCHEDULER_DEPTH - 1);
+            MP_STATE_VM(sched_idx) = iput;
+        } else {
+            iput = IDX_MASK(MP_STATE_VM(sched_idx) + MP_STATE_VM(sched_len));
+        }
+        MP_STATE_VM(sched_queue)[iput].func = function;
+        MP_STATE_VM(sched_queue)[iput].arg = arg;
+        ++MP_STATE_VM(sched_len);
     } else {
-        // schedule stack is full
+        // schedule queue is full
+        ++MP_STATE_VM(sched_dropped);
         ret = false;
     }
     MICROPY_END_ATOMIC_SECTION(atomic_state);
@@ -345,6 +345,19 @@ const byte *mp_bytecode_print_str(const byte *ip) {
             printf("POP_JUMP_IF_FALSE " UINT_FMT, (mp_uint_t)(ip + unum - mp_showbc_code_start));
             break;
 
+        #if MICROPY_OPT_FUSED_COMPARE_JUMP
+        case MP_BC_COMPARE_POP_JUMP_IF_TRUE:
+        case MP_BC_COMPARE_POP_JUMP_IF_FALSE: {
+            mp_uint_t op = *ip++;
+            DECODE_SLABEL;
+            printf("COMPARE_POP_JUMP_IF_%s %s " UINT_FMT,
+                ip[-4] == MP_BC_COMPARE_POP_JUMP_IF_TRUE ? "TRUE" : "FALSE",
+                qstr_str(mp_binary_op_method_name[op]),
+                (mp_uint_t)(ip + unum - mp_showbc_code_start));
+            break;
+        }
+        #endif
+
         case MP_BC_JUMP_IF_TRUE_OR_POP:
             DECODE_SLABEL;
             printf("JUMP_IF_TRUE_OR_POP " UINT_FMT, (mp_uint_t)(ip + unum - mp_showbc_code_start));
@@ -532,6 +545,12 @@ const byte *mp_bytecode_print_str(const byte *ip) {
             printf("IMPORT_STAR");
             break;
 
+        #if MICROPY_OPT_QUICKEN_SMALL_INT_OPS
+        case MP_BC_LOAD_SUBSCR_SMALL_INT:
+            printf("LOAD_SUBSCR_SMALL_INT");
+            break;
+        #endif
+
         default:
             if (ip[-1] < MP_BC_LOAD_CONST_SMALL_INT_MULTI + 64) {
                 printf("LOAD_CONST_SMALL_INT " INT_FMT, (mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - 16);
@@ -544,6 +563,10 @@ const byte *mp_bytecode_print_str(const byte *ip) {
             } else if (ip[-1] < MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_NUM_BYTECODE) {
                 mp_uint_t op = ip[-1] - MP_BC_BINARY_OP_MULTI;
                 printf("BINARY_OP " UINT_FMT " %s", op, qstr_str(mp_binary_op_method_name[op]));
+            #if MICROPY_OPT_QUICKEN_SMALL_INT_OPS
+            } else if (ip[-1] <= MP_BC_BINARY_OP_SMALL_INT_SUBTRACT) {
+                printf("BINARY_OP_SMALL_INT 0x%02x", ip[-1]);
+            #endif
             } else {
                 printf("code %p, byte code 0x%02x not implemented\n", ip, ip[-1]);
                 assert(0);
@@ -30,8 +30,13 @@
 #include <assert.h>
 
 #include "py/emitglue.h"
+#include "py/objgenerator.h"
+#include "py/objlist.h"
+#include "py/objstr.h"
+#include "py/objtuple.h"
 #include "py/objtype.h"
 #include "py/runtime.h"
+#include "py/smallint.h"
 #include "py/bc0.h"
 #include "py/bc.h"
 
@@ -112,6 +117,75 @@
     exc_sp--; /* pop back to previous exception handler */ \
     CLEAR_SYS_EXC_INFO() /* just clear sys.exc_info(), not compliant, but it shouldn't be used in 1st place */
 
+#if MICROPY_OPT_QUICKEN_SMALL_INT_OPS
+// The generic operator for each of the MP_BC_BINARY_OP_SMALL_INT_xxx opcodes.
+STATIC const byte small_int_binary_op[] = {
+    MP_BINARY_OP_LESS,
+    MP_BINARY_OP_MORE,
+    MP_BINARY_OP_EQUAL,
+    MP_BINARY_OP_INPLACE_ADD,
+    MP_BINARY_OP_INPLACE_SUBTRACT,
+    MP_BINARY_OP_ADD,
+    MP_BINARY_OP_SUBTRACT,
+};
+
+// Rewrite the BINARY_OP_MULTI opcode at ip with its small int form, if it has one.
+STATIC void quicken_binary_op(const byte *ip) {
+    for (size_t i = 0; i < MP_ARRAY_SIZE(small_int_binary_op); i++) {
+        if (*ip - MP_BC_BINARY_OP_MULTI == small_int_binary_op[i]) {
+            *(byte*)ip = MP_BC_BINARY_OP_SMALL_INT_LESS + i;
+            return;
+        }
+    }
+}
+#endif
+
+#if MICROPY_OPT_FAST_FOR_ITER
+// Step the builtin iterators directly, rather than through the type's iternext
+// slot.  Returns MP_OBJ_NULL if obj isn't one of them.
+STATIC inline mp_obj_t fast_iternext(mp_obj_t obj) {
+    if (!MP_OBJ_IS_OBJ(obj)) {
+        return MP_OBJ_NULL;
+    }
+    const mp_obj_type_t *type = ((mp_obj_base_t*)MP_OBJ_TO_PTR(obj))->type;
+    if (type == &mp_type_range_it) {
+        mp_obj_range_it_t *o = MP_OBJ_TO_PTR(obj);
+        if ((o->step > 0 && o->cur < o->stop) || (o->step < 0 && o->cur > o->stop)) {
+            mp_obj_t value = MP_OBJ_NEW_SMALL_INT(o->cur);
+            o->cur += o->step;
+            return value;
+        }
+        return MP_OBJ_STOP_ITERATION;
+    } else if (type == &mp_type_polymorph_iter) {
+        mp_fun_1_t iternext = ((mp_obj_list_it_t*)MP_OBJ_TO_PTR(obj))->iternext;
+        if (iternext == mp_obj_list_it_iternext) {
+            mp_obj_list_it_t *o = MP_OBJ_TO_PTR(obj);
+            mp_obj_list_t *list = MP_OBJ_TO_PTR(o->list);
+            if (o->cur < list->len) {
+                return list->items[o->cur++];
+            }
+            return MP_OBJ_STOP_ITERATION;
+        } else if (iternext == mp_obj_tuple_it_iternext) {
+            mp_obj_tuple_it_t *o = MP_OBJ_TO_PTR(obj);
+            if (o->cur < o->tuple->len) {
+                return o->tuple->items[o->cur++];
+            }
+            return MP_OBJ_STOP_ITERATION;
+        } else if (iternext == mp_obj_bytes_it_iternext) {
+            mp_obj_str8_it_t *o = MP_OBJ_TO_PTR(obj);
+            GET_STR_DATA_LEN(o->str, data, len);
+            if (o->cur < len) {
+                return MP_OBJ_NEW_SMALL_INT(data[o->cur++]);
+            }
+            return MP_OBJ_STOP_ITERATION;
+        }
+    } else if (type == &mp_type_gen_instance) {
+        return mp_obj_gen_resume_and_raise(obj, mp_const_none, MP_OBJ_NULL);
+    }
+    return MP_OBJ_NULL;
+}
+#endif
+
 // fastn has items in reverse order (fastn[0] is local[0], fastn[-1] is local[1], etc)
 // sp points to bottom of stack which grows up
 // returns:
@@ -338,7 +412,27 @@ dispatch_loop:
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
                     mp_obj_t top = TOP();
-                    if (mp_obj_is_instance_type(mp_obj_get_type(top))) {
+                    mp_obj_type_t *type = mp_obj_get_type(top);
+                    #if MICROPY_PY_ATTRTUPLE || MICROPY_PY_COLLECTIONS
+                    // namedtuple fields: cache the index of the field
+                    const qstr *fields = mp_obj_attrtuple_get_fields(type, top);
+                    if (fields != NULL) {
+                        mp_obj_tuple_t *self = MP_OBJ_TO_PTR(top);
+                        mp_uint_t x = *ip;
+                        if (!(x < self->len && fields[x] == qst)) {
+                            for (x = 0; x < self->len && fields[x] != qst; x++) {
+                            }
+                            if (x == self->len || x > 255) {
+                                goto load_attr_cache_fail;
+                            }
+                            *(byte*)ip = x;
+                        }
+                        SET_TOP(self->items[x]);
+                        ip++;
+                        DISPATCH();
+                    }
+                    #endif
+                    if (mp_obj_is_instance_type(type)) {
                         mp_obj_instance_t *self = MP_OBJ_TO_PTR(top);
                         mp_uint_t x = *ip;
                         mp_obj_t key = MP_OBJ_NEW_QSTR(qst);
@@ -353,6 +447,12 @@ dispatch_loop:
                                 goto load_attr_cache_fail;
                             }
                         }
+                        #if MICROPY_PY_SLOTS
+                        if (elem->value == MP_OBJ_NULL) {
+                            // unassigned slot
+                            goto load_attr_cache_fail;
+                        }
+                        #endif
                         SET_TOP(elem->value);
                         ip++;
                         DISPATCH();
@@ -388,10 +488,48 @@ dispatch_loop:
                 ENTRY(MP_BC_LOAD_SUBSCR): {
                     MARK_EXC_IP_SELECTIVE();
                     mp_obj_t index = POP();
+                    #if MICROPY_OPT_QUICKEN_SMALL_INT_OPS
+                    if (MP_OBJ_IS_SMALL_INT(index)
+                        && (MP_OBJ_IS_TYPE(TOP(), &mp_type_list) || MP_OBJ_IS_TYPE(TOP(), &mp_type_tuple))) {
+                        *(byte*)(ip - 1) = MP_BC_LOAD_SUBSCR_SMALL_INT;
+                    }
+                    #endif
                     SET_TOP(mp_obj_subscr(TOP(), index, MP_OBJ_SENTINEL));
                     DISPATCH();
                 }
 
+                #if MICROPY_OPT_QUICKEN_SMALL_INT_OPS
+                ENTRY(MP_BC_LOAD_SUBSCR_SMALL_INT): {
+                    MARK_EXC_IP_SELECTIVE();
+                    mp_obj_t index = POP();
+                    mp_obj_t base = TOP();
+                    if (MP_OBJ_IS_SMALL_INT(index)) {
+                        size_t len = 0;
+                        mp_obj_t *items = NULL;
+                        if (MP_OBJ_IS_TYPE(base, &mp_type_list)) {
+                            mp_obj_list_t *list = MP_OBJ_TO_PTR(base);
+                            len = list->len;
+                            items = list->items;
+                        } else if (MP_OBJ_IS_TYPE(base, &mp_type_tuple)) {
+                            mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(base);
+                            len = tuple->len;
+                            items = tuple->items;
+                        }
+                        mp_int_t i = MP_OBJ_SMALL_INT_VALUE(index);
+                        if (i < 0) {
+                            i += len;
+                        }
+                        if ((mp_uint_t)i < len) {
+                            SET_TOP(items[i]);
+                            DISPATCH();
+                        }
+                    }
+                    // not a list or tuple, or out of range so let it raise
+                    SET_TOP(mp_obj_subscr(base, index, MP_OBJ_SENTINEL));
+                    DISPATCH();
+                }
+                #endif
+
                 ENTRY(MP_BC_STORE_FAST_N): {
                     DECODE_UINT;
                     fastn[-unum] = POP();
@@ -451,6 +589,12 @@ dispatch_loop:
                                 goto store_attr_cache_fail;
                             }
                         }
+                        #if MICROPY_PY_SLOTS
+                        if (elem->value == MP_OBJ_NULL) {
+                            // first store to a slot goes through __setattr__
+                            goto store_attr_cache_fail;
+                        }
+                        #endif
                         elem->value = sp[-1];
                         sp -= 2;
                         ip++;
@@ -557,6 +701,37 @@ dispatch_loop:
                     DISPATCH_WITH_PEND_EXC_CHECK();
                 }
 
+                #if MICROPY_OPT_FUSED_COMPARE_JUMP
+                ENTRY(MP_BC_COMPARE_POP_JUMP_IF_TRUE):
+                ENTRY(MP_BC_COMPARE_POP_JUMP_IF_FALSE): {
+                    MARK_EXC_IP_SELECTIVE();
+                    bool jump_if = ip[-1] == MP_BC_COMPARE_POP_JUMP_IF_TRUE;
+                    mp_binary_op_t op = *ip++;
+                    DECODE_SLABEL;
+                    mp_obj_t rhs = POP();
+                    mp_obj_t lhs = POP();
+                    bool res;
+                    if (MP_OBJ_IS_SMALL_INT(lhs) && MP_OBJ_IS_SMALL_INT(rhs)) {
+                        mp_int_t lhs_val = MP_OBJ_SMALL_INT_VALUE(lhs);
+                        mp_int_t rhs_val = MP_OBJ_SMALL_INT_VALUE(rhs);
+                        switch (op) {
+                            case MP_BINARY_OP_LESS: res = lhs_val < rhs_val; break;
+                            case MP_BINARY_OP_MORE: res = lhs_val > rhs_val; break;
+                            case MP_BINARY_OP_EQUAL: res = lhs_val == rhs_val; break;
+                            case MP_BINARY_OP_LESS_EQUAL: res = lhs_val <= rhs_val; break;
+                            case MP_BINARY_OP_MORE_EQUAL: res = lhs_val >= rhs_val; break;
+                            default: res = lhs_val != rhs_val; break;
+                        }
+                    } else {
+                        res = mp_obj_is_true(mp_binary_op(op, lhs, rhs));
+                    }
+                    if (res == jump_if) {
+                        ip += slab;
+                    }
+                    DISPATCH_WITH_PEND_EXC_CHECK();
+                }
+                #endif
+
                 ENTRY(MP_BC_JUMP_IF_TRUE_OR_POP): {
                     DECODE_SLABEL;
                     if (mp_obj_is_true(TOP())) {
@@ -753,7 +928,14 @@ unwind_jump:;
                     } else {
                         obj = MP_OBJ_FROM_PTR(&sp[-MP_OBJ_ITER_BUF_NSLOTS + 1]);
                     }
+                    #if MICROPY_OPT_FAST_FOR_ITER
+                    mp_obj_t value = fast_iternext(obj);
+                    if (value == MP_OBJ_NULL) {
+                        value = mp_iternext_allow_raise(obj);
+                    }
+                    #else
                     mp_obj_t value = mp_iternext_allow_raise(obj);
+                    #endif
                     if (value == MP_OBJ_STOP_ITERATION) {
                         sp -= MP_OBJ_ITER_BUF_NSLOTS; // pop the exhausted iterator
                         ip += ulab; // jump to after for-block
@@ -1233,6 +1415,57 @@ yield:
                     mp_import_all(POP());
                     DISPATCH();
 
+                #if MICROPY_OPT_QUICKEN_SMALL_INT_OPS
+                #if !MICROPY_OPT_COMPUTED_GOTO
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_MORE):
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_EQUAL):
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_INPLACE_ADD):
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_INPLACE_SUBTRACT):
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_ADD):
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_SUBTRACT):
+                #endif
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT_LESS): {
+                    MARK_EXC_IP_SELECTIVE();
+                    mp_obj_t rhs = POP();
+                    mp_obj_t lhs = TOP();
+                    mp_obj_t res = MP_OBJ_NULL;
+                    if (MP_OBJ_IS_SMALL_INT(lhs) && MP_OBJ_IS_SMALL_INT(rhs)) {
+                        mp_int_t lhs_val = MP_OBJ_SMALL_INT_VALUE(lhs);
+                        mp_int_t rhs_val = MP_OBJ_SMALL_INT_VALUE(rhs);
+                        switch (ip[-1]) {
+                            case MP_BC_BINARY_OP_SMALL_INT_LESS:
+                                res = mp_obj_new_bool(lhs_val < rhs_val);
+                                break;
+                            case MP_BC_BINARY_OP_SMALL_INT_MORE:
+                                res = mp_obj_new_bool(lhs_val > rhs_val);
+                                break;
+                            case MP_BC_BINARY_OP_SMALL_INT_EQUAL:
+                                res = mp_obj_new_bool(lhs_val == rhs_val);
+                                break;
+                            case MP_BC_BINARY_OP_SMALL_INT_INPLACE_ADD:
+                            case MP_BC_BINARY_OP_SMALL_INT_ADD:
+                                // can't overflow an mp_int_t, but may not fit a small int
+                                lhs_val += rhs_val;
+                                if (MP_SMALL_INT_FITS(lhs_val)) {
+                                    res = MP_OBJ_NEW_SMALL_INT(lhs_val);
+                                }
+                                break;
+                            default:
+                                lhs_val -= rhs_val;
+                                if (MP_SMALL_INT_FITS(lhs_val)) {
+                                    res = MP_OBJ_NEW_SMALL_INT(lhs_val);
+                                }
+                                break;
+                        }
+                    }
+                    if (res == MP_OBJ_NULL) {
+                        res = mp_binary_op(small_int_binary_op[ip[-1] - MP_BC_BINARY_OP_SMALL_INT_LESS], lhs, rhs);
+                    }
+                    SET_TOP(res);
+                    DISPATCH();
+                }
+                #endif
+
 #if MICROPY_OPT_COMPUTED_GOTO
                 ENTRY(MP_BC_LOAD_CONST_SMALL_INT_MULTI):
                     PUSH(MP_OBJ_NEW_SMALL_INT((mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - 16));
@@ -1255,7 +1488,13 @@ yield:
                     MARK_EXC_IP_SELECTIVE();
                     mp_obj_t rhs = POP();
                     mp_obj_t lhs = TOP();
-                    SET_TOP(mp_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
+                    mp_binary_op_t op = ip[-1] - MP_BC_BINARY_OP_MULTI;
+                    #if MICROPY_OPT_QUICKEN_SMALL_INT_OPS
+                    if (MP_OBJ_IS_SMALL_INT(lhs) && MP_OBJ_IS_SMALL_INT(rhs)) {
+                        quicken_binary_op(ip - 1);
+                    }
+                    #endif
+                    SET_TOP(mp_binary_op(op, lhs, rhs));
                     DISPATCH();
                 }
 
@@ -1278,7 +1517,13 @@ yield:
                     } else if (ip[-1] < MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_NUM_BYTECODE) {
                         mp_obj_t rhs = POP();
                         mp_obj_t lhs = TOP();
-                        SET_TOP(mp_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
+                        mp_binary_op_t op = ip[-1] - MP_BC_BINARY_OP_MULTI;
+                        #if MICROPY_OPT_QUICKEN_SMALL_INT_OPS
+                        if (MP_OBJ_IS_SMALL_INT(lhs) && MP_OBJ_IS_SMALL_INT(rhs)) {
+                            quicken_binary_op(ip - 1);
+                        }
+                        #endif
+                        SET_TOP(mp_binary_op(op, lhs, rhs));
                         DISPATCH();
                     } else
 #endif
@@ -1383,50 +1628,8 @@ unwind_loop:
             // TODO: don't set traceback for exceptions re-raised by END_FINALLY.
             // But consider how to handle nested exceptions.
             if (nlr.ret_val != &mp_const_GeneratorExit_obj) {
-                const byte *ip = code_state->fun_bc->bytecode;
-                ip = mp_decode_uint_skip(ip); // skip n_state
-                ip = mp_decode_uint_skip(ip); // skip n_exc_stack
-                ip++; // skip scope_params
-                ip++; // skip n_pos_args
-                ip++; // skip n_kwonly_args
-                ip++; // skip n_def_pos_args
-                size_t bc = code_state->ip - ip;
-                size_t code_info_size = mp_decode_uint_value(ip);
-                ip = mp_decode_uint_skip(ip); // skip code_info_size
-                bc -= code_info_size;
-                #if MICROPY_PERSISTENT_CODE
-                qstr block_name = ip[0] | (ip[1] << 8);
-                qstr source_file = ip[2] | (ip[3] << 8);
-                ip += 4;
-                #else
-                qstr block_name = mp_decode_uint_value(ip);
-                ip = mp_decode_uint_skip(ip);
-                qstr source_file = mp_decode_uint_value(ip);
-                ip = mp_decode_uint_skip(ip);
-                #endif
-                size_t source_line = 1;
-                size_t c;
-                while ((c = *ip)) {
-                    size_t b, l;
-                    if ((c & 0x80) == 0) {
-                        // 0b0LLBBBBB encoding
-                        b = c & 0x1f;
-                        l = c >> 5;
-                        ip += 1;
-                    } else {
-                        // 0b1LLLBBBB 0bLLLLLLLL encoding (l's LSB in second byte)
-                        b = c & 0xf;
-                        l = ((c << 4) & 0x700) | ip[1];
-                        ip += 2;
-                    }
-                    if (bc >= b) {
-                        bc -= b;
-                        source_line += l;
-                    } else {
-                        // found source line corresponding to bytecode offset
-                        break;
-                    }
-                }
+                qstr block_name, source_file;
+                size_t source_line = mp_code_state_get_source_line(code_state, &block_name, &source_file);
                 mp_obj_exception_add_traceback(MP_OBJ_FROM_PTR(nlr.ret_val), source_file, source_line, block_name);
             }
 
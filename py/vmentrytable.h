@@ -69,6 +69,10 @@ static const void *const PLACE_IN_DTCM_DATA(entry_table[256]) = {
     [MP_BC_POP_JUMP_IF_FALSE] = &&entry_MP_BC_POP_JUMP_IF_FALSE,
     [MP_BC_JUMP_IF_TRUE_OR_POP] = &&entry_MP_BC_JUMP_IF_TRUE_OR_POP,
     [MP_BC_JUMP_IF_FALSE_OR_POP] = &&entry_MP_BC_JUMP_IF_FALSE_OR_POP,
+    #if MICROPY_OPT_FUSED_COMPARE_JUMP
+    [MP_BC_COMPARE_POP_JUMP_IF_TRUE] = &&entry_MP_BC_COMPARE_POP_JUMP_IF_TRUE,
+    [MP_BC_COMPARE_POP_JUMP_IF_FALSE] = &&entry_MP_BC_COMPARE_POP_JUMP_IF_FALSE,
+    #endif
     [MP_BC_SETUP_WITH] = &&entry_MP_BC_SETUP_WITH,
     [MP_BC_WITH_CLEANUP] = &&entry_MP_BC_WITH_CLEANUP,
     [MP_BC_UNWIND_JUMP] = &&entry_MP_BC_UNWIND_JUMP,
@@ -113,6 +117,10 @@ static const void *const PLACE_IN_DTCM_DATA(entry_table[256]) = {
     [MP_BC_STORE_FAST_MULTI ... MP_BC_STORE_FAST_MULTI + 15] = &&entry_MP_BC_STORE_FAST_MULTI,
     [MP_BC_UNARY_OP_MULTI ... MP_BC_UNARY_OP_MULTI + MP_UNARY_OP_NUM_BYTECODE - 1] = &&entry_MP_BC_UNARY_OP_MULTI,
     [MP_BC_BINARY_OP_MULTI ... MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_NUM_BYTECODE - 1] = &&entry_MP_BC_BINARY_OP_MULTI,
+    #if MICROPY_OPT_QUICKEN_SMALL_INT_OPS
+    [MP_BC_BINARY_OP_SMALL_INT_LESS ... MP_BC_BINARY_OP_SMALL_INT_SUBTRACT] = &&entry_MP_BC_BINARY_OP_SMALL_INT_LESS,
+    [MP_BC_LOAD_SUBSCR_SMALL_INT] = &&entry_MP_BC_LOAD_SUBSCR_SMALL_INT,
+    #endif
 };
 
 #ifdef __clang__
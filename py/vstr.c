@@ -114,6 +114,19 @@ STATIC void vstr_ensure_extra(vstr_t *vstr, size_t size) {
             mp_raise_msg(&mp_type_RuntimeError, NULL);
         }
         size_t new_alloc = ROUND_ALLOC((vstr->len + size) + 16);
+        #if MICROPY_OPT_STR_BUILDER
+        // grow by at least half so that many small appends are amortised O(1),
+        // but settle for the exact size if that much memory can't be found
+        size_t geo_alloc = vstr->alloc + vstr->alloc / 2;
+        if (geo_alloc > new_alloc) {
+            char *new_buf = m_renew_maybe(char, vstr->buf, vstr->alloc, geo_alloc, true);
+            if (new_buf != NULL) {
+                vstr->alloc = geo_alloc;
+                vstr->buf = new_buf;
+                return;
+            }
+        }
+        #endif
         char *new_buf = m_renew(char, vstr->buf, vstr->alloc, new_alloc);
         vstr->alloc = new_alloc;
         vstr->buf = new_buf;
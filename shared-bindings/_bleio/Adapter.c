@@ -215,7 +215,7 @@ STATIC mp_obj_t bleio_adapter_stop_advertising(mp_obj_t self_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(bleio_adapter_stop_advertising_obj, bleio_adapter_stop_advertising);
 
-//|     def start_scan(self, prefixes: sequence = b"", *, buffer_size: int = 512, extended: bool = False, timeout: float = None, interval: float = 0.1, window: float = 0.1, minimum_rssi: int = -80, active: bool = True) -> Any:
+//|     def start_scan(self, prefixes: sequence = b"", *, buffer_size: int = 512, extended: bool = False, timeout: float = None, interval: float = 0.1, window: float = 0.1, minimum_rssi: int = -80, active: bool = True, addresses: sequence = None, duplicate_window: float = 0) -> Any:
 //|         """Starts a BLE scan and returns an iterator of results. Advertisements and scan responses are
 //|         filtered and returned separately.
 //|
@@ -231,12 +231,17 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(bleio_adapter_stop_advertising_obj, bleio_adapt
 //|            window must be <= interval.
 //|         :param int minimum_rssi: the minimum rssi of entries to return.
 //|         :param bool active: retrieve scan responses for scannable advertisements.
+//|         :param sequence addresses: Sequence of `_bleio.Address` objects. If given, only
+//|            advertisements from these addresses are buffered.
+//|         :param float duplicate_window: If greater than zero, an advertisement with the same data as
+//|            the last one buffered from the same address is dropped if it arrives within this many
+//|            seconds. Only the most recent 16 advertisers are remembered.
 //|         :returns: an iterable of `_bleio.ScanEntry` objects
 //|         :rtype: iterable"""
 //|         ...
 //|
 STATIC mp_obj_t bleio_adapter_start_scan(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_prefixes, ARG_buffer_size, ARG_extended, ARG_timeout, ARG_interval, ARG_window, ARG_minimum_rssi, ARG_active };
+    enum { ARG_prefixes, ARG_buffer_size, ARG_extended, ARG_timeout, ARG_interval, ARG_window, ARG_minimum_rssi, ARG_active, ARG_addresses, ARG_duplicate_window };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_prefixes,  MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
         { MP_QSTR_buffer_size,  MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 512} },
@@ -246,6 +251,8 @@ STATIC mp_obj_t bleio_adapter_start_scan(size_t n_args, const mp_obj_t *pos_args
         { MP_QSTR_window,   MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
         { MP_QSTR_minimum_rssi,  MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -80} },
         { MP_QSTR_active,  MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
+        { MP_QSTR_addresses,  MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_duplicate_window,  MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
     };
 
     bleio_adapter_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
@@ -284,7 +291,38 @@ STATIC mp_obj_t bleio_adapter_start_scan(size_t n_args, const mp_obj_t *pos_args
         }
     }
 
-    return common_hal_bleio_adapter_start_scan(self, prefix_bufinfo.buf, prefix_bufinfo.len, args[ARG_extended].u_bool, args[ARG_buffer_size].u_int, timeout, interval, window, args[ARG_minimum_rssi].u_int, args[ARG_active].u_bool);
+    // Flatten the addresses into a heap array of address type followed by address bytes, so that
+    // they can be matched from the BLE event handler.
+    uint8_t *addresses = NULL;
+    size_t address_count = 0;
+    if (args[ARG_addresses].u_obj != mp_const_none) {
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_get_array(args[ARG_addresses].u_obj, &len, &items);
+        addresses = m_new(uint8_t, len * (1 + NUM_BLEIO_ADDRESS_BYTES));
+        for (size_t i = 0; i < len; i++) {
+            if (!MP_OBJ_IS_TYPE(items[i], &bleio_address_type)) {
+                mp_raise_TypeError(translate("Expected an Address"));
+            }
+            bleio_address_obj_t *address = MP_OBJ_TO_PTR(items[i]);
+            uint8_t *entry = addresses + i * (1 + NUM_BLEIO_ADDRESS_BYTES);
+            entry[0] = common_hal_bleio_address_get_type(address);
+            mp_buffer_info_t address_bufinfo;
+            mp_get_buffer_raise(common_hal_bleio_address_get_address_bytes(address), &address_bufinfo, MP_BUFFER_READ);
+            memcpy(entry + 1, address_bufinfo.buf, NUM_BLEIO_ADDRESS_BYTES);
+        }
+        address_count = len;
+    }
+
+    mp_float_t duplicate_window = 0;
+    if (args[ARG_duplicate_window].u_obj != MP_OBJ_NULL) {
+        duplicate_window = mp_obj_get_float(args[ARG_duplicate_window].u_obj);
+        if (duplicate_window < 0) {
+            mp_raise_ValueError_varg(translate("%q must be >= 0"), MP_QSTR_duplicate_window);
+        }
+    }
+
+    return common_hal_bleio_adapter_start_scan(self, prefix_bufinfo.buf, prefix_bufinfo.len, args[ARG_extended].u_bool, args[ARG_buffer_size].u_int, timeout, interval, window, args[ARG_minimum_rssi].u_int, args[ARG_active].u_bool, addresses, address_count, (uint32_t) (duplicate_window * 1000));
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(bleio_adapter_start_scan_obj, 1, bleio_adapter_start_scan);
 
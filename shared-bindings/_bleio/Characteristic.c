@@ -181,7 +181,11 @@ const mp_obj_property_t bleio_characteristic_uuid_obj = {
 };
 
 //|     value: Any = ...
-//|     """The value of this characteristic."""
+//|     """The value of this characteristic.
+//|
+//|     Setting the value of a local characteristic notifies subscribed peers. If a peer can't keep
+//|     up, only its latest value is notified once there is room, so rapid updates are coalesced
+//|     rather than blocking."""
 //|
 STATIC mp_obj_t bleio_characteristic_get_value(mp_obj_t self_in) {
     bleio_characteristic_obj_t *self = MP_OBJ_TO_PTR(self_in);
@@ -250,17 +250,167 @@ const mp_obj_property_t bleio_connection_max_packet_length_obj = {
                (mp_obj_t)&mp_const_none_obj },
 };
 
+//|     def update_parameters(self, *, min_interval: float = None, max_interval: float = None, peripheral_latency: int = None, supervision_timeout: float = None) -> Any:
+//|         """Request new connection parameters from the peer. Parameters that aren't given keep their
+//|         current values. The peer may choose any interval between ``min_interval`` and
+//|         ``max_interval``, or reject the request entirely; read `connection_interval`,
+//|         `peripheral_latency` and `supervision_timeout` to see what was negotiated. Reading them
+//|         waits until the update has completed.
+//|
+//|         :param float min_interval: shortest acceptable connection interval, in milliseconds.
+//|         :param float max_interval: longest acceptable connection interval, in milliseconds.
+//|         :param int peripheral_latency: number of connection events the peripheral may skip when
+//|           it has nothing to send. Higher values save power on the peripheral at the cost of latency.
+//|         :param float supervision_timeout: seconds without traffic before the connection is
+//|           considered lost. Must be longer than ``(1 + peripheral_latency) * max_interval * 2``."""
+//|         ...
+//|
+STATIC mp_obj_t bleio_connection_update_parameters(mp_uint_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_min_interval, ARG_max_interval, ARG_peripheral_latency, ARG_supervision_timeout };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_min_interval, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_max_interval, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_peripheral_latency, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_supervision_timeout, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+
+    bleio_connection_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    bleio_connection_ensure_connected(self);
+
+    mp_float_t interval = common_hal_bleio_connection_get_connection_interval(self->connection);
+    mp_float_t min_interval = args[ARG_min_interval].u_obj == mp_const_none ?
+        interval : mp_obj_get_float(args[ARG_min_interval].u_obj);
+    mp_float_t max_interval = args[ARG_max_interval].u_obj == mp_const_none ?
+        MAX(interval, min_interval) : mp_obj_get_float(args[ARG_max_interval].u_obj);
+    if (min_interval > max_interval) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_min_interval);
+    }
+    mp_int_t latency = args[ARG_peripheral_latency].u_obj == mp_const_none ?
+        common_hal_bleio_connection_get_peripheral_latency(self->connection) :
+        mp_obj_get_int(args[ARG_peripheral_latency].u_obj);
+    mp_float_t supervision_timeout = args[ARG_supervision_timeout].u_obj == mp_const_none ?
+        common_hal_bleio_connection_get_supervision_timeout(self->connection) :
+        mp_obj_get_float(args[ARG_supervision_timeout].u_obj);
+
+    common_hal_bleio_connection_update_parameters(self->connection, min_interval, max_interval,
+        latency, supervision_timeout);
+
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(bleio_connection_update_parameters_obj, 1, bleio_connection_update_parameters);
+
+//|     peripheral_latency: int = ...
+//|     """Number of connection events the peripheral may skip when it has nothing to send.
+//|     Set with `update_parameters`. (read-only)"""
+//|
+STATIC mp_obj_t bleio_connection_get_peripheral_latency(mp_obj_t self_in) {
+    bleio_connection_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    bleio_connection_ensure_connected(self);
+    return mp_obj_new_int(common_hal_bleio_connection_get_peripheral_latency(self->connection));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(bleio_connection_get_peripheral_latency_obj, bleio_connection_get_peripheral_latency);
+
+const mp_obj_property_t bleio_connection_peripheral_latency_obj = {
+    .base.type = &mp_type_property,
+    .proxy = { (mp_obj_t)&bleio_connection_get_peripheral_latency_obj,
+               (mp_obj_t)&mp_const_none_obj,
+               (mp_obj_t)&mp_const_none_obj },
+};
+
+//|     supervision_timeout: float = ...
+//|     """Seconds without traffic before the connection is considered lost.
+//|     Set with `update_parameters`. (read-only)"""
+//|
+STATIC mp_obj_t bleio_connection_get_supervision_timeout(mp_obj_t self_in) {
+    bleio_connection_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    bleio_connection_ensure_connected(self);
+    return mp_obj_new_float(common_hal_bleio_connection_get_supervision_timeout(self->connection));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(bleio_connection_get_supervision_timeout_obj, bleio_connection_get_supervision_timeout);
+
+const mp_obj_property_t bleio_connection_supervision_timeout_obj = {
+    .base.type = &mp_type_property,
+    .proxy = { (mp_obj_t)&bleio_connection_get_supervision_timeout_obj,
+               (mp_obj_t)&mp_const_none_obj,
+               (mp_obj_t)&mp_const_none_obj },
+};
+
+//|     phy: int = ...
+//|     """The radio PHY used to transmit: 1 for LE 1M, 2 for LE 2M or 4 for LE Coded (long range).
+//|     Setting it requests that PHY in both directions; the peer may refuse, so read it back to see
+//|     what was negotiated. Reading waits for a pending change to complete."""
+//|
+STATIC mp_obj_t bleio_connection_get_phy(mp_obj_t self_in) {
+    bleio_connection_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    bleio_connection_ensure_connected(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_bleio_connection_get_phy(self->connection));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(bleio_connection_get_phy_obj, bleio_connection_get_phy);
+
+STATIC mp_obj_t bleio_connection_set_phy(mp_obj_t self_in, mp_obj_t phy_in) {
+    bleio_connection_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    mp_int_t phy = mp_obj_get_int(phy_in);
+    if (phy != 1 && phy != 2 && phy != 4) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_phy);
+    }
+
+    bleio_connection_ensure_connected(self);
+    common_hal_bleio_connection_set_phy(self->connection, phy);
+
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(bleio_connection_set_phy_obj, bleio_connection_set_phy);
+
+const mp_obj_property_t bleio_connection_phy_obj = {
+    .base.type = &mp_type_property,
+    .proxy = { (mp_obj_t)&bleio_connection_get_phy_obj,
+               (mp_obj_t)&bleio_connection_set_phy_obj,
+               (mp_obj_t)&mp_const_none_obj },
+};
+
+//|     data_length: int = ...
+//|     """The largest link layer packet payload, in bytes, that can currently be transmitted. The
+//|     data length is negotiated automatically; larger values let each connection event carry
+//|     more data. (read-only)"""
+//|
+STATIC mp_obj_t bleio_connection_get_data_length(mp_obj_t self_in) {
+    bleio_connection_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    bleio_connection_ensure_connected(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_bleio_connection_get_data_length(self->connection));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(bleio_connection_get_data_length_obj, bleio_connection_get_data_length);
+
+const mp_obj_property_t bleio_connection_data_length_obj = {
+    .base.type = &mp_type_property,
+    .proxy = { (mp_obj_t)&bleio_connection_get_data_length_obj,
+               (mp_obj_t)&mp_const_none_obj,
+               (mp_obj_t)&mp_const_none_obj },
+};
+
 STATIC const mp_rom_map_elem_t bleio_connection_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_pair),                     MP_ROM_PTR(&bleio_connection_pair_obj) },
     { MP_ROM_QSTR(MP_QSTR_disconnect),               MP_ROM_PTR(&bleio_connection_disconnect_obj) },
     { MP_ROM_QSTR(MP_QSTR_discover_remote_services), MP_ROM_PTR(&bleio_connection_discover_remote_services_obj) },
+    { MP_ROM_QSTR(MP_QSTR_update_parameters),        MP_ROM_PTR(&bleio_connection_update_parameters_obj) },
 
     // Properties
     { MP_ROM_QSTR(MP_QSTR_connected),           MP_ROM_PTR(&bleio_connection_connected_obj) },
     { MP_ROM_QSTR(MP_QSTR_paired),              MP_ROM_PTR(&bleio_connection_paired_obj) },
     { MP_ROM_QSTR(MP_QSTR_connection_interval), MP_ROM_PTR(&bleio_connection_connection_interval_obj) },
     { MP_ROM_QSTR(MP_QSTR_max_packet_length),   MP_ROM_PTR(&bleio_connection_max_packet_length_obj) },
+    { MP_ROM_QSTR(MP_QSTR_peripheral_latency),  MP_ROM_PTR(&bleio_connection_peripheral_latency_obj) },
+    { MP_ROM_QSTR(MP_QSTR_supervision_timeout), MP_ROM_PTR(&bleio_connection_supervision_timeout_obj) },
+    { MP_ROM_QSTR(MP_QSTR_phy),                 MP_ROM_PTR(&bleio_connection_phy_obj) },
+    { MP_ROM_QSTR(MP_QSTR_data_length),         MP_ROM_PTR(&bleio_connection_data_length_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(bleio_connection_locals_dict, bleio_connection_locals_dict_table);
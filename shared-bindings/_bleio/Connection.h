@@ -43,6 +43,12 @@ mp_obj_tuple_t *common_hal_bleio_connection_discover_remote_services(bleio_conne
 
 mp_float_t common_hal_bleio_connection_get_connection_interval(bleio_connection_internal_t *self);
 void common_hal_bleio_connection_set_connection_interval(bleio_connection_internal_t *self, mp_float_t new_interval);
+mp_int_t common_hal_bleio_connection_get_peripheral_latency(bleio_connection_internal_t *self);
+mp_float_t common_hal_bleio_connection_get_supervision_timeout(bleio_connection_internal_t *self);
+void common_hal_bleio_connection_update_parameters(bleio_connection_internal_t *self, mp_float_t min_interval, mp_float_t max_interval, mp_int_t latency, mp_float_t supervision_timeout);
+mp_int_t common_hal_bleio_connection_get_phy(bleio_connection_internal_t *self);
+void common_hal_bleio_connection_set_phy(bleio_connection_internal_t *self, mp_int_t phy);
+mp_int_t common_hal_bleio_connection_get_data_length(bleio_connection_internal_t *self);
 
 void bleio_connection_ensure_connected(bleio_connection_obj_t *self);
 
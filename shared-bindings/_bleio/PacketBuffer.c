@@ -226,6 +226,27 @@ const mp_obj_property_t bleio_packet_buffer_outgoing_packet_length_obj = {
                (mp_obj_t)&mp_const_none_obj },
 };
 
+//|     statistics: tuple = ...
+//|     """A tuple of running totals since the buffer was created:
+//|     ``(packets_sent, bytes_sent, packets_received, bytes_received, packets_dropped)``.
+//|     Sample it twice, some time apart, to measure the achieved throughput. ``packets_dropped``
+//|     counts incoming packets discarded because the buffer was full. (read-only)"""
+//|
+STATIC mp_obj_t bleio_packet_buffer_get_statistics(mp_obj_t self_in) {
+    bleio_packet_buffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    return MP_OBJ_FROM_PTR(common_hal_bleio_packet_buffer_get_statistics(self));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(bleio_packet_buffer_get_statistics_obj, bleio_packet_buffer_get_statistics);
+
+const mp_obj_property_t bleio_packet_buffer_statistics_obj = {
+    .base.type = &mp_type_property,
+    .proxy = { (mp_obj_t)&bleio_packet_buffer_get_statistics_obj,
+               (mp_obj_t)&mp_const_none_obj,
+               (mp_obj_t)&mp_const_none_obj },
+};
+
 STATIC const mp_rom_map_elem_t bleio_packet_buffer_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_deinit),                     MP_ROM_PTR(&bleio_packet_buffer_deinit_obj) },
 
@@ -238,6 +259,7 @@ STATIC const mp_rom_map_elem_t bleio_packet_buffer_locals_dict_table[] = {
     { MP_OBJ_NEW_QSTR(MP_QSTR_packet_size),            MP_ROM_PTR(&bleio_packet_buffer_incoming_packet_length_obj) },
     { MP_OBJ_NEW_QSTR(MP_QSTR_incoming_packet_length), MP_ROM_PTR(&bleio_packet_buffer_incoming_packet_length_obj) },
     { MP_OBJ_NEW_QSTR(MP_QSTR_outgoing_packet_length), MP_ROM_PTR(&bleio_packet_buffer_outgoing_packet_length_obj) },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_statistics),             MP_ROM_PTR(&bleio_packet_buffer_statistics_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(bleio_packet_buffer_locals_dict, bleio_packet_buffer_locals_dict_table);
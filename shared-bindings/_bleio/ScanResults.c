@@ -59,10 +59,43 @@ STATIC mp_obj_t scanresults_iternext(mp_obj_t self_in) {
 //|         active. Raises `StopIteration` if scanning is finished and no other results are available."""
 //|         ...
 //|
+//|     def readinto(self, buf: Any) -> Any:
+//|         """Reads as many buffered advertisements as fit into ``buf`` without creating
+//|         `_bleio.ScanEntry` objects. Blocks like `__next__` until at least one is available.
+//|         Each advertisement is stored as one byte of flags (bit 0 connectable, bit 1 scan
+//|         response), the signed RSSI, the address type, six address bytes, one byte of data length
+//|         and then the advertising data. Raises an exception if the next advertisement is longer
+//|         than the given buffer.
+//|
+//|         :return: number of bytes read and stored into ``buf``, 0 once scanning is finished
+//|         :rtype: int"""
+//|         ...
+//|
+STATIC mp_obj_t scanresults_readinto(mp_obj_t self_in, mp_obj_t buffer_obj) {
+    bleio_scanresults_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_obj, &bufinfo, MP_BUFFER_WRITE);
+
+    mp_int_t size = common_hal_bleio_scanresults_readinto(self, bufinfo.buf, bufinfo.len);
+    if (size < 0) {
+        mp_raise_ValueError_varg(translate("Buffer too short by %d bytes"), size * -1);
+    }
+
+    return MP_OBJ_NEW_SMALL_INT(size);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(scanresults_readinto_obj, scanresults_readinto);
+
+STATIC const mp_rom_map_elem_t scanresults_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&scanresults_readinto_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(scanresults_locals_dict, scanresults_locals_dict_table);
 
 const mp_obj_type_t bleio_scanresults_type = {
     { &mp_type_type },
     .name = MP_QSTR_ScanResults,
     .getiter = mp_identity_getiter,
     .iternext = scanresults_iternext,
+    .locals_dict = (mp_obj_dict_t*)&scanresults_locals_dict,
 };
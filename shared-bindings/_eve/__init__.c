@@ -51,13 +51,58 @@ STATIC const mp_obj_type_t _EVE_type;
 #define EVEHAL(s) \
   (&((mp_obj__EVE_t*)mp_instance_cast_to_native_base((s), &_EVE_type))->_eve)
 
+//| def register(self, o: Any) -> None:
+//|     """Send command buffers to ``o.write()``. The buffer passed to ``write``
+//|     is only valid for the duration of the call.
+//|
+//|     :param o: object with a ``write(buf)`` method"""
+//|     ...
+//|
 STATIC mp_obj_t _register(mp_obj_t self, mp_obj_t o) {
-    common_hal__eve_t *eve = EVEHAL(self);
-    mp_load_method(o, MP_QSTR_write, eve->dest);
+    common_hal__eve_register(EVEHAL(self), o);
     return mp_const_none;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(register_obj, _register);
 
+#if CIRCUITPY_BUSIO
+//| def register_spi(self, spi: busio.SPI, cs: digitalio.DigitalInOut, *, baudrate: int = 10000000) -> None:
+//|     """Send command buffers directly to the coprocessor FIFO of an FT81x or
+//|     BT81x over ``spi``, without calling into Python. Writes never exceed the
+//|     free space reported by ``REG_CMDB_SPACE``.
+//|
+//|     :param busio.SPI spi: the bus the EVE is on. It must not be locked when commands are flushed
+//|     :param digitalio.DigitalInOut cs: the EVE chip select
+//|     :param int baudrate: SPI clock rate used for each transfer"""
+//|     ...
+//|
+STATIC mp_obj_t _register_spi(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_self, ARG_spi, ARG_cs, ARG_baudrate };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_self, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_spi, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_cs, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_baudrate, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 10000000} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t spi = args[ARG_spi].u_obj;
+    if (!MP_OBJ_IS_TYPE(spi, &busio_spi_type)) {
+        mp_raise_TypeError_varg(translate("Expected a %q"), busio_spi_type.name);
+    }
+    mp_obj_t cs = args[ARG_cs].u_obj;
+    if (!MP_OBJ_IS_TYPE(cs, &digitalio_digitalinout_type)) {
+        mp_raise_TypeError_varg(translate("Expected a %q"), digitalio_digitalinout_type.name);
+    }
+    if (args[ARG_baudrate].u_int < 1) {
+        mp_raise_ValueError_varg(translate("%q must be >= 1"), MP_QSTR_baudrate);
+    }
+    common_hal__eve_register_spi(EVEHAL(args[ARG_self].u_obj), MP_OBJ_TO_PTR(spi), MP_OBJ_TO_PTR(cs), args[ARG_baudrate].u_int);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(register_spi_obj, 3, _register_spi);
+#endif
+
 //| def flush(self, ) -> Any:
 //|     """Send any queued drawing commands directly to the hardware.
 //|
@@ -1060,6 +1105,9 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(cmd_obj, 4, 4, _cmd);
 
 STATIC const mp_rom_map_elem_t _EVE_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_register), MP_ROM_PTR(&register_obj) },
+    #if CIRCUITPY_BUSIO
+    { MP_ROM_QSTR(MP_QSTR_register_spi), MP_ROM_PTR(&register_spi_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_cc), MP_ROM_PTR(&cc_obj) },
     { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&flush_obj) },
     { MP_ROM_QSTR(MP_QSTR_Vertex2f), MP_ROM_PTR(&vertex2f_obj) },
@@ -1069,12 +1117,25 @@ STATIC const mp_rom_map_elem_t _EVE_locals_dict_table[] = {
 };
 STATIC MP_DEFINE_CONST_DICT(_EVE_locals_dict, _EVE_locals_dict_table);
 
-STATIC mp_obj_t _EVE_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
-    // mp_arg_check_num(n_args, kw_args, 1, 1, false);
+//| def __init__(self, *, buffer_size: int = 2048) -> None:
+//|     """Create a command buffer.
+//|
+//|     :param int buffer_size: size of the command buffer in bytes, rounded up to a multiple of 4"""
+//|     ...
+//|
+STATIC mp_obj_t _EVE_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer_size, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = CIRCUITPY__EVE_BUFFER_SIZE} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    if (args[ARG_buffer_size].u_int < 1) {
+        mp_raise_ValueError_varg(translate("%q must be >= 1"), MP_QSTR_buffer_size);
+    }
     mp_obj__EVE_t *o = m_new_obj(mp_obj__EVE_t);
     o->base.type = &_EVE_type;
-    o->_eve.n = 0;
-    o->_eve.vscale = 16;
+    common_hal__eve_construct(&o->_eve, args[ARG_buffer_size].u_int);
     return MP_OBJ_FROM_PTR(o);
 }
 
@@ -27,6 +27,11 @@
 #ifndef MICROPY_INCLUDED_SHARED_BINDINGS__EVE___INIT___H
 #define MICROPY_INCLUDED_SHARED_BINDINGS__EVE___INIT___H
 
+void common_hal__eve_construct(common_hal__eve_t *eve, size_t buffer_size);
+void common_hal__eve_register(common_hal__eve_t *eve, mp_obj_t o);
+#if CIRCUITPY_BUSIO
+void common_hal__eve_register_spi(common_hal__eve_t *eve, busio_spi_obj_t *spi, digitalio_digitalinout_obj_t *cs, uint32_t baudrate);
+#endif
 void common_hal__eve_flush(common_hal__eve_t *eve);
 void common_hal__eve_add(common_hal__eve_t *eve, size_t len, void *buf);
 void common_hal__eve_Vertex2f(common_hal__eve_t *eve, mp_float_t x, mp_float_t y);
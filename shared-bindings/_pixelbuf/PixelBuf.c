@@ -172,7 +172,8 @@ const mp_obj_property_t pixelbuf_pixelbuf_bpp_obj = {
 //|     """Float value between 0 and 1.  Output brightness.
 //|
 //|     When brightness is less than 1.0, a second buffer will be used to store the color values
-//|     before they are adjusted for brightness."""
+//|     before they are adjusted for brightness. The adjustment is made when the pixels are shown, so
+//|     changing brightness is cheap however many pixels there are."""
 //|
 STATIC mp_obj_t pixelbuf_pixelbuf_obj_get_brightness(mp_obj_t self_in) {
     return mp_obj_new_float(common_hal__pixelbuf_pixelbuf_get_brightness(self_in));
@@ -280,7 +281,12 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_2(pixelbuf_pixelbuf_fill_obj, pixelbuf_pixelbuf_f
 //|         The individual (Red, Green, Blue[, White]) values between 0 and 255.  If given an integer, the
 //|         red, green and blue values are packed into the lower three bytes (0xRRGGBB).
 //|         For RGBW byteorders, if given only RGB values either as an int or as a tuple, the white value
-//|         is used instead when the red, green, and blue values are the same."""
+//|         is used instead when the red, green, and blue values are the same.
+//|
+//|         A slice can also be set from a buffer instead of a list or tuple, which is much faster. A
+//|         `bytes`, `bytearray` or ``array.array('B')`` holds ``bpp`` bytes per pixel in (Red, Green,
+//|         Blue[, White]) order. An ``array.array('I')`` holds one integer per pixel, packed as
+//|         0xRRGGBB with any white value in the top byte."""
 //|         ...
 //|
 STATIC mp_obj_t pixelbuf_pixelbuf_subscr(mp_obj_t self_in, mp_obj_t index_in, mp_obj_t value) {
@@ -318,6 +324,23 @@ STATIC mp_obj_t pixelbuf_pixelbuf_subscr(mp_obj_t self_in, mp_obj_t index_in, mp
         } else { // Set
             #if MICROPY_PY_ARRAY_SLICE_ASSIGN
 
+            mp_buffer_info_t bufinfo;
+            if (!(MP_OBJ_IS_TYPE(value, &mp_type_list) || MP_OBJ_IS_TYPE(value, &mp_type_tuple)) &&
+                mp_get_buffer(value, &bufinfo, MP_BUFFER_READ)) {
+                size_t item_size = mp_binary_get_size('@', bufinfo.typecode, NULL);
+                bool packed_ints = item_size == 4 && (bufinfo.typecode == 'I' || bufinfo.typecode == 'L');
+                if (!packed_ints && item_size != 1) {
+                    mp_raise_ValueError(translate("tuple/list required on RHS"));
+                }
+                size_t pixel_size = packed_ints ? 4 : common_hal__pixelbuf_pixelbuf_get_bpp(self_in);
+                if (bufinfo.len != slice_len * pixel_size) {
+                    mp_raise_ValueError_varg(translate("Unmatched number of items on RHS (expected %d, got %d)."),
+                                                       slice_len, bufinfo.len / pixel_size);
+                }
+                common_hal__pixelbuf_pixelbuf_set_pixels_from_buffer(self_in, slice.start, slice.step,
+                                                                     slice_len, bufinfo.buf, packed_ints);
+                return mp_const_none;
+            }
             if (!(MP_OBJ_IS_TYPE(value, &mp_type_list) || MP_OBJ_IS_TYPE(value, &mp_type_tuple))) {
                 mp_raise_ValueError(translate("tuple/list required on RHS"));
             }
@@ -94,7 +94,75 @@ STATIC mp_obj_t stage_render(size_t n_args, const mp_obj_t *args) {
 
     return mp_const_none;
 }
-MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(stage_render_obj, 7, 8, stage_render);
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(stage_render_obj, 7, 9, stage_render);
+
+//| def render_areas(areas: list, layers: list, buffer: bytearray, display: displayio.Display, scale: int, background: int) -> Any:
+//|     """Render and send to the display all the fragments of the screen that
+//|     changed in a frame.
+//|
+//|     Overlapping and nearby areas are merged first, so that every pixel is
+//|     rendered and sent at most once no matter how many sprites moved over it.
+//|
+//|     :param list areas: A list of ``(x0, y0, x1, y1)`` tuples, as for :py:func:`render`.
+//|     :param list layers: A list of the :py:class:`~_stage.Layer` objects.
+//|     :param bytearray buffer: A buffer to use for rendering. When the display
+//|         can send in the background, half is rendered while the other half is sent.
+//|     :param ~displayio.Display display: The display to use.
+//|     :param int scale: How many times should the image be scaled up.
+//|     :param int background: What color to display when nothing is there.
+//|
+//|     Like :py:func:`render`, this is intended for internal use in the
+//|     ``stage`` library."""
+//|
+STATIC mp_obj_t stage_render_areas(size_t n_args, const mp_obj_t *args) {
+    size_t areas_size = 0;
+    mp_obj_t *area_objs;
+    mp_obj_get_array(args[0], &areas_size, &area_objs);
+
+    size_t layers_size = 0;
+    mp_obj_t *layers;
+    mp_obj_get_array(args[1], &layers_size, &layers);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[2], &bufinfo, MP_BUFFER_WRITE);
+    uint16_t *buffer = bufinfo.buf;
+    size_t buffer_size = bufinfo.len / 2; // 16-bit indexing
+
+    mp_obj_t native_display = mp_instance_cast_to_native_base(args[3],
+        &displayio_display_type);
+    if (!MP_OBJ_IS_TYPE(native_display, &displayio_display_type)) {
+        mp_raise_TypeError(translate("argument num/types mismatch"));
+    }
+    displayio_display_obj_t *display = MP_OBJ_TO_PTR(native_display);
+    uint8_t scale = 1;
+    if (n_args > 4) {
+        scale = mp_obj_get_int(args[4]);
+    }
+    uint16_t background = 0;
+    if (n_args > 5) {
+        background = mp_obj_get_int(args[5]);
+    }
+
+    if (areas_size == 0) {
+        return mp_const_none;
+    }
+    displayio_area_t areas[areas_size];
+    for (size_t i = 0; i < areas_size; i++) {
+        mp_obj_t *coords;
+        mp_obj_get_array_fixed_n(area_objs[i], 4, &coords);
+        areas[i].x1 = mp_obj_get_int(coords[0]);
+        areas[i].y1 = mp_obj_get_int(coords[1]);
+        areas[i].x2 = mp_obj_get_int(coords[2]);
+        areas[i].y2 = mp_obj_get_int(coords[3]);
+        areas[i].next = i + 1 < areas_size ? &areas[i + 1] : NULL;
+    }
+
+    render_stage_areas(areas, layers, layers_size, buffer, buffer_size,
+                       display, scale, background);
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(stage_render_areas_obj, 4, 6, stage_render_areas);
 
 
 STATIC const mp_rom_map_elem_t stage_module_globals_table[] = {
@@ -102,6 +170,7 @@ STATIC const mp_rom_map_elem_t stage_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_Layer), MP_ROM_PTR(&mp_type_layer) },
     { MP_ROM_QSTR(MP_QSTR_Text), MP_ROM_PTR(&mp_type_text) },
     { MP_ROM_QSTR(MP_QSTR_render), MP_ROM_PTR(&stage_render_obj) },
+    { MP_ROM_QSTR(MP_QSTR_render_areas), MP_ROM_PTR(&stage_render_areas_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(stage_module_globals, stage_module_globals_table);
@@ -27,6 +27,7 @@
 #include <string.h>
 
 #include "lib/utils/context_manager_helpers.h"
+#include "lib/utils/interrupt_char.h"
 #include "py/binary.h"
 #include "py/mphal.h"
 #include "py/nlr.h"
@@ -35,6 +36,7 @@
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/analogio/AnalogIn.h"
 #include "shared-bindings/util.h"
+#include "supervisor/port.h"
 
 //| class AnalogIn:
 //|     """Read analog voltage levels
@@ -124,6 +126,53 @@ const mp_obj_property_t analogio_analogin_value_obj = {
               (mp_obj_t)&mp_const_none_obj},
 };
 
+//|     def readinto(self, buffer: array.array, sample_rate: int) -> int:
+//|         """Fill ``buffer``, an array of type ``'H'``, with `value` readings taken
+//|         ``sample_rate`` times a second. The readings are scheduled from the start of the
+//|         call, so a late one is followed by readings taken back to back until the schedule
+//|         is met. How high a rate can be kept up depends on the board. Returns the number
+//|         of readings taken, which is less than ``len(buffer)`` only if interrupted with
+//|         ctrl-C."""
+//|         ...
+//|
+STATIC mp_obj_t analogio_analogin_readinto(mp_obj_t self_in, mp_obj_t buffer, mp_obj_t sample_rate_in) {
+    analogio_analogin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_WRITE);
+    if (bufinfo.typecode != 'H') {
+        mp_raise_TypeError(translate("Array must contain halfwords (type 'H')"));
+    }
+    mp_int_t sample_rate = mp_obj_get_int(sample_rate_in);
+    if (sample_rate <= 0) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_sample_rate);
+    }
+
+    uint16_t *samples = bufinfo.buf;
+    size_t len = bufinfo.len / sizeof(uint16_t);
+    // Time is kept in subticks, 32768 per second.
+    uint8_t subticks;
+    uint64_t start = port_get_raw_ticks(&subticks) * 32 + subticks;
+    size_t i;
+    for (i = 0; i < len; i++) {
+        uint64_t due = start + (uint64_t) i * 32768 / sample_rate;
+        while (true) {
+            uint64_t now = port_get_raw_ticks(&subticks) * 32 + subticks;
+            if (now >= due) {
+                break;
+            }
+            RUN_BACKGROUND_TASKS;
+        }
+        if (mp_hal_is_interrupted()) {
+            break;
+        }
+        samples[i] = common_hal_analogio_analogin_get_value(self);
+    }
+    return MP_OBJ_NEW_SMALL_INT(i);
+}
+MP_DEFINE_CONST_FUN_OBJ_3(analogio_analogin_readinto_obj, analogio_analogin_readinto);
+
 //|     reference_voltage: Any = ...
 //|     """The maximum voltage measurable (also known as the reference voltage) as a
 //|     `float` in Volts."""
@@ -153,6 +202,7 @@ STATIC const mp_rom_map_elem_t analogio_analogin_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_deinit),             MP_ROM_PTR(&analogio_analogin_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__),          MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__),           MP_ROM_PTR(&analogio_analogin___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto),           MP_ROM_PTR(&analogio_analogin_readinto_obj)},
     { MP_ROM_QSTR(MP_QSTR_value),              MP_ROM_PTR(&analogio_analogin_value_obj)},
     { MP_ROM_QSTR(MP_QSTR_reference_voltage),  MP_ROM_PTR(&analogio_analogin_reference_voltage_obj)},
 };
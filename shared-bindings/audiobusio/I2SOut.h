@@ -29,6 +29,7 @@
 
 #include "common-hal/audiobusio/I2SOut.h"
 #include "common-hal/microcontroller/Pin.h"
+#include "shared-module/audiocore/__init__.h"
 
 extern const mp_obj_type_t audiobusio_i2sout_type;
 
@@ -44,5 +45,7 @@ bool common_hal_audiobusio_i2sout_get_playing(audiobusio_i2sout_obj_t* self);
 void common_hal_audiobusio_i2sout_pause(audiobusio_i2sout_obj_t* self);
 void common_hal_audiobusio_i2sout_resume(audiobusio_i2sout_obj_t* self);
 bool common_hal_audiobusio_i2sout_get_paused(audiobusio_i2sout_obj_t* self);
+// Adds the stats of the buffers filled since play or the last reset into stats.
+void common_hal_audiobusio_i2sout_get_stats(audiobusio_i2sout_obj_t* self, audiocore_stats_t* stats, bool reset);
 
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOBUSIO_I2SOUT_H
@@ -34,6 +34,7 @@
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/audiobusio/PDMIn.h"
 #include "shared-bindings/util.h"
+#include "shared-module/audiobusio/PDMStream.h"
 #include "supervisor/shared/translate.h"
 
 //| class PDMIn:
@@ -187,6 +188,9 @@ STATIC mp_obj_t audiobusio_pdmin_obj_record(mp_obj_t self_obj, mp_obj_t destinat
         mp_raise_TypeError(translate("destination_length must be an int >= 0"));
     }
     uint32_t length = MP_OBJ_SMALL_INT_VALUE(destination_length);
+    if (common_hal_audiobusio_pdmin_get_streaming(self)) {
+        mp_raise_RuntimeError(translate("PDMIn is streaming"));
+    }
 
     mp_buffer_info_t bufinfo;
     if (MP_OBJ_IS_TYPE(destination, &mp_type_fileio)) {
@@ -210,6 +214,124 @@ STATIC mp_obj_t audiobusio_pdmin_obj_record(mp_obj_t self_obj, mp_obj_t destinat
 }
 MP_DEFINE_CONST_FUN_OBJ_3(audiobusio_pdmin_record_obj, audiobusio_pdmin_obj_record);
 
+//|     def start_stream(self, *, block_length: int = 256, block_count: int = 4) -> None:
+//|         """Starts recording continuously in the background into a ring of ``block_count``
+//|         blocks of ``block_length`` samples each, which are read with `read_block`. Recording
+//|         carries on until `stop_stream` is called, and `record` can't be used meanwhile.
+//|
+//|         :param int block_length: Samples in each block, in the same units as ``destination_length`` of `record`
+//|         :param int block_count: Blocks in the ring, between 3 and 16. One is lent out by `read_block` and one is being recorded, so the rest are how far Python may fall behind.
+//|
+//|         Print the level of the microphone continuously::
+//|
+//|           import audiobusio
+//|           import board
+//|
+//|           mic = audiobusio.PDMIn(board.MICROPHONE_CLOCK, board.MICROPHONE_DATA, bit_depth=16)
+//|           mic.start_stream(block_length=512)
+//|           while True:
+//|               block = mic.read_block()
+//|               if block is not None:
+//|                   print(max(block) - min(block))"""
+//|         ...
+//|
+STATIC mp_obj_t audiobusio_pdmin_obj_start_stream(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_block_length, ARG_block_count };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_block_length, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 256} },
+        { MP_QSTR_block_count,  MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 4} },
+    };
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t block_length = args[ARG_block_length].u_int;
+    if (block_length < 1 || block_length > 0xffff) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_block_length);
+    }
+    mp_int_t block_count = args[ARG_block_count].u_int;
+    if (block_count < AUDIOBUSIO_PDMSTREAM_MIN_BLOCKS || block_count > AUDIOBUSIO_PDMSTREAM_MAX_BLOCKS) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_block_count);
+    }
+    if (common_hal_audiobusio_pdmin_get_streaming(self)) {
+        mp_raise_RuntimeError(translate("PDMIn is streaming"));
+    }
+    common_hal_audiobusio_pdmin_start_stream(self, block_length, block_count);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(audiobusio_pdmin_start_stream_obj, 1, audiobusio_pdmin_obj_start_stream);
+
+//|     def stop_stream(self) -> None:
+//|         """Stops recording started by `start_stream`. Blocks that have been read stay valid."""
+//|         ...
+//|
+STATIC mp_obj_t audiobusio_pdmin_obj_stop_stream(mp_obj_t self_in) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiobusio_pdmin_stop_stream(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmin_stop_stream_obj, audiobusio_pdmin_obj_stop_stream);
+
+//|     def read_block(self) -> Optional[memoryview]:
+//|         """Returns the oldest recorded block that hasn't been read yet, as a memoryview into the
+//|         ring with the same type as `record` fills, or None if the next block isn't finished
+//|         yet. Nothing is copied, so the block is only valid until the next call, when it is
+//|         given back to be recorded into again."""
+//|         ...
+//|
+STATIC mp_obj_t audiobusio_pdmin_obj_read_block(mp_obj_t self_in) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    if (!common_hal_audiobusio_pdmin_get_streaming(self)) {
+        mp_raise_RuntimeError(translate("PDMIn is not streaming"));
+    }
+    uint32_t length;
+    uint8_t *block = common_hal_audiobusio_pdmin_read_block(self, &length);
+    if (block == NULL) {
+        return mp_const_none;
+    }
+    uint8_t bit_depth = common_hal_audiobusio_pdmin_get_bit_depth(self);
+    return mp_obj_new_memoryview(bit_depth == 16 ? 'H' : 'B', length * 8 / bit_depth, block);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmin_read_block_obj, audiobusio_pdmin_obj_read_block);
+
+//|     streaming: bool = ...
+//|     """True while recording started by `start_stream`. (read only)"""
+//|
+STATIC mp_obj_t audiobusio_pdmin_obj_get_streaming(mp_obj_t self_in) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_bool(common_hal_audiobusio_pdmin_get_streaming(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmin_get_streaming_obj, audiobusio_pdmin_obj_get_streaming);
+
+const mp_obj_property_t audiobusio_pdmin_streaming_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audiobusio_pdmin_get_streaming_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     overruns: int = ...
+//|     """How many blocks have been lost since `start_stream`, because every block was full and
+//|     unread or because the background tasks fell behind the microphone. (read only)"""
+//|
+STATIC mp_obj_t audiobusio_pdmin_obj_get_overruns(mp_obj_t self_in) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_audiobusio_pdmin_get_overruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmin_get_overruns_obj, audiobusio_pdmin_obj_get_overruns);
+
+const mp_obj_property_t audiobusio_pdmin_overruns_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audiobusio_pdmin_get_overruns_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
 //|     sample_rate: Any = ...
 //|     """The actual sample_rate of the recording. This may not match the constructed
 //|     sample rate due to internal clock limitations."""
@@ -234,7 +356,12 @@ STATIC const mp_rom_map_elem_t audiobusio_pdmin_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiobusio_pdmin___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_record), MP_ROM_PTR(&audiobusio_pdmin_record_obj) },
-    { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audiobusio_pdmin_sample_rate_obj) }
+    { MP_ROM_QSTR(MP_QSTR_start_stream), MP_ROM_PTR(&audiobusio_pdmin_start_stream_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop_stream), MP_ROM_PTR(&audiobusio_pdmin_stop_stream_obj) },
+    { MP_ROM_QSTR(MP_QSTR_read_block), MP_ROM_PTR(&audiobusio_pdmin_read_block_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audiobusio_pdmin_sample_rate_obj) },
+    { MP_ROM_QSTR(MP_QSTR_streaming), MP_ROM_PTR(&audiobusio_pdmin_streaming_obj) },
+    { MP_ROM_QSTR(MP_QSTR_overruns), MP_ROM_PTR(&audiobusio_pdmin_overruns_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(audiobusio_pdmin_locals_dict, audiobusio_pdmin_locals_dict_table);
 
@@ -42,6 +42,12 @@ uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t* se
     uint16_t* buffer, uint32_t length);
 uint8_t common_hal_audiobusio_pdmin_get_bit_depth(audiobusio_pdmin_obj_t* self);
 uint32_t common_hal_audiobusio_pdmin_get_sample_rate(audiobusio_pdmin_obj_t* self);
+void common_hal_audiobusio_pdmin_start_stream(audiobusio_pdmin_obj_t* self,
+    uint32_t block_length, uint8_t block_count);
+void common_hal_audiobusio_pdmin_stop_stream(audiobusio_pdmin_obj_t* self);
+bool common_hal_audiobusio_pdmin_get_streaming(audiobusio_pdmin_obj_t* self);
+uint8_t* common_hal_audiobusio_pdmin_read_block(audiobusio_pdmin_obj_t* self, uint32_t* length);
+uint32_t common_hal_audiobusio_pdmin_get_overruns(audiobusio_pdmin_obj_t* self);
 // TODO(tannewt): Add record to file
 
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOBUSIO_AUDIOOUT_H
@@ -38,15 +38,20 @@
 //| class RawSample:
 //|     """A raw audio sample buffer in memory"""
 //|
-//|     def __init__(self, buffer: array.array, *, channel_count: int = 1, sample_rate: int = 8000):
+//|     def __init__(self, buffer: array.array, *, channel_count: int = 1, sample_rate: int = 8000, adpcm_block_length: int = 0):
 //|         """Create a RawSample based on the given buffer of signed values. If channel_count is more than
 //|         1 then each channel's samples should alternate. In other words, for a two channel buffer, the
 //|         first sample will be for channel 1, the second sample will be for channel two, the third for
 //|         channel 1 and so on.
 //|
+//|         When adpcm_block_length is given, the buffer instead holds 4 bit IMA ADPCM blocks of that
+//|         many bytes, laid out as in the data chunk of a wave file. They are decoded to 16 bit
+//|         samples as they are played.
+//|
 //|         :param array.array buffer: An `array.array` with samples
 //|         :param int channel_count: The number of channels in the buffer
 //|         :param int sample_rate: The desired playback sample rate
+//|         :param int adpcm_block_length: The length in bytes of each ADPCM block, or 0 for uncompressed samples
 //|
 //|         Simple 8ksps 440 Hz sin wave::
 //|
@@ -71,29 +76,43 @@
 //|         ...
 //|
 STATIC mp_obj_t audioio_rawsample_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_buffer, ARG_channel_count, ARG_sample_rate };
+    enum { ARG_buffer, ARG_channel_count, ARG_sample_rate, ARG_adpcm_block_length };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_buffer, MP_ARG_OBJ | MP_ARG_REQUIRED },
         { MP_QSTR_channel_count, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1 } },
         { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 8000} },
+        { MP_QSTR_adpcm_block_length, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
+    mp_int_t adpcm_block_length = args[ARG_adpcm_block_length].u_int;
+    if (adpcm_block_length != 0) {
+        mp_int_t channel_count = args[ARG_channel_count].u_int;
+        if (channel_count < 1 || channel_count > 2) {
+            mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_channel_count);
+        }
+        if (adpcm_block_length < 4 * channel_count || adpcm_block_length > 0xffff) {
+            mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_adpcm_block_length);
+        }
+    }
+
     audioio_rawsample_obj_t *self = m_new_obj(audioio_rawsample_obj_t);
     self->base.type = &audioio_rawsample_type;
     mp_buffer_info_t bufinfo;
     if (mp_get_buffer(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ)) {
         uint8_t bytes_per_sample = 1;
         bool signed_samples = bufinfo.typecode == 'b' || bufinfo.typecode == 'h';
-        if (bufinfo.typecode == 'h' || bufinfo.typecode == 'H') {
+        if (adpcm_block_length != 0) {
+            // Any buffer of ADPCM blocks will do.
+        } else if (bufinfo.typecode == 'h' || bufinfo.typecode == 'H') {
             bytes_per_sample = 2;
         } else if (bufinfo.typecode != 'b' && bufinfo.typecode != 'B' && bufinfo.typecode != BYTEARRAY_TYPECODE) {
             mp_raise_ValueError(translate("sample_source buffer must be a bytearray or array of type 'h', 'H', 'b' or 'B'"));
         }
         common_hal_audioio_rawsample_construct(self, ((uint8_t*)bufinfo.buf), bufinfo.len,
                                                bytes_per_sample, signed_samples, args[ARG_channel_count].u_int,
-                                               args[ARG_sample_rate].u_int);
+                                               args[ARG_sample_rate].u_int, adpcm_block_length);
     } else {
         mp_raise_TypeError(translate("buffer must be a bytes-like object"));
     }
@@ -164,6 +183,79 @@ const mp_obj_property_t audioio_rawsample_sample_rate_obj = {
               (mp_obj_t)&mp_const_none_obj},
 };
 
+//|     loop_start: int = ...
+//|     """The frame that a loop goes back to, counting frames of all channels together from the
+//|     start of the buffer."""
+//|
+STATIC mp_obj_t audioio_rawsample_obj_get_loop_start(mp_obj_t self_in) {
+    audioio_rawsample_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_audioio_rawsample_get_loop_start(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_rawsample_get_loop_start_obj, audioio_rawsample_obj_get_loop_start);
+
+STATIC mp_obj_t audioio_rawsample_obj_set_loop_start(mp_obj_t self_in, mp_obj_t loop_start_obj) {
+    audioio_rawsample_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_int_t loop_start = mp_obj_get_int(loop_start_obj);
+    uint32_t loop_end = common_hal_audioio_rawsample_get_loop_end(self);
+    if (loop_end == 0) {
+        loop_end = common_hal_audioio_rawsample_get_frame_count(self);
+    }
+    if (loop_start < 0 || (uint32_t) loop_start >= loop_end) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_loop_start);
+    }
+    common_hal_audioio_rawsample_set_loop_start(self, loop_start);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audioio_rawsample_set_loop_start_obj, audioio_rawsample_obj_set_loop_start);
+
+const mp_obj_property_t audioio_rawsample_loop_start_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audioio_rawsample_get_loop_start_obj,
+              (mp_obj_t)&audioio_rawsample_set_loop_start_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     loop_end: int = ...
+//|     """The frame after the last one in the loop, or 0 for no loop. When a play starts with a
+//|     loop set, the sample plays up to loop_end and then repeats from loop_start to loop_end until
+//|     loop_end is set back to 0, after which it plays on to the end of the buffer. This lets the
+//|     sustained part of a note repeat for as long as the note is held.
+//|
+//|     The loop points can be moved while the sample plays and apply from the next time the loop
+//|     comes round. They are rounded down to a multiple of four bytes. A RawSample with a loop
+//|     keeps track of where it is, so play it from one output or voice at a time. Several
+//|     RawSamples can share one buffer without copying it."""
+//|
+STATIC mp_obj_t audioio_rawsample_obj_get_loop_end(mp_obj_t self_in) {
+    audioio_rawsample_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_audioio_rawsample_get_loop_end(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_rawsample_get_loop_end_obj, audioio_rawsample_obj_get_loop_end);
+
+STATIC mp_obj_t audioio_rawsample_obj_set_loop_end(mp_obj_t self_in, mp_obj_t loop_end_obj) {
+    audioio_rawsample_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_int_t loop_end = mp_obj_get_int(loop_end_obj);
+    if (loop_end != 0 &&
+        (loop_end <= (mp_int_t) common_hal_audioio_rawsample_get_loop_start(self) ||
+         (uint32_t) loop_end > common_hal_audioio_rawsample_get_frame_count(self))) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_loop_end);
+    }
+    common_hal_audioio_rawsample_set_loop_end(self, loop_end);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audioio_rawsample_set_loop_end_obj, audioio_rawsample_obj_set_loop_end);
+
+const mp_obj_property_t audioio_rawsample_loop_end_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audioio_rawsample_get_loop_end_obj,
+              (mp_obj_t)&audioio_rawsample_set_loop_end_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
 STATIC const mp_rom_map_elem_t audioio_rawsample_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audioio_rawsample_deinit_obj) },
@@ -172,6 +264,8 @@ STATIC const mp_rom_map_elem_t audioio_rawsample_locals_dict_table[] = {
 
     // Properties
     { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audioio_rawsample_sample_rate_obj) },
+    { MP_ROM_QSTR(MP_QSTR_loop_start), MP_ROM_PTR(&audioio_rawsample_loop_start_obj) },
+    { MP_ROM_QSTR(MP_QSTR_loop_end), MP_ROM_PTR(&audioio_rawsample_loop_end_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(audioio_rawsample_locals_dict, audioio_rawsample_locals_dict_table);
 
@@ -34,7 +34,7 @@ extern const mp_obj_type_t audioio_rawsample_type;
 
 void common_hal_audioio_rawsample_construct(audioio_rawsample_obj_t* self,
     uint8_t* buffer, uint32_t len, uint8_t bytes_per_sample, bool samples_signed,
-    uint8_t channel_count, uint32_t sample_rate);
+    uint8_t channel_count, uint32_t sample_rate, uint16_t adpcm_block_length);
 
 void common_hal_audioio_rawsample_deinit(audioio_rawsample_obj_t* self);
 bool common_hal_audioio_rawsample_deinited(audioio_rawsample_obj_t* self);
@@ -42,5 +42,10 @@ uint32_t common_hal_audioio_rawsample_get_sample_rate(audioio_rawsample_obj_t* s
 uint8_t common_hal_audioio_rawsample_get_bits_per_sample(audioio_rawsample_obj_t* self);
 uint8_t common_hal_audioio_rawsample_get_channel_count(audioio_rawsample_obj_t* self);
 void common_hal_audioio_rawsample_set_sample_rate(audioio_rawsample_obj_t* self, uint32_t sample_rate);
+uint32_t common_hal_audioio_rawsample_get_frame_count(audioio_rawsample_obj_t* self);
+uint32_t common_hal_audioio_rawsample_get_loop_start(audioio_rawsample_obj_t* self);
+void common_hal_audioio_rawsample_set_loop_start(audioio_rawsample_obj_t* self, uint32_t loop_start);
+uint32_t common_hal_audioio_rawsample_get_loop_end(audioio_rawsample_obj_t* self);
+void common_hal_audioio_rawsample_set_loop_end(audioio_rawsample_obj_t* self, uint32_t loop_end);
 
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOIO_RAWSAMPLE_H
@@ -37,14 +37,16 @@
 //|     """Load a wave file for audio playback
 //|
 //|     A .wav file prepped for audio playback. Only mono and stereo files are supported. Samples must
-//|     be 8 bit unsigned or 16 bit signed. If a buffer is provided, it will be used instead of allocating
+//|     be 8 bit unsigned, 16 bit signed or 4 bit IMA ADPCM, which is decoded to 16 bit signed samples as
+//|     it is played. If a buffer is provided, it will be used instead of allocating
 //|     an internal buffer."""
 //|
-//|     def __init__(self, file: typing.BinaryIO, buffer: bytearray):
+//|     def __init__(self, file: typing.BinaryIO, buffer: bytearray, *, read_ahead: int = 2):
 //|         """Load a .wav file for playback with `audioio.AudioOut` or `audiobusio.I2SOut`.
 //|
 //|         :param typing.BinaryIO file: Already opened wave file
-//|         :param bytearray buffer: Optional pre-allocated buffer, that will be split in half and used for double-buffering of the data. If not provided, two 512 byte buffers are allocated internally.
+//|         :param bytearray buffer: Optional pre-allocated buffer, that will be split into ``read_ahead + 2`` blocks. If not provided, 256 byte blocks are allocated internally.
+//|         :param int read_ahead: How many blocks to read from the file ahead of playback, between 0 and 6. Reading ahead happens in the background, so slow filesystem access is less likely to interrupt the audio.
 //|
 //|
 //|         Playing a wave file from flash::
@@ -69,24 +71,36 @@
 //|           print("stopped")"""
 //|         ...
 //|
-STATIC mp_obj_t audioio_wavefile_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
-    mp_arg_check_num(n_args, kw_args, 1, 2, false);
-
-    audioio_wavefile_obj_t *self = m_new_obj(audioio_wavefile_obj_t);
-    self->base.type = &audioio_wavefile_type;
-    if (!MP_OBJ_IS_TYPE(args[0], &mp_type_fileio)) {
+STATIC mp_obj_t audioio_wavefile_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_file, ARG_buffer, ARG_read_ahead };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_file, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_buffer, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_read_ahead, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = CIRCUITPY_AUDIOCORE_WAVEFILE_READ_AHEAD} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if (!MP_OBJ_IS_TYPE(args[ARG_file].u_obj, &mp_type_fileio)) {
         mp_raise_TypeError(translate("file must be a file opened in byte mode"));
     }
+    mp_int_t read_ahead = args[ARG_read_ahead].u_int;
+    if (read_ahead < 0 || read_ahead > AUDIOIO_WAVEFILE_MAX_READ_AHEAD) {
+        mp_raise_ValueError_varg(translate("read_ahead must be between 0 and %d"), AUDIOIO_WAVEFILE_MAX_READ_AHEAD);
+    }
     uint8_t *buffer = NULL;
     size_t buffer_size = 0;
-    if (n_args >= 2) {
+    if (args[ARG_buffer].u_obj != mp_const_none) {
         mp_buffer_info_t bufinfo;
-        mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_WRITE);
+        mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
         buffer = bufinfo.buf;
         buffer_size = bufinfo.len;
     }
-    common_hal_audioio_wavefile_construct(self, MP_OBJ_TO_PTR(args[0]),
-                                          buffer, buffer_size);
+
+    audioio_wavefile_obj_t *self = m_new_obj(audioio_wavefile_obj_t);
+    self->base.type = &audioio_wavefile_type;
+    common_hal_audioio_wavefile_construct(self, MP_OBJ_TO_PTR(args[ARG_file].u_obj),
+                                          buffer, buffer_size, read_ahead);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -185,6 +199,23 @@ const mp_obj_property_t audioio_wavefile_channel_count_obj = {
               (mp_obj_t)&mp_const_none_obj},
 };
 
+//|     underruns: int = ...
+//|     """How many times playback needed a block that hadn't been read ahead yet, so the
+//|     file was read while the output waited. (read only)"""
+//|
+STATIC mp_obj_t audioio_wavefile_obj_get_underruns(mp_obj_t self_in) {
+    audioio_wavefile_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_audioio_wavefile_get_underruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_wavefile_get_underruns_obj, audioio_wavefile_obj_get_underruns);
+
+const mp_obj_property_t audioio_wavefile_underruns_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audioio_wavefile_get_underruns_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
 
 STATIC const mp_rom_map_elem_t audioio_wavefile_locals_dict_table[] = {
     // Methods
@@ -196,6 +227,7 @@ STATIC const mp_rom_map_elem_t audioio_wavefile_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audioio_wavefile_sample_rate_obj) },
     { MP_ROM_QSTR(MP_QSTR_bits_per_sample), MP_ROM_PTR(&audioio_wavefile_bits_per_sample_obj) },
     { MP_ROM_QSTR(MP_QSTR_channel_count), MP_ROM_PTR(&audioio_wavefile_channel_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_underruns), MP_ROM_PTR(&audioio_wavefile_underruns_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(audioio_wavefile_locals_dict, audioio_wavefile_locals_dict_table);
 
@@ -207,6 +239,7 @@ STATIC const audiosample_p_t audioio_wavefile_proto = {
     .reset_buffer = (audiosample_reset_buffer_fun)audioio_wavefile_reset_buffer,
     .get_buffer = (audiosample_get_buffer_fun)audioio_wavefile_get_buffer,
     .get_buffer_structure = (audiosample_get_buffer_structure_fun)audioio_wavefile_get_buffer_structure,
+    .prefetch = (audiosample_prefetch_fun)audioio_wavefile_prefetch,
 };
 
 
@@ -34,14 +34,106 @@
 #include "shared-bindings/audiocore/RawSample.h"
 #include "shared-bindings/audiocore/WaveFile.h"
 //#include "shared-bindings/audiomixer/Mixer.h"
+#include "shared-module/audiocore/__init__.h"
+#include "supervisor/shared/translate.h"
+
+#if CIRCUITPY_AUDIOIO
+#include "shared-bindings/audioio/AudioOut.h"
+#endif
+#if CIRCUITPY_AUDIOBUSIO
+#include "shared-bindings/audiobusio/I2SOut.h"
+#endif
+#if CIRCUITPY_AUDIOPWMIO
+#include "shared-bindings/audiopwmio/PWMAudioOut.h"
+#endif
 
 //| """Support for audio samples"""
 //|
 
+#if CIRCUITPY_AUDIOCORE_STATS
+STATIC const qstr audiocore_stats_fields[] = {
+    MP_QSTR_buffers_filled,
+    MP_QSTR_underruns,
+    MP_QSTR_max_get_buffer_us,
+    MP_QSTR_min_slack_us,
+};
+
+STATIC mp_obj_t ticks_to_us(int64_t ticks) {
+    return mp_obj_new_int((mp_int_t) (ticks * 1000000 / 32768));
+}
+
+STATIC mp_obj_t stats_tuple(const audiocore_stats_t* stats) {
+    mp_obj_t items[4] = {
+        mp_obj_new_int_from_uint(stats->buffers_filled),
+        mp_obj_new_int_from_uint(stats->underruns),
+        ticks_to_us(stats->max_get_buffer_time),
+        mp_const_none,
+    };
+    if (stats->min_slack != INT32_MAX) {
+        items[3] = ticks_to_us(stats->min_slack);
+    }
+    return mp_obj_new_attrtuple(audiocore_stats_fields, MP_ARRAY_SIZE(items), items);
+}
+
+//| def stats(output: Any, *, reset: bool = False) -> tuple:
+//|     """Returns how well ``output`` has kept up with its hardware since it started playing, or
+//|     since the last reset, as a tuple with these fields:
+//|
+//|     * ``buffers_filled``: Number of buffers handed to the hardware.
+//|     * ``underruns``: Number of those that weren't ready before the hardware needed them.
+//|     * ``max_get_buffer_us``: Longest the sample took to produce a buffer, in microseconds.
+//|     * ``min_slack_us``: Least time there was left before the hardware needed a buffer, in
+//|       microseconds, or None if it has never had to wait for one.
+//|
+//|     Times have a resolution of about 30 microseconds. A slack that stays well above zero
+//|     while the code is busy means there is room for more voices in an `audiomixer.Mixer` or a
+//|     shorter ``buffer_size``.
+//|
+//|     :param output: An `audioio.AudioOut`, `audiobusio.I2SOut` or `audiopwmio.PWMAudioOut`
+//|     :param bool reset: Start counting again after reading the stats"""
+//|     ...
+//|
+STATIC mp_obj_t audiocore_stats(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_output, ARG_reset };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_output, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_reset, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    audiocore_stats_t stats;
+    audiocore_stats_clear(&stats);
+    #if CIRCUITPY_AUDIOIO
+    if (MP_OBJ_IS_TYPE(args[ARG_output].u_obj, &audioio_audioout_type)) {
+        common_hal_audioio_audioout_get_stats(MP_OBJ_TO_PTR(args[ARG_output].u_obj), &stats, args[ARG_reset].u_bool);
+        return stats_tuple(&stats);
+    }
+    #endif
+    #if CIRCUITPY_AUDIOBUSIO
+    if (MP_OBJ_IS_TYPE(args[ARG_output].u_obj, &audiobusio_i2sout_type)) {
+        common_hal_audiobusio_i2sout_get_stats(MP_OBJ_TO_PTR(args[ARG_output].u_obj), &stats, args[ARG_reset].u_bool);
+        return stats_tuple(&stats);
+    }
+    #endif
+    #if CIRCUITPY_AUDIOPWMIO
+    if (MP_OBJ_IS_TYPE(args[ARG_output].u_obj, &audiopwmio_pwmaudioout_type)) {
+        common_hal_audiopwmio_pwmaudioout_get_stats(MP_OBJ_TO_PTR(args[ARG_output].u_obj), &stats, args[ARG_reset].u_bool);
+        return stats_tuple(&stats);
+    }
+    #endif
+    mp_raise_TypeError_varg(translate("%q must be an audio output"), MP_QSTR_output);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(audiocore_stats_obj, 1, audiocore_stats);
+#endif
+
 STATIC const mp_rom_map_elem_t audiocore_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_audiocore) },
     { MP_ROM_QSTR(MP_QSTR_RawSample), MP_ROM_PTR(&audioio_rawsample_type) },
     { MP_ROM_QSTR(MP_QSTR_WaveFile), MP_ROM_PTR(&audioio_wavefile_type) },
+    #if CIRCUITPY_AUDIOCORE_STATS
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&audiocore_stats_obj) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(audiocore_module_globals, audiocore_module_globals_table);
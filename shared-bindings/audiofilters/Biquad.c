@@ -0,0 +1,197 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "shared-bindings/audiofilters/Biquad.h"
+
+#include <math.h>
+#include <stdint.h>
+
+#include "lib/utils/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/util.h"
+#include "supervisor/shared/translate.h"
+
+//| class Biquad:
+//|     """Filters another sample with a second order IIR filter
+//|
+//|     Biquads are the building block of equalisers and of low pass, high pass, band pass and
+//|     notch filters. Filtering is done in fixed point as the sample is played, so it needs no
+//|     time from Python."""
+//|
+//|     def __init__(self, sample: Any, coefficients: tuple):
+//|         """Create a Biquad that plays ``sample`` filtered.
+//|
+//|         :param sample: The sample to filter, such as an `audiocore.WaveFile` or an `audiomixer.Mixer`.
+//|           The filtered output has the same sample rate, channels and format.
+//|         :param tuple coefficients: ``(b0, b1, b2, a1, a2)``, normalised so that a0 is 1. Each must be
+//|           between -4 and 4. `audiofilters.lowpass` and the other design functions compute these.
+//|
+//|         Playing a wave file without its low rumble::
+//|
+//|           import audiocore
+//|           import audiofilters
+//|           import audioio
+//|           import board
+//|
+//|           wav = audiocore.WaveFile(open("drums.wav", "rb"))
+//|           filtered = audiofilters.Biquad(wav, audiofilters.highpass(80, wav.sample_rate))
+//|           a = audioio.AudioOut(board.A0)
+//|           a.play(filtered)
+//|           while a.playing:
+//|             pass"""
+//|         ...
+//|
+STATIC void parse_coefficients(mp_obj_t coefficients_in, float coefficients[5]) {
+    mp_obj_t *items;
+    mp_obj_get_array_fixed_n(coefficients_in, 5, &items);
+    for (size_t i = 0; i < 5; i++) {
+        coefficients[i] = mp_obj_get_float(items[i]);
+        if (!(fabsf(coefficients[i]) < 4)) {
+            mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_coefficients);
+        }
+    }
+}
+
+STATIC mp_obj_t audiofilters_biquad_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_sample, ARG_coefficients };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_coefficients, MP_ARG_OBJ | MP_ARG_REQUIRED },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    float coefficients[5];
+    parse_coefficients(args[ARG_coefficients].u_obj, coefficients);
+
+    audiofilters_biquad_obj_t *self = m_new_obj(audiofilters_biquad_obj_t);
+    self->base.type = &audiofilters_biquad_type;
+    common_hal_audiofilters_biquad_construct(self, args[ARG_sample].u_obj, coefficients);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self, ) -> Any:
+//|         """Deinitialises the Biquad and releases its buffers for reuse."""
+//|         ...
+//|
+STATIC mp_obj_t audiofilters_biquad_deinit(mp_obj_t self_in) {
+    audiofilters_biquad_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audiofilters_biquad_deinit(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(audiofilters_biquad_deinit_obj, audiofilters_biquad_deinit);
+
+STATIC void check_for_deinit(audiofilters_biquad_obj_t *self) {
+    if (common_hal_audiofilters_biquad_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+//|     def __enter__(self, ) -> Any:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self, ) -> Any:
+//|         """Automatically deinitializes the Biquad when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+STATIC mp_obj_t audiofilters_biquad_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_audiofilters_biquad_deinit(args[0]);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audiofilters_biquad___exit___obj, 4, 4, audiofilters_biquad_obj___exit__);
+
+//|     coefficients: tuple = ...
+//|     """The filter's ``(b0, b1, b2, a1, a2)``. Setting them takes effect from the next block
+//|     played, so a filter can be swept while it plays."""
+//|
+STATIC mp_obj_t audiofilters_biquad_obj_get_coefficients(mp_obj_t self_in) {
+    audiofilters_biquad_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    float coefficients[5];
+    common_hal_audiofilters_biquad_get_coefficients(self, coefficients);
+    mp_obj_t items[5];
+    for (size_t i = 0; i < 5; i++) {
+        items[i] = mp_obj_new_float(coefficients[i]);
+    }
+    return mp_obj_new_tuple(5, items);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofilters_biquad_get_coefficients_obj, audiofilters_biquad_obj_get_coefficients);
+
+STATIC mp_obj_t audiofilters_biquad_obj_set_coefficients(mp_obj_t self_in, mp_obj_t coefficients_in) {
+    audiofilters_biquad_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    float coefficients[5];
+    parse_coefficients(coefficients_in, coefficients);
+    common_hal_audiofilters_biquad_set_coefficients(self, coefficients);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofilters_biquad_set_coefficients_obj, audiofilters_biquad_obj_set_coefficients);
+
+const mp_obj_property_t audiofilters_biquad_coefficients_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audiofilters_biquad_get_coefficients_obj,
+              (mp_obj_t)&audiofilters_biquad_set_coefficients_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+STATIC const mp_rom_map_elem_t audiofilters_biquad_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiofilters_biquad_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiofilters_biquad___exit___obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_coefficients), MP_ROM_PTR(&audiofilters_biquad_coefficients_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audiofilters_biquad_locals_dict, audiofilters_biquad_locals_dict_table);
+
+STATIC const audiosample_p_t audiofilters_biquad_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .sample_rate = (audiosample_sample_rate_fun)common_hal_audiofilters_biquad_get_sample_rate,
+    .bits_per_sample = (audiosample_bits_per_sample_fun)common_hal_audiofilters_biquad_get_bits_per_sample,
+    .channel_count = (audiosample_channel_count_fun)common_hal_audiofilters_biquad_get_channel_count,
+    .reset_buffer = (audiosample_reset_buffer_fun)audiofilters_biquad_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audiofilters_biquad_get_buffer,
+    .get_buffer_structure = (audiosample_get_buffer_structure_fun)audiofilters_biquad_get_buffer_structure,
+    .prefetch = (audiosample_prefetch_fun)audiofilters_biquad_prefetch,
+    .set_output_signed = (audiosample_set_output_signed_fun)audiofilters_biquad_set_output_signed,
+};
+
+const mp_obj_type_t audiofilters_biquad_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Biquad,
+    .make_new = audiofilters_biquad_make_new,
+    .locals_dict = (mp_obj_dict_t*)&audiofilters_biquad_locals_dict,
+    .protocol = &audiofilters_biquad_proto,
+};
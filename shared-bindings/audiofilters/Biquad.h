@@ -0,0 +1,46 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOFILTERS_BIQUAD_H
+#define MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOFILTERS_BIQUAD_H
+
+#include "shared-module/audiofilters/Biquad.h"
+
+extern const mp_obj_type_t audiofilters_biquad_type;
+
+void common_hal_audiofilters_biquad_construct(audiofilters_biquad_obj_t* self,
+    mp_obj_t sample, const float coefficients[5]);
+void common_hal_audiofilters_biquad_deinit(audiofilters_biquad_obj_t* self);
+bool common_hal_audiofilters_biquad_deinited(audiofilters_biquad_obj_t* self);
+
+void common_hal_audiofilters_biquad_get_coefficients(audiofilters_biquad_obj_t* self, float coefficients[5]);
+void common_hal_audiofilters_biquad_set_coefficients(audiofilters_biquad_obj_t* self, const float coefficients[5]);
+uint32_t common_hal_audiofilters_biquad_get_sample_rate(audiofilters_biquad_obj_t* self);
+uint8_t common_hal_audiofilters_biquad_get_channel_count(audiofilters_biquad_obj_t* self);
+uint8_t common_hal_audiofilters_biquad_get_bits_per_sample(audiofilters_biquad_obj_t* self);
+
+#endif // MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOFILTERS_BIQUAD_H
@@ -0,0 +1,134 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "shared-bindings/audiofilters/FIR.h"
+
+#include <stdint.h>
+
+#include "lib/utils/context_manager_helpers.h"
+#include "py/runtime.h"
+#include "supervisor/shared/translate.h"
+
+//| class FIR:
+//|     """Filters another sample with a finite impulse response filter
+//|
+//|     Each output sample is the sum of the most recent input samples, each weighted by a tap.
+//|     Filtering is done in fixed point as the sample is played, so it needs no time from
+//|     Python."""
+//|
+//|     def __init__(self, sample: Any, taps: Sequence[float]):
+//|         """Create an FIR filter that plays ``sample`` filtered.
+//|
+//|         :param sample: The sample to filter, such as an `audiocore.WaveFile` or an `audiomixer.Mixer`.
+//|           The filtered output has the same sample rate, channels and format.
+//|         :param Sequence[float] taps: The weights, newest sample first. There can be up to 64 and
+//|           each is limited to between -1 and 1."""
+//|         ...
+//|
+STATIC mp_obj_t audiofilters_fir_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_sample, ARG_taps };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_taps, MP_ARG_OBJ | MP_ARG_REQUIRED },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    size_t tap_count;
+    mp_obj_t *items;
+    mp_obj_get_array(args[ARG_taps].u_obj, &tap_count, &items);
+    if (tap_count < 1 || tap_count > AUDIOFILTERS_FIR_MAX_TAPS) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_taps);
+    }
+    float taps[AUDIOFILTERS_FIR_MAX_TAPS];
+    for (size_t i = 0; i < tap_count; i++) {
+        taps[i] = mp_obj_get_float(items[i]);
+    }
+
+    audiofilters_fir_obj_t *self = m_new_obj(audiofilters_fir_obj_t);
+    self->base.type = &audiofilters_fir_type;
+    common_hal_audiofilters_fir_construct(self, args[ARG_sample].u_obj, taps, tap_count);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self, ) -> Any:
+//|         """Deinitialises the FIR and releases its buffers for reuse."""
+//|         ...
+//|
+STATIC mp_obj_t audiofilters_fir_deinit(mp_obj_t self_in) {
+    audiofilters_fir_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audiofilters_fir_deinit(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(audiofilters_fir_deinit_obj, audiofilters_fir_deinit);
+
+//|     def __enter__(self, ) -> Any:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self, ) -> Any:
+//|         """Automatically deinitializes the FIR when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+STATIC mp_obj_t audiofilters_fir_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_audiofilters_fir_deinit(args[0]);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audiofilters_fir___exit___obj, 4, 4, audiofilters_fir_obj___exit__);
+
+STATIC const mp_rom_map_elem_t audiofilters_fir_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiofilters_fir_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiofilters_fir___exit___obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audiofilters_fir_locals_dict, audiofilters_fir_locals_dict_table);
+
+STATIC const audiosample_p_t audiofilters_fir_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .sample_rate = (audiosample_sample_rate_fun)common_hal_audiofilters_fir_get_sample_rate,
+    .bits_per_sample = (audiosample_bits_per_sample_fun)common_hal_audiofilters_fir_get_bits_per_sample,
+    .channel_count = (audiosample_channel_count_fun)common_hal_audiofilters_fir_get_channel_count,
+    .reset_buffer = (audiosample_reset_buffer_fun)audiofilters_fir_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audiofilters_fir_get_buffer,
+    .get_buffer_structure = (audiosample_get_buffer_structure_fun)audiofilters_fir_get_buffer_structure,
+    .prefetch = (audiosample_prefetch_fun)audiofilters_fir_prefetch,
+    .set_output_signed = (audiosample_set_output_signed_fun)audiofilters_fir_set_output_signed,
+};
+
+const mp_obj_type_t audiofilters_fir_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_FIR,
+    .make_new = audiofilters_fir_make_new,
+    .locals_dict = (mp_obj_dict_t*)&audiofilters_fir_locals_dict,
+    .protocol = &audiofilters_fir_proto,
+};
@@ -0,0 +1,44 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOFILTERS_FIR_H
+#define MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOFILTERS_FIR_H
+
+#include "shared-module/audiofilters/FIR.h"
+
+extern const mp_obj_type_t audiofilters_fir_type;
+
+void common_hal_audiofilters_fir_construct(audiofilters_fir_obj_t* self,
+    mp_obj_t sample, const float* taps, uint16_t tap_count);
+void common_hal_audiofilters_fir_deinit(audiofilters_fir_obj_t* self);
+bool common_hal_audiofilters_fir_deinited(audiofilters_fir_obj_t* self);
+
+uint32_t common_hal_audiofilters_fir_get_sample_rate(audiofilters_fir_obj_t* self);
+uint8_t common_hal_audiofilters_fir_get_channel_count(audiofilters_fir_obj_t* self);
+uint8_t common_hal_audiofilters_fir_get_bits_per_sample(audiofilters_fir_obj_t* self);
+
+#endif // MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOFILTERS_FIR_H
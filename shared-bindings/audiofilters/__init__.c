@@ -0,0 +1,135 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <stdint.h>
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/audiofilters/__init__.h"
+#include "shared-bindings/audiofilters/Biquad.h"
+#include "shared-bindings/audiofilters/FIR.h"
+#include "supervisor/shared/translate.h"
+
+//| """Support for filtering audio
+//|
+//| The `audiofilters` module contains filters that wrap another sample and change
+//| its sound as it plays, such as `audiofilters.Biquad` and `audiofilters.FIR`."""
+//|
+
+STATIC mp_obj_t design_biquad(audiofilters_biquad_kind_t kind, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_frequency, ARG_sample_rate, ARG_q };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_frequency, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_REQUIRED },
+        { MP_QSTR_q, MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    float frequency = mp_obj_get_float(args[ARG_frequency].u_obj);
+    mp_int_t sample_rate = args[ARG_sample_rate].u_int;
+    if (sample_rate < 1) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_sample_rate);
+    }
+    if (!(frequency > 0 && frequency < sample_rate / 2.0f)) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_frequency);
+    }
+    // Butterworth by default.
+    float q = 0.70710678f;
+    if (args[ARG_q].u_obj != MP_OBJ_NULL) {
+        q = mp_obj_get_float(args[ARG_q].u_obj);
+    }
+    if (!(q > 0)) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_q);
+    }
+
+    float coefficients[5];
+    audiofilters_design_biquad(kind, frequency, sample_rate, q, coefficients);
+    mp_obj_t items[5];
+    for (size_t i = 0; i < 5; i++) {
+        items[i] = mp_obj_new_float(coefficients[i]);
+    }
+    return mp_obj_new_tuple(5, items);
+}
+
+//| def lowpass(frequency: float, sample_rate: int, q: float = 0.7071) -> tuple:
+//|     """Returns `Biquad` coefficients that pass frequencies below ``frequency``, in Hz, for
+//|     samples at ``sample_rate``. Higher ``q`` gives a sharper knee with a resonant peak."""
+//|     ...
+//|
+STATIC mp_obj_t audiofilters_lowpass(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return design_biquad(AUDIOFILTERS_LOWPASS, n_args, pos_args, kw_args);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(audiofilters_lowpass_obj, 2, audiofilters_lowpass);
+
+//| def highpass(frequency: float, sample_rate: int, q: float = 0.7071) -> tuple:
+//|     """Returns `Biquad` coefficients that pass frequencies above ``frequency``, in Hz. A low
+//|     ``frequency``, such as 20, blocks DC offsets."""
+//|     ...
+//|
+STATIC mp_obj_t audiofilters_highpass(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return design_biquad(AUDIOFILTERS_HIGHPASS, n_args, pos_args, kw_args);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(audiofilters_highpass_obj, 2, audiofilters_highpass);
+
+//| def bandpass(frequency: float, sample_rate: int, q: float = 0.7071) -> tuple:
+//|     """Returns `Biquad` coefficients that pass frequencies around ``frequency``, in Hz. Higher
+//|     ``q`` gives a narrower band."""
+//|     ...
+//|
+STATIC mp_obj_t audiofilters_bandpass(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return design_biquad(AUDIOFILTERS_BANDPASS, n_args, pos_args, kw_args);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(audiofilters_bandpass_obj, 2, audiofilters_bandpass);
+
+//| def notch(frequency: float, sample_rate: int, q: float = 0.7071) -> tuple:
+//|     """Returns `Biquad` coefficients that block frequencies around ``frequency``, in Hz, such
+//|     as mains hum. Higher ``q`` gives a narrower notch."""
+//|     ...
+//|
+STATIC mp_obj_t audiofilters_notch(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return design_biquad(AUDIOFILTERS_NOTCH, n_args, pos_args, kw_args);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(audiofilters_notch_obj, 2, audiofilters_notch);
+
+STATIC const mp_rom_map_elem_t audiofilters_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_audiofilters) },
+    { MP_ROM_QSTR(MP_QSTR_Biquad), MP_ROM_PTR(&audiofilters_biquad_type) },
+    { MP_ROM_QSTR(MP_QSTR_FIR), MP_ROM_PTR(&audiofilters_fir_type) },
+    { MP_ROM_QSTR(MP_QSTR_lowpass), MP_ROM_PTR(&audiofilters_lowpass_obj) },
+    { MP_ROM_QSTR(MP_QSTR_highpass), MP_ROM_PTR(&audiofilters_highpass_obj) },
+    { MP_ROM_QSTR(MP_QSTR_bandpass), MP_ROM_PTR(&audiofilters_bandpass_obj) },
+    { MP_ROM_QSTR(MP_QSTR_notch), MP_ROM_PTR(&audiofilters_notch_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(audiofilters_module_globals, audiofilters_module_globals_table);
+
+const mp_obj_module_t audiofilters_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t*)&audiofilters_module_globals,
+};
@@ -50,7 +50,7 @@
 //|         :param int channel_count: The number of channels the source samples contain. 1 = mono; 2 = stereo.
 //|         :param int bits_per_sample: The bits per sample of the samples being played
 //|         :param bool samples_signed: Samples are signed (True) or unsigned (False)
-//|         :param int sample_rate: The sample rate to be used for all samples
+//|         :param int sample_rate: The sample rate of the mixed output. Samples at other rates are resampled
 //|
 //|         Playing a wave file from flash::
 //|
@@ -292,6 +292,8 @@ STATIC const audiosample_p_t audiomixer_mixer_proto = {
     .reset_buffer = (audiosample_reset_buffer_fun)audiomixer_mixer_reset_buffer,
     .get_buffer = (audiosample_get_buffer_fun)audiomixer_mixer_get_buffer,
     .get_buffer_structure = (audiosample_get_buffer_structure_fun)audiomixer_mixer_get_buffer_structure,
+    .prefetch = (audiosample_prefetch_fun)audiomixer_mixer_prefetch,
+    .set_output_signed = (audiosample_set_output_signed_fun)audiomixer_mixer_set_output_signed,
 };
 
 const mp_obj_type_t audiomixer_mixer_type = {
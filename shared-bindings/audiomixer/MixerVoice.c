@@ -62,7 +62,13 @@ STATIC mp_obj_t audiomixer_mixervoice_make_new(const mp_obj_type_t *type, size_t
 //|
 //|         Sample must be an `audiocore.WaveFile`, `audiomixer.Mixer` or `audiocore.RawSample`.
 //|
-//|         The sample must match the `audiomixer.Mixer`'s encoding settings given in the constructor."""
+//|         The sample must match the `audiomixer.Mixer`'s channel count, bits per sample and
+//|         signedness given in the constructor. Samples at other sample rates are resampled
+//|         to the mixer's.
+//|
+//|         An `audiocore.RawSample` with loop points set repeats its loop whatever ``loop`` is,
+//|         until its ``loop_end`` is cleared. To play one buffer on several voices at once, give
+//|         each voice its own `audiocore.RawSample` of it."""
 //|         ...
 //|
 STATIC mp_obj_t audiomixer_mixervoice_obj_play(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
@@ -136,6 +142,36 @@ const mp_obj_property_t audiomixer_mixervoice_level_obj = {
               (mp_obj_t)&mp_const_none_obj},
 };
 
+//|     rate: Any = ...
+//|     """How fast the sample is played back, as a multiple of its own sample rate. 2.0 plays
+//|     it an octave higher and twice as fast. Must be greater than 0 and at most 16."""
+//|
+STATIC mp_obj_t audiomixer_mixervoice_obj_get_rate(mp_obj_t self_in) {
+    return mp_obj_new_float(common_hal_audiomixer_mixervoice_get_rate(self_in));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiomixer_mixervoice_get_rate_obj, audiomixer_mixervoice_obj_get_rate);
+
+STATIC mp_obj_t audiomixer_mixervoice_obj_set_rate(mp_obj_t self_in, mp_obj_t rate_in) {
+    audiomixer_mixervoice_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    float rate = mp_obj_get_float(rate_in);
+
+    if (!(rate > 0) || rate > 16) {
+        mp_raise_ValueError(translate("sampling rate out of range"));
+    }
+
+    common_hal_audiomixer_mixervoice_set_rate(self, rate);
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiomixer_mixervoice_set_rate_obj, audiomixer_mixervoice_obj_set_rate);
+
+const mp_obj_property_t audiomixer_mixervoice_rate_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audiomixer_mixervoice_get_rate_obj,
+              (mp_obj_t)&audiomixer_mixervoice_set_rate_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
 //|     playing: Any = ...
 //|     """True when this voice is being output. (read-only)"""
 //|
@@ -163,6 +199,7 @@ STATIC const mp_rom_map_elem_t audiomixer_mixervoice_locals_dict_table[] = {
     // Properties
     { MP_ROM_QSTR(MP_QSTR_playing), MP_ROM_PTR(&audiomixer_mixervoice_playing_obj) },
     { MP_ROM_QSTR(MP_QSTR_level), MP_ROM_PTR(&audiomixer_mixervoice_level_obj) },
+    { MP_ROM_QSTR(MP_QSTR_rate), MP_ROM_PTR(&audiomixer_mixervoice_rate_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(audiomixer_mixervoice_locals_dict, audiomixer_mixervoice_locals_dict_table);
 
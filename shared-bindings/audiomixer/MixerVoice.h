@@ -41,6 +41,8 @@ void common_hal_audiomixer_mixervoice_play(audiomixer_mixervoice_obj_t* self, mp
 void common_hal_audiomixer_mixervoice_stop(audiomixer_mixervoice_obj_t* self);
 float common_hal_audiomixer_mixervoice_get_level(audiomixer_mixervoice_obj_t* self);
 void common_hal_audiomixer_mixervoice_set_level(audiomixer_mixervoice_obj_t* self, float gain);
+float common_hal_audiomixer_mixervoice_get_rate(audiomixer_mixervoice_obj_t* self);
+void common_hal_audiomixer_mixervoice_set_rate(audiomixer_mixervoice_obj_t* self, float rate);
 
 bool common_hal_audiomixer_mixervoice_get_playing(audiomixer_mixervoice_obj_t* self);
 
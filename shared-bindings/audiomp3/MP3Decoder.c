@@ -37,12 +37,13 @@
 //| class MP3:
 //|     """Load a mp3 file for audio playback"""
 //|
-//|     def __init__(self, file: typing.BinaryIO, buffer: bytearray):
+//|     def __init__(self, file: typing.BinaryIO, buffer: bytearray, *, read_ahead: int = 1):
 //|
 //|         """Load a .mp3 file for playback with `audioio.AudioOut` or `audiobusio.I2SOut`.
 //|
 //|         :param typing.BinaryIO file: Already opened mp3 file
-//|         :param bytearray buffer: Optional pre-allocated buffer, that will be split in half and used for double-buffering of the data. If not provided, two buffers are allocated internally.  The specific buffer size required depends on the mp3 file.
+//|         :param bytearray buffer: Optional pre-allocated buffer, that will be split into ``read_ahead + 2`` frames of 4608 bytes each. If not provided, or too short, the frames are allocated internally.
+//|         :param int read_ahead: How many frames to decode ahead of playback, between 0 and 4. Decoding ahead happens in the background, so the work of each frame is spread out and several MP3s can be mixed.
 //|
 //|
 //|         Playing a mp3 file from flash::
@@ -67,24 +68,36 @@
 //|           print("stopped")"""
 //|         ...
 //|
-STATIC mp_obj_t audiomp3_mp3file_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
-    mp_arg_check_num(n_args, kw_args, 1, 2, false);
+STATIC mp_obj_t audiomp3_mp3file_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_file, ARG_buffer, ARG_read_ahead };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_file, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_buffer, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_read_ahead, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = CIRCUITPY_AUDIOMP3_READ_AHEAD} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
-    audiomp3_mp3file_obj_t *self = m_new_obj(audiomp3_mp3file_obj_t);
-    self->base.type = &audiomp3_mp3file_type;
-    if (!MP_OBJ_IS_TYPE(args[0], &mp_type_fileio)) {
+    if (!MP_OBJ_IS_TYPE(args[ARG_file].u_obj, &mp_type_fileio)) {
         mp_raise_TypeError(translate("file must be a file opened in byte mode"));
     }
+    mp_int_t read_ahead = args[ARG_read_ahead].u_int;
+    if (read_ahead < 0 || read_ahead > AUDIOMP3_MAX_READ_AHEAD) {
+        mp_raise_ValueError_varg(translate("read_ahead must be between 0 and %d"), AUDIOMP3_MAX_READ_AHEAD);
+    }
     uint8_t *buffer = NULL;
     size_t buffer_size = 0;
-    if (n_args >= 2) {
+    if (args[ARG_buffer].u_obj != mp_const_none) {
         mp_buffer_info_t bufinfo;
-        mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_WRITE);
+        mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
         buffer = bufinfo.buf;
         buffer_size = bufinfo.len;
     }
-    common_hal_audiomp3_mp3file_construct(self, MP_OBJ_TO_PTR(args[0]),
-                                          buffer, buffer_size);
+
+    audiomp3_mp3file_obj_t *self = m_new_obj(audiomp3_mp3file_obj_t);
+    self->base.type = &audiomp3_mp3file_type;
+    common_hal_audiomp3_mp3file_construct(self, MP_OBJ_TO_PTR(args[ARG_file].u_obj),
+                                          buffer, buffer_size, read_ahead);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -124,6 +137,20 @@ STATIC mp_obj_t audiomp3_mp3file_obj___exit__(size_t n_args, const mp_obj_t *arg
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audiomp3_mp3file___exit___obj, 4, 4, audiomp3_mp3file_obj___exit__);
 
+//|     def seek(self, seconds: float) -> None:
+//|         """Move playback to ``seconds`` into the file, to the start of the frame that contains
+//|         it. Frames up to the furthest point reached so far are found from an index kept while
+//|         playing, so seeking back, and looping, doesn't read the file from the start."""
+//|         ...
+//|
+STATIC mp_obj_t audiomp3_mp3file_obj_seek(mp_obj_t self_in, mp_obj_t seconds) {
+    audiomp3_mp3file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiomp3_mp3file_seek(self, mp_obj_get_float(seconds));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiomp3_mp3file_seek_obj, audiomp3_mp3file_obj_seek);
+
 //|     file: Any = ...
 //|     """File to play back."""
 //|
@@ -232,12 +259,30 @@ const mp_obj_property_t audiomp3_mp3file_rms_level_obj = {
               (mp_obj_t)&mp_const_none_obj},
 };
 
+//|     underruns: int = ...
+//|     """How many times playback needed a frame that hadn't been decoded ahead yet, so it was
+//|     decoded while the output waited. (read only)"""
+//|
+STATIC mp_obj_t audiomp3_mp3file_obj_get_underruns(mp_obj_t self_in) {
+    audiomp3_mp3file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_audiomp3_mp3file_get_underruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiomp3_mp3file_get_underruns_obj, audiomp3_mp3file_obj_get_underruns);
+
+const mp_obj_property_t audiomp3_mp3file_underruns_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audiomp3_mp3file_get_underruns_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
 
 STATIC const mp_rom_map_elem_t audiomp3_mp3file_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiomp3_mp3file_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiomp3_mp3file___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_seek), MP_ROM_PTR(&audiomp3_mp3file_seek_obj) },
 
     // Properties
     { MP_ROM_QSTR(MP_QSTR_file), MP_ROM_PTR(&audiomp3_mp3file_file_obj) },
@@ -245,6 +290,7 @@ STATIC const mp_rom_map_elem_t audiomp3_mp3file_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_bits_per_sample), MP_ROM_PTR(&audiomp3_mp3file_bits_per_sample_obj) },
     { MP_ROM_QSTR(MP_QSTR_channel_count), MP_ROM_PTR(&audiomp3_mp3file_channel_count_obj) },
     { MP_ROM_QSTR(MP_QSTR_rms_level), MP_ROM_PTR(&audiomp3_mp3file_rms_level_obj) },
+    { MP_ROM_QSTR(MP_QSTR_underruns), MP_ROM_PTR(&audiomp3_mp3file_underruns_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(audiomp3_mp3file_locals_dict, audiomp3_mp3file_locals_dict_table);
 
@@ -256,6 +302,8 @@ STATIC const audiosample_p_t audiomp3_mp3file_proto = {
     .reset_buffer = (audiosample_reset_buffer_fun)audiomp3_mp3file_reset_buffer,
     .get_buffer = (audiosample_get_buffer_fun)audiomp3_mp3file_get_buffer,
     .get_buffer_structure = (audiosample_get_buffer_structure_fun)audiomp3_mp3file_get_buffer_structure,
+    .prefetch = (audiosample_prefetch_fun)audiomp3_mp3file_prefetch,
+    .set_output_signed = (audiosample_set_output_signed_fun)audiomp3_mp3file_set_output_signed,
 };
 
 const mp_obj_type_t audiomp3_mp3file_type = {
@@ -30,6 +30,7 @@
 #include "common-hal/audiopwmio/PWMAudioOut.h"
 #include "common-hal/microcontroller/Pin.h"
 #include "shared-bindings/audiocore/RawSample.h"
+#include "shared-module/audiocore/__init__.h"
 
 extern const mp_obj_type_t audiopwmio_pwmaudioout_type;
 
@@ -45,5 +46,7 @@ bool common_hal_audiopwmio_pwmaudioout_get_playing(audiopwmio_pwmaudioout_obj_t*
 void common_hal_audiopwmio_pwmaudioout_pause(audiopwmio_pwmaudioout_obj_t* self);
 void common_hal_audiopwmio_pwmaudioout_resume(audiopwmio_pwmaudioout_obj_t* self);
 bool common_hal_audiopwmio_pwmaudioout_get_paused(audiopwmio_pwmaudioout_obj_t* self);
+// Adds the stats of the buffers filled since play or the last reset into stats.
+void common_hal_audiopwmio_pwmaudioout_get_stats(audiopwmio_pwmaudioout_obj_t* self, audiocore_stats_t* stats, bool reset);
 
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOPWMIO_AUDIOOUT_H
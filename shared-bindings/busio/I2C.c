@@ -331,6 +331,77 @@ STATIC mp_obj_t busio_i2c_writeto_then_readfrom(size_t n_args, const mp_obj_t *p
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(busio_i2c_writeto_then_readfrom_obj, 3, busio_i2c_writeto_then_readfrom);
 
+//|     def writeto_then_readfrom_many(self, operations: Any, in_buffer: bytearray) -> Any:
+//|          """Run a sequence of `writeto_then_readfrom` transfers back to back.
+//|          Each item of ``operations`` is an ``(address, out_buffer, in_length)`` tuple.
+//|          ``out_buffer`` is written to the device at ``address``, then ``in_length`` bytes are
+//|          read after a repeated start. The bytes read by all the operations are stored one after
+//|          the other at the start of ``in_buffer``. An operation with an ``in_length`` of 0 only
+//|          writes, and ends with a stop bit.
+//|
+//|          All the operations are checked before any is sent. `OSError` is raised by the first
+//|          operation that fails; the ones after it are not run.
+//|
+//|          :param list operations: ``(address, out_buffer, in_length)`` tuples
+//|          :param bytearray in_buffer: buffer to read into"""
+//|          ...
+//|
+STATIC mp_obj_t busio_i2c_writeto_then_readfrom_many(mp_obj_t self_in, mp_obj_t operations_in, mp_obj_t in_buffer) {
+    busio_i2c_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    check_lock(self);
+
+    size_t num_operations;
+    mp_obj_t *operations;
+    mp_obj_get_array(operations_in, &num_operations, &operations);
+
+    mp_buffer_info_t in_bufinfo;
+    mp_get_buffer_raise(in_buffer, &in_bufinfo, MP_BUFFER_WRITE);
+
+    // Check everything first so that a bad operation doesn't stop the batch halfway.
+    size_t total_length = 0;
+    for (size_t i = 0; i < num_operations; i++) {
+        mp_obj_t *operation;
+        mp_obj_get_array_fixed_n(operations[i], 3, &operation);
+        mp_obj_get_int(operation[0]);
+        mp_buffer_info_t out_bufinfo;
+        mp_get_buffer_raise(operation[1], &out_bufinfo, MP_BUFFER_READ);
+        mp_int_t in_length = mp_obj_get_int(operation[2]);
+        if (in_length < 0) {
+            mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_in_length);
+        }
+        total_length += in_length;
+    }
+    if (total_length > in_bufinfo.len) {
+        mp_raise_ValueError(translate("Buffer is too small"));
+    }
+
+    uint8_t *data_in = in_bufinfo.buf;
+    for (size_t i = 0; i < num_operations; i++) {
+        mp_obj_t *operation;
+        mp_obj_get_array_fixed_n(operations[i], 3, &operation);
+        mp_int_t address = mp_obj_get_int(operation[0]);
+        mp_buffer_info_t out_bufinfo;
+        mp_get_buffer_raise(operation[1], &out_bufinfo, MP_BUFFER_READ);
+        size_t in_length = mp_obj_get_int(operation[2]);
+
+        uint8_t status = 0;
+        if (out_bufinfo.len > 0 || in_length == 0) {
+            status = common_hal_busio_i2c_write(self, address, out_bufinfo.buf, out_bufinfo.len,
+                                                in_length == 0);
+        }
+        if (status == 0 && in_length > 0) {
+            status = common_hal_busio_i2c_read(self, address, data_in, in_length);
+        }
+        if (status != 0) {
+            mp_raise_OSError(status);
+        }
+        data_in += in_length;
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_3(busio_i2c_writeto_then_readfrom_many_obj, busio_i2c_writeto_then_readfrom_many);
+
 STATIC const mp_rom_map_elem_t busio_i2c_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&busio_i2c_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
@@ -343,6 +414,7 @@ STATIC const mp_rom_map_elem_t busio_i2c_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_readfrom_into), MP_ROM_PTR(&busio_i2c_readfrom_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_writeto), MP_ROM_PTR(&busio_i2c_writeto_obj) },
     { MP_ROM_QSTR(MP_QSTR_writeto_then_readfrom), MP_ROM_PTR(&busio_i2c_writeto_then_readfrom_obj) },
+    { MP_ROM_QSTR(MP_QSTR_writeto_then_readfrom_many), MP_ROM_PTR(&busio_i2c_writeto_then_readfrom_many_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(busio_i2c_locals_dict, busio_i2c_locals_dict_table);
@@ -37,7 +37,7 @@
 //| class OneWire:
 //|     """Lowest-level of the Maxim OneWire protocol"""
 //|
-//|     def __init__(self, pin: microcontroller.Pin):
+//|     def __init__(self, pin: microcontroller.Pin, *, rx: microcontroller.Pin = None):
 //|         """(formerly Dallas Semi) OneWire protocol.
 //|
 //|         Protocol definition is here: https://www.maximintegrated.com/en/app-notes/index.mvp/id/126
@@ -48,6 +48,10 @@
 //|           implements the lowest level timing-sensitive bits of the protocol.
 //|
 //|           :param ~microcontroller.Pin pin: Pin connected to the OneWire bus
+//|           :param ~microcontroller.Pin rx: When given, ``pin`` and ``rx`` are the TX and RX of
+//|             a UART that runs the bus instead of timing each bit with interrupts off. ``rx``
+//|             connects straight to the bus and ``pin`` drives it low only, through an open
+//|             drain buffer or a diode.
 //|
 //|           Read a short series of pulses::
 //|
@@ -62,18 +66,24 @@
 //|         ...
 //|
 STATIC mp_obj_t busio_onewire_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_pin };
+    enum { ARG_pin, ARG_rx };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_pin, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_rx, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
     const mcu_pin_obj_t* pin = validate_obj_is_free_pin(args[ARG_pin].u_obj);
+    const mcu_pin_obj_t* rx = validate_obj_is_free_pin_or_none(args[ARG_rx].u_obj);
 
     busio_onewire_obj_t *self = m_new_obj(busio_onewire_obj_t);
     self->base.type = &busio_onewire_type;
 
-    common_hal_busio_onewire_construct(self, pin);
+    if (rx != NULL) {
+        common_hal_busio_onewire_construct_uart(self, pin, rx);
+    } else {
+        common_hal_busio_onewire_construct(self, pin);
+    }
     return MP_OBJ_FROM_PTR(self);
 }
 
@@ -155,6 +165,52 @@ STATIC mp_obj_t busio_onewire_obj_write_bit(mp_obj_t self_in, mp_obj_t bool_obj)
 }
 MP_DEFINE_CONST_FUN_OBJ_2(busio_onewire_write_bit_obj, busio_onewire_obj_write_bit);
 
+//|     def write(self, buf: bytearray) -> Any:
+//|         """Write out the bytes in ``buf``, least significant bit first. Interrupts are
+//|         only turned off for each bit, if at all."""
+//|         ...
+//|
+STATIC mp_obj_t busio_onewire_obj_write(mp_obj_t self_in, mp_obj_t buf_in) {
+    busio_onewire_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_READ);
+    common_hal_busio_onewire_write(self, bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(busio_onewire_write_obj, busio_onewire_obj_write);
+
+//|     def readinto(self, buf: bytearray) -> Any:
+//|         """Fill ``buf`` with bytes read off the bus, such as a whole DS18B20 scratchpad."""
+//|         ...
+//|
+STATIC mp_obj_t busio_onewire_obj_readinto(mp_obj_t self_in, mp_obj_t buf_in) {
+    busio_onewire_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_WRITE);
+    common_hal_busio_onewire_readinto(self, bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(busio_onewire_readinto_obj, busio_onewire_obj_readinto);
+
+//|     def search(self, ) -> Any:
+//|         """Find the ROM codes of all the devices on the bus.
+//|
+//|         :returns: 8 byte ROM codes, family code first
+//|         :rtype: list of bytes"""
+//|         ...
+//|
+STATIC mp_obj_t busio_onewire_obj_search(mp_obj_t self_in) {
+    busio_onewire_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    return common_hal_busio_onewire_search(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busio_onewire_search_obj, busio_onewire_obj_search);
+
 STATIC const mp_rom_map_elem_t busio_onewire_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&busio_onewire_deinit_obj) },
@@ -163,6 +219,9 @@ STATIC const mp_rom_map_elem_t busio_onewire_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_reset), MP_ROM_PTR(&busio_onewire_reset_obj) },
     { MP_ROM_QSTR(MP_QSTR_read_bit), MP_ROM_PTR(&busio_onewire_read_bit_obj) },
     { MP_ROM_QSTR(MP_QSTR_write_bit), MP_ROM_PTR(&busio_onewire_write_bit_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&busio_onewire_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&busio_onewire_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_search), MP_ROM_PTR(&busio_onewire_search_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(busio_onewire_locals_dict, busio_onewire_locals_dict_table);
 
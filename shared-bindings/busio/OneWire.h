@@ -40,4 +40,11 @@ extern bool common_hal_busio_onewire_reset(busio_onewire_obj_t* self);
 extern bool common_hal_busio_onewire_read_bit(busio_onewire_obj_t* self);
 extern void common_hal_busio_onewire_write_bit(busio_onewire_obj_t* self, bool bit);
 
+// Runs the bus with a UART instead of bit-banging the pin.
+extern void common_hal_busio_onewire_construct_uart(busio_onewire_obj_t* self,
+    const mcu_pin_obj_t* tx, const mcu_pin_obj_t* rx);
+extern void common_hal_busio_onewire_write(busio_onewire_obj_t* self, const uint8_t* data, size_t len);
+extern void common_hal_busio_onewire_readinto(busio_onewire_obj_t* self, uint8_t* data, size_t len);
+extern mp_obj_t common_hal_busio_onewire_search(busio_onewire_obj_t* self);
+
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_BUSIO_ONEWIRE_H
@@ -329,7 +329,10 @@ MP_DEFINE_CONST_FUN_OBJ_KW(busio_spi_readinto_obj, 2, busio_spi_readinto);
 //|         ...
 //|
 
-STATIC mp_obj_t busio_spi_write_readinto(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+// Checks the arguments shared by write_readinto() and start_write_readinto() and
+// returns the length of the slices. The buffer objects are stored in buffers.
+STATIC size_t get_write_readinto_slices(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args,
+        uint8_t **data_out, uint8_t **data_in, mp_obj_t *buffers) {
     enum { ARG_buffer_out, ARG_buffer_in, ARG_out_start, ARG_out_end, ARG_in_start, ARG_in_end };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_buffer_out,    MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
@@ -361,14 +364,25 @@ STATIC mp_obj_t busio_spi_write_readinto(size_t n_args, const mp_obj_t *pos_args
         mp_raise_ValueError(translate("buffer slices must be of equal length"));
     }
 
-    if (out_length == 0) {
+    *data_out = ((uint8_t*)buf_out_info.buf) + out_start;
+    *data_in = ((uint8_t*)buf_in_info.buf) + in_start;
+    buffers[0] = args[ARG_buffer_out].u_obj;
+    buffers[1] = args[ARG_buffer_in].u_obj;
+    return out_length;
+}
+
+STATIC mp_obj_t busio_spi_write_readinto(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    busio_spi_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    uint8_t *data_out;
+    uint8_t *data_in;
+    mp_obj_t buffers[2];
+    size_t length = get_write_readinto_slices(n_args, pos_args, kw_args, &data_out, &data_in, buffers);
+
+    if (length == 0) {
         return mp_const_none;
     }
 
-    bool ok = common_hal_busio_spi_transfer(self,
-                                            ((uint8_t*)buf_out_info.buf) + out_start,
-                                            ((uint8_t*)buf_in_info.buf) + in_start,
-                                            out_length);
+    bool ok = common_hal_busio_spi_transfer(self, data_out, data_in, length);
     if (!ok) {
         mp_raise_OSError(MP_EIO);
     }
@@ -376,6 +390,73 @@ STATIC mp_obj_t busio_spi_write_readinto(size_t n_args, const mp_obj_t *pos_args
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(busio_spi_write_readinto_obj, 2, busio_spi_write_readinto);
 
+#if CIRCUITPY_BUSIO_SPI_BACKGROUND
+//|     def start_write_readinto(self, buffer_out: bytearray, buffer_in: bytearray, *, out_start: Any = 0, out_end: int = None, in_start: Any = 0, in_end: int = None) -> Any:
+//|         """Start the same transfer as `write_readinto` and return while it is still going.
+//|         Any transfer already in progress is finished first, so the next one can be
+//|         started as soon as the previous buffers have been handled.
+//|         Neither buffer may be changed or resized until `busy` is False or `wait` returns.
+//|         Blocking transfers and `configure` wait for the transfer too.
+//|         Not available on all boards.
+//|
+//|         :param bytearray buffer_out: Write out the data in this buffer
+//|         :param bytearray buffer_in: Read data into this buffer
+//|         :param int out_start: Start of the slice of buffer_out to write out: ``buffer_out[out_start:out_end]``
+//|         :param int out_end: End of the slice; this index is not included. Defaults to ``len(buffer_out)``
+//|         :param int in_start: Start of the slice of ``buffer_in`` to read into: ``buffer_in[in_start:in_end]``
+//|         :param int in_end: End of the slice; this index is not included. Defaults to ``len(buffer_in)``"""
+//|         ...
+//|
+
+STATIC mp_obj_t busio_spi_start_write_readinto(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    busio_spi_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    uint8_t *data_out;
+    uint8_t *data_in;
+    mp_obj_t buffers[2];
+    size_t length = get_write_readinto_slices(n_args, pos_args, kw_args, &data_out, &data_in, buffers);
+
+    if (!common_hal_busio_spi_start_transfer(self, data_out, data_in, length, mp_obj_new_tuple(2, buffers))) {
+        mp_raise_RuntimeError(translate("No DMA channel found"));
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(busio_spi_start_write_readinto_obj, 2, busio_spi_start_write_readinto);
+
+//|     def wait(self) -> Any:
+//|         """Wait for the transfer started by `start_write_readinto` to finish.
+//|         Raises `OSError` if it failed. Returns right away when no transfer is in progress."""
+//|         ...
+//|
+
+STATIC mp_obj_t busio_spi_wait(mp_obj_t self_in) {
+    busio_spi_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    if (!common_hal_busio_spi_wait(self)) {
+        mp_raise_OSError(MP_EIO);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busio_spi_wait_obj, busio_spi_wait);
+
+//|     busy: bool = ...
+//|     """True while a transfer started by `start_write_readinto` is in progress. (read-only)"""
+//|
+
+STATIC mp_obj_t busio_spi_obj_get_busy(mp_obj_t self_in) {
+    busio_spi_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_bool(common_hal_busio_spi_get_busy(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busio_spi_get_busy_obj, busio_spi_obj_get_busy);
+
+const mp_obj_property_t busio_spi_busy_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&busio_spi_get_busy_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+#endif
+
 //|     frequency: Any = ...
 //|     """The actual SPI bus frequency. This may not match the frequency requested
 //|     due to internal limitations."""
@@ -407,6 +488,11 @@ STATIC const mp_rom_map_elem_t busio_spi_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&busio_spi_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&busio_spi_write_obj) },
     { MP_ROM_QSTR(MP_QSTR_write_readinto), MP_ROM_PTR(&busio_spi_write_readinto_obj) },
+    #if CIRCUITPY_BUSIO_SPI_BACKGROUND
+    { MP_ROM_QSTR(MP_QSTR_start_write_readinto), MP_ROM_PTR(&busio_spi_start_write_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_wait), MP_ROM_PTR(&busio_spi_wait_obj) },
+    { MP_ROM_QSTR(MP_QSTR_busy), MP_ROM_PTR(&busio_spi_busy_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_frequency), MP_ROM_PTR(&busio_spi_frequency_obj) }
 };
 STATIC MP_DEFINE_CONST_DICT(busio_spi_locals_dict, busio_spi_locals_dict_table);
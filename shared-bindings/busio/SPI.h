@@ -58,6 +58,18 @@ extern bool common_hal_busio_spi_read(busio_spi_obj_t *self, uint8_t *data, size
 // Reads and write len bytes simultaneously.
 extern bool common_hal_busio_spi_transfer(busio_spi_obj_t *self, uint8_t *data_out, uint8_t *data_in, size_t len);
 
+#if CIRCUITPY_BUSIO_SPI_BACKGROUND
+// Starts the same transfer as common_hal_busio_spi_transfer and returns while it runs. buffers is
+// kept referenced until the transfer is done. Returns false if the transfer couldn't be started.
+extern bool common_hal_busio_spi_start_transfer(busio_spi_obj_t *self, uint8_t *data_out, uint8_t *data_in, size_t len, mp_obj_t buffers);
+
+// True while a transfer started by common_hal_busio_spi_start_transfer is running.
+extern bool common_hal_busio_spi_get_busy(busio_spi_obj_t *self);
+
+// Waits for a started transfer to finish. Returns false if it failed.
+extern bool common_hal_busio_spi_wait(busio_spi_obj_t *self);
+#endif
+
 // Return actual SPI bus frequency.
 uint32_t common_hal_busio_spi_get_frequency(busio_spi_obj_t* self);
 
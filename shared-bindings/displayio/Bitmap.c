@@ -37,7 +37,12 @@
 #include "supervisor/shared/translate.h"
 
 //| class Bitmap:
-//|     """Stores values of a certain size in a 2D array"""
+//|     """Stores values of a certain size in a 2D array
+//|
+//|     The bitmap supports the buffer protocol for reading, so ``memoryview(bitmap)``
+//|     or any other buffer consumer sees its values without a copy.  Each row is
+//|     padded to a whole machine word.  Values of fewer than 8 bits are packed
+//|     several to a word, starting from its most significant bits."""
 //|
 //|     def __init__(self, width: int, height: int, value_count: int):
 //|         """Create a Bitmap object with the given fixed size. Each pixel stores a value that is used to
@@ -189,10 +194,96 @@ STATIC mp_obj_t displayio_bitmap_obj_fill(mp_obj_t self_in, mp_obj_t value_obj)
 }
 MP_DEFINE_CONST_FUN_OBJ_2(displayio_bitmap_fill_obj, displayio_bitmap_obj_fill);
 
+//|     def fill_region(self, x1: int, y1: int, x2: int, y2: int, value: int) -> None:
+//|         """Fills the rectangle from x1,y1 up to but not including x2,y2 with the supplied palette
+//|         index value. Parts of the rectangle outside the bitmap are ignored."""
+//|         ...
+//|
+STATIC mp_obj_t displayio_bitmap_obj_fill_region(size_t n_args, const mp_obj_t *args) {
+    displayio_bitmap_t *self = MP_OBJ_TO_PTR(args[0]);
+
+    mp_int_t value = mp_obj_get_int(args[5]);
+    if (value >= 1 << common_hal_displayio_bitmap_get_bits_per_value(self)) {
+        mp_raise_ValueError(translate("pixel value requires too many bits"));
+    }
+    common_hal_displayio_bitmap_fill_region(self, mp_obj_get_int(args[1]), mp_obj_get_int(args[2]),
+                                            mp_obj_get_int(args[3]), mp_obj_get_int(args[4]), value);
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(displayio_bitmap_fill_region_obj, 6, 6, displayio_bitmap_obj_fill_region);
+
+//|     def blit(self, x: int, y: int, source_bitmap: Bitmap, *, x1: int = 0, y1: int = 0, x2: int = None, y2: int = None, skip_index: int = None) -> None:
+//|         """Copies the rectangle from x1,y1 up to but not including x2,y2 of source_bitmap so that
+//|         its top left corner lands at x,y. The source may be this bitmap, for example to scroll part
+//|         of it. Values outside either bitmap are ignored.
+//|
+//|         :param int x: Horizontal position of the copy in this bitmap
+//|         :param int y: Vertical position of the copy in this bitmap
+//|         :param Bitmap source_bitmap: The bitmap to copy from
+//|         :param int x1: Left edge of the rectangle in the source
+//|         :param int y1: Top edge of the rectangle in the source
+//|         :param int x2: Right edge of the rectangle in the source, defaults to its width
+//|         :param int y2: Bottom edge of the rectangle in the source, defaults to its height
+//|         :param int skip_index: Source value that isn't copied, leaving ours in place"""
+//|         ...
+//|
+STATIC mp_obj_t displayio_bitmap_obj_blit(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_x, ARG_y, ARG_source, ARG_x1, ARG_y1, ARG_x2, ARG_y2, ARG_skip_index };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_y, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_source_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_x1, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+        { MP_QSTR_y1, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+        { MP_QSTR_x2, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_y2, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_skip_index, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    displayio_bitmap_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+
+    if (!MP_OBJ_IS_TYPE(args[ARG_source].u_obj, &displayio_bitmap_type)) {
+        mp_raise_TypeError_varg(translate("unsupported %q type"), MP_QSTR_source_bitmap);
+    }
+    displayio_bitmap_t *source = MP_OBJ_TO_PTR(args[ARG_source].u_obj);
+    if (common_hal_displayio_bitmap_get_bits_per_value(source) > common_hal_displayio_bitmap_get_bits_per_value(self)) {
+        mp_raise_ValueError(translate("pixel value requires too many bits"));
+    }
+
+    mp_int_t x2 = common_hal_displayio_bitmap_get_width(source);
+    if (args[ARG_x2].u_obj != mp_const_none) {
+        x2 = mp_obj_get_int(args[ARG_x2].u_obj);
+    }
+    mp_int_t y2 = common_hal_displayio_bitmap_get_height(source);
+    if (args[ARG_y2].u_obj != mp_const_none) {
+        y2 = mp_obj_get_int(args[ARG_y2].u_obj);
+    }
+    uint32_t skip_index = 0;
+    bool skip_index_none = args[ARG_skip_index].u_obj == mp_const_none;
+    if (!skip_index_none) {
+        skip_index = mp_obj_get_int(args[ARG_skip_index].u_obj);
+    }
+
+    common_hal_displayio_bitmap_blit(self, args[ARG_x].u_int, args[ARG_y].u_int, source,
+                                     args[ARG_x1].u_int, args[ARG_y1].u_int, x2, y2, skip_index, skip_index_none);
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(displayio_bitmap_blit_obj, 1, displayio_bitmap_obj_blit);
+
+STATIC mp_int_t displayio_bitmap_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    displayio_bitmap_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_displayio_bitmap_get_buffer(self, bufinfo, flags);
+}
+
 STATIC const mp_rom_map_elem_t displayio_bitmap_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&displayio_bitmap_height_obj) },
     { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&displayio_bitmap_width_obj) },
     { MP_ROM_QSTR(MP_QSTR_fill), MP_ROM_PTR(&displayio_bitmap_fill_obj) },
+    { MP_ROM_QSTR(MP_QSTR_fill_region), MP_ROM_PTR(&displayio_bitmap_fill_region_obj) },
+    { MP_ROM_QSTR(MP_QSTR_blit), MP_ROM_PTR(&displayio_bitmap_blit_obj) },
 
 };
 STATIC MP_DEFINE_CONST_DICT(displayio_bitmap_locals_dict, displayio_bitmap_locals_dict_table);
@@ -202,5 +293,6 @@ const mp_obj_type_t displayio_bitmap_type = {
     .name = MP_QSTR_Bitmap,
     .make_new = displayio_bitmap_make_new,
     .subscr = bitmap_subscr,
+    .buffer_p = { .get_buffer = displayio_bitmap_get_buffer },
     .locals_dict = (mp_obj_dict_t*)&displayio_bitmap_locals_dict,
 };
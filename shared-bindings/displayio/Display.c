@@ -395,6 +395,24 @@ const mp_obj_property_t displayio_display_rotation_obj = {
               (mp_obj_t)&mp_const_none_obj},
 };
 
+//|     frame_stats: tuple = ...
+//|     """Timing of the frames drawn so far, as a tuple of the number of frames, the number of frames
+//|     dropped to keep up with the frame rate, the milliseconds the last frame took, the most
+//|     milliseconds any frame took and the number of pixels the last frame sent. (read only)"""
+//|
+STATIC mp_obj_t displayio_display_obj_get_frame_stats(mp_obj_t self_in) {
+    displayio_display_obj_t *self = native_display(self_in);
+    return common_hal_displayio_display_get_frame_stats(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_display_get_frame_stats_obj, displayio_display_obj_get_frame_stats);
+
+const mp_obj_property_t displayio_display_frame_stats_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&displayio_display_get_frame_stats_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
 //|     bus: Any = ...
 //|	    """The bus being used by the display"""
 //|
@@ -480,6 +498,7 @@ STATIC const mp_rom_map_elem_t displayio_display_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_fill_row), MP_ROM_PTR(&displayio_display_fill_row_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_auto_refresh), MP_ROM_PTR(&displayio_display_auto_refresh_obj) },
+    { MP_ROM_QSTR(MP_QSTR_frame_stats), MP_ROM_PTR(&displayio_display_frame_stats_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_brightness), MP_ROM_PTR(&displayio_display_brightness_obj) },
     { MP_ROM_QSTR(MP_QSTR_auto_brightness), MP_ROM_PTR(&displayio_display_auto_brightness_obj) },
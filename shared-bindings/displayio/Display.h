@@ -55,6 +55,8 @@ bool common_hal_displayio_display_refresh(displayio_display_obj_t* self, uint32_
 bool common_hal_displayio_display_get_auto_refresh(displayio_display_obj_t* self);
 void common_hal_displayio_display_set_auto_refresh(displayio_display_obj_t* self, bool auto_refresh);
 
+mp_obj_t common_hal_displayio_display_get_frame_stats(displayio_display_obj_t* self);
+
 uint16_t common_hal_displayio_display_get_width(displayio_display_obj_t* self);
 uint16_t common_hal_displayio_display_get_height(displayio_display_obj_t* self);
 uint16_t common_hal_displayio_display_get_rotation(displayio_display_obj_t* self);
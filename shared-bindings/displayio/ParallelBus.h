@@ -50,4 +50,9 @@ void common_hal_displayio_parallelbus_send(mp_obj_t self, display_byte_type_t by
 
 void common_hal_displayio_parallelbus_end_transaction(mp_obj_t self);
 
+#if CIRCUITPY_DISPLAYIO_PARALLELBUS_DMA
+void common_hal_displayio_parallelbus_send_async(mp_obj_t self, uint8_t *data, uint32_t data_length);
+void common_hal_displayio_parallelbus_wait_for_send(mp_obj_t self);
+#endif
+
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_DISPLAYBUSIO_PARALLELBUS_H
@@ -0,0 +1,259 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/displayio/TextLayer.h"
+
+#include <stdint.h>
+
+#include "py/objproperty.h"
+#include "py/objtype.h"
+#include "py/runtime.h"
+#include "shared-bindings/displayio/ColorConverter.h"
+#include "shared-bindings/displayio/Palette.h"
+#include "supervisor/shared/translate.h"
+
+//| class TextLayer:
+//|     """A line, or lines, of text drawn straight from a font
+//|
+//|     Glyphs are placed one after another by their own advance width rather than in a fixed
+//|     grid, so proportional fonts look as intended. Each glyph's bitmap value is passed to the
+//|     pixel_shader. Value 0 is transparent so anti-aliased fonts with 2 or 4 bit coverage can use
+//|     a palette that ramps from the background to the text color."""
+//|
+//|     def __init__(self, font: Any, *, pixel_shader: displayio.Palette, text: str = "", kerning: dict = None, x: int = 0, y: int = 0):
+//|         """Create a TextLayer object. The font may be a `fontio.BuiltinFont` or any font with
+//|         ``get_glyph`` and ``get_bounding_box`` such as those loaded by adafruit_bitmap_font.
+//|
+//|         :param font: The font to draw the text with. Its glyphs must be stored in `displayio.Bitmap` objects.
+//|         :param displayio.Palette pixel_shader: The pixel shader that produces colors from glyph values
+//|         :param str text: The text to show. Newlines start a new line below the last.
+//|         :param dict kerning: Extra pixels between pairs of characters, keyed by the pair such as ``"AV"``.
+//|         :param int x: Initial x position of the left edge within the parent.
+//|         :param int y: Initial y position of the baseline of the first line within the parent."""
+//|
+STATIC mp_obj_t displayio_textlayer_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_font, ARG_pixel_shader, ARG_text, ARG_kerning, ARG_x, ARG_y };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_font, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_pixel_shader, MP_ARG_OBJ | MP_ARG_KW_ONLY | MP_ARG_REQUIRED },
+        { MP_QSTR_text, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NEW_QSTR(MP_QSTR_)} },
+        { MP_QSTR_kerning, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_x, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+        { MP_QSTR_y, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t pixel_shader = args[ARG_pixel_shader].u_obj;
+    if (!MP_OBJ_IS_TYPE(pixel_shader, &displayio_colorconverter_type) &&
+        !MP_OBJ_IS_TYPE(pixel_shader, &displayio_palette_type)) {
+        mp_raise_TypeError_varg(translate("unsupported %q type"), MP_QSTR_pixel_shader);
+    }
+    mp_obj_t text = args[ARG_text].u_obj;
+    if (!MP_OBJ_IS_STR(text)) {
+        mp_raise_TypeError_varg(translate("unsupported %q type"), MP_QSTR_text);
+    }
+    mp_obj_t kerning = args[ARG_kerning].u_obj;
+    if (kerning != mp_const_none && !MP_OBJ_IS_TYPE(kerning, &mp_type_dict)) {
+        mp_raise_TypeError_varg(translate("unsupported %q type"), MP_QSTR_kerning);
+    }
+
+    displayio_textlayer_t *self = m_new_obj(displayio_textlayer_t);
+    self->base.type = &displayio_textlayer_type;
+    common_hal_displayio_textlayer_construct(self, args[ARG_font].u_obj, text, kerning,
+        pixel_shader, args[ARG_x].u_int, args[ARG_y].u_int);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+// Helper to ensure we have the native super class instead of a subclass.
+static displayio_textlayer_t* native_textlayer(mp_obj_t textlayer_obj) {
+    mp_obj_t native_textlayer = mp_instance_cast_to_native_base(textlayer_obj, &displayio_textlayer_type);
+    mp_obj_assert_native_inited(native_textlayer);
+    return MP_OBJ_TO_PTR(native_textlayer);
+}
+
+//|     text: str = ...
+//|     """The text shown. Setting it lays out the glyphs again."""
+//|
+STATIC mp_obj_t displayio_textlayer_obj_get_text(mp_obj_t self_in) {
+    displayio_textlayer_t *self = native_textlayer(self_in);
+    return common_hal_displayio_textlayer_get_text(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_textlayer_get_text_obj, displayio_textlayer_obj_get_text);
+
+STATIC mp_obj_t displayio_textlayer_obj_set_text(mp_obj_t self_in, mp_obj_t text) {
+    displayio_textlayer_t *self = native_textlayer(self_in);
+    if (!MP_OBJ_IS_STR(text)) {
+        mp_raise_TypeError_varg(translate("unsupported %q type"), MP_QSTR_text);
+    }
+    common_hal_displayio_textlayer_set_text(self, text);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(displayio_textlayer_set_text_obj, displayio_textlayer_obj_set_text);
+
+const mp_obj_property_t displayio_textlayer_text_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&displayio_textlayer_get_text_obj,
+              (mp_obj_t)&displayio_textlayer_set_text_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     font: Any = ...
+//|     """The font the text is drawn with."""
+//|
+STATIC mp_obj_t displayio_textlayer_obj_get_font(mp_obj_t self_in) {
+    displayio_textlayer_t *self = native_textlayer(self_in);
+    return common_hal_displayio_textlayer_get_font(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_textlayer_get_font_obj, displayio_textlayer_obj_get_font);
+
+const mp_obj_property_t displayio_textlayer_font_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&displayio_textlayer_get_font_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     x: int = ...
+//|     """X position of the left edge in the parent."""
+//|
+STATIC mp_obj_t displayio_textlayer_obj_get_x(mp_obj_t self_in) {
+    displayio_textlayer_t *self = native_textlayer(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_displayio_textlayer_get_x(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_textlayer_get_x_obj, displayio_textlayer_obj_get_x);
+
+STATIC mp_obj_t displayio_textlayer_obj_set_x(mp_obj_t self_in, mp_obj_t x_obj) {
+    displayio_textlayer_t *self = native_textlayer(self_in);
+
+    mp_int_t x = mp_obj_get_int(x_obj);
+    common_hal_displayio_textlayer_set_x(self, x);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(displayio_textlayer_set_x_obj, displayio_textlayer_obj_set_x);
+
+const mp_obj_property_t displayio_textlayer_x_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&displayio_textlayer_get_x_obj,
+              (mp_obj_t)&displayio_textlayer_set_x_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     y: int = ...
+//|     """Y position of the first line's baseline in the parent."""
+//|
+STATIC mp_obj_t displayio_textlayer_obj_get_y(mp_obj_t self_in) {
+    displayio_textlayer_t *self = native_textlayer(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_displayio_textlayer_get_y(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_textlayer_get_y_obj, displayio_textlayer_obj_get_y);
+
+STATIC mp_obj_t displayio_textlayer_obj_set_y(mp_obj_t self_in, mp_obj_t y_obj) {
+    displayio_textlayer_t *self = native_textlayer(self_in);
+
+    mp_int_t y = mp_obj_get_int(y_obj);
+    common_hal_displayio_textlayer_set_y(self, y);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(displayio_textlayer_set_y_obj, displayio_textlayer_obj_set_y);
+
+const mp_obj_property_t displayio_textlayer_y_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&displayio_textlayer_get_y_obj,
+              (mp_obj_t)&displayio_textlayer_set_y_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     pixel_shader: Any = ...
+//|     """The pixel shader of the text."""
+//|
+STATIC mp_obj_t displayio_textlayer_obj_get_pixel_shader(mp_obj_t self_in) {
+    displayio_textlayer_t *self = native_textlayer(self_in);
+    return common_hal_displayio_textlayer_get_pixel_shader(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_textlayer_get_pixel_shader_obj, displayio_textlayer_obj_get_pixel_shader);
+
+STATIC mp_obj_t displayio_textlayer_obj_set_pixel_shader(mp_obj_t self_in, mp_obj_t pixel_shader) {
+    displayio_textlayer_t *self = native_textlayer(self_in);
+    if (!MP_OBJ_IS_TYPE(pixel_shader, &displayio_palette_type) && !MP_OBJ_IS_TYPE(pixel_shader, &displayio_colorconverter_type)) {
+        mp_raise_TypeError(translate("pixel_shader must be displayio.Palette or displayio.ColorConverter"));
+    }
+
+    common_hal_displayio_textlayer_set_pixel_shader(self, pixel_shader);
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(displayio_textlayer_set_pixel_shader_obj, displayio_textlayer_obj_set_pixel_shader);
+
+const mp_obj_property_t displayio_textlayer_pixel_shader_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&displayio_textlayer_get_pixel_shader_obj,
+              (mp_obj_t)&displayio_textlayer_set_pixel_shader_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     bounding_box: Tuple[int, int, int, int] = ...
+//|     """The x, y, width and height of the drawn glyphs relative to x and y. y is usually negative
+//|     because glyphs sit above the baseline."""
+//|
+STATIC mp_obj_t displayio_textlayer_obj_get_bounding_box(mp_obj_t self_in) {
+    displayio_textlayer_t *self = native_textlayer(self_in);
+    displayio_area_t bounds;
+    common_hal_displayio_textlayer_get_bounds(self, &bounds);
+    mp_obj_t items[4] = {
+        MP_OBJ_NEW_SMALL_INT(bounds.x1),
+        MP_OBJ_NEW_SMALL_INT(bounds.y1),
+        MP_OBJ_NEW_SMALL_INT(bounds.x2 - bounds.x1),
+        MP_OBJ_NEW_SMALL_INT(bounds.y2 - bounds.y1),
+    };
+    return mp_obj_new_tuple(4, items);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_textlayer_get_bounding_box_obj, displayio_textlayer_obj_get_bounding_box);
+
+const mp_obj_property_t displayio_textlayer_bounding_box_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&displayio_textlayer_get_bounding_box_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+STATIC const mp_rom_map_elem_t displayio_textlayer_locals_dict_table[] = {
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_text), MP_ROM_PTR(&displayio_textlayer_text_obj) },
+    { MP_ROM_QSTR(MP_QSTR_font), MP_ROM_PTR(&displayio_textlayer_font_obj) },
+    { MP_ROM_QSTR(MP_QSTR_x), MP_ROM_PTR(&displayio_textlayer_x_obj) },
+    { MP_ROM_QSTR(MP_QSTR_y), MP_ROM_PTR(&displayio_textlayer_y_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pixel_shader), MP_ROM_PTR(&displayio_textlayer_pixel_shader_obj) },
+    { MP_ROM_QSTR(MP_QSTR_bounding_box), MP_ROM_PTR(&displayio_textlayer_bounding_box_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(displayio_textlayer_locals_dict, displayio_textlayer_locals_dict_table);
+
+const mp_obj_type_t displayio_textlayer_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_TextLayer,
+    .make_new = displayio_textlayer_make_new,
+    .locals_dict = (mp_obj_dict_t*)&displayio_textlayer_locals_dict,
+};
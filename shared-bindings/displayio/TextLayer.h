@@ -0,0 +1,49 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_BINDINGS_DISPLAYIO_TEXTLAYER_H
+#define MICROPY_INCLUDED_SHARED_BINDINGS_DISPLAYIO_TEXTLAYER_H
+
+#include "shared-module/displayio/TextLayer.h"
+
+extern const mp_obj_type_t displayio_textlayer_type;
+
+void common_hal_displayio_textlayer_construct(displayio_textlayer_t *self, mp_obj_t font, mp_obj_t text,
+        mp_obj_t kerning, mp_obj_t pixel_shader, int16_t x, int16_t y);
+
+mp_obj_t common_hal_displayio_textlayer_get_text(displayio_textlayer_t *self);
+void common_hal_displayio_textlayer_set_text(displayio_textlayer_t *self, mp_obj_t text);
+mp_obj_t common_hal_displayio_textlayer_get_font(displayio_textlayer_t *self);
+mp_obj_t common_hal_displayio_textlayer_get_pixel_shader(displayio_textlayer_t *self);
+void common_hal_displayio_textlayer_set_pixel_shader(displayio_textlayer_t *self, mp_obj_t pixel_shader);
+mp_int_t common_hal_displayio_textlayer_get_x(displayio_textlayer_t *self);
+void common_hal_displayio_textlayer_set_x(displayio_textlayer_t *self, mp_int_t x);
+mp_int_t common_hal_displayio_textlayer_get_y(displayio_textlayer_t *self);
+void common_hal_displayio_textlayer_set_y(displayio_textlayer_t *self, mp_int_t y);
+// Bounds of the laid out glyphs relative to x and y.
+void common_hal_displayio_textlayer_get_bounds(displayio_textlayer_t *self, displayio_area_t* bounds);
+
+#endif // MICROPY_INCLUDED_SHARED_BINDINGS_DISPLAYIO_TEXTLAYER_H
@@ -44,6 +44,11 @@ typedef bool (*display_bus_bus_free)(mp_obj_t bus);
 typedef bool (*display_bus_begin_transaction)(mp_obj_t bus);
 typedef void (*display_bus_send)(mp_obj_t bus, display_byte_type_t byte_type, display_chip_select_behavior_t chip_select, uint8_t *data, uint32_t data_length);
 typedef void (*display_bus_end_transaction)(mp_obj_t bus);
+// Optional for a bus: start sending DISPLAY_DATA bytes (e.g. by DMA) and return
+// before the transfer is done. data must stay untouched until wait_for_send
+// returns, and nothing else may be sent in between.
+typedef void (*display_bus_send_async)(mp_obj_t bus, uint8_t *data, uint32_t data_length);
+typedef void (*display_bus_wait_for_send)(mp_obj_t bus);
 
 void common_hal_displayio_release_displays(void);
 
@@ -0,0 +1,122 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/fontio/PackedFont.h"
+
+#include <stdint.h>
+
+#include "py/runtime.h"
+#include "supervisor/shared/translate.h"
+
+//| class PackedFont:
+//|     """A font precompiled by ``tools/gen_packed_font.py``. Glyphs are read from the
+//|     file or buffer as they are needed, rather than all being loaded up front, and the
+//|     most recently used ones are kept as Bitmaps.
+//|
+//|     Usage::
+//|
+//|        import fontio
+//|
+//|        font = fontio.PackedFont(open("/fonts/ter-u12n.cpf", "rb"))
+//|        glyph = font.get_glyph(ord("A"))"""
+//|
+//|     def __init__(self, file: file, *, cache_size: int = 16):
+//|         """Load the index of a packed font.
+//|
+//|         :param file file: The packed font file, opened in byte mode. A buffer, such as a
+//|           ``bytes`` object frozen into flash, may be given instead.
+//|         :param int cache_size: The number of glyphs to keep as Bitmaps"""
+//|         ...
+//|
+STATIC mp_obj_t fontio_packedfont_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_file, ARG_cache_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_file, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_cache_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 16} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t source = args[ARG_file].u_obj;
+    pyb_file_obj_t* file = NULL;
+    mp_buffer_info_t bufinfo;
+    if (MP_OBJ_IS_TYPE(source, &mp_type_fileio)) {
+        file = MP_OBJ_TO_PTR(source);
+    } else if (!mp_get_buffer(source, &bufinfo, MP_BUFFER_READ)) {
+        mp_raise_TypeError(translate("file must be a file opened in byte mode"));
+    }
+    mp_int_t cache_size = args[ARG_cache_size].u_int;
+    if (cache_size < 1) {
+        mp_raise_ValueError_varg(translate("%q must be >= 1"), MP_QSTR_cache_size);
+    }
+
+    fontio_packedfont_t *self = m_new_obj(fontio_packedfont_t);
+    self->base.type = &fontio_packedfont_type;
+    common_hal_fontio_packedfont_construct(self, file, source, MIN(cache_size, 0xffff));
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def get_bounding_box(self, ) -> Any:
+//|         """Returns the maximum bounds of all glyphs in the font in a tuple of four values:
+//|         width, height, x offset and y offset."""
+//|         ...
+//|
+STATIC mp_obj_t fontio_packedfont_obj_get_bounding_box(mp_obj_t self_in) {
+    fontio_packedfont_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return common_hal_fontio_packedfont_get_bounding_box(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(fontio_packedfont_get_bounding_box_obj, fontio_packedfont_obj_get_bounding_box);
+
+//|     def get_glyph(self, codepoint: Any) -> Any:
+//|         """Returns a `fontio.Glyph` for the given codepoint or None if no glyph is available.
+//|         Each glyph has its own bitmap, so ``tile_index`` is always 0."""
+//|         ...
+//|
+STATIC mp_obj_t fontio_packedfont_obj_get_glyph(mp_obj_t self_in, mp_obj_t codepoint_obj) {
+    fontio_packedfont_t *self = MP_OBJ_TO_PTR(self_in);
+
+    mp_int_t codepoint;
+    if (!mp_obj_get_int_maybe(codepoint_obj, &codepoint)) {
+        mp_raise_ValueError_varg(translate("%q should be an int"), MP_QSTR_codepoint);
+    }
+    return common_hal_fontio_packedfont_get_glyph(self, codepoint);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(fontio_packedfont_get_glyph_obj, fontio_packedfont_obj_get_glyph);
+
+STATIC const mp_rom_map_elem_t fontio_packedfont_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_get_bounding_box), MP_ROM_PTR(&fontio_packedfont_get_bounding_box_obj) },
+    { MP_ROM_QSTR(MP_QSTR_get_glyph), MP_ROM_PTR(&fontio_packedfont_get_glyph_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(fontio_packedfont_locals_dict, fontio_packedfont_locals_dict_table);
+
+const mp_obj_type_t fontio_packedfont_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_PackedFont,
+    .make_new = fontio_packedfont_make_new,
+    .locals_dict = (mp_obj_dict_t*)&fontio_packedfont_locals_dict,
+};
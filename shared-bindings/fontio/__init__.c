@@ -32,6 +32,7 @@
 #include "shared-bindings/fontio/__init__.h"
 #include "shared-bindings/fontio/BuiltinFont.h"
 #include "shared-bindings/fontio/Glyph.h"
+#include "shared-bindings/fontio/PackedFont.h"
 
 //| """Core font related data structures"""
 //|
@@ -40,6 +41,7 @@ STATIC const mp_rom_map_elem_t fontio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_fontio) },
     { MP_ROM_QSTR(MP_QSTR_BuiltinFont), MP_ROM_PTR(&fontio_builtinfont_type) },
     { MP_ROM_QSTR(MP_QSTR_Glyph), MP_ROM_PTR(&fontio_glyph_type) },
+    { MP_ROM_QSTR(MP_QSTR_PackedFont), MP_ROM_PTR(&fontio_packedfont_type) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(fontio_module_globals, fontio_module_globals_table);
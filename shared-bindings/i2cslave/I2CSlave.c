@@ -136,6 +136,8 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(i2cslave_i2c_slave___exit___obj, 4, 4
 //|     def request(self, timeout: float = -1) -> Any:
 //|         """Wait for an I2C request from a master.
 //|
+//|         Not available while `registers` is set.
+//|
 //|         :param float timeout: Timeout in seconds. Zero means wait forever, a negative value means check once
 //|         :return: I2C Slave Request or None if timeout=-1 and there's no request
 //|         :rtype: ~i2cslave.I2CSlaveRequest"""
@@ -153,6 +155,10 @@ STATIC mp_obj_t i2cslave_i2c_slave_request(size_t n_args, const mp_obj_t *pos_ar
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
+    if (common_hal_i2cslave_i2c_slave_get_registers(self) != mp_const_none) {
+        mp_raise_RuntimeError(translate("Requests are not available while registers is set"));
+    }
+
     #if MICROPY_PY_BUILTINS_FLOAT
     float f = mp_obj_get_float(args[ARG_timeout].u_obj) * 1000;
     int timeout_ms = (int)f;
@@ -208,11 +214,83 @@ STATIC mp_obj_t i2cslave_i2c_slave_request(size_t n_args, const mp_obj_t *pos_ar
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(i2cslave_i2c_slave_request_obj, 1, i2cslave_i2c_slave_request);
 
+//|     registers: Optional[WriteableBuffer] = ...
+//|     """A buffer served as a register map, or None to handle requests with `request`.
+//|
+//|     While set, transfers to the slave's addresses are handled without Python.
+//|     The first byte a master writes sets the register pointer and the following
+//|     bytes are stored from there on. A read returns the bytes from the pointer on.
+//|     The pointer moves on by one for every byte. Writes past the end of the
+//|     buffer are dropped, and reads past it return 0xff.
+//|
+//|     .. code-block:: python
+//|
+//|       regs = bytearray(16)
+//|       slave.registers = regs
+//|       while True:
+//|           written = slave.written
+//|           if written:
+//|               print(regs[written[0]:written[1]])"""
+//|
+STATIC mp_obj_t i2cslave_i2c_slave_obj_get_registers(mp_obj_t self_in) {
+    i2cslave_i2c_slave_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (common_hal_i2cslave_i2c_slave_deinited(self)) {
+        raise_deinited_error();
+    }
+    return common_hal_i2cslave_i2c_slave_get_registers(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(i2cslave_i2c_slave_get_registers_obj, i2cslave_i2c_slave_obj_get_registers);
+
+STATIC mp_obj_t i2cslave_i2c_slave_obj_set_registers(mp_obj_t self_in, mp_obj_t registers) {
+    i2cslave_i2c_slave_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (common_hal_i2cslave_i2c_slave_deinited(self)) {
+        raise_deinited_error();
+    }
+    common_hal_i2cslave_i2c_slave_set_registers(self, registers);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(i2cslave_i2c_slave_set_registers_obj, i2cslave_i2c_slave_obj_set_registers);
+
+const mp_obj_property_t i2cslave_i2c_slave_registers_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&i2cslave_i2c_slave_get_registers_obj,
+              (mp_obj_t)&i2cslave_i2c_slave_set_registers_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     written: Optional[Tuple[int, int]] = ...
+//|     """The ``(start, end)`` range of `registers` written by masters since
+//|     `written` was last read, or None if nothing was written. A transfer's
+//|     writes show up once it ends. (read-only)"""
+//|
+STATIC mp_obj_t i2cslave_i2c_slave_obj_get_written(mp_obj_t self_in) {
+    i2cslave_i2c_slave_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (common_hal_i2cslave_i2c_slave_deinited(self)) {
+        raise_deinited_error();
+    }
+    size_t start, end;
+    if (!common_hal_i2cslave_i2c_slave_get_written(self, &start, &end)) {
+        return mp_const_none;
+    }
+    mp_obj_t range[2] = { MP_OBJ_NEW_SMALL_INT(start), MP_OBJ_NEW_SMALL_INT(end) };
+    return mp_obj_new_tuple(2, range);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(i2cslave_i2c_slave_get_written_obj, i2cslave_i2c_slave_obj_get_written);
+
+const mp_obj_property_t i2cslave_i2c_slave_written_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&i2cslave_i2c_slave_get_written_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
 STATIC const mp_rom_map_elem_t i2cslave_i2c_slave_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&i2cslave_i2c_slave_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&i2cslave_i2c_slave___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_request), MP_ROM_PTR(&i2cslave_i2c_slave_request_obj) },
+    { MP_ROM_QSTR(MP_QSTR_registers), MP_ROM_PTR(&i2cslave_i2c_slave_registers_obj) },
+    { MP_ROM_QSTR(MP_QSTR_written), MP_ROM_PTR(&i2cslave_i2c_slave_written_obj) },
 
 };
 
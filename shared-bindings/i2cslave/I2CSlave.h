@@ -57,4 +57,8 @@ extern int common_hal_i2cslave_i2c_slave_write_byte(i2cslave_i2c_slave_obj_t *se
 extern void common_hal_i2cslave_i2c_slave_ack(i2cslave_i2c_slave_obj_t *self, bool ack);
 extern void common_hal_i2cslave_i2c_slave_close(i2cslave_i2c_slave_obj_t *self);
 
+extern void common_hal_i2cslave_i2c_slave_set_registers(i2cslave_i2c_slave_obj_t *self, mp_obj_t registers);
+extern mp_obj_t common_hal_i2cslave_i2c_slave_get_registers(i2cslave_i2c_slave_obj_t *self);
+extern bool common_hal_i2cslave_i2c_slave_get_written(i2cslave_i2c_slave_obj_t *self, size_t *start, size_t *end);
+
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_BUSIO_I2C_SLAVE_H
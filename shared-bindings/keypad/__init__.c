@@ -0,0 +1,121 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/obj.h"
+#include "py/runtime.h"
+#include "shared-bindings/keypad/__init__.h"
+#include "shared-bindings/keypad/Event.h"
+#include "shared-bindings/keypad/EventQueue.h"
+#include "shared-bindings/keypad/KeyMatrix.h"
+#include "shared-bindings/keypad/Keys.h"
+#include "shared-bindings/keypad/ShiftRegisterKeys.h"
+#include "shared-bindings/util.h"
+#include "supervisor/shared/translate.h"
+
+//| """Support for scanning keys and key matrices
+//|
+//| The `keypad` module provides native support to scan sets of keys or buttons,
+//| connected independently to individual pins, connected to a shift register,
+//| or connected in a row-and-column matrix.
+//|
+//| Scanning happens in the background from the supervisor tick, so no key
+//| transitions are lost while the program is busy. Each transition is
+//| debounced and timestamped, then queued as an `Event` in the scanner's
+//| `EventQueue` for the program to read whenever it is ready."""
+//|
+
+void keypad_generic_check_for_deinit(mp_obj_t self_in) {
+    if (common_hal_keypad_generic_deinited(MP_OBJ_TO_PTR(self_in))) {
+        raise_deinited_error();
+    }
+}
+
+mp_float_t keypad_generic_validate_interval(mp_obj_t interval_obj) {
+    mp_float_t interval = mp_obj_get_float(interval_obj);
+    if (interval < 0.0f || interval > 2.0f) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_interval);
+    }
+    return interval;
+}
+
+size_t keypad_generic_validate_max_events(mp_int_t max_events) {
+    if (max_events < 1) {
+        mp_raise_ValueError_varg(translate("%q must be >= 1"), MP_QSTR_max_events);
+    }
+    return (size_t)max_events;
+}
+
+// Methods and properties shared by all the scanner classes. Each class
+// documents them itself.
+
+STATIC mp_obj_t keypad_generic_reset(mp_obj_t self_in) {
+    keypad_generic_check_for_deinit(self_in);
+    common_hal_keypad_generic_reset(MP_OBJ_TO_PTR(self_in));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(keypad_generic_reset_obj, keypad_generic_reset);
+
+STATIC mp_obj_t keypad_generic_get_key_count(mp_obj_t self_in) {
+    keypad_generic_check_for_deinit(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_keypad_generic_get_key_count(MP_OBJ_TO_PTR(self_in)));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(keypad_generic_get_key_count_obj, keypad_generic_get_key_count);
+
+const mp_obj_property_t keypad_generic_key_count_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&keypad_generic_get_key_count_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+STATIC mp_obj_t keypad_generic_get_events(mp_obj_t self_in) {
+    keypad_generic_check_for_deinit(self_in);
+    return common_hal_keypad_generic_get_events(MP_OBJ_TO_PTR(self_in));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(keypad_generic_get_events_obj, keypad_generic_get_events);
+
+const mp_obj_property_t keypad_generic_events_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&keypad_generic_get_events_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+STATIC const mp_rom_map_elem_t keypad_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_keypad) },
+    { MP_ROM_QSTR(MP_QSTR_Event), MP_ROM_PTR(&keypad_event_type) },
+    { MP_ROM_QSTR(MP_QSTR_EventQueue), MP_ROM_PTR(&keypad_eventqueue_type) },
+    { MP_ROM_QSTR(MP_QSTR_KeyMatrix), MP_ROM_PTR(&keypad_keymatrix_type) },
+    { MP_ROM_QSTR(MP_QSTR_Keys), MP_ROM_PTR(&keypad_keys_type) },
+    { MP_ROM_QSTR(MP_QSTR_ShiftRegisterKeys), MP_ROM_PTR(&keypad_shiftregisterkeys_type) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(keypad_module_globals, keypad_module_globals_table);
+
+const mp_obj_module_t keypad_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t*)&keypad_module_globals,
+};
@@ -0,0 +1,50 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_BINDINGS_KEYPAD___INIT___H
+#define MICROPY_INCLUDED_SHARED_BINDINGS_KEYPAD___INIT___H
+
+#include <stdbool.h>
+
+#include "py/obj.h"
+#include "py/objproperty.h"
+
+// The scanner classes share these, since their objects all begin with
+// KEYPAD_SCANNER_COMMON_FIELDS.
+bool common_hal_keypad_generic_deinited(void *self);
+void common_hal_keypad_generic_reset(void *self);
+size_t common_hal_keypad_generic_get_key_count(void *self);
+mp_obj_t common_hal_keypad_generic_get_events(void *self);
+
+void keypad_generic_check_for_deinit(mp_obj_t self_in);
+mp_float_t keypad_generic_validate_interval(mp_obj_t interval_obj);
+size_t keypad_generic_validate_max_events(mp_int_t max_events);
+
+extern const mp_obj_fun_builtin_fixed_t keypad_generic_reset_obj;
+extern const mp_obj_property_t keypad_generic_key_count_obj;
+extern const mp_obj_property_t keypad_generic_events_obj;
+
+#endif  // MICROPY_INCLUDED_SHARED_BINDINGS_KEYPAD___INIT___H
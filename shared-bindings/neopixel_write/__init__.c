@@ -50,29 +50,63 @@
 //|   pixel_off = bytearray([0, 0, 0])
 //|   neopixel_write.neopixel_write(pin, pixel_off)"""
 //|
-//| def neopixel_write(digitalinout: digitalio.DigitalInOut, buf: bytearray) -> None:
+//| def neopixel_write(digitalinout: digitalio.DigitalInOut, buf: bytearray, *, background: bool = False) -> None:
 //|   """Write buf out on the given DigitalInOut.
 //|
+//|   When background is True and the port can send pixels with DMA, this returns as soon as
+//|   sending starts, so the next frame can be worked out while the pixels go out. buf is copied
+//|   first, so it can be changed straight away. Otherwise this returns once the pixels are sent.
+//|
 //|   :param digitalinout: the DigitalInOut to output with
-//|   :param buf: The bytes to clock out. No assumption is made about color order"""
+//|   :param buf: The bytes to clock out. No assumption is made about color order
+//|   :param bool background: Return while the pixels are still being sent"""
 //|   ...
-STATIC mp_obj_t neopixel_write_neopixel_write_(mp_obj_t digitalinout_obj, mp_obj_t buf) {
+STATIC mp_obj_t neopixel_write_neopixel_write_(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_digitalinout, ARG_buf, ARG_background };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_digitalinout, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_buf, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_background, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t digitalinout_obj = args[ARG_digitalinout].u_obj;
     if (!MP_OBJ_IS_TYPE(digitalinout_obj, &digitalio_digitalinout_type)) {
         mp_raise_TypeError_varg(translate("Expected a %q"), digitalio_digitalinout_type.name);
     }
     // Convert parameters into expected types.
     const digitalio_digitalinout_obj_t *digitalinout = MP_OBJ_TO_PTR(digitalinout_obj);
     mp_buffer_info_t bufinfo;
-    mp_get_buffer_raise(buf, &bufinfo, MP_BUFFER_READ);
+    mp_get_buffer_raise(args[ARG_buf].u_obj, &bufinfo, MP_BUFFER_READ);
     // Call platform's neopixel write function with provided buffer and options.
+    #if CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND
+    if (args[ARG_background].u_bool) {
+        common_hal_neopixel_write_background(digitalinout, (uint8_t*)bufinfo.buf, bufinfo.len);
+        return mp_const_none;
+    }
+    #endif
     common_hal_neopixel_write(digitalinout, (uint8_t*)bufinfo.buf, bufinfo.len);
     return mp_const_none;
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_2(neopixel_write_neopixel_write_obj, neopixel_write_neopixel_write_);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(neopixel_write_neopixel_write_obj, 2, neopixel_write_neopixel_write_);
+
+//| def busy() -> bool:
+//|   """True while pixels from a background `neopixel_write` are still being sent."""
+//|   ...
+STATIC mp_obj_t neopixel_write_busy(void) {
+    #if CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND
+    return mp_obj_new_bool(common_hal_neopixel_write_get_busy());
+    #else
+    return mp_const_false;
+    #endif
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(neopixel_write_busy_obj, neopixel_write_busy);
 
 STATIC const mp_rom_map_elem_t neopixel_write_module_globals_table[] = {
     { MP_OBJ_NEW_QSTR(MP_QSTR___name__), MP_OBJ_NEW_QSTR(MP_QSTR_neopixel_write) },
     { MP_OBJ_NEW_QSTR(MP_QSTR_neopixel_write), (mp_obj_t)&neopixel_write_neopixel_write_obj },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_busy), (mp_obj_t)&neopixel_write_busy_obj },
 };
 
 STATIC MP_DEFINE_CONST_DICT(neopixel_write_module_globals, neopixel_write_module_globals_table);
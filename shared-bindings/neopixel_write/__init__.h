@@ -34,4 +34,11 @@
 
 extern void common_hal_neopixel_write(const digitalio_digitalinout_obj_t* gpio, uint8_t *pixels, uint32_t numBytes);
 
+#if CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND
+// Starts sending the pixels and returns. The pixels are copied, so the buffer
+// can be reused straight away.
+extern void common_hal_neopixel_write_background(const digitalio_digitalinout_obj_t* gpio, uint8_t *pixels, uint32_t numBytes);
+extern bool common_hal_neopixel_write_get_busy(void);
+#endif
+
 #endif  // MICROPY_INCLUDED_SHARED_BINDINGS_NEOPIXEL_WRITE_H
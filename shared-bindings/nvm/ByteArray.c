@@ -35,13 +35,16 @@
 //|     """Presents a stretch of non-volatile memory as a bytearray.
 //|
 //|     Non-volatile memory is available as a byte array that persists over reloads
-//|     and power cycles. Each assignment causes an erase and write cycle so its recommended to assign
-//|     all values to change at once.
+//|     and power cycles. Assignments are gathered in RAM and written out together by
+//|     `flush`, when an assignment moves on to another flash erase unit, or when
+//|     the VM resets. Assigning values that are already stored doesn't write anything.
+//|     Call `flush` before anything that may cut the power so no changes are lost.
 //|
 //|     Usage::
 //|
 //|        import microcontroller
-//|        microcontroller.nvm[0:3] = b\"\xcc\x10\x00\""""
+//|        microcontroller.nvm[0:3] = b\"\xcc\x10\x00\"
+//|        microcontroller.nvm.flush()"""
 //|
 
 //|     def __init__(self, ):
@@ -63,7 +66,21 @@ STATIC mp_obj_t nvm_bytearray_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
     }
 }
 
+//|     def flush(self, ) -> None:
+//|         """Write any changes that are still held in RAM out to the flash."""
+//|         ...
+//|
+STATIC mp_obj_t nvm_bytearray_flush(mp_obj_t self_in) {
+    nvm_bytearray_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (!common_hal_nvm_bytearray_flush(self)) {
+        mp_raise_RuntimeError(translate("Unable to write to nvm."));
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(nvm_bytearray_flush_obj, nvm_bytearray_flush);
+
 STATIC const mp_rom_map_elem_t nvm_bytearray_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&nvm_bytearray_flush_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(nvm_bytearray_locals_dict, nvm_bytearray_locals_dict_table);
@@ -89,6 +89,27 @@ mp_obj_t os_listdir(size_t n_args, const mp_obj_t *args) {
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(os_listdir_obj, 0, 1, os_listdir);
 
+//| def ilistdir(dir: Any) -> Any:
+//|     """Return an iterator over the entries of the current directory, or of
+//|     the given directory.  Each entry is a tuple ``(name, type, inode[, size])``
+//|     where ``type`` is ``0x4000`` for a directory and ``0x8000`` for a file,
+//|     and ``size`` (when the filesystem provides it) is the size of a file in
+//|     bytes.  Entries are read from the directory one at a time as the
+//|     iterator advances, so nothing is built up for the whole directory and
+//|     the size comes without a separate `stat` call per file."""
+//|     ...
+//|
+mp_obj_t os_ilistdir(size_t n_args, const mp_obj_t *args) {
+    const char* path;
+    if (n_args == 1) {
+        path = mp_obj_str_get_str(args[0]);
+    } else {
+        path = mp_obj_str_get_str(common_hal_os_getcwd());
+    }
+    return common_hal_os_ilistdir(path);
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(os_ilistdir_obj, 0, 1, os_ilistdir);
+
 //| def mkdir(path: Any) -> Any:
 //|     """Create a new directory."""
 //|     ...
@@ -211,6 +232,7 @@ STATIC const mp_rom_map_elem_t os_module_globals_table[] = {
 
     { MP_ROM_QSTR(MP_QSTR_chdir), MP_ROM_PTR(&os_chdir_obj) },
     { MP_ROM_QSTR(MP_QSTR_getcwd), MP_ROM_PTR(&os_getcwd_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ilistdir), MP_ROM_PTR(&os_ilistdir_obj) },
     { MP_ROM_QSTR(MP_QSTR_listdir), MP_ROM_PTR(&os_listdir_obj) },
     { MP_ROM_QSTR(MP_QSTR_mkdir), MP_ROM_PTR(&os_mkdir_obj) },
     { MP_ROM_QSTR(MP_QSTR_remove), MP_ROM_PTR(&os_remove_obj) },
@@ -0,0 +1,135 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/profiler/__init__.h"
+
+//| """Statistical CPU profiler
+//|
+//| The `profiler` module finds out where Python code spends its time by
+//| looking at what the main thread is executing at a fixed rate, from the
+//| supervisor tick, and counting how often each location turns up. It costs
+//| nothing while stopped and very little while running, so it can be used on
+//| regular firmware.
+//|
+//| Example usage::
+//|
+//|     import profiler
+//|     profiler.start()
+//|     busy_code()
+//|     profiler.stop()
+//|     for function, file, offset, count in profiler.dump():
+//|         print(function, file, offset, count)"""
+//|
+
+//| def start(rate: int = 100) -> None:
+//|     """Starts, or restarts at a new rate, taking samples. Counts carry on
+//|     from where they were; use `reset` to clear them.
+//|
+//|     :param int rate: samples per second, from 1 to 1024"""
+//|     ...
+//|
+STATIC mp_obj_t profiler_start(size_t n_args, const mp_obj_t *args) {
+    mp_int_t rate = 100;
+    if (n_args > 0) {
+        rate = mp_obj_get_int(args[0]);
+    }
+    if (rate < 1 || rate > 1024) {
+        mp_raise_ValueError_varg(translate("%q out of range"), MP_QSTR_rate);
+    }
+    shared_module_profiler_start(rate);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(profiler_start_obj, 0, 1, profiler_start);
+
+//| def stop() -> None:
+//|     """Stops taking samples."""
+//|     ...
+//|
+STATIC mp_obj_t profiler_stop(void) {
+    shared_module_profiler_stop();
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(profiler_stop_obj, profiler_stop);
+
+//| def running() -> bool:
+//|     """True while samples are being taken."""
+//|     ...
+//|
+STATIC mp_obj_t profiler_running(void) {
+    return mp_obj_new_bool(shared_module_profiler_is_running());
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(profiler_running_obj, profiler_running);
+
+//| def reset() -> None:
+//|     """Clears the samples counted so far."""
+//|     ...
+//|
+STATIC mp_obj_t profiler_reset(void) {
+    shared_module_profiler_reset();
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(profiler_reset_obj, profiler_reset);
+
+//| def dump(n: int = 8) -> list:
+//|     """Returns the n most sampled locations, most first, as a list of
+//|     ``(function, file, offset, count)`` tuples. ``offset`` is the
+//|     bytecode offset within the function. ``function`` and ``file`` are
+//|     None for samples taken outside of Python code, such as while sleeping.
+//|
+//|     Only a limited number of locations are tracked. Once they are all in
+//|     use, the least sampled one is replaced, so counts for code that rarely
+//|     shows up are approximate."""
+//|     ...
+//|
+STATIC mp_obj_t profiler_dump(size_t n_args, const mp_obj_t *args) {
+    mp_int_t n = 8;
+    if (n_args > 0) {
+        n = mp_obj_get_int(args[0]);
+    }
+    return shared_module_profiler_dump(MAX(n, 0));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(profiler_dump_obj, 0, 1, profiler_dump);
+
+STATIC const mp_rom_map_elem_t profiler_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_profiler) },
+    { MP_ROM_QSTR(MP_QSTR_start), MP_ROM_PTR(&profiler_start_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop), MP_ROM_PTR(&profiler_stop_obj) },
+    { MP_ROM_QSTR(MP_QSTR_running), MP_ROM_PTR(&profiler_running_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reset), MP_ROM_PTR(&profiler_reset_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dump), MP_ROM_PTR(&profiler_dump_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(profiler_module_globals, profiler_module_globals_table);
+
+const mp_obj_module_t profiler_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t*)&profiler_module_globals,
+};
@@ -28,9 +28,11 @@
 #include <stdint.h>
 
 #include "lib/utils/context_manager_helpers.h"
+#include "py/ioctl.h"
 #include "py/objproperty.h"
 #include "py/runtime.h"
 #include "py/runtime0.h"
+#include "py/stream.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/ps2io/Ps2.h"
 #include "shared-bindings/util.h"
@@ -218,6 +220,24 @@ STATIC mp_obj_t ps2_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
     }
 }
 
+// Only poll is supported, so that uselect (and uasyncio) can wait for data
+// to arrive instead of checking len() in a loop.
+STATIC mp_uint_t ps2_ioctl(mp_obj_t self_in, mp_uint_t request, mp_uint_t arg, int *errcode) {
+    ps2io_ps2_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_uint_t ret;
+    if (request == MP_IOCTL_POLL) {
+        ret = 0;
+        if ((arg & MP_IOCTL_POLL_RD) && common_hal_ps2io_ps2_get_len(self) > 0) {
+            ret |= MP_IOCTL_POLL_RD;
+        }
+    } else {
+        *errcode = MP_EINVAL;
+        ret = MP_STREAM_ERROR;
+    }
+    return ret;
+}
+
 STATIC const mp_rom_map_elem_t ps2io_ps2_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&ps2io_ps2_deinit_obj) },
@@ -229,10 +249,16 @@ STATIC const mp_rom_map_elem_t ps2io_ps2_locals_dict_table[] = {
 };
 STATIC MP_DEFINE_CONST_DICT(ps2io_ps2_locals_dict, ps2io_ps2_locals_dict_table);
 
+STATIC const mp_stream_p_t ps2_stream_p = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_stream)
+    .ioctl = ps2_ioctl,
+};
+
 const mp_obj_type_t ps2io_ps2_type = {
     { &mp_type_type },
     .name = MP_QSTR_Ps2,
     .make_new = ps2io_ps2_make_new,
     .unary_op = ps2_unary_op,
+    .protocol = &ps2_stream_p,
     .locals_dict = (mp_obj_dict_t*)&ps2io_ps2_locals_dict,
 };
@@ -27,9 +27,11 @@
 #include <stdint.h>
 
 #include "lib/utils/context_manager_helpers.h"
+#include "py/ioctl.h"
 #include "py/objproperty.h"
 #include "py/runtime.h"
 #include "py/runtime0.h"
+#include "py/stream.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/pulseio/PulseIn.h"
 #include "shared-bindings/util.h"
@@ -172,7 +174,7 @@ STATIC mp_obj_t pulseio_pulsein_obj_resume(size_t n_args, const mp_obj_t *pos_ar
 MP_DEFINE_CONST_FUN_OBJ_KW(pulseio_pulsein_resume_obj, 1, pulseio_pulsein_obj_resume);
 
 //|     def clear(self, ) -> Any:
-//|         """Clears all captured pulses"""
+//|         """Clears all captured pulses and resets `dropped`"""
 //|         ...
 //|
 STATIC mp_obj_t pulseio_pulsein_obj_clear(mp_obj_t self_in) {
@@ -196,6 +198,26 @@ STATIC mp_obj_t pulseio_pulsein_obj_popleft(mp_obj_t self_in) {
 }
 MP_DEFINE_CONST_FUN_OBJ_1(pulseio_pulsein_popleft_obj, pulseio_pulsein_obj_popleft);
 
+//|     def readinto(self, buffer: array.array) -> int:
+//|         """Removes the oldest pulses and stores them in ``buffer``, which must be an
+//|         array of type ``'H'``. As many pulses are moved as fit or are available. Returns
+//|         the number of pulses moved."""
+//|         ...
+//|
+STATIC mp_obj_t pulseio_pulsein_obj_readinto(mp_obj_t self_in, mp_obj_t buffer) {
+    pulseio_pulsein_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_WRITE);
+    if (bufinfo.typecode != 'H') {
+        mp_raise_TypeError(translate("Array must contain halfwords (type 'H')"));
+    }
+    size_t len = MIN(bufinfo.len / 2, 0xffff);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_pulseio_pulsein_readinto(self, bufinfo.buf, len));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(pulseio_pulsein_readinto_obj, pulseio_pulsein_obj_readinto);
+
 //|     maxlen: Any = ...
 //|     """The maximum length of the PulseIn. When len() is equal to maxlen,
 //|     it is unclear which pulses are active and which are idle."""
@@ -215,6 +237,25 @@ const mp_obj_property_t pulseio_pulsein_maxlen_obj = {
               (mp_obj_t)&mp_const_none_obj},
 };
 
+//|     dropped: int = ...
+//|     """The number of pulses discarded to make room because the PulseIn was full.
+//|     Reset by `clear`. (read-only)"""
+//|
+STATIC mp_obj_t pulseio_pulsein_obj_get_dropped(mp_obj_t self_in) {
+    pulseio_pulsein_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    return mp_obj_new_int_from_uint(common_hal_pulseio_pulsein_get_dropped(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(pulseio_pulsein_get_dropped_obj, pulseio_pulsein_obj_get_dropped);
+
+const mp_obj_property_t pulseio_pulsein_dropped_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&pulseio_pulsein_get_dropped_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
 //|     paused: Any = ...
 //|     """True when pulse capture is paused as a result of :py:func:`pause` or an error during capture
 //|     such as a signal that is too fast."""
@@ -286,6 +327,24 @@ STATIC mp_obj_t pulsein_subscr(mp_obj_t self_in, mp_obj_t index_obj, mp_obj_t va
     return mp_const_none;
 }
 
+// Only poll is supported, so that uselect (and uasyncio) can wait for data
+// to arrive instead of checking len() in a loop.
+STATIC mp_uint_t pulsein_ioctl(mp_obj_t self_in, mp_uint_t request, mp_uint_t arg, int *errcode) {
+    pulseio_pulsein_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_uint_t ret;
+    if (request == MP_IOCTL_POLL) {
+        ret = 0;
+        if ((arg & MP_IOCTL_POLL_RD) && common_hal_pulseio_pulsein_get_len(self) > 0) {
+            ret |= MP_IOCTL_POLL_RD;
+        }
+    } else {
+        *errcode = MP_EINVAL;
+        ret = MP_STREAM_ERROR;
+    }
+    return ret;
+}
+
 STATIC const mp_rom_map_elem_t pulseio_pulsein_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&pulseio_pulsein_deinit_obj) },
@@ -295,18 +354,26 @@ STATIC const mp_rom_map_elem_t pulseio_pulsein_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_resume), MP_ROM_PTR(&pulseio_pulsein_resume_obj) },
     { MP_ROM_QSTR(MP_QSTR_clear), MP_ROM_PTR(&pulseio_pulsein_clear_obj) },
     { MP_ROM_QSTR(MP_QSTR_popleft), MP_ROM_PTR(&pulseio_pulsein_popleft_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&pulseio_pulsein_readinto_obj) },
 
     // Properties
     { MP_ROM_QSTR(MP_QSTR_maxlen), MP_ROM_PTR(&pulseio_pulsein_maxlen_obj) },
     { MP_ROM_QSTR(MP_QSTR_paused), MP_ROM_PTR(&pulseio_pulsein_paused_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dropped), MP_ROM_PTR(&pulseio_pulsein_dropped_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(pulseio_pulsein_locals_dict, pulseio_pulsein_locals_dict_table);
 
+STATIC const mp_stream_p_t pulsein_stream_p = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_stream)
+    .ioctl = pulsein_ioctl,
+};
+
 const mp_obj_type_t pulseio_pulsein_type = {
     { &mp_type_type },
     .name = MP_QSTR_PulseIn,
     .make_new = pulseio_pulsein_make_new,
     .subscr = pulsein_subscr,
     .unary_op = pulsein_unary_op,
+    .protocol = &pulsein_stream_p,
     .locals_dict = (mp_obj_dict_t*)&pulseio_pulsein_locals_dict,
 };
@@ -40,6 +40,8 @@ extern void common_hal_pulseio_pulsein_pause(pulseio_pulsein_obj_t* self);
 extern void common_hal_pulseio_pulsein_resume(pulseio_pulsein_obj_t* self, uint16_t trigger_duration);
 extern void common_hal_pulseio_pulsein_clear(pulseio_pulsein_obj_t* self);
 extern uint16_t common_hal_pulseio_pulsein_popleft(pulseio_pulsein_obj_t* self);
+extern uint16_t common_hal_pulseio_pulsein_readinto(pulseio_pulsein_obj_t* self, uint16_t* buffer, uint16_t len);
+extern uint32_t common_hal_pulseio_pulsein_get_dropped(pulseio_pulsein_obj_t* self);
 extern uint16_t common_hal_pulseio_pulsein_get_maxlen(pulseio_pulsein_obj_t* self);
 extern bool common_hal_pulseio_pulsein_get_paused(pulseio_pulsein_obj_t* self);
 extern uint16_t common_hal_pulseio_pulsein_get_len(pulseio_pulsein_obj_t* self);
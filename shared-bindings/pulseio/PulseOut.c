@@ -115,8 +115,10 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(pulseio_pulseout___exit___obj, 4, 4,
 //|         ``pulses`` must be an `array.array` with data type 'H' for unsigned
 //|         halfword (two bytes).
 //|
-//|         This method waits until the whole array of pulses has been sent and
-//|         ensures the signal is off afterwards.
+//|         The signal is off once the whole array of pulses has been sent. Where the
+//|         hardware can play the pulses by itself this returns as soon as they
+//|         start and `busy` tells when they are done. Otherwise it waits until
+//|         they have been sent. A send waits for the previous one to finish.
 //|
 //|         :param array.array pulses: pulse durations in microseconds"""
 //|         ...
@@ -137,12 +139,34 @@ STATIC mp_obj_t pulseio_pulseout_obj_send(mp_obj_t self_in, mp_obj_t pulses) {
 }
 MP_DEFINE_CONST_FUN_OBJ_2(pulseio_pulseout_send_obj, pulseio_pulseout_obj_send);
 
+//|     busy: bool = ...
+//|     """True while pulses from `send` are still being sent. (read-only)"""
+//|
+STATIC mp_obj_t pulseio_pulseout_obj_get_busy(mp_obj_t self_in) {
+    pulseio_pulseout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (common_hal_pulseio_pulseout_deinited(self)) {
+        raise_deinited_error();
+    }
+    return mp_obj_new_bool(common_hal_pulseio_pulseout_get_busy(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(pulseio_pulseout_get_busy_obj, pulseio_pulseout_obj_get_busy);
+
+const mp_obj_property_t pulseio_pulseout_busy_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&pulseio_pulseout_get_busy_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
 STATIC const mp_rom_map_elem_t pulseio_pulseout_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&pulseio_pulseout_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&pulseio_pulseout___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_send), MP_ROM_PTR(&pulseio_pulseout_send_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_busy), MP_ROM_PTR(&pulseio_pulseout_busy_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(pulseio_pulseout_locals_dict, pulseio_pulseout_locals_dict_table);
 
@@ -39,5 +39,7 @@ extern void common_hal_pulseio_pulseout_deinit(pulseio_pulseout_obj_t* self);
 extern bool common_hal_pulseio_pulseout_deinited(pulseio_pulseout_obj_t* self);
 extern void common_hal_pulseio_pulseout_send(pulseio_pulseout_obj_t* self,
     uint16_t* pulses, uint16_t len);
+// Ports that play pulses in hardware may return from send before they're done.
+extern bool common_hal_pulseio_pulseout_get_busy(pulseio_pulseout_obj_t* self);
 
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_PULSEIO_PULSEOUT_H
@@ -36,8 +36,8 @@
 //| """pseudo-random numbers and choices
 //|
 //| The `random` module is a strict subset of the CPython `cpython:random`
-//| module. So, code written in CircuitPython will work in CPython but not
-//| necessarily the other way around.
+//| module, apart from `fill`. So, code written in CircuitPython will work in
+//| CPython but not necessarily the other way around.
 //|
 //| Like its CPython cousin, CircuitPython's random seeds itself on first use
 //| with a true random from os.urandom() when available or the uptime otherwise.
@@ -164,6 +164,23 @@ STATIC mp_obj_t random_uniform(mp_obj_t a_in, mp_obj_t b_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(random_uniform_obj, random_uniform);
 
+//| def fill(buffer: WriteableBuffer) -> None:
+//|     """Fills ``buffer`` with random bytes in one call, which is much faster
+//|     than assigning the elements one at a time. Every bit is random, so an
+//|     ``array`` of integers is filled with values over its whole range. Uses
+//|     the xoshiro128** generator, seeded along with the others by `seed`.
+//|
+//|     This is a CircuitPython extension and is not in CPython."""
+//|     ...
+//|
+STATIC mp_obj_t random_fill(mp_obj_t buf_in) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_WRITE);
+    shared_modules_random_fill(bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(random_fill_obj, random_fill);
+
 STATIC const mp_rom_map_elem_t mp_module_random_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_random) },
     { MP_ROM_QSTR(MP_QSTR_seed), MP_ROM_PTR(&random_seed_obj) },
@@ -173,6 +190,7 @@ STATIC const mp_rom_map_elem_t mp_module_random_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_choice), MP_ROM_PTR(&random_choice_obj) },
     { MP_ROM_QSTR(MP_QSTR_random), MP_ROM_PTR(&random_random_obj) },
     { MP_ROM_QSTR(MP_QSTR_uniform), MP_ROM_PTR(&random_uniform_obj) },
+    { MP_ROM_QSTR(MP_QSTR_fill), MP_ROM_PTR(&random_fill_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_random_globals, mp_module_random_globals_table);
@@ -66,6 +66,7 @@ STATIC mp_obj_t socket_make_new(const mp_obj_type_t *type, size_t n_args, const
     s->u_param.domain = MOD_NETWORK_AF_INET;
     s->u_param.type = MOD_NETWORK_SOCK_STREAM;
     s->u_param.fileno = -1;
+    s->timeout = -1;
     if (n_args >= 1) {
         s->u_param.domain = mp_obj_get_int(args[0]);
         if (n_args >= 2) {
@@ -90,6 +91,10 @@ STATIC void socket_select_nic(mod_network_socket_obj_t *self, const byte *ip) {
         if (self->nic_type->socket(self, &_errno) != 0) {
             mp_raise_OSError(_errno);
         }
+        if (self->timeout != (mp_uint_t)-1
+            && self->nic_type->settimeout(self, self->timeout, &_errno) != 0) {
+            mp_raise_OSError(_errno);
+        }
     }
 }
 
@@ -160,6 +165,7 @@ STATIC mp_obj_t socket_accept(mp_obj_t self_in) {
     socket2->base.type = &socket_type;
     socket2->nic = MP_OBJ_NULL;
     socket2->nic_type = NULL;
+    socket2->timeout = -1;
 
     // accept incoming connection
     uint8_t ip[MOD_NETWORK_IPADDR_BUF_SIZE];
@@ -234,6 +240,40 @@ STATIC mp_obj_t socket_send(mp_obj_t self_in, mp_obj_t buf_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(socket_send_obj, socket_send);
 
+//|     def sendall(self, bytes: bytes) -> Any:
+//|         """Send all of the given bytes to the connected remote address,
+//|         calling send until everything has been sent. Any object with the
+//|         buffer protocol, such as a memoryview slice, is sent without being
+//|         copied.
+//|         Suits sockets of type SOCK_STREAM
+//|
+//|         :param ~bytes bytes: some bytes to send"""
+//|         ...
+//|
+
+STATIC mp_obj_t socket_sendall(mp_obj_t self_in, mp_obj_t buf_in) {
+    mod_network_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->nic == MP_OBJ_NULL) {
+        // not connected
+        mp_raise_OSError(MP_EPIPE);
+    }
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_READ);
+    const byte *buf = bufinfo.buf;
+    mp_uint_t len = bufinfo.len;
+    while (len > 0) {
+        int _errno;
+        mp_int_t ret = self->nic_type->send(self, buf, len, &_errno);
+        if (ret == -1) {
+            mp_raise_OSError(_errno);
+        }
+        buf += ret;
+        len -= ret;
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(socket_sendall_obj, socket_sendall);
+
 
 // helper function for socket_recv and socket_recv_into to handle common operations of both
 STATIC mp_int_t _socket_recv_into(mod_network_socket_obj_t *sock, byte *buf, mp_int_t len) {
@@ -250,8 +290,8 @@ STATIC mp_int_t _socket_recv_into(mod_network_socket_obj_t *sock, byte *buf, mp_
 //|         """Reads some bytes from the connected remote address, writing
 //|         into the provided buffer. If bufsize <= len(buffer) is given,
 //|         a maximum of bufsize bytes will be read into the buffer. If no
-//|         valid value is given for bufsize, the default is the length of
-//|         the given buffer.
+//|         valid value is given for bufsize, or it is 0, the default is the
+//|         length of the given buffer.
 //|
 //|         Suits sockets of type SOCK_STREAM
 //|         Returns an int of number of bytes read.
@@ -272,7 +312,7 @@ STATIC mp_obj_t socket_recv_into(size_t n_args, const mp_obj_t *args) {
     mp_int_t len = bufinfo.len;
     if (n_args == 3) {
         mp_int_t given_len = mp_obj_get_int(args[2]);
-        if (given_len < len) {
+        if (given_len > 0 && given_len < len) {
             len = given_len;
         }
     }
@@ -425,10 +465,6 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(socket_setsockopt_obj, 4, 4, socket_s
 
 STATIC mp_obj_t socket_settimeout(mp_obj_t self_in, mp_obj_t timeout_in) {
     mod_network_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
-    if (self->nic == MP_OBJ_NULL) {
-        // not connected
-        mp_raise_OSError(MP_ENOTCONN);
-    }
     mp_uint_t timeout;
     if (timeout_in == mp_const_none) {
         timeout = -1;
@@ -439,6 +475,11 @@ STATIC mp_obj_t socket_settimeout(mp_obj_t self_in, mp_obj_t timeout_in) {
         timeout = 1000 * mp_obj_get_int(timeout_in);
         #endif
     }
+    self->timeout = timeout;
+    if (self->nic == MP_OBJ_NULL) {
+        // not bound to a NIC yet, the timeout is applied when it is
+        return mp_const_none;
+    }
     int _errno;
     if (self->nic_type->settimeout(self, timeout, &_errno) != 0) {
         mp_raise_OSError(_errno);
@@ -472,6 +513,7 @@ STATIC const mp_rom_map_elem_t socket_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_accept), MP_ROM_PTR(&socket_accept_obj) },
     { MP_ROM_QSTR(MP_QSTR_connect), MP_ROM_PTR(&socket_connect_obj) },
     { MP_ROM_QSTR(MP_QSTR_send), MP_ROM_PTR(&socket_send_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sendall), MP_ROM_PTR(&socket_sendall_obj) },
     { MP_ROM_QSTR(MP_QSTR_recv), MP_ROM_PTR(&socket_recv_obj) },
     { MP_ROM_QSTR(MP_QSTR_sendto), MP_ROM_PTR(&socket_sendto_obj) },
     { MP_ROM_QSTR(MP_QSTR_recvfrom), MP_ROM_PTR(&socket_recvfrom_obj) },
@@ -479,10 +521,41 @@ STATIC const mp_rom_map_elem_t socket_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_setsockopt), MP_ROM_PTR(&socket_setsockopt_obj) },
     { MP_ROM_QSTR(MP_QSTR_settimeout), MP_ROM_PTR(&socket_settimeout_obj) },
     { MP_ROM_QSTR(MP_QSTR_setblocking), MP_ROM_PTR(&socket_setblocking_obj) },
+
+    { MP_ROM_QSTR(MP_QSTR_read), MP_ROM_PTR(&mp_stream_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&mp_stream_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readline), MP_ROM_PTR(&mp_stream_unbuffered_readline_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&mp_stream_write_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(socket_locals_dict, socket_locals_dict_table);
 
+STATIC mp_uint_t socket_read(mp_obj_t self_in, void *buf, mp_uint_t size, int *errcode) {
+    mod_network_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->nic == MP_OBJ_NULL) {
+        *errcode = MP_ENOTCONN;
+        return MP_STREAM_ERROR;
+    }
+    mp_int_t ret = self->nic_type->recv(self, buf, size, errcode);
+    if (ret == -1) {
+        return MP_STREAM_ERROR;
+    }
+    return ret;
+}
+
+STATIC mp_uint_t socket_write(mp_obj_t self_in, const void *buf, mp_uint_t size, int *errcode) {
+    mod_network_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->nic == MP_OBJ_NULL) {
+        *errcode = MP_EPIPE;
+        return MP_STREAM_ERROR;
+    }
+    mp_int_t ret = self->nic_type->send(self, buf, size, errcode);
+    if (ret == -1) {
+        return MP_STREAM_ERROR;
+    }
+    return ret;
+}
+
 mp_uint_t socket_ioctl(mp_obj_t self_in, mp_uint_t request, uintptr_t arg, int *errcode) {
     mod_network_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
     if (request == MP_STREAM_CLOSE) {
@@ -497,6 +570,8 @@ mp_uint_t socket_ioctl(mp_obj_t self_in, mp_uint_t request, uintptr_t arg, int *
 
 STATIC const mp_stream_p_t socket_stream_p = {
     MP_PROTO_IMPLEMENT(MP_QSTR_protocol_stream)
+    .read = socket_read,
+    .write = socket_write,
     .ioctl = socket_ioctl,
     .is_text = false,
 };
@@ -217,6 +217,42 @@ STATIC const mp_rom_map_elem_t storage_module_globals_table[] = {
 //|         ...
 //|
     { MP_ROM_QSTR(MP_QSTR_VfsFat), MP_ROM_PTR(&mp_fat_vfs_type) },
+
+//| class RAMBlockDevice:
+//|     def __init__(self, block_count: int, block_size: int = 512):
+//|         """Create a block device held in RAM, for scratch files that don't
+//|         need to survive a reset. Format it with `VfsFat` and
+//|         mount it to keep frequently rewritten temporary files off the flash.
+//|
+//|         The memory comes from the heap, so it lives in PSRAM on boards that
+//|         put the heap there, and is freed once the device is unmounted and
+//|         no longer referenced.
+//|
+//|         .. code-block:: python
+//|
+//|           import storage
+//|           dev = storage.RAMBlockDevice(64)
+//|           storage.VfsFat.mkfs(dev)
+//|           storage.mount(storage.VfsFat(dev), "/tmp")
+//|
+//|         :param int block_count: Number of blocks
+//|         :param int block_size: Bytes per block, a power of two of at least 128"""
+//|
+//|     def readblocks(self, block_num: int, buf: WriteableBuffer, offset: int = 0) -> None:
+//|         """Read ``len(buf)`` bytes starting ``offset`` bytes into ``block_num``"""
+//|         ...
+//|
+//|     def writeblocks(self, block_num: int, buf: ReadableBuffer, offset: int = 0) -> None:
+//|         """Write ``buf`` starting ``offset`` bytes into ``block_num``"""
+//|         ...
+//|
+//|     def ioctl(self, op: int, arg: int) -> Optional[int]:
+//|         """Block device control, as used by the filesystems"""
+//|         ...
+//|
+    #if MICROPY_VFS_RAMBLOCKDEV
+    { MP_ROM_QSTR(MP_QSTR_RAMBlockDevice), MP_ROM_PTR(&mp_type_vfs_ramblockdev) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(storage_module_globals, storage_module_globals_table);
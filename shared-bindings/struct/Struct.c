@@ -0,0 +1,256 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/objlist.h"
+#include "py/objproperty.h"
+#include "py/objtuple.h"
+#include "py/runtime.h"
+#include "shared-bindings/struct/Struct.h"
+#include "supervisor/shared/translate.h"
+
+//| class Struct:
+//|     """A compiled struct format
+//|
+//|     The format string is parsed once, when the Struct is made, so packing and
+//|     unpacking many records with the same format is faster than calling the
+//|     module-level functions each time."""
+//|
+//|     def __init__(self, format: str):
+//|         """Compile ``format``, which is the same as for the module-level functions."""
+//|         ...
+//|
+
+STATIC mp_obj_t struct_struct_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
+    mp_arg_check_num(n_args, kw_args, 1, 1, false);
+    return MP_OBJ_FROM_PTR(shared_modules_struct_struct_construct(type, args[0]));
+}
+
+// Find where a struct starts in a buffer, given a possibly negative offset.
+STATIC byte *get_buffer(mp_obj_t buf_in, mp_int_t offset, mp_uint_t flags, byte **end_p) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, flags);
+    if (offset < 0) {
+        // negative offsets are relative to the end of the buffer
+        offset = (mp_int_t)bufinfo.len + offset;
+        if (offset < 0) {
+            mp_raise_RuntimeError(translate("buffer too small"));
+        }
+    }
+    *end_p = (byte*)bufinfo.buf + bufinfo.len;
+    return (byte*)bufinfo.buf + offset;
+}
+
+//|     def pack(self, *values: Any) -> bytes:
+//|         """Pack the values according to the format.
+//|         The return value is a bytes object encoding the values."""
+//|         ...
+//|
+
+STATIC mp_obj_t struct_struct_pack(size_t n_args, const mp_obj_t *args) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    vstr_t vstr;
+    vstr_init_len(&vstr, self->size);
+    byte *p = (byte*)vstr.buf;
+    memset(p, 0, self->size);
+    shared_modules_struct_struct_pack_into(self, p, p + self->size, n_args - 1, &args[1]);
+    return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_struct_pack_obj, 1, MP_OBJ_FUN_ARGS_MAX, struct_struct_pack);
+
+//|     def pack_into(self, buffer: WriteableBuffer, offset: int, *values: Any) -> None:
+//|         """Pack the values according to the format into a buffer
+//|         starting at offset. offset may be negative to count from the end of buffer."""
+//|         ...
+//|
+
+STATIC mp_obj_t struct_struct_pack_into(size_t n_args, const mp_obj_t *args) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    byte *end_p;
+    byte *p = get_buffer(args[1], mp_obj_get_int(args[2]), MP_BUFFER_WRITE, &end_p);
+    shared_modules_struct_struct_pack_into(self, p, end_p, n_args - 3, &args[3]);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_struct_pack_into_obj, 3, MP_OBJ_FUN_ARGS_MAX, struct_struct_pack_into);
+
+//|     def unpack(self, data: ReadableBuffer) -> tuple:
+//|         """Unpack from the data according to the format. The return value
+//|         is a tuple of the unpacked values. The buffer size must match `size`."""
+//|         ...
+//|
+
+STATIC mp_obj_t struct_struct_unpack(mp_obj_t self_in, mp_obj_t data) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    byte *end_p;
+    byte *p = get_buffer(data, 0, MP_BUFFER_READ, &end_p);
+    mp_obj_tuple_t *res = MP_OBJ_TO_PTR(mp_obj_new_tuple(self->num_items, NULL));
+    // true means check the size must be exactly right.
+    shared_modules_struct_struct_unpack_into(self, p, end_p, true, res->items);
+    return MP_OBJ_FROM_PTR(res);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(struct_struct_unpack_obj, struct_struct_unpack);
+
+//|     def unpack_from(self, data: ReadableBuffer, offset: int = 0, *, out: Optional[list] = None) -> Any:
+//|         """Unpack from the data starting at offset according to the format.
+//|         offset may be negative to count from the end of buffer. The buffer
+//|         must be at least `size` bytes long from offset.
+//|
+//|         The return value is a tuple of the unpacked values. If ``out`` is
+//|         given, it must be a list with one element per value; the values are
+//|         stored in it instead and ``out`` is returned, so nothing needs to be
+//|         allocated for the result."""
+//|         ...
+//|
+
+STATIC mp_obj_t struct_struct_unpack_from(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_offset, ARG_out };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_offset, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    byte *end_p;
+    byte *p = get_buffer(args[ARG_buffer].u_obj, args[ARG_offset].u_int, MP_BUFFER_READ, &end_p);
+    mp_obj_t out = args[ARG_out].u_obj;
+    mp_obj_t *items;
+    if (out == mp_const_none) {
+        out = mp_obj_new_tuple(self->num_items, NULL);
+        items = ((mp_obj_tuple_t*)MP_OBJ_TO_PTR(out))->items;
+    } else {
+        if (!MP_OBJ_IS_TYPE(out, &mp_type_list)) {
+            mp_raise_TypeError_varg(translate("Expected a %q"), MP_QSTR_list);
+        }
+        size_t len;
+        mp_obj_list_get(out, &len, &items);
+        if (len != self->num_items) {
+            mp_raise_ValueError_varg(translate("requested length %d but object has length %d"), self->num_items, len);
+        }
+    }
+    // false means the size doesn't have to be exact. unpack_from() only requires
+    // that be buffer be big enough.
+    shared_modules_struct_struct_unpack_into(self, p, end_p, false, items);
+    return out;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(struct_struct_unpack_from_obj, 2, struct_struct_unpack_from);
+
+//|     def iter_unpack(self, data: ReadableBuffer) -> Iterator[tuple]:
+//|         """Unpack consecutive records from the data, returning an iterator that
+//|         yields a tuple for each. The buffer size must be a multiple of `size`."""
+//|         ...
+//|
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_fun_1_t iternext;
+    struct_struct_obj_t *self;
+    mp_obj_t data;
+    mp_uint_t offset;
+} struct_struct_iter_t;
+
+STATIC mp_obj_t struct_struct_iter_iternext(mp_obj_t self_in) {
+    struct_struct_iter_t *iter = MP_OBJ_TO_PTR(self_in);
+    byte *end_p;
+    byte *p = get_buffer(iter->data, iter->offset, MP_BUFFER_READ, &end_p);
+    if (p + iter->self->size > end_p) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+    mp_obj_tuple_t *res = MP_OBJ_TO_PTR(mp_obj_new_tuple(iter->self->num_items, NULL));
+    shared_modules_struct_struct_unpack_into(iter->self, p, end_p, false, res->items);
+    iter->offset += iter->self->size;
+    return MP_OBJ_FROM_PTR(res);
+}
+
+STATIC mp_obj_t struct_struct_iter_unpack(mp_obj_t self_in, mp_obj_t data) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    if (self->size == 0 || bufinfo.len % self->size != 0) {
+        mp_raise_RuntimeError(translate("buffer size must match format"));
+    }
+    struct_struct_iter_t *iter = m_new_obj(struct_struct_iter_t);
+    iter->base.type = &mp_type_polymorph_iter;
+    iter->iternext = struct_struct_iter_iternext;
+    iter->self = self;
+    iter->data = data;
+    iter->offset = 0;
+    return MP_OBJ_FROM_PTR(iter);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(struct_struct_iter_unpack_obj, struct_struct_iter_unpack);
+
+//|     format: str
+//|     """The format string this Struct was made from."""
+//|
+STATIC mp_obj_t struct_struct_get_format(mp_obj_t self_in) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return self->format;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(struct_struct_get_format_obj, struct_struct_get_format);
+
+const mp_obj_property_t struct_struct_format_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&struct_struct_get_format_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     size: int
+//|     """The number of bytes a packed record takes, as `calcsize` gives."""
+//|
+STATIC mp_obj_t struct_struct_get_size(mp_obj_t self_in) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(self->size);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(struct_struct_get_size_obj, struct_struct_get_size);
+
+const mp_obj_property_t struct_struct_size_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&struct_struct_get_size_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+STATIC const mp_rom_map_elem_t struct_struct_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_pack), MP_ROM_PTR(&struct_struct_pack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pack_into), MP_ROM_PTR(&struct_struct_pack_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack), MP_ROM_PTR(&struct_struct_unpack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack_from), MP_ROM_PTR(&struct_struct_unpack_from_obj) },
+    { MP_ROM_QSTR(MP_QSTR_iter_unpack), MP_ROM_PTR(&struct_struct_iter_unpack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_format), MP_ROM_PTR(&struct_struct_format_obj) },
+    { MP_ROM_QSTR(MP_QSTR_size), MP_ROM_PTR(&struct_struct_size_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(struct_struct_locals_dict, struct_struct_locals_dict_table);
+
+const mp_obj_type_t struct_struct_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Struct,
+    .make_new = struct_struct_make_new,
+    .locals_dict = (mp_obj_dict_t*)&struct_struct_locals_dict,
+};
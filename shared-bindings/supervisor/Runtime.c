@@ -26,7 +26,13 @@
 
 #include <stdbool.h>
 #include "py/objproperty.h"
+#include "py/runtime.h"
 #include "shared-bindings/supervisor/Runtime.h"
+#include "supervisor/serial.h"
+
+#if CIRCUITPY_DISPLAYIO
+#include "supervisor/shared/display.h"
+#endif
 
 //TODO: add USB, REPL to description once they're operational
 //| class Runtime:
@@ -96,9 +102,84 @@ const mp_obj_property_t supervisor_serial_bytes_available_obj = {
 };
 
 
+#ifdef USB_AVAILABLE
+//|     serial_write_blocking: bool = ...
+//|     """When ``True``, the default, output to USB serial waits for the host to
+//|     read it. When ``False``, output that doesn't fit in the transmit buffer is
+//|     dropped so heavy logging doesn't slow down the code. Set back to ``True``
+//|     when the code finishes."""
+//|
+STATIC mp_obj_t supervisor_get_serial_write_blocking(mp_obj_t self) {
+    return mp_obj_new_bool(serial_get_write_blocking());
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_get_serial_write_blocking_obj, supervisor_get_serial_write_blocking);
+
+STATIC mp_obj_t supervisor_set_serial_write_blocking(mp_obj_t self, mp_obj_t blocking) {
+    serial_set_write_blocking(mp_obj_is_true(blocking));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(supervisor_set_serial_write_blocking_obj, supervisor_set_serial_write_blocking);
+
+const mp_obj_property_t supervisor_serial_write_blocking_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&supervisor_get_serial_write_blocking_obj,
+              (mp_obj_t)&supervisor_set_serial_write_blocking_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     serial_bytes_dropped: int = ...
+//|     """The number of bytes of USB serial output dropped because
+//|     `serial_write_blocking` was ``False`` (read-only)"""
+//|
+STATIC mp_obj_t supervisor_get_serial_bytes_dropped(mp_obj_t self) {
+    return mp_obj_new_int_from_uint(serial_get_bytes_dropped());
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_get_serial_bytes_dropped_obj, supervisor_get_serial_bytes_dropped);
+
+const mp_obj_property_t supervisor_serial_bytes_dropped_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&supervisor_get_serial_bytes_dropped_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+#endif
+
+#if CIRCUITPY_DISPLAYIO
+//|     terminal_while_serial_connected: bool = ...
+//|     """When ``True``, the default, console output is also drawn on the board's display. When
+//|     ``False``, it isn't while USB serial is connected, so printing a lot doesn't slow down the
+//|     code to redraw the display. Either way it is drawn at most ten times a second. Set back to
+//|     ``True`` when the code finishes."""
+//|
+STATIC mp_obj_t supervisor_get_terminal_while_serial_connected(mp_obj_t self) {
+    return mp_obj_new_bool(supervisor_terminal_get_while_serial_connected());
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_get_terminal_while_serial_connected_obj, supervisor_get_terminal_while_serial_connected);
+
+STATIC mp_obj_t supervisor_set_terminal_while_serial_connected(mp_obj_t self, mp_obj_t enabled) {
+    supervisor_terminal_set_while_serial_connected(mp_obj_is_true(enabled));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(supervisor_set_terminal_while_serial_connected_obj, supervisor_set_terminal_while_serial_connected);
+
+const mp_obj_property_t supervisor_terminal_while_serial_connected_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&supervisor_get_terminal_while_serial_connected_obj,
+              (mp_obj_t)&supervisor_set_terminal_while_serial_connected_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+#endif
+
 STATIC const mp_rom_map_elem_t supervisor_runtime_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_serial_connected), MP_ROM_PTR(&supervisor_serial_connected_obj) },
     { MP_ROM_QSTR(MP_QSTR_serial_bytes_available), MP_ROM_PTR(&supervisor_serial_bytes_available_obj) },
+    #ifdef USB_AVAILABLE
+    { MP_ROM_QSTR(MP_QSTR_serial_write_blocking), MP_ROM_PTR(&supervisor_serial_write_blocking_obj) },
+    { MP_ROM_QSTR(MP_QSTR_serial_bytes_dropped), MP_ROM_PTR(&supervisor_serial_bytes_dropped_obj) },
+    #endif
+    #if CIRCUITPY_DISPLAYIO
+    { MP_ROM_QSTR(MP_QSTR_terminal_while_serial_connected), MP_ROM_PTR(&supervisor_terminal_while_serial_connected_obj) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(supervisor_runtime_locals_dict, supervisor_runtime_locals_dict_table);
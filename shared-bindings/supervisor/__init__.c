@@ -29,6 +29,7 @@
 
 #include "lib/utils/interrupt_char.h"
 #include "supervisor/shared/autoreload.h"
+#include "supervisor/shared/perf.h"
 #include "supervisor/shared/rgb_led_status.h"
 #include "supervisor/shared/stack.h"
 #include "supervisor/shared/translate.h"
@@ -109,6 +110,65 @@ STATIC mp_obj_t supervisor_set_next_stack_limit(mp_obj_t size_obj) {
 }
 MP_DEFINE_CONST_FUN_OBJ_1(supervisor_set_next_stack_limit_obj, supervisor_set_next_stack_limit);
 
+#if CIRCUITPY_PERF_COUNTERS
+// Indexed by counter, see supervisor/shared/perf.h.
+STATIC const qstr perf_counter_names[PERF_COUNTER_COUNT] = {
+    [BACKGROUND_TASK_PRIORITY_AUDIO] = MP_QSTR_audio,
+    [BACKGROUND_TASK_PRIORITY_USB] = MP_QSTR_usb,
+    [BACKGROUND_TASK_PRIORITY_I2CSLAVE] = MP_QSTR_i2cslave,
+    [BACKGROUND_TASK_PRIORITY_BLE] = MP_QSTR_ble,
+    [BACKGROUND_TASK_PRIORITY_NETWORK] = MP_QSTR_network,
+    [BACKGROUND_TASK_PRIORITY_FILESYSTEM] = MP_QSTR_filesystem,
+    [BACKGROUND_TASK_PRIORITY_DISPLAY] = MP_QSTR_display,
+    [BACKGROUND_TASK_PRIORITY_TOUCH] = MP_QSTR_touch,
+    [BACKGROUND_TASK_PRIORITY_PROFILER] = MP_QSTR_profiler,
+    [PERF_COUNTER_BACKGROUND] = MP_QSTR_background,
+    [PERF_COUNTER_GC] = MP_QSTR_gc,
+};
+
+//| def perf_counters(self) -> dict:
+//|     """Return the CPU cycles spent in each subsystem since the last
+//|     `reset_perf_counters`, as a dict mapping a name to a tuple of
+//|     ``(count, min, avg, max)``. The durations are in cycles, so divide by
+//|     `microcontroller.Processor.frequency` for seconds.
+//|
+//|     ``background`` covers whole background passes and ``gc`` whole garbage
+//|     collections. The others, such as ``usb``, ``audio`` and ``display``, add
+//|     up the background tasks of that subsystem. Subsystems that haven't run
+//|     are left out. The counts survive reloads."""
+//|     ...
+//|
+STATIC mp_obj_t supervisor_perf_counters(void) {
+    mp_obj_t dict = mp_obj_new_dict(0);
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+        const perf_counter_t *c = perf_get(i);
+        if (c->count == 0) {
+            continue;
+        }
+        mp_obj_t items[4] = {
+            mp_obj_new_int_from_uint(c->count),
+            mp_obj_new_int_from_uint(c->min),
+            // The average is no more than the max, so it fits.
+            mp_obj_new_int_from_uint((uint32_t)(c->total / c->count)),
+            mp_obj_new_int_from_uint(c->max),
+        };
+        mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(perf_counter_names[i]), mp_obj_new_tuple(4, items));
+    }
+    return dict;
+}
+MP_DEFINE_CONST_FUN_OBJ_0(supervisor_perf_counters_obj, supervisor_perf_counters);
+
+//| def reset_perf_counters(self) -> None:
+//|     """Clear the counters returned by `perf_counters`."""
+//|     ...
+//|
+STATIC mp_obj_t supervisor_reset_perf_counters(void) {
+    perf_reset();
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_0(supervisor_reset_perf_counters_obj, supervisor_reset_perf_counters);
+#endif
+
 STATIC const mp_rom_map_elem_t supervisor_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_supervisor) },
     { MP_OBJ_NEW_QSTR(MP_QSTR_enable_autoreload),  MP_ROM_PTR(&supervisor_enable_autoreload_obj) },
@@ -117,6 +177,10 @@ STATIC const mp_rom_map_elem_t supervisor_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_runtime),  MP_ROM_PTR(&common_hal_supervisor_runtime_obj) },
     { MP_ROM_QSTR(MP_QSTR_reload),  MP_ROM_PTR(&supervisor_reload_obj) },
     { MP_ROM_QSTR(MP_QSTR_set_next_stack_limit),  MP_ROM_PTR(&supervisor_set_next_stack_limit_obj) },
+    #if CIRCUITPY_PERF_COUNTERS
+    { MP_ROM_QSTR(MP_QSTR_perf_counters),  MP_ROM_PTR(&supervisor_perf_counters_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reset_perf_counters),  MP_ROM_PTR(&supervisor_reset_perf_counters_obj) },
+    #endif
 
 };
 
@@ -111,7 +111,8 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(touchio_touchin___exit___obj, 4, 4, t
 //|     value: Any = ...
 //|     """Whether the touch pad is being touched or not. (read-only)
 //|
-//|     True when `raw_value` > `threshold`."""
+//|     True when `raw_value` > `threshold`. Ports that scan pads in the background
+//|     compare a smoothed `raw_value`, so a single noisy measurement doesn't count."""
 //|
 STATIC mp_obj_t touchio_touchin_obj_get_value(mp_obj_t self_in) {
     touchio_touchin_obj_t *self = MP_OBJ_TO_PTR(self_in);
@@ -153,7 +154,10 @@ const mp_obj_property_t touchio_touchin_raw_value_obj = {
 //|     When the **TouchIn** object is created, an initial `raw_value` is read from the pin,
 //|     and then `threshold` is set to be 100 + that value.
 //|
-//|     You can adjust `threshold` to make the pin more or less sensitive."""
+//|     You can adjust `threshold` to make the pin more or less sensitive.
+//|
+//|     Ports that scan pads in the background track the untouched reading as it
+//|     drifts, keeping `threshold` the same distance above it."""
 //|
 STATIC mp_obj_t touchio_touchin_obj_get_threshold(mp_obj_t self_in) {
     touchio_touchin_obj_t *self = MP_OBJ_TO_PTR(self_in);
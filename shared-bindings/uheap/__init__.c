@@ -46,9 +46,53 @@ STATIC mp_obj_t uheap_info(mp_obj_t obj) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(uheap_info_obj, uheap_info);
 
+#if MICROPY_GC_ALLOC_PROFILE
+//| def profile_enable(enabled: bool) -> None:
+//|     """Starts or stops recording every heap allocation against the function
+//|     and line number that made it."""
+//|     ...
+//|
+STATIC mp_obj_t uheap_profile_enable(mp_obj_t enabled) {
+    shared_module_uheap_profile_enable(mp_obj_is_true(enabled));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(uheap_profile_enable_obj, uheap_profile_enable);
+
+//| def profile(n: int = 8) -> list:
+//|     """Returns the n call sites that have allocated the most bytes since
+//|     profiling was enabled or reset, largest first, as a list of
+//|     ``(function, file, line, count, bytes)`` tuples. ``function`` and ``file``
+//|     are ``None`` for allocations made outside of Python code."""
+//|     ...
+//|
+STATIC mp_obj_t uheap_profile(size_t n_args, const mp_obj_t *args) {
+    mp_int_t n = 8;
+    if (n_args > 0) {
+        n = mp_obj_get_int(args[0]);
+    }
+    return shared_module_uheap_profile(MAX(n, 0));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(uheap_profile_obj, 0, 1, uheap_profile);
+
+//| def profile_reset() -> None:
+//|     """Clears the allocations recorded so far."""
+//|     ...
+//|
+STATIC mp_obj_t uheap_profile_reset(void) {
+    shared_module_uheap_profile_reset();
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(uheap_profile_reset_obj, uheap_profile_reset);
+#endif
+
 STATIC const mp_rom_map_elem_t uheap_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_uheap) },
     { MP_ROM_QSTR(MP_QSTR_info), MP_ROM_PTR(&uheap_info_obj) },
+    #if MICROPY_GC_ALLOC_PROFILE
+    { MP_ROM_QSTR(MP_QSTR_profile), MP_ROM_PTR(&uheap_profile_obj) },
+    { MP_ROM_QSTR(MP_QSTR_profile_enable), MP_ROM_PTR(&uheap_profile_enable_obj) },
+    { MP_ROM_QSTR(MP_QSTR_profile_reset), MP_ROM_PTR(&uheap_profile_reset_obj) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(uheap_module_globals, uheap_module_globals_table);
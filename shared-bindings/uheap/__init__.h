@@ -31,4 +31,10 @@
 
 extern uint32_t shared_module_uheap_info(mp_obj_t obj);
 
+#if MICROPY_GC_ALLOC_PROFILE
+extern void shared_module_uheap_profile_enable(bool enabled);
+extern mp_obj_t shared_module_uheap_profile(size_t n);
+extern void shared_module_uheap_profile_reset(void);
+#endif
+
 #endif  // MICROPY_INCLUDED_SHARED_BINDINGS_UHEAP___INIT___H
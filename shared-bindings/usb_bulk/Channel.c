@@ -0,0 +1,177 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+
+#include "shared-bindings/usb_bulk/Channel.h"
+#include "shared-bindings/util.h"
+
+#include "py/ioctl.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+#include "supervisor/shared/translate.h"
+
+//| class Channel:
+//|     """Sends and receives raw bytes over a USB bulk endpoint pair
+//|
+//|     Reads and writes never block waiting for the host. read() returns only
+//|     the bytes that have already arrived (or None if there are none) and
+//|     write() returns None when the host has not opened the interface."""
+//|
+//|     def __init__(self):
+//|         """You cannot create an instance of `usb_bulk.Channel`.
+//|
+//|         Use `usb_bulk.channel` instead."""
+//|         ...
+//|
+
+// These are standard stream methods. Code is in py/stream.c.
+//
+//|     def read(self, nbytes: Any = None) -> Any:
+//|         """Read at most nbytes bytes, or everything that is waiting if nbytes
+//|         is not given.
+//|
+//|         :return: Data read
+//|         :rtype: bytes or None"""
+//|         ...
+//|
+//|     def readinto(self, buf: Any, nbytes: Any = None) -> Any:
+//|         """Read bytes into the buf.  If nbytes is specified then read at most
+//|         that many bytes.  Otherwise, read at most len(buf) bytes.
+//|
+//|         :return: number of bytes read and stored into buf
+//|         :rtype: int or None"""
+//|         ...
+//|
+//|     def write(self, buf: Any) -> Any:
+//|         """Write the buffer of bytes to the host. Large buffers are streamed out
+//|         as the host accepts packets, so pass as much as you have at once.
+//|
+//|         :return: the number of bytes written
+//|         :rtype: int or None"""
+//|         ...
+//|
+
+// These three methods are used by the shared stream methods.
+STATIC mp_uint_t usb_bulk_channel_read(mp_obj_t self_in, void *buf_in, mp_uint_t size, int *errcode) {
+    usb_bulk_channel_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    byte *buf = buf_in;
+
+    // make sure we want at least 1 char
+    if (size == 0) {
+        return 0;
+    }
+
+    return common_hal_usb_bulk_channel_read(self, buf, size, errcode);
+}
+
+STATIC mp_uint_t usb_bulk_channel_write(mp_obj_t self_in, const void *buf_in, mp_uint_t size, int *errcode) {
+    usb_bulk_channel_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    const byte *buf = buf_in;
+
+    return common_hal_usb_bulk_channel_write(self, buf, size, errcode);
+}
+
+STATIC mp_uint_t usb_bulk_channel_ioctl(mp_obj_t self_in, mp_uint_t request, mp_uint_t arg, int *errcode) {
+    usb_bulk_channel_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_uint_t ret;
+    if (request == MP_IOCTL_POLL) {
+        mp_uint_t flags = arg;
+        ret = 0;
+        if ((flags & MP_IOCTL_POLL_RD) && common_hal_usb_bulk_channel_get_in_waiting(self) > 0) {
+            ret |= MP_IOCTL_POLL_RD;
+        }
+        if ((flags & MP_IOCTL_POLL_WR) && common_hal_usb_bulk_channel_ready_to_tx(self)) {
+            ret |= MP_IOCTL_POLL_WR;
+        }
+    } else {
+        *errcode = MP_EINVAL;
+        ret = MP_STREAM_ERROR;
+    }
+    return ret;
+}
+
+//|     in_waiting: int = ...
+//|     """The number of bytes received from the host and not yet read. (read-only)"""
+//|
+STATIC mp_obj_t usb_bulk_channel_obj_get_in_waiting(mp_obj_t self_in) {
+    usb_bulk_channel_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_usb_bulk_channel_get_in_waiting(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_bulk_channel_get_in_waiting_obj, usb_bulk_channel_obj_get_in_waiting);
+
+const mp_obj_property_t usb_bulk_channel_in_waiting_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&usb_bulk_channel_get_in_waiting_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     connected: bool = ...
+//|     """True when the host has configured the USB device and the channel can carry data. (read-only)"""
+//|
+STATIC mp_obj_t usb_bulk_channel_obj_get_connected(mp_obj_t self_in) {
+    usb_bulk_channel_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_usb_bulk_channel_get_connected(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_bulk_channel_get_connected_obj, usb_bulk_channel_obj_get_connected);
+
+const mp_obj_property_t usb_bulk_channel_connected_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&usb_bulk_channel_get_connected_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+STATIC const mp_rom_map_elem_t usb_bulk_channel_locals_dict_table[] = {
+    // Standard stream methods.
+    { MP_OBJ_NEW_QSTR(MP_QSTR_read),     MP_ROM_PTR(&mp_stream_read_obj) },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&mp_stream_readinto_obj) },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_write),    MP_ROM_PTR(&mp_stream_write_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_in_waiting),   MP_ROM_PTR(&usb_bulk_channel_in_waiting_obj) },
+    { MP_ROM_QSTR(MP_QSTR_connected),    MP_ROM_PTR(&usb_bulk_channel_connected_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(usb_bulk_channel_locals_dict, usb_bulk_channel_locals_dict_table);
+
+STATIC const mp_stream_p_t usb_bulk_channel_stream_p = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_stream)
+    .read = usb_bulk_channel_read,
+    .write = usb_bulk_channel_write,
+    .ioctl = usb_bulk_channel_ioctl,
+    .is_text = false,
+};
+
+const mp_obj_type_t usb_bulk_channel_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Channel,
+    .getiter = mp_identity_getiter,
+    .iternext = mp_stream_unbuffered_iter,
+    .protocol = &usb_bulk_channel_stream_p,
+    .locals_dict = (mp_obj_dict_t*)&usb_bulk_channel_locals_dict,
+};
@@ -0,0 +1,57 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/usb_bulk/__init__.h"
+#include "shared-bindings/usb_bulk/Channel.h"
+
+//| """Raw bulk data channel over USB
+//|
+//| The `usb_bulk` module exposes a vendor-specific USB interface with one bulk
+//| endpoint in each direction. Unlike the serial console there is no line
+//| discipline and unlike `usb_midi` there is no packet framing, so it is suited to
+//| moving binary data such as sensor telemetry at close to full-speed USB rates.
+//| The host side talks to it with a generic driver such as libusb or WinUSB."""
+//|
+//| channel: Channel = ...
+//| """The `Channel` for the vendor interface in the USB descriptor."""
+//|
+STATIC const mp_rom_map_elem_t usb_bulk_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_usb_bulk) },
+    { MP_ROM_QSTR(MP_QSTR_channel),  MP_ROM_PTR(&usb_bulk_channel_obj) },
+    { MP_ROM_QSTR(MP_QSTR_Channel),  MP_ROM_PTR(&usb_bulk_channel_type) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(usb_bulk_module_globals, usb_bulk_module_globals_table);
+
+const mp_obj_module_t usb_bulk_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t*)&usb_bulk_module_globals,
+};
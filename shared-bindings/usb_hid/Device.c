@@ -44,7 +44,11 @@
 //|         ...
 //|
 //|     def send_report(self, buf: Any) -> Any:
-//|         """Send a HID report."""
+//|         """Send a HID report.
+//|
+//|         The report is queued and sent in the background as soon as the host
+//|         polls for it, so this only waits when the queue is full. It raises
+//|         `OSError` if no room frees up within two seconds."""
 //|         ...
 //|
 STATIC mp_obj_t usb_hid_device_send_report(mp_obj_t self_in, mp_obj_t buffer) {
@@ -58,6 +62,39 @@ STATIC mp_obj_t usb_hid_device_send_report(mp_obj_t self_in, mp_obj_t buffer) {
 }
 MP_DEFINE_CONST_FUN_OBJ_2(usb_hid_device_send_report_obj, usb_hid_device_send_report);
 
+//|     def queue_report(self, buf: Any) -> bool:
+//|         """Queue a HID report to be sent in the background without waiting.
+//|
+//|         Returns ``False`` and drops the report if the queue is full. Reports
+//|         from all the devices share one queue and are sent in order."""
+//|         ...
+//|
+STATIC mp_obj_t usb_hid_device_queue_report(mp_obj_t self_in, mp_obj_t buffer) {
+    usb_hid_device_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_READ);
+
+    return mp_obj_new_bool(common_hal_usb_hid_device_queue_report(self, ((uint8_t*) bufinfo.buf), bufinfo.len));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(usb_hid_device_queue_report_obj, usb_hid_device_queue_report);
+
+//|     reports_pending: int = ...
+//|     """The number of this device's reports that are queued but not yet sent. (read-only)"""
+//|
+STATIC mp_obj_t usb_hid_device_obj_get_reports_pending(mp_obj_t self_in) {
+    usb_hid_device_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_usb_hid_device_get_reports_pending(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_hid_device_get_reports_pending_obj, usb_hid_device_obj_get_reports_pending);
+
+const mp_obj_property_t usb_hid_device_reports_pending_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&usb_hid_device_get_reports_pending_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
 //|     usage_page: Any = ...
 //|     """The usage page of the device as an `int`. Can be thought of a category. (read-only)"""
 //|
@@ -96,6 +133,8 @@ const mp_obj_property_t usb_hid_device_usage_obj = {
 
 STATIC const mp_rom_map_elem_t usb_hid_device_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_send_report),    MP_ROM_PTR(&usb_hid_device_send_report_obj) },
+    { MP_ROM_QSTR(MP_QSTR_queue_report),   MP_ROM_PTR(&usb_hid_device_queue_report_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reports_pending), MP_ROM_PTR(&usb_hid_device_reports_pending_obj) },
     { MP_ROM_QSTR(MP_QSTR_usage_page),     MP_ROM_PTR(&usb_hid_device_usage_page_obj)},
     { MP_ROM_QSTR(MP_QSTR_usage),          MP_ROM_PTR(&usb_hid_device_usage_obj)},
 };
@@ -32,6 +32,8 @@
 const mp_obj_type_t usb_hid_device_type;
 
 void common_hal_usb_hid_device_send_report(usb_hid_device_obj_t *self, uint8_t* report, uint8_t len);
+bool common_hal_usb_hid_device_queue_report(usb_hid_device_obj_t *self, uint8_t* report, uint8_t len);
+size_t common_hal_usb_hid_device_get_reports_pending(usb_hid_device_obj_t *self);
 uint8_t common_hal_usb_hid_device_get_usage_page(usb_hid_device_obj_t *self);
 uint8_t common_hal_usb_hid_device_get_usage(usb_hid_device_obj_t *self);
 
@@ -30,6 +30,7 @@
 #include "shared-bindings/util.h"
 
 #include "py/ioctl.h"
+#include "py/objint.h"
 #include "py/objproperty.h"
 #include "py/runtime.h"
 #include "py/stream.h"
@@ -50,6 +51,9 @@
 //|     def write(self, buf: Any) -> Any:
 //|         """Write the buffer of bytes to the bus.
 //|
+//|         Bytes are held for up to a millisecond so that messages written
+//|         close together share a USB packet. Use `flush` to send them now.
+//|
 //|         :return: the number of bytes written
 //|         :rtype: int or None"""
 //|         ...
@@ -62,6 +66,41 @@ STATIC mp_uint_t usb_midi_portout_write(mp_obj_t self_in, const void *buf_in, mp
     return common_hal_usb_midi_portout_write(self, buf, size, errcode);
 }
 
+//|     def write_at(self, buf: Any, time_ns: int) -> bool:
+//|         """Send the buffer of bytes when `time.monotonic_ns()` reaches ``time_ns``.
+//|
+//|         Messages that come due together are sent in the same USB packet.
+//|         Writes are sent in the order they were made, so one whose time is
+//|         earlier than an already scheduled write goes out just after it.
+//|         ``buf`` may be at most 48 bytes long.
+//|
+//|         :return: ``False`` if the schedule is full and ``buf`` was dropped
+//|         :rtype: bool"""
+//|         ...
+//|
+STATIC mp_obj_t usb_midi_portout_write_at(mp_obj_t self_in, mp_obj_t buf_in, mp_obj_t time_in) {
+    usb_midi_portout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_READ);
+    // monotonic_ns() outgrows a small int within seconds.
+    uint64_t time_ns = 0;
+    if (MP_OBJ_IS_TYPE(time_in, &mp_type_int)) {
+        mp_obj_int_to_bytes_impl(time_in, false, sizeof(time_ns), (byte *)&time_ns);
+    } else {
+        mp_int_t value = mp_obj_get_int(time_in);
+        time_ns = value < 0 ? 0 : value;
+    }
+
+    return mp_obj_new_bool(common_hal_usb_midi_portout_write_at(self, bufinfo.buf, bufinfo.len, time_ns / 1000000));
+}
+MP_DEFINE_CONST_FUN_OBJ_3(usb_midi_portout_write_at_obj, usb_midi_portout_write_at);
+
+//|     def flush(self) -> None:
+//|         """Send any bytes held back by `write` without waiting for more."""
+//|         ...
+//|
+
 STATIC mp_uint_t usb_midi_portout_ioctl(mp_obj_t self_in, mp_uint_t request, mp_uint_t arg, int *errcode) {
     usb_midi_portout_obj_t *self = MP_OBJ_TO_PTR(self_in);
     mp_uint_t ret;
@@ -71,6 +110,9 @@ STATIC mp_uint_t usb_midi_portout_ioctl(mp_obj_t self_in, mp_uint_t request, mp_
         if ((flags & MP_IOCTL_POLL_WR) && common_hal_usb_midi_portout_ready_to_tx(self)) {
             ret |= MP_IOCTL_POLL_WR;
         }
+    } else if (request == MP_STREAM_FLUSH) {
+        common_hal_usb_midi_portout_flush(self);
+        ret = 0;
     } else {
         *errcode = MP_EINVAL;
         ret = MP_STREAM_ERROR;
@@ -81,6 +123,8 @@ STATIC mp_uint_t usb_midi_portout_ioctl(mp_obj_t self_in, mp_uint_t request, mp_
 STATIC const mp_rom_map_elem_t usb_midi_portout_locals_dict_table[] = {
     // Standard stream methods.
     { MP_OBJ_NEW_QSTR(MP_QSTR_write),    MP_ROM_PTR(&mp_stream_write_obj) },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_flush),    MP_ROM_PTR(&mp_stream_flush_obj) },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_write_at), MP_ROM_PTR(&usb_midi_portout_write_at_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(usb_midi_portout_locals_dict, usb_midi_portout_locals_dict_table);
 
@@ -9,6 +9,7 @@ extern const mp_obj_type_t vectorio_rectangle_type;
 void common_hal_vectorio_rectangle_construct(vectorio_rectangle_t *self, uint32_t width, uint32_t height);
 
 uint32_t common_hal_vectorio_rectangle_get_pixel(void *rectangle, int16_t x, int16_t y);
+size_t common_hal_vectorio_rectangle_get_spans(void *rectangle, bool column, int16_t line, int32_t *spans, size_t max_spans);
 
 void common_hal_vectorio_rectangle_get_area(void *rectangle, displayio_area_t *out_area);
 
@@ -56,14 +56,17 @@ STATIC mp_obj_t vectorio_vector_shape_make_new(const mp_obj_type_t *type, size_t
         ishape.shape = shape;
         ishape.get_area = &common_hal_vectorio_polygon_get_area;
         ishape.get_pixel = &common_hal_vectorio_polygon_get_pixel;
+        ishape.get_spans = &common_hal_vectorio_polygon_get_spans;
     } else if (MP_OBJ_IS_TYPE(shape, &vectorio_rectangle_type)) {
         ishape.shape = shape;
         ishape.get_area = &common_hal_vectorio_rectangle_get_area;
         ishape.get_pixel = &common_hal_vectorio_rectangle_get_pixel;
+        ishape.get_spans = &common_hal_vectorio_rectangle_get_spans;
     } else if (MP_OBJ_IS_TYPE(shape, &vectorio_circle_type)) {
         ishape.shape = shape;
         ishape.get_area = &common_hal_vectorio_circle_get_area;
         ishape.get_pixel = &common_hal_vectorio_circle_get_pixel;
+        ishape.get_spans = &common_hal_vectorio_circle_get_spans;
     } else {
         mp_raise_TypeError_varg(translate("unsupported %q type"), MP_QSTR_shape);
     }
@@ -0,0 +1,275 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/wifi/__init__.h"
+#include "shared-bindings/wifi/Radio.h"
+
+//| class Radio:
+//|     """Native wifi radio.
+//|
+//|     This class manages the station and access point functionality of the native
+//|     Wifi radio. While the radio is enabled it is registered as a NIC with the
+//|     `network` module, so `socket` traffic goes over it."""
+//|
+//|     def __init__(self) -> None:
+//|         """You cannot create an instance of `wifi.Radio`.
+//|         Use `wifi.radio` to access the sole instance available."""
+//|         ...
+//|
+
+STATIC void validate_ssid_password(size_t ssid_len, size_t password_len) {
+    if (ssid_len < 1 || ssid_len > 32) {
+        mp_raise_ValueError_varg(translate("%q length must be %d-%d"), MP_QSTR_ssid, 1, 32);
+    }
+    // An empty password selects an open network; otherwise WPA2 needs 8 to 63
+    // characters (or 64 hex digits for the raw key).
+    if (password_len != 0 && (password_len < 8 || password_len > 64)) {
+        mp_raise_ValueError_varg(translate("%q length must be %d-%d"), MP_QSTR_password, 8, 64);
+    }
+}
+
+//|     enabled: bool
+//|     """True when the wifi radio is enabled.  Disabling it drops any connection
+//|     and closes its sockets."""
+//|
+STATIC mp_obj_t wifi_radio_get_enabled(mp_obj_t self) {
+    return mp_obj_new_bool(common_hal_wifi_radio_get_enabled(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(wifi_radio_get_enabled_obj, wifi_radio_get_enabled);
+
+STATIC mp_obj_t wifi_radio_set_enabled(mp_obj_t self, mp_obj_t value) {
+    common_hal_wifi_radio_set_enabled(self, mp_obj_is_true(value));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(wifi_radio_set_enabled_obj, wifi_radio_set_enabled);
+
+const mp_obj_property_t wifi_radio_enabled_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&wifi_radio_get_enabled_obj,
+              (mp_obj_t)&wifi_radio_set_enabled_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     mac_address: bytes
+//|     """MAC address of the wifi radio station. (read-only)"""
+//|
+STATIC mp_obj_t wifi_radio_get_mac_address(mp_obj_t self) {
+    return common_hal_wifi_radio_get_mac_address(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(wifi_radio_get_mac_address_obj, wifi_radio_get_mac_address);
+
+const mp_obj_property_t wifi_radio_mac_address_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&wifi_radio_get_mac_address_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     connected: bool
+//|     """True when the station is associated and has an IP address. (read-only)"""
+//|
+STATIC mp_obj_t wifi_radio_get_connected(mp_obj_t self) {
+    return mp_obj_new_bool(common_hal_wifi_radio_get_connected(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(wifi_radio_get_connected_obj, wifi_radio_get_connected);
+
+const mp_obj_property_t wifi_radio_connected_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&wifi_radio_get_connected_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     ipv4_address: Optional[str]
+//|     """IP v4 address of the station when connected to an access point. None otherwise. (read-only)"""
+//|
+STATIC mp_obj_t wifi_radio_get_ipv4_address(mp_obj_t self) {
+    return common_hal_wifi_radio_get_ipv4_address(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(wifi_radio_get_ipv4_address_obj, wifi_radio_get_ipv4_address);
+
+const mp_obj_property_t wifi_radio_ipv4_address_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&wifi_radio_get_ipv4_address_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     ap_ipv4_address: Optional[str]
+//|     """IP v4 address of the access point, when started. None otherwise. (read-only)"""
+//|
+STATIC mp_obj_t wifi_radio_get_ap_ipv4_address(mp_obj_t self) {
+    return common_hal_wifi_radio_get_ap_ipv4_address(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(wifi_radio_get_ap_ipv4_address_obj, wifi_radio_get_ap_ipv4_address);
+
+const mp_obj_property_t wifi_radio_ap_ipv4_address_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&wifi_radio_get_ap_ipv4_address_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|     def connect(self, ssid: ReadableBuffer, password: ReadableBuffer = b"", *, channel: int = 0, timeout: Optional[float] = None) -> None:
+//|         """Connects to the given ssid and waits for an IP address.
+//|
+//|         :param ReadableBuffer ssid: network to join, 1 to 32 bytes
+//|         :param ReadableBuffer password: WPA2 passphrase; empty for an open network
+//|         :param int channel: channel to scan first, or 0 to scan them all
+//|         :param float timeout: seconds to wait, or None to wait forever
+//|
+//|         Raises `OSError` with `errno.ETIMEDOUT` if no address was obtained in time,
+//|         or `errno.ECONNREFUSED` if the access point rejected the connection."""
+//|         ...
+//|
+STATIC mp_obj_t wifi_radio_connect(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_ssid, ARG_password, ARG_channel, ARG_timeout };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_ssid, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_password,  MP_ARG_OBJ, {.u_obj = mp_const_empty_bytes} },
+        { MP_QSTR_channel, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_timeout, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+
+    wifi_radio_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t ssid;
+    mp_get_buffer_raise(args[ARG_ssid].u_obj, &ssid, MP_BUFFER_READ);
+    mp_buffer_info_t password;
+    mp_get_buffer_raise(args[ARG_password].u_obj, &password, MP_BUFFER_READ);
+    validate_ssid_password(ssid.len, password.len);
+
+    mp_int_t channel = args[ARG_channel].u_int;
+    if (channel < 0 || channel > 14) {
+        mp_raise_ValueError(translate("Invalid argument"));
+    }
+
+    mp_float_t timeout = -1;
+    if (args[ARG_timeout].u_obj != mp_const_none) {
+        timeout = mp_obj_get_float(args[ARG_timeout].u_obj);
+    }
+
+    common_hal_wifi_radio_connect(self, ssid.buf, ssid.len, password.buf, password.len, channel, timeout);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(wifi_radio_connect_obj, 1, wifi_radio_connect);
+
+//|     def disconnect(self) -> None:
+//|         """Disconnects the station from its access point."""
+//|         ...
+//|
+STATIC mp_obj_t wifi_radio_disconnect(mp_obj_t self) {
+    common_hal_wifi_radio_disconnect(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(wifi_radio_disconnect_obj, wifi_radio_disconnect);
+
+//|     def start_ap(self, ssid: ReadableBuffer, password: ReadableBuffer = b"", *, channel: int = 1) -> None:
+//|         """Starts an access point with the given ssid. The station keeps running
+//|         alongside it. Clients get an address from the built-in DHCP server."""
+//|         ...
+//|
+STATIC mp_obj_t wifi_radio_start_ap(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_ssid, ARG_password, ARG_channel };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_ssid, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_password,  MP_ARG_OBJ, {.u_obj = mp_const_empty_bytes} },
+        { MP_QSTR_channel, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 1} },
+    };
+
+    wifi_radio_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t ssid;
+    mp_get_buffer_raise(args[ARG_ssid].u_obj, &ssid, MP_BUFFER_READ);
+    mp_buffer_info_t password;
+    mp_get_buffer_raise(args[ARG_password].u_obj, &password, MP_BUFFER_READ);
+    validate_ssid_password(ssid.len, password.len);
+
+    mp_int_t channel = args[ARG_channel].u_int;
+    if (channel < 1 || channel > 14) {
+        mp_raise_ValueError(translate("Invalid argument"));
+    }
+
+    common_hal_wifi_radio_start_ap(self, ssid.buf, ssid.len, password.buf, password.len, channel);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(wifi_radio_start_ap_obj, 1, wifi_radio_start_ap);
+
+//|     def stop_ap(self) -> None:
+//|         """Stops the access point."""
+//|         ...
+//|
+STATIC mp_obj_t wifi_radio_stop_ap(mp_obj_t self) {
+    common_hal_wifi_radio_stop_ap(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(wifi_radio_stop_ap_obj, wifi_radio_stop_ap);
+
+STATIC const mp_rom_map_elem_t wifi_radio_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_enabled), MP_ROM_PTR(&wifi_radio_enabled_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mac_address), MP_ROM_PTR(&wifi_radio_mac_address_obj) },
+    { MP_ROM_QSTR(MP_QSTR_connected), MP_ROM_PTR(&wifi_radio_connected_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ipv4_address), MP_ROM_PTR(&wifi_radio_ipv4_address_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ap_ipv4_address), MP_ROM_PTR(&wifi_radio_ap_ipv4_address_obj) },
+
+    { MP_ROM_QSTR(MP_QSTR_connect), MP_ROM_PTR(&wifi_radio_connect_obj) },
+    { MP_ROM_QSTR(MP_QSTR_disconnect), MP_ROM_PTR(&wifi_radio_disconnect_obj) },
+    { MP_ROM_QSTR(MP_QSTR_start_ap), MP_ROM_PTR(&wifi_radio_start_ap_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop_ap), MP_ROM_PTR(&wifi_radio_stop_ap_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(wifi_radio_locals_dict, wifi_radio_locals_dict_table);
+
+const mod_network_nic_type_t wifi_radio_type = {
+    .base = {
+        { &mp_type_type },
+        .name = MP_QSTR_Radio,
+        .locals_dict = (mp_obj_dict_t*)&wifi_radio_locals_dict,
+    },
+    .gethostbyname = common_hal_wifi_radio_gethostbyname,
+    .socket = common_hal_wifi_radio_socket_socket,
+    .close = common_hal_wifi_radio_socket_close,
+    .bind = common_hal_wifi_radio_socket_bind,
+    .listen = common_hal_wifi_radio_socket_listen,
+    .accept = common_hal_wifi_radio_socket_accept,
+    .connect = common_hal_wifi_radio_socket_connect,
+    .send = common_hal_wifi_radio_socket_send,
+    .recv = common_hal_wifi_radio_socket_recv,
+    .sendto = common_hal_wifi_radio_socket_sendto,
+    .recvfrom = common_hal_wifi_radio_socket_recvfrom,
+    .setsockopt = common_hal_wifi_radio_socket_setsockopt,
+    .settimeout = common_hal_wifi_radio_socket_settimeout,
+    .ioctl = common_hal_wifi_radio_socket_ioctl,
+    .deinit = common_hal_wifi_radio_socket_deinit,
+};
@@ -0,0 +1,72 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_BINDINGS_WIFI_RADIO_H
+#define MICROPY_INCLUDED_SHARED_BINDINGS_WIFI_RADIO_H
+
+#include <stdint.h>
+
+#include "common-hal/wifi/Radio.h"
+
+#include "py/objstr.h"
+#include "shared-module/network/__init__.h"
+
+extern const mod_network_nic_type_t wifi_radio_type;
+
+extern bool common_hal_wifi_radio_get_enabled(wifi_radio_obj_t *self);
+extern void common_hal_wifi_radio_set_enabled(wifi_radio_obj_t *self, bool enabled);
+
+extern mp_obj_t common_hal_wifi_radio_get_mac_address(wifi_radio_obj_t *self);
+
+extern bool common_hal_wifi_radio_get_connected(wifi_radio_obj_t *self);
+extern mp_obj_t common_hal_wifi_radio_get_ipv4_address(wifi_radio_obj_t *self);
+extern mp_obj_t common_hal_wifi_radio_get_ap_ipv4_address(wifi_radio_obj_t *self);
+
+// timeout is in seconds and negative means wait forever. Raises OSError on failure.
+extern void common_hal_wifi_radio_connect(wifi_radio_obj_t *self, const uint8_t *ssid, size_t ssid_len, const uint8_t *password, size_t password_len, uint8_t channel, mp_float_t timeout);
+extern void common_hal_wifi_radio_disconnect(wifi_radio_obj_t *self);
+
+extern void common_hal_wifi_radio_start_ap(wifi_radio_obj_t *self, const uint8_t *ssid, size_t ssid_len, const uint8_t *password, size_t password_len, uint8_t channel);
+extern void common_hal_wifi_radio_stop_ap(wifi_radio_obj_t *self);
+
+// NIC interface used by the socket module.
+int common_hal_wifi_radio_gethostbyname(mp_obj_t nic, const char *name, mp_uint_t len, uint8_t *ip_out);
+int common_hal_wifi_radio_socket_socket(mod_network_socket_obj_t *socket, int *_errno);
+void common_hal_wifi_radio_socket_close(mod_network_socket_obj_t *socket);
+int common_hal_wifi_radio_socket_bind(mod_network_socket_obj_t *socket, byte *ip, mp_uint_t port, int *_errno);
+int common_hal_wifi_radio_socket_listen(mod_network_socket_obj_t *socket, mp_int_t backlog, int *_errno);
+int common_hal_wifi_radio_socket_accept(mod_network_socket_obj_t *socket, mod_network_socket_obj_t *socket2, byte *ip, mp_uint_t *port, int *_errno);
+int common_hal_wifi_radio_socket_connect(mod_network_socket_obj_t *socket, byte *ip, mp_uint_t port, int *_errno);
+mp_uint_t common_hal_wifi_radio_socket_send(mod_network_socket_obj_t *socket, const byte *buf, mp_uint_t len, int *_errno);
+mp_uint_t common_hal_wifi_radio_socket_recv(mod_network_socket_obj_t *socket, byte *buf, mp_uint_t len, int *_errno);
+mp_uint_t common_hal_wifi_radio_socket_sendto(mod_network_socket_obj_t *socket, const byte *buf, mp_uint_t len, byte *ip, mp_uint_t port, int *_errno);
+mp_uint_t common_hal_wifi_radio_socket_recvfrom(mod_network_socket_obj_t *socket, byte *buf, mp_uint_t len, byte *ip, mp_uint_t *port, int *_errno);
+int common_hal_wifi_radio_socket_setsockopt(mod_network_socket_obj_t *socket, mp_uint_t level, mp_uint_t opt, const void *optval, mp_uint_t optlen, int *_errno);
+int common_hal_wifi_radio_socket_settimeout(mod_network_socket_obj_t *socket, mp_uint_t timeout_ms, int *_errno);
+int common_hal_wifi_radio_socket_ioctl(mod_network_socket_obj_t *socket, mp_uint_t request, mp_uint_t arg, int *_errno);
+void common_hal_wifi_radio_socket_deinit(mod_network_socket_obj_t *socket);
+
+#endif  // MICROPY_INCLUDED_SHARED_BINDINGS_WIFI_RADIO_H
@@ -30,25 +30,50 @@
 
 #include "lib/utils/interrupt_char.h"
 #include "py/objstr.h"
+#include "py/qstr.h"
 #include "py/runtime.h"
 #include "shared-bindings/_bleio/ScanEntry.h"
 #include "shared-bindings/_bleio/ScanResults.h"
 
-bleio_scanresults_obj_t* shared_module_bleio_new_scanresults(size_t buffer_size, uint8_t* prefixes, size_t prefixes_len, mp_int_t minimum_rssi) {
+// Each buffered advertisement is stored as:
+// type(1) ticks_ms(8) rssi(1) peer_addr(6) addr_type(1) len(2) data(len)
+#define ENTRY_HEADER_SIZE (1 + sizeof(uint64_t) + 1 + NUM_BLEIO_ADDRESS_BYTES + 1 + sizeof(uint16_t))
+#define ENTRY_LEN_OFFSET (ENTRY_HEADER_SIZE - sizeof(uint16_t))
+
+// Raw entries returned by readinto are stored as:
+// type(1) rssi(1) addr_type(1) peer_addr(6) len(1) data(len)
+#define RAW_HEADER_SIZE (3 + NUM_BLEIO_ADDRESS_BYTES + 1)
+
+bleio_scanresults_obj_t* shared_module_bleio_new_scanresults(size_t buffer_size, uint8_t* prefixes, size_t prefixes_len, mp_int_t minimum_rssi, uint8_t* addresses, size_t address_count, uint32_t duplicate_window_ms) {
     bleio_scanresults_obj_t* self = m_new_obj(bleio_scanresults_obj_t);
     self->base.type = &bleio_scanresults_type;
     ringbuf_alloc(&self->buf, buffer_size, false);
     self->prefixes = prefixes;
     self->prefix_length = prefixes_len;
+    self->addresses = addresses;
+    self->address_count = address_count;
     self->minimum_rssi = minimum_rssi;
+    self->duplicate_window_ms = duplicate_window_ms;
+    self->seen = NULL;
+    self->seen_next = 0;
+    if (duplicate_window_ms > 0) {
+        // Allocated here because entries are appended from the BLE event handler.
+        self->seen = m_new0(bleio_scanresults_seen_t, BLEIO_SCANRESULTS_SEEN_COUNT);
+    }
     return self;
 }
 
-mp_obj_t common_hal_bleio_scanresults_next(bleio_scanresults_obj_t *self) {
+// Wait until there's an entry to read or scanning is done. Returns false if there is nothing to
+// read.
+STATIC bool scanresults_wait(bleio_scanresults_obj_t *self) {
     while (ringbuf_num_filled(&self->buf) == 0 && !self->done && !mp_hal_is_interrupted()) {
         RUN_BACKGROUND_TASKS;
     }
-    if (ringbuf_num_filled(&self->buf) == 0 || mp_hal_is_interrupted()) {
+    return ringbuf_num_filled(&self->buf) != 0 && !mp_hal_is_interrupted();
+}
+
+mp_obj_t common_hal_bleio_scanresults_next(bleio_scanresults_obj_t *self) {
+    if (!scanresults_wait(self)) {
         return mp_const_none;
     }
 
@@ -85,6 +110,71 @@ mp_obj_t common_hal_bleio_scanresults_next(bleio_scanresults_obj_t *self) {
     return MP_OBJ_FROM_PTR(entry);
 }
 
+mp_int_t common_hal_bleio_scanresults_readinto(bleio_scanresults_obj_t *self, uint8_t *buf, size_t len) {
+    if (!scanresults_wait(self)) {
+        return 0;
+    }
+
+    // Copy out as many whole entries as fit, leaving the rest buffered.
+    size_t written = 0;
+    while (ringbuf_num_filled(&self->buf) >= ENTRY_HEADER_SIZE) {
+        uint16_t data_len;
+        ringbuf_peek_n(&self->buf, (uint8_t*) &data_len, sizeof(data_len), ENTRY_LEN_OFFSET);
+        size_t raw_size = RAW_HEADER_SIZE + data_len;
+        if (written + raw_size > len) {
+            if (written == 0) {
+                // Not even the first entry fits. Return negative of the shortfall.
+                return (mp_int_t) len - (mp_int_t) raw_size;
+            }
+            break;
+        }
+        uint8_t *raw = buf + written;
+        raw[0] = ringbuf_get(&self->buf);
+        uint64_t ticks_ms;
+        ringbuf_get_n(&self->buf, (uint8_t*) &ticks_ms, sizeof(ticks_ms));
+        raw[1] = ringbuf_get(&self->buf);
+        ringbuf_get_n(&self->buf, raw + 3, NUM_BLEIO_ADDRESS_BYTES);
+        raw[2] = ringbuf_get(&self->buf);
+        ringbuf_get_n(&self->buf, (uint8_t*) &data_len, sizeof(data_len));
+        raw[3 + NUM_BLEIO_ADDRESS_BYTES] = data_len;
+        ringbuf_get_n(&self->buf, raw + RAW_HEADER_SIZE, data_len);
+        written += raw_size;
+    }
+    return written;
+}
+
+// Returns true if the address is in the address filter, or there's no filter.
+STATIC bool scanresults_address_matches(bleio_scanresults_obj_t *self, const uint8_t *peer_addr, uint8_t addr_type) {
+    if (self->address_count == 0) {
+        return true;
+    }
+    for (size_t i = 0; i < self->address_count; i++) {
+        const uint8_t *address = self->addresses + i * (1 + NUM_BLEIO_ADDRESS_BYTES);
+        if (address[0] == addr_type && memcmp(address + 1, peer_addr, NUM_BLEIO_ADDRESS_BYTES) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Find the slot remembering this advertiser, or the slot to evict for it. Sets *duplicate if the
+// same data from it was buffered within the duplicate window.
+STATIC bleio_scanresults_seen_t *scanresults_find_seen(bleio_scanresults_obj_t *self, uint32_t now,
+    uint8_t type, const uint8_t *peer_addr, uint8_t addr_type, uint16_t data_hash, bool *duplicate) {
+    *duplicate = false;
+    for (size_t i = 0; i < BLEIO_SCANRESULTS_SEEN_COUNT; i++) {
+        bleio_scanresults_seen_t *seen = &self->seen[i];
+        if (seen->type == type && seen->addr_type == addr_type &&
+            memcmp(seen->addr, peer_addr, NUM_BLEIO_ADDRESS_BYTES) == 0) {
+            *duplicate = seen->data_hash == data_hash && now - seen->ticks_ms < self->duplicate_window_ms;
+            return seen;
+        }
+    }
+    bleio_scanresults_seen_t *seen = &self->seen[self->seen_next];
+    self->seen_next = (self->seen_next + 1) % BLEIO_SCANRESULTS_SEEN_COUNT;
+    return seen;
+}
+
 
 void shared_module_bleio_scanresults_append(bleio_scanresults_obj_t* self,
                                             uint64_t ticks_ms,
@@ -95,15 +185,12 @@ void shared_module_bleio_scanresults_append(bleio_scanresults_obj_t* self,
                                             uint8_t addr_type,
                                             uint8_t *data,
                                             uint16_t len) {
-    int32_t packet_size = sizeof(uint8_t) + sizeof(ticks_ms) + sizeof(rssi) + NUM_BLEIO_ADDRESS_BYTES +
-        sizeof(addr_type) + sizeof(len) + len;
-    int32_t empty_space = self->buf.size - ringbuf_num_filled(&self->buf);
-    if (packet_size >= empty_space) {
-        // We can't fit the packet so skip it.
+    // Filter the packet, cheapest tests first.
+    if (rssi < self->minimum_rssi) {
         return;
     }
-    // Filter the packet.
-    if (rssi < self->minimum_rssi) {
+
+    if (!scanresults_address_matches(self, peer_addr, addr_type)) {
         return;
     }
 
@@ -111,6 +198,14 @@ void shared_module_bleio_scanresults_append(bleio_scanresults_obj_t* self,
     if (!bleio_scanentry_data_matches(data, len, self->prefixes, self->prefix_length, true)) {
         return;
     }
+
+    int32_t packet_size = ENTRY_HEADER_SIZE + len;
+    int32_t empty_space = ringbuf_num_empty(&self->buf);
+    if (packet_size >= empty_space) {
+        // We can't fit the packet so skip it.
+        return;
+    }
+
     uint8_t type = 0;
     if (connectable) {
         type |= 1 << 0;
@@ -119,6 +214,21 @@ void shared_module_bleio_scanresults_append(bleio_scanresults_obj_t* self,
         type |= 1 << 1;
     }
 
+    if (self->seen != NULL) {
+        uint16_t data_hash = qstr_compute_hash(data, len);
+        bool duplicate;
+        bleio_scanresults_seen_t *seen = scanresults_find_seen(self, (uint32_t) ticks_ms, type,
+            peer_addr, addr_type, data_hash, &duplicate);
+        if (duplicate) {
+            return;
+        }
+        seen->ticks_ms = ticks_ms;
+        seen->data_hash = data_hash;
+        seen->type = type;
+        seen->addr_type = addr_type;
+        memcpy(seen->addr, peer_addr, NUM_BLEIO_ADDRESS_BYTES);
+    }
+
     // Add the packet to the buffer.
     ringbuf_put(&self->buf, type);
     ringbuf_put_n(&self->buf, (uint8_t*) &ticks_ms, sizeof(ticks_ms));
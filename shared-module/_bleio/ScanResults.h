@@ -32,6 +32,18 @@
 
 #include "py/obj.h"
 #include "py/ringbuf.h"
+#include "shared-module/_bleio/Address.h"
+
+// Number of recently buffered advertisers remembered for duplicate filtering.
+#define BLEIO_SCANRESULTS_SEEN_COUNT (16)
+
+typedef struct {
+    uint32_t ticks_ms;
+    uint16_t data_hash;
+    uint8_t type;
+    uint8_t addr_type;
+    uint8_t addr[NUM_BLEIO_ADDRESS_BYTES];
+} bleio_scanresults_seen_t;
 
 typedef struct {
     mp_obj_base_t base;
@@ -41,12 +53,19 @@ typedef struct {
     // Prefixes is a length encoded array of prefixes.
     uint8_t* prefixes;
     size_t prefix_length;
+    // Addresses is an array of address type followed by the address bytes, for each address.
+    uint8_t* addresses;
+    size_t address_count;
+    // Advertisements repeated within duplicate_window_ms of the last one buffered are dropped.
+    bleio_scanresults_seen_t* seen;
+    uint32_t duplicate_window_ms;
+    uint8_t seen_next;
     mp_int_t minimum_rssi;
     bool active;
     bool done;
 } bleio_scanresults_obj_t;
 
-bleio_scanresults_obj_t* shared_module_bleio_new_scanresults(size_t buffer_size, uint8_t* prefixes, size_t prefixes_len, mp_int_t minimum_rssi);
+bleio_scanresults_obj_t* shared_module_bleio_new_scanresults(size_t buffer_size, uint8_t* prefixes, size_t prefixes_len, mp_int_t minimum_rssi, uint8_t* addresses, size_t address_count, uint32_t duplicate_window_ms);
 
 bool shared_module_bleio_scanresults_get_done(bleio_scanresults_obj_t* self);
 void shared_module_bleio_scanresults_set_done(bleio_scanresults_obj_t* self, bool done);
@@ -26,23 +26,136 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include "py/binary.h"
 #include "py/runtime.h"
+#include "lib/utils/interrupt_char.h"
 #include "shared-module/_eve/__init__.h"
+#include "shared-bindings/_eve/__init__.h"
+
+// Coprocessor FIFO registers of the FT81x and BT81x.
+#define REG_CMDB_SPACE 0x302574
+#define REG_CMDB_WRITE 0x302578
+
+void common_hal__eve_construct(common_hal__eve_t *eve, size_t buffer_size) {
+    // Commands are whole words, so keep the buffer a whole number of them.
+    eve->buf_size = (buffer_size + 3) & ~3;
+    eve->buf = m_new(uint8_t, eve->buf_size);
+    eve->n = 0;
+    eve->vscale = 16;
+    eve->view.base.type = &mp_type_bytearray;
+    eve->view.typecode = BYTEARRAY_TYPECODE;
+    eve->view.free = 0;
+    eve->view.len = 0;
+    eve->view.items = eve->buf;
+    eve->dest[0] = MP_OBJ_NULL;
+    #if CIRCUITPY_BUSIO
+    eve->spi = NULL;
+    eve->cs = NULL;
+    #endif
+}
+
+void common_hal__eve_register(common_hal__eve_t *eve, mp_obj_t o) {
+    common_hal__eve_flush(eve);
+    mp_load_method(o, MP_QSTR_write, eve->dest);
+    #if CIRCUITPY_BUSIO
+    eve->spi = NULL;
+    eve->cs = NULL;
+    #endif
+}
+
+#if CIRCUITPY_BUSIO
+void common_hal__eve_register_spi(common_hal__eve_t *eve, busio_spi_obj_t *spi, digitalio_digitalinout_obj_t *cs, uint32_t baudrate) {
+    common_hal__eve_flush(eve);
+    eve->spi = spi;
+    eve->cs = cs;
+    eve->baudrate = baudrate;
+    // Nothing is known about the FIFO until it is read.
+    eve->space = 0;
+    common_hal_digitalio_digitalinout_switch_to_output(cs, true, DRIVE_MODE_PUSH_PULL);
+}
+
+STATIC void begin_transaction(common_hal__eve_t *eve, uint32_t addr, bool write) {
+    uint8_t header[4] = {
+        (write ? 0x80 : 0x00) | ((addr >> 16) & 0x3f),
+        (addr >> 8) & 0xff,
+        addr & 0xff,
+        0x00,   // dummy byte that precedes read data
+    };
+    common_hal_digitalio_digitalinout_set_value(eve->cs, false);
+    common_hal_busio_spi_write(eve->spi, header, write ? 3 : 4);
+}
+
+STATIC void end_transaction(common_hal__eve_t *eve) {
+    common_hal_digitalio_digitalinout_set_value(eve->cs, true);
+}
+
+STATIC uint32_t read_space(common_hal__eve_t *eve) {
+    uint8_t r[4];
+    begin_transaction(eve, REG_CMDB_SPACE, false);
+    common_hal_busio_spi_read(eve->spi, r, sizeof(r), 0);
+    end_transaction(eve);
+    return (r[0] | (r[1] << 8)) & 0xffc;
+}
+
+// Write straight into the coprocessor FIFO through REG_CMDB_WRITE, never
+// sending more than the FIFO has room for. The free space is only read back
+// from the device when the cached count runs out.
+STATIC void write_spi(common_hal__eve_t *eve, size_t len, const uint8_t *buf) {
+    if (!common_hal_busio_spi_try_lock(eve->spi)) {
+        mp_raise_msg_varg(&mp_type_RuntimeError, translate("%q in use"), MP_QSTR_SPI);
+    }
+    common_hal_busio_spi_configure(eve->spi, eve->baudrate, 0, 0, 8);
+    while (len > 0) {
+        while (eve->space == 0) {
+            eve->space = read_space(eve);
+            if (eve->space == 0) {
+                RUN_BACKGROUND_TASKS;
+                if (mp_hal_is_interrupted()) {
+                    common_hal_busio_spi_unlock(eve->spi);
+                    return;
+                }
+            }
+        }
+        size_t m = MIN(len, eve->space);
+        begin_transaction(eve, REG_CMDB_WRITE, true);
+        common_hal_busio_spi_write(eve->spi, buf, m);
+        end_transaction(eve);
+        eve->space -= m;
+        buf += m;
+        len -= m;
+    }
+    common_hal_busio_spi_unlock(eve->spi);
+}
+#endif
 
-STATIC void write(common_hal__eve_t *eve, size_t len, void *buf) {
-    eve->dest[2] = mp_obj_new_bytearray_by_ref(len, buf);
+STATIC void write_buf(common_hal__eve_t *eve, size_t len, void *buf) {
+    #if CIRCUITPY_BUSIO
+    if (eve->spi != NULL) {
+        write_spi(eve, len, buf);
+        return;
+    }
+    #endif
+    if (eve->dest[0] == MP_OBJ_NULL) {
+        return;
+    }
+    // 'write' sees a view of the buffer that is only valid for the call.
+    eve->view.len = len;
+    eve->view.items = buf;
+    eve->dest[2] = MP_OBJ_FROM_PTR(&eve->view);
     mp_call_method_n_kw(1, 0, eve->dest);
+    eve->view.len = 0;
+    eve->view.items = eve->buf;
 }
 
 void common_hal__eve_flush(common_hal__eve_t *eve) {
     if (eve->n != 0) {
-        write(eve, eve->n, eve->buf);
+        write_buf(eve, eve->n, eve->buf);
         eve->n = 0;
     }
 }
 
 static void *append(common_hal__eve_t *eve, size_t m) {
-    if ((eve->n + m) > sizeof(eve->buf))
+    if ((eve->n + m) > eve->buf_size)
         common_hal__eve_flush(eve);
     uint8_t *r = eve->buf + eve->n;
     eve->n += m;
@@ -50,13 +163,13 @@ static void *append(common_hal__eve_t *eve, size_t m) {
 }
 
 void common_hal__eve_add(common_hal__eve_t *eve, size_t len, void *buf) {
-    if (len <= sizeof(eve->buf)) {
+    if (len <= eve->buf_size) {
       uint8_t *p = (uint8_t*)append(eve, len);
       // memcpy(p, buffer_info.buf, buffer_info.len);
       uint8_t *s = buf; for (size_t i = 0; i < len; i++) *p++ = *s++;
     } else {
       common_hal__eve_flush(eve);
-      write(eve, len, buf);
+      write_buf(eve, len, buf);
     }
 }
 
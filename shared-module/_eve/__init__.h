@@ -27,11 +27,32 @@
 #ifndef MICROPY_INCLUDED_SHARED_MODULE__EVE___INIT___H
 #define MICROPY_INCLUDED_SHARED_MODULE__EVE___INIT___H
 
+#include "py/objarray.h"
+
+#if CIRCUITPY_BUSIO
+#include "shared-bindings/busio/SPI.h"
+#include "shared-bindings/digitalio/DigitalInOut.h"
+#endif
+
+// Default size of the command buffer, in bytes. A larger buffer means fewer
+// bus transactions per frame.
+#ifndef CIRCUITPY__EVE_BUFFER_SIZE
+#define CIRCUITPY__EVE_BUFFER_SIZE (2048)
+#endif
+
 typedef struct _common_hal__eve_t {
     mp_obj_t dest[3];           // Own 'write' method, plus argument
+    mp_obj_array_t view;        // bytearray passed to 'write', reused for every call
+    #if CIRCUITPY_BUSIO
+    busio_spi_obj_t *spi;       // Native bus, or NULL to use 'write'
+    digitalio_digitalinout_obj_t *cs;
+    uint32_t baudrate;
+    uint32_t space;             // Free bytes in the coprocessor FIFO, as last known
+    #endif
     int vscale;                 // fixed-point scaling used for Vertex2f
     size_t n;                   // Current size of command buffer
-    uint8_t buf[512];           // Command buffer
+    size_t buf_size;            // Capacity of command buffer
+    uint8_t *buf;               // Command buffer
 } common_hal__eve_t;
 
 #endif // MICROPY_INCLUDED_SHARED_MODULE__EVE___INIT___H
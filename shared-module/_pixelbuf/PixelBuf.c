@@ -69,6 +69,8 @@ void common_hal__pixelbuf_pixelbuf_construct(pixelbuf_pixelbuf_obj_t *self, size
     }
     // Call set_brightness so that it can allocate a second buffer if needed.
     self->brightness = 1.0;
+    self->brightness_scale = 256;
+    self->post_brightness_stale = false;
     common_hal__pixelbuf_pixelbuf_set_brightness(MP_OBJ_FROM_PTR(self), brightness);
 
     // Turn on auto_write. We don't want to do it with the above brightness call.
@@ -114,18 +116,20 @@ void common_hal__pixelbuf_pixelbuf_set_brightness(mp_obj_t self_in, mp_float_t b
         return;
     }
     self->brightness = brightness;
-    size_t pixel_len = self->pixel_count * self->bytes_per_pixel;
+    if (brightness <= 0) {
+        self->brightness_scale = 0;
+    } else if (brightness >= 1) {
+        self->brightness_scale = 256;
+    } else {
+        self->brightness_scale = brightness * 256 + 0.5;
+    }
     if (self->pre_brightness_buffer == NULL) {
+        size_t pixel_len = self->pixel_count * self->bytes_per_pixel;
         self->pre_brightness_buffer = m_malloc(pixel_len, false);
         memcpy(self->pre_brightness_buffer, self->post_brightness_buffer, pixel_len);
     }
-    for (size_t i = 0; i < pixel_len; i++) {
-        // Don't adjust per-pixel luminance bytes in dotstar mode
-        if (self->byteorder.is_dotstar && i % 4 == 0) {
-            continue;
-        }
-        self->post_brightness_buffer[i] = self->pre_brightness_buffer[i] * self->brightness;
-    }
+    // The new brightness is applied by the next show().
+    self->post_brightness_stale = true;
 
     if (self->auto_write) {
         common_hal__pixelbuf_pixelbuf_show(self_in);
@@ -185,28 +189,19 @@ void _pixelbuf_set_pixel_color(pixelbuf_pixelbuf_obj_t* self, size_t index, uint
     }
     pixelbuf_rgbw_t *rgbw_order = &self->byteorder.byteorder;
     size_t offset = index * self->bytes_per_pixel;
+    // Brightness is only ever other than 1.0 once there's a pre_brightness_buffer, and then it is
+    // applied by show().
+    uint8_t* pixel_buffer = self->post_brightness_buffer + offset;
     if (self->pre_brightness_buffer != NULL) {
-        uint8_t* pre_brightness_buffer = self->pre_brightness_buffer + offset;
-        if (self->bytes_per_pixel == 4) {
-            pre_brightness_buffer[rgbw_order->w] = w;
-        }
-
-        pre_brightness_buffer[rgbw_order->r] = r;
-        pre_brightness_buffer[rgbw_order->g] = g;
-        pre_brightness_buffer[rgbw_order->b] = b;
+        pixel_buffer = self->pre_brightness_buffer + offset;
+        self->post_brightness_stale = true;
     }
-
-    uint8_t* post_brightness_buffer = self->post_brightness_buffer + offset;
     if (self->bytes_per_pixel == 4) {
-        // Only apply brightness if w is actually white (aka not DotStar.)
-        if (!self->byteorder.is_dotstar) {
-            w *= self->brightness;
-        }
-        post_brightness_buffer[rgbw_order->w] = w;
+        pixel_buffer[rgbw_order->w] = w;
     }
-    post_brightness_buffer[rgbw_order->r] = r * self->brightness;
-    post_brightness_buffer[rgbw_order->g] = g * self->brightness;
-    post_brightness_buffer[rgbw_order->b] = b * self->brightness;
+    pixel_buffer[rgbw_order->r] = r;
+    pixel_buffer[rgbw_order->g] = g;
+    pixel_buffer[rgbw_order->b] = b;
 }
 
 void _pixelbuf_set_pixel(pixelbuf_pixelbuf_obj_t* self, size_t index, mp_obj_t value) {
@@ -237,6 +232,45 @@ void common_hal__pixelbuf_pixelbuf_set_pixel(mp_obj_t self_in, size_t index, mp_
     }
 }
 
+// data holds slice_len colors, either as 32 bit ints laid out like int colors with white in the
+// top byte, or as bpp bytes each in (Red, Green, Blue[, White]) order.
+void common_hal__pixelbuf_pixelbuf_set_pixels_from_buffer(mp_obj_t self_in, size_t start, mp_int_t step, size_t slice_len, const uint8_t* data, bool packed_ints) {
+    pixelbuf_pixelbuf_obj_t* self = native_pixelbuf(self_in);
+    uint8_t bpp = self->byteorder.bpp;
+    // As in _pixelbuf_parse_color, DotStars default to full per-pixel brightness.
+    uint8_t default_w = self->byteorder.is_dotstar ? 255 : 0;
+    for (size_t i = 0; i < slice_len; i++) {
+        uint8_t r;
+        uint8_t g;
+        uint8_t b;
+        uint8_t w = default_w;
+        if (packed_ints) {
+            uint32_t value;
+            memcpy(&value, data, sizeof(uint32_t));
+            data += sizeof(uint32_t);
+            r = value >> 16;
+            g = value >> 8;
+            b = value;
+            if (bpp == 4 && self->byteorder.has_white) {
+                w = value >> 24;
+            }
+        } else {
+            r = data[PIXEL_R];
+            g = data[PIXEL_G];
+            b = data[PIXEL_B];
+            if (bpp == 4) {
+                w = data[PIXEL_W];
+            }
+            data += bpp;
+        }
+        _pixelbuf_set_pixel_color(self, start, r, g, b, w);
+        start += step;
+    }
+    if (self->auto_write) {
+        common_hal__pixelbuf_pixelbuf_show(self_in);
+    }
+}
+
 mp_obj_t common_hal__pixelbuf_pixelbuf_get_pixel(mp_obj_t self_in, size_t index) {
     pixelbuf_pixelbuf_obj_t* self = native_pixelbuf(self_in);
     mp_obj_t elems[self->byteorder.bpp];
@@ -262,8 +296,33 @@ mp_obj_t common_hal__pixelbuf_pixelbuf_get_pixel(mp_obj_t self_in, size_t index)
     return mp_obj_new_tuple(self->byteorder.bpp, elems);
 }
 
+// Scales the pre_brightness_buffer into the post_brightness_buffer. DotStar per-pixel luminance
+// bytes are copied as they are.
+STATIC void apply_brightness(pixelbuf_pixelbuf_obj_t* self) {
+    size_t pixel_len = self->pixel_count * self->bytes_per_pixel;
+    uint16_t scale = self->brightness_scale;
+    uint8_t* pre_brightness_buffer = self->pre_brightness_buffer;
+    uint8_t* post_brightness_buffer = self->post_brightness_buffer;
+    if (self->byteorder.is_dotstar) {
+        for (size_t i = 0; i < pixel_len; i += 4) {
+            post_brightness_buffer[i] = pre_brightness_buffer[i];
+            post_brightness_buffer[i + 1] = (pre_brightness_buffer[i + 1] * scale) >> 8;
+            post_brightness_buffer[i + 2] = (pre_brightness_buffer[i + 2] * scale) >> 8;
+            post_brightness_buffer[i + 3] = (pre_brightness_buffer[i + 3] * scale) >> 8;
+        }
+    } else {
+        for (size_t i = 0; i < pixel_len; i++) {
+            post_brightness_buffer[i] = (pre_brightness_buffer[i] * scale) >> 8;
+        }
+    }
+    self->post_brightness_stale = false;
+}
+
 void common_hal__pixelbuf_pixelbuf_show(mp_obj_t self_in) {
     pixelbuf_pixelbuf_obj_t* self = native_pixelbuf(self_in);
+    if (self->post_brightness_stale) {
+        apply_brightness(self);
+    }
     mp_obj_t dest[2 + 1];
     mp_load_method(self_in, MP_QSTR__transmit, dest);
 
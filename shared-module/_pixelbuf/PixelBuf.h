@@ -52,11 +52,16 @@ typedef struct {
     size_t bytes_per_pixel;
     pixelbuf_byteorder_details_t byteorder;
     mp_float_t brightness;
+    // brightness in 8.8 fixed point, between 0 and 256.
+    uint16_t brightness_scale;
     mp_obj_t transmit_buffer_obj;
     // The post_brightness_buffer is offset into the buffer allocated in transmit_buffer_obj to
     // account for any header.
     uint8_t *post_brightness_buffer;
+    // Once brightness has changed, pixels are set in the pre_brightness_buffer and only scaled
+    // into the post_brightness_buffer by show().
     uint8_t *pre_brightness_buffer;
+    bool post_brightness_stale;
     bool auto_write;
 } pixelbuf_pixelbuf_obj_t;
 
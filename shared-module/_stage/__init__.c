@@ -29,23 +29,70 @@
 #include "__init__.h"
 #include "shared-bindings/_stage/Layer.h"
 #include "shared-bindings/_stage/Text.h"
+#include "shared-module/displayio/display_core.h"
 
+// Whether the layer has any pixels within the columns [x0, x1) and rows [y0, y1).
+static bool layer_overlaps(mp_obj_t layer, int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+    int32_t left, top, right, bottom;
+    const mp_obj_type_t *type = ((mp_obj_base_t *)MP_OBJ_TO_PTR(layer))->type;
+    if (type == &mp_type_layer) {
+        layer_obj_t *obj = MP_OBJ_TO_PTR(layer);
+        left = obj->x;
+        top = obj->y;
+        right = left + (obj->width << 4);
+        bottom = top + (obj->height << 4);
+    } else if (type == &mp_type_text) {
+        text_obj_t *obj = MP_OBJ_TO_PTR(layer);
+        left = obj->x;
+        top = obj->y;
+        right = left + (obj->width << 3);
+        bottom = top + (obj->height << 3);
+    } else {
+        return false;
+    }
+    return left < x1 && x0 < right && top < y1 && y0 < bottom;
+}
 
-void render_stage(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+// Sends pixels, in the background when the bus can. Waits for the previous
+// background send first, since only one can be in flight.
+static void send_pixels(displayio_display_obj_t *display, uint16_t *pixels, size_t count, bool *sending) {
+    if (*sending) {
+        display->core.wait_for_send(display->core.bus);
+        *sending = false;
+    }
+    if (display->core.send_async != NULL) {
+        display->core.send_async(display->core.bus, (uint8_t*)pixels, count * 2);
+        *sending = true;
+    } else {
+        display->core.send(display->core.bus, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED,
+                           (uint8_t*)pixels, count * 2);
+    }
+}
+
+static void render_area(displayio_area_t *area,
         mp_obj_t *layers, size_t layers_size,
         uint16_t *buffer, size_t buffer_size,
         displayio_display_obj_t *display,
         uint8_t scale, uint16_t background) {
+    uint16_t x0 = area->x1;
+    uint16_t y0 = area->y1;
+    uint16_t x1 = area->x2;
+    uint16_t y1 = area->y2;
 
+    // Only the layers that reach into the area are asked for pixels, and of
+    // those only the ones that cross the current row.
+    mp_obj_t area_layers[layers_size + 1];
+    size_t area_layers_size = 0;
+    for (size_t layer = 0; layer < layers_size; ++layer) {
+        if (layer_overlaps(layers[layer], x0, y0, x1, y1)) {
+            area_layers[area_layers_size++] = layers[layer];
+        }
+    }
+    mp_obj_t row_layers[area_layers_size + 1];
 
-    displayio_area_t area;
-    area.x1 = x0;
-    area.y1 = y0;
-    area.x2 = x1;
-    area.y2 = y1;
     displayio_display_core_set_region_to_update(
         &display->core, display->set_column_command, display->set_row_command,
-        NO_COMMAND, NO_COMMAND, display->data_as_commands, false, &area);
+        NO_COMMAND, NO_COMMAND, display->data_as_commands, false, area);
 
     while (!displayio_display_core_begin_transaction(&display->core)) {
         RUN_BACKGROUND_TASKS;
@@ -53,13 +100,28 @@ void render_stage(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
     display->core.send(display->core.bus, DISPLAY_COMMAND,
                       CHIP_SELECT_TOGGLE_EVERY_BYTE,
                       &display->write_ram_command, 1);
+
+    // When the bus sends in the background, one half of the buffer is filled
+    // while the other half is being sent.
+    size_t half_size = buffer_size;
+    if (display->core.send_async != NULL && buffer_size >= 2) {
+        half_size = buffer_size / 2;
+    }
+    uint16_t *pixels = buffer;
+    bool sending = false;
     size_t index = 0;
     for (uint16_t y = y0; y < y1; ++y) {
+        size_t row_layers_size = 0;
+        for (size_t layer = 0; layer < area_layers_size; ++layer) {
+            if (layer_overlaps(area_layers[layer], x0, y, x1, y + 1)) {
+                row_layers[row_layers_size++] = area_layers[layer];
+            }
+        }
         for (uint8_t yscale = 0; yscale < scale; ++yscale) {
             for (uint16_t x = x0; x < x1; ++x) {
                 uint16_t c = TRANSPARENT;
-                for (size_t layer = 0; layer < layers_size; ++layer) {
-                    layer_obj_t *obj = MP_OBJ_TO_PTR(layers[layer]);
+                for (size_t layer = 0; layer < row_layers_size; ++layer) {
+                    layer_obj_t *obj = MP_OBJ_TO_PTR(row_layers[layer]);
                     if (obj->base.type == &mp_type_layer) {
                         c = get_layer_pixel(obj, x, y);
                     } else if (obj->base.type == &mp_type_text) {
@@ -73,13 +135,14 @@ void render_stage(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
                     c = background;
                 }
                 for (uint8_t xscale = 0; xscale < scale; ++xscale) {
-                    buffer[index] = c;
+                    pixels[index] = c;
                     index += 1;
                     // The buffer is full, send it.
-                    if (index >= buffer_size) {
-                        display->core.send(display->core.bus, DISPLAY_DATA,
-                                           CHIP_SELECT_UNTOUCHED,
-                                           ((uint8_t*)buffer), buffer_size * 2);
+                    if (index >= half_size) {
+                        send_pixels(display, pixels, half_size, &sending);
+                        if (half_size < buffer_size) {
+                            pixels = pixels == buffer ? buffer + half_size : buffer;
+                        }
                         index = 0;
                     }
                 }
@@ -88,10 +151,49 @@ void render_stage(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
     }
     // Send the remaining data.
     if (index) {
-        display->core.send(display->core.bus, DISPLAY_DATA,
-                           CHIP_SELECT_UNTOUCHED,
-                           ((uint8_t*)buffer), index * 2);
+        send_pixels(display, pixels, index, &sending);
+    }
+    if (sending) {
+        display->core.wait_for_send(display->core.bus);
     }
 
     displayio_display_core_end_transaction(&display->core);
 }
+
+void render_stage(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+        mp_obj_t *layers, size_t layers_size,
+        uint16_t *buffer, size_t buffer_size,
+        displayio_display_obj_t *display,
+        uint8_t scale, uint16_t background) {
+    displayio_area_t area;
+    area.x1 = x0;
+    area.y1 = y0;
+    area.x2 = x1;
+    area.y2 = y1;
+    area.next = NULL;
+    render_area(&area, layers, layers_size, buffer, buffer_size, display,
+                scale, background);
+}
+
+void render_stage_areas(const displayio_area_t *areas,
+        mp_obj_t *layers, size_t layers_size,
+        uint16_t *buffer, size_t buffer_size,
+        displayio_display_obj_t *display,
+        uint8_t scale, uint16_t background) {
+    // Overlapping and nearby areas are merged the same way display refreshes
+    // merge theirs, so each pixel is rendered at most once per frame. The
+    // result is copied out because a background refresh may reuse the core's
+    // list while we wait for the bus.
+    displayio_area_t merged[CIRCUITPY_DISPLAY_REFRESH_AREA_LIMIT];
+    size_t count = 0;
+    for (const displayio_area_t *area = displayio_display_core_coalesce_areas(&display->core, areas);
+            area != NULL; area = area->next) {
+        displayio_area_copy(area, &merged[count]);
+        merged[count].next = NULL;
+        count++;
+    }
+    for (size_t i = 0; i < count; i++) {
+        render_area(&merged[i], layers, layers_size, buffer, buffer_size,
+                    display, scale, background);
+    }
+}
@@ -40,4 +40,12 @@ void render_stage(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
         displayio_display_obj_t *display,
         uint8_t scale, uint16_t background);
 
+// Renders each of the areas, after merging the ones that are cheaper to
+// send together.
+void render_stage_areas(const displayio_area_t *areas,
+        mp_obj_t *layers, size_t layers_size,
+        uint16_t *buffer, size_t buffer_size,
+        displayio_display_obj_t *display,
+        uint8_t scale, uint16_t background);
+
 #endif  // MICROPY_INCLUDED_SHARED_MODULE__STAGE
@@ -56,4 +56,12 @@ typedef struct {
     uint32_t counter;
 } aesio_aes_obj_t;
 
+#if CIRCUITPY_AESIO_HW
+// Ports with an AES engine set CIRCUITPY_AESIO_HW and provide this. It
+// encrypts one 16 byte block in place with a 16 byte key, and returns false
+// if the engine can't take the request so the software cipher runs instead.
+// Every encrypting path (ECB and CBC encryption, and CTR) goes through it.
+bool aesio_hw_encrypt_block(const uint8_t *key, uint8_t *block);
+#endif
+
 #endif // MICROPY_INCLUDED_SHARED_MODULE_AESIO__INIT__H
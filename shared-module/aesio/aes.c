@@ -36,6 +36,9 @@ NOTE:   String length must be evenly divisible by 16byte (str_len % 16 == 0)
 /*****************************************************************************/
 #include <string.h> // CBC mode, for memset
 #include "aes.h"
+#if CIRCUITPY_AESIO_HW
+#include "shared-module/aesio/__init__.h"
+#endif
 
 /*****************************************************************************/
 /* Defines:                                                                  */
@@ -449,6 +452,13 @@ static void InvShiftRows(state_t* state)
 // Cipher is the main function that encrypts the PlainText.
 static void Cipher(state_t* state, const struct AES_ctx* ctx)
 {
+#if CIRCUITPY_AESIO_HW
+  // The first round key is the key itself, so hand that to the port's engine.
+  if (ctx->KeyLength == AES_KEYLEN128 &&
+      aesio_hw_encrypt_block(GetRoundKey(ctx), (uint8_t*)state)) {
+    return;
+  }
+#endif
   const uint8_t* RoundKey = GetRoundKey(ctx);
   uint8_t round = 0;
 
@@ -0,0 +1,88 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "shared-module/audiobusio/PDMStream.h"
+
+#include "py/runtime.h"
+#include "supervisor/shared/translate.h"
+
+void audiobusio_pdmstream_construct(audiobusio_pdmstream_t* self, uint32_t block_size,
+    uint8_t block_count) {
+    self->buffer = m_malloc(block_size * block_count, false);
+    if (self->buffer == NULL) {
+        mp_raise_msg(&mp_type_MemoryError, translate("Couldn't allocate input buffer"));
+    }
+    self->block_size = block_size;
+    self->block_count = block_count;
+    self->write_offset = 0;
+    self->overruns = 0;
+    self->read_block = 0;
+    self->blocks_ready = 0;
+    self->holding = false;
+}
+
+void audiobusio_pdmstream_deinit(audiobusio_pdmstream_t* self) {
+    // A memoryview of a block may still be around, so leave freeing the
+    // buffer to the garbage collector.
+    self->buffer = NULL;
+}
+
+uint8_t* audiobusio_pdmstream_write_pointer(audiobusio_pdmstream_t* self, uint32_t* space) {
+    uint8_t index = (self->read_block + self->blocks_ready) % self->block_count;
+    *space = self->block_size - self->write_offset;
+    return self->buffer + index * self->block_size + self->write_offset;
+}
+
+void audiobusio_pdmstream_commit(audiobusio_pdmstream_t* self, uint32_t length) {
+    self->write_offset += length;
+    if (self->write_offset < self->block_size) {
+        return;
+    }
+    self->write_offset = 0;
+    // Finishing the block needs another one to write next.
+    if (self->holding + self->blocks_ready + 2 <= self->block_count) {
+        self->blocks_ready += 1;
+    } else {
+        self->overruns += 1;
+    }
+}
+
+void audiobusio_pdmstream_overrun(audiobusio_pdmstream_t* self) {
+    self->overruns += 1;
+}
+
+uint8_t* audiobusio_pdmstream_read(audiobusio_pdmstream_t* self) {
+    self->holding = false;
+    if (self->blocks_ready == 0) {
+        return NULL;
+    }
+    uint8_t* block = self->buffer + self->read_block * self->block_size;
+    self->read_block = (self->read_block + 1) % self->block_count;
+    self->blocks_ready -= 1;
+    self->holding = true;
+    return block;
+}
@@ -0,0 +1,76 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_AUDIOBUSIO_PDMSTREAM_H
+#define MICROPY_INCLUDED_SHARED_MODULE_AUDIOBUSIO_PDMSTREAM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Ring of recorded blocks that a PDMIn fills from background tasks while
+// Python reads finished blocks out of it in place.
+//
+// The blocks are, in order: the one lent to Python by the last read (if
+// holding), blocks_ready finished ones starting at read_block, then the one
+// being written. A finished block is dropped, rather than overwriting one
+// that hasn't been read, when there is nowhere to write the next one.
+typedef struct {
+    uint8_t* buffer;
+    uint32_t block_size; // In bytes
+    uint32_t write_offset; // Bytes written to the block being written
+    uint32_t overruns;
+    uint8_t block_count;
+    uint8_t read_block;
+    uint8_t blocks_ready;
+    bool holding;
+} audiobusio_pdmstream_t;
+
+// Fewest blocks that let recording carry on while Python holds one.
+#define AUDIOBUSIO_PDMSTREAM_MIN_BLOCKS (3)
+#define AUDIOBUSIO_PDMSTREAM_MAX_BLOCKS (16)
+
+void audiobusio_pdmstream_construct(audiobusio_pdmstream_t* self, uint32_t block_size,
+    uint8_t block_count);
+void audiobusio_pdmstream_deinit(audiobusio_pdmstream_t* self);
+
+static inline bool audiobusio_pdmstream_active(audiobusio_pdmstream_t* self) {
+    return self->buffer != NULL;
+}
+
+// Where the next bytes go, and how many fit before the block is finished.
+uint8_t* audiobusio_pdmstream_write_pointer(audiobusio_pdmstream_t* self, uint32_t* space);
+// Marks length bytes at the write pointer as written.
+void audiobusio_pdmstream_commit(audiobusio_pdmstream_t* self, uint32_t length);
+// Notes that input was lost before it reached the ring.
+void audiobusio_pdmstream_overrun(audiobusio_pdmstream_t* self);
+
+// Returns the oldest finished block, or NULL if there isn't one yet, and
+// gives back the block returned by the previous call.
+uint8_t* audiobusio_pdmstream_read(audiobusio_pdmstream_t* self);
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_AUDIOBUSIO_PDMSTREAM_H
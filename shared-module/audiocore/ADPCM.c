@@ -0,0 +1,113 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "shared-module/audiocore/ADPCM.h"
+
+#include "py/mpconfig.h"
+#include "py/misc.h"
+
+STATIC const uint16_t step_table[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66,
+    73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408,
+    449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
+    9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+};
+
+STATIC const int8_t index_table[8] = {
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+uint32_t audiocore_adpcm_block_frames(uint32_t length, uint8_t channel_count) {
+    uint32_t header_length = 4 * channel_count;
+    if (length < header_length) {
+        return 0;
+    }
+    uint32_t data_length = length - header_length;
+    if (channel_count == 1) {
+        return 1 + data_length * 2;
+    }
+    // Each channel's codes come in groups of four bytes.
+    return 1 + data_length / header_length * 8;
+}
+
+void audiocore_adpcm_start_block(audiocore_adpcm_t* self, const uint8_t* block, uint32_t length) {
+    self->block = block;
+    self->block_frames = audiocore_adpcm_block_frames(length, self->channel_count);
+    self->frame = 0;
+}
+
+uint32_t audiocore_adpcm_decode(audiocore_adpcm_t* self, int16_t* output, uint32_t frame_count) {
+    uint8_t channel_count = self->channel_count;
+    uint32_t frame = self->frame;
+    uint32_t end = MIN(self->block_frames, frame + frame_count);
+    if (frame == 0 && end > 0) {
+        // The header gives the first frame as is.
+        for (uint8_t c = 0; c < channel_count; c++) {
+            const uint8_t* header = self->block + 4 * c;
+            self->predictor[c] = (int16_t) (header[0] | header[1] << 8);
+            self->step_index[c] = MIN(header[2], 88);
+            *output++ = self->predictor[c];
+        }
+        frame++;
+    }
+    uint32_t group_length = 4 * channel_count;
+    for (; frame < end; frame++) {
+        uint32_t i = frame - 1;
+        const uint8_t* codes = self->block + group_length + (i >> 3) * group_length + ((i & 7) >> 1);
+        uint8_t shift = (i & 1) * 4;
+        for (uint8_t c = 0; c < channel_count; c++) {
+            uint8_t code = (codes[4 * c] >> shift) & 0xf;
+            int32_t step = step_table[self->step_index[c]];
+            // The spec's shift and add approximation of (code + 0.5) * step / 4.
+            int32_t difference = step >> 3;
+            if (code & 1) {
+                difference += step >> 2;
+            }
+            if (code & 2) {
+                difference += step >> 1;
+            }
+            if (code & 4) {
+                difference += step;
+            }
+            int32_t predictor = self->predictor[c];
+            if (code & 8) {
+                predictor -= difference;
+            } else {
+                predictor += difference;
+            }
+            self->predictor[c] = MAX(INT16_MIN, MIN(INT16_MAX, predictor));
+            int32_t step_index = self->step_index[c] + index_table[code & 7];
+            self->step_index[c] = MAX(0, MIN(88, step_index));
+            *output++ = self->predictor[c];
+        }
+    }
+    uint32_t decoded = end - self->frame;
+    self->frame = end;
+    return decoded;
+}
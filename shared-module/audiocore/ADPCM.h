@@ -0,0 +1,60 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_AUDIOCORE_ADPCM_H
+#define MICROPY_INCLUDED_SHARED_MODULE_AUDIOCORE_ADPCM_H
+
+#include <stdint.h>
+
+// WAVE_FORMAT_IMA_ADPCM from the fmt chunk of a wave file.
+#define AUDIOCORE_ADPCM_FORMAT (0x11)
+
+// Decodes IMA ADPCM laid out in blocks as in a wave file. Each block starts
+// with a four byte header per channel holding its first sample and step
+// index, followed by four bit codes, low nibble first, in groups of eight per
+// channel.
+typedef struct {
+    const uint8_t* block; // The block being decoded
+    uint32_t block_frames; // Frames in it
+    uint32_t frame; // Next frame to decode from it
+    int16_t predictor[2];
+    uint8_t step_index[2];
+    uint8_t channel_count;
+} audiocore_adpcm_t;
+
+// Frames in a block of length bytes, which may be a short final block.
+uint32_t audiocore_adpcm_block_frames(uint32_t length, uint8_t channel_count);
+
+// Starts decoding the block of length bytes. It must stay in memory while
+// frames are decoded from it.
+void audiocore_adpcm_start_block(audiocore_adpcm_t* self, const uint8_t* block, uint32_t length);
+
+// Decodes up to frame_count interleaved frames of signed 16 bit samples into
+// output, stopping at the end of the block. Returns how many were decoded.
+uint32_t audiocore_adpcm_decode(audiocore_adpcm_t* self, int16_t* output, uint32_t frame_count);
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_AUDIOCORE_ADPCM_H
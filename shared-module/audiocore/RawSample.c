@@ -28,15 +28,20 @@
 
 #include <stdint.h>
 
+#include "py/misc.h"
+
 #include "shared-module/audiocore/RawSample.h"
 
+#define ADPCM_PCM_LENGTH (256)
+
 void common_hal_audioio_rawsample_construct(audioio_rawsample_obj_t* self,
                                             uint8_t* buffer,
                                             uint32_t len,
                                             uint8_t bytes_per_sample,
                                             bool samples_signed,
                                             uint8_t channel_count,
-                                            uint32_t sample_rate) {
+                                            uint32_t sample_rate,
+                                            uint16_t adpcm_block_length) {
     self->buffer = buffer;
     self->bits_per_sample = bytes_per_sample * 8;
     self->samples_signed = samples_signed;
@@ -44,10 +49,25 @@ void common_hal_audioio_rawsample_construct(audioio_rawsample_obj_t* self,
     self->channel_count = channel_count;
     self->sample_rate = sample_rate;
     self->buffer_read = false;
+    self->loop_start = 0;
+    self->loop_end = 0;
+    self->segmented = false;
+    self->read_count = 0;
+    self->pcm = NULL;
+    self->adpcm_block_length = adpcm_block_length;
+    if (adpcm_block_length > 0) {
+        self->bits_per_sample = 16;
+        self->samples_signed = true;
+        self->adpcm.channel_count = channel_count;
+        self->pcm_length = ADPCM_PCM_LENGTH;
+        self->pcm = m_malloc(2 * self->pcm_length, false);
+        audioio_rawsample_reset_buffer(self, false, 0);
+    }
 }
 
 void common_hal_audioio_rawsample_deinit(audioio_rawsample_obj_t* self) {
     self->buffer = NULL;
+    self->pcm = NULL;
 }
 bool common_hal_audioio_rawsample_deinited(audioio_rawsample_obj_t* self) {
     return self->buffer == NULL;
@@ -67,9 +87,101 @@ uint8_t common_hal_audioio_rawsample_get_channel_count(audioio_rawsample_obj_t*
     return self->channel_count;
 }
 
+// The frames that loop points can refer to. Compressed samples can't loop
+// within themselves.
+uint32_t common_hal_audioio_rawsample_get_frame_count(audioio_rawsample_obj_t* self) {
+    if (self->pcm != NULL) {
+        return 0;
+    }
+    return self->len / (self->channel_count * (self->bits_per_sample / 8));
+}
+
+uint32_t common_hal_audioio_rawsample_get_loop_start(audioio_rawsample_obj_t* self) {
+    return self->loop_start;
+}
+
+void common_hal_audioio_rawsample_set_loop_start(audioio_rawsample_obj_t* self, uint32_t loop_start) {
+    self->loop_start = loop_start;
+}
+
+uint32_t common_hal_audioio_rawsample_get_loop_end(audioio_rawsample_obj_t* self) {
+    return self->loop_end;
+}
+
+void common_hal_audioio_rawsample_set_loop_end(audioio_rawsample_obj_t* self, uint32_t loop_end) {
+    self->loop_end = loop_end;
+}
+
 void audioio_rawsample_reset_buffer(audioio_rawsample_obj_t* self,
                                     bool single_channel,
                                     uint8_t channel) {
+    if (single_channel && channel == 1) {
+        return;
+    }
+    // Loop points only take effect for plays started with them set, because
+    // otherwise the output may be looping the whole buffer by itself.
+    self->segmented = self->pcm != NULL || self->loop_end != 0;
+    // The read count keeps going so that the block last handed out isn't
+    // replaced while it may still be playing.
+    self->position = 0;
+    self->adpcm.frame = 0;
+    self->adpcm.block_frames = 0;
+    self->left_read_count = self->read_count;
+    self->right_read_count = self->read_count;
+}
+
+// Decodes the next half of pcm from the blocks in the buffer.
+STATIC void decode_pcm(audioio_rawsample_obj_t* self, uint8_t index) {
+    int16_t* output = self->pcm + index * (self->pcm_length / sizeof(int16_t));
+    uint32_t frames = self->pcm_length / (self->channel_count * sizeof(int16_t));
+    uint32_t decoded = 0;
+    while (decoded < frames) {
+        if (self->adpcm.frame == self->adpcm.block_frames) {
+            if (self->position >= self->len) {
+                break;
+            }
+            uint32_t block_length = MIN(self->adpcm_block_length, self->len - self->position);
+            audiocore_adpcm_start_block(&self->adpcm, self->buffer + self->position, block_length);
+            self->position += block_length;
+            continue;
+        }
+        decoded += audiocore_adpcm_decode(&self->adpcm, output + decoded * self->channel_count,
+                                          frames - decoded);
+    }
+    uint32_t length = decoded * self->channel_count;
+    // Pad the last half to word align it.
+    if (length % 2 != 0) {
+        output[length] = 0;
+        length++;
+    }
+    self->block[index] = (uint8_t*) output;
+    self->block_length[index] = length * sizeof(int16_t);
+    self->block_last[index] = self->adpcm.frame == self->adpcm.block_frames &&
+                              self->position >= self->len;
+}
+
+// Hands out the buffer up to the loop end and then the loop itself, over and
+// over, until loop_end is cleared. Then the rest of the buffer plays out. The
+// loop points are rounded down to whole words so the mixer can read them.
+STATIC void next_segment(audioio_rawsample_obj_t* self, uint8_t index) {
+    uint32_t frame_size = self->channel_count * (self->bits_per_sample / 8);
+    uint32_t loop_start = (self->loop_start * frame_size) & ~(sizeof(uint32_t) - 1);
+    uint32_t loop_end = (self->loop_end * frame_size) & ~(sizeof(uint32_t) - 1);
+    bool looping = self->loop_end != 0 && loop_start < loop_end && loop_end <= self->len;
+    uint32_t start = self->position;
+    uint32_t end = self->len;
+    if (looping) {
+        if (start >= loop_end) {
+            start = loop_start;
+        }
+        end = loop_end;
+        self->position = loop_start;
+    } else {
+        self->position = self->len;
+    }
+    self->block[index] = self->buffer + start;
+    self->block_length[index] = end - start;
+    self->block_last[index] = !looping;
 }
 
 audioio_get_buffer_result_t audioio_rawsample_get_buffer(audioio_rawsample_obj_t* self,
@@ -77,6 +189,30 @@ audioio_get_buffer_result_t audioio_rawsample_get_buffer(audioio_rawsample_obj_t
                                                          uint8_t channel,
                                                          uint8_t** buffer,
                                                          uint32_t* buffer_length) {
+    if (self->segmented) {
+        if (!single_channel) {
+            channel = 0;
+        }
+        uint32_t channel_read_count = channel == 1 ? self->right_read_count : self->left_read_count;
+        uint8_t index = channel_read_count % 2;
+        if (self->read_count == channel_read_count) {
+            if (self->pcm != NULL) {
+                decode_pcm(self, index);
+            } else {
+                next_segment(self, index);
+            }
+            self->read_count += 1;
+        }
+        *buffer = self->block[index];
+        *buffer_length = self->block_length[index];
+        if (channel == 1) {
+            self->right_read_count += 1;
+            *buffer += (channel % self->channel_count) * (self->bits_per_sample / 8);
+        } else {
+            self->left_read_count += 1;
+        }
+        return self->block_last[index] ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
+    }
     *buffer_length = self->len;
     if (single_channel) {
         *buffer = self->buffer + (channel % self->channel_count) * (self->bits_per_sample / 8);
@@ -89,9 +225,9 @@ audioio_get_buffer_result_t audioio_rawsample_get_buffer(audioio_rawsample_obj_t
 void audioio_rawsample_get_buffer_structure(audioio_rawsample_obj_t* self, bool single_channel,
                                             bool* single_buffer, bool* samples_signed,
                                             uint32_t* max_buffer_length, uint8_t* spacing) {
-    *single_buffer = true;
+    *single_buffer = self->pcm == NULL && self->loop_end == 0;
     *samples_signed = self->samples_signed;
-    *max_buffer_length = self->len;
+    *max_buffer_length = self->pcm == NULL ? self->len : self->pcm_length;
     if (single_channel) {
         *spacing = self->channel_count;
     } else {
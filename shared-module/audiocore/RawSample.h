@@ -30,6 +30,7 @@
 #include "py/obj.h"
 
 #include "shared-module/audiocore/__init__.h"
+#include "shared-module/audiocore/ADPCM.h"
 
 typedef struct {
     mp_obj_base_t base;
@@ -40,6 +41,26 @@ typedef struct {
     uint8_t channel_count;
     uint32_t sample_rate;
     bool buffer_read;
+    // Loop points in frames. loop_end is 0 when there is no loop.
+    uint32_t loop_start;
+    uint32_t loop_end;
+    // Set when the buffer is handed out in pieces, either because it loops or
+    // because it holds IMA ADPCM blocks. The pieces alternate between two
+    // slots so that one may still be playing while the next is prepared.
+    bool segmented;
+    uint8_t* block[2];
+    uint32_t block_length[2];
+    bool block_last[2];
+    uint32_t position; // Of the next piece in buffer
+    uint32_t read_count;
+    uint32_t left_read_count;
+    uint32_t right_read_count;
+    // Only used when the buffer holds IMA ADPCM blocks, which are decoded
+    // into the two halves of pcm.
+    int16_t* pcm;
+    uint32_t pcm_length; // In bytes, for each half
+    uint16_t adpcm_block_length;
+    audiocore_adpcm_t adpcm;
 } audioio_rawsample_obj_t;
 
 
@@ -42,13 +42,15 @@ struct wave_format_chunk {
     uint32_t byte_rate;
     uint16_t block_align;
     uint16_t bits_per_sample;
-    uint16_t extra_params; // Assumed to be zero below.
+    uint16_t extra_params; // Assumed to be zero below, except for IMA ADPCM.
+    uint16_t samples_per_block; // Only for IMA ADPCM
 };
 
 void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t* self,
                                            pyb_file_obj_t* file,
                                            uint8_t *buffer,
-                                           size_t buffer_size) {
+                                           size_t buffer_size,
+                                           uint8_t read_ahead) {
     // Load the wave
     self->file = file;
     uint8_t chunk_header[16];
@@ -77,66 +79,92 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t* self,
     if (bytes_read != format_size) {
     }
 
-    if (format.audio_format != 1 ||
+    bool adpcm = format.audio_format == AUDIOCORE_ADPCM_FORMAT;
+    if (adpcm) {
+        if (format.num_channels < 1 ||
+            format.num_channels > 2 ||
+            format.bits_per_sample != 4 ||
+            format.block_align < 4 * format.num_channels ||
+            format.block_align > 4096) {
+            mp_raise_ValueError(translate("Unsupported format"));
+        }
+    } else if (format.audio_format != 1 ||
         format.num_channels > 2 ||
         format.bits_per_sample > 16 ||
-        (format_size == 18 &&
+        (format_size >= 18 &&
          format.extra_params != 0)) {
         mp_raise_ValueError(translate("Unsupported format"));
     }
     // Get the sample_rate
     self->sample_rate = format.sample_rate;
     self->channel_count = format.num_channels;
-    self->bits_per_sample = format.bits_per_sample;
-
-    // TODO(tannewt): Skip any extra chunks that occur before the data section.
-
-    uint8_t data_tag[4];
-    if (f_read(&self->file->fp, &data_tag, 4, &bytes_read) != FR_OK) {
-        mp_raise_OSError(MP_EIO);
-    }
-    if (bytes_read != 4 ||
-        memcmp((uint8_t *) data_tag, "data", 4) != 0) {
-        mp_raise_ValueError(translate("Data chunk must follow fmt chunk"));
-    }
+    self->bits_per_sample = adpcm ? 16 : format.bits_per_sample;
 
+    // Skip any other chunks, such as the fact chunk of compressed files, before the data.
+    uint8_t chunk_tag[4];
     uint32_t data_length;
-    if (f_read(&self->file->fp, &data_length, 4, &bytes_read) != FR_OK) {
-        mp_raise_OSError(MP_EIO);
-    }
-    if (bytes_read != 4) {
-        mp_raise_ValueError(translate("Invalid file"));
+    while (true) {
+        if (f_read(&self->file->fp, &chunk_tag, 4, &bytes_read) != FR_OK ||
+            (bytes_read == 4 && f_read(&self->file->fp, &data_length, 4, &bytes_read) != FR_OK)) {
+            mp_raise_OSError(MP_EIO);
+        }
+        if (bytes_read != 4) {
+            mp_raise_ValueError(translate("Invalid wave file"));
+        }
+        if (memcmp(chunk_tag, "data", 4) == 0) {
+            break;
+        }
+        // Chunks are padded to an even length.
+        f_lseek(&self->file->fp, self->file->fp.fptr + data_length + (data_length & 1));
     }
+    self->data_length = data_length;
     self->file_length = data_length;
     self->data_start = self->file->fp.fptr;
 
-    // Try to allocate two buffers, one will be loaded from file and the other
-    // DMAed to DAC.
+    self->adpcm_block = NULL;
+    if (adpcm) {
+        self->adpcm.channel_count = self->channel_count;
+        self->adpcm_block_length = format.block_align;
+        uint32_t frames = data_length / format.block_align *
+                          audiocore_adpcm_block_frames(format.block_align, self->channel_count) +
+                          audiocore_adpcm_block_frames(data_length % format.block_align, self->channel_count);
+        self->file_length = frames * self->channel_count * sizeof(int16_t);
+        self->adpcm_block = m_malloc(format.block_align, false);
+        if (self->adpcm_block == NULL) {
+            mp_raise_msg(&mp_type_MemoryError,
+                         translate("Couldn't allocate input buffer"));
+        }
+    }
+
+    // Two blocks are in use by the output at any time, one being played and
+    // one queued. The rest are read ahead from background tasks.
+    self->block_count = read_ahead + 2;
+    self->next_block = 0;
+    self->blocks_ready = 0;
+    self->underruns = 0;
+    self->read_error = false;
     if (buffer_size) {
-        self->len = buffer_size / 2;
+        // Keep every block word aligned.
+        self->len = (buffer_size / self->block_count) & ~(sizeof(uint32_t) - 1);
+        if (self->len == 0) {
+            mp_raise_ValueError_varg(translate("Buffer too short by %d bytes"),
+                                     self->block_count * sizeof(uint32_t) - buffer_size);
+        }
         self->buffer = buffer;
-        self->second_buffer = buffer + self->len;
     } else {
         self->len = 256;
-        self->buffer = m_malloc(self->len, false);
+        self->buffer = m_malloc(self->len * self->block_count, false);
         if (self->buffer == NULL) {
             common_hal_audioio_wavefile_deinit(self);
             mp_raise_msg(&mp_type_MemoryError,
                          translate("Couldn't allocate first buffer"));
         }
-
-        self->second_buffer = m_malloc(self->len, false);
-        if (self->second_buffer == NULL) {
-            common_hal_audioio_wavefile_deinit(self);
-            mp_raise_msg(&mp_type_MemoryError,
-                         translate("Couldn't allocate second buffer"));
-        }
     }
 }
 
 void common_hal_audioio_wavefile_deinit(audioio_wavefile_obj_t* self) {
     self->buffer = NULL;
-    self->second_buffer = NULL;
+    self->adpcm_block = NULL;
 }
 
 bool common_hal_audioio_wavefile_deinited(audioio_wavefile_obj_t* self) {
@@ -160,12 +188,16 @@ uint8_t common_hal_audioio_wavefile_get_channel_count(audioio_wavefile_obj_t* se
     return self->channel_count;
 }
 
+uint32_t common_hal_audioio_wavefile_get_underruns(audioio_wavefile_obj_t* self) {
+    return self->underruns;
+}
+
 bool audioio_wavefile_samples_signed(audioio_wavefile_obj_t* self) {
     return self->bits_per_sample > 8;
 }
 
 uint32_t audioio_wavefile_max_buffer_length(audioio_wavefile_obj_t* self) {
-    return 512;
+    return self->len;
 }
 
 void audioio_wavefile_reset_buffer(audioio_wavefile_obj_t* self,
@@ -174,15 +206,94 @@ void audioio_wavefile_reset_buffer(audioio_wavefile_obj_t* self,
     if (single_channel && channel == 1) {
         return;
     }
-    // We don't reset the buffer index in case we're looping and we have an odd number of buffer
-    // loads
+    // We don't reset the block index in case we're looping and the last blocks handed out are
+    // still being played. Anything read ahead is from the end of the file, though.
     self->bytes_remaining = self->file_length;
+    self->bytes_unread = self->file_length;
+    self->blocks_ready = 0;
+    self->read_error = false;
+    self->adpcm_unread = self->data_length;
+    self->adpcm.frame = 0;
+    self->adpcm.block_frames = 0;
     f_lseek(&self->file->fp, self->data_start);
     self->read_count = 0;
     self->left_read_count = 0;
     self->right_read_count = 0;
 }
 
+// Decodes length bytes worth of samples into block, reading compressed
+// blocks from the file as they are used up.
+STATIC bool read_adpcm(audioio_wavefile_obj_t* self, uint8_t* block, uint32_t length) {
+    int16_t* output = (int16_t*)(void*) block;
+    uint32_t frames = length / (self->channel_count * sizeof(int16_t));
+    while (frames > 0) {
+        if (self->adpcm.frame == self->adpcm.block_frames) {
+            uint32_t block_length = MIN(self->adpcm_block_length, self->adpcm_unread);
+            UINT length_read;
+            if (f_read(&self->file->fp, self->adpcm_block, block_length, &length_read) != FR_OK ||
+                length_read != block_length) {
+                return false;
+            }
+            self->adpcm_unread -= block_length;
+            audiocore_adpcm_start_block(&self->adpcm, self->adpcm_block, block_length);
+            if (self->adpcm.block_frames == 0) {
+                return false;
+            }
+        }
+        uint32_t decoded = audiocore_adpcm_decode(&self->adpcm, output, frames);
+        output += decoded * self->channel_count;
+        frames -= decoded;
+    }
+    return true;
+}
+
+// Reads the next block of the file into the ring, after those already ready.
+STATIC bool fill_block(audioio_wavefile_obj_t* self) {
+    uint8_t index = (self->next_block + self->blocks_ready) % self->block_count;
+    uint8_t *block = self->buffer + index * self->len;
+    uint32_t num_bytes_to_load = MIN(self->len, self->bytes_unread);
+    UINT length_read = num_bytes_to_load;
+    if (self->adpcm_block != NULL) {
+        if (!read_adpcm(self, block, num_bytes_to_load)) {
+            return false;
+        }
+    } else if (f_read(&self->file->fp, block, num_bytes_to_load, &length_read) != FR_OK || length_read != num_bytes_to_load) {
+        return false;
+    }
+    self->bytes_unread -= length_read;
+    // Pad the last block to word align it.
+    if (self->bytes_unread == 0 && length_read % sizeof(uint32_t) != 0) {
+        uint32_t pad = sizeof(uint32_t) - length_read % sizeof(uint32_t);
+        length_read += pad;
+        if (self->bits_per_sample == 8) {
+            for (uint32_t i = 0; i < pad; i++) {
+                block[length_read / sizeof(uint8_t) - i - 1] = 0x80;
+            }
+        } else if (self->bits_per_sample == 16) {
+            // Blocks are word aligned within the buffer.
+            #pragma GCC diagnostic push
+            #pragma GCC diagnostic ignored "-Wcast-align"
+            ((int16_t*) block)[length_read / sizeof(int16_t) - 1] = 0;
+            #pragma GCC diagnostic pop
+        }
+    }
+    self->block_length[index] = length_read;
+    self->blocks_ready += 1;
+    return true;
+}
+
+// Called from background tasks while the file is playing. Reads at most one
+// block so that other background work isn't held up for long.
+void audioio_wavefile_prefetch(audioio_wavefile_obj_t* self) {
+    if (self->buffer == NULL || self->read_error || self->bytes_unread == 0 ||
+        self->blocks_ready >= self->block_count - 2) {
+        return;
+    }
+    if (!fill_block(self)) {
+        self->read_error = true;
+    }
+}
+
 audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t* self,
                                                         bool single_channel,
                                                         uint8_t channel,
@@ -206,54 +317,25 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t*
     }
 
     if (need_more_data) {
-        uint16_t num_bytes_to_load = self->len;
-        if (num_bytes_to_load > self->bytes_remaining) {
-            num_bytes_to_load = self->bytes_remaining;
-        }
-        UINT length_read;
-        if (self->buffer_index % 2 == 1) {
-            *buffer = self->second_buffer;
-        } else {
-            *buffer = self->buffer;
-        }
-        if (f_read(&self->file->fp, *buffer, num_bytes_to_load, &length_read) != FR_OK || length_read != num_bytes_to_load) {
-            return GET_BUFFER_ERROR;
-        }
-        self->bytes_remaining -= length_read;
-        // Pad the last buffer to word align it.
-        if (self->bytes_remaining == 0 && length_read % sizeof(uint32_t) != 0) {
-            uint32_t pad = length_read % sizeof(uint32_t);
-            length_read += pad;
-            if (self->bits_per_sample == 8) {
-                for (uint32_t i = 0; i < pad; i++) {
-                    ((uint8_t*) (*buffer))[length_read / sizeof(uint8_t) - i - 1] = 0x80;
-                }
-            } else if (self->bits_per_sample == 16) {
-                // We know the buffer is aligned because we allocated it onto the heap ourselves.
-                #pragma GCC diagnostic push
-                #pragma GCC diagnostic ignored "-Wcast-align"
-                ((int16_t*) (*buffer))[length_read / sizeof(int16_t) - 1] = 0;
-                #pragma GCC diagnostic pop
+        if (self->blocks_ready == 0) {
+            // Read ahead didn't keep up, so read in line as we always used to.
+            if (self->read_count > 0 && self->block_count > 2) {
+                self->underruns += 1;
+            }
+            if (self->read_error || !fill_block(self)) {
+                return GET_BUFFER_ERROR;
             }
         }
-        *buffer_length = length_read;
-        if (self->buffer_index % 2 == 1) {
-            self->second_buffer_length = length_read;
-        } else {
-            self->buffer_length = length_read;
-        }
-        self->buffer_index += 1;
+        self->next_block = (self->next_block + 1) % self->block_count;
+        self->blocks_ready -= 1;
+        self->bytes_remaining -= MIN(self->len, self->bytes_remaining);
         self->read_count += 1;
     }
 
     uint32_t buffers_back = self->read_count - 1 - channel_read_count;
-    if ((self->buffer_index - buffers_back) % 2 == 0) {
-        *buffer = self->second_buffer;
-        *buffer_length = self->second_buffer_length;
-    } else {
-        *buffer = self->buffer;
-        *buffer_length = self->buffer_length;
-    }
+    uint8_t index = (self->next_block + self->block_count - 1 - buffers_back) % self->block_count;
+    *buffer = self->buffer + index * self->len;
+    *buffer_length = self->block_length[index];
 
     if (channel == 0) {
         self->left_read_count += 1;
@@ -270,7 +352,7 @@ void audioio_wavefile_get_buffer_structure(audioio_wavefile_obj_t* self, bool si
                                            uint32_t* max_buffer_length, uint8_t* spacing) {
     *single_buffer = false;
     *samples_signed = self->bits_per_sample > 8;
-    *max_buffer_length = 512;
+    *max_buffer_length = self->len;
     if (single_channel) {
         *spacing = self->channel_count;
     } else {
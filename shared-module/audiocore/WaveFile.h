@@ -31,18 +31,28 @@
 #include "py/obj.h"
 
 #include "shared-module/audiocore/__init__.h"
+#include "shared-module/audiocore/ADPCM.h"
+
+// Most blocks a WaveFile can read ahead, on top of the two being played.
+#define AUDIOIO_WAVEFILE_MAX_READ_AHEAD (6)
 
 typedef struct {
     mp_obj_base_t base;
+    // Ring of block_count blocks of len bytes each. The two blocks handed out
+    // last are being played; up to block_count - 2 more are read ahead.
     uint8_t* buffer;
-    uint32_t buffer_length;
-    uint8_t* second_buffer;
-    uint32_t second_buffer_length;
-    uint32_t file_length; // In bytes
-    uint16_t data_start; // Where the data values start
+    uint32_t block_length[AUDIOIO_WAVEFILE_MAX_READ_AHEAD + 2];
+    uint8_t block_count;
+    uint8_t next_block; // Next block to hand out
+    uint8_t blocks_ready; // Blocks read ahead of next_block
+    uint32_t file_length; // In bytes, once decoded
+    uint32_t data_start; // Where the data values start
+    uint32_t data_length; // In bytes, as stored in the file
     uint8_t bits_per_sample;
-    uint16_t buffer_index;
-    uint32_t bytes_remaining;
+    uint32_t bytes_remaining; // Not handed out yet
+    uint32_t bytes_unread; // Not read from the file yet
+    uint32_t underruns;
+    bool read_error; // A read ahead failed; reported once the ready blocks run out
 
     uint8_t channel_count;
     uint32_t sample_rate;
@@ -50,6 +60,13 @@ typedef struct {
     uint32_t len;
     pyb_file_obj_t* file;
 
+    // IMA ADPCM data is read a compressed block at a time and decoded into
+    // the blocks above. adpcm_block is NULL for PCM files.
+    uint8_t* adpcm_block;
+    uint16_t adpcm_block_length;
+    uint32_t adpcm_unread; // Compressed bytes not read from the file yet
+    audiocore_adpcm_t adpcm;
+
     uint32_t read_count;
     uint32_t left_read_count;
     uint32_t right_read_count;
@@ -64,6 +81,7 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t*
                                                         uint8_t channel,
                                                         uint8_t** buffer,
                                                         uint32_t* buffer_length); // length in bytes
+void audioio_wavefile_prefetch(audioio_wavefile_obj_t* self);
 void audioio_wavefile_get_buffer_structure(audioio_wavefile_obj_t* self, bool single_channel,
                                            bool* single_buffer, bool* samples_signed,
                                            uint32_t* max_buffer_length, uint8_t* spacing);
@@ -27,6 +27,7 @@
 #include "shared-module/audioio/__init__.h"
 
 #include "py/obj.h"
+#include "supervisor/port.h"
 #include "shared-bindings/audiocore/RawSample.h"
 #include "shared-bindings/audiocore/WaveFile.h"
 #include "shared-module/audiocore/RawSample.h"
@@ -70,3 +71,94 @@ void audiosample_get_buffer_structure(mp_obj_t sample_obj, bool single_channel,
     proto->get_buffer_structure(MP_OBJ_TO_PTR(sample_obj), single_channel, single_buffer,
         samples_signed, max_buffer_length, spacing);
 }
+
+void audiosample_prefetch(mp_obj_t sample_obj) {
+    const audiosample_p_t *proto = mp_proto_get(MP_QSTR_protocol_audiosample, sample_obj);
+    if (proto != NULL && proto->prefetch != NULL) {
+        proto->prefetch(MP_OBJ_TO_PTR(sample_obj));
+    }
+}
+
+void audiosample_set_output_signed(mp_obj_t sample_obj, bool output_signed) {
+    const audiosample_p_t *proto = mp_proto_get_or_throw(MP_QSTR_protocol_audiosample, sample_obj);
+    if (proto->set_output_signed != NULL) {
+        proto->set_output_signed(MP_OBJ_TO_PTR(sample_obj), output_signed);
+    }
+}
+
+void audiocore_stats_clear(audiocore_stats_t* stats) {
+    stats->buffers_filled = 0;
+    stats->underruns = 0;
+    stats->max_get_buffer_time = 0;
+    stats->min_slack = INT32_MAX;
+}
+
+void audiocore_stats_merge(audiocore_stats_t* into, const audiocore_stats_t* from) {
+    into->buffers_filled += from->buffers_filled;
+    into->underruns += from->underruns;
+    into->max_get_buffer_time = MAX(into->max_get_buffer_time, from->max_get_buffer_time);
+    into->min_slack = MIN(into->min_slack, from->min_slack);
+}
+
+#if CIRCUITPY_AUDIOCORE_STATS
+void audiocore_stats_init(audiocore_stats_t* stats, uint32_t sample_rate) {
+    audiocore_stats_clear(stats);
+    stats->next_switch = 0;
+    stats->queued_time = 0;
+    stats->primed_time = 0;
+    stats->sample_rate = sample_rate;
+    stats->running = false;
+}
+
+uint64_t audiocore_stats_now(void) {
+    uint8_t subticks;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    return ticks * 32 + subticks;
+}
+
+void audiocore_stats_got_buffer(audiocore_stats_t* stats, uint64_t started) {
+    uint32_t elapsed = audiocore_stats_now() - started;
+    stats->max_get_buffer_time = MAX(stats->max_get_buffer_time, elapsed);
+}
+
+// Called once a buffer of frames has been handed to the hardware. noticed is
+// when background tasks saw that the hardware had moved on to the buffer
+// before it, which is as late as the move can have happened.
+void audiocore_stats_filled(audiocore_stats_t* stats, uint64_t noticed, uint32_t frames) {
+    uint64_t now = audiocore_stats_now();
+    uint32_t length = 0;
+    if (stats->sample_rate != 0) {
+        length = (uint64_t) frames * 32768 / stats->sample_rate;
+    }
+    stats->buffers_filled++;
+    if (!stats->running) {
+        stats->primed_time += length;
+    } else {
+        uint64_t switched = noticed;
+        if (stats->next_switch != 0 && stats->next_switch < switched) {
+            switched = stats->next_switch;
+        }
+        // This buffer has to be ready before the one queued last runs out.
+        uint64_t deadline = switched + stats->queued_time;
+        int32_t slack = (int64_t) (deadline - now);
+        stats->min_slack = MIN(stats->min_slack, slack);
+        if (slack < 0) {
+            stats->underruns++;
+        }
+        stats->next_switch = deadline;
+    }
+    stats->queued_time = length;
+}
+
+// Called when the hardware starts on the first of the buffers filled so far.
+void audiocore_stats_started(audiocore_stats_t* stats) {
+    stats->running = true;
+    // It moves on to the last of them once it has played the others.
+    stats->next_switch = audiocore_stats_now() + stats->primed_time - stats->queued_time;
+}
+
+// Called when the hardware may have stopped for a while, such as when paused.
+void audiocore_stats_resync(audiocore_stats_t* stats) {
+    stats->next_switch = 0;
+}
+#endif
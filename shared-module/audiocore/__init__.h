@@ -51,6 +51,8 @@ typedef void (*audiosample_get_buffer_structure_fun)(mp_obj_t,
         bool single_channel, bool* single_buffer,
         bool* samples_signed, uint32_t *max_buffer_length,
         uint8_t* spacing);
+typedef void (*audiosample_prefetch_fun)(mp_obj_t);
+typedef void (*audiosample_set_output_signed_fun)(mp_obj_t, bool output_signed);
 
 typedef struct _audiosample_p_t {
     MP_PROTOCOL_HEAD // MP_QSTR_protocol_audiosample
@@ -60,6 +62,13 @@ typedef struct _audiosample_p_t {
     audiosample_reset_buffer_fun reset_buffer;
     audiosample_get_buffer_fun get_buffer;
     audiosample_get_buffer_structure_fun get_buffer_structure;
+    // Optional. Called from background tasks while the sample is playing, to
+    // get data ready before get_buffer asks for it.
+    audiosample_prefetch_fun prefetch;
+    // Optional. Asks for buffers of the given signedness, so that the player
+    // can use them as is rather than converting a copy. get_buffer_structure
+    // reports what the sample will actually produce.
+    audiosample_set_output_signed_fun set_output_signed;
 } audiosample_p_t;
 
 uint32_t audiosample_sample_rate(mp_obj_t sample_obj);
@@ -73,5 +82,46 @@ audioio_get_buffer_result_t audiosample_get_buffer(mp_obj_t sample_obj,
 void audiosample_get_buffer_structure(mp_obj_t sample_obj, bool single_channel,
                                       bool* single_buffer, bool* samples_signed,
                                       uint32_t* max_buffer_length, uint8_t* spacing);
+void audiosample_prefetch(mp_obj_t sample_obj);
+void audiosample_set_output_signed(mp_obj_t sample_obj, bool output_signed);
+
+// How well an audio output's background tasks keep up with its hardware, for
+// audiocore.stats(). Times are in 1/32768ths of a second, the resolution of
+// port_get_raw_ticks().
+typedef struct {
+    uint32_t buffers_filled;
+    uint32_t underruns; // Buffers that were filled after the hardware needed them
+    uint32_t max_get_buffer_time;
+    int32_t min_slack; // Least time left over after filling a buffer
+    // When the hardware is expected to move on to the next buffer, which is
+    // refined whenever background tasks notice the move sooner. 0 if unknown.
+    uint64_t next_switch;
+    uint32_t queued_time; // Length of the buffer filled last
+    uint32_t primed_time; // Length of the buffers filled before the hardware started
+    uint32_t sample_rate;
+    bool running;
+} audiocore_stats_t;
+
+#if CIRCUITPY_AUDIOCORE_STATS
+// Outputs call these around filling their buffers.
+void audiocore_stats_init(audiocore_stats_t* stats, uint32_t sample_rate);
+uint64_t audiocore_stats_now(void);
+void audiocore_stats_got_buffer(audiocore_stats_t* stats, uint64_t started);
+void audiocore_stats_filled(audiocore_stats_t* stats, uint64_t noticed, uint32_t frames);
+void audiocore_stats_started(audiocore_stats_t* stats);
+void audiocore_stats_resync(audiocore_stats_t* stats);
+#else
+static inline void audiocore_stats_init(audiocore_stats_t* stats, uint32_t sample_rate) {}
+static inline uint64_t audiocore_stats_now(void) {
+    return 0;
+}
+static inline void audiocore_stats_got_buffer(audiocore_stats_t* stats, uint64_t started) {}
+static inline void audiocore_stats_filled(audiocore_stats_t* stats, uint64_t noticed, uint32_t frames) {}
+static inline void audiocore_stats_started(audiocore_stats_t* stats) {}
+static inline void audiocore_stats_resync(audiocore_stats_t* stats) {}
+#endif
+// And these when audiocore.stats() asks for them.
+void audiocore_stats_clear(audiocore_stats_t* stats);
+void audiocore_stats_merge(audiocore_stats_t* into, const audiocore_stats_t* from);
 
 #endif  // MICROPY_INCLUDED_SHARED_MODULE_AUDIOCORE__INIT__H
@@ -0,0 +1,144 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "shared-bindings/audiofilters/Biquad.h"
+
+#include <string.h>
+
+#include "py/runtime.h"
+
+STATIC int32_t to_fixed(float coefficient) {
+    return (int32_t) (coefficient * (1 << AUDIOFILTERS_BIQUAD_SHIFT));
+}
+
+void common_hal_audiofilters_biquad_construct(audiofilters_biquad_obj_t* self,
+        mp_obj_t sample, const float coefficients[5]) {
+    audiofilters_stream_construct(&self->stream, sample);
+    memset(self->x1, 0, sizeof(self->x1));
+    memset(self->x2, 0, sizeof(self->x2));
+    memset(self->y1, 0, sizeof(self->y1));
+    memset(self->y2, 0, sizeof(self->y2));
+    memset(self->error, 0, sizeof(self->error));
+    common_hal_audiofilters_biquad_set_coefficients(self, coefficients);
+}
+
+void common_hal_audiofilters_biquad_deinit(audiofilters_biquad_obj_t* self) {
+    audiofilters_stream_deinit(&self->stream);
+}
+
+bool common_hal_audiofilters_biquad_deinited(audiofilters_biquad_obj_t* self) {
+    return audiofilters_stream_deinited(&self->stream);
+}
+
+void common_hal_audiofilters_biquad_get_coefficients(audiofilters_biquad_obj_t* self, float coefficients[5]) {
+    memcpy(coefficients, self->coefficients, sizeof(self->coefficients));
+}
+
+void common_hal_audiofilters_biquad_set_coefficients(audiofilters_biquad_obj_t* self, const float coefficients[5]) {
+    memcpy(self->coefficients, coefficients, sizeof(self->coefficients));
+    self->b0 = to_fixed(coefficients[0]);
+    self->b1 = to_fixed(coefficients[1]);
+    self->b2 = to_fixed(coefficients[2]);
+    self->a1 = to_fixed(coefficients[3]);
+    self->a2 = to_fixed(coefficients[4]);
+}
+
+uint32_t common_hal_audiofilters_biquad_get_sample_rate(audiofilters_biquad_obj_t* self) {
+    return audiosample_sample_rate(self->stream.sample);
+}
+
+uint8_t common_hal_audiofilters_biquad_get_channel_count(audiofilters_biquad_obj_t* self) {
+    return self->stream.channel_count;
+}
+
+uint8_t common_hal_audiofilters_biquad_get_bits_per_sample(audiofilters_biquad_obj_t* self) {
+    return self->stream.bits_per_sample;
+}
+
+STATIC void biquad_process(void* filter, const uint8_t* src, uint8_t* dst, uint32_t length) {
+    audiofilters_biquad_obj_t* self = filter;
+    const audiofilters_stream_t* stream = &self->stream;
+    uint32_t channel_count = stream->channel_count;
+    uint32_t frame_count = length / (channel_count * stream->bits_per_sample / 8);
+    for (uint32_t c = 0; c < channel_count; c++) {
+        // Keep the history in registers for the length of the block.
+        int32_t x1 = self->x1[c], x2 = self->x2[c], y1 = self->y1[c], y2 = self->y2[c];
+        int32_t error = self->error[c];
+        for (uint32_t i = c; i < frame_count * channel_count; i += channel_count) {
+            int32_t x0 = audiofilters_load(stream, src, i);
+            int64_t acc = (int64_t) self->b0 * x0 + (int64_t) self->b1 * x1 +
+                          (int64_t) self->b2 * x2 - (int64_t) self->a1 * y1 -
+                          (int64_t) self->a2 * y2 + error;
+            int32_t y0 = acc >> AUDIOFILTERS_BIQUAD_SHIFT;
+            error = acc - ((int64_t) y0 << AUDIOFILTERS_BIQUAD_SHIFT);
+            // Saturate the output but not the history, so that clipping
+            // doesn't feed back into the filter.
+            audiofilters_store(stream, dst, i, y0);
+            x2 = x1;
+            x1 = x0;
+            y2 = y1;
+            y1 = MIN(MAX(y0, -(1 << 20)), 1 << 20);
+        }
+        self->x1[c] = x1;
+        self->x2[c] = x2;
+        self->y1[c] = y1;
+        self->y2[c] = y2;
+        self->error[c] = error;
+    }
+}
+
+void audiofilters_biquad_reset_buffer(audiofilters_biquad_obj_t* self,
+                                      bool single_channel,
+                                      uint8_t channel) {
+    audiofilters_stream_reset_buffer(&self->stream, single_channel, channel);
+}
+
+audioio_get_buffer_result_t audiofilters_biquad_get_buffer(audiofilters_biquad_obj_t* self,
+                                                           bool single_channel,
+                                                           uint8_t channel,
+                                                           uint8_t** buffer,
+                                                           uint32_t* buffer_length) {
+    return audiofilters_stream_get_buffer(&self->stream, single_channel, channel, buffer,
+                                          buffer_length, biquad_process, self);
+}
+
+void audiofilters_biquad_get_buffer_structure(audiofilters_biquad_obj_t* self, bool single_channel,
+                                              bool* single_buffer, bool* samples_signed,
+                                              uint32_t* max_buffer_length, uint8_t* spacing) {
+    audiofilters_stream_get_buffer_structure(&self->stream, single_channel, single_buffer,
+                                             samples_signed, max_buffer_length, spacing);
+}
+
+void audiofilters_biquad_prefetch(audiofilters_biquad_obj_t* self) {
+    if (self->stream.sample != MP_OBJ_NULL) {
+        audiosample_prefetch(self->stream.sample);
+    }
+}
+
+void audiofilters_biquad_set_output_signed(audiofilters_biquad_obj_t* self, bool output_signed) {
+    audiofilters_stream_set_output_signed(&self->stream, output_signed);
+}
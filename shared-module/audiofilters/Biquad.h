@@ -0,0 +1,66 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_AUDIOFILTERS_BIQUAD_H
+#define MICROPY_INCLUDED_SHARED_MODULE_AUDIOFILTERS_BIQUAD_H
+
+#include "py/obj.h"
+
+#include "shared-module/audiofilters/__init__.h"
+
+// Coefficients are fixed point with this many fractional bits, which leaves
+// room for the magnitudes up to 2 that b1 and a1 reach.
+#define AUDIOFILTERS_BIQUAD_SHIFT (29)
+
+typedef struct {
+    mp_obj_base_t base;
+    audiofilters_stream_t stream;
+    float coefficients[5];
+    int32_t b0, b1, b2, a1, a2;
+    // Direct form I history, per channel.
+    int32_t x1[2], x2[2], y1[2], y2[2];
+    // The bits that the last output dropped, carried into the next one so
+    // that rounding doesn't build up in the feedback path.
+    int32_t error[2];
+} audiofilters_biquad_obj_t;
+
+// These are not available from Python because it may be called in an interrupt.
+void audiofilters_biquad_reset_buffer(audiofilters_biquad_obj_t* self,
+                                      bool single_channel,
+                                      uint8_t channel);
+audioio_get_buffer_result_t audiofilters_biquad_get_buffer(audiofilters_biquad_obj_t* self,
+                                                           bool single_channel,
+                                                           uint8_t channel,
+                                                           uint8_t** buffer,
+                                                           uint32_t* buffer_length); // length in bytes
+void audiofilters_biquad_get_buffer_structure(audiofilters_biquad_obj_t* self, bool single_channel,
+                                              bool* single_buffer, bool* samples_signed,
+                                              uint32_t* max_buffer_length, uint8_t* spacing);
+void audiofilters_biquad_prefetch(audiofilters_biquad_obj_t* self);
+void audiofilters_biquad_set_output_signed(audiofilters_biquad_obj_t* self, bool output_signed);
+
+#endif  // MICROPY_INCLUDED_SHARED_MODULE_AUDIOFILTERS_BIQUAD_H
@@ -0,0 +1,132 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "shared-bindings/audiofilters/FIR.h"
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "supervisor/shared/translate.h"
+
+void common_hal_audiofilters_fir_construct(audiofilters_fir_obj_t* self,
+        mp_obj_t sample, const float* taps, uint16_t tap_count) {
+    audiofilters_stream_construct(&self->stream, sample);
+    self->tap_count = tap_count;
+    self->taps = m_new(int16_t, tap_count);
+    for (uint16_t i = 0; i < tap_count; i++) {
+        float tap = taps[tap_count - 1 - i] * (1 << 15);
+        self->taps[i] = MIN(MAX(tap, INT16_MIN), INT16_MAX);
+    }
+    uint32_t frame_size = self->stream.channel_count * self->stream.bits_per_sample / 8;
+    self->history_length = tap_count - 1 + self->stream.len / frame_size;
+    self->history = m_malloc(self->history_length * self->stream.channel_count * sizeof(int16_t), false);
+    if (self->history == NULL) {
+        common_hal_audiofilters_fir_deinit(self);
+        mp_raise_msg(&mp_type_MemoryError, translate("Couldn't allocate input buffer"));
+    }
+    memset(self->history, 0, (tap_count - 1) * self->stream.channel_count * sizeof(int16_t));
+}
+
+void common_hal_audiofilters_fir_deinit(audiofilters_fir_obj_t* self) {
+    audiofilters_stream_deinit(&self->stream);
+    self->taps = NULL;
+    self->history = NULL;
+}
+
+bool common_hal_audiofilters_fir_deinited(audiofilters_fir_obj_t* self) {
+    return audiofilters_stream_deinited(&self->stream);
+}
+
+uint32_t common_hal_audiofilters_fir_get_sample_rate(audiofilters_fir_obj_t* self) {
+    return audiosample_sample_rate(self->stream.sample);
+}
+
+uint8_t common_hal_audiofilters_fir_get_channel_count(audiofilters_fir_obj_t* self) {
+    return self->stream.channel_count;
+}
+
+uint8_t common_hal_audiofilters_fir_get_bits_per_sample(audiofilters_fir_obj_t* self) {
+    return self->stream.bits_per_sample;
+}
+
+STATIC void fir_process(void* filter, const uint8_t* src, uint8_t* dst, uint32_t length) {
+    audiofilters_fir_obj_t* self = filter;
+    const audiofilters_stream_t* stream = &self->stream;
+    uint32_t channel_count = stream->channel_count;
+    uint32_t frame_count = length / (channel_count * stream->bits_per_sample / 8);
+    uint32_t kept = self->tap_count - 1;
+    const int16_t* taps = self->taps;
+    for (uint32_t c = 0; c < channel_count; c++) {
+        // Append the block to this channel's history, so that every output
+        // sample is a plain dot product of the taps and a run of history.
+        int16_t* history = self->history + c * self->history_length;
+        for (uint32_t i = 0; i < frame_count; i++) {
+            history[kept + i] = audiofilters_load(stream, src, i * channel_count + c);
+        }
+        for (uint32_t i = 0; i < frame_count; i++) {
+            const int16_t* h = history + i;
+            int64_t acc = 0;
+            for (uint32_t k = 0; k < self->tap_count; k++) {
+                acc += (int32_t) taps[k] * h[k];
+            }
+            audiofilters_store(stream, dst, i * channel_count + c, acc >> 15);
+        }
+        memmove(history, history + frame_count, kept * sizeof(int16_t));
+    }
+}
+
+void audiofilters_fir_reset_buffer(audiofilters_fir_obj_t* self,
+                                   bool single_channel,
+                                   uint8_t channel) {
+    audiofilters_stream_reset_buffer(&self->stream, single_channel, channel);
+}
+
+audioio_get_buffer_result_t audiofilters_fir_get_buffer(audiofilters_fir_obj_t* self,
+                                                        bool single_channel,
+                                                        uint8_t channel,
+                                                        uint8_t** buffer,
+                                                        uint32_t* buffer_length) {
+    return audiofilters_stream_get_buffer(&self->stream, single_channel, channel, buffer,
+                                          buffer_length, fir_process, self);
+}
+
+void audiofilters_fir_get_buffer_structure(audiofilters_fir_obj_t* self, bool single_channel,
+                                           bool* single_buffer, bool* samples_signed,
+                                           uint32_t* max_buffer_length, uint8_t* spacing) {
+    audiofilters_stream_get_buffer_structure(&self->stream, single_channel, single_buffer,
+                                             samples_signed, max_buffer_length, spacing);
+}
+
+void audiofilters_fir_prefetch(audiofilters_fir_obj_t* self) {
+    if (self->stream.sample != MP_OBJ_NULL) {
+        audiosample_prefetch(self->stream.sample);
+    }
+}
+
+void audiofilters_fir_set_output_signed(audiofilters_fir_obj_t* self, bool output_signed) {
+    audiofilters_stream_set_output_signed(&self->stream, output_signed);
+}
@@ -0,0 +1,64 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_AUDIOFILTERS_FIR_H
+#define MICROPY_INCLUDED_SHARED_MODULE_AUDIOFILTERS_FIR_H
+
+#include "py/obj.h"
+
+#include "shared-module/audiofilters/__init__.h"
+
+// Most taps an FIR filter can have. Each tap costs a multiply per sample.
+#define AUDIOFILTERS_FIR_MAX_TAPS (64)
+
+typedef struct {
+    mp_obj_base_t base;
+    audiofilters_stream_t stream;
+    int16_t* taps; // Q15, in reverse so they line up with the history
+    uint16_t tap_count;
+    // The last tap_count - 1 input samples of each channel, oldest first,
+    // followed by room for a block of new ones.
+    int16_t* history;
+    uint32_t history_length; // per channel, in samples
+} audiofilters_fir_obj_t;
+
+// These are not available from Python because it may be called in an interrupt.
+void audiofilters_fir_reset_buffer(audiofilters_fir_obj_t* self,
+                                   bool single_channel,
+                                   uint8_t channel);
+audioio_get_buffer_result_t audiofilters_fir_get_buffer(audiofilters_fir_obj_t* self,
+                                                        bool single_channel,
+                                                        uint8_t channel,
+                                                        uint8_t** buffer,
+                                                        uint32_t* buffer_length); // length in bytes
+void audiofilters_fir_get_buffer_structure(audiofilters_fir_obj_t* self, bool single_channel,
+                                           bool* single_buffer, bool* samples_signed,
+                                           uint32_t* max_buffer_length, uint8_t* spacing);
+void audiofilters_fir_prefetch(audiofilters_fir_obj_t* self);
+void audiofilters_fir_set_output_signed(audiofilters_fir_obj_t* self, bool output_signed);
+
+#endif  // MICROPY_INCLUDED_SHARED_MODULE_AUDIOFILTERS_FIR_H
@@ -0,0 +1,192 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "shared-module/audiofilters/__init__.h"
+
+#include <math.h>
+
+#include "py/runtime.h"
+#include "supervisor/shared/translate.h"
+
+void audiofilters_stream_construct(audiofilters_stream_t* self, mp_obj_t sample) {
+    self->sample = sample;
+    self->bits_per_sample = audiosample_bits_per_sample(sample);
+    self->channel_count = audiosample_channel_count(sample);
+
+    bool single_buffer;
+    uint8_t spacing;
+    audiosample_get_buffer_structure(sample, false, &single_buffer, &self->samples_signed,
+                                     &self->len, &spacing);
+
+    self->buffer[0] = m_malloc(self->len, false);
+    if (self->buffer[0] == NULL) {
+        audiofilters_stream_deinit(self);
+        mp_raise_msg(&mp_type_MemoryError, translate("Couldn't allocate first buffer"));
+    }
+    self->buffer[1] = m_malloc(self->len, false);
+    if (self->buffer[1] == NULL) {
+        audiofilters_stream_deinit(self);
+        mp_raise_msg(&mp_type_MemoryError, translate("Couldn't allocate second buffer"));
+    }
+    self->next_buffer = 0;
+    self->buffer_length[0] = 0;
+    self->buffer_length[1] = 0;
+    self->result = GET_BUFFER_MORE_DATA;
+}
+
+void audiofilters_stream_deinit(audiofilters_stream_t* self) {
+    self->buffer[0] = NULL;
+    self->buffer[1] = NULL;
+    self->sample = MP_OBJ_NULL;
+}
+
+bool audiofilters_stream_deinited(audiofilters_stream_t* self) {
+    return self->buffer[0] == NULL;
+}
+
+void audiofilters_stream_reset_buffer(audiofilters_stream_t* self, bool single_channel, uint8_t channel) {
+    if (single_channel && channel == 1) {
+        return;
+    }
+    // Filter state carries on, so a looping sample joins up without a click.
+    audiosample_reset_buffer(self->sample, false, 0);
+    self->read_count = 0;
+    self->left_read_count = 0;
+    self->right_read_count = 0;
+}
+
+audioio_get_buffer_result_t audiofilters_stream_get_buffer(audiofilters_stream_t* self,
+        bool single_channel, uint8_t channel, uint8_t** buffer, uint32_t* buffer_length,
+        audiofilters_process_fun process, void* filter) {
+    if (!single_channel) {
+        channel = 0;
+    }
+
+    uint32_t channel_read_count = self->left_read_count;
+    if (channel == 1) {
+        channel_read_count = self->right_read_count;
+    }
+
+    // Both channels of a stereo sample share each block, so only the first
+    // channel to ask for a block gets a new one filtered.
+    if (self->read_count == channel_read_count) {
+        uint8_t* src;
+        uint32_t src_length;
+        self->result = audiosample_get_buffer(self->sample, false, 0, &src, &src_length);
+        if (self->result == GET_BUFFER_ERROR) {
+            return GET_BUFFER_ERROR;
+        }
+        uint32_t frame_size = self->channel_count * self->bits_per_sample / 8;
+        src_length = MIN(src_length, self->len);
+        src_length -= src_length % frame_size;
+        uint8_t index = self->next_buffer;
+        process(filter, src, (uint8_t*) self->buffer[index], src_length);
+        self->buffer_length[index] = src_length;
+        self->next_buffer = !index;
+        self->read_count += 1;
+    }
+
+    // The channel that's behind reads the block the other has moved past.
+    uint8_t index = !self->next_buffer;
+    if (self->read_count - 1 != channel_read_count) {
+        index = self->next_buffer;
+    }
+    *buffer = (uint8_t*) self->buffer[index];
+    *buffer_length = self->buffer_length[index];
+
+    if (channel == 0) {
+        self->left_read_count += 1;
+    } else if (channel == 1) {
+        self->right_read_count += 1;
+        *buffer = *buffer + self->bits_per_sample / 8;
+    }
+    return self->result;
+}
+
+void audiofilters_stream_get_buffer_structure(audiofilters_stream_t* self, bool single_channel,
+        bool* single_buffer, bool* samples_signed, uint32_t* max_buffer_length, uint8_t* spacing) {
+    *single_buffer = false;
+    *samples_signed = self->samples_signed;
+    *max_buffer_length = self->len;
+    if (single_channel) {
+        *spacing = self->channel_count;
+    } else {
+        *spacing = 1;
+    }
+}
+
+// Filters work on signed samples internally, so pass the request on and
+// produce whatever the wrapped sample ends up producing.
+void audiofilters_stream_set_output_signed(audiofilters_stream_t* self, bool output_signed) {
+    if (self->sample == MP_OBJ_NULL) {
+        return;
+    }
+    audiosample_set_output_signed(self->sample, output_signed);
+    bool single_buffer;
+    uint32_t max_buffer_length;
+    uint8_t spacing;
+    audiosample_get_buffer_structure(self->sample, false, &single_buffer, &self->samples_signed,
+                                     &max_buffer_length, &spacing);
+}
+
+// From the Audio EQ Cookbook by Robert Bristow-Johnson.
+void audiofilters_design_biquad(audiofilters_biquad_kind_t kind, float frequency,
+        float sample_rate, float q, float coefficients[5]) {
+    float w0 = 2 * (float) M_PI * frequency / sample_rate;
+    float cos_w0 = cosf(w0);
+    float alpha = sinf(w0) / (2 * q);
+    float b0, b1, b2;
+    switch (kind) {
+        case AUDIOFILTERS_LOWPASS:
+            b0 = (1 - cos_w0) / 2;
+            b1 = 1 - cos_w0;
+            b2 = b0;
+            break;
+        case AUDIOFILTERS_HIGHPASS:
+            b0 = (1 + cos_w0) / 2;
+            b1 = -(1 + cos_w0);
+            b2 = b0;
+            break;
+        case AUDIOFILTERS_BANDPASS:
+            b0 = alpha;
+            b1 = 0;
+            b2 = -alpha;
+            break;
+        case AUDIOFILTERS_NOTCH:
+        default:
+            b0 = 1;
+            b1 = -2 * cos_w0;
+            b2 = 1;
+            break;
+    }
+    float a0 = 1 + alpha;
+    coefficients[0] = b0 / a0;
+    coefficients[1] = b1 / a0;
+    coefficients[2] = b2 / a0;
+    coefficients[3] = -2 * cos_w0 / a0;
+    coefficients[4] = (1 - alpha) / a0;
+}
@@ -0,0 +1,103 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_AUDIOFILTERS__INIT__H
+#define MICROPY_INCLUDED_SHARED_MODULE_AUDIOFILTERS__INIT__H
+
+#include <stdint.h>
+
+#include "py/obj.h"
+
+#include "shared-module/audiocore/__init__.h"
+
+// Filters wrap another sample. Each block of the wrapped sample is filtered
+// into one of two buffers of the filter's own, in the same format, and
+// handed on to whatever is playing the filter.
+typedef struct {
+    mp_obj_t sample;
+    uint32_t* buffer[2];
+    uint32_t len; // in bytes
+    uint8_t next_buffer;
+    uint8_t bits_per_sample;
+    uint8_t channel_count;
+    bool samples_signed;
+
+    uint32_t buffer_length[2];
+    audioio_get_buffer_result_t result;
+
+    uint32_t read_count;
+    uint32_t left_read_count;
+    uint32_t right_read_count;
+} audiofilters_stream_t;
+
+// Filters length bytes of whole frames from src into dst.
+typedef void (*audiofilters_process_fun)(void* filter, const uint8_t* src, uint8_t* dst, uint32_t length);
+
+void audiofilters_stream_construct(audiofilters_stream_t* self, mp_obj_t sample);
+void audiofilters_stream_deinit(audiofilters_stream_t* self);
+bool audiofilters_stream_deinited(audiofilters_stream_t* self);
+void audiofilters_stream_reset_buffer(audiofilters_stream_t* self, bool single_channel, uint8_t channel);
+audioio_get_buffer_result_t audiofilters_stream_get_buffer(audiofilters_stream_t* self,
+        bool single_channel, uint8_t channel, uint8_t** buffer, uint32_t* buffer_length,
+        audiofilters_process_fun process, void* filter);
+void audiofilters_stream_get_buffer_structure(audiofilters_stream_t* self, bool single_channel,
+        bool* single_buffer, bool* samples_signed, uint32_t* max_buffer_length, uint8_t* spacing);
+void audiofilters_stream_set_output_signed(audiofilters_stream_t* self, bool output_signed);
+
+// Samples are filtered as signed 16 bit whatever their format.
+static inline int32_t audiofilters_load(const audiofilters_stream_t* self, const uint8_t* src, uint32_t i) {
+    if (self->bits_per_sample == 16) {
+        uint16_t raw = ((const uint16_t*) (const void*) src)[i];
+        return (int16_t) (self->samples_signed ? raw : raw ^ 0x8000);
+    }
+    uint8_t raw = src[i];
+    return (int8_t) (self->samples_signed ? raw : raw ^ 0x80) * 256;
+}
+
+static inline void audiofilters_store(const audiofilters_stream_t* self, uint8_t* dst, uint32_t i, int32_t value) {
+    value = MIN(MAX(value, INT16_MIN), INT16_MAX);
+    if (self->bits_per_sample == 16) {
+        uint16_t raw = value;
+        ((uint16_t*) (void*) dst)[i] = self->samples_signed ? raw : raw ^ 0x8000;
+    } else {
+        uint8_t raw = value >> 8;
+        dst[i] = self->samples_signed ? raw : raw ^ 0x80;
+    }
+}
+
+typedef enum {
+    AUDIOFILTERS_LOWPASS,
+    AUDIOFILTERS_HIGHPASS,
+    AUDIOFILTERS_BANDPASS,
+    AUDIOFILTERS_NOTCH,
+} audiofilters_biquad_kind_t;
+
+// Fills coefficients with b0, b1, b2, a1 and a2, normalised so that a0 is 1.
+void audiofilters_design_biquad(audiofilters_biquad_kind_t kind, float frequency,
+        float sample_rate, float q, float coefficients[5]);
+
+#endif  // MICROPY_INCLUDED_SHARED_MODULE_AUDIOFILTERS__INIT__H
@@ -30,6 +30,7 @@
 #include "shared-bindings/audiomixer/MixerVoice.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #include "py/runtime.h"
 #include "shared-module/audiocore/__init__.h"
@@ -58,6 +59,7 @@ void common_hal_audiomixer_mixer_construct(audiomixer_mixer_obj_t* self,
 
     self->bits_per_sample = bits_per_sample;
     self->samples_signed = samples_signed;
+    self->output_signed = samples_signed;
     self->channel_count = channel_count;
     self->sample_rate = sample_rate;
     self->voice_count = voice_count;
@@ -101,6 +103,10 @@ void audiomixer_mixer_reset_buffer(audiomixer_mixer_obj_t* self,
     }
 }
 
+// Samples are mixed two at a time, packed as a pair of signed 16-bit halves
+// in a word.  Cortex-M4 and up have SIMD instructions for this; other cores
+// get a portable version that gives the same results.
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
 __attribute__((always_inline))
 static inline uint32_t add16signed(uint32_t a, uint32_t b) {
     return __QADD16(a, b);
@@ -112,24 +118,57 @@ static inline uint32_t mult16signed(uint32_t val, int32_t mul) {
     int32_t hi, lo;
     enum { bits = 16 }; // saturate to 16 bits
     enum { shift = 15 }; // shift is done automatically
-    asm volatile("smulwb %0, %1, %2" : "=r" (lo) : "r" (mul), "r" (val));
-    asm volatile("smulwt %0, %1, %2" : "=r" (hi) : "r" (mul), "r" (val));
-    asm volatile("ssat %0, %1, %2, asr %3" : "=r" (lo) : "I" (bits), "r" (lo), "I" (shift));
-    asm volatile("ssat %0, %1, %2, asr %3" : "=r" (hi) : "I" (bits), "r" (hi), "I" (shift));
-    asm volatile("pkhbt %0, %1, %2, lsl #16" : "=r" (val) : "r" (lo), "r" (hi)); // pack
+    // Not volatile so that the compiler can interleave these with the loads
+    // and stores of the surrounding loop.
+    asm("smulwb %0, %1, %2" : "=r" (lo) : "r" (mul), "r" (val));
+    asm("smulwt %0, %1, %2" : "=r" (hi) : "r" (mul), "r" (val));
+    asm("ssat %0, %1, %2, asr %3" : "=r" (lo) : "I" (bits), "r" (lo), "I" (shift));
+    asm("ssat %0, %1, %2, asr %3" : "=r" (hi) : "I" (bits), "r" (hi), "I" (shift));
+    asm("pkhbt %0, %1, %2, lsl #16" : "=r" (val) : "r" (lo), "r" (hi)); // pack
     return val;
 }
+#else
+static inline int32_t saturate16(int32_t val) {
+    if (val > INT16_MAX) {
+        return INT16_MAX;
+    }
+    if (val < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return val;
+}
+
+static inline uint32_t pack16(int32_t lo, int32_t hi) {
+    return ((uint32_t) hi << 16) | ((uint32_t) lo & 0xffff);
+}
+
+__attribute__((always_inline))
+static inline uint32_t add16signed(uint32_t a, uint32_t b) {
+    int32_t lo = saturate16((int16_t) a + (int16_t) b);
+    int32_t hi = saturate16((int16_t) (a >> 16) + (int16_t) (b >> 16));
+    return pack16(lo, hi);
+}
 
+__attribute__((always_inline))
+static inline uint32_t mult16signed(uint32_t val, int32_t mul) {
+    int32_t lo = saturate16(((int16_t) val * mul) >> 15);
+    int32_t hi = saturate16(((int16_t) (val >> 16) * mul) >> 15);
+    return pack16(lo, hi);
+}
+#endif
+
+// Adding 0x80 (0x8000) to every lane modulo 256 (65536) only flips the top
+// bit, so the sign conversions are a single XOR on every core.
 static inline uint32_t tounsigned8(uint32_t val) {
-    return __UADD8(val, 0x80808080);
+    return val ^ 0x80808080;
 }
 
 static inline uint32_t tounsigned16(uint32_t val) {
-    return __UADD16(val, 0x80008000);
+    return val ^ 0x80008000;
 }
 
 static inline uint32_t tosigned16(uint32_t val) {
-    return __UADD16(val, 0x80008000);
+    return val ^ 0x80008000;
 }
 
 static inline uint32_t unpack8(uint16_t val) {
@@ -140,86 +179,192 @@ static inline uint32_t pack8(uint32_t val) {
     return ((val & 0xff000000) >> 16) | ((val & 0xff00) >> 8);
 }
 
-static void mix_down_one_voice(audiomixer_mixer_obj_t* self,
+// When the level is full scale, the multiply leaves samples unchanged.
+#define LEVEL_UNITY (1 << 15)
+
+// Mixes n words of 16-bit samples from src into word_buffer.  The first
+// voice overwrites the buffer; the rest are added to it with saturation.
+static void mix_16(uint32_t* word_buffer, const uint32_t* src, uint32_t n,
+        uint16_t level, bool samples_signed, bool voices_active) {
+    uint32_t flip = samples_signed ? 0 : 0x80008000;
+    if (level >= LEVEL_UNITY) {
+        if (!voices_active) {
+            for (uint32_t i = 0; i < n; i++) {
+                word_buffer[i] = src[i] ^ flip;
+            }
+        } else {
+            for (uint32_t i = 0; i < n; i++) {
+                word_buffer[i] = add16signed(src[i] ^ flip, word_buffer[i]);
+            }
+        }
+    } else if (!voices_active) {
+        for (uint32_t i = 0; i < n; i++) {
+            word_buffer[i] = mult16signed(src[i] ^ flip, level);
+        }
+    } else {
+        for (uint32_t i = 0; i < n; i++) {
+            word_buffer[i] = add16signed(mult16signed(src[i] ^ flip, level), word_buffer[i]);
+        }
+    }
+}
+
+// Mixes n words of 8-bit samples, widening each pair to 16 bits to mix it.
+static void mix_8(uint32_t* word_buffer, const uint32_t* src, uint32_t n,
+        uint16_t level, bool samples_signed, bool voices_active) {
+    uint16_t *hword_buffer = (uint16_t*)word_buffer;
+    const uint16_t *hsrc = (const uint16_t*)src;
+    uint32_t flip = samples_signed ? 0 : 0x80008000;
+    for (uint32_t i = 0; i < n * 2; i++) {
+        uint32_t word = unpack8(hsrc[i]) ^ flip;
+        if (level < LEVEL_UNITY) {
+            word = mult16signed(word, level);
+        }
+        if (voices_active) {
+            word = add16signed(word, unpack8(hword_buffer[i]));
+        }
+        hword_buffer[i] = pack8(word);
+    }
+}
+
+// Loads the voice's next buffer, restarting a looping sample when it ends.
+// Returns false once a sample that doesn't loop has finished.
+static bool load_buffer(audiomixer_mixervoice_obj_t* voice) {
+    if (!voice->more_data) {
+        if (voice->loop) {
+            audiosample_reset_buffer(voice->sample, false, 0);
+        } else {
+            voice->sample = NULL;
+            return false;
+        }
+    }
+    audioio_get_buffer_result_t result = audiosample_get_buffer(voice->sample, false, 0, (uint8_t**) &voice->remaining_buffer, &voice->buffer_length);
+    // Track length in terms of words.
+    voice->buffer_length /= sizeof(uint32_t);
+    voice->more_data = result == GET_BUFFER_MORE_DATA;
+    voice->frame_in_word = 0;
+    return true;
+}
+
+// Moves the voice on by one sample frame: the next frame becomes the previous
+// one and a new next frame is read, as signed 16 bit, from the sample.
+static bool read_frame(audiomixer_mixer_obj_t* self, audiomixer_mixervoice_obj_t* voice,
+        uint32_t frame_size, uint32_t frames_per_word) {
+    while (voice->buffer_length == 0) {
+        if (!load_buffer(voice)) {
+            return false;
+        }
+    }
+    uint8_t *p = (uint8_t*) voice->remaining_buffer + voice->frame_in_word * frame_size;
+    for (uint32_t c = 0; c < self->channel_count; c++) {
+        voice->frames[0][c] = voice->frames[1][c];
+        if (self->bits_per_sample == 16) {
+            uint16_t raw = ((uint16_t*) p)[c];
+            if (!self->samples_signed) {
+                raw ^= 0x8000;
+            }
+            voice->frames[1][c] = (int16_t) raw;
+        } else {
+            uint8_t raw = p[c];
+            if (!self->samples_signed) {
+                raw ^= 0x80;
+            }
+            voice->frames[1][c] = (int8_t) raw * 256;
+        }
+    }
+    voice->frame_in_word++;
+    if (voice->frame_in_word == frames_per_word) {
+        voice->frame_in_word = 0;
+        voice->remaining_buffer++;
+        voice->buffer_length--;
+    }
+    return true;
+}
+
+// Mixes a voice whose sample doesn't advance exactly one frame per output
+// frame, interpolating linearly between the two frames either side of each
+// output frame.  Works in place from the voice's own buffers, so nothing is
+// allocated while refilling.
+static void mix_down_one_voice_resampled(audiomixer_mixer_obj_t* self,
         audiomixer_mixervoice_obj_t* voice, bool voices_active,
         uint32_t* word_buffer, uint32_t length) {
-    while (length != 0) {
-        if (voice->buffer_length == 0) {
-            if (!voice->more_data) {
-                if (voice->loop) {
-                    audiosample_reset_buffer(voice->sample, false, 0);
-                } else {
-                    voice->sample = NULL;
-                    break;
-                }
+    uint32_t frame_size = self->channel_count * self->bits_per_sample / 8;
+    uint32_t frames_per_word = sizeof(uint32_t) / frame_size;
+    uint32_t frame_count = length * frames_per_word;
+    uint8_t *out = (uint8_t*) word_buffer;
+    int32_t level = voice->level;
+    uint32_t i = 0;
+    for (; i < frame_count; i++) {
+        while (voice->phase >= (1 << 16)) {
+            if (!read_frame(self, voice, frame_size, frames_per_word)) {
+                break;
             }
-            if (voice->sample) {
-                // Load another buffer
-                audioio_get_buffer_result_t result = audiosample_get_buffer(voice->sample, false, 0, (uint8_t**) &voice->remaining_buffer, &voice->buffer_length);
-                // Track length in terms of words.
-                voice->buffer_length /= sizeof(uint32_t);
-                voice->more_data = result == GET_BUFFER_MORE_DATA;
+            voice->phase -= 1 << 16;
+        }
+        if (voice->sample == NULL) {
+            break;
+        }
+        // Halve the fraction so the product fits in 32 bits.
+        int32_t fraction = voice->phase >> 1;
+        for (uint32_t c = 0; c < self->channel_count; c++) {
+            int32_t a = voice->frames[0][c];
+            int32_t b = voice->frames[1][c];
+            int32_t v = a + (((b - a) * fraction) >> 15);
+            v = (v * level) >> 15;
+            if (self->bits_per_sample == 16) {
+                int16_t *sample = (int16_t*) out + c;
+                if (voices_active) {
+                    v += *sample;
+                }
+                *sample = MIN(MAX(v, INT16_MIN), INT16_MAX);
+            } else {
+                int8_t *sample = (int8_t*) out + c;
+                v >>= 8;
+                if (voices_active) {
+                    v += *sample;
+                }
+                *sample = MIN(MAX(v, INT8_MIN), INT8_MAX);
             }
         }
+        out += frame_size;
+        voice->phase += voice->step;
+    }
+
+    if (i < frame_count && !voices_active) {
+        memset(out, 0, (frame_count - i) * frame_size);
+    }
+}
+
+static void mix_down_one_voice(audiomixer_mixer_obj_t* self,
+        audiomixer_mixervoice_obj_t* voice, bool voices_active,
+        uint32_t* word_buffer, uint32_t length) {
+    if (voice->step != (1 << 16)) {
+        mix_down_one_voice_resampled(self, voice, voices_active, word_buffer, length);
+        return;
+    }
+    // Whole words are mixed here, so restart resampling cleanly if the rate
+    // changes later on.
+    voice->phase = 2 << 16;
+    voice->frame_in_word = 0;
+    while (length != 0) {
+        if (voice->buffer_length == 0 && !load_buffer(voice)) {
+            break;
+        }
 
         uint32_t n = MIN(voice->buffer_length, length);
         uint32_t *src = voice->remaining_buffer;
         uint16_t level = voice->level;
 
-        // First active voice gets copied over verbatim.
-        if (!voices_active) {
-            if (MP_LIKELY(self->bits_per_sample == 16)) {
-                if (MP_LIKELY(self->samples_signed)) {
-                    for (uint32_t i = 0; i<n; i++) {
-                        uint32_t v = src[i];
-                        word_buffer[i] = mult16signed(v, level);
-                    }
-                } else {
-                    for (uint32_t i = 0; i<n; i++) {
-                        uint32_t v = src[i];
-                        v = tosigned16(v);
-                        word_buffer[i] = mult16signed(v, level);
-                    }
-                }
-            } else {
-                uint16_t *hword_buffer = (uint16_t*)word_buffer;
-                uint16_t *hsrc = (uint16_t*)src;
-                for (uint32_t i = 0; i<n*2; i++) {
-                    uint32_t word = unpack8(hsrc[i]);
-                    if (MP_LIKELY(!self->samples_signed)) {
-                        word = tosigned16(word);
-                    }
-                    word = mult16signed(word, level);
-                    hword_buffer[i] = pack8(word);
+        if (level == 0) {
+            // A muted voice still consumes its samples but adds nothing.
+            if (!voices_active) {
+                for (uint32_t i = 0; i < n; i++) {
+                    word_buffer[i] = 0;
                 }
             }
+        } else if (MP_LIKELY(self->bits_per_sample == 16)) {
+            mix_16(word_buffer, src, n, level, self->samples_signed, voices_active);
         } else {
-            if (MP_LIKELY(self->bits_per_sample == 16)) {
-                if (MP_LIKELY(self->samples_signed)) {
-                    for (uint32_t i = 0; i<n; i++) {
-                        uint32_t word = src[i];
-                        word_buffer[i] = add16signed(mult16signed(word, level), word_buffer[i]);
-                    }
-                } else {
-                    for (uint32_t i = 0; i<n; i++) {
-                        uint32_t word = src[i];
-                        word = tosigned16(word);
-                        word_buffer[i] = add16signed(mult16signed(word, level), word_buffer[i]);
-                        }
-                }
-            } else {
-                uint16_t *hword_buffer = (uint16_t*)word_buffer;
-                uint16_t *hsrc = (uint16_t*)src;
-                for (uint32_t i = 0; i<n*2; i++) {
-                    uint32_t word = unpack8(hsrc[i]);
-                    if (MP_LIKELY(!self->samples_signed)) {
-                        word = tosigned16(word);
-                    }
-                    word = mult16signed(word, level);
-                    word = add16signed(word, unpack8(hword_buffer[i]));
-                    hword_buffer[i] = pack8(word);
-                }
-            }
+            mix_8(word_buffer, src, n, level, self->samples_signed, voices_active);
         }
         length -= n;
         word_buffer += n;
@@ -277,7 +422,7 @@ audioio_get_buffer_result_t audiomixer_mixer_get_buffer(audiomixer_mixer_obj_t*
             }
         }
 
-        if (!self->samples_signed) {
+        if (!self->output_signed) {
             if (self->bits_per_sample == 16) {
                 for (uint32_t i = 0; i < length; i++) {
                     word_buffer[i] = tounsigned16(word_buffer[i]);
@@ -306,11 +451,25 @@ audioio_get_buffer_result_t audiomixer_mixer_get_buffer(audiomixer_mixer_obj_t*
     return GET_BUFFER_MORE_DATA;
 }
 
+void audiomixer_mixer_prefetch(audiomixer_mixer_obj_t* self) {
+    for (int32_t v = 0; v < self->voice_count; v++) {
+        audiomixer_mixervoice_obj_t* voice = MP_OBJ_TO_PTR(self->voice[v]);
+        if (voice->sample) {
+            audiosample_prefetch(voice->sample);
+        }
+    }
+}
+
+// Voices are mixed as signed samples, so either signedness costs the same.
+void audiomixer_mixer_set_output_signed(audiomixer_mixer_obj_t* self, bool output_signed) {
+    self->output_signed = output_signed;
+}
+
 void audiomixer_mixer_get_buffer_structure(audiomixer_mixer_obj_t* self, bool single_channel,
                                         bool* single_buffer, bool* samples_signed,
                                         uint32_t* max_buffer_length, uint8_t* spacing) {
     *single_buffer = false;
-    *samples_signed = self->samples_signed;
+    *samples_signed = self->output_signed;
     *max_buffer_length = self->len;
     if (single_channel) {
         *spacing = self->channel_count;
@@ -39,7 +39,8 @@ typedef struct {
     uint32_t len; // in words
     uint8_t bits_per_sample;
     bool use_first_buffer;
-    bool samples_signed;
+    bool samples_signed; // Of the voices' samples
+    bool output_signed;
     uint8_t channel_count;
     uint32_t sample_rate;
 
@@ -62,6 +63,8 @@ audioio_get_buffer_result_t audiomixer_mixer_get_buffer(audiomixer_mixer_obj_t*
                                                          uint8_t channel,
                                                          uint8_t** buffer,
                                                          uint32_t* buffer_length); // length in bytes
+void audiomixer_mixer_prefetch(audiomixer_mixer_obj_t* self);
+void audiomixer_mixer_set_output_signed(audiomixer_mixer_obj_t* self, bool output_signed);
 void audiomixer_mixer_get_buffer_structure(audiomixer_mixer_obj_t* self, bool single_channel,
                                             bool* single_buffer, bool* samples_signed,
                                             uint32_t* max_buffer_length, uint8_t* spacing);
@@ -35,6 +35,8 @@
 void common_hal_audiomixer_mixervoice_construct(audiomixer_mixervoice_obj_t *self) {
     self->sample = NULL;
     self->level = 1 << 15;
+    self->rate = 1.0f;
+    self->step = 1 << 16;
 }
 
 void common_hal_audiomixer_mixervoice_set_parent(audiomixer_mixervoice_obj_t* self, audiomixer_mixer_obj_t *parent) {
@@ -49,16 +51,37 @@ void common_hal_audiomixer_mixervoice_set_level(audiomixer_mixervoice_obj_t* sel
 	self->level = level * (1 << 15);
 }
 
-void common_hal_audiomixer_mixervoice_play(audiomixer_mixervoice_obj_t* self, mp_obj_t sample, bool loop) {
-    if (audiosample_sample_rate(sample) != self->parent->sample_rate) {
-        mp_raise_ValueError(translate("The sample's sample rate does not match the mixer's"));
+float common_hal_audiomixer_mixervoice_get_rate(audiomixer_mixervoice_obj_t* self) {
+    return self->rate;
+}
+
+void common_hal_audiomixer_mixervoice_set_rate(audiomixer_mixervoice_obj_t* self, float rate) {
+    self->rate = rate;
+    audiomixer_mixervoice_update_step(self);
+}
+
+void audiomixer_mixervoice_update_step(audiomixer_mixervoice_obj_t* self) {
+    if (self->sample == NULL) {
+        return;
     }
+    float step = (float) audiosample_sample_rate(self->sample) / self->parent->sample_rate * self->rate;
+    step = step * (1 << 16) + 0.5f;
+    if (step < 1) {
+        step = 1;
+    } else if (step > AUDIOMIXER_MAX_STEP) {
+        step = AUDIOMIXER_MAX_STEP;
+    }
+    self->step = step;
+}
+
+void common_hal_audiomixer_mixervoice_play(audiomixer_mixervoice_obj_t* self, mp_obj_t sample, bool loop) {
     if (audiosample_channel_count(sample) != self->parent->channel_count) {
         mp_raise_ValueError(translate("The sample's channel count does not match the mixer's"));
     }
     if (audiosample_bits_per_sample(sample) != self->parent->bits_per_sample) {
         mp_raise_ValueError(translate("The sample's bits_per_sample does not match the mixer's"));
     }
+    audiosample_set_output_signed(sample, self->parent->samples_signed);
     bool single_buffer;
     bool samples_signed;
     uint32_t max_buffer_length;
@@ -70,6 +93,11 @@ void common_hal_audiomixer_mixervoice_play(audiomixer_mixervoice_obj_t* self, mp
     }
     self->sample = sample;
     self->loop = loop;
+    audiomixer_mixervoice_update_step(self);
+    // Start two frames back so that the first output frame reads both of
+    // the frames it interpolates between.
+    self->phase = 2 << 16;
+    self->frame_in_word = 0;
 
     audiosample_reset_buffer(sample, false, 0);
     audioio_get_buffer_result_t result = audiosample_get_buffer(sample, false, 0, (uint8_t**) &self->remaining_buffer, &self->buffer_length);
@@ -31,6 +31,10 @@
 #include "shared-module/audiomixer/__init__.h"
 #include "shared-module/audiomixer/Mixer.h"
 
+// Limits how many sample frames a voice can move through per output frame,
+// which bounds the work done for each one.
+#define AUDIOMIXER_MAX_STEP (16 << 16)
+
 typedef struct {
 	mp_obj_base_t base;
 	audiomixer_mixer_obj_t *parent;
@@ -40,7 +44,17 @@ typedef struct {
     uint32_t* remaining_buffer;
     uint32_t buffer_length;
     uint16_t level;
+
+    // Resampling state. step is how far to move through the sample per output
+    // frame, in 16.16 fixed point; exactly 1 << 16 uses the direct mix.
+    float rate;
+    uint32_t step;
+    uint32_t phase; // position between frames[0] and frames[1], 16.16
+    uint8_t frame_in_word; // frames of remaining_buffer[0] already read
+    int16_t frames[2][2]; // [previous/next][channel], as signed 16 bit
 } audiomixer_mixervoice_obj_t;
 
+void audiomixer_mixervoice_update_step(audiomixer_mixervoice_obj_t* self);
+
 
 #endif /* SHARED_MODULE_AUDIOMIXER_MIXERVOICE_H_ */
@@ -63,6 +63,7 @@ STATIC bool mp3file_update_inbuf(audiomp3_mp3file_obj_t* self) {
         memmove(self->inbuf, self->inbuf + self->inbuf_offset,
             self->inbuf_length - self->inbuf_offset);
         self->inbuf_offset = 0;
+        self->inbuf_position = f_tell(&self->file->fp) - (new_end_of_data - self->inbuf);
 
         UINT to_read = end_of_buffer - new_end_of_data;
         UINT bytes_read = 0;
@@ -91,6 +92,15 @@ STATIC bool mp3file_update_inbuf(audiomp3_mp3file_obj_t* self) {
 #define BYTES_LEFT(self) (self->inbuf_length - self->inbuf_offset)
 #define CONSUME(self, n) (self->inbuf_offset += n)
 
+// Consumes n bytes, seeking the file past any that haven't been read yet.
+STATIC void mp3file_skip(audiomp3_mp3file_obj_t* self, uint32_t n) {
+    uint32_t in_buffer = MIN(n, BYTES_LEFT(self));
+    CONSUME(self, in_buffer);
+    if (n > in_buffer && !self->eof) {
+        f_lseek(&self->file->fp, f_tell(&self->file->fp) + n - in_buffer);
+    }
+}
+
 // http://id3.org/d3v2.3.0
 // http://id3.org/id3v2.3.0
 STATIC void mp3file_skip_id3v2(audiomp3_mp3file_obj_t* self) {
@@ -154,10 +164,93 @@ STATIC bool mp3file_get_next_frame_info(audiomp3_mp3file_obj_t* self, MP3FrameIn
     return err == ERR_MP3_NONE;
 }
 
+// Returns the length in bytes of the Layer III frame whose header is at
+// data, or 0 if it isn't a valid header or is free format, so that frames
+// can be skipped without decoding them.
+STATIC uint32_t mp3file_frame_length(const uint8_t* data) {
+    static const uint16_t bitrates[2][15] = {
+        {0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160}, // MPEG 2 and 2.5
+        {0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320}, // MPEG 1
+    };
+    static const uint16_t sample_rates[3] = {44100, 48000, 32000};
+    uint8_t version = (data[1] >> 3) & 3;
+    uint8_t layer = (data[1] >> 1) & 3;
+    uint8_t bitrate_index = data[2] >> 4;
+    uint8_t sample_rate_index = (data[2] >> 2) & 3;
+    if (data[0] != 0xff || (data[1] & 0xe0) != 0xe0 || version == 1 || layer != 1 ||
+        bitrate_index == 0 || bitrate_index == 15 || sample_rate_index == 3) {
+        return 0;
+    }
+    bool mpeg1 = version == 3;
+    // MPEG 2 halves the sample rate and MPEG 2.5 quarters it.
+    uint8_t shift = mpeg1 ? 0 : (version == 2 ? 1 : 2);
+    uint32_t sample_rate = sample_rates[sample_rate_index] >> shift;
+    uint32_t padding = (data[2] >> 1) & 1;
+    return (mpeg1 ? 144000 : 72000) * bitrates[mpeg1][bitrate_index] / sample_rate + padding;
+}
+
+// Notes where the frame at the read position starts, if it is the next one
+// the index is waiting for.
+STATIC void mp3file_index_frame(audiomp3_mp3file_obj_t* self) {
+    if (self->frame_number != self->index_count * self->index_stride) {
+        return;
+    }
+    if (self->index_count == AUDIOMP3_INDEX_LENGTH) {
+        for (size_t i = 0; i < AUDIOMP3_INDEX_LENGTH / 2; i++) {
+            self->frame_offsets[i] = self->frame_offsets[2 * i];
+        }
+        self->index_count = AUDIOMP3_INDEX_LENGTH / 2;
+        self->index_stride *= 2;
+    }
+    self->frame_offsets[self->index_count++] = self->inbuf_position + self->inbuf_offset;
+}
+
+// Steps over the next frame using only its header. Returns false at the end
+// of the file.
+STATIC bool mp3file_skip_frame(audiomp3_mp3file_obj_t* self) {
+    while (mp3file_find_sync_word(self)) {
+        uint32_t length = 0;
+        if (BYTES_LEFT(self) >= 4) {
+            length = mp3file_frame_length(READ_PTR(self));
+        }
+        if (length == 0) {
+            CONSUME(self, 1);
+            continue;
+        }
+        mp3file_index_frame(self);
+        mp3file_skip(self, length);
+        self->frame_number += 1;
+        return true;
+    }
+    return false;
+}
+
+// Moves the read position to the start of the given frame, from the closest
+// indexed frame before it. Anything decoded ahead is dropped.
+STATIC void mp3file_seek_frame(audiomp3_mp3file_obj_t* self, uint32_t frame) {
+    uint32_t entry = MIN(frame / self->index_stride, self->index_count - 1u);
+    f_lseek(&self->file->fp, self->frame_offsets[entry]);
+    self->frame_number = entry * self->index_stride;
+    self->inbuf_offset = self->inbuf_length;
+    self->eof = false;
+    self->other_channel = -1;
+    self->frames_ready = 0;
+    self->decode_done = false;
+    self->started = false;
+    // Drop the bit reservoir of the old position, so that the first frames
+    // are skipped rather than decoded from the wrong data.
+    self->decoder->mainDataBytes = 0;
+    mp3file_update_inbuf(self);
+    while (self->frame_number < frame && mp3file_skip_frame(self)) {
+    }
+}
+
 void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t* self,
                                            pyb_file_obj_t* file,
                                            uint8_t *buffer,
-                                           size_t buffer_size) {
+                                           size_t buffer_size,
+                                           uint8_t read_ahead) {
+    self->output_signed = true;
     // XXX Adafruit_MP3 uses a 2kB input buffer and two 4kB output buffers.
     // for a whopping total of 10kB buffers (+mp3 decoder state and frame buffer)
     // At 44kHz, that's 23ms of output audio data.
@@ -168,7 +261,7 @@ void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t* self,
     // than the two 4kB output buffers, except that the alignment allows to
     // never allocate that extra frame buffer.
 
-    self->inbuf_length = 2048;
+    self->inbuf_length = CIRCUITPY_AUDIOMP3_INBUF_SIZE;
     self->inbuf_offset = self->inbuf_length;
     self->inbuf = m_malloc(self->inbuf_length, false);
     if (self->inbuf == NULL) {
@@ -183,26 +276,23 @@ void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t* self,
                      translate("Couldn't allocate decoder"));
     }
 
+    // Two frames are in use by the output at any time, one being played
+    // and one queued. The rest are decoded ahead from background tasks.
+    self->frame_count = read_ahead + 2;
+    self->next_frame = 0;
+    self->underruns = 0;
     if ((intptr_t)buffer & 1) {
         buffer += 1; buffer_size -= 1;
     }
-    if (buffer_size >= 2 * MAX_BUFFER_LEN) {
-        self->buffers[0] = (int16_t*)(void*)buffer;
-        self->buffers[1] = (int16_t*)(void*)(buffer + MAX_BUFFER_LEN);
+    if (buffer_size >= self->frame_count * MAX_BUFFER_LEN) {
+        self->frames = buffer;
     } else {
-        self->buffers[0] = m_malloc(MAX_BUFFER_LEN, false);
-        if (self->buffers[0] == NULL) {
+        self->frames = m_malloc(self->frame_count * MAX_BUFFER_LEN, false);
+        if (self->frames == NULL) {
             common_hal_audiomp3_mp3file_deinit(self);
             mp_raise_msg(&mp_type_MemoryError,
                          translate("Couldn't allocate first buffer"));
         }
-
-        self->buffers[1] = m_malloc(MAX_BUFFER_LEN, false);
-        if (self->buffers[1] == NULL) {
-            common_hal_audiomp3_mp3file_deinit(self);
-            mp_raise_msg(&mp_type_MemoryError,
-                         translate("Couldn't allocate second buffer"));
-        }
     }
 
     common_hal_audiomp3_mp3file_set_file(self, file);
@@ -214,20 +304,23 @@ void common_hal_audiomp3_mp3file_set_file(audiomp3_mp3file_obj_t* self, pyb_file
     self->inbuf_offset = self->inbuf_length;
     self->eof = 0;
     self->other_channel = -1;
+    self->frames_ready = 0;
+    self->decode_done = false;
+    self->started = false;
     mp3file_update_inbuf(self);
+    mp3file_skip_id3v2(self);
     mp3file_find_sync_word(self);
-    // It **SHOULD** not be necessary to do this; the buffer should be filled
-    // with fresh content before it is returned by get_buffer().  The fact that
-    // this is necessary to avoid a glitch at the start of playback of a second
-    // track using the same decoder object means there's still a bug in
-    // get_buffer() that I didn't understand.
-    memset(self->buffers[0], 0, MAX_BUFFER_LEN);
-    memset(self->buffers[1], 0, MAX_BUFFER_LEN);
     MP3FrameInfo fi;
     if(!mp3file_get_next_frame_info(self, &fi)) {
         mp_raise_msg(&mp_type_RuntimeError,
                      translate("Failed to parse MP3 file"));
     }
+    // Start a fresh index at the first frame, so looping and seeking never
+    // need to look at the tags again.
+    self->frame_number = 0;
+    self->index_count = 0;
+    self->index_stride = 16;
+    mp3file_index_frame(self);
 
     self->sample_rate = fi.samprate;
     self->channel_count = fi.nChans;
@@ -239,13 +332,12 @@ void common_hal_audiomp3_mp3file_deinit(audiomp3_mp3file_obj_t* self) {
     MP3FreeDecoder(self->decoder);
     self->decoder = NULL;
     self->inbuf = NULL;
-    self->buffers[0] = NULL;
-    self->buffers[1] = NULL;
+    self->frames = NULL;
     self->file = NULL;
 }
 
 bool common_hal_audiomp3_mp3file_deinited(audiomp3_mp3file_obj_t* self) {
-    return self->buffers[0] == NULL;
+    return self->frames == NULL;
 }
 
 uint32_t common_hal_audiomp3_mp3file_get_sample_rate(audiomp3_mp3file_obj_t* self) {
@@ -265,8 +357,21 @@ uint8_t common_hal_audiomp3_mp3file_get_channel_count(audiomp3_mp3file_obj_t* se
     return self->channel_count;
 }
 
+uint32_t common_hal_audiomp3_mp3file_get_underruns(audiomp3_mp3file_obj_t* self) {
+    return self->underruns;
+}
+
+void common_hal_audiomp3_mp3file_seek(audiomp3_mp3file_obj_t* self, float seconds) {
+    uint32_t samples_per_frame = self->frame_buffer_size / sizeof(int16_t) / self->channel_count;
+    uint32_t frame = 0;
+    if (seconds > 0) {
+        frame = seconds * self->sample_rate / samples_per_frame;
+    }
+    mp3file_seek_frame(self, frame);
+}
+
 bool audiomp3_mp3file_samples_signed(audiomp3_mp3file_obj_t* self) {
-    return true;
+    return self->output_signed;
 }
 
 void audiomp3_mp3file_reset_buffer(audiomp3_mp3file_obj_t* self,
@@ -275,15 +380,54 @@ void audiomp3_mp3file_reset_buffer(audiomp3_mp3file_obj_t* self,
     if (single_channel && channel == 1) {
         return;
     }
-    // We don't reset the buffer index in case we're looping and we have an odd number of buffer
-    // loads
-    f_lseek(&self->file->fp, 0);
-    self->inbuf_offset = self->inbuf_length;
-    self->eof = 0;
-    self->other_channel = -1;
-    mp3file_update_inbuf(self);
-    mp3file_skip_id3v2(self);
-    mp3file_find_sync_word(self);
+    // We don't reset the frame index in case we're looping and the last frames handed out are
+    // still being played.
+    mp3file_seek_frame(self, 0);
+}
+
+// Decodes the next frame into the ring, after those already ready. Frames
+// that only fill the bit reservoir, as after a seek, are skipped.
+STATIC bool mp3file_decode_frame(audiomp3_mp3file_obj_t* self) {
+    uint8_t index = (self->next_frame + self->frames_ready) % self->frame_count;
+    int16_t *buffer = (int16_t *)(void *)(self->frames + index * MAX_BUFFER_LEN);
+    int err;
+    do {
+        mp3file_skip_id3v2(self);
+        if (!mp3file_find_sync_word(self)) {
+            return false;
+        }
+        mp3file_index_frame(self);
+        int bytes_left = BYTES_LEFT(self);
+        uint8_t *inbuf = READ_PTR(self);
+        err = MP3Decode(self->decoder, &inbuf, &bytes_left, buffer, 0);
+        CONSUME(self, BYTES_LEFT(self) - bytes_left);
+        self->frame_number += 1;
+    } while (err == ERR_MP3_MAINDATA_UNDERFLOW);
+    if (err) {
+        return false;
+    }
+    // The frame is still in cache, so converting it here is cheaper than
+    // having the player convert a copy.
+    if (!self->output_signed) {
+        uint32_t *words = (uint32_t *)(void *)buffer;
+        for (size_t i = 0; i < self->frame_buffer_size / sizeof(uint32_t); i++) {
+            words[i] ^= 0x80008000;
+        }
+    }
+    self->frames_ready += 1;
+    return true;
+}
+
+// Called from background tasks while the file is playing. Decodes at most
+// one frame so that other background work isn't held up for long.
+void audiomp3_mp3file_prefetch(audiomp3_mp3file_obj_t* self) {
+    if (self->frames == NULL || self->decode_done ||
+        self->frames_ready >= self->frame_count - 2) {
+        return;
+    }
+    if (!mp3file_decode_frame(self)) {
+        self->decode_done = true;
+    }
 }
 
 audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t* self,
@@ -301,38 +445,51 @@ audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t*
     *buffer_length = self->frame_buffer_size;
 
     if (channel == self->other_channel) {
-        *bufptr = (uint8_t*)(self->buffers[self->other_buffer_index] + channel);
+        *bufptr = self->frames + self->other_frame * MAX_BUFFER_LEN + channel * sizeof(int16_t);
         self->other_channel = -1;
         return GET_BUFFER_MORE_DATA;
     }
 
+    if (self->frames_ready == 0) {
+        // Decoding ahead didn't keep up, so decode in line as we always used to.
+        if (self->frame_count > 2 && self->started && !self->decode_done) {
+            self->underruns += 1;
+        }
+        if (self->decode_done || !mp3file_decode_frame(self)) {
+            // Finish with a frame of silence rather than one played before.
+            uint32_t *words = (uint32_t *)(void *)(self->frames + self->next_frame * MAX_BUFFER_LEN);
+            uint32_t silence = self->output_signed ? 0 : 0x80008000;
+            for (size_t i = 0; i < self->frame_buffer_size / sizeof(uint32_t); i++) {
+                words[i] = silence;
+            }
+            self->frames_ready = 1;
+            self->decode_done = true;
+        }
+    }
+    uint8_t index = self->next_frame;
+    self->next_frame = (self->next_frame + 1) % self->frame_count;
+    self->frames_ready -= 1;
 
-    self->buffer_index = !self->buffer_index;
+    self->started = true;
     self->other_channel = 1-channel;
-    self->other_buffer_index = self->buffer_index;
-    int16_t *buffer = (int16_t *)(void *)self->buffers[self->buffer_index];
-    *bufptr = (uint8_t*)buffer;
+    self->other_frame = index;
+    *bufptr = self->frames + index * MAX_BUFFER_LEN;
 
-    mp3file_skip_id3v2(self);
-    if (!mp3file_find_sync_word(self)) {
-        return self->eof ? GET_BUFFER_DONE : GET_BUFFER_ERROR;
-    }
-    int bytes_left = BYTES_LEFT(self);
-    uint8_t *inbuf = READ_PTR(self);
-    int err = MP3Decode(self->decoder, &inbuf, &bytes_left, buffer, 0);
-    CONSUME(self, BYTES_LEFT(self) - bytes_left);
-    if (err) {
+    if (self->frames_ready == 0 && self->decode_done) {
         return GET_BUFFER_DONE;
     }
-
     return GET_BUFFER_MORE_DATA;
 }
 
+void audiomp3_mp3file_set_output_signed(audiomp3_mp3file_obj_t* self, bool output_signed) {
+    self->output_signed = output_signed;
+}
+
 void audiomp3_mp3file_get_buffer_structure(audiomp3_mp3file_obj_t* self, bool single_channel,
                                            bool* single_buffer, bool* samples_signed,
                                            uint32_t* max_buffer_length, uint8_t* spacing) {
     *single_buffer = false;
-    *samples_signed = true;
+    *samples_signed = self->output_signed;
     *max_buffer_length = self->frame_buffer_size;
     if (single_channel) {
         *spacing = self->channel_count;
@@ -344,9 +501,12 @@ void audiomp3_mp3file_get_buffer_structure(audiomp3_mp3file_obj_t* self, bool si
 float common_hal_audiomp3_mp3file_get_rms_level(audiomp3_mp3file_obj_t* self) {
     float sumsq = 0.f;
     // Assumes no DC component to the audio.  Is that a safe assumption?
-    int16_t *buffer = (int16_t *)(void *)self->buffers[self->buffer_index];
+    uint8_t index = (self->next_frame + self->frame_count - 1) % self->frame_count;
+    int16_t *buffer = (int16_t *)(void *)(self->frames + index * MAX_BUFFER_LEN);
+    int16_t offset = self->output_signed ? 0 : INT16_MIN;
     for(size_t i=0; i<self->frame_buffer_size / sizeof(int16_t); i++) {
-        sumsq += (float)buffer[i] * buffer[i];
+        float sample = (int16_t)(buffer[i] ^ offset);
+        sumsq += sample * sample;
     }
     return sqrtf(sumsq) / (self->frame_buffer_size / sizeof(int16_t));
 }
@@ -33,25 +33,48 @@
 
 #include "shared-module/audiocore/__init__.h"
 
+// Most frames a MP3Decoder can decode ahead, on top of the two being played.
+#define AUDIOMP3_MAX_READ_AHEAD (4)
+
+// File offsets kept for seeking. When the index fills up, every other entry
+// is dropped and the rest cover twice as many frames each.
+#define AUDIOMP3_INDEX_LENGTH (64)
+
 typedef struct {
     mp_obj_base_t base;
     struct _MP3DecInfo *decoder;
     uint8_t* inbuf;
     uint32_t inbuf_length;
     uint32_t inbuf_offset;
-    int16_t* buffers[2];
+    uint32_t inbuf_position; // File offset of inbuf[0]
+    // Ring of frame_count decoded frames of frame_buffer_size bytes each,
+    // spaced MAX_BUFFER_LEN apart. The two frames handed out last are being
+    // played; up to frame_count - 2 more are decoded ahead.
+    uint8_t* frames;
+    uint8_t frame_count;
+    uint8_t next_frame; // Next frame to hand out
+    uint8_t frames_ready; // Frames decoded ahead of next_frame
+    bool decode_done; // Nothing more to decode until the decoder is reset or seeks
+    bool started; // A frame has been handed out since the last seek
     uint32_t len;
     uint32_t frame_buffer_size;
+    uint32_t underruns;
+
+    // Index of the file, frame_offsets[i] is where frame i * index_stride starts.
+    uint32_t frame_offsets[AUDIOMP3_INDEX_LENGTH];
+    uint32_t index_stride;
+    uint8_t index_count;
+    uint32_t frame_number; // Frame at the read position of inbuf
 
     uint32_t sample_rate;
     pyb_file_obj_t* file;
 
-    uint8_t buffer_index;
     uint8_t channel_count;
     bool eof;
+    bool output_signed;
 
     int8_t other_channel;
-    int8_t other_buffer_index;
+    int8_t other_frame;
 } audiomp3_mp3file_obj_t;
 
 // These are not available from Python because it may be called in an interrupt.
@@ -63,10 +86,13 @@ audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t*
                                                         uint8_t channel,
                                                         uint8_t** buffer,
                                                         uint32_t* buffer_length); // length in bytes
+void audiomp3_mp3file_prefetch(audiomp3_mp3file_obj_t* self);
 void audiomp3_mp3file_get_buffer_structure(audiomp3_mp3file_obj_t* self, bool single_channel,
                                            bool* single_buffer, bool* samples_signed,
                                            uint32_t* max_buffer_length, uint8_t* spacing);
 
+void audiomp3_mp3file_set_output_signed(audiomp3_mp3file_obj_t* self, bool output_signed);
+
 float audiomp3_mp3file_get_rms_level(audiomp3_mp3file_obj_t* self);
 
 #endif // MICROPY_INCLUDED_SHARED_MODULE_AUDIOIO_MP3FILE_H
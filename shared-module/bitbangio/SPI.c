@@ -168,9 +168,7 @@ bool shared_module_bitbangio_spi_write(bitbangio_spi_obj_t *self, const uint8_t
 
         // Some ports need a regular callback, but probably we don't need
         // to do this every byte, or even at all.
-        #ifdef MICROPY_EVENT_POLL_HOOK
-        MICROPY_EVENT_POLL_HOOK;
-        #endif
+        RUN_BACKGROUND_TASKS;
     }
     return true;
 }
@@ -232,9 +230,7 @@ bool shared_module_bitbangio_spi_read(bitbangio_spi_obj_t *self, uint8_t *data,
 
         // Some ports need a regular callback, but probably we don't need
         // to do this every byte, or even at all.
-        #ifdef MICROPY_EVENT_POLL_HOOK
-        MICROPY_EVENT_POLL_HOOK;
-        #endif
+        RUN_BACKGROUND_TASKS;
     }
     return true;
 }
@@ -297,9 +293,7 @@ bool shared_module_bitbangio_spi_transfer(bitbangio_spi_obj_t *self, const uint8
 
         // Some ports need a regular callback, but probably we don't need
         // to do this every byte, or even at all.
-        #ifdef MICROPY_EVENT_POLL_HOOK
-        MICROPY_EVENT_POLL_HOOK;
-        #endif
+        RUN_BACKGROUND_TASKS;
     }
     return true;
 }
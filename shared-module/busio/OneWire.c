@@ -24,17 +24,50 @@
  * THE SOFTWARE.
  */
 
-// Wraps the bitbangio implementation of OneWire for use in busio.
+// Wraps the bitbangio implementation of OneWire for use in busio, or runs the
+// bus with a UART whose TX and RX are both wired to it. The UART encodes each
+// time slot as one character: the start bit is the low part of the slot and a
+// device pulling the bus low shows up in the character read back. Its buffers
+// keep the slot timing, so interrupts stay on.
+#include <string.h>
+
 #include "common-hal/microcontroller/Pin.h"
+#include "py/mperrno.h"
+#include "py/runtime.h"
 #include "shared-bindings/bitbangio/OneWire.h"
+#include "shared-bindings/busio/OneWire.h"
+#include "shared-bindings/busio/UART.h"
 #include "shared-module/busio/OneWire.h"
 
+// A reset pulse is 0xf0 at 9600 baud, which is about 520us low. A presence
+// pulse corrupts the character read back.
+#define RESET_BAUDRATE (9600)
+#define RESET_CHARACTER (0xf0)
+// Time slots are 0xff (write 1 or read) or 0x00 (write 0) at 115200 baud.
+// The start bit gives the 8.7us low part of a 1 slot.
+#define SLOT_BAUDRATE (115200)
+#define SLOTS_PER_TRANSFER (64)
+
+#define SEARCH_ROM (0xf0)
+
 void common_hal_busio_onewire_construct(busio_onewire_obj_t* self,
         const mcu_pin_obj_t* pin) {
+    self->use_uart = false;
     shared_module_bitbangio_onewire_construct(&self->bitbang, pin);
 }
 
+void common_hal_busio_onewire_construct_uart(busio_onewire_obj_t* self,
+        const mcu_pin_obj_t* tx, const mcu_pin_obj_t* rx) {
+    self->use_uart = true;
+    self->uart.base.type = &busio_uart_type;
+    common_hal_busio_uart_construct(&self->uart, tx, rx, NULL, NULL, NULL, false,
+        SLOT_BAUDRATE, 8, PARITY_NONE, 1, 0.1, SLOTS_PER_TRANSFER, NULL, false);
+}
+
 bool common_hal_busio_onewire_deinited(busio_onewire_obj_t* self) {
+    if (self->use_uart) {
+        return common_hal_busio_uart_deinited(&self->uart);
+    }
     return shared_module_bitbangio_onewire_deinited(&self->bitbang);
 }
 
@@ -42,18 +75,156 @@ void common_hal_busio_onewire_deinit(busio_onewire_obj_t* self) {
     if (common_hal_busio_onewire_deinited(self)) {
         return;
     }
+    if (self->use_uart) {
+        common_hal_busio_uart_deinit(&self->uart);
+        return;
+    }
     shared_module_bitbangio_onewire_deinit(&self->bitbang);
 }
 
+// Sends the characters and replaces them with the ones read back off the bus.
+static void uart_transfer(busio_onewire_obj_t* self, uint8_t* characters, size_t len) {
+    common_hal_busio_uart_clear_rx_buffer(&self->uart);
+    int errcode;
+    if (common_hal_busio_uart_write(&self->uart, characters, len, &errcode) != len ||
+        common_hal_busio_uart_read(&self->uart, characters, len, &errcode) != len) {
+        mp_raise_OSError(MP_EIO);
+    }
+}
+
 bool common_hal_busio_onewire_reset(busio_onewire_obj_t* self) {
-    return shared_module_bitbangio_onewire_reset(&self->bitbang);
+    if (!self->use_uart) {
+        return shared_module_bitbangio_onewire_reset(&self->bitbang);
+    }
+    common_hal_busio_uart_set_baudrate(&self->uart, RESET_BAUDRATE);
+    uint8_t character = RESET_CHARACTER;
+    uart_transfer(self, &character, 1);
+    common_hal_busio_uart_set_baudrate(&self->uart, SLOT_BAUDRATE);
+    return character == RESET_CHARACTER;
+}
+
+// Runs one time slot per bit, writing the bits and replacing each with the bus
+// value. Writing a 1 is also how a bit is read.
+static void slots(busio_onewire_obj_t* self, bool* bits, size_t len) {
+    if (!self->use_uart) {
+        for (size_t i = 0; i < len; i++) {
+            if (bits[i]) {
+                bits[i] = shared_module_bitbangio_onewire_read_bit(&self->bitbang);
+            } else {
+                shared_module_bitbangio_onewire_write_bit(&self->bitbang, false);
+            }
+        }
+        return;
+    }
+    uint8_t characters[SLOTS_PER_TRANSFER];
+    while (len > 0) {
+        size_t count = MIN(len, SLOTS_PER_TRANSFER);
+        for (size_t i = 0; i < count; i++) {
+            characters[i] = bits[i] ? 0xff : 0x00;
+        }
+        uart_transfer(self, characters, count);
+        for (size_t i = 0; i < count; i++) {
+            bits[i] = characters[i] == 0xff;
+        }
+        bits += count;
+        len -= count;
+    }
 }
 
 bool common_hal_busio_onewire_read_bit(busio_onewire_obj_t* self) {
-    return shared_module_bitbangio_onewire_read_bit(&self->bitbang);
+    bool bit = true;
+    slots(self, &bit, 1);
+    return bit;
 }
 
 void common_hal_busio_onewire_write_bit(busio_onewire_obj_t* self,
         bool bit) {
-    shared_module_bitbangio_onewire_write_bit(&self->bitbang, bit);
+    slots(self, &bit, 1);
+}
+
+// Bytes go out least significant bit first. Reading sends all ones.
+static void transfer_bytes(busio_onewire_obj_t* self, uint8_t* data, size_t len) {
+    bool bits[SLOTS_PER_TRANSFER];
+    const size_t bytes_per_transfer = SLOTS_PER_TRANSFER / 8;
+    while (len > 0) {
+        size_t count = MIN(len, bytes_per_transfer);
+        for (size_t i = 0; i < count * 8; i++) {
+            bits[i] = (data[i / 8] >> (i % 8)) & 1;
+        }
+        slots(self, bits, count * 8);
+        memset(data, 0, count);
+        for (size_t i = 0; i < count * 8; i++) {
+            data[i / 8] |= bits[i] << (i % 8);
+        }
+        data += count;
+        len -= count;
+    }
+}
+
+void common_hal_busio_onewire_write(busio_onewire_obj_t* self, const uint8_t* data, size_t len) {
+    uint8_t buffer[SLOTS_PER_TRANSFER / 8];
+    while (len > 0) {
+        size_t count = MIN(len, sizeof(buffer));
+        memcpy(buffer, data, count);
+        transfer_bytes(self, buffer, count);
+        data += count;
+        len -= count;
+    }
+}
+
+void common_hal_busio_onewire_readinto(busio_onewire_obj_t* self, uint8_t* data, size_t len) {
+    memset(data, 0xff, len);
+    transfer_bytes(self, data, len);
+}
+
+// The ROM search from Maxim application note 187. Each step of it reads a bit
+// and its complement and then writes the chosen direction; the three slots
+// are run together.
+mp_obj_t common_hal_busio_onewire_search(busio_onewire_obj_t* self) {
+    mp_obj_t devices = mp_obj_new_list(0, NULL);
+    uint8_t rom[8] = {0};
+    int last_discrepancy = -1;
+    do {
+        if (common_hal_busio_onewire_reset(self)) {
+            // No devices are present.
+            break;
+        }
+        uint8_t command = SEARCH_ROM;
+        common_hal_busio_onewire_write(self, &command, 1);
+        int discrepancy = -1;
+        for (int i = 0; i < 64; i++) {
+            bool bits[2] = {true, true};
+            slots(self, bits, 2);
+            bool direction;
+            if (bits[0] && bits[1]) {
+                // Nothing answered, so the bus changed during the search.
+                return devices;
+            } else if (bits[0] != bits[1]) {
+                direction = bits[0];
+            } else {
+                // Devices with both values are left. Take 1 if this is the
+                // last branch taken last time, 0 after it, and the previous
+                // choice before it.
+                if (i == last_discrepancy) {
+                    direction = true;
+                } else if (i > last_discrepancy) {
+                    direction = false;
+                } else {
+                    direction = (rom[i / 8] >> (i % 8)) & 1;
+                }
+                if (!direction) {
+                    discrepancy = i;
+                }
+            }
+            if (direction) {
+                rom[i / 8] |= 1 << (i % 8);
+            } else {
+                rom[i / 8] &= ~(1 << (i % 8));
+            }
+            common_hal_busio_onewire_write_bit(self, direction);
+        }
+        mp_obj_list_append(devices, mp_obj_new_bytes(rom, sizeof(rom)));
+        last_discrepancy = discrepancy;
+    } while (last_discrepancy >= 0);
+    return devices;
 }
@@ -28,12 +28,16 @@
 #define MICROPY_INCLUDED_ATMEL_SAMD_SHARED_MODULE_BUSIO_ONEWIRE_H
 
 #include "shared-module/bitbangio/types.h"
+#include "common-hal/busio/UART.h"
 
 #include "py/obj.h"
 
 typedef struct {
     mp_obj_base_t base;
     bitbangio_onewire_obj_t bitbang;
+    // Used instead of bitbang when the bus is run by a UART.
+    busio_uart_obj_t uart;
+    bool use_uart;
 } busio_onewire_obj_t;
 
 #endif // MICROPY_INCLUDED_ATMEL_SAMD_SHARED_MODULE_BUSIO_ONEWIRE_H
@@ -82,6 +82,29 @@ uint32_t common_hal_displayio_bitmap_get_bits_per_value(displayio_bitmap_t *self
     return self->bits_per_value;
 }
 
+int common_hal_displayio_bitmap_get_buffer(displayio_bitmap_t *self, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    // Writes through the buffer would bypass dirty area tracking, so only
+    // reading is allowed.
+    if (flags & MP_BUFFER_WRITE) {
+        return 1;
+    }
+    bufinfo->buf = self->data;
+    bufinfo->len = self->stride * self->height * sizeof(size_t);
+    switch (self->bits_per_value) {
+        case 32:
+            bufinfo->typecode = 'I';
+            break;
+        case 16:
+            bufinfo->typecode = 'H';
+            break;
+        default:
+            // values of fewer than 8 bits are packed into words
+            bufinfo->typecode = 'B';
+            break;
+    }
+    return 0;
+}
+
 uint32_t common_hal_displayio_bitmap_get_pixel(displayio_bitmap_t *self, int16_t x, int16_t y) {
     if (x >= self->width || x < 0 || y >= self->height || y < 0) {
         return 0;
@@ -105,6 +128,29 @@ uint32_t common_hal_displayio_bitmap_get_pixel(displayio_bitmap_t *self, int16_t
     return 0;
 }
 
+// Stores value without any checks or dirty area tracking.
+STATIC void _set_value(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value) {
+    int32_t row_start = y * self->stride;
+    uint32_t bytes_per_value = self->bits_per_value / 8;
+    if (bytes_per_value < 1) {
+        uint32_t bit_position = (sizeof(size_t) * 8 - ((x & self->x_mask) + 1) * self->bits_per_value);
+        uint32_t index = row_start + (x >> self->x_shift);
+        size_t word = self->data[index];
+        word &= ~((size_t) self->bitmask << bit_position);
+        word |= (size_t) (value & self->bitmask) << bit_position;
+        self->data[index] = word;
+    } else {
+        size_t* row = self->data + row_start;
+        if (bytes_per_value == 1) {
+            ((uint8_t*) row)[x] = value;
+        } else if (bytes_per_value == 2) {
+            ((uint16_t*) row)[x] = value;
+        } else if (bytes_per_value == 4) {
+            ((uint32_t*) row)[x] = value;
+        }
+    }
+}
+
 void common_hal_displayio_bitmap_set_pixel(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value) {
     if (self->read_only) {
         mp_raise_RuntimeError(translate("Read-only object"));
@@ -129,25 +175,7 @@ void common_hal_displayio_bitmap_set_pixel(displayio_bitmap_t *self, int16_t x,
     }
 
     // Update our data
-    int32_t row_start = y * self->stride;
-    uint32_t bytes_per_value = self->bits_per_value / 8;
-    if (bytes_per_value < 1) {
-        uint32_t bit_position = (sizeof(size_t) * 8 - ((x & self->x_mask) + 1) * self->bits_per_value);
-        uint32_t index = row_start + (x >> self->x_shift);
-        uint32_t word = self->data[index];
-        word &= ~(self->bitmask << bit_position);
-        word |= (value & self->bitmask) << bit_position;
-        self->data[index] = word;
-    } else {
-        size_t* row = self->data + row_start;
-        if (bytes_per_value == 1) {
-            ((uint8_t*) row)[x] = value;
-        } else if (bytes_per_value == 2) {
-            ((uint16_t*) row)[x] = value;
-        } else if (bytes_per_value == 4) {
-            ((uint32_t*) row)[x] = value;
-        }
-    }
+    _set_value(self, x, y, value);
 }
 
 displayio_area_t* displayio_bitmap_get_refresh_areas(displayio_bitmap_t *self, displayio_area_t* tail) {
@@ -183,3 +211,159 @@ void common_hal_displayio_bitmap_fill(displayio_bitmap_t *self, uint32_t value)
         self->data[i] = word;
     }
 }
+
+// Grows the dirty area to include the given, already clipped, area.
+STATIC void _expand_dirty_area(displayio_bitmap_t *self, const displayio_area_t* area) {
+    if (self->dirty_area.x1 == self->dirty_area.x2) {
+        displayio_area_copy(area, &self->dirty_area);
+    } else {
+        displayio_area_expand(&self->dirty_area, area);
+    }
+}
+
+// Returns the bits of a packed word that hold values first to last - 1.
+STATIC size_t _word_mask(displayio_bitmap_t *self, uint32_t first, uint32_t last) {
+    size_t mask = ~((size_t) 0) >> (first * self->bits_per_value);
+    uint32_t end = last * self->bits_per_value;
+    if (end < sizeof(size_t) * 8) {
+        mask &= ~(~((size_t) 0) >> end);
+    }
+    return mask;
+}
+
+// Stores value (already packed into every position of a word) into the run of
+// width values starting at x in the given row of a packed bitmap.
+STATIC void _fill_packed_run(displayio_bitmap_t *self, size_t* row, uint16_t x, uint16_t width, size_t word) {
+    uint32_t values_per_word = self->x_mask + 1;
+    uint32_t index = x >> self->x_shift;
+    uint32_t first = x & self->x_mask;
+    while (width > 0) {
+        uint32_t last = first + width;
+        if (last > values_per_word) {
+            last = values_per_word;
+        }
+        size_t mask = _word_mask(self, first, last);
+        row[index] = (row[index] & ~mask) | (word & mask);
+        width -= last - first;
+        first = 0;
+        index++;
+    }
+}
+
+void common_hal_displayio_bitmap_fill_region(displayio_bitmap_t *self, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint32_t value) {
+    if (self->read_only) {
+        mp_raise_RuntimeError(translate("Read-only object"));
+    }
+    displayio_area_t area = { x1, y1, x2, y2, NULL };
+    displayio_area_t bitmap_area = { 0, 0, self->width, self->height, NULL };
+    if (!displayio_area_compute_overlap(&area, &bitmap_area, &area)) {
+        return;
+    }
+    _expand_dirty_area(self, &area);
+
+    uint16_t width = displayio_area_width(&area);
+    uint32_t bytes_per_value = self->bits_per_value / 8;
+    size_t word = 0;
+    if (bytes_per_value < 1) {
+        for (uint32_t i = 0; i <= self->x_mask; i++) {
+            word = (word << self->bits_per_value) | (value & self->bitmask);
+        }
+    }
+    for (int16_t y = area.y1; y < area.y2; y++) {
+        size_t* row = self->data + y * self->stride;
+        if (bytes_per_value < 1) {
+            _fill_packed_run(self, row, area.x1, width, word);
+        } else if (bytes_per_value == 1) {
+            memset(((uint8_t*) row) + area.x1, value, width);
+        } else if (bytes_per_value == 2) {
+            uint16_t* values = ((uint16_t*) row) + area.x1;
+            for (uint16_t i = 0; i < width; i++) {
+                values[i] = value;
+            }
+        } else if (bytes_per_value == 4) {
+            uint32_t* values = ((uint32_t*) row) + area.x1;
+            for (uint16_t i = 0; i < width; i++) {
+                values[i] = value;
+            }
+        }
+    }
+}
+
+// Copies the run of width values from src_x in src_row to dst_x in dst_row of
+// packed bitmaps where both start at the same position within a word, so whole
+// words can be moved. Runs in the same row are copied in whichever direction
+// doesn't overwrite values before they're read.
+STATIC void _copy_packed_run(displayio_bitmap_t *self, size_t* dst_row, uint16_t dst_x, const size_t* src_row, uint16_t src_x, uint16_t width) {
+    uint32_t values_per_word = self->x_mask + 1;
+    uint32_t first = dst_x & self->x_mask;
+    uint32_t words = (first + width + values_per_word - 1) / values_per_word;
+    size_t* dst = dst_row + (dst_x >> self->x_shift);
+    const size_t* src = src_row + (src_x >> self->x_shift);
+    bool backwards = dst > src;
+    for (uint32_t n = 0; n < words; n++) {
+        uint32_t i = backwards ? words - 1 - n : n;
+        uint32_t word_first = i == 0 ? first : 0;
+        uint32_t word_last = values_per_word;
+        if (i == words - 1) {
+            word_last = (first + width) - i * values_per_word;
+        }
+        size_t mask = _word_mask(self, word_first, word_last);
+        dst[i] = (dst[i] & ~mask) | (src[i] & mask);
+    }
+}
+
+void common_hal_displayio_bitmap_blit(displayio_bitmap_t *self, int16_t x, int16_t y, displayio_bitmap_t *source,
+                                      int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint32_t skip_index, bool skip_index_none) {
+    if (self->read_only) {
+        mp_raise_RuntimeError(translate("Read-only object"));
+    }
+    // Clip the source rectangle to the source and then to where it lands in us.
+    displayio_area_t source_area = { x1, y1, x2, y2, NULL };
+    displayio_area_t source_bounds = { 0, 0, source->width, source->height, NULL };
+    if (!displayio_area_compute_overlap(&source_area, &source_bounds, &source_area)) {
+        return;
+    }
+    displayio_area_t area = source_area;
+    displayio_area_shift(&area, x - x1, y - y1);
+    displayio_area_t bitmap_area = { 0, 0, self->width, self->height, NULL };
+    if (!displayio_area_compute_overlap(&area, &bitmap_area, &area)) {
+        return;
+    }
+    _expand_dirty_area(self, &area);
+    int16_t dx = x1 - x;
+    int16_t dy = y1 - y;
+    uint16_t width = displayio_area_width(&area);
+    uint16_t height = displayio_area_height(&area);
+
+    // Copying within one bitmap goes bottom up when moving down so rows are
+    // read before they're overwritten.
+    bool bottom_up = self == source && dy < 0;
+    bool right_to_left = self == source && dy == 0 && dx < 0;
+    uint32_t bytes_per_value = self->bits_per_value / 8;
+    bool same_format = self->bits_per_value == source->bits_per_value;
+    bool aligned = bytes_per_value >= 1 ||
+                   ((area.x1 & self->x_mask) == ((area.x1 + dx) & self->x_mask));
+    for (uint16_t j = 0; j < height; j++) {
+        int16_t row = bottom_up ? area.y2 - 1 - j : area.y1 + j;
+        size_t* dst_row = self->data + row * self->stride;
+        const size_t* src_row = source->data + (row + dy) * source->stride;
+        if (skip_index_none && same_format && aligned) {
+            if (bytes_per_value < 1) {
+                _copy_packed_run(self, dst_row, area.x1, src_row, area.x1 + dx, width);
+            } else {
+                memmove(((uint8_t*) dst_row) + area.x1 * bytes_per_value,
+                        ((const uint8_t*) src_row) + (area.x1 + dx) * bytes_per_value,
+                        width * bytes_per_value);
+            }
+            continue;
+        }
+        for (uint16_t i = 0; i < width; i++) {
+            int16_t column = right_to_left ? area.x2 - 1 - i : area.x1 + i;
+            uint32_t value = common_hal_displayio_bitmap_get_pixel(source, column + dx, row + dy);
+            if (!skip_index_none && value == skip_index) {
+                continue;
+            }
+            _set_value(self, column, row, value);
+        }
+    }
+}
@@ -71,6 +71,11 @@ void common_hal_displayio_display_construct(displayio_display_obj_t* self,
 
     self->native_frames_per_second = native_frames_per_second;
     self->native_ms_per_frame = 1000 / native_frames_per_second;
+    self->frame_start = 0;
+    self->frames = 0;
+    self->dropped_frames = 0;
+    self->last_frame_ms = 0;
+    self->max_frame_ms = 0;
 
     uint32_t i = 0;
     while (i < init_sequence_len) {
@@ -220,20 +225,27 @@ STATIC const displayio_area_t* _get_refresh_areas(displayio_display_obj_t *self)
         self->core.area.next = NULL;
         return &self->core.area;
     } else if (self->core.current_group != NULL) {
-        return displayio_group_get_refresh_areas(self->core.current_group, NULL);
+        const displayio_area_t* areas = displayio_group_get_refresh_areas(self->core.current_group, NULL);
+        return displayio_display_core_coalesce_areas(&self->core, areas);
     }
     return NULL;
 }
 
+// If the bus can send in the background then this returns before the pixels
+// have been sent; call wait_for_send before touching them again.
 STATIC void _send_pixels(displayio_display_obj_t* self, uint8_t* pixels, uint32_t length) {
     if (!self->data_as_commands) {
         self->core.send(self->core.bus, DISPLAY_COMMAND, CHIP_SELECT_TOGGLE_EVERY_BYTE, &self->write_ram_command, 1);
     }
-    self->core.send(self->core.bus, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED, pixels, length);
+    if (self->core.send_async != NULL) {
+        self->core.send_async(self->core.bus, pixels, length);
+    } else {
+        self->core.send(self->core.bus, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED, pixels, length);
+    }
 }
 
 STATIC bool _refresh_area(displayio_display_obj_t* self, const displayio_area_t* area) {
-    uint16_t buffer_size = 128; // In uint32_ts
+    uint16_t buffer_size = CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE; // In uint32_ts
 
     displayio_area_t clipped;
     // Clip the area to the display by overlapping the areas. If there is no overlap then we're done.
@@ -267,12 +279,19 @@ STATIC bool _refresh_area(displayio_display_obj_t* self, const displayio_area_t*
         }
     }
 
+    // If the bus sends in the background then use two buffers, so one
+    // subrectangle is rendered while the previous one is still being sent.
+    bool double_buffered = self->core.send_async != NULL && subrectangles > 1;
+
     // Allocated and shared as a uint32_t array so the compiler knows the
     // alignment everywhere.
-    uint32_t buffer[buffer_size];
+    uint32_t buffers[double_buffered ? 2 * buffer_size : buffer_size];
     uint32_t mask_length = (pixels_per_buffer / 32) + 1;
     uint32_t mask[mask_length];
     uint16_t remaining_rows = displayio_area_height(&clipped);
+    bool sending = false;
+    self->core.pixels_sent += displayio_area_size(&clipped);
+    self->core.windows_sent += subrectangles;
 
     for (uint16_t j = 0; j < subrectangles; j++) {
         displayio_area_t subrectangle = {
@@ -286,8 +305,6 @@ STATIC bool _refresh_area(displayio_display_obj_t* self, const displayio_area_t*
         }
         remaining_rows -= rows_per_buffer;
 
-        displayio_display_core_set_region_to_update(&self->core, self->set_column_command, self->set_row_command, NO_COMMAND, NO_COMMAND, self->data_as_commands, false, &subrectangle);
-
         uint16_t subrectangle_size_bytes;
         if (self->core.colorspace.depth >= 8) {
             subrectangle_size_bytes = displayio_area_size(&subrectangle) * (self->core.colorspace.depth / 8);
@@ -295,24 +312,45 @@ STATIC bool _refresh_area(displayio_display_obj_t* self, const displayio_area_t*
             subrectangle_size_bytes = displayio_area_size(&subrectangle) / (8 / self->core.colorspace.depth);
         }
 
+        uint32_t *buffer = buffers;
+        if (double_buffered && j % 2 == 1) {
+            buffer += buffer_size;
+        }
         memset(mask, 0, mask_length * sizeof(mask[0]));
         memset(buffer, 0, buffer_size * sizeof(buffer[0]));
 
         displayio_display_core_fill_area(&self->core, &subrectangle, mask, buffer);
 
+        // The previous subrectangle must be out before the region can change.
+        if (sending) {
+            self->core.wait_for_send(self->core.bus);
+            displayio_display_core_end_transaction(&self->core);
+            sending = false;
+        }
+
         // Can't acquire display bus; skip the rest of the data.
         if (!displayio_display_core_bus_free(&self->core)) {
             return false;
         }
 
+        displayio_display_core_set_region_to_update(&self->core, self->set_column_command, self->set_row_command, NO_COMMAND, NO_COMMAND, self->data_as_commands, false, &subrectangle);
+
         displayio_display_core_begin_transaction(&self->core);
         _send_pixels(self, (uint8_t*) buffer, subrectangle_size_bytes);
-        displayio_display_core_end_transaction(&self->core);
+        if (self->core.send_async != NULL) {
+            sending = true;
+        } else {
+            displayio_display_core_end_transaction(&self->core);
+        }
 
         // TODO(tannewt): Make refresh displays faster so we don't starve other
         // background tasks.
         usb_background();
     }
+    if (sending) {
+        self->core.wait_for_send(self->core.bus);
+        displayio_display_core_end_transaction(&self->core);
+    }
     return true;
 }
 
@@ -321,6 +359,7 @@ STATIC void _refresh_display(displayio_display_obj_t* self) {
         // Can't acquire display bus; skip updating this display. Try next display.
         return;
     }
+    uint64_t start = supervisor_ticks_ms64();
     displayio_display_core_start_refresh(&self->core);
     const displayio_area_t* current_area = _get_refresh_areas(self);
     while (current_area != NULL) {
@@ -328,6 +367,14 @@ STATIC void _refresh_display(displayio_display_obj_t* self) {
         current_area = current_area->next;
     }
     displayio_display_core_finish_refresh(&self->core);
+
+    uint32_t frame_ms = supervisor_ticks_ms64() - start;
+    self->frame_start = start;
+    self->frames++;
+    self->last_frame_ms = MIN(frame_ms, 0xffff);
+    if (self->last_frame_ms > self->max_frame_ms) {
+        self->max_frame_ms = self->last_frame_ms;
+    }
 }
 
 void common_hal_displayio_display_set_rotation(displayio_display_obj_t* self, int rotation){
@@ -363,6 +410,7 @@ bool common_hal_displayio_display_refresh(displayio_display_obj_t* self, uint32_
         self->last_refresh_call = current_time;
         // Skip the actual refresh to help catch up.
         if (current_ms_since_last_call > target_ms_per_frame) {
+            self->dropped_frames++;
             return false;
         }
         uint32_t remaining_time = target_ms_per_frame - (current_ms_since_real_refresh % target_ms_per_frame);
@@ -384,6 +432,18 @@ void common_hal_displayio_display_set_auto_refresh(displayio_display_obj_t* self
                                                    bool auto_refresh) {
     self->first_manual_refresh = !auto_refresh;
     self->auto_refresh = auto_refresh;
+    self->frame_start = 0;
+}
+
+mp_obj_t common_hal_displayio_display_get_frame_stats(displayio_display_obj_t* self) {
+    mp_obj_t items[] = {
+        mp_obj_new_int_from_uint(self->frames),
+        mp_obj_new_int_from_uint(self->dropped_frames),
+        MP_OBJ_NEW_SMALL_INT(self->last_frame_ms),
+        MP_OBJ_NEW_SMALL_INT(self->max_frame_ms),
+        mp_obj_new_int_from_uint(self->core.pixels_sent),
+    };
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
 }
 
 STATIC void _update_backlight(displayio_display_obj_t* self) {
@@ -403,9 +463,21 @@ STATIC void _update_backlight(displayio_display_obj_t* self) {
 void displayio_display_background(displayio_display_obj_t* self) {
     _update_backlight(self);
 
-    if (self->auto_refresh && (supervisor_ticks_ms64() - self->core.last_refresh) > self->native_ms_per_frame) {
-        _refresh_display(self);
+    if (!self->auto_refresh) {
+        return;
+    }
+    // Pace frames from when the last one started so the frame rate doesn't
+    // drop by however long drawing takes, but always leave a gap after one.
+    uint64_t now = supervisor_ticks_ms64();
+    uint32_t since_start = now - self->frame_start;
+    if (since_start < self->native_ms_per_frame ||
+        now - self->core.last_refresh < CIRCUITPY_DISPLAY_FRAME_GAP_MS) {
+        return;
+    }
+    if (self->frame_start != 0 && self->native_ms_per_frame > 0) {
+        self->dropped_frames += since_start / self->native_ms_per_frame - 1;
     }
+    _refresh_display(self);
 }
 
 void release_display(displayio_display_obj_t* self) {
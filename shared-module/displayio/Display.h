@@ -43,6 +43,11 @@ typedef struct {
     };
     uint64_t last_backlight_refresh;
     uint64_t last_refresh_call;
+    uint64_t frame_start; // When the last frame started, 0 to restart pacing.
+    uint32_t frames;
+    uint32_t dropped_frames;
+    uint16_t last_frame_ms;
+    uint16_t max_frame_ms;
     mp_float_t current_brightness;
     uint16_t brightness_command;
     uint16_t native_frames_per_second;
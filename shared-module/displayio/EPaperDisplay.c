@@ -49,7 +49,8 @@ void common_hal_displayio_epaperdisplay_construct(displayio_epaperdisplay_obj_t*
         uint16_t set_column_window_command, uint16_t set_row_window_command,
         uint16_t set_current_column_command, uint16_t set_current_row_command,
         uint16_t write_black_ram_command, bool black_bits_inverted, uint16_t write_color_ram_command, bool color_bits_inverted, uint32_t highlight_color, uint16_t refresh_display_command, mp_float_t refresh_time,
-        const mcu_pin_obj_t* busy_pin, bool busy_state, mp_float_t seconds_per_frame, bool chip_select) {
+        const mcu_pin_obj_t* busy_pin, bool busy_state, mp_float_t seconds_per_frame, bool chip_select,
+        uint8_t* partial_start_sequence, uint16_t partial_start_sequence_len, uint16_t partial_refresh_limit) {
     if (highlight_color != 0x000000) {
         self->core.colorspace.tricolor = true;
         self->core.colorspace.tricolor_hue = displayio_colorconverter_compute_hue(highlight_color);
@@ -77,6 +78,10 @@ void common_hal_displayio_epaperdisplay_construct(displayio_epaperdisplay_obj_t*
     self->start_sequence_len = start_sequence_len;
     self->stop_sequence = stop_sequence;
     self->stop_sequence_len = stop_sequence_len;
+    self->partial_start_sequence = partial_start_sequence;
+    self->partial_start_sequence_len = partial_start_sequence_len;
+    self->partial_refresh_limit = partial_refresh_limit;
+    self->partial_refreshes = 0;
 
     self->busy.base.type = &mp_type_NoneType;
     if (busy_pin != NULL) {
@@ -114,7 +119,7 @@ const displayio_area_t* displayio_epaperdisplay_get_refresh_areas(displayio_epap
         self->core.area.next = NULL;
         return &self->core.area;
     }
-    return first_area;
+    return displayio_display_core_coalesce_areas(&self->core, first_area);
 }
 
 uint16_t common_hal_displayio_epaperdisplay_get_width(displayio_epaperdisplay_obj_t* self){
@@ -162,11 +167,15 @@ STATIC void send_command_sequence(displayio_epaperdisplay_obj_t* self, bool shou
     }
 }
 
-void displayio_epaperdisplay_start_refresh(displayio_epaperdisplay_obj_t* self) {
+void displayio_epaperdisplay_start_refresh(displayio_epaperdisplay_obj_t* self, bool partial) {
     // run start sequence
     self->core.bus_reset(self->core.bus);
 
-    send_command_sequence(self, true, self->start_sequence, self->start_sequence_len);
+    if (partial) {
+        send_command_sequence(self, true, self->partial_start_sequence, self->partial_start_sequence_len);
+    } else {
+        send_command_sequence(self, true, self->start_sequence, self->start_sequence_len);
+    }
     displayio_display_core_start_refresh(&self->core);
 }
 
@@ -197,7 +206,7 @@ mp_obj_t common_hal_displayio_epaperdisplay_get_bus(displayio_epaperdisplay_obj_
 }
 
 bool displayio_epaperdisplay_refresh_area(displayio_epaperdisplay_obj_t* self, const displayio_area_t* area) {
-    uint16_t buffer_size = 128; // In uint32_ts
+    uint16_t buffer_size = CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE; // In uint32_ts
 
     displayio_area_t clipped;
     // Clip the area to the display by overlapping the areas. If there is no overlap then we're done.
@@ -234,6 +243,8 @@ bool displayio_epaperdisplay_refresh_area(displayio_epaperdisplay_obj_t* self, c
     if (self->core.colorspace.tricolor) {
         passes = 2;
     }
+    self->core.pixels_sent += displayio_area_size(&clipped) * passes;
+    self->core.windows_sent += passes;
     for (uint8_t pass = 0; pass < passes; pass++) {
         uint16_t remaining_rows = displayio_area_height(&clipped);
 
@@ -323,7 +334,20 @@ bool common_hal_displayio_epaperdisplay_refresh(displayio_epaperdisplay_obj_t* s
     if (current_area == NULL) {
         return true;
     }
-    displayio_epaperdisplay_start_refresh(self);
+    // Partial refreshes leave ghosts behind so every so often redraw everything
+    // with a full refresh to clear them.
+    bool partial = self->partial_start_sequence != NULL && !self->core.full_refresh;
+    if (partial && self->partial_refreshes >= self->partial_refresh_limit) {
+        partial = false;
+        self->core.area.next = NULL;
+        current_area = &self->core.area;
+    }
+    if (partial) {
+        self->partial_refreshes++;
+    } else {
+        self->partial_refreshes = 0;
+    }
+    displayio_epaperdisplay_start_refresh(self, partial);
     while (current_area != NULL) {
         displayio_epaperdisplay_refresh_area(self, current_area);
         current_area = current_area->next;
@@ -367,6 +391,7 @@ void displayio_epaperdisplay_collect_ptrs(displayio_epaperdisplay_obj_t* self) {
     displayio_display_core_collect_ptrs(&self->core);
     gc_collect_ptr(self->start_sequence);
     gc_collect_ptr(self->stop_sequence);
+    gc_collect_ptr(self->partial_start_sequence);
 }
 
 bool maybe_refresh_epaperdisplay(void) {
@@ -380,6 +405,8 @@ bool maybe_refresh_epaperdisplay(void) {
         if (common_hal_displayio_epaperdisplay_get_time_to_refresh(display) != 0) {
             return false;
         }
+        // The one refresh has to show all of the output.
+        supervisor_terminal_flush();
         return common_hal_displayio_epaperdisplay_refresh(display);
     }
     // Return true if no ePaper displays are available to pretend it was updated.
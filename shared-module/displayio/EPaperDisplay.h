@@ -43,6 +43,12 @@ typedef struct {
     uint32_t start_sequence_len;
     uint8_t* stop_sequence;
     uint32_t stop_sequence_len;
+    // Run instead of start_sequence to refresh only what changed. NULL when
+    // the panel can't do partial refreshes.
+    uint8_t* partial_start_sequence;
+    uint32_t partial_start_sequence_len;
+    uint16_t partial_refresh_limit; // Partial refreshes between full ones.
+    uint16_t partial_refreshes; // Partial refreshes since the last full one.
     uint16_t refresh_time;
     uint16_t set_column_window_command;
     uint16_t set_row_window_command;
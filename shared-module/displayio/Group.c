@@ -27,6 +27,7 @@
 #include "shared-bindings/displayio/Group.h"
 
 #include "py/runtime.h"
+#include "shared-bindings/displayio/TextLayer.h"
 #include "shared-bindings/displayio/TileGrid.h"
 
 #if CIRCUITPY_VECTORIO
@@ -93,6 +94,10 @@ bool displayio_group_get_previous_area(displayio_group_t *self, displayio_area_t
             if (!displayio_tilegrid_get_previous_area(layer, &layer_area)) {
                 continue;
             }
+        } else if (MP_OBJ_IS_TYPE(layer, &displayio_textlayer_type)) {
+            if (!displayio_textlayer_get_previous_area(layer, &layer_area)) {
+                continue;
+            }
         } else if (MP_OBJ_IS_TYPE(layer, &displayio_group_type)) {
             if (!displayio_group_get_previous_area(layer, &layer_area)) {
                 continue;
@@ -130,6 +135,8 @@ static void _update_child_transforms(displayio_group_t* self) {
 #endif
         if (MP_OBJ_IS_TYPE(layer, &displayio_tilegrid_type)) {
             displayio_tilegrid_update_transform(layer, &self->absolute_transform);
+        } else if (MP_OBJ_IS_TYPE(layer, &displayio_textlayer_type)) {
+            displayio_textlayer_update_transform(layer, &self->absolute_transform);
         } else if (MP_OBJ_IS_TYPE(layer, &displayio_group_type)) {
             displayio_group_update_transform(layer, &self->absolute_transform);
         }
@@ -219,6 +226,15 @@ static mp_obj_t _add_layer(displayio_group_t* self, mp_obj_t layer) {
         return native_layer;
     }
 #endif
+    native_layer = mp_instance_cast_to_native_base(layer, &displayio_textlayer_type);
+    if (native_layer != MP_OBJ_NULL) {
+        displayio_textlayer_t* textlayer = native_layer;
+        if (textlayer->in_group) {
+            mp_raise_ValueError(translate("Layer already in a group."));
+        }
+        displayio_textlayer_update_transform(textlayer, &self->absolute_transform);
+        return native_layer;
+    }
     native_layer = mp_instance_cast_to_native_base(layer, &displayio_group_type);
     if (native_layer == MP_OBJ_NULL) {
         native_layer = mp_instance_cast_to_native_base(layer, &displayio_tilegrid_type);
@@ -260,6 +276,10 @@ static void _remove_layer(displayio_group_t* self, size_t index) {
         displayio_tilegrid_t* tilegrid = layer;
         rendered_last_frame = displayio_tilegrid_get_previous_area(tilegrid, &layer_area);
         displayio_tilegrid_update_transform(tilegrid, NULL);
+    } else if (MP_OBJ_IS_TYPE(layer, &displayio_textlayer_type)) {
+        displayio_textlayer_t* textlayer = layer;
+        rendered_last_frame = displayio_textlayer_get_previous_area(textlayer, &layer_area);
+        displayio_textlayer_update_transform(textlayer, NULL);
     } else if (MP_OBJ_IS_TYPE(layer, &displayio_group_type)) {
         displayio_group_t* group = layer;
         rendered_last_frame = displayio_group_get_previous_area(group, &layer_area);
@@ -338,7 +358,9 @@ void displayio_group_construct(displayio_group_t* self, displayio_group_child_t*
     self->in_group = false;
 }
 
-bool displayio_group_fill_area(displayio_group_t *self, const _displayio_colorspace_t* colorspace, const displayio_area_t* area, uint32_t* mask, uint32_t* buffer) {
+// Covered is shared by the whole tree so that opaque layers drawn first, in
+// any group, let later ones be skipped without checking every pixel.
+STATIC bool _fill_area(displayio_group_t *self, const _displayio_colorspace_t* colorspace, const displayio_area_t* area, uint32_t* mask, uint32_t* buffer, displayio_area_t* covered) {
     // Track if any of the layers finishes filling in the given area. We can ignore any remaining
     // layers at that point.
     bool full_coverage = false;
@@ -354,20 +376,32 @@ bool displayio_group_fill_area(displayio_group_t *self, const _displayio_colorsp
         else
 #endif
         if (MP_OBJ_IS_TYPE(layer, &displayio_tilegrid_type)) {
-            if (displayio_tilegrid_fill_area(layer, colorspace, area, mask, buffer)) {
+            if (displayio_tilegrid_fill_area(layer, colorspace, area, mask, buffer, covered)) {
                 full_coverage = true;
                 break;
             }
+        } else if (MP_OBJ_IS_TYPE(layer, &displayio_textlayer_type)) {
+            displayio_textlayer_fill_area(layer, colorspace, area, mask, buffer);
         } else if (MP_OBJ_IS_TYPE(layer, &displayio_group_type)) {
-            if (displayio_group_fill_area(layer, colorspace, area, mask, buffer)) {
+            if (_fill_area(layer, colorspace, area, mask, buffer, covered)) {
                 full_coverage = true;
                 break;
             }
         }
+        // Opaque layers may have covered the area together.
+        if (displayio_area_equal(covered, area)) {
+            full_coverage = true;
+            break;
+        }
     }
     return full_coverage;
 }
 
+bool displayio_group_fill_area(displayio_group_t *self, const _displayio_colorspace_t* colorspace, const displayio_area_t* area, uint32_t* mask, uint32_t* buffer) {
+    displayio_area_t covered = {0, 0, 0, 0, NULL};
+    return _fill_area(self, colorspace, area, mask, buffer, &covered);
+}
+
 void displayio_group_finish_refresh(displayio_group_t *self) {
     self->item_removed = false;
     for (int32_t i = self->size - 1; i >= 0 ; i--) {
@@ -380,6 +414,8 @@ void displayio_group_finish_refresh(displayio_group_t *self) {
 #endif
         if (MP_OBJ_IS_TYPE(layer, &displayio_tilegrid_type)) {
             displayio_tilegrid_finish_refresh(layer);
+        } else if (MP_OBJ_IS_TYPE(layer, &displayio_textlayer_type)) {
+            displayio_textlayer_finish_refresh(layer);
         } else if (MP_OBJ_IS_TYPE(layer, &displayio_group_type)) {
             displayio_group_finish_refresh(layer);
         }
@@ -402,6 +438,8 @@ displayio_area_t* displayio_group_get_refresh_areas(displayio_group_t *self, dis
 #endif
         if (MP_OBJ_IS_TYPE(layer, &displayio_tilegrid_type)) {
             tail = displayio_tilegrid_get_refresh_areas(layer, tail);
+        } else if (MP_OBJ_IS_TYPE(layer, &displayio_textlayer_type)) {
+            tail = displayio_textlayer_get_refresh_areas(layer, tail);
         } else if (MP_OBJ_IS_TYPE(layer, &displayio_group_type)) {
             tail = displayio_group_get_refresh_areas(layer, tail);
         }
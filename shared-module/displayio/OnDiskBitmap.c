@@ -114,65 +114,116 @@ void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self,
         self->stride = (bit_stride / 8);
     }
 
+    self->cache_y = -1;
+    self->cache_len = 0;
 }
 
 
-uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *self,
-        int16_t x, int16_t y) {
-    if (x < 0 || x >= self->width || y < 0 || y >= self->height) {
-        return 0;
+static uint32_t convert_pixel(displayio_ondiskbitmap_t *self, uint32_t pixel_data) {
+    uint8_t red;
+    uint8_t green;
+    uint8_t blue;
+    if (self->bits_per_pixel == 1) {
+        if (pixel_data == 1) {
+            return 0xFFFFFF;
+        } else {
+            return 0x000000;
+        }
+    } else if (self->bits_per_pixel <= 8) {
+        return self->palette_data[pixel_data];
+    } else if (self->bits_per_pixel == 16) {
+        if (self->g_bitmask == 0x07e0) { // 565
+            red =((pixel_data & self->r_bitmask) >>11);
+            green = ((pixel_data & self->g_bitmask) >>5);
+            blue = ((pixel_data & self->b_bitmask) >> 0);
+        } else { // 555
+            red =((pixel_data & self->r_bitmask) >>10);
+            green = ((pixel_data & self->g_bitmask) >>4);
+            blue = ((pixel_data & self->b_bitmask) >> 0);
+        }
+        return red << 19 | green << 10 | blue << 3;
+    } else if ((self->bits_per_pixel == 32) && (self->bitfield_compressed)) {
+        return pixel_data & 0x00FFFFFF;
+    } else {
+        return pixel_data;
     }
+}
 
-    uint32_t location;
+// Read and convert the span of row y that starts at (or just before) x, with
+// a single seek and read, instead of going back to the file for every pixel.
+static void load_row_span(displayio_ondiskbitmap_t *self, int16_t x, int16_t y) {
     uint8_t bytes_per_pixel = (self->bits_per_pixel / 8)  ? (self->bits_per_pixel /8) : 1;
     uint8_t pixels_per_byte = 8 / self->bits_per_pixel;
-    if (pixels_per_byte == 0){
-        location = self->data_offset + (self->height - y - 1) * self->stride + x * bytes_per_pixel;
+    if (pixels_per_byte != 0) {
+        x -= x % pixels_per_byte;
+    }
+    uint16_t count = self->width - x;
+    if (count > DISPLAYIO_ONDISKBITMAP_ROW_CACHE_PIXELS) {
+        count = DISPLAYIO_ONDISKBITMAP_ROW_CACHE_PIXELS;
+    }
+
+    uint32_t location = self->data_offset + (self->height - y - 1) * self->stride;
+    uint16_t span_bytes;
+    if (pixels_per_byte == 0) {
+        location += x * bytes_per_pixel;
+        span_bytes = count * bytes_per_pixel;
     } else {
-        location = self->data_offset + (self->height - y - 1) * self->stride + x / pixels_per_byte;
+        location += x / pixels_per_byte;
+        span_bytes = (count + pixels_per_byte - 1) / pixels_per_byte;
     }
-    // We don't cache here because the underlying FS caches sectors.
-    f_lseek(&self->file->fp, location);
+
+    self->cache_len = 0;
+    uint8_t span[DISPLAYIO_ONDISKBITMAP_ROW_CACHE_PIXELS * 4];
     UINT bytes_read;
-    uint32_t pixel_data = 0;
-    uint32_t result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
-    if (result == FR_OK) {
-        uint32_t tmp = 0;
-        uint8_t red;
-        uint8_t green;
-        uint8_t blue;
-        if (bytes_per_pixel == 1) {
-            uint8_t offset = (x % pixels_per_byte) * self->bits_per_pixel;
-            uint8_t mask = (1 << self->bits_per_pixel) - 1;
-
-            uint8_t index = (pixel_data >> ((8 - self->bits_per_pixel) - offset)) & mask;
-            if (self->bits_per_pixel == 1) {
-                if (index == 1) {
-                    return 0xFFFFFF;
-                } else {
-                    return 0x000000;
-                }
-            }
-            return self->palette_data[index];
-        } else if (bytes_per_pixel == 2) {
-            if (self->g_bitmask == 0x07e0) { // 565
-                red =((pixel_data & self->r_bitmask) >>11);
-                green = ((pixel_data & self->g_bitmask) >>5);
-                blue = ((pixel_data & self->b_bitmask) >> 0);
-            } else { // 555
-                red =((pixel_data & self->r_bitmask) >>10);
-                green = ((pixel_data & self->g_bitmask) >>4);
-                blue = ((pixel_data & self->b_bitmask) >> 0);
+    f_lseek(&self->file->fp, location);
+    if (f_read(&self->file->fp, span, span_bytes, &bytes_read) != FR_OK) {
+        return;
+    }
+
+    // Only keep the pixels that were read completely.
+    if (pixels_per_byte == 0) {
+        count = bytes_read / bytes_per_pixel;
+    } else if (bytes_read * pixels_per_byte < count) {
+        count = bytes_read * pixels_per_byte;
+    }
+
+    if (pixels_per_byte == 0) {
+        const uint8_t *p = span;
+        for (uint16_t i = 0; i < count; i++) {
+            uint32_t pixel_data = 0;
+            for (uint8_t b = 0; b < bytes_per_pixel; b++) {
+                pixel_data |= (uint32_t)*p++ << (8 * b);
             }
-            tmp = (red << 19 | green << 10 | blue << 3);
-            return tmp;
-        } else if ((bytes_per_pixel == 4) && (self->bitfield_compressed)) {
-            return pixel_data & 0x00FFFFFF;
-        } else {
-            return pixel_data;
+            self->row_cache[i] = convert_pixel(self, pixel_data);
+        }
+    } else {
+        uint8_t mask = (1 << self->bits_per_pixel) - 1;
+        for (uint16_t i = 0; i < count; i++) {
+            uint8_t offset = (i % pixels_per_byte) * self->bits_per_pixel;
+            uint8_t index = (span[i / pixels_per_byte] >> ((8 - self->bits_per_pixel) - offset)) & mask;
+            self->row_cache[i] = convert_pixel(self, index);
+        }
+    }
+    self->cache_x = x;
+    self->cache_y = y;
+    self->cache_len = count;
+}
+
+uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *self,
+        int16_t x, int16_t y) {
+    if (x < 0 || x >= self->width || y < 0 || y >= self->height) {
+        return 0;
+    }
+
+    // Pixels are drawn along rows, so most of them come from the span
+    // loaded for the previous pixel.
+    if (y != self->cache_y || x < self->cache_x || x >= self->cache_x + self->cache_len) {
+        load_row_span(self, x, y);
+        if (self->cache_len == 0 || x >= self->cache_x + self->cache_len) {
+            return 0;
         }
     }
-    return 0;
+    return self->row_cache[x - self->cache_x];
 }
 
 uint16_t common_hal_displayio_ondiskbitmap_get_height(displayio_ondiskbitmap_t *self) {
@@ -34,6 +34,9 @@
 
 #include "extmod/vfs_fat.h"
 
+// Number of converted pixels of a row kept from the last read of the file.
+#define DISPLAYIO_ONDISKBITMAP_ROW_CACHE_PIXELS (64)
+
 typedef struct {
     mp_obj_base_t base;
     uint16_t width;
@@ -47,6 +50,11 @@ typedef struct {
     pyb_file_obj_t* file;
     uint8_t bits_per_pixel;
     uint32_t* palette_data;
+    // A span of row cache_y starting at cache_x, already converted to RGB888.
+    int16_t cache_y;
+    uint16_t cache_x;
+    uint16_t cache_len;
+    uint32_t row_cache[DISPLAYIO_ONDISKBITMAP_ROW_CACHE_PIXELS];
 } displayio_ondiskbitmap_t;
 
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_ONDISKBITMAP_H
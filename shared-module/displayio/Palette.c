@@ -31,6 +31,8 @@
 void common_hal_displayio_palette_construct(displayio_palette_t* self, uint16_t color_count) {
     self->color_count = color_count;
     self->colors = (_displayio_color_t *) m_malloc(color_count * sizeof(_displayio_color_t), false);
+    self->native_colors = (uint16_t *) m_malloc(color_count * sizeof(uint16_t), false);
+    self->cache_key = 0;
 }
 
 void common_hal_displayio_palette_make_opaque(displayio_palette_t* self, uint32_t palette_index) {
@@ -57,40 +59,68 @@ void common_hal_displayio_palette_set_color(displayio_palette_t* self, uint32_t
     self->colors[palette_index].chroma = chroma;
     self->colors[palette_index].hue = displayio_colorconverter_compute_hue(color);
     self->needs_refresh = true;
+    self->cache_key = 0;
 }
 
 uint32_t common_hal_displayio_palette_get_color(displayio_palette_t* self, uint32_t palette_index) {
     return self->colors[palette_index].rgb888;
 }
 
-bool displayio_palette_get_color(displayio_palette_t *self, const _displayio_colorspace_t* colorspace, uint32_t palette_index, uint32_t* color) {
-    if (palette_index > self->color_count || self->colors[palette_index].transparent) {
-        return false; // returns opaque
-    }
-
+STATIC uint32_t _convert_color(const _displayio_color_t* palette_color, const _displayio_colorspace_t* colorspace) {
+    uint32_t color;
     if (colorspace->tricolor) {
-        uint8_t luma = self->colors[palette_index].luma;
-        *color = luma >> (8 - colorspace->depth);
+        uint8_t luma = palette_color->luma;
+        color = luma >> (8 - colorspace->depth);
         // Chroma 0 means the color is a gray and has no hue so never color based on it.
-        if (self->colors[palette_index].chroma  <= 16) {
+        if (palette_color->chroma  <= 16) {
             if (!colorspace->grayscale) {
-                *color = 0;
+                color = 0;
             }
-            return true;
+            return color;
         }
-        uint8_t pixel_hue = self->colors[palette_index].hue;
-        displayio_colorconverter_compute_tricolor(colorspace, pixel_hue, luma, color);
+        uint8_t pixel_hue = palette_color->hue;
+        displayio_colorconverter_compute_tricolor(colorspace, pixel_hue, luma, &color);
     } else if (colorspace->grayscale) {
-        *color = self->colors[palette_index].luma >> (8 - colorspace->depth);
+        color = palette_color->luma >> (8 - colorspace->depth);
     } else {
-        uint16_t packed = self->colors[palette_index].rgb565;
+        uint16_t packed = palette_color->rgb565;
         if (colorspace->reverse_bytes_in_word) {
             // swap bytes
             packed = __builtin_bswap16(packed);
         }
-        *color = packed;
+        color = packed;
+    }
+    return color;
+}
+
+// Packs everything _convert_color depends on. Never 0 because depth isn't.
+STATIC uint32_t _colorspace_key(const _displayio_colorspace_t* colorspace) {
+    return colorspace->depth |
+           colorspace->grayscale << 8 |
+           colorspace->tricolor << 9 |
+           colorspace->reverse_bytes_in_word << 10 |
+           colorspace->tricolor_hue << 16;
+}
+
+bool displayio_palette_get_color(displayio_palette_t *self, const _displayio_colorspace_t* colorspace, uint32_t palette_index, uint32_t* color) {
+    if (palette_index >= self->color_count || self->colors[palette_index].transparent) {
+        return false; // returns opaque
     }
 
+    if (self->native_colors == NULL) {
+        *color = _convert_color(&self->colors[palette_index], colorspace);
+        return true;
+    }
+    // EPaperDisplay switches grayscale between passes so this may rebuild a
+    // couple of times per refresh, which is still once per color, not pixel.
+    uint32_t key = _colorspace_key(colorspace);
+    if (key != self->cache_key) {
+        for (uint32_t i = 0; i < self->color_count; i++) {
+            self->native_colors[i] = _convert_color(&self->colors[i], colorspace);
+        }
+        self->cache_key = key;
+    }
+    *color = self->native_colors[palette_index];
     return true;
 }
 
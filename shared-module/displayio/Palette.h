@@ -72,6 +72,10 @@ typedef struct {
     mp_obj_base_t base;
     _displayio_color_t* colors;
     uint32_t color_count;
+    // Colors already converted for the colorspace identified by cache_key. NULL
+    // for palettes that aren't on the heap, which convert every pixel instead.
+    uint16_t* native_colors;
+    uint32_t cache_key;
     bool needs_refresh;
 } displayio_palette_t;
 
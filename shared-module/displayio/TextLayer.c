@@ -0,0 +1,471 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/displayio/TextLayer.h"
+
+#include "py/runtime.h"
+#include "py/unicode.h"
+#include "shared-bindings/displayio/Bitmap.h"
+#include "shared-bindings/displayio/ColorConverter.h"
+#include "shared-bindings/displayio/Palette.h"
+#include "shared-bindings/fontio/BuiltinFont.h"
+
+// Looks up a glyph in either a BuiltinFont or a font with get_glyph, such as the ones loaded by
+// adafruit_bitmap_font. The glyph is placed relative to the pen on the baseline and shift_x is
+// set to how far the pen moves afterwards. Returns false if the font doesn't have the glyph.
+static bool _get_glyph(mp_obj_t font, mp_uint_t codepoint, displayio_textlayer_glyph_t* glyph, int16_t* shift_x) {
+    displayio_bitmap_t* bitmap;
+    mp_int_t tile_index, width, height, dx, dy;
+    if (MP_OBJ_IS_TYPE(font, &fontio_builtinfont_type)) {
+        const fontio_builtinfont_t* builtin = MP_OBJ_TO_PTR(font);
+        tile_index = fontio_builtinfont_get_glyph_index(builtin, codepoint);
+        if (tile_index == 0xff) {
+            return false;
+        }
+        bitmap = (displayio_bitmap_t*) builtin->bitmap;
+        width = builtin->width;
+        height = builtin->height;
+        dx = 0;
+        dy = 0;
+        *shift_x = width;
+    } else {
+        mp_obj_t method[3];
+        mp_load_method(font, MP_QSTR_get_glyph, method);
+        method[2] = MP_OBJ_NEW_SMALL_INT(codepoint);
+        mp_obj_t glyph_obj = mp_call_method_n_kw(1, 0, method);
+        if (glyph_obj == mp_const_none) {
+            return false;
+        }
+        size_t len;
+        mp_obj_t* items;
+        mp_obj_tuple_get(glyph_obj, &len, &items);
+        if (len < 8 || !MP_OBJ_IS_TYPE(items[0], &displayio_bitmap_type)) {
+            mp_raise_TypeError_varg(translate("unsupported %q type"), MP_QSTR_font);
+        }
+        bitmap = MP_OBJ_TO_PTR(items[0]);
+        tile_index = mp_obj_get_int(items[1]);
+        width = mp_obj_get_int(items[2]);
+        height = mp_obj_get_int(items[3]);
+        dx = mp_obj_get_int(items[4]);
+        dy = mp_obj_get_int(items[5]);
+        *shift_x = mp_obj_get_int(items[6]);
+    }
+    if (width <= 0 || height <= 0 || width > bitmap->width || height > bitmap->height) {
+        // Nothing to draw, but the pen still moves.
+        width = 0;
+        height = 0;
+    } else {
+        uint16_t tiles_per_row = bitmap->width / width;
+        glyph->source_x = (tile_index % tiles_per_row) * width;
+        glyph->source_y = (tile_index / tiles_per_row) * height;
+        if (glyph->source_y + height > bitmap->height) {
+            height = 0;
+        }
+    }
+    glyph->bitmap = bitmap;
+    glyph->x = dx;
+    glyph->y = -height - dy;
+    glyph->width = width;
+    glyph->height = height;
+    return true;
+}
+
+static int16_t _get_line_height(mp_obj_t font) {
+    if (MP_OBJ_IS_TYPE(font, &fontio_builtinfont_type)) {
+        const fontio_builtinfont_t* builtin = MP_OBJ_TO_PTR(font);
+        return builtin->height;
+    }
+    size_t len;
+    mp_obj_t* items;
+    mp_obj_t method[2];
+    mp_load_method(font, MP_QSTR_get_bounding_box, method);
+    mp_obj_tuple_get(mp_call_method_n_kw(0, 0, method), &len, &items);
+    if (len < 2) {
+        mp_raise_TypeError_varg(translate("unsupported %q type"), MP_QSTR_font);
+    }
+    return mp_obj_get_int(items[1]);
+}
+
+// Works out the absolute area of part of the layer, given relative to x and y.
+static void _get_screen_area(displayio_textlayer_t *self, const displayio_area_t* local, displayio_area_t* out_area) {
+    const displayio_buffer_transform_t* transform = self->absolute_transform;
+    int16_t x1 = self->x + local->x1;
+    int16_t x2 = self->x + local->x2;
+    int16_t y1 = self->y + local->y1;
+    int16_t y2 = self->y + local->y2;
+    if (transform->transpose_xy) {
+        out_area->x1 = transform->x + transform->dx * y1;
+        out_area->x2 = transform->x + transform->dx * y2;
+        out_area->y1 = transform->y + transform->dy * x1;
+        out_area->y2 = transform->y + transform->dy * x2;
+    } else {
+        out_area->x1 = transform->x + transform->dx * x1;
+        out_area->x2 = transform->x + transform->dx * x2;
+        out_area->y1 = transform->y + transform->dy * y1;
+        out_area->y2 = transform->y + transform->dy * y2;
+    }
+    if (out_area->x2 < out_area->x1) {
+        int16_t temp = out_area->x2;
+        out_area->x2 = out_area->x1;
+        out_area->x1 = temp;
+    }
+    if (out_area->y2 < out_area->y1) {
+        int16_t temp = out_area->y2;
+        out_area->y2 = out_area->y1;
+        out_area->y1 = temp;
+    }
+    out_area->next = NULL;
+}
+
+// The parent coordinate whose pixel holds screen coordinate s, given the offset and scale of
+// the axis it lies along. Negative scales run the pixels backwards from offset.
+static inline int16_t _screen_to_parent(int16_t s, int16_t offset, int16_t scale) {
+    int32_t distance = s - offset;
+    if (scale > 0) {
+        return distance >= 0 ? distance / scale : -((-distance + scale - 1) / scale);
+    }
+    // The pixel at parent coordinate p covers [offset + scale * (p + 1), offset + scale * p).
+    scale = -scale;
+    distance = -distance;
+    return (distance > 0 ? (distance + scale - 1) / scale : -(-distance / scale)) - 1;
+}
+
+static void _update_current_area(displayio_textlayer_t *self) {
+    if (self->absolute_transform == NULL || self->glyph_count == 0) {
+        self->current_area.x1 = 0;
+        self->current_area.y1 = 0;
+        self->current_area.x2 = 0;
+        self->current_area.y2 = 0;
+        self->current_area.next = NULL;
+        return;
+    }
+    _get_screen_area(self, &self->bounds, &self->current_area);
+}
+
+static inline bool _area_empty(const displayio_area_t* area) {
+    return area->x1 == area->x2 || area->y1 == area->y2;
+}
+
+// Called whenever what we draw may have changed. Until the refresh finishes, dirty_area covers
+// what was drawn last frame as well as what will be drawn in the next one.
+static void _set_dirty(displayio_textlayer_t *self) {
+    _update_current_area(self);
+    if (_area_empty(&self->dirty_area)) {
+        displayio_area_copy(&self->current_area, &self->dirty_area);
+    } else if (!_area_empty(&self->current_area)) {
+        displayio_area_expand(&self->dirty_area, &self->current_area);
+    }
+    self->dirty = true;
+}
+
+static void _layout(displayio_textlayer_t *self) {
+    size_t len;
+    const byte* text = (const byte*) mp_obj_str_get_data(self->text, &len);
+    const byte* end = text + len;
+
+    // One glyph at most for each character.
+    size_t codepoint_count = utf8_charlen(text, len);
+    displayio_textlayer_glyph_t* glyphs = m_new(displayio_textlayer_glyph_t, codepoint_count);
+    size_t glyph_count = 0;
+
+    int16_t line_height = 0;
+    int16_t pen_x = 0;
+    int16_t pen_y = 0;
+    const byte* previous = NULL;
+    for (const byte* i = text; i < end;) {
+        const byte* next = utf8_next_char(i);
+        unichar c = utf8_get_char(i);
+        if (c == '\n') {
+            if (line_height == 0) {
+                line_height = _get_line_height(self->font);
+            }
+            pen_x = 0;
+            pen_y += line_height;
+            previous = NULL;
+            i = next;
+            continue;
+        }
+        if (previous != NULL && self->kerning != mp_const_none) {
+            // Kerning is keyed by the pair of characters, such as "AV".
+            mp_obj_t pair = mp_obj_new_str((const char*) previous, next - previous);
+            mp_map_elem_t* adjust = mp_map_lookup(mp_obj_dict_get_map(self->kerning), pair, MP_MAP_LOOKUP);
+            if (adjust != NULL) {
+                pen_x += mp_obj_get_int(adjust->value);
+            }
+        }
+        int16_t shift_x;
+        displayio_textlayer_glyph_t* glyph = &glyphs[glyph_count];
+        if (_get_glyph(self->font, c, glyph, &shift_x)) {
+            glyph->x += pen_x;
+            glyph->y += pen_y;
+            pen_x += shift_x;
+            if (glyph->width > 0) {
+                glyph_count++;
+            }
+        }
+        previous = i;
+        i = next;
+    }
+
+    self->bounds.x1 = 0;
+    self->bounds.y1 = 0;
+    self->bounds.x2 = 0;
+    self->bounds.y2 = 0;
+    for (size_t i = 0; i < glyph_count; i++) {
+        displayio_area_t glyph_area = {glyphs[i].x, glyphs[i].y, glyphs[i].x + glyphs[i].width, glyphs[i].y + glyphs[i].height, NULL};
+        if (i == 0) {
+            displayio_area_copy(&glyph_area, &self->bounds);
+        } else {
+            displayio_area_expand(&self->bounds, &glyph_area);
+        }
+    }
+
+    if (glyph_count < codepoint_count) {
+        glyphs = m_renew(displayio_textlayer_glyph_t, glyphs, codepoint_count, glyph_count);
+    }
+    if (self->glyphs != NULL) {
+        m_del(displayio_textlayer_glyph_t, self->glyphs, self->glyph_count);
+    }
+    self->glyphs = glyphs;
+    self->glyph_count = glyph_count;
+}
+
+void common_hal_displayio_textlayer_construct(displayio_textlayer_t *self, mp_obj_t font, mp_obj_t text,
+        mp_obj_t kerning, mp_obj_t pixel_shader, int16_t x, int16_t y) {
+    self->font = font;
+    self->text = text;
+    self->kerning = kerning;
+    self->pixel_shader = pixel_shader;
+    self->glyphs = NULL;
+    self->glyph_count = 0;
+    self->x = x;
+    self->y = y;
+    self->absolute_transform = NULL;
+    self->dirty = false;
+    self->in_group = false;
+    _layout(self);
+    _update_current_area(self);
+    displayio_area_copy(&self->current_area, &self->dirty_area);
+}
+
+mp_obj_t common_hal_displayio_textlayer_get_text(displayio_textlayer_t *self) {
+    return self->text;
+}
+
+void common_hal_displayio_textlayer_set_text(displayio_textlayer_t *self, mp_obj_t text) {
+    self->text = text;
+    _layout(self);
+    _set_dirty(self);
+}
+
+mp_obj_t common_hal_displayio_textlayer_get_font(displayio_textlayer_t *self) {
+    return self->font;
+}
+
+mp_obj_t common_hal_displayio_textlayer_get_pixel_shader(displayio_textlayer_t *self) {
+    return self->pixel_shader;
+}
+
+void common_hal_displayio_textlayer_set_pixel_shader(displayio_textlayer_t *self, mp_obj_t pixel_shader) {
+    self->pixel_shader = pixel_shader;
+    _set_dirty(self);
+}
+
+mp_int_t common_hal_displayio_textlayer_get_x(displayio_textlayer_t *self) {
+    return self->x;
+}
+
+void common_hal_displayio_textlayer_set_x(displayio_textlayer_t *self, mp_int_t x) {
+    if (self->x == x) {
+        return;
+    }
+    self->x = x;
+    _set_dirty(self);
+}
+
+mp_int_t common_hal_displayio_textlayer_get_y(displayio_textlayer_t *self) {
+    return self->y;
+}
+
+void common_hal_displayio_textlayer_set_y(displayio_textlayer_t *self, mp_int_t y) {
+    if (self->y == y) {
+        return;
+    }
+    self->y = y;
+    _set_dirty(self);
+}
+
+void common_hal_displayio_textlayer_get_bounds(displayio_textlayer_t *self, displayio_area_t* bounds) {
+    displayio_area_copy(&self->bounds, bounds);
+}
+
+void displayio_textlayer_update_transform(displayio_textlayer_t *self, const displayio_buffer_transform_t* absolute_transform) {
+    self->in_group = absolute_transform != NULL;
+    self->absolute_transform = absolute_transform;
+    if (absolute_transform != NULL) {
+        _set_dirty(self);
+        return;
+    }
+    // Our old group redraws where we were, so forget it.
+    _update_current_area(self);
+    displayio_area_copy(&self->current_area, &self->dirty_area);
+    self->dirty = false;
+}
+
+bool displayio_textlayer_fill_area(displayio_textlayer_t *self, const _displayio_colorspace_t* colorspace, const displayio_area_t* area, uint32_t* mask, uint32_t *buffer) {
+    displayio_area_t overlap;
+    if (self->absolute_transform == NULL || !displayio_area_compute_overlap(area, &self->current_area, &overlap)) {
+        return false;
+    }
+    const displayio_buffer_transform_t* transform = self->absolute_transform;
+
+    // A palette's output only depends on the coverage so each level is shaded once.
+    // ColorConverter may dither by position so isn't cached.
+    bool palette = MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_palette_type);
+    bool colorconverter = MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_colorconverter_type);
+    bool cached = false;
+    uint32_t cached_input = 0;
+    displayio_output_pixel_t cached_output = {0};
+
+    uint8_t pixels_per_byte = 8 / colorspace->depth;
+    uint32_t linestride_px = displayio_area_width(area);
+    displayio_input_pixel_t input_pixel;
+    displayio_output_pixel_t output_pixel;
+
+    for (size_t i = 0; i < self->glyph_count; i++) {
+        const displayio_textlayer_glyph_t* glyph = &self->glyphs[i];
+        displayio_area_t glyph_area = {glyph->x, glyph->y, glyph->x + glyph->width, glyph->y + glyph->height, NULL};
+        displayio_area_t screen_area;
+        _get_screen_area(self, &glyph_area, &screen_area);
+        displayio_area_t glyph_overlap;
+        if (!displayio_area_compute_overlap(&overlap, &screen_area, &glyph_overlap)) {
+            continue;
+        }
+        for (input_pixel.y = glyph_overlap.y1; input_pixel.y < glyph_overlap.y2; ++input_pixel.y) {
+            for (input_pixel.x = glyph_overlap.x1; input_pixel.x < glyph_overlap.x2; ++input_pixel.x) {
+                uint32_t offset = (input_pixel.y - area->y1) * linestride_px + (input_pixel.x - area->x1);
+                // Check the mask first to see if the pixel has already been set.
+                if ((mask[offset / 32] & (1u << (offset % 32))) != 0) {
+                    continue;
+                }
+                int16_t glyph_x, glyph_y;
+                if (transform->transpose_xy) {
+                    glyph_x = _screen_to_parent(input_pixel.y, transform->y, transform->dy);
+                    glyph_y = _screen_to_parent(input_pixel.x, transform->x, transform->dx);
+                } else {
+                    glyph_x = _screen_to_parent(input_pixel.x, transform->x, transform->dx);
+                    glyph_y = _screen_to_parent(input_pixel.y, transform->y, transform->dy);
+                }
+                glyph_x -= self->x + glyph->x;
+                glyph_y -= self->y + glyph->y;
+                if (glyph_x < 0 || glyph_x >= glyph->width || glyph_y < 0 || glyph_y >= glyph->height) {
+                    continue;
+                }
+                // The bitmap value is the glyph's coverage of the pixel, so 2 and 4 bit glyphs
+                // are anti-aliased by a palette that ramps from the background to the text color.
+                input_pixel.pixel = common_hal_displayio_bitmap_get_pixel(glyph->bitmap, glyph->source_x + glyph_x, glyph->source_y + glyph_y);
+                if (input_pixel.pixel == 0) {
+                    continue;
+                }
+
+                output_pixel.pixel = input_pixel.pixel;
+                output_pixel.opaque = true;
+                if (palette) {
+                    if (!cached || input_pixel.pixel != cached_input) {
+                        cached_output.pixel = 0;
+                        cached_output.opaque = displayio_palette_get_color(self->pixel_shader, colorspace, input_pixel.pixel, &cached_output.pixel);
+                        cached_input = input_pixel.pixel;
+                        cached = true;
+                    }
+                    output_pixel = cached_output;
+                } else if (colorconverter) {
+                    displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
+                }
+                if (!output_pixel.opaque) {
+                    continue;
+                }
+
+                mask[offset / 32] |= 1u << (offset % 32);
+                if (colorspace->depth == 16) {
+                    *(((uint16_t*) buffer) + offset) = output_pixel.pixel;
+                } else if (colorspace->depth == 8) {
+                    *(((uint8_t*) buffer) + offset) = output_pixel.pixel;
+                } else if (colorspace->depth < 8) {
+                    // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
+                    if (!colorspace->pixels_in_byte_share_row) {
+                        uint16_t row = offset / linestride_px;
+                        uint16_t col = offset % linestride_px;
+                        offset = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
+                    }
+                    uint8_t shift = (offset % pixels_per_byte) * colorspace->depth;
+                    if (colorspace->reverse_pixels_in_byte) {
+                        // Reverse the shift by subtracting it from the leftmost shift.
+                        shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+                    }
+                    ((uint8_t*)buffer)[offset / pixels_per_byte] |= output_pixel.pixel << shift;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+displayio_area_t* displayio_textlayer_get_refresh_areas(displayio_textlayer_t *self, displayio_area_t* tail) {
+    bool shader_changed =
+        (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_palette_type) && displayio_palette_needs_refresh(self->pixel_shader)) ||
+        (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_colorconverter_type) && displayio_colorconverter_needs_refresh(self->pixel_shader));
+    if (shader_changed && !self->dirty) {
+        displayio_area_copy(&self->current_area, &self->dirty_area);
+        self->dirty = true;
+    }
+    if (!self->dirty || _area_empty(&self->dirty_area)) {
+        return tail;
+    }
+    self->dirty_area.next = tail;
+    return &self->dirty_area;
+}
+
+bool displayio_textlayer_get_previous_area(displayio_textlayer_t *self, displayio_area_t* area) {
+    if (self->dirty || _area_empty(&self->current_area)) {
+        if (_area_empty(&self->dirty_area)) {
+            return false;
+        }
+        displayio_area_copy(&self->dirty_area, area);
+        return true;
+    }
+    displayio_area_copy(&self->current_area, area);
+    return true;
+}
+
+void displayio_textlayer_finish_refresh(displayio_textlayer_t *self) {
+    self->dirty = false;
+    displayio_area_copy(&self->current_area, &self->dirty_area);
+    if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_palette_type)) {
+        displayio_palette_finish_refresh(self->pixel_shader);
+    } else if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_colorconverter_type)) {
+        displayio_colorconverter_finish_refresh(self->pixel_shader);
+    }
+}
@@ -0,0 +1,79 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_TEXTLAYER_H
+#define MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_TEXTLAYER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "py/obj.h"
+#include "shared-module/displayio/area.h"
+#include "shared-module/displayio/Bitmap.h"
+#include "shared-module/displayio/Palette.h"
+
+// One laid out glyph. Its pixels are read straight out of the font's bitmap.
+typedef struct {
+    displayio_bitmap_t* bitmap;
+    int16_t x; // Top left of the glyph within the layer.
+    int16_t y;
+    uint16_t source_x; // Top left of the glyph within the bitmap.
+    uint16_t source_y;
+    uint16_t width;
+    uint16_t height;
+} displayio_textlayer_glyph_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_t font;
+    mp_obj_t text;
+    mp_obj_t kerning;
+    mp_obj_t pixel_shader;
+    displayio_textlayer_glyph_t* glyphs;
+    size_t glyph_count;
+    int16_t x;
+    int16_t y;
+    displayio_area_t bounds; // Covers every glyph, relative to x and y.
+    const displayio_buffer_transform_t* absolute_transform;
+    displayio_area_t current_area; // Stored as an absolute area.
+    // Covers what we drew last frame as well as what we'll draw next, until the refresh finishes.
+    displayio_area_t dirty_area;
+    bool dirty :1;
+    bool in_group :1;
+} displayio_textlayer_t;
+
+void displayio_textlayer_update_transform(displayio_textlayer_t *self, const displayio_buffer_transform_t* absolute_transform);
+
+// Area is always in absolute screen coordinates. Text never covers all of it.
+bool displayio_textlayer_fill_area(displayio_textlayer_t *self, const _displayio_colorspace_t* colorspace, const displayio_area_t* area, uint32_t* mask, uint32_t *buffer);
+
+displayio_area_t* displayio_textlayer_get_refresh_areas(displayio_textlayer_t *self, displayio_area_t* tail);
+// Fills in area with the bounds of the text in the last rendered frame. Returns false if there
+// wasn't any.
+bool displayio_textlayer_get_previous_area(displayio_textlayer_t *self, displayio_area_t* area);
+void displayio_textlayer_finish_refresh(displayio_textlayer_t *self);
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_TEXTLAYER_H
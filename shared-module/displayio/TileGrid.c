@@ -26,6 +26,8 @@
 
 #include "shared-bindings/displayio/TileGrid.h"
 
+#include <string.h>
+
 #include "py/runtime.h"
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/displayio/ColorConverter.h"
@@ -219,18 +221,8 @@ uint8_t common_hal_displayio_tilegrid_get_tile(displayio_tilegrid_t *self, uint1
     return tiles[y * self->width_in_tiles + x];
 }
 
-void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint8_t tile_index) {
-    if (tile_index >= self->tiles_in_bitmap) {
-        mp_raise_ValueError(translate("Tile index out of bounds"));
-    }
-    uint8_t* tiles = self->tiles;
-    if (self->inline_tiles) {
-        tiles = (uint8_t*) &self->tiles;
-    }
-    if (tiles == NULL) {
-        return;
-    }
-    tiles[y * self->width_in_tiles + x] = tile_index;
+// Adds count tiles of row y, starting at x, to the dirty area.
+static void _mark_tiles_dirty(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint16_t count) {
     displayio_area_t temp_area;
     displayio_area_t* tile_area;
     if (!self->partial_change) {
@@ -242,8 +234,14 @@ void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t
     if (tx < 0) {
         tx += self->width_in_tiles;
     }
-    tile_area->x1 = tx * self->tile_width;
-    tile_area->x2 = tile_area->x1 + self->tile_width;
+    if (tx + count > self->width_in_tiles) {
+        // The run wraps around the edge of the screen, so dirty the whole row.
+        tile_area->x1 = 0;
+        tile_area->x2 = self->width_in_tiles * self->tile_width;
+    } else {
+        tile_area->x1 = tx * self->tile_width;
+        tile_area->x2 = tile_area->x1 + count * self->tile_width;
+    }
     int16_t ty = (y - self->top_left_y) % self->height_in_tiles;
     if (ty < 0) {
         ty += self->height_in_tiles;
@@ -258,6 +256,51 @@ void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t
     self->partial_change = true;
 }
 
+static uint8_t* _get_tiles(displayio_tilegrid_t *self) {
+    if (self->inline_tiles) {
+        return (uint8_t*) &self->tiles;
+    }
+    return self->tiles;
+}
+
+void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint8_t tile_index) {
+    if (tile_index >= self->tiles_in_bitmap) {
+        mp_raise_ValueError(translate("Tile index out of bounds"));
+    }
+    uint8_t* tiles = _get_tiles(self);
+    if (tiles == NULL) {
+        return;
+    }
+    tiles[y * self->width_in_tiles + x] = tile_index;
+    _mark_tiles_dirty(self, x, y, 1);
+}
+
+void displayio_tilegrid_set_tiles(displayio_tilegrid_t *self, uint16_t x, uint16_t y, const uint8_t *tile_indices, uint16_t count) {
+    for (uint16_t i = 0; i < count; i++) {
+        if (tile_indices[i] >= self->tiles_in_bitmap) {
+            mp_raise_ValueError(translate("Tile index out of bounds"));
+        }
+    }
+    uint8_t* tiles = _get_tiles(self);
+    if (tiles == NULL || count == 0) {
+        return;
+    }
+    memcpy(tiles + y * self->width_in_tiles + x, tile_indices, count);
+    _mark_tiles_dirty(self, x, y, count);
+}
+
+void displayio_tilegrid_fill_tiles(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint8_t tile_index, uint16_t count) {
+    if (tile_index >= self->tiles_in_bitmap) {
+        mp_raise_ValueError(translate("Tile index out of bounds"));
+    }
+    uint8_t* tiles = _get_tiles(self);
+    if (tiles == NULL || count == 0) {
+        return;
+    }
+    memset(tiles + y * self->width_in_tiles + x, tile_index, count);
+    _mark_tiles_dirty(self, x, y, count);
+}
+
 bool common_hal_displayio_tilegrid_get_flip_x(displayio_tilegrid_t *self) {
     return self->flip_x;
 }
@@ -310,7 +353,7 @@ void common_hal_displayio_tilegrid_set_top_left(displayio_tilegrid_t *self, uint
     self->full_change = true;
 }
 
-bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self, const _displayio_colorspace_t* colorspace, const displayio_area_t* area, uint32_t* mask, uint32_t *buffer) {
+bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self, const _displayio_colorspace_t* colorspace, const displayio_area_t* area, uint32_t* mask, uint32_t *buffer, displayio_area_t* covered) {
     // If no tiles are present we have no impact.
     uint8_t* tiles = self->tiles;
     if (self->inline_tiles) {
@@ -329,6 +372,10 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self, const _displayio_c
     if (!displayio_area_compute_overlap(area, &self->current_area, &overlap)) {
         return false;
     }
+    // Every pixel we'd draw has already been drawn by opaque layers above us.
+    if (covered != NULL && displayio_area_contains(covered, &overlap)) {
+        return false;
+    }
 
     int16_t x_stride = 1;
     int16_t y_stride = displayio_area_width(area);
@@ -355,6 +402,8 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self, const _displayio_c
     // Track if this layer finishes filling in the given area. We can ignore any remaining
     // layers at that point.
     bool full_coverage = displayio_area_equal(area, &overlap);
+    // Track if every pixel of the overlap ends up drawn, by us or a layer above.
+    bool overlap_opaque = true;
 
     // TODO(tannewt): Skip coverage tracking if all pixels outside the overlap have already been
     // set and our palette is all opaque.
@@ -400,83 +449,142 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self, const _displayio_c
     displayio_input_pixel_t input_pixel;
     displayio_output_pixel_t output_pixel;
 
+    // Work out what the bitmap and shader are once rather than for every pixel.
+    enum { SOURCE_BITMAP, SOURCE_SHAPE, SOURCE_ONDISKBITMAP, SOURCE_NONE } source = SOURCE_NONE;
+    if (MP_OBJ_IS_TYPE(self->bitmap, &displayio_bitmap_type)) {
+        source = SOURCE_BITMAP;
+    } else if (MP_OBJ_IS_TYPE(self->bitmap, &displayio_shape_type)) {
+        source = SOURCE_SHAPE;
+    } else if (MP_OBJ_IS_TYPE(self->bitmap, &displayio_ondiskbitmap_type)) {
+        source = SOURCE_ONDISKBITMAP;
+    }
+    enum { SHADER_NONE, SHADER_PALETTE, SHADER_COLORCONVERTER, SHADER_UNKNOWN } shader = SHADER_UNKNOWN;
+    if (self->pixel_shader == mp_const_none) {
+        shader = SHADER_NONE;
+    } else if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_palette_type)) {
+        shader = SHADER_PALETTE;
+    } else if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_colorconverter_type)) {
+        shader = SHADER_COLORCONVERTER;
+    }
+    // A palette's output only depends on the index so runs of the same index
+    // are shaded once. ColorConverter may dither by position so isn't cached.
+    bool cached = false;
+    uint32_t cached_input = 0;
+    displayio_output_pixel_t cached_output = {0};
+
+    uint8_t scale = self->absolute_transform->scale;
+    // When scaled up, each source pixel covers scale pixels in a row. Its color
+    // is worked out once and replicated unless dithering makes it depend on
+    // the position.
+    bool replicate = scale > 1 &&
+        (shader != SHADER_COLORCONVERTER || !((displayio_colorconverter_t*) MP_OBJ_TO_PTR(self->pixel_shader))->dither);
+    displayio_output_pixel_t last_output = {0};
     for (input_pixel.y = start_y; input_pixel.y < end_y; ++input_pixel.y) {
         int16_t row_start = start + (input_pixel.y - start_y + y_shift) * y_stride; // in pixels
-        int16_t local_y = input_pixel.y / self->absolute_transform->scale;
-        for (input_pixel.x = start_x; input_pixel.x < end_x; ++input_pixel.x) {
-            // Compute the destination pixel in the buffer and mask based on the transformations.
-            int16_t offset = row_start + (input_pixel.x - start_x + x_shift) * x_stride; // in pixels
-
-            // This is super useful for debugging out of range accesses. Uncomment to use.
-            // if (offset < 0 || offset >= (int32_t) displayio_area_size(area)) {
-            //     asm("bkpt");
-            // }
-
-            // Check the mask first to see if the pixel has already been set.
-            if ((mask[offset / 32] & (1 << (offset % 32))) != 0) {
-                continue;
-            }
-            int16_t local_x = input_pixel.x / self->absolute_transform->scale;
-            uint16_t tile_location = ((local_y / self->tile_height + self->top_left_y) % self->height_in_tiles) * self->width_in_tiles + (local_x / self->tile_width + self->top_left_x) % self->width_in_tiles;
-            input_pixel.tile = tiles[tile_location];
-            input_pixel.tile_x = (input_pixel.tile % self->bitmap_width_in_tiles) * self->tile_width + local_x % self->tile_width;
-            input_pixel.tile_y = (input_pixel.tile / self->bitmap_width_in_tiles) * self->tile_height + local_y % self->tile_height;
-
-            //uint32_t value = 0;
-            output_pixel.pixel = 0;
-            input_pixel.pixel = 0;
-
-            // We always want to read bitmap pixels by row first and then transpose into the destination
-            // buffer because most bitmaps are row associated.
-            if (MP_OBJ_IS_TYPE(self->bitmap, &displayio_bitmap_type)) {
-                input_pixel.pixel = common_hal_displayio_bitmap_get_pixel(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
-            } else if (MP_OBJ_IS_TYPE(self->bitmap, &displayio_shape_type)) {
-                input_pixel.pixel = common_hal_displayio_shape_get_pixel(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
-            } else if (MP_OBJ_IS_TYPE(self->bitmap, &displayio_ondiskbitmap_type)) {
-                input_pixel.pixel = common_hal_displayio_ondiskbitmap_get_pixel(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
+        int16_t local_y = input_pixel.y / scale;
+        int16_t last_local_x = -1;
+        uint16_t tile_row = ((local_y / self->tile_height + self->top_left_y) % self->height_in_tiles) * self->width_in_tiles;
+        uint16_t y_in_tile = local_y % self->tile_height;
+        input_pixel.x = start_x;
+        // Walk the row one tile at a time so the tile lookup is done once per span.
+        while (input_pixel.x < end_x) {
+            int16_t tile_column = input_pixel.x / scale / self->tile_width;
+            int16_t span_end = (tile_column + 1) * self->tile_width * scale;
+            if (span_end > end_x) {
+                span_end = end_x;
             }
+            input_pixel.tile = tiles[tile_row + (tile_column + self->top_left_x) % self->width_in_tiles];
+            uint16_t tile_x_start = (input_pixel.tile % self->bitmap_width_in_tiles) * self->tile_width;
+            input_pixel.tile_y = (input_pixel.tile / self->bitmap_width_in_tiles) * self->tile_height + y_in_tile;
+
+            for (; input_pixel.x < span_end; ++input_pixel.x) {
+                // Compute the destination pixel in the buffer and mask based on the transformations.
+                int16_t offset = row_start + (input_pixel.x - start_x + x_shift) * x_stride; // in pixels
+
+                // This is super useful for debugging out of range accesses. Uncomment to use.
+                // if (offset < 0 || offset >= (int32_t) displayio_area_size(area)) {
+                //     asm("bkpt");
+                // }
+
+                // Check the mask first to see if the pixel has already been set.
+                if ((mask[offset / 32] & (1 << (offset % 32))) != 0) {
+                    continue;
+                }
+                int16_t local_x = input_pixel.x / scale;
+                input_pixel.tile_x = tile_x_start + local_x % self->tile_width;
+
+                if (replicate && local_x == last_local_x) {
+                    // Same source pixel as the last output pixel so reuse its color.
+                    output_pixel = last_output;
+                } else {
+                    //uint32_t value = 0;
+                    output_pixel.pixel = 0;
+                    input_pixel.pixel = 0;
+
+                    // We always want to read bitmap pixels by row first and then transpose into the destination
+                    // buffer because most bitmaps are row associated.
+                    if (source == SOURCE_BITMAP) {
+                        input_pixel.pixel = common_hal_displayio_bitmap_get_pixel(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
+                    } else if (source == SOURCE_SHAPE) {
+                        input_pixel.pixel = common_hal_displayio_shape_get_pixel(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
+                    } else if (source == SOURCE_ONDISKBITMAP) {
+                        input_pixel.pixel = common_hal_displayio_ondiskbitmap_get_pixel(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
+                    }
 
-            output_pixel.opaque = true;
-            if (self->pixel_shader == mp_const_none) {
-                output_pixel.pixel = input_pixel.pixel;
-            } else if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_palette_type)) {
-                output_pixel.opaque = displayio_palette_get_color(self->pixel_shader, colorspace, input_pixel.pixel, &output_pixel.pixel);
-            } else if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_colorconverter_type)) {
-                displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
-            }
-            if (!output_pixel.opaque) {
-                // A pixel is transparent so we haven't fully covered the area ourselves.
-                full_coverage = false;
-            } else {
-                mask[offset / 32] |= 1 << (offset % 32);
-                if (colorspace->depth == 16) {
-                    *(((uint16_t*) buffer) + offset) = output_pixel.pixel;
-                } else if (colorspace->depth == 8) {
-                    *(((uint8_t*) buffer) + offset) = output_pixel.pixel;
-                } else if (colorspace->depth < 8) {
-                    // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
-                    if (!colorspace->pixels_in_byte_share_row) {
-                        uint16_t width = displayio_area_width(area);
-                        uint16_t row = offset / width;
-                        uint16_t col = offset % width;
-                        // Dividing by pixels_per_byte does truncated division even if we multiply it back out.
-                        offset = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * width + row % pixels_per_byte;
-                        // Also useful for validating that the bitpacking worked correctly.
-                        // if (offset > displayio_area_size(area)) {
-                        //     asm("bkpt");
-                        // }
+                    output_pixel.opaque = true;
+                    if (shader == SHADER_NONE) {
+                        output_pixel.pixel = input_pixel.pixel;
+                    } else if (shader == SHADER_PALETTE) {
+                        if (!cached || input_pixel.pixel != cached_input) {
+                            cached_output.pixel = 0;
+                            cached_output.opaque = displayio_palette_get_color(self->pixel_shader, colorspace, input_pixel.pixel, &cached_output.pixel);
+                            cached_input = input_pixel.pixel;
+                            cached = true;
+                        }
+                        output_pixel = cached_output;
+                    } else if (shader == SHADER_COLORCONVERTER) {
+                        displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
                     }
-                    uint8_t shift = (offset % pixels_per_byte) * colorspace->depth;
-                    if (colorspace->reverse_pixels_in_byte) {
-                        // Reverse the shift by subtracting it from the leftmost shift.
-                        shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+                    last_local_x = local_x;
+                    last_output = output_pixel;
+                }
+                if (!output_pixel.opaque) {
+                    // A pixel is transparent so we haven't fully covered the area ourselves.
+                    overlap_opaque = false;
+                } else {
+                    mask[offset / 32] |= 1 << (offset % 32);
+                    if (colorspace->depth == 16) {
+                        *(((uint16_t*) buffer) + offset) = output_pixel.pixel;
+                    } else if (colorspace->depth == 8) {
+                        *(((uint8_t*) buffer) + offset) = output_pixel.pixel;
+                    } else if (colorspace->depth < 8) {
+                        // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
+                        if (!colorspace->pixels_in_byte_share_row) {
+                            uint16_t width = displayio_area_width(area);
+                            uint16_t row = offset / width;
+                            uint16_t col = offset % width;
+                            // Dividing by pixels_per_byte does truncated division even if we multiply it back out.
+                            offset = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * width + row % pixels_per_byte;
+                            // Also useful for validating that the bitpacking worked correctly.
+                            // if (offset > displayio_area_size(area)) {
+                            //     asm("bkpt");
+                            // }
+                        }
+                        uint8_t shift = (offset % pixels_per_byte) * colorspace->depth;
+                        if (colorspace->reverse_pixels_in_byte) {
+                            // Reverse the shift by subtracting it from the leftmost shift.
+                            shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+                        }
+                        ((uint8_t*)buffer)[offset / pixels_per_byte] |= output_pixel.pixel << shift;
                     }
-                    ((uint8_t*)buffer)[offset / pixels_per_byte] |= output_pixel.pixel << shift;
                 }
             }
         }
     }
-    return full_coverage;
+    if (overlap_opaque && covered != NULL) {
+        displayio_area_add_covered(covered, &overlap);
+    }
+    return full_coverage && overlap_opaque;
 }
 
 void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
@@ -70,14 +70,21 @@ typedef struct {
 
 void displayio_tilegrid_set_hidden_by_parent(displayio_tilegrid_t *self, bool hidden);
 
+// Set count tiles of row y, starting at x, with a single dirty area. The run must not go past
+// the end of the row. set_tiles copies tile_indices and fill_tiles repeats tile_index.
+void displayio_tilegrid_set_tiles(displayio_tilegrid_t *self, uint16_t x, uint16_t y, const uint8_t *tile_indices, uint16_t count);
+void displayio_tilegrid_fill_tiles(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint8_t tile_index, uint16_t count);
+
 // Updating the screen is a three stage process.
 
 // The first stage is used to determine i
 displayio_area_t* displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *self, displayio_area_t* tail);
 
 // Area is always in absolute screen coordinates. Update transform is used to inform TileGrids how
-// they relate to it.
-bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self, const _displayio_colorspace_t* colorspace, const displayio_area_t* area, uint32_t* mask, uint32_t *buffer);
+// they relate to it. Covered, if not NULL, is the part of area that opaque layers above have
+// already drawn. Nothing is drawn if it holds all of our pixels, and it's grown when ours are all
+// opaque.
+bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self, const _displayio_colorspace_t* colorspace, const displayio_area_t* area, uint32_t* mask, uint32_t *buffer, displayio_area_t* covered);
 void displayio_tilegrid_update_transform(displayio_tilegrid_t *group, const displayio_buffer_transform_t* parent_transform);
 
 // Fills in area with the maximum bounds of all related pixels in the last rendered frame. Returns
@@ -54,6 +54,9 @@ void displayio_background(void) {
 
     displayio_background_in_progress = true;
 
+    // Draw the console output gathered since the last time.
+    supervisor_terminal_background();
+
     for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
         if (displays[i].display.base.type == NULL || displays[i].display.base.type == &mp_type_NoneType) {
             // Skip null display.
@@ -329,6 +332,38 @@ bool displayio_area_equal(const displayio_area_t* a, const displayio_area_t* b)
            a->y2 == b->y2;
 }
 
+bool displayio_area_contains(const displayio_area_t* outer, const displayio_area_t* inner) {
+    return outer->x1 <= inner->x1 &&
+           outer->y1 <= inner->y1 &&
+           outer->x2 >= inner->x2 &&
+           outer->y2 >= inner->y2;
+}
+
+// Covered is a rectangle whose pixels are all known to be drawn. This grows it
+// by addition, another such rectangle, when their union is exactly the two of
+// them. Otherwise it keeps whichever of the two is bigger.
+void displayio_area_add_covered(displayio_area_t* covered, const displayio_area_t* addition) {
+    if (displayio_area_contains(covered, addition)) {
+        return;
+    }
+    if (covered->x1 == covered->x2 || displayio_area_contains(addition, covered)) {
+        displayio_area_copy(addition, covered);
+        return;
+    }
+    displayio_area_t u;
+    displayio_area_t overlap;
+    displayio_area_union(covered, addition, &u);
+    uint32_t overlap_size = 0;
+    if (displayio_area_compute_overlap(covered, addition, &overlap)) {
+        overlap_size = displayio_area_size(&overlap);
+    }
+    if (displayio_area_size(&u) == displayio_area_size(covered) + displayio_area_size(addition) - overlap_size) {
+        displayio_area_copy(&u, covered);
+    } else if (displayio_area_size(addition) > displayio_area_size(covered)) {
+        displayio_area_copy(addition, covered);
+    }
+}
+
 // Original and whole must be in the same coordinate space.
 void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpose_xy,
                                      const displayio_area_t* original,
@@ -65,6 +65,8 @@ uint16_t displayio_area_width(const displayio_area_t* area);
 uint16_t displayio_area_height(const displayio_area_t* area);
 uint32_t displayio_area_size(const displayio_area_t* area);
 bool displayio_area_equal(const displayio_area_t* a, const displayio_area_t* b);
+bool displayio_area_contains(const displayio_area_t* outer, const displayio_area_t* inner);
+void displayio_area_add_covered(displayio_area_t* covered, const displayio_area_t* addition);
 void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpose_xy,
                                      const displayio_area_t* original,
                                      const displayio_area_t* whole,
@@ -58,6 +58,10 @@ void displayio_display_core_construct(displayio_display_core_t* self,
     self->rowstart = rowstart;
     self->last_refresh = 0;
 
+    // Only some buses can send in the background.
+    self->send_async = NULL;
+    self->wait_for_send = NULL;
+
     // (framebufferdisplay already validated its 'bus' is a buffer-protocol object)
     if (bus) {
         if (MP_OBJ_IS_TYPE(bus, &displayio_parallelbus_type)) {
@@ -66,6 +70,10 @@ void displayio_display_core_construct(displayio_display_core_t* self,
             self->begin_transaction = common_hal_displayio_parallelbus_begin_transaction;
             self->send = common_hal_displayio_parallelbus_send;
             self->end_transaction = common_hal_displayio_parallelbus_end_transaction;
+            #if CIRCUITPY_DISPLAYIO_PARALLELBUS_DMA
+            self->send_async = common_hal_displayio_parallelbus_send_async;
+            self->wait_for_send = common_hal_displayio_parallelbus_wait_for_send;
+            #endif
         } else if (MP_OBJ_IS_TYPE(bus, &displayio_fourwire_type)) {
             self->bus_reset = common_hal_displayio_fourwire_reset;
             self->bus_free = common_hal_displayio_fourwire_bus_free;
@@ -297,6 +305,8 @@ void displayio_display_core_set_region_to_update(displayio_display_core_t* self,
 
 void displayio_display_core_start_refresh(displayio_display_core_t* self) {
     self->last_refresh = supervisor_ticks_ms64();
+    self->pixels_sent = 0;
+    self->windows_sent = 0;
 }
 
 void displayio_display_core_finish_refresh(displayio_display_core_t* self) {
@@ -349,3 +359,78 @@ bool displayio_display_core_clip_area(displayio_display_core_t *self, const disp
     }
     return true;
 }
+
+// How many more pixels refreshing the union of a and b sends than refreshing
+// each of them. Negative when they overlap.
+STATIC int32_t _merge_penalty(const displayio_area_t* a, const displayio_area_t* b) {
+    displayio_area_t u;
+    displayio_area_union(a, b, &u);
+    return (int32_t) displayio_area_size(&u) - (int32_t) displayio_area_size(a) - (int32_t) displayio_area_size(b);
+}
+
+// Merges the pair of areas that's cheapest to refresh as one, if that adds no
+// more than max_penalty pixels. Returns the new number of areas.
+STATIC uint8_t _merge_cheapest_pair(displayio_area_t* areas, uint8_t count, int32_t max_penalty) {
+    uint8_t best_i = 0;
+    uint8_t best_j = 0;
+    int32_t best_penalty = INT32_MAX;
+    for (uint8_t i = 0; i < count; i++) {
+        for (uint8_t j = i + 1; j < count; j++) {
+            int32_t penalty = _merge_penalty(&areas[i], &areas[j]);
+            if (penalty < best_penalty) {
+                best_i = i;
+                best_j = j;
+                best_penalty = penalty;
+            }
+        }
+    }
+    if (best_penalty > max_penalty) {
+        return count;
+    }
+    displayio_area_expand(&areas[best_i], &areas[best_j]);
+    count--;
+    displayio_area_copy(&areas[count], &areas[best_j]);
+    return count;
+}
+
+// Copies the on-screen parts of the given areas into refresh_areas, merging
+// areas whenever one window costs less to send than two, and returns the new
+// list. Pixels outside the given areas are redrawn from the group tree like
+// any others, so a merged area only costs time.
+const displayio_area_t* displayio_display_core_coalesce_areas(displayio_display_core_t *self, const displayio_area_t* areas) {
+    displayio_area_t* out = self->refresh_areas;
+    uint8_t count = 0;
+    for (const displayio_area_t* area = areas; area != NULL; area = area->next) {
+        displayio_area_t clipped;
+        if (!displayio_area_compute_overlap(&self->area, area, &clipped)) {
+            continue;
+        }
+        if (count == CIRCUITPY_DISPLAY_REFRESH_AREA_LIMIT) {
+            // Out of room so make some, by force if no merge is worth it.
+            uint8_t merged = _merge_cheapest_pair(out, count, CIRCUITPY_DISPLAY_AREA_OVERHEAD_PIXELS);
+            if (merged == count) {
+                merged = _merge_cheapest_pair(out, count, INT32_MAX);
+            }
+            count = merged;
+        }
+        displayio_area_copy(&clipped, &out[count]);
+        count++;
+    }
+
+    // Merge until no merge saves anything.
+    while (count > 1) {
+        uint8_t merged = _merge_cheapest_pair(out, count, CIRCUITPY_DISPLAY_AREA_OVERHEAD_PIXELS);
+        if (merged == count) {
+            break;
+        }
+        count = merged;
+    }
+
+    if (count == 0) {
+        return NULL;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        out[i].next = i + 1 < count ? &out[i + 1] : NULL;
+    }
+    return out;
+}
@@ -34,6 +34,10 @@
 
 #define NO_COMMAND 0x100
 
+#if CIRCUITPY_DISPLAY_REFRESH_AREA_LIMIT < 2
+#error "CIRCUITPY_DISPLAY_REFRESH_AREA_LIMIT must be at least 2"
+#endif
+
 typedef struct {
     mp_obj_t bus;
     displayio_group_t *current_group;
@@ -43,6 +47,9 @@ typedef struct {
     display_bus_begin_transaction begin_transaction;
     display_bus_send send;
     display_bus_end_transaction end_transaction;
+    // NULL unless the bus can send pixel data in the background.
+    display_bus_send_async send_async;
+    display_bus_wait_for_send wait_for_send;
     displayio_buffer_transform_t transform;
     displayio_area_t area;
     uint16_t width;
@@ -54,6 +61,11 @@ typedef struct {
     int16_t colstart;
     int16_t rowstart;
     bool full_refresh; // New group means we need to refresh the whole display.
+    // Dirty areas after coalescing, linked together by next.
+    displayio_area_t refresh_areas[CIRCUITPY_DISPLAY_REFRESH_AREA_LIMIT];
+    // Counts for the most recent refresh.
+    uint32_t pixels_sent;
+    uint16_t windows_sent;
 } displayio_display_core_t;
 
 void displayio_display_core_construct(displayio_display_core_t* self,
@@ -87,4 +99,6 @@ bool displayio_display_core_fill_area(displayio_display_core_t *self, displayio_
 
 bool displayio_display_core_clip_area(displayio_display_core_t *self, const displayio_area_t* area, displayio_area_t* clipped);
 
+const displayio_area_t* displayio_display_core_coalesce_areas(displayio_display_core_t *self, const displayio_area_t* areas);
+
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_DISPLAY_CORE_H
@@ -38,8 +38,9 @@ typedef struct {
     const displayio_bitmap_t* bitmap;
     uint8_t width;
     uint8_t height;
-    const byte* unicode_characters;
-    uint16_t unicode_characters_len;
+    // Codepoints of the glyphs that follow visible ASCII, in ascending order.
+    const uint16_t* unicode_codepoints;
+    uint16_t unicode_codepoint_count;
 } fontio_builtinfont_t;
 
 uint8_t fontio_builtinfont_get_glyph_index(const fontio_builtinfont_t *self, mp_uint_t codepoint);
@@ -0,0 +1,193 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/fontio/PackedFont.h"
+
+#include <string.h>
+
+#include "py/mperrno.h"
+#include "py/objnamedtuple.h"
+#include "py/runtime.h"
+#include "shared-bindings/displayio/Bitmap.h"
+#include "shared-bindings/fontio/Glyph.h"
+#include "supervisor/shared/translate.h"
+
+// The layout written by tools/gen_packed_font.py. Everything is little endian.
+#define HEADER_SIZE (16)
+#define GLYPH_SIZE (16)
+
+static uint32_t read_u32(const uint8_t* buf) {
+    return buf[0] | buf[1] << 8 | buf[2] << 16 | (uint32_t) buf[3] << 24;
+}
+
+static void invalid_font(void) {
+    mp_raise_ValueError(translate("Invalid font file"));
+}
+
+static void read_font(fontio_packedfont_t *self, uint32_t offset, uint8_t* buf, size_t len) {
+    if (self->file == NULL) {
+        // Fetch the buffer every time in case it has been resized.
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(self->source, &bufinfo, MP_BUFFER_READ);
+        if (offset > bufinfo.len || len > bufinfo.len - offset) {
+            invalid_font();
+        }
+        memcpy(buf, (const uint8_t*) bufinfo.buf + offset, len);
+        return;
+    }
+    UINT bytes_read;
+    if (f_lseek(&self->file->fp, offset) != FR_OK ||
+        f_read(&self->file->fp, buf, len, &bytes_read) != FR_OK) {
+        mp_raise_OSError(MP_EIO);
+    }
+    if (bytes_read != len) {
+        invalid_font();
+    }
+}
+
+void common_hal_fontio_packedfont_construct(fontio_packedfont_t *self, pyb_file_obj_t* file,
+    mp_obj_t source, uint16_t cache_size) {
+    self->file = file;
+    self->source = source;
+
+    uint8_t header[HEADER_SIZE];
+    read_font(self, 0, header, HEADER_SIZE);
+    if (memcmp(header, "CPF\x01", 4) != 0) {
+        invalid_font();
+    }
+    self->glyph_count = read_u32(header + 4);
+    self->width = header[8];
+    self->height = header[9];
+    self->dx = (int8_t) header[10];
+    self->dy = (int8_t) header[11];
+    self->bitmap_offset = read_u32(header + 12);
+    if (self->bitmap_offset < HEADER_SIZE + (uint64_t) self->glyph_count * GLYPH_SIZE) {
+        invalid_font();
+    }
+
+    self->use_count = 0;
+    self->cache_size = cache_size;
+    self->cache = m_new(fontio_packedfont_cache_entry_t, cache_size);
+    for (uint16_t i = 0; i < cache_size; i++) {
+        self->cache[i].glyph = MP_OBJ_NULL;
+    }
+}
+
+mp_obj_t common_hal_fontio_packedfont_get_bounding_box(const fontio_packedfont_t *self) {
+    mp_obj_t items[] = {
+        MP_OBJ_NEW_SMALL_INT(self->width),
+        MP_OBJ_NEW_SMALL_INT(self->height),
+        MP_OBJ_NEW_SMALL_INT(self->dx),
+        MP_OBJ_NEW_SMALL_INT(self->dy),
+    };
+    return mp_obj_new_tuple(4, items);
+}
+
+// Binary search the glyph index for codepoint. Returns false if it isn't there.
+static bool find_glyph(fontio_packedfont_t *self, mp_uint_t codepoint, uint8_t* entry) {
+    size_t lo = 0;
+    size_t hi = self->glyph_count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        read_font(self, HEADER_SIZE + mid * GLYPH_SIZE, entry, GLYPH_SIZE);
+        mp_uint_t potential_c = read_u32(entry);
+        if (codepoint == potential_c) {
+            return true;
+        } else if (codepoint < potential_c) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return false;
+}
+
+// Turn the index entry of a glyph into a fontio.Glyph with its own Bitmap.
+static mp_obj_t load_glyph(fontio_packedfont_t *self, const uint8_t* entry) {
+    uint32_t offset = read_u32(entry + 4);
+    uint8_t width = entry[8];
+    uint8_t height = entry[9];
+    size_t row_bytes = (width + 7) / 8;
+    size_t len = row_bytes * height;
+
+    displayio_bitmap_t *bitmap = m_new_obj(displayio_bitmap_t);
+    bitmap->base.type = &displayio_bitmap_type;
+    common_hal_displayio_bitmap_construct(bitmap, width > 0 ? width : 1, height > 0 ? height : 1, 1);
+    if (len == 0) {
+        common_hal_displayio_bitmap_set_pixel(bitmap, 0, 0, 0);
+    } else {
+        uint8_t* rows = m_new(uint8_t, len);
+        read_font(self, self->bitmap_offset + offset, rows, len);
+        for (uint8_t y = 0; y < height; y++) {
+            const uint8_t* row = rows + y * row_bytes;
+            for (uint8_t x = 0; x < width; x++) {
+                common_hal_displayio_bitmap_set_pixel(bitmap, x, y, (row[x / 8] >> (7 - x % 8)) & 1);
+            }
+        }
+        m_del(uint8_t, rows, len);
+    }
+
+    mp_obj_t field_values[8] = {
+        MP_OBJ_FROM_PTR(bitmap),
+        MP_OBJ_NEW_SMALL_INT(0),
+        MP_OBJ_NEW_SMALL_INT(width),
+        MP_OBJ_NEW_SMALL_INT(height),
+        MP_OBJ_NEW_SMALL_INT((int8_t) entry[10]),
+        MP_OBJ_NEW_SMALL_INT((int8_t) entry[11]),
+        MP_OBJ_NEW_SMALL_INT((int8_t) entry[12]),
+        MP_OBJ_NEW_SMALL_INT((int8_t) entry[13])
+    };
+    return namedtuple_make_new((const mp_obj_type_t*) &fontio_glyph_type, 8, field_values, NULL);
+}
+
+mp_obj_t common_hal_fontio_packedfont_get_glyph(fontio_packedfont_t *self, mp_uint_t codepoint) {
+    // Use the cached glyph if there is one, otherwise note the least recently used entry.
+    fontio_packedfont_cache_entry_t* victim = &self->cache[0];
+    for (uint16_t i = 0; i < self->cache_size; i++) {
+        fontio_packedfont_cache_entry_t* e = &self->cache[i];
+        if (e->glyph == MP_OBJ_NULL) {
+            victim = e;
+            continue;
+        }
+        if (e->codepoint == codepoint) {
+            e->last_used = ++self->use_count;
+            return e->glyph;
+        }
+        if (victim->glyph != MP_OBJ_NULL && e->last_used < victim->last_used) {
+            victim = e;
+        }
+    }
+
+    uint8_t entry[GLYPH_SIZE];
+    if (!find_glyph(self, codepoint, entry)) {
+        return mp_const_none;
+    }
+    // The old glyph stays valid for anything still using it; it's just forgotten here.
+    victim->glyph = load_glyph(self, entry);
+    victim->codepoint = codepoint;
+    victim->last_used = ++self->use_count;
+    return victim->glyph;
+}
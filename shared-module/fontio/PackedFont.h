@@ -0,0 +1,59 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_FONTIO_PACKEDFONT_H
+#define MICROPY_INCLUDED_SHARED_MODULE_FONTIO_PACKEDFONT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "py/obj.h"
+#include "extmod/vfs_fat.h"
+
+// A glyph that has been turned into a Bitmap, and when it was last used.
+typedef struct {
+    mp_obj_t glyph; // MP_OBJ_NULL when the entry is empty
+    uint32_t codepoint;
+    uint32_t last_used;
+} fontio_packedfont_cache_entry_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    // The font is read from file, or from the buffer of source if file is NULL.
+    pyb_file_obj_t* file;
+    mp_obj_t source;
+    uint32_t glyph_count;
+    uint32_t bitmap_offset;
+    uint8_t width;
+    uint8_t height;
+    int8_t dx;
+    int8_t dy;
+    uint32_t use_count;
+    uint16_t cache_size;
+    fontio_packedfont_cache_entry_t* cache;
+} fontio_packedfont_t;
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_FONTIO_PACKEDFONT_H
@@ -138,7 +138,9 @@ STATIC const displayio_area_t* _get_refresh_areas(framebufferio_framebufferdispl
     return NULL;
 }
 
-STATIC bool _refresh_area(framebufferio_framebufferdisplay_obj_t* self, const displayio_area_t* area) {
+// Draws the area into the framebuffer and sets the bits in dirty_row_bitmask for the rows that
+// it covers.
+STATIC bool _refresh_area(framebufferio_framebufferdisplay_obj_t* self, const displayio_area_t* area, uint8_t *dirty_row_bitmask) {
     uint16_t buffer_size = 128; // In uint32_ts
 
     displayio_area_t clipped;
@@ -206,6 +208,7 @@ STATIC bool _refresh_area(framebufferio_framebufferdisplay_obj_t* self, const di
             memcpy(dest, src, rowsize);
             dest += rowstride;
             src += rowsize;
+            dirty_row_bitmask[i / 8] |= 1 << (i & 7);
         }
 
         // TODO(tannewt): Make refresh displays faster so we don't starve other
@@ -218,13 +221,23 @@ STATIC bool _refresh_area(framebufferio_framebufferdisplay_obj_t* self, const di
 STATIC void _refresh_display(framebufferio_framebufferdisplay_obj_t* self) {
     displayio_display_core_start_refresh(&self->core);
     self->framebuffer_protocol->get_bufinfo(self->framebuffer, &self->bufinfo);
+    // Sized to cover the framebuffer's rows whichever way the display is rotated.
+    uint8_t dirty_row_bitmask[(MAX(self->core.width, self->core.height) + 7) / 8];
+    memset(dirty_row_bitmask, 0, sizeof(dirty_row_bitmask));
     const displayio_area_t* current_area = _get_refresh_areas(self);
+    bool dirty = false;
     while (current_area != NULL) {
-        _refresh_area(self, current_area);
+        _refresh_area(self, current_area, dirty_row_bitmask);
         current_area = current_area->next;
     }
+    for (size_t i = 0; i < sizeof(dirty_row_bitmask); i++) {
+        dirty = dirty || dirty_row_bitmask[i] != 0;
+    }
     displayio_display_core_finish_refresh(&self->core);
-    self->framebuffer_protocol->swapbuffers(self->framebuffer);
+    // Nothing to show when no area needed drawing, which is every frame of a still display.
+    if (dirty && self->framebuffer_protocol->swapbuffers != NULL) {
+        self->framebuffer_protocol->swapbuffers(self->framebuffer, dirty_row_bitmask);
+    }
 }
 
 void common_hal_framebufferio_framebufferdisplay_set_rotation(framebufferio_framebufferdisplay_obj_t* self, int rotation){
@@ -61,7 +61,10 @@ void framebufferio_framebufferdisplay_collect_ptrs(framebufferio_framebufferdisp
 mp_obj_t common_hal_framebufferio_framebufferdisplay_get_framebuffer(framebufferio_framebufferdisplay_obj_t* self);
 
 typedef void (*framebuffer_get_bufinfo_fun)(mp_obj_t, mp_buffer_info_t *bufinfo);
-typedef void (*framebuffer_swapbuffers_fun)(mp_obj_t);
+// dirty_row_bitmask has a bit set for each framebuffer row written since the
+// last swap, lowest bit first. It is only called when at least one row was,
+// and may be left out by framebuffers that are shown as they are written.
+typedef void (*framebuffer_swapbuffers_fun)(mp_obj_t, uint8_t *dirty_row_bitmask);
 typedef void (*framebuffer_deinit_fun)(mp_obj_t);
 typedef bool (*framebuffer_set_brightness_fun)(mp_obj_t, mp_float_t);
 typedef mp_float_t (*framebuffer_get_brightness_fun)(mp_obj_t);
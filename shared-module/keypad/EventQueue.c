@@ -0,0 +1,106 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/runtime.h"
+#include "shared-bindings/keypad/Event.h"
+#include "shared-bindings/keypad/EventQueue.h"
+#include "shared-module/keypad/EventQueue.h"
+
+#define RECORD_SIZE (sizeof(keypad_eventqueue_record_t))
+
+void common_hal_keypad_eventqueue_construct(keypad_eventqueue_obj_t *self, size_t max_events) {
+    // The queue is long-lived because its scanner usually lives as long as the program.
+    if (!ringbuf_alloc(&self->encoded_events, max_events * RECORD_SIZE, true)) {
+        m_malloc_fail(max_events * RECORD_SIZE);
+    }
+    self->overflowed = false;
+}
+
+size_t common_hal_keypad_eventqueue_get_length(keypad_eventqueue_obj_t *self) {
+    return ringbuf_num_filled(&self->encoded_events) / RECORD_SIZE;
+}
+
+bool common_hal_keypad_eventqueue_get_into(keypad_eventqueue_obj_t *self, keypad_event_obj_t *event) {
+    keypad_eventqueue_record_t record;
+    if (ringbuf_get_n(&self->encoded_events, (uint8_t *)&record, RECORD_SIZE) != RECORD_SIZE) {
+        return false;
+    }
+    common_hal_keypad_event_construct(event, record.key_number, record.pressed, record.timestamp);
+    return true;
+}
+
+mp_obj_t common_hal_keypad_eventqueue_get(keypad_eventqueue_obj_t *self) {
+    keypad_event_obj_t *event = m_new_obj(keypad_event_obj_t);
+    event->base.type = &keypad_event_type;
+    if (common_hal_keypad_eventqueue_get_into(self, event)) {
+        return MP_OBJ_FROM_PTR(event);
+    }
+    m_del_obj(keypad_event_obj_t, event);
+    return mp_const_none;
+}
+
+mp_obj_t common_hal_keypad_eventqueue_get_all(keypad_eventqueue_obj_t *self) {
+    // Take a snapshot of the count so that events arriving while the tuple is
+    // built are left for the next call.
+    size_t len = common_hal_keypad_eventqueue_get_length(self);
+    mp_obj_tuple_t *events = MP_OBJ_TO_PTR(mp_obj_new_tuple(len, NULL));
+    for (size_t i = 0; i < len; i++) {
+        keypad_event_obj_t *event = m_new_obj(keypad_event_obj_t);
+        event->base.type = &keypad_event_type;
+        common_hal_keypad_eventqueue_get_into(self, event);
+        events->items[i] = MP_OBJ_FROM_PTR(event);
+    }
+    return MP_OBJ_FROM_PTR(events);
+}
+
+void common_hal_keypad_eventqueue_clear(keypad_eventqueue_obj_t *self) {
+    ringbuf_clear(&self->encoded_events);
+    self->overflowed = false;
+}
+
+bool common_hal_keypad_eventqueue_get_overflowed(keypad_eventqueue_obj_t *self) {
+    return self->overflowed;
+}
+
+void common_hal_keypad_eventqueue_set_overflowed(keypad_eventqueue_obj_t *self, bool overflowed) {
+    self->overflowed = overflowed;
+}
+
+// Called by the scanners, from the tick interrupt. A record is either stored
+// whole or dropped, so the consumer never sees a torn event.
+bool keypad_eventqueue_record(keypad_eventqueue_obj_t *self, mp_uint_t key_number, bool pressed, uint32_t timestamp) {
+    if (ringbuf_num_empty(&self->encoded_events) < RECORD_SIZE) {
+        self->overflowed = true;
+        return false;
+    }
+    keypad_eventqueue_record_t record = {
+        .key_number = key_number,
+        .pressed = pressed,
+        .timestamp = timestamp,
+    };
+    ringbuf_put_n(&self->encoded_events, (uint8_t *)&record, RECORD_SIZE);
+    return true;
+}
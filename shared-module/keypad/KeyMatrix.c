@@ -0,0 +1,125 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/runtime.h"
+#include "shared-bindings/digitalio/DigitalInOut.h"
+#include "shared-bindings/keypad/KeyMatrix.h"
+#include "shared-bindings/microcontroller/__init__.h"
+#include "shared-bindings/keypad/__init__.h"
+#include "shared-module/keypad/__init__.h"
+
+STATIC mp_uint_t row_column_to_key_number(keypad_keymatrix_obj_t *self, mp_uint_t row, mp_uint_t column) {
+    return row * self->column_digitalinouts->len + column;
+}
+
+// Drive one row at a time to the active level and read every column. Idle
+// rows are left as pulled inputs so a pressed key in another row can't fight
+// the selected one.
+STATIC void keymatrix_scan(keypad_scanner_obj_t *self_in, uint32_t timestamp) {
+    keypad_keymatrix_obj_t *self = (keypad_keymatrix_obj_t *)self_in;
+    // With the diode anodes on the columns, the columns are pulled up and a
+    // selected row is driven low, so a pressed key reads low.
+    bool active = !self->columns_to_anodes;
+    digitalio_pull_t pull = self->columns_to_anodes ? PULL_UP : PULL_DOWN;
+
+    for (size_t row = 0; row < self->row_digitalinouts->len; row++) {
+        digitalio_digitalinout_obj_t *row_dio = MP_OBJ_TO_PTR(self->row_digitalinouts->items[row]);
+        common_hal_digitalio_digitalinout_switch_to_output(row_dio, active, DRIVE_MODE_PUSH_PULL);
+        // Give the column lines a moment to settle through the pulls.
+        common_hal_mcu_delay_us(1);
+
+        for (size_t column = 0; column < self->column_digitalinouts->len; column++) {
+            digitalio_digitalinout_obj_t *column_dio = MP_OBJ_TO_PTR(self->column_digitalinouts->items[column]);
+            bool pressed = common_hal_digitalio_digitalinout_get_value(column_dio) == active;
+            keypad_scanner_update(self_in, row_column_to_key_number(self, row, column), pressed, timestamp);
+        }
+
+        common_hal_digitalio_digitalinout_switch_to_input(row_dio, pull);
+    }
+}
+
+void common_hal_keypad_keymatrix_construct(keypad_keymatrix_obj_t *self, mp_uint_t num_row_pins, mcu_pin_obj_t *row_pins[], mp_uint_t num_column_pins, mcu_pin_obj_t *column_pins[], bool columns_to_anodes, mp_float_t interval, size_t max_events) {
+    digitalio_pull_t pull = columns_to_anodes ? PULL_UP : PULL_DOWN;
+
+    mp_obj_t row_dios[num_row_pins];
+    for (size_t row = 0; row < num_row_pins; row++) {
+        digitalio_digitalinout_obj_t *dio = m_new_obj(digitalio_digitalinout_obj_t);
+        dio->base.type = &digitalio_digitalinout_type;
+        common_hal_digitalio_digitalinout_construct(dio, row_pins[row]);
+        common_hal_digitalio_digitalinout_switch_to_input(dio, pull);
+        row_dios[row] = dio;
+    }
+    self->row_digitalinouts = MP_OBJ_TO_PTR(mp_obj_new_tuple(num_row_pins, row_dios));
+
+    mp_obj_t column_dios[num_column_pins];
+    for (size_t column = 0; column < num_column_pins; column++) {
+        digitalio_digitalinout_obj_t *dio = m_new_obj(digitalio_digitalinout_obj_t);
+        dio->base.type = &digitalio_digitalinout_type;
+        common_hal_digitalio_digitalinout_construct(dio, column_pins[column]);
+        common_hal_digitalio_digitalinout_switch_to_input(dio, pull);
+        column_dios[column] = dio;
+    }
+    self->column_digitalinouts = MP_OBJ_TO_PTR(mp_obj_new_tuple(num_column_pins, column_dios));
+
+    self->columns_to_anodes = columns_to_anodes;
+    keypad_construct_common((keypad_scanner_obj_t *)self, keymatrix_scan, num_row_pins * num_column_pins, interval, max_events);
+    keypad_register_scanner((keypad_scanner_obj_t *)self);
+}
+
+void common_hal_keypad_keymatrix_deinit(keypad_keymatrix_obj_t *self) {
+    if (common_hal_keypad_generic_deinited(self)) {
+        return;
+    }
+    keypad_deregister_scanner((keypad_scanner_obj_t *)self);
+    self->pressed = NULL;
+
+    for (size_t row = 0; row < self->row_digitalinouts->len; row++) {
+        common_hal_digitalio_digitalinout_deinit(MP_OBJ_TO_PTR(self->row_digitalinouts->items[row]));
+    }
+    self->row_digitalinouts = NULL;
+    for (size_t column = 0; column < self->column_digitalinouts->len; column++) {
+        common_hal_digitalio_digitalinout_deinit(MP_OBJ_TO_PTR(self->column_digitalinouts->items[column]));
+    }
+    self->column_digitalinouts = NULL;
+}
+
+size_t common_hal_keypad_keymatrix_get_row_count(keypad_keymatrix_obj_t *self) {
+    return self->row_digitalinouts->len;
+}
+
+size_t common_hal_keypad_keymatrix_get_column_count(keypad_keymatrix_obj_t *self) {
+    return self->column_digitalinouts->len;
+}
+
+mp_uint_t common_hal_keypad_keymatrix_row_column_to_key_number(keypad_keymatrix_obj_t *self, mp_uint_t row, mp_uint_t column) {
+    return row_column_to_key_number(self, row, column);
+}
+
+void common_hal_keypad_keymatrix_key_number_to_row_column(keypad_keymatrix_obj_t *self, mp_uint_t key_number, mp_uint_t *row, mp_uint_t *column) {
+    const size_t num_columns = self->column_digitalinouts->len;
+    *row = key_number / num_columns;
+    *column = key_number % num_columns;
+}
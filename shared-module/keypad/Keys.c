@@ -0,0 +1,76 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/runtime.h"
+#include "shared-bindings/digitalio/DigitalInOut.h"
+#include "shared-bindings/keypad/Keys.h"
+#include "shared-bindings/keypad/__init__.h"
+#include "shared-module/keypad/__init__.h"
+
+STATIC void keys_scan(keypad_scanner_obj_t *self_in, uint32_t timestamp) {
+    keypad_keys_obj_t *self = (keypad_keys_obj_t *)self_in;
+    for (size_t key_number = 0; key_number < self->key_count; key_number++) {
+        digitalio_digitalinout_obj_t *dio = MP_OBJ_TO_PTR(self->digitalinouts->items[key_number]);
+        bool pressed = common_hal_digitalio_digitalinout_get_value(dio) == self->value_when_pressed;
+        keypad_scanner_update(self_in, key_number, pressed, timestamp);
+    }
+}
+
+void common_hal_keypad_keys_construct(keypad_keys_obj_t *self, mp_uint_t num_pins, mcu_pin_obj_t *pins[], bool value_when_pressed, bool pull, mp_float_t interval, size_t max_events) {
+    mp_obj_t dios[num_pins];
+
+    for (size_t i = 0; i < num_pins; i++) {
+        digitalio_digitalinout_obj_t *dio = m_new_obj(digitalio_digitalinout_obj_t);
+        dio->base.type = &digitalio_digitalinout_type;
+        common_hal_digitalio_digitalinout_construct(dio, pins[i]);
+        // Pull towards the released level unless the board has its own
+        // resistors.
+        digitalio_pull_t dpull = PULL_NONE;
+        if (pull) {
+            dpull = value_when_pressed ? PULL_DOWN : PULL_UP;
+        }
+        common_hal_digitalio_digitalinout_switch_to_input(dio, dpull);
+        dios[i] = dio;
+    }
+
+    self->digitalinouts = MP_OBJ_TO_PTR(mp_obj_new_tuple(num_pins, dios));
+    self->value_when_pressed = value_when_pressed;
+    keypad_construct_common((keypad_scanner_obj_t *)self, keys_scan, num_pins, interval, max_events);
+    keypad_register_scanner((keypad_scanner_obj_t *)self);
+}
+
+void common_hal_keypad_keys_deinit(keypad_keys_obj_t *self) {
+    if (common_hal_keypad_generic_deinited(self)) {
+        return;
+    }
+    keypad_deregister_scanner((keypad_scanner_obj_t *)self);
+    self->pressed = NULL;
+
+    for (size_t i = 0; i < self->digitalinouts->len; i++) {
+        common_hal_digitalio_digitalinout_deinit(MP_OBJ_TO_PTR(self->digitalinouts->items[i]));
+    }
+    self->digitalinouts = NULL;
+}
@@ -0,0 +1,85 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/runtime.h"
+#include "shared-bindings/digitalio/DigitalInOut.h"
+#include "shared-bindings/keypad/ShiftRegisterKeys.h"
+#include "shared-bindings/keypad/__init__.h"
+#include "shared-module/keypad/__init__.h"
+
+STATIC void shiftregisterkeys_scan(keypad_scanner_obj_t *self_in, uint32_t timestamp) {
+    keypad_shiftregisterkeys_obj_t *self = (keypad_shiftregisterkeys_obj_t *)self_in;
+
+    // Freeze the parallel inputs, then clock them out one at a time. The
+    // first bit is on the data pin before the first clock.
+    common_hal_digitalio_digitalinout_set_value(self->latch, self->value_to_latch);
+    for (size_t key_number = 0; key_number < self->key_count; key_number++) {
+        common_hal_digitalio_digitalinout_set_value(self->clock, false);
+        bool pressed = common_hal_digitalio_digitalinout_get_value(self->data) == self->value_when_pressed;
+        keypad_scanner_update(self_in, key_number, pressed, timestamp);
+        common_hal_digitalio_digitalinout_set_value(self->clock, true);
+    }
+    // Let the register follow its inputs again until the next scan.
+    common_hal_digitalio_digitalinout_set_value(self->latch, !self->value_to_latch);
+}
+
+STATIC digitalio_digitalinout_obj_t *new_digitalinout(const mcu_pin_obj_t *pin) {
+    digitalio_digitalinout_obj_t *dio = m_new_obj(digitalio_digitalinout_obj_t);
+    dio->base.type = &digitalio_digitalinout_type;
+    common_hal_digitalio_digitalinout_construct(dio, pin);
+    return dio;
+}
+
+void common_hal_keypad_shiftregisterkeys_construct(keypad_shiftregisterkeys_obj_t *self, const mcu_pin_obj_t *clock_pin, const mcu_pin_obj_t *data_pin, const mcu_pin_obj_t *latch_pin, bool value_to_latch, size_t key_count, bool value_when_pressed, mp_float_t interval, size_t max_events) {
+    self->clock = new_digitalinout(clock_pin);
+    common_hal_digitalio_digitalinout_switch_to_output(self->clock, false, DRIVE_MODE_PUSH_PULL);
+
+    self->data = new_digitalinout(data_pin);
+    common_hal_digitalio_digitalinout_switch_to_input(self->data, PULL_NONE);
+
+    self->latch = new_digitalinout(latch_pin);
+    common_hal_digitalio_digitalinout_switch_to_output(self->latch, !value_to_latch, DRIVE_MODE_PUSH_PULL);
+
+    self->value_to_latch = value_to_latch;
+    self->value_when_pressed = value_when_pressed;
+    keypad_construct_common((keypad_scanner_obj_t *)self, shiftregisterkeys_scan, key_count, interval, max_events);
+    keypad_register_scanner((keypad_scanner_obj_t *)self);
+}
+
+void common_hal_keypad_shiftregisterkeys_deinit(keypad_shiftregisterkeys_obj_t *self) {
+    if (common_hal_keypad_generic_deinited(self)) {
+        return;
+    }
+    keypad_deregister_scanner((keypad_scanner_obj_t *)self);
+    self->pressed = NULL;
+
+    common_hal_digitalio_digitalinout_deinit(self->clock);
+    self->clock = NULL;
+    common_hal_digitalio_digitalinout_deinit(self->data);
+    self->data = NULL;
+    common_hal_digitalio_digitalinout_deinit(self->latch);
+    self->latch = NULL;
+}
@@ -0,0 +1,141 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/gc.h"
+#include "py/mpstate.h"
+#include "py/runtime.h"
+#include "shared-bindings/keypad/__init__.h"
+#include "shared-bindings/keypad/EventQueue.h"
+#include "shared-bindings/microcontroller/__init__.h"
+#include "shared-module/keypad/__init__.h"
+#include "supervisor/port.h"
+#include "supervisor/shared/tick.h"
+
+// Called from supervisor_tick(), usually in interrupt context. Each scanner
+// samples its keys every interval_ticks, and the interval doubles as the
+// debounce time: a bouncing contact settles long before the next sample.
+void keypad_tick(void) {
+    keypad_scanner_obj_t *scanner = MP_STATE_VM(keypad_scanners_list);
+    if (scanner == NULL) {
+        return;
+    }
+    uint64_t now = port_get_raw_ticks(NULL);
+    uint32_t timestamp = (uint32_t)(now * 1000 / 1024);
+    for (; scanner != NULL; scanner = scanner->next) {
+        if (now < scanner->next_scan_ticks) {
+            continue;
+        }
+        scanner->next_scan_ticks = now + scanner->interval_ticks;
+        scanner->scan(scanner, timestamp);
+    }
+}
+
+void keypad_reset(void) {
+    if (MP_STATE_VM(keypad_scanners_list) != NULL) {
+        supervisor_disable_tick();
+    }
+    MP_STATE_VM(keypad_scanners_list) = NULL;
+}
+
+void keypad_construct_common(keypad_scanner_obj_t *self, keypad_scan_func_t scan, size_t key_count, mp_float_t interval, size_t max_events) {
+    self->scan = scan;
+    self->key_count = key_count;
+    self->pressed = m_new0(bool, key_count);
+    // Raw ticks are 1/1024 second.
+    self->interval_ticks = (uint32_t)(interval * 1024);
+    if (self->interval_ticks == 0) {
+        self->interval_ticks = 1;
+    }
+    self->next_scan_ticks = 0;
+
+    keypad_eventqueue_obj_t *events = m_new_obj(keypad_eventqueue_obj_t);
+    events->base.type = &keypad_eventqueue_type;
+    common_hal_keypad_eventqueue_construct(events, max_events);
+    self->events = events;
+}
+
+// The list is walked from the tick interrupt, so only change it with
+// interrupts off.
+void keypad_register_scanner(keypad_scanner_obj_t *self) {
+    common_hal_mcu_disable_interrupts();
+    bool was_empty = MP_STATE_VM(keypad_scanners_list) == NULL;
+    self->next = MP_STATE_VM(keypad_scanners_list);
+    MP_STATE_VM(keypad_scanners_list) = self;
+    common_hal_mcu_enable_interrupts();
+    if (was_empty) {
+        supervisor_enable_tick();
+    }
+}
+
+void keypad_deregister_scanner(keypad_scanner_obj_t *self) {
+    common_hal_mcu_disable_interrupts();
+    keypad_scanner_obj_t **link = (keypad_scanner_obj_t **)&MP_STATE_VM(keypad_scanners_list);
+    while (*link != NULL && *link != self) {
+        link = &(*link)->next;
+    }
+    bool found = *link != NULL;
+    if (found) {
+        *link = self->next;
+    }
+    bool now_empty = MP_STATE_VM(keypad_scanners_list) == NULL;
+    common_hal_mcu_enable_interrupts();
+    self->next = NULL;
+    if (found && now_empty) {
+        supervisor_disable_tick();
+    }
+}
+
+void keypad_scanner_update(keypad_scanner_obj_t *self, size_t key_number, bool pressed, uint32_t timestamp) {
+    if (self->pressed[key_number] == pressed) {
+        return;
+    }
+    self->pressed[key_number] = pressed;
+    keypad_eventqueue_record(self->events, key_number, pressed, timestamp);
+}
+
+void common_hal_keypad_generic_reset(void *self_in) {
+    keypad_scanner_obj_t *self = self_in;
+    // Forget the key states so keys held now are reported as new presses.
+    memset(self->pressed, 0, self->key_count);
+    self->next_scan_ticks = 0;
+}
+
+size_t common_hal_keypad_generic_get_key_count(void *self_in) {
+    keypad_scanner_obj_t *self = self_in;
+    return self->key_count;
+}
+
+mp_obj_t common_hal_keypad_generic_get_events(void *self_in) {
+    keypad_scanner_obj_t *self = self_in;
+    return MP_OBJ_FROM_PTR(self->events);
+}
+
+bool common_hal_keypad_generic_deinited(void *self_in) {
+    keypad_scanner_obj_t *self = self_in;
+    return self->pressed == NULL;
+}
@@ -0,0 +1,64 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_KEYPAD_H
+#define MICROPY_INCLUDED_SHARED_MODULE_KEYPAD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "py/obj.h"
+#include "shared-module/keypad/EventQueue.h"
+
+struct _keypad_scanner_obj_t;
+
+typedef void (*keypad_scan_func_t)(struct _keypad_scanner_obj_t *self, uint32_t timestamp);
+
+// Every scanner type starts with these fields so that keypad_tick() and the
+// generic methods can treat them alike. pressed is NULL once deinited.
+#define KEYPAD_SCANNER_COMMON_FIELDS \
+    mp_obj_base_t base; \
+    struct _keypad_scanner_obj_t *next; \
+    keypad_scan_func_t scan; \
+    keypad_eventqueue_obj_t *events; \
+    uint64_t next_scan_ticks; \
+    uint32_t interval_ticks; \
+    size_t key_count; \
+    bool *pressed
+
+typedef struct _keypad_scanner_obj_t {
+    KEYPAD_SCANNER_COMMON_FIELDS;
+} keypad_scanner_obj_t;
+
+void keypad_tick(void);
+void keypad_reset(void);
+
+void keypad_construct_common(keypad_scanner_obj_t *self, keypad_scan_func_t scan, size_t key_count, mp_float_t interval, size_t max_events);
+void keypad_register_scanner(keypad_scanner_obj_t *self);
+void keypad_deregister_scanner(keypad_scanner_obj_t *self);
+void keypad_scanner_update(keypad_scanner_obj_t *self, size_t key_number, bool pressed, uint32_t timestamp);
+
+#endif  // MICROPY_INCLUDED_SHARED_MODULE_KEYPAD_H
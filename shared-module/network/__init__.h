@@ -78,6 +78,7 @@ typedef struct _mod_network_socket_obj_t {
         } u_param;
         mp_uint_t u_state;
     };
+    mp_uint_t timeout; // ms, -1 for blocking; applied when the NIC is selected
 } mod_network_socket_obj_t;
 
 extern const mod_network_nic_type_t mod_network_nic_type_wiznet5k;
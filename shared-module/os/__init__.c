@@ -105,20 +105,36 @@ mp_obj_t common_hal_os_getcwd(void) {
     return mp_vfs_getcwd();
 }
 
+// Fill in an iterator over the mount points in the root directory.
+STATIC mp_obj_t os_ilistdir_root(mp_vfs_ilistdir_it_t *iter) {
+    iter->base.type = &mp_type_polymorph_iter;
+    iter->iternext = mp_vfs_ilistdir_it_iternext;
+    iter->cur.vfs = MP_STATE_VM(vfs_mount_table);
+    iter->is_str = true;
+    iter->is_iter = false;
+    return MP_OBJ_FROM_PTR(iter);
+}
+
+mp_obj_t common_hal_os_ilistdir(const char* path) {
+    mp_obj_t path_out;
+    mp_vfs_mount_t *vfs = lookup_dir_path(path, &path_out);
+    if (vfs == MP_VFS_ROOT) {
+        return os_ilistdir_root(m_new_obj(mp_vfs_ilistdir_it_t));
+    }
+    // The filesystem reads entries one at a time as the iterator advances.
+    return mp_vfs_proxy_call(vfs, MP_QSTR_ilistdir, 1, &path_out);
+}
+
 mp_obj_t common_hal_os_listdir(const char* path) {
     mp_obj_t path_out;
     mp_vfs_mount_t *vfs = lookup_dir_path(path, &path_out);
 
     mp_vfs_ilistdir_it_t iter;
-    mp_obj_t iter_obj = MP_OBJ_FROM_PTR(&iter);
+    mp_obj_t iter_obj;
 
     if (vfs == MP_VFS_ROOT) {
         // list the root directory
-        iter.base.type = &mp_type_polymorph_iter;
-        iter.iternext = mp_vfs_ilistdir_it_iternext;
-        iter.cur.vfs = MP_STATE_VM(vfs_mount_table);
-        iter.is_str = true;
-        iter.is_iter = false;
+        iter_obj = os_ilistdir_root(&iter);
     } else {
         iter_obj = mp_vfs_proxy_call(vfs, MP_QSTR_ilistdir, 1, &path_out);
     }
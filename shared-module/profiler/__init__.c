@@ -0,0 +1,205 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/bc.h"
+#include "py/mpstate.h"
+#include "py/objlist.h"
+#include "py/objtuple.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/profiler/__init__.h"
+#include "shared-module/profiler/__init__.h"
+#include "supervisor/shared/background_tasks.h"
+
+// Samples taken by the tick but not counted yet. Only the tick writes
+// ring_head and only the background task (or dump()) writes ring_tail.
+#define PROFILER_RING_SIZE (16)
+// Number of distinct locations counted.
+#define PROFILER_ENTRIES (32)
+
+typedef struct {
+    qstr block_name;
+    qstr source_file;
+    size_t offset;
+} profiler_sample_t;
+
+typedef struct {
+    qstr block_name;
+    qstr source_file;
+    size_t offset;
+    size_t count;
+} profiler_entry_t;
+
+static profiler_sample_t ring[PROFILER_RING_SIZE];
+static volatile uint8_t ring_head;
+static volatile uint8_t ring_tail;
+static profiler_entry_t entries[PROFILER_ENTRIES];
+
+static volatile bool running;
+// Ticks between samples, and ticks left until the next one.
+static uint16_t interval;
+static uint16_t countdown;
+
+STATIC void profiler_drain(void);
+
+STATIC background_task_t profiler_task = BACKGROUND_TASK(profiler_drain, BACKGROUND_TASK_PRIORITY_PROFILER, 8);
+
+void profiler_tick(void) {
+    if (!running || --countdown > 0) {
+        return;
+    }
+    countdown = interval;
+
+    uint8_t head = ring_head;
+    uint8_t next = (head + 1) % PROFILER_RING_SIZE;
+    if (next == ring_tail) {
+        // The background task is behind; skipping a sample doesn't skew the
+        // ones that are taken.
+        return;
+    }
+    profiler_sample_t *sample = &ring[head];
+    // This may interrupt any thread, so look at the main thread explicitly.
+    const mp_code_state_t *code_state = MP_STATE_MAIN_THREAD(current_code_state);
+    if (code_state == NULL) {
+        sample->block_name = MP_QSTR_NULL;
+        sample->source_file = MP_QSTR_NULL;
+        sample->offset = 0;
+    } else {
+        sample->offset = mp_code_state_get_bc_offset(code_state, &sample->block_name, &sample->source_file);
+    }
+    ring_head = next;
+}
+
+// Counts a sample against its location. When every entry is in use, the one
+// with the fewest samples is given up to the new location.
+STATIC void profiler_count(const profiler_sample_t *sample) {
+    profiler_entry_t *entry = NULL;
+    profiler_entry_t *smallest = &entries[0];
+    for (size_t i = 0; i < PROFILER_ENTRIES; i++) {
+        profiler_entry_t *e = &entries[i];
+        if (e->count > 0 && e->offset == sample->offset && e->block_name == sample->block_name && e->source_file == sample->source_file) {
+            entry = e;
+            break;
+        }
+        if (e->count < smallest->count) {
+            smallest = e;
+        }
+    }
+    if (entry == NULL) {
+        entry = smallest;
+        entry->block_name = sample->block_name;
+        entry->source_file = sample->source_file;
+        entry->offset = sample->offset;
+        entry->count = 0;
+    }
+    entry->count++;
+}
+
+STATIC void profiler_drain(void) {
+    uint8_t tail = ring_tail;
+    while (tail != ring_head) {
+        profiler_count(&ring[tail]);
+        tail = (tail + 1) % PROFILER_RING_SIZE;
+        ring_tail = tail;
+    }
+}
+
+void shared_module_profiler_start(mp_uint_t rate) {
+    running = false;
+    // Ticks are 1/1024 of a second.
+    interval = 1024 / rate;
+    countdown = interval;
+    supervisor_background_task_register(&profiler_task);
+    running = true;
+}
+
+void shared_module_profiler_stop(void) {
+    running = false;
+    profiler_drain();
+}
+
+bool shared_module_profiler_is_running(void) {
+    return running;
+}
+
+void shared_module_profiler_reset(void) {
+    bool was_running = running;
+    running = false;
+    ring_tail = ring_head;
+    memset(entries, 0, sizeof(entries));
+    running = was_running;
+}
+
+void reset_profiler(void) {
+    running = false;
+    ring_tail = ring_head;
+    memset(entries, 0, sizeof(entries));
+}
+
+mp_obj_t shared_module_profiler_dump(size_t n) {
+    profiler_drain();
+    // Take a copy so the samples counted while building the result don't
+    // change the table underneath us.
+    profiler_entry_t sorted[PROFILER_ENTRIES];
+    memcpy(sorted, entries, sizeof(sorted));
+
+    // Selection sort by count, largest first. The table is small.
+    size_t used = 0;
+    for (size_t i = 0; i < PROFILER_ENTRIES; i++) {
+        size_t largest = i;
+        for (size_t j = i + 1; j < PROFILER_ENTRIES; j++) {
+            if (sorted[j].count > sorted[largest].count) {
+                largest = j;
+            }
+        }
+        if (sorted[largest].count == 0) {
+            break;
+        }
+        profiler_entry_t tmp = sorted[i];
+        sorted[i] = sorted[largest];
+        sorted[largest] = tmp;
+        used++;
+    }
+    if (n > used) {
+        n = used;
+    }
+
+    mp_obj_t result = mp_obj_new_list(n, NULL);
+    mp_obj_list_t *list = MP_OBJ_TO_PTR(result);
+    for (size_t i = 0; i < n; i++) {
+        profiler_entry_t *e = &sorted[i];
+        mp_obj_t items[4] = {
+            e->block_name == MP_QSTR_NULL ? mp_const_none : MP_OBJ_NEW_QSTR(e->block_name),
+            e->source_file == MP_QSTR_NULL ? mp_const_none : MP_OBJ_NEW_QSTR(e->source_file),
+            MP_OBJ_NEW_SMALL_INT(e->offset),
+            mp_obj_new_int_from_uint(e->count),
+        };
+        list->items[i] = mp_obj_new_tuple(4, items);
+    }
+    return result;
+}
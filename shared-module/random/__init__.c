@@ -58,6 +58,36 @@ STATIC uint32_t yasmarang(void)
 
 // End of Yasmarang
 
+// xoshiro128** by David Blackman and Sebastiano Vigna
+// http://prng.di.unimi.it/
+// Public Domain
+//
+// Used by fill(), where it produces four bytes per step with nothing but
+// shifts, xors and two multiplies, and keeps its state in registers for the
+// whole buffer.
+
+STATIC uint32_t xoshiro_state[4];
+
+STATIC inline uint32_t xoshiro_rotl(uint32_t x, int k) {
+    return (x << k) | (x >> (32 - k));
+}
+
+// splitmix32, to spread a seed over the whole state
+STATIC uint32_t xoshiro_splitmix(uint32_t *x) {
+    uint32_t z = (*x += 0x9e3779b9);
+    z = (z ^ (z >> 16)) * 0x85ebca6b;
+    z = (z ^ (z >> 13)) * 0xc2b2ae35;
+    return z ^ (z >> 16);
+}
+
+STATIC void xoshiro_seed(uint32_t seed) {
+    for (size_t i = 0; i < MP_ARRAY_SIZE(xoshiro_state); i++) {
+        xoshiro_state[i] = xoshiro_splitmix(&seed);
+    }
+}
+
+// End of xoshiro128**
+
 // returns an unsigned integer below the given argument
 // n must not be zero
 STATIC uint32_t yasmarang_randbelow(uint32_t n) {
@@ -77,6 +107,42 @@ void shared_modules_random_seed(mp_uint_t seed) {
     yasmarang_n = 69;
     yasmarang_d = 233;
     yasmarang_dat = 0;
+    xoshiro_seed(seed);
+}
+
+void shared_modules_random_fill(uint8_t *buf, size_t len) {
+    uint32_t s0 = xoshiro_state[0], s1 = xoshiro_state[1];
+    uint32_t s2 = xoshiro_state[2], s3 = xoshiro_state[3];
+    if ((s0 | s1 | s2 | s3) == 0) {
+        // Not seeded yet, the all zero state is the one xoshiro can't leave.
+        uint32_t seed;
+        if (!common_hal_os_urandom((uint8_t *)&seed, sizeof(seed))) {
+            seed = common_hal_time_monotonic() & 0xffffffff;
+        }
+        xoshiro_seed(seed);
+        s0 = xoshiro_state[0];
+        s1 = xoshiro_state[1];
+        s2 = xoshiro_state[2];
+        s3 = xoshiro_state[3];
+    }
+    while (len > 0) {
+        uint32_t result = xoshiro_rotl(s1 * 5, 7) * 9;
+        uint32_t t = s1 << 9;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = xoshiro_rotl(s3, 11);
+        size_t n = len < sizeof(result) ? len : sizeof(result);
+        memcpy(buf, &result, n);
+        buf += n;
+        len -= n;
+    }
+    xoshiro_state[0] = s0;
+    xoshiro_state[1] = s1;
+    xoshiro_state[2] = s2;
+    xoshiro_state[3] = s3;
 }
 
 mp_uint_t shared_modules_random_getrandbits(uint8_t n) {
@@ -0,0 +1,121 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "py/binary.h"
+#include "shared-bindings/struct/__init__.h"
+#include "shared-bindings/struct/Struct.h"
+#include "shared-module/struct/__init__.h"
+#include "supervisor/shared/translate.h"
+
+struct_struct_obj_t *shared_modules_struct_struct_construct(const mp_obj_type_t *type, mp_obj_t fmt_in) {
+    const mp_uint_t size = shared_modules_struct_calcsize(fmt_in);
+    const char *fmt = mp_obj_str_get_str(fmt_in);
+    char fmt_type = get_fmt_type(&fmt);
+    mp_uint_t num_fields = 0;
+    for (const char *f = fmt; *f; f++) {
+        if (!unichar_isdigit(*f)) {
+            num_fields++;
+        }
+    }
+
+    struct_struct_obj_t *self = m_new_obj_var(struct_struct_obj_t, struct_struct_field_t, num_fields);
+    self->base.type = type;
+    self->format = fmt_in;
+    self->fmt_type = fmt_type;
+    self->size = size;
+    self->num_items = calcsize_items(fmt);
+    self->num_fields = num_fields;
+    for (struct_struct_field_t *field = self->fields; *fmt; fmt++, field++) {
+        field->count = 1;
+        if (unichar_isdigit(*fmt)) {
+            field->count = get_fmt_num(&fmt);
+        }
+        field->code = *fmt;
+    }
+    return self;
+}
+
+void shared_modules_struct_struct_pack_into(struct_struct_obj_t *self, byte *p, byte *end_p, size_t n_args, const mp_obj_t *args) {
+    if (p + self->size > end_p) {
+        mp_raise_RuntimeError(translate("buffer too small"));
+    }
+
+    const struct_struct_field_t *field = self->fields;
+    const struct_struct_field_t *end = field + self->num_fields;
+    for (size_t i = 0; i < n_args; field++) {
+        if (field == end) {
+            // more arguments given than used by format string; CPython raises struct.error here
+            mp_raise_RuntimeError(translate("too many arguments provided with the given format"));
+        }
+        if (field->code == 's') {
+            mp_buffer_info_t bufinfo;
+            mp_get_buffer_raise(args[i++], &bufinfo, MP_BUFFER_READ);
+            mp_uint_t to_copy = MIN(bufinfo.len, field->count);
+            memcpy(p, bufinfo.buf, to_copy);
+            memset(p + to_copy, 0, field->count - to_copy);
+            p += field->count;
+        } else {
+            for (mp_uint_t cnt = field->count; cnt > 0 && i < n_args; cnt--) {
+                mp_binary_set_val(self->fmt_type, field->code, args[i], &p);
+                // Pad bytes don't have a corresponding argument.
+                if (field->code != 'x') {
+                    i++;
+                }
+            }
+        }
+    }
+}
+
+void shared_modules_struct_struct_unpack_into(struct_struct_obj_t *self, byte *p, byte *end_p, bool exact_size, mp_obj_t *items) {
+    // If exact_size, make sure the buffer is exactly the right size.
+    // Otherwise just make sure it's big enough.
+    if (exact_size) {
+        if (p + self->size != end_p) {
+            mp_raise_RuntimeError(translate("buffer size must match format"));
+        }
+    } else if (p + self->size > end_p) {
+        mp_raise_RuntimeError(translate("buffer too small"));
+    }
+
+    const struct_struct_field_t *field = self->fields;
+    for (mp_uint_t i = 0; i < self->num_items; field++) {
+        if (field->code == 's') {
+            items[i++] = mp_obj_new_bytes(p, field->count);
+            p += field->count;
+        } else {
+            for (mp_uint_t cnt = field->count; cnt > 0; cnt--) {
+                mp_obj_t item = mp_binary_get_val(self->fmt_type, field->code, &p);
+                // Pad bytes are not stored.
+                if (field->code != 'x') {
+                    items[i++] = item;
+                }
+            }
+        }
+    }
+}
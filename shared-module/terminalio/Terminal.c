@@ -29,6 +29,9 @@
 #include "shared-module/fontio/BuiltinFont.h"
 #include "shared-bindings/displayio/TileGrid.h"
 
+// Most glyphs gathered before they're written to the tile grid in one run.
+#define TERMINALIO_RUN_LENGTH (32)
+
 void common_hal_terminalio_terminal_construct(terminalio_terminal_obj_t *self, displayio_tilegrid_t* tilegrid, const fontio_builtinfont_t* font) {
     self->cursor_x = 0;
     self->cursor_y = 0;
@@ -45,19 +48,35 @@ void common_hal_terminalio_terminal_construct(terminalio_terminal_obj_t *self, d
     common_hal_displayio_tilegrid_set_top_left(self->tilegrid, 0, 1);
 }
 
+// Writes the gathered glyphs, which end just before the cursor.
+static void flush_run(terminalio_terminal_obj_t *self, const uint8_t *run, uint16_t *run_length) {
+    displayio_tilegrid_set_tiles(self->tilegrid, self->cursor_x - *run_length, self->cursor_y, run, *run_length);
+    *run_length = 0;
+}
+
 size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, const byte *data, size_t len, int *errcode) {
     const byte* i = data;
     uint16_t start_y = self->cursor_y;
+    uint8_t run[TERMINALIO_RUN_LENGTH];
+    uint16_t run_length = 0;
     while (i < data + len) {
         unichar c = utf8_get_char(i);
         i = utf8_next_char(i);
-        // Always handle ASCII.
-        if (c < 128) {
-            if (c >= 0x20 && c <= 0x7e) {
-                uint8_t tile_index = fontio_builtinfont_get_glyph_index(self->font, c);
-                common_hal_displayio_tilegrid_set_tile(self->tilegrid, self->cursor_x, self->cursor_y, tile_index);
-                self->cursor_x++;
-            } else if (c == '\r') {
+        uint8_t tile_index = 0xff;
+        if ((c >= 0x20 && c <= 0x7e) || c >= 128) {
+            tile_index = fontio_builtinfont_get_glyph_index(self->font, c);
+        }
+        if (tile_index != 0xff) {
+            // Glyphs along a row are gathered up and written together.
+            run[run_length++] = tile_index;
+            self->cursor_x++;
+            if (run_length == TERMINALIO_RUN_LENGTH || self->cursor_x >= self->tilegrid->width_in_tiles) {
+                flush_run(self, run, &run_length);
+            }
+        } else if (c < 128) {
+            // Always handle ASCII.
+            flush_run(self, run, &run_length);
+            if (c == '\r') {
                 self->cursor_x = 0;
             } else if (c == '\n') {
                 self->cursor_y++;
@@ -70,8 +89,9 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
                 if (i[0] == '[') {
                     if (i[1] == 'K') {
                         // Clear the rest of the line.
-                        for (uint16_t j = self->cursor_x; j < self->tilegrid->width_in_tiles; j++) {
-                            common_hal_displayio_tilegrid_set_tile(self->tilegrid, j, self->cursor_y, 0);
+                        if (self->cursor_x < self->tilegrid->width_in_tiles) {
+                            displayio_tilegrid_fill_tiles(self->tilegrid, self->cursor_x, self->cursor_y, 0,
+                                self->tilegrid->width_in_tiles - self->cursor_x);
                         }
                         i += 2;
                     } else {
@@ -98,13 +118,6 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
                     }
                 }
             }
-        } else {
-            uint8_t tile_index = fontio_builtinfont_get_glyph_index(self->font, c);
-            if (tile_index != 0xff) {
-                common_hal_displayio_tilegrid_set_tile(self->tilegrid, self->cursor_x, self->cursor_y, tile_index);
-                self->cursor_x++;
-
-            }
         }
         if (self->cursor_x >= self->tilegrid->width_in_tiles) {
             self->cursor_y++;
@@ -115,13 +128,12 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
         }
         if (self->cursor_y != start_y) {
             // clear the new row
-            for (uint16_t j = 0; j < self->tilegrid->width_in_tiles; j++) {
-                common_hal_displayio_tilegrid_set_tile(self->tilegrid, j, self->cursor_y, 0);
-                start_y = self->cursor_y;
-            }
+            displayio_tilegrid_fill_tiles(self->tilegrid, 0, self->cursor_y, 0, self->tilegrid->width_in_tiles);
+            start_y = self->cursor_y;
             common_hal_displayio_tilegrid_set_top_left(self->tilegrid, 0, (start_y + self->tilegrid->height_in_tiles + 1) % self->tilegrid->height_in_tiles);
         }
     }
+    flush_run(self, run, &run_length);
     return i - data;
 }
 
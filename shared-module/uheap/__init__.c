@@ -25,6 +25,7 @@
  */
 
 #include <stdint.h>
+#include <string.h>
 
 #include "py/bc.h"
 #include "py/binary.h"
@@ -33,16 +34,30 @@
 #include "py/objarray.h"
 #include "py/objfun.h"
 #include "py/objint.h"
+#include "py/objlist.h"
 #include "py/objstr.h"
 #include "py/objtype.h"
 #include "py/runtime.h"
 
 #include "shared-bindings/uheap/__init__.h"
 
-#define VERIFY_PTR(ptr) ( \
-        (void *) ptr >= (void*)MP_STATE_MEM(gc_pool_start)     /* must be above start of pool */ \
-        && (void *) ptr < (void*)MP_STATE_MEM(gc_pool_end)        /* must be below end of pool */ \
-    )
+// Unlike the version in py/gc.h this doesn't require the pointer to be block
+// aligned, so it can be used on interior pointers.
+static bool ptr_in_heap(const void *ptr) {
+    const mp_state_mem_area_t *area = &MP_STATE_MEM(area);
+    #if MICROPY_GC_SPLIT_HEAP
+    for (; area != NULL; area = area->next)
+    #endif
+    {
+        if (ptr >= (void*)area->gc_pool_start && ptr < (void*)area->gc_pool_end) {
+            return true;
+        }
+    }
+    return false;
+}
+
+#undef VERIFY_PTR
+#define VERIFY_PTR(ptr) ptr_in_heap((const void *) ptr)
 
 static void indent(uint8_t levels) {
     for (int i = 0; i < levels; i++) {
@@ -139,18 +154,6 @@ static uint32_t function_size(uint8_t indent_level, mp_obj_t obj) {
         mp_printf(&mp_plat_print, "BYTECODE END\n");
         #endif
         return total_size;
-    #if MICROPY_EMIT_NATIVE
-    } else if (MP_OBJ_IS_TYPE(obj, &mp_type_fun_native)) {
-        return 0;
-    #endif
-    #if MICROPY_EMIT_NATIVE
-    } else if (MP_OBJ_IS_TYPE(obj, &mp_obj_fun_viper_t)) {
-        return 0;
-    #endif
-    #if MICROPY_EMIT_THUMB
-    } else if (MP_OBJ_IS_TYPE(obj, &mp_type_fun_asm)) {
-        return 0;
-    #endif
     }
     return 0;
 }
@@ -290,3 +293,56 @@ uint32_t shared_module_uheap_info(mp_obj_t obj) {
     }
     return object_size(0, obj);
 }
+
+#if MICROPY_GC_ALLOC_PROFILE
+void shared_module_uheap_profile_enable(bool enabled) {
+    gc_profile_enable(enabled);
+}
+
+void shared_module_uheap_profile_reset(void) {
+    gc_profile_reset();
+}
+
+mp_obj_t shared_module_uheap_profile(size_t n) {
+    // Take a copy so that the allocations made while building the result
+    // don't change the table underneath us.
+    mp_gc_profile_entry_t entries[MICROPY_GC_ALLOC_PROFILE_ENTRIES];
+    memcpy(entries, MP_STATE_MEM(gc_profile), sizeof(entries));
+
+    // Selection sort by bytes, largest first. The table is small.
+    size_t used = 0;
+    for (size_t i = 0; i < MICROPY_GC_ALLOC_PROFILE_ENTRIES; i++) {
+        size_t largest = i;
+        for (size_t j = i + 1; j < MICROPY_GC_ALLOC_PROFILE_ENTRIES; j++) {
+            if (entries[j].bytes > entries[largest].bytes) {
+                largest = j;
+            }
+        }
+        if (entries[largest].count == 0) {
+            break;
+        }
+        mp_gc_profile_entry_t tmp = entries[i];
+        entries[i] = entries[largest];
+        entries[largest] = tmp;
+        used++;
+    }
+    if (n > used) {
+        n = used;
+    }
+
+    mp_obj_t result = mp_obj_new_list(n, NULL);
+    mp_obj_list_t *list = MP_OBJ_TO_PTR(result);
+    for (size_t i = 0; i < n; i++) {
+        mp_gc_profile_entry_t *e = &entries[i];
+        mp_obj_t items[5] = {
+            e->block_name == MP_QSTR_NULL ? mp_const_none : MP_OBJ_NEW_QSTR(e->block_name),
+            e->source_file == MP_QSTR_NULL ? mp_const_none : MP_OBJ_NEW_QSTR(e->source_file),
+            MP_OBJ_NEW_SMALL_INT(e->line),
+            mp_obj_new_int_from_uint(e->count),
+            mp_obj_new_int_from_uint(e->bytes),
+        };
+        list->items[i] = mp_obj_new_tuple(5, items);
+    }
+    return result;
+}
+#endif
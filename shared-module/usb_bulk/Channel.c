@@ -0,0 +1,77 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/usb_bulk/Channel.h"
+
+#include "lib/utils/interrupt_char.h"
+#include "py/mperrno.h"
+#include "py/stream.h"
+#include "supervisor/usb.h"
+#include "tusb.h"
+
+size_t common_hal_usb_bulk_channel_read(usb_bulk_channel_obj_t *self, uint8_t *data, size_t len, int *errcode) {
+    // Hand back whatever TinyUSB has already queued. Telemetry consumers poll,
+    // so an empty FIFO is reported as EAGAIN rather than blocking the VM.
+    uint32_t count = tud_vendor_read(data, len);
+    if (count == 0) {
+        *errcode = MP_EAGAIN;
+        return MP_STREAM_ERROR;
+    }
+    return count;
+}
+
+size_t common_hal_usb_bulk_channel_write(usb_bulk_channel_obj_t *self, const uint8_t *data, size_t len, int *errcode) {
+    // tud_vendor_write() copies into the TX FIFO and starts a transfer
+    // straight from it, so keep the FIFO topped up and run the USB task
+    // ourselves instead of waiting for the next background tick.
+    size_t count = 0;
+    while (count < len && tud_vendor_mounted()) {
+        count += tud_vendor_write(data + count, len - count);
+        if (count < len) {
+            usb_background();
+            if (mp_hal_is_interrupted()) {
+                break;
+            }
+        }
+    }
+    if (count == 0) {
+        *errcode = MP_EAGAIN;
+        return MP_STREAM_ERROR;
+    }
+    return count;
+}
+
+uint32_t common_hal_usb_bulk_channel_get_in_waiting(usb_bulk_channel_obj_t *self) {
+    return tud_vendor_available();
+}
+
+bool common_hal_usb_bulk_channel_get_connected(usb_bulk_channel_obj_t *self) {
+    return tud_vendor_mounted();
+}
+
+bool common_hal_usb_bulk_channel_ready_to_tx(usb_bulk_channel_obj_t *self) {
+    return tud_vendor_mounted() && tud_vendor_write_available() > 0;
+}
@@ -26,6 +26,8 @@
 
 #include <string.h>
 
+#include "genhdr/autogen_usb_descriptor.h"
+#include "py/ringbuf.h"
 #include "py/runtime.h"
 #include "shared-bindings/usb_hid/Device.h"
 #include "shared-module/usb_hid/Device.h"
@@ -41,25 +43,83 @@ uint8_t common_hal_usb_hid_device_get_usage(usb_hid_device_obj_t *self) {
     return self->usage;
 }
 
-void common_hal_usb_hid_device_send_report(usb_hid_device_obj_t *self, uint8_t* report, uint8_t len) {
+// All the devices share one interrupt IN endpoint, so their reports share
+// one FIFO and go out in the order they were queued. Each entry is the
+// device's index in usb_hid_devices followed by its report. The VM is the
+// only producer and usb_hid_background() the only consumer.
+static uint8_t report_queue_buf[USB_HID_REPORT_QUEUE_SIZE];
+static ringbuf_t report_queue = {
+    .buf = report_queue_buf,
+    .size = USB_HID_REPORT_QUEUE_SIZE,
+};
+
+static void check_report_length(usb_hid_device_obj_t *self, uint8_t len) {
     if (len != self->report_length) {
         mp_raise_ValueError_varg(translate("Buffer incorrect size. Should be %d bytes."), self->report_length);
     }
+}
+
+bool common_hal_usb_hid_device_queue_report(usb_hid_device_obj_t *self, uint8_t* report, uint8_t len) {
+    MP_STATIC_ASSERT((USB_HID_REPORT_QUEUE_SIZE & (USB_HID_REPORT_QUEUE_SIZE - 1)) == 0);
+    MP_STATIC_ASSERT(USB_HID_REPORT_QUEUE_SIZE >= USB_HID_MAX_REPORT_LENGTH + 1);
+    check_report_length(self, len);
+
+    if (ringbuf_num_empty(&report_queue) < (size_t)len + 1) {
+        return false;
+    }
+    // Publish the whole entry at once so the consumer never sees half of it.
+    uint8_t entry[USB_HID_MAX_REPORT_LENGTH + 1];
+    entry[0] = self - usb_hid_devices;
+    memcpy(entry + 1, report, len);
+    ringbuf_put_n(&report_queue, entry, len + 1);
+    return true;
+}
 
-    // Wait until interface is ready, timeout = 2 seconds
+void common_hal_usb_hid_device_send_report(usb_hid_device_obj_t *self, uint8_t* report, uint8_t len) {
+    check_report_length(self, len);
+
+    // Only wait when the queue is full, timeout = 2 seconds
     uint64_t end_ticks = supervisor_ticks_ms64() + 2000;
-    while ( (supervisor_ticks_ms64() < end_ticks) && !tud_hid_ready() ) {
+    while (!common_hal_usb_hid_device_queue_report(self, report, len)) {
+        if (supervisor_ticks_ms64() >= end_ticks) {
+            mp_raise_msg(&mp_type_OSError,  translate("USB Busy"));
+        }
         RUN_BACKGROUND_TASKS;
     }
+}
 
-    if ( !tud_hid_ready() ) {
-        mp_raise_msg(&mp_type_OSError,  translate("USB Busy"));
+size_t common_hal_usb_hid_device_get_reports_pending(usb_hid_device_obj_t *self) {
+    // Walk the queue without consuming it. Entries are variable length, so
+    // each header says how far to skip.
+    size_t pending = 0;
+    size_t offset = 0;
+    size_t filled = ringbuf_num_filled(&report_queue);
+    while (offset < filled) {
+        uint8_t device_index;
+        ringbuf_peek_n(&report_queue, &device_index, 1, offset);
+        if (&usb_hid_devices[device_index] == self) {
+            pending++;
+        }
+        offset += 1 + usb_hid_devices[device_index].report_length;
     }
+    return pending;
+}
 
-    memcpy(self->report_buffer, report, len);
+// Called from usb_background() after tud_task(). Sends the oldest queued
+// report whenever the endpoint has finished with the previous one, so a
+// burst goes out at the endpoint's polling rate without Python waiting on it.
+void usb_hid_background(void) {
+    if (ringbuf_num_filled(&report_queue) == 0 || !tud_hid_ready()) {
+        return;
+    }
+    uint8_t device_index;
+    ringbuf_peek_n(&report_queue, &device_index, 1, 0);
+    usb_hid_device_obj_t *device = &usb_hid_devices[device_index];
 
-    if ( !tud_hid_report(self->report_id, self->report_buffer, len) ) {
-        mp_raise_msg(&mp_type_OSError, translate("USB Error"));
+    // Keep the last report for Get_Report requests.
+    ringbuf_peek_n(&report_queue, device->report_buffer, device->report_length, 1);
+    if (tud_hid_report(device->report_id, device->report_buffer, device->report_length)) {
+        ringbuf_read_commit(&report_queue, 1 + device->report_length);
     }
 }
 
@@ -48,6 +48,13 @@ typedef struct  {
 
 extern usb_hid_device_obj_t usb_hid_devices[];
 
+// Bytes of queued reports shared by all the devices. Must be a power of two.
+#ifndef USB_HID_REPORT_QUEUE_SIZE
+#define USB_HID_REPORT_QUEUE_SIZE (256)
+#endif
+
+void usb_hid_background(void);
+
 #ifdef __cplusplus
  }
 #endif
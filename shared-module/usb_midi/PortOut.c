@@ -24,12 +24,117 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-bindings/usb_midi/PortOut.h"
 #include "shared-module/usb_midi/PortOut.h"
+#include "supervisor/shared/tick.h"
 #include "supervisor/shared/translate.h"
 #include "tusb.h"
 
+#define SCHEDULED_HEADER_SIZE (sizeof(uint64_t) + 1)
+
+// There is only ever one PortOut, and it lives outside the heap.
+static uint8_t scheduled_buf[USB_MIDI_PORTOUT_SCHEDULE_SIZE];
+
+void usb_midi_portout_init(usb_midi_portout_obj_t *self) {
+    ringbuf_init(&self->scheduled, scheduled_buf, sizeof(scheduled_buf));
+    self->pending_len = 0;
+    self->flush_deadline_ms = 0;
+}
+
+// Hand everything pending to TinyUSB in one call so that it is packed into
+// as few packets as possible. TinyUSB keeps the running-status parser state
+// between calls, so a message split here is still reassembled correctly.
+STATIC void portout_flush(usb_midi_portout_obj_t *self) {
+    if (self->pending_len == 0) {
+        return;
+    }
+    size_t n = tud_midi_write(0, self->pending, self->pending_len);
+    self->pending_len -= n;
+    memmove(self->pending, self->pending + n, self->pending_len);
+}
+
+// Returns how many bytes were accepted into pending.
+STATIC size_t portout_append(usb_midi_portout_obj_t *self, const uint8_t *data, size_t len) {
+    size_t written = 0;
+    while (written < len) {
+        if (self->pending_len == USB_MIDI_PORTOUT_PACKET_BYTES) {
+            portout_flush(self);
+            if (self->pending_len == USB_MIDI_PORTOUT_PACKET_BYTES) {
+                break;
+            }
+        }
+        if (self->pending_len == 0) {
+            self->flush_deadline_ms = supervisor_ticks_ms64() + USB_MIDI_PORTOUT_FLUSH_MS;
+        }
+        size_t n = MIN(len - written, (size_t)(USB_MIDI_PORTOUT_PACKET_BYTES - self->pending_len));
+        memcpy(self->pending + self->pending_len, data + written, n);
+        self->pending_len += n;
+        written += n;
+    }
+    if (self->pending_len == USB_MIDI_PORTOUT_PACKET_BYTES) {
+        portout_flush(self);
+    }
+    return written;
+}
+
 size_t common_hal_usb_midi_portout_write(usb_midi_portout_obj_t *self, const uint8_t *data, size_t len, int *errcode) {
-    return tud_midi_write(0, data, len);
+    return portout_append(self, data, len);
+}
+
+bool common_hal_usb_midi_portout_write_at(usb_midi_portout_obj_t *self, const uint8_t *data, size_t len, uint64_t time_ms) {
+    // A due entry is moved into pending whole, so it can't be larger.
+    if (len == 0 || len > USB_MIDI_PORTOUT_PACKET_BYTES) {
+        mp_raise_ValueError_varg(translate("%q length must be %d-%d"), MP_QSTR_buf, 1, USB_MIDI_PORTOUT_PACKET_BYTES);
+    }
+    if (ringbuf_num_empty(&self->scheduled) < SCHEDULED_HEADER_SIZE + len) {
+        return false;
+    }
+    // Publish the whole entry at once so the background never sees half of it.
+    uint8_t entry[SCHEDULED_HEADER_SIZE + USB_MIDI_PORTOUT_PACKET_BYTES];
+    memcpy(entry, &time_ms, sizeof(time_ms));
+    entry[sizeof(time_ms)] = len;
+    memcpy(entry + SCHEDULED_HEADER_SIZE, data, len);
+    ringbuf_put_n(&self->scheduled, entry, SCHEDULED_HEADER_SIZE + len);
+    return true;
+}
+
+void common_hal_usb_midi_portout_flush(usb_midi_portout_obj_t *self) {
+    portout_flush(self);
+}
+
+// Called from usb_background(). Moves every scheduled write that has come
+// due into pending and sends them together, then sends anything that has
+// waited out the flush deadline.
+void usb_midi_portout_background(usb_midi_portout_obj_t *self) {
+    uint64_t now = supervisor_ticks_ms64();
+    bool due = false;
+    while (ringbuf_num_filled(&self->scheduled) >= SCHEDULED_HEADER_SIZE) {
+        uint8_t header[SCHEDULED_HEADER_SIZE];
+        ringbuf_peek_n(&self->scheduled, header, SCHEDULED_HEADER_SIZE, 0);
+        uint64_t time_ms;
+        memcpy(&time_ms, header, sizeof(time_ms));
+        if (time_ms > now) {
+            break;
+        }
+        size_t len = header[sizeof(time_ms)];
+        if (USB_MIDI_PORTOUT_PACKET_BYTES - self->pending_len < len) {
+            portout_flush(self);
+            if (USB_MIDI_PORTOUT_PACKET_BYTES - self->pending_len < len) {
+                // TinyUSB is full; try again on the next pass.
+                break;
+            }
+        }
+        ringbuf_peek_n(&self->scheduled, self->pending + self->pending_len, len, SCHEDULED_HEADER_SIZE);
+        self->pending_len += len;
+        ringbuf_read_commit(&self->scheduled, SCHEDULED_HEADER_SIZE + len);
+        due = true;
+    }
+    if (self->pending_len > 0 && (due || now >= self->flush_deadline_ms)) {
+        portout_flush(self);
+    }
 }
 
 bool common_hal_usb_midi_portout_ready_to_tx(usb_midi_portout_obj_t *self) {
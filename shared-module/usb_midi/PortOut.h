@@ -31,9 +31,32 @@
 #include <stdbool.h>
 
 #include "py/obj.h"
+#include "py/ringbuf.h"
+
+// Raw MIDI bytes held back to fill one 64-byte USB packet: sixteen 4-byte
+// USB-MIDI events of three-byte channel messages.
+#define USB_MIDI_PORTOUT_PACKET_BYTES (48)
+
+// How long written bytes may wait for more to share their packet.
+#ifndef USB_MIDI_PORTOUT_FLUSH_MS
+#define USB_MIDI_PORTOUT_FLUSH_MS (1)
+#endif
+
+// Bytes of timestamped writes waiting for their time. Must be a power of two.
+#ifndef USB_MIDI_PORTOUT_SCHEDULE_SIZE
+#define USB_MIDI_PORTOUT_SCHEDULE_SIZE (256)
+#endif
 
 typedef struct  {
     mp_obj_base_t base;
+    uint64_t flush_deadline_ms;
+    // Entries are a uint64_t due time in ms, a length byte and the data.
+    ringbuf_t scheduled;
+    uint8_t pending_len;
+    uint8_t pending[USB_MIDI_PORTOUT_PACKET_BYTES];
 } usb_midi_portout_obj_t;
 
+void usb_midi_portout_init(usb_midi_portout_obj_t *self);
+void usb_midi_portout_background(usb_midi_portout_obj_t *self);
+
 #endif /* SHARED_MODULE_USB_MIDI_PORTOUT_H */
@@ -37,6 +37,7 @@
 #include "tusb.h"
 
 supervisor_allocation* usb_midi_allocation;
+static usb_midi_portout_obj_t *usb_midi_portout;
 
 void usb_midi_init(void) {
     // TODO(tannewt): Make this dynamic.
@@ -57,7 +58,15 @@ void usb_midi_init(void) {
 
     usb_midi_portout_obj_t* out = (usb_midi_portout_obj_t *) (usb_midi_allocation->ptr + tuple_size / 4 + portin_size / 4);
     out->base.type = &usb_midi_portout_type;
+    usb_midi_portout_init(out);
+    usb_midi_portout = out;
     ports->items[1] = MP_OBJ_FROM_PTR(out);
 
     mp_map_lookup(&usb_midi_module_globals.map, MP_ROM_QSTR(MP_QSTR_ports), MP_MAP_LOOKUP)->value = MP_OBJ_FROM_PTR(ports);
 }
+
+void usb_midi_background(void) {
+    if (usb_midi_portout != NULL) {
+        usb_midi_portout_background(usb_midi_portout);
+    }
+}
@@ -2,6 +2,7 @@
 #include "shared-bindings/vectorio/Circle.h"
 #include "shared-module/vectorio/__init__.h"
 #include "shared-module/displayio/area.h"
+#include "shared-module/vectorio/VectorShape.h"
 
 #include "py/runtime.h"
 #include "stdlib.h"
@@ -33,6 +34,42 @@ uint32_t common_hal_vectorio_circle_get_pixel(void *obj, int16_t x, int16_t y) {
 }
 
 
+// Largest h with h * h <= n.
+static int32_t isqrt(int32_t n) {
+    int32_t root = 0;
+    int32_t bit = 1 << 30;
+    while (bit > n) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (n >= root + bit) {
+            n -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+
+// A circle is symmetric, so rows and columns have the same spans.
+size_t common_hal_vectorio_circle_get_spans(void *obj, bool column, int16_t line, int32_t *spans, size_t max_spans) {
+    vectorio_circle_t *self = obj;
+    int16_t radius = abs(self->radius);
+    int32_t y = abs(line);
+    if (y > radius) {
+        return 0;
+    }
+    // The pixels get_pixel accepts are exactly those with x*x + y*y <= radius*radius.
+    int32_t half_width = isqrt((int32_t)radius*radius - y*y);
+    spans[0] = -half_width;
+    spans[1] = half_width + 1;
+    return 1;
+}
+
+
 void common_hal_vectorio_circle_get_area(void *circle, displayio_area_t *out_area) {
     vectorio_circle_t *self = circle;
     out_area->x1 = -1 * self->radius - 1;
@@ -2,6 +2,7 @@
 #include "shared-module/vectorio/__init__.h"
 #include "shared-bindings/vectorio/Polygon.h"
 #include "shared-module/displayio/area.h"
+#include "shared-module/vectorio/VectorShape.h"
 
 #include "py/runtime.h"
 #include "py/gc.h"
@@ -13,6 +14,10 @@
 #define VECTORIO_POLYGON_DEBUG(...) (void)0
 // #define VECTORIO_POLYGON_DEBUG(...) mp_printf(&mp_plat_print __VA_OPT__(,) __VA_ARGS__)
 
+// Most winding changes looked at along one line of a polygon, before get_spans gives up and
+// lets the caller test each pixel.
+#define VECTORIO_POLYGON_MAX_EVENTS (32)
+
 
 // Converts a list of points tuples to a flat list of ints for speedier internal use.
 // Also validates the points.
@@ -144,3 +149,118 @@ uint32_t common_hal_vectorio_polygon_get_pixel(void *obj, int16_t x, int16_t y)
     }
     return winding_number == 0 ? 0 : 1;
 }
+
+
+// Where the winding number changes by delta along a line.
+typedef struct {
+    int32_t pos;
+    int32_t delta;
+} winding_event_t;
+
+
+static inline int32_t floor_div(int32_t a, int32_t b) {
+    int32_t q = a / b;
+    if (a % b != 0 && (a < 0) != (b < 0)) {
+        --q;
+    }
+    return q;
+}
+
+
+// Gives exactly the pixels get_pixel would accept.  Each edge that crosses the line changes the
+//   winding number on one run of pixels along it, so the runs are collected as events, sorted,
+//   and swept to find where the winding number is nonzero.
+size_t common_hal_vectorio_polygon_get_spans(void *obj, bool column, int16_t line, int32_t *spans, size_t max_spans) {
+    vectorio_polygon_t *self = obj;
+
+    if (self->len == 0) {
+        return 0;
+    }
+
+    winding_event_t events[VECTORIO_POLYGON_MAX_EVENTS];
+    size_t event_count = 0;
+    int x1 = self->points_list[0];
+    int y1 = self->points_list[1];
+    for (size_t i=2; i <= self->len + 1; i += 2) {
+        int x2 = self->points_list[i % self->len];
+        int y2 = self->points_list[(i + 1) % self->len];
+        if (y1 != y2) {
+            // Wind up for edges going up and down for edges going down, on the same half-open
+            //   range of rows as get_pixel.
+            int32_t wind = y2 > y1 ? 1 : -1;
+            int32_t start;
+            int32_t end = INT32_MAX;
+            if (!column) {
+                // Row: the pixels to the right of the edge, strictly.
+                if (line < MIN(y1, y2) || line >= MAX(y1, y2)) {
+                    goto next_edge;
+                }
+                start = x1 + floor_div(wind * (line - y1) * (x2 - x1), wind * (y2 - y1)) + 1;
+            } else {
+                // Column: the rows of the edge where the column is strictly to its right.
+                int32_t d = wind * (x2 - x1);
+                int32_t k = wind * (line - x1) * (y2 - y1);
+                start = MIN(y1, y2);
+                end = MAX(y1, y2);
+                if (d == 0) {
+                    if (k <= 0) {
+                        goto next_edge;
+                    }
+                } else if (d > 0) {
+                    end = MIN(end, y1 - floor_div(-k, d));
+                } else {
+                    start = MAX(start, y1 + floor_div(k, d) + 1);
+                }
+                if (start >= end) {
+                    goto next_edge;
+                }
+            }
+            if (event_count + (end == INT32_MAX ? 1 : 2) > VECTORIO_POLYGON_MAX_EVENTS) {
+                return VECTORIO_SPANS_UNAVAILABLE;
+            }
+            events[event_count].pos = start;
+            events[event_count++].delta = wind;
+            if (end != INT32_MAX) {
+                events[event_count].pos = end;
+                events[event_count++].delta = -wind;
+            }
+        }
+    next_edge:
+        x1 = x2;
+        y1 = y2;
+    }
+
+    // Insertion sort; there are only a handful of events on a line.
+    for (size_t i = 1; i < event_count; ++i) {
+        winding_event_t event = events[i];
+        size_t j = i;
+        for (; j > 0 && events[j - 1].pos > event.pos; --j) {
+            events[j] = events[j - 1];
+        }
+        events[j] = event;
+    }
+
+    size_t span_count = 0;
+    int32_t winding_number = 0;
+    for (size_t i = 0; i < event_count;) {
+        int32_t pos = events[i].pos;
+        int32_t was = winding_number;
+        for (; i < event_count && events[i].pos == pos; ++i) {
+            winding_number += events[i].delta;
+        }
+        if (was == 0 && winding_number != 0) {
+            if (span_count == max_spans) {
+                return VECTORIO_SPANS_UNAVAILABLE;
+            }
+            spans[2 * span_count] = pos;
+        } else if (was != 0 && winding_number == 0) {
+            spans[2 * span_count + 1] = pos;
+            ++span_count;
+        }
+    }
+    if (winding_number != 0) {
+        spans[2 * span_count + 1] = INT32_MAX;
+        ++span_count;
+    }
+    return span_count;
+}
@@ -1,5 +1,6 @@
 #include "shared-bindings/vectorio/Rectangle.h"
 #include "shared-module/displayio/area.h"
+#include "shared-module/vectorio/VectorShape.h"
 
 #include "py/runtime.h"
 
@@ -19,6 +20,19 @@ uint32_t common_hal_vectorio_rectangle_get_pixel(void *obj, int16_t x, int16_t y
 }
 
 
+size_t common_hal_vectorio_rectangle_get_spans(void *obj, bool column, int16_t line, int32_t *spans, size_t max_spans) {
+    vectorio_rectangle_t *self = obj;
+    int32_t line_extent = column ? self->width : self->height;
+    if (line < 0 || line > line_extent) {
+        return 0;
+    }
+    // Same bounds as get_pixel: both edges are inclusive.
+    spans[0] = 0;
+    spans[1] = (column ? self->height : self->width) + 1;
+    return 1;
+}
+
+
 void common_hal_vectorio_rectangle_get_area(void *rectangle, displayio_area_t *out_area) {
     vectorio_rectangle_t *self = rectangle;
     out_area->x1 = -1;
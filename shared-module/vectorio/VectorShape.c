@@ -201,9 +201,38 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
     displayio_input_pixel_t input_pixel;
     displayio_output_pixel_t output_pixel;
 
+    // Shapes only ever produce 0 or 1, so unless the shader depends on where the pixel is
+    //   both colors can be worked out up front.
+    bool shade_each_pixel = MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_colorconverter_type);
+    displayio_output_pixel_t shaded_pixels[2];
+    for (uint32_t value = 0; value < 2 && !shade_each_pixel; ++value) {
+        shaded_pixels[value].opaque = true;
+        shaded_pixels[value].pixel = value;
+        if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_palette_type)) {
+            shaded_pixels[value].opaque = displayio_palette_get_color(self->pixel_shader, colorspace, value, &shaded_pixels[value].pixel);
+        }
+    }
+
+    // Each screen row is one line of the shape: a shape row, or a shape column when transposed.
+    bool transpose_xy = self->absolute_transform->transpose_xy;
+    int32_t spans[2 * VECTORIO_MAX_SPANS];
+
     uint32_t mask_start_px = line_dirty_offset_px;
     for (input_pixel.y = overlap.y1; input_pixel.y < overlap.y2; ++input_pixel.y) {
         mask_start_px += column_dirty_offset_px;
+        int16_t shape_line;
+        if (transpose_xy) {
+            shape_line = (input_pixel.y - self->absolute_transform->dy * self->x - self->absolute_transform->y) / self->absolute_transform->dy;
+        } else {
+            shape_line = (input_pixel.y - self->absolute_transform->dy * self->y) / self->absolute_transform->dy;
+        }
+#ifdef VECTORIO_PERF
+        uint64_t pre_spans = common_hal_time_monotonic_ns();
+#endif
+        size_t span_count = self->ishape.get_spans(self->ishape.shape, transpose_xy, shape_line, spans, VECTORIO_MAX_SPANS);
+#ifdef VECTORIO_PERF
+        pixel_time += common_hal_time_monotonic_ns() - pre_spans;
+#endif
         for (input_pixel.x = overlap.x1; input_pixel.x < overlap.x2; ++input_pixel.x) {
             // Check the mask first to see if the pixel has already been set.
             uint32_t pixel_index = mask_start_px + (input_pixel.x - overlap.x1);
@@ -214,36 +243,37 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
                 VECTORIO_SHAPE_PIXEL_DEBUG(" masked\n");
                 continue;
             }
-            output_pixel.pixel = 0;
-
-            // Get the target pixel based on the shape's coordinate space
-            int16_t pixel_to_get_x;
-            int16_t pixel_to_get_y;
-            if (self->absolute_transform->transpose_xy) {
-                pixel_to_get_x = (input_pixel.y - self->absolute_transform->dy * self->x - self->absolute_transform->y) / self->absolute_transform->dy;
-                pixel_to_get_y = (input_pixel.x - self->absolute_transform->dx * self->y - self->absolute_transform->x) / self->absolute_transform->dx;
+            // Position along the shape line, in the shape's coordinate space
+            int16_t shape_position;
+            if (transpose_xy) {
+                shape_position = (input_pixel.x - self->absolute_transform->dx * self->y - self->absolute_transform->x) / self->absolute_transform->dx;
             } else {
-                pixel_to_get_x = (input_pixel.x - self->absolute_transform->dx * self->x) / self->absolute_transform->dx;
-                pixel_to_get_y = (input_pixel.y - self->absolute_transform->dy * self->y) / self->absolute_transform->dy;
+                shape_position = (input_pixel.x - self->absolute_transform->dx * self->x) / self->absolute_transform->dx;
+            }
+            VECTORIO_SHAPE_PIXEL_DEBUG(" get_pixel %p (%3d, %3d) -> line %3d at %3d", self->ishape.shape, input_pixel.x, input_pixel.y, shape_line, shape_position);
+            if (span_count == VECTORIO_SPANS_UNAVAILABLE) {
+                if (transpose_xy) {
+                    input_pixel.pixel = self->ishape.get_pixel(self->ishape.shape, shape_line, shape_position);
+                } else {
+                    input_pixel.pixel = self->ishape.get_pixel(self->ishape.shape, shape_position, shape_line);
+                }
+            } else {
+                input_pixel.pixel = 0;
+                for (size_t i = 0; i < span_count; ++i) {
+                    if (shape_position >= spans[2 * i] && shape_position < spans[2 * i + 1]) {
+                        input_pixel.pixel = 1;
+                        break;
+                    }
+                }
             }
-            VECTORIO_SHAPE_PIXEL_DEBUG(" get_pixel %p (%3d, %3d) -> ( %3d, %3d )", self->ishape.shape, input_pixel.x, input_pixel.y, pixel_to_get_x, pixel_to_get_y);
-#ifdef VECTORIO_PERF
-            uint64_t pre_pixel = common_hal_time_monotonic_ns();
-#endif
-            input_pixel.pixel = self->ishape.get_pixel(self->ishape.shape, pixel_to_get_x, pixel_to_get_y);
-#ifdef VECTORIO_PERF
-            uint64_t post_pixel = common_hal_time_monotonic_ns();
-            pixel_time += post_pixel - pre_pixel;
-#endif
             VECTORIO_SHAPE_PIXEL_DEBUG(" -> %d", input_pixel.pixel);
 
-            output_pixel.opaque = true;
-            if (self->pixel_shader == mp_const_none) {
-                output_pixel.pixel = input_pixel.pixel;
-            } else if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_palette_type)) {
-                output_pixel.opaque = displayio_palette_get_color(self->pixel_shader, colorspace, input_pixel.pixel, &output_pixel.pixel);
-            } else if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_colorconverter_type)) {
+            if (shade_each_pixel) {
+                output_pixel.pixel = 0;
+                output_pixel.opaque = true;
                 displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
+            } else {
+                output_pixel = shaded_pixels[input_pixel.pixel];
             }
             if (!output_pixel.opaque) {
                 VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel; input area is not fully covered)\n");
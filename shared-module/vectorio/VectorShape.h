@@ -11,6 +11,15 @@
 
 typedef void get_area_function(mp_obj_t shape, displayio_area_t *out_area);
 typedef uint32_t get_pixel_function(mp_obj_t shape, int16_t x, int16_t y);
+// Fills spans with [start, end) pairs giving the covered pixels along one line of the shape:
+//   row `line` when column is false, or column `line` when it is true.  Pairs are in ascending
+//   order.  Returns the number of pairs, or VECTORIO_SPANS_UNAVAILABLE if the line doesn't fit
+//   in max_spans, in which case the caller falls back to get_pixel.
+typedef size_t get_spans_function(mp_obj_t shape, bool column, int16_t line, int32_t *spans, size_t max_spans);
+
+#define VECTORIO_SPANS_UNAVAILABLE ((size_t)-1)
+// Most spans looked up for a single line of a shape.
+#define VECTORIO_MAX_SPANS (8)
 
 // This struct binds a shape's common Shape support functions (its vector shape interface)
 //   to its instance pointer.  We only check at construction time what the type of the
@@ -22,6 +31,7 @@ typedef struct {
     mp_obj_t shape;
     get_area_function *get_area;
     get_pixel_function *get_pixel;
+    get_spans_function *get_spans;
 } vectorio_ishape_t;
 
 typedef struct {
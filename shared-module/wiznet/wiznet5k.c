@@ -52,6 +52,8 @@
 
 #include "shared-module/wiznet/wiznet5k.h"
 
+#include "supervisor/shared/tick.h"
+
 STATIC wiznet5k_obj_t wiznet5k_obj;
 
 STATIC void wiz_cris_enter(void) {
@@ -93,10 +95,39 @@ int wiznet5k_gethostbyname(mp_obj_t nic, const char *name, mp_uint_t len, uint8_
     }
 }
 
+STATIC void wiznet5k_set_timeout(uint8_t sn, mp_uint_t timeout_ms) {
+    // Only a blocking socket is left to the driver to wait on; timeouts are
+    // implemented here on top of the driver's non-blocking mode.
+    uint8_t arg = timeout_ms == (mp_uint_t)-1 ? SOCK_IO_BLOCK : SOCK_IO_NONBLOCK;
+    WIZCHIP_EXPORT(ctlsocket)(sn, CS_SET_IOMODE, &arg);
+    wiznet5k_obj.socket_timeout[sn] = timeout_ms;
+}
+
+// Called when an operation on a non-blocking socket returned SOCK_BUSY.
+// Returns true if the operation should be retried, or false with *_errno
+// set if the socket doesn't wait or its timeout has expired.
+STATIC bool wiznet5k_socket_wait(uint8_t sn, uint64_t start, int *_errno) {
+    mp_uint_t timeout_ms = wiznet5k_obj.socket_timeout[sn];
+    if (timeout_ms == 0) {
+        *_errno = MP_EAGAIN;
+        return false;
+    }
+    if (timeout_ms != (mp_uint_t)-1 && supervisor_ticks_ms64() - start >= timeout_ms) {
+        *_errno = MP_ETIMEDOUT;
+        return false;
+    }
+    mp_hal_delay_ms(1);
+    return true;
+}
+
 int get_available_socket(wiznet5k_obj_t *wiz) {
     for (uint8_t sn = 0; sn < _WIZCHIP_SOCK_NUM_; sn++) {
         if ((wiz->socket_used & (1 << sn)) == 0) {
             wiz->socket_used |= (1 << sn);
+            wiz->socket_listening &= ~(1 << sn);
+            wiz->socket_rx_valid &= ~(1 << sn);
+            // the driver keeps the IO mode across close, so reset it
+            wiznet5k_set_timeout(sn, -1);
             return sn;
         }
     }
@@ -139,6 +170,8 @@ void wiznet5k_socket_close(mod_network_socket_obj_t *socket) {
     uint8_t sn = (uint8_t)socket->u_param.fileno;
     if (sn < _WIZCHIP_SOCK_NUM_) {
         wiznet5k_obj.socket_used &= ~(1 << sn);
+        wiznet5k_obj.socket_listening &= ~(1 << sn);
+        wiznet5k_obj.socket_rx_valid &= ~(1 << sn);
         WIZCHIP_EXPORT(close)(sn);
     }
 }
@@ -166,16 +199,24 @@ int wiznet5k_socket_listen(mod_network_socket_obj_t *socket, mp_int_t backlog, i
         *_errno = -ret;
         return -1;
     }
+    wiznet5k_obj.socket_listening |= 1 << socket->u_param.fileno;
     return 0;
 }
 
 int wiznet5k_socket_accept(mod_network_socket_obj_t *socket, mod_network_socket_obj_t *socket2, byte *ip, mp_uint_t *port, int *_errno) {
+    uint64_t start = supervisor_ticks_ms64();
     for (;;) {
-        int sr = getSn_SR((uint8_t)socket->u_param.fileno);
+        uint8_t sn = (uint8_t)socket->u_param.fileno;
+        int sr = getSn_SR(sn);
         if (sr == SOCK_ESTABLISHED) {
             socket2->u_param = socket->u_param;
-            getSn_DIPR((uint8_t)socket2->u_param.fileno, ip);
-            *port = getSn_PORT(socket2->u_param.fileno);
+            getSn_DIPR(sn, ip);
+            *port = getSn_PORT(sn);
+            mp_uint_t timeout_ms = wiznet5k_obj.socket_timeout[sn];
+            wiznet5k_obj.socket_listening &= ~(1 << sn);
+            wiznet5k_obj.socket_rx_valid &= ~(1 << sn);
+            // like a POSIX accept, the new connection starts out blocking
+            wiznet5k_set_timeout(sn, -1);
 
             // WIZnet turns the listening socket into the client socket, so we
             // need to re-bind and re-listen on another socket for the server.
@@ -189,6 +230,8 @@ int wiznet5k_socket_accept(mod_network_socket_obj_t *socket, mod_network_socket_
                 //printf("(bad rebind %d)\n", _errno2);
             } else if (wiznet5k_socket_listen(socket, 0, &_errno2) != 0) {
                 //printf("(bad relisten %d)\n", _errno2);
+            } else {
+                wiznet5k_set_timeout((uint8_t)socket->u_param.fileno, timeout_ms);
             }
 
             return 0;
@@ -198,7 +241,9 @@ int wiznet5k_socket_accept(mod_network_socket_obj_t *socket, mod_network_socket_
             *_errno = MP_ENOTCONN; // ??
             return -1;
         }
-        mp_hal_delay_ms(1);
+        if (!wiznet5k_socket_wait(sn, start, _errno)) {
+            return -1;
+        }
     }
 }
 
@@ -213,8 +258,9 @@ int wiznet5k_socket_connect(mod_network_socket_obj_t *socket, byte *ip, mp_uint_
     }
 
     // now connect
+    uint8_t sn = (uint8_t)socket->u_param.fileno;
     MP_THREAD_GIL_EXIT();
-    mp_int_t ret = WIZCHIP_EXPORT(connect)(socket->u_param.fileno, ip, port);
+    mp_int_t ret = WIZCHIP_EXPORT(connect)(sn, ip, port);
     MP_THREAD_GIL_ENTER();
 
     if (ret < 0) {
@@ -223,36 +269,83 @@ int wiznet5k_socket_connect(mod_network_socket_obj_t *socket, byte *ip, mp_uint_
         return -1;
     }
 
+    if (ret == SOCK_BUSY) {
+        // non-blocking mode: the SYN has been sent, wait for the handshake
+        uint64_t start = supervisor_ticks_ms64();
+        for (;;) {
+            uint8_t sr = getSn_SR(sn);
+            if (sr == SOCK_ESTABLISHED) {
+                break;
+            }
+            if (sr == SOCK_CLOSED || (getSn_IR(sn) & Sn_IR_TIMEOUT)) {
+                wiznet5k_socket_close(socket);
+                *_errno = sr == SOCK_CLOSED ? MP_ECONNREFUSED : MP_ETIMEDOUT;
+                return -1;
+            }
+            if (wiznet5k_obj.socket_timeout[sn] == 0) {
+                // completion is signalled by the socket polling writable
+                *_errno = MP_EINPROGRESS;
+                return -1;
+            }
+            if (!wiznet5k_socket_wait(sn, start, _errno)) {
+                return -1;
+            }
+        }
+    }
+
     // success
     return 0;
 }
 
 mp_uint_t wiznet5k_socket_send(mod_network_socket_obj_t *socket, const byte *buf, mp_uint_t len, int *_errno) {
-    MP_THREAD_GIL_EXIT();
-    mp_int_t ret = WIZCHIP_EXPORT(send)(socket->u_param.fileno, (byte*)buf, len);
-    MP_THREAD_GIL_ENTER();
+    uint8_t sn = (uint8_t)socket->u_param.fileno;
+    uint64_t start = supervisor_ticks_ms64();
+    for (;;) {
+        MP_THREAD_GIL_EXIT();
+        mp_int_t ret = WIZCHIP_EXPORT(send)(sn, (byte*)buf, len);
+        MP_THREAD_GIL_ENTER();
 
-    // TODO convert Wiz errno's to POSIX ones
-    if (ret < 0) {
-        wiznet5k_socket_close(socket);
-        *_errno = -ret;
-        return -1;
+        // TODO convert Wiz errno's to POSIX ones
+        if (ret < 0) {
+            wiznet5k_socket_close(socket);
+            *_errno = -ret;
+            return -1;
+        }
+        // SOCK_BUSY means the TX buffer is full or the previous send hasn't
+        // completed; the driver returns it even in blocking mode for the latter.
+        if (ret != SOCK_BUSY) {
+            return ret;
+        }
+        if (!wiznet5k_socket_wait(sn, start, _errno)) {
+            return -1;
+        }
     }
-    return ret;
 }
 
 mp_uint_t wiznet5k_socket_recv(mod_network_socket_obj_t *socket, byte *buf, mp_uint_t len, int *_errno) {
-    MP_THREAD_GIL_EXIT();
-    mp_int_t ret = WIZCHIP_EXPORT(recv)(socket->u_param.fileno, buf, len);
-    MP_THREAD_GIL_ENTER();
+    uint8_t sn = (uint8_t)socket->u_param.fileno;
+    uint64_t start = supervisor_ticks_ms64();
+    for (;;) {
+        MP_THREAD_GIL_EXIT();
+        mp_int_t ret = WIZCHIP_EXPORT(recv)(sn, buf, len);
+        MP_THREAD_GIL_ENTER();
+        wiznet5k_obj.socket_rx_valid &= ~(1 << sn);
 
-    // TODO convert Wiz errno's to POSIX ones
-    if (ret < 0) {
-        wiznet5k_socket_close(socket);
-        *_errno = -ret;
-        return -1;
+        // TODO convert Wiz errno's to POSIX ones
+        if (ret < 0) {
+            wiznet5k_socket_close(socket);
+            *_errno = -ret;
+            return -1;
+        }
+        // SOCK_BUSY is also 0, so tell it apart from an orderly shutdown, after
+        // which the driver has closed the socket.
+        if (ret != SOCK_BUSY || getSn_SR(sn) == SOCK_CLOSED) {
+            return ret;
+        }
+        if (!wiznet5k_socket_wait(sn, start, _errno)) {
+            return -1;
+        }
     }
-    return ret;
 }
 
 mp_uint_t wiznet5k_socket_sendto(mod_network_socket_obj_t *socket, const byte *buf, mp_uint_t len, byte *ip, mp_uint_t port, int *_errno) {
@@ -263,30 +356,49 @@ mp_uint_t wiznet5k_socket_sendto(mod_network_socket_obj_t *socket, const byte *b
         }
     }
 
-    MP_THREAD_GIL_EXIT();
-    mp_int_t ret = WIZCHIP_EXPORT(sendto)(socket->u_param.fileno, (byte*)buf, len, ip, port);
-    MP_THREAD_GIL_ENTER();
+    uint8_t sn = (uint8_t)socket->u_param.fileno;
+    uint64_t start = supervisor_ticks_ms64();
+    for (;;) {
+        MP_THREAD_GIL_EXIT();
+        mp_int_t ret = WIZCHIP_EXPORT(sendto)(sn, (byte*)buf, len, ip, port);
+        MP_THREAD_GIL_ENTER();
 
-    if (ret < 0) {
-        wiznet5k_socket_close(socket);
-        *_errno = -ret;
-        return -1;
+        if (ret < 0) {
+            wiznet5k_socket_close(socket);
+            *_errno = -ret;
+            return -1;
+        }
+        if (ret != SOCK_BUSY) {
+            return ret;
+        }
+        if (!wiznet5k_socket_wait(sn, start, _errno)) {
+            return -1;
+        }
     }
-    return ret;
 }
 
 mp_uint_t wiznet5k_socket_recvfrom(mod_network_socket_obj_t *socket, byte *buf, mp_uint_t len, byte *ip, mp_uint_t *port, int *_errno) {
-    uint16_t port2;
-    MP_THREAD_GIL_EXIT();
-    mp_int_t ret = WIZCHIP_EXPORT(recvfrom)(socket->u_param.fileno, buf, len, ip, &port2);
-    MP_THREAD_GIL_ENTER();
-    *port = port2;
-    if (ret < 0) {
-        wiznet5k_socket_close(socket);
-        *_errno = -ret;
-        return -1;
+    uint8_t sn = (uint8_t)socket->u_param.fileno;
+    uint64_t start = supervisor_ticks_ms64();
+    for (;;) {
+        uint16_t port2;
+        MP_THREAD_GIL_EXIT();
+        mp_int_t ret = WIZCHIP_EXPORT(recvfrom)(sn, buf, len, ip, &port2);
+        MP_THREAD_GIL_ENTER();
+        wiznet5k_obj.socket_rx_valid &= ~(1 << sn);
+        if (ret < 0) {
+            wiznet5k_socket_close(socket);
+            *_errno = -ret;
+            return -1;
+        }
+        if (ret != SOCK_BUSY) {
+            *port = port2;
+            return ret;
+        }
+        if (!wiznet5k_socket_wait(sn, start, _errno)) {
+            return -1;
+        }
     }
-    return ret;
 }
 
 int wiznet5k_socket_setsockopt(mod_network_socket_obj_t *socket, mp_uint_t level, mp_uint_t opt, const void *optval, mp_uint_t optlen, int *_errno) {
@@ -296,27 +408,57 @@ int wiznet5k_socket_setsockopt(mod_network_socket_obj_t *socket, mp_uint_t level
 }
 
 int wiznet5k_socket_settimeout(mod_network_socket_obj_t *socket, mp_uint_t timeout_ms, int *_errno) {
-    // TODO
-    *_errno = MP_EINVAL;
-    return -1;
+    wiznet5k_set_timeout((uint8_t)socket->u_param.fileno, timeout_ms);
+    return 0;
+}
 
-    /*
-    if (timeout_ms == 0) {
-        // set non-blocking mode
-        uint8_t arg = SOCK_IO_NONBLOCK;
-        WIZCHIP_EXPORT(ctlsocket)(socket->u_param.fileno, CS_SET_IOMODE, &arg);
+STATIC bool wiznet5k_socket_rx_pending(uint8_t sn) {
+    // New data or a change of connection state raises an interrupt, so the
+    // size of the RX buffer only needs reading after one of those (or after
+    // data has been read from it).  This keeps polling many idle sockets
+    // down to a couple of single byte register reads each.
+    uint8_t ir = getSn_IR(sn) & (Sn_IR_CON | Sn_IR_DISCON | Sn_IR_RECV);
+    if (ir) {
+        // SENDOK and TIMEOUT are left set for the driver, which waits on them
+        setSn_IR(sn, ir);
+        wiznet5k_obj.socket_rx_valid &= ~(1 << sn);
+    }
+    if (!(wiznet5k_obj.socket_rx_valid & (1 << sn))) {
+        if (getSn_RX_RSR(sn) != 0) {
+            wiznet5k_obj.socket_rx_pending |= 1 << sn;
+        } else {
+            wiznet5k_obj.socket_rx_pending &= ~(1 << sn);
+        }
+        wiznet5k_obj.socket_rx_valid |= 1 << sn;
     }
-    */
+    return wiznet5k_obj.socket_rx_pending & (1 << sn);
 }
 
 int wiznet5k_socket_ioctl(mod_network_socket_obj_t *socket, mp_uint_t request, mp_uint_t arg, int *_errno) {
     if (request == MP_STREAM_POLL) {
+        uint8_t sn = (uint8_t)socket->u_param.fileno;
+        uint8_t sr = getSn_SR(sn);
         int ret = 0;
-        if (arg & MP_STREAM_POLL_RD && getSn_RX_RSR(socket->u_param.fileno) != 0) {
-            ret |= MP_STREAM_POLL_RD;
+        if (sr == SOCK_CLOSED) {
+            // recv would return straight away with EOF or an error
+            return (arg & MP_STREAM_POLL_RD) | MP_STREAM_POLL_HUP;
+        }
+        if (arg & MP_STREAM_POLL_RD) {
+            if (sr == SOCK_CLOSE_WAIT || wiznet5k_socket_rx_pending(sn)
+                || (sr == SOCK_ESTABLISHED && (wiznet5k_obj.socket_listening & (1 << sn)))) {
+                ret |= MP_STREAM_POLL_RD;
+            }
+        }
+        if (arg & MP_STREAM_POLL_WR) {
+            // a pending non-blocking connect completes in SOCK_ESTABLISHED
+            if ((sr == SOCK_ESTABLISHED || sr == SOCK_CLOSE_WAIT || sr == SOCK_UDP)
+                && !(wiznet5k_obj.socket_listening & (1 << sn))
+                && getSn_TX_FSR(sn) != 0) {
+                ret |= MP_STREAM_POLL_WR;
+            }
         }
-        if (arg & MP_STREAM_POLL_WR && getSn_TX_FSR(socket->u_param.fileno) != 0) {
-            ret |= MP_STREAM_POLL_WR;
+        if (getSn_IR(sn) & Sn_IR_TIMEOUT) {
+            ret |= MP_STREAM_POLL_ERR;
         }
         return ret;
     } else {
@@ -386,6 +528,8 @@ mp_obj_t wiznet5k_create(busio_spi_obj_t *spi_in, const mcu_pin_obj_t *cs_in, co
     wiznet5k_obj.cris_state = 0;
     wiznet5k_obj.spi = spi_in;
     wiznet5k_obj.socket_used = 0;
+    wiznet5k_obj.socket_listening = 0;
+    wiznet5k_obj.socket_rx_valid = 0;
     wiznet5k_obj.dhcp_socket = -1;
 
     /*!< SPI configuration */
@@ -39,7 +39,13 @@ typedef struct _wiznet5k_obj_t {
     digitalio_digitalinout_obj_t cs;
     digitalio_digitalinout_obj_t rst;
     uint8_t socket_used;
+    uint8_t socket_listening;
+    // Sockets whose RX state is cached in socket_rx_pending; a bit is
+    // cleared when the chip raises an interrupt for it or data is read.
+    uint8_t socket_rx_valid;
+    uint8_t socket_rx_pending;
     int8_t dhcp_socket; // -1 for DHCP not in use
+    mp_uint_t socket_timeout[_WIZCHIP_SOCK_NUM_]; // ms, -1 to block forever
 } wiznet5k_obj_t;
 
 int wiznet5k_gethostbyname(mp_obj_t nic, const char *name, mp_uint_t len, uint8_t *out_ip);
@@ -35,6 +35,10 @@ extern volatile bool filesystem_flush_requested;
 
 void filesystem_background(void);
 void filesystem_tick(void);
+// Ticks until filesystem_tick next requests a flush, or 0 if flushing is off.
+uint32_t filesystem_ticks_until_flush(void);
+// Restarts the flush interval so caches are only flushed once writes pause.
+void filesystem_delay_flush(void);
 void filesystem_init(bool create_allowed, bool force_create);
 void filesystem_flush(void);
 bool filesystem_present(void);
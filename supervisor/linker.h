@@ -39,4 +39,13 @@
 #define PLACE_IN_ITCM(name) name
 #endif
 
+// Hot functions outside the core of the VM: the call path, attribute and
+// global lookup, iteration and the garbage collector's mark and sweep. Ports
+// that have room for them in ITCM set CIRCUITPY_ITCM_HOT_PATHS.
+#if defined(CIRCUITPY_ITCM_HOT_PATHS) && CIRCUITPY_ITCM_HOT_PATHS
+#define PLACE_IN_ITCM_HOT(name) PLACE_IN_ITCM(name)
+#else
+#define PLACE_IN_ITCM_HOT(name) name
+#endif
+
 #endif  // MICROPY_INCLUDED_SUPERVISOR_LINKER_H
@@ -39,18 +39,27 @@ typedef struct {
     uint32_t length; // in bytes
 } supervisor_allocation;
 
-
+// Called after a movable allocation's contents have been copied to allocation->ptr so that its
+// owner can update pointers into it. old_ptr is where it used to be.
+typedef void (*supervisor_move_callback_t)(supervisor_allocation* allocation, uint32_t* old_ptr);
 
 void memory_init(void);
 void free_memory(supervisor_allocation* allocation);
 supervisor_allocation* allocation_from_ptr(void *ptr);
+// Moves movable allocations out of the way first so that the remaining memory is in one piece.
 supervisor_allocation* allocate_remaining_memory(void);
 
-// Allocate a piece of a given length in bytes. If high_address is true then it should be allocated
-// at a lower address from the top of the stack. Otherwise, addresses will increase starting after
-// statically allocated memory.
+// Allocate a piece of a given length in bytes. The smallest hole left by a freed allocation that
+// fits is used first. Otherwise, if high_address is true then it should be allocated at a lower
+// address from the top of the stack, and if not, addresses will increase starting after statically
+// allocated memory.
 supervisor_allocation* allocate_memory(uint32_t length, bool high_address);
 
+// Like allocate_memory but allocate_remaining_memory may move it while the VM heap isn't allocated.
+// move_callback is called after each move.
+supervisor_allocation* allocate_movable_memory(uint32_t length, bool high_address,
+    supervisor_move_callback_t move_callback);
+
 static inline uint16_t align32_size(uint16_t size) {
     if (size % 4 != 0) {
         return (size & 0xfffc) + 0x4;
@@ -69,6 +69,12 @@ uint32_t *port_heap_get_bottom(void);
 // Get heap top address
 uint32_t *port_heap_get_top(void);
 
+#if MICROPY_GC_SPLIT_HEAP
+// Get the bounds of more RAM to add to the Python heap, such as external PSRAM.
+// Returns false if there is none.
+bool port_heap_get_extra(uint32_t **bottom, uint32_t **top);
+#endif
+
 // Save and retrieve a word from memory that is preserved over reset. Used for safe mode.
 void port_set_saved_word(uint32_t);
 uint32_t port_get_saved_word(void);
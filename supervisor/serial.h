@@ -47,4 +47,12 @@ char serial_read(void);
 bool serial_bytes_available(void);
 bool serial_connected(void);
 
+#ifdef USB_AVAILABLE
+// When blocking is off, USB CDC output that doesn't fit in the transmit
+// buffer is dropped and counted rather than waiting for the host to read it.
+void serial_set_write_blocking(bool blocking);
+bool serial_get_write_blocking(void);
+uint32_t serial_get_bytes_dropped(void);
+#endif
+
 #endif  // MICROPY_INCLUDED_SUPERVISOR_SERIAL_H
@@ -44,11 +44,15 @@ inline void autoreload_tick() {
         !autoreload_suspended && !reload_requested) {
         mp_raise_reload_exception();
         reload_requested = true;
-        supervisor_disable_tick();
+        supervisor_disable_tick_deadline();
     }
     autoreload_delay_ms--;
 }
 
+uint32_t autoreload_ticks_remaining(void) {
+    return autoreload_delay_ms;
+}
+
 void autoreload_enable() {
     autoreload_enabled = true;
     reload_requested = false;
@@ -75,7 +79,7 @@ void autoreload_start() {
     // our current state so that we only turn ticks on once. Multiple starts
     // can occur before we reload and then turn ticks off.
     if (autoreload_delay_ms == 0) {
-        supervisor_enable_tick();
+        supervisor_enable_tick_deadline();
     }
     autoreload_delay_ms = CIRCUITPY_AUTORELOAD_DELAY_MS;
 }
@@ -28,10 +28,13 @@
 #define MICROPY_INCLUDED_SUPERVISOR_AUTORELOAD_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 extern volatile bool reload_requested;
 
 void autoreload_tick(void);
+// Ticks until a pending autoreload happens, or 0 if none is pending.
+uint32_t autoreload_ticks_remaining(void);
 
 void autoreload_start(void);
 void autoreload_stop(void);
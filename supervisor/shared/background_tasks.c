@@ -0,0 +1,126 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "supervisor/shared/background_tasks.h"
+
+#include "py/mpconfig.h"
+#include "supervisor/linker.h"
+#include "supervisor/shared/perf.h"
+#include "supervisor/port.h"
+#include "supervisor/shared/stack.h"
+
+STATIC background_task_t *tasks = NULL;
+STATIC bool running_background_tasks = false;
+
+// Time in 1/32768 second units.
+STATIC uint64_t subticks_now(void) {
+    uint8_t subticks;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    return ticks * 32 + subticks;
+}
+
+void supervisor_background_task_register(background_task_t *task) {
+    for (background_task_t *t = tasks; t != NULL; t = t->next) {
+        if (t == task) {
+            return;
+        }
+    }
+    background_task_t **link = &tasks;
+    while (*link != NULL && (*link)->priority <= task->priority) {
+        link = &(*link)->next;
+    }
+    task->last_run = port_get_raw_ticks(NULL);
+    task->next = *link;
+    *link = task;
+}
+
+void PLACE_IN_ITCM(supervisor_background_tasks_run)(void) {
+    // Don't call ourselves recursively.
+    if (running_background_tasks) {
+        return;
+    }
+    assert_heap_ok();
+    running_background_tasks = true;
+    PERF_START();
+
+    // The budget is compared in subticks; 32768 / 1000000 == 512 / 15625.
+    const uint64_t budget = (uint64_t)CIRCUITPY_BACKGROUND_TASKS_BUDGET_US * 512 / 15625;
+    uint64_t start = subticks_now();
+    bool over_budget = false;
+    for (background_task_t *task = tasks; task != NULL; task = task->next) {
+        if (over_budget && port_get_raw_ticks(NULL) - task->last_run < task->deadline) {
+            continue;
+        }
+        #if CIRCUITPY_PERF_COUNTERS
+        uint32_t task_start = port_get_cycle_count();
+        task->fun();
+        perf_record(task->priority, task_start);
+        #else
+        task->fun();
+        #endif
+
+        uint64_t now = subticks_now();
+        uint64_t gap = now / 32 - task->last_run;
+        if (gap > task->worst_latency) {
+            task->worst_latency = gap > UINT32_MAX ? UINT32_MAX : gap;
+        }
+        task->last_run = now / 32;
+        if (now - start >= budget) {
+            over_budget = true;
+        }
+    }
+
+    PERF_END(PERF_COUNTER_BACKGROUND);
+    running_background_tasks = false;
+    assert_heap_ok();
+}
+
+bool supervisor_background_tasks_running(void) {
+    return running_background_tasks;
+}
+
+void supervisor_background_tasks_reset(void) {
+    running_background_tasks = false;
+    uint64_t now = port_get_raw_ticks(NULL);
+    for (background_task_t *task = tasks; task != NULL; task = task->next) {
+        task->last_run = now;
+        task->worst_latency = 0;
+    }
+}
+
+bool supervisor_background_task_ok(const background_task_t *task) {
+    uint32_t limit = task->max_latency ? task->max_latency : BACKGROUND_TASK_DEFAULT_MAX_LATENCY;
+    return port_get_raw_ticks(NULL) - task->last_run < limit;
+}
+
+bool supervisor_background_tasks_ok(void) {
+    for (background_task_t *task = tasks; task != NULL; task = task->next) {
+        if (!supervisor_background_task_ok(task)) {
+            return false;
+        }
+    }
+    return true;
+}
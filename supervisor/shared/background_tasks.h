@@ -0,0 +1,99 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SUPERVISOR_SHARED_BACKGROUND_TASKS_H
+#define MICROPY_INCLUDED_SUPERVISOR_SHARED_BACKGROUND_TASKS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Lower numbers run first in each background pass.
+#define BACKGROUND_TASK_PRIORITY_AUDIO      (0)
+#define BACKGROUND_TASK_PRIORITY_USB        (1)
+#define BACKGROUND_TASK_PRIORITY_I2CSLAVE   (2)
+#define BACKGROUND_TASK_PRIORITY_BLE        (3)
+#define BACKGROUND_TASK_PRIORITY_NETWORK    (4)
+#define BACKGROUND_TASK_PRIORITY_FILESYSTEM (5)
+#define BACKGROUND_TASK_PRIORITY_DISPLAY    (6)
+#define BACKGROUND_TASK_PRIORITY_TOUCH      (7)
+#define BACKGROUND_TASK_PRIORITY_PROFILER   (8)
+#define BACKGROUND_TASK_PRIORITY_COUNT      (9)
+
+// A task that hasn't run for this many ticks makes background_tasks_ok() fail
+// unless the task gives its own limit.
+#define BACKGROUND_TASK_DEFAULT_MAX_LATENCY (1024)
+
+typedef struct _background_task_t {
+    void (*fun)(void);
+    struct _background_task_t *next;
+    // Raw tick at which the task last finished.
+    uint64_t last_run;
+    // Longest gap between two runs seen since the last reset, in ticks.
+    uint32_t worst_latency;
+    // Once the time budget for a pass is used up, the task is only run if it
+    // hasn't run for at least this many ticks.
+    uint16_t deadline;
+    // Gap, in ticks, after which the task counts as starved. 0 means
+    // BACKGROUND_TASK_DEFAULT_MAX_LATENCY.
+    uint16_t max_latency;
+    uint8_t priority;
+} background_task_t;
+
+#define BACKGROUND_TASK(f, prio, dl) { .fun = (f), .priority = (prio), .deadline = (dl) }
+
+/** @brief Add a task to the background pass
+ *
+ * The task must be statically allocated. Tasks are kept in priority order and
+ * a task with the same priority as an existing one runs after it. Registering
+ * a task that is already registered does nothing.
+ */
+void supervisor_background_task_register(background_task_t *task);
+
+/** @brief Run one background pass
+ *
+ * Every task runs in priority order until CIRCUITPY_BACKGROUND_TASKS_BUDGET_US
+ * has been spent. After that only the tasks that have reached their deadline
+ * run, so a slow task delays the lower priority work rather than the higher
+ * priority work. Recursive calls return immediately.
+ */
+void supervisor_background_tasks_run(void);
+
+/** @brief Whether a background pass is in progress */
+bool supervisor_background_tasks_running(void);
+
+/** @brief Clear the recursion guard and the latency statistics */
+void supervisor_background_tasks_reset(void);
+
+/** @brief Whether the task has run within its latency limit */
+bool supervisor_background_task_ok(const background_task_t *task);
+
+/** @brief Whether every registered task has run within its latency limit
+ *
+ * This is safe to call from an interrupt handler.
+ */
+bool supervisor_background_tasks_ok(void);
+
+#endif  // MICROPY_INCLUDED_SUPERVISOR_SHARED_BACKGROUND_TASKS_H
@@ -33,6 +33,8 @@
 #include "shared-bindings/displayio/Palette.h"
 #include "shared-bindings/displayio/TileGrid.h"
 #include "supervisor/memory.h"
+#include "supervisor/serial.h"
+#include "supervisor/shared/tick.h"
 
 #if CIRCUITPY_RGBMATRIX
 #include "shared-module/displayio/__init__.h"
@@ -44,6 +46,18 @@ extern displayio_group_t circuitpython_splash;
 
 static supervisor_allocation* tilegrid_tiles = NULL;
 
+static char pending_text[CIRCUITPY_TERMINAL_BUFFER_SIZE];
+static uint32_t pending_length = 0;
+static uint32_t last_render_ms = 0;
+static bool terminal_while_serial_connected = true;
+
+static void move_tilegrid_tiles(supervisor_allocation* allocation, uint32_t* old_ptr) {
+    displayio_tilegrid_t* grid = &supervisor_terminal_text_grid;
+    if (grid->tiles == (uint8_t*) old_ptr) {
+        grid->tiles = (uint8_t*) allocation->ptr;
+    }
+}
+
 void supervisor_start_terminal(uint16_t width_px, uint16_t height_px) {
     displayio_tilegrid_t* grid = &supervisor_terminal_text_grid;
     uint16_t width_in_tiles = (width_px - blinka_bitmap.width) / grid->tile_width;
@@ -63,7 +77,7 @@ void supervisor_start_terminal(uint16_t width_px, uint16_t height_px) {
     uint16_t total_tiles = width_in_tiles * height_in_tiles;
 
     // First try to allocate outside the heap. This will fail when the VM is running.
-    tilegrid_tiles = allocate_memory(align32_size(total_tiles), false);
+    tilegrid_tiles = allocate_movable_memory(align32_size(total_tiles), false, move_tilegrid_tiles);
     uint8_t* tiles;
     if (tilegrid_tiles == NULL) {
         tiles = m_malloc(total_tiles, true);
@@ -91,6 +105,7 @@ void supervisor_start_terminal(uint16_t width_px, uint16_t height_px) {
 }
 
 void supervisor_stop_terminal(void) {
+    pending_length = 0;
     if (tilegrid_tiles != NULL) {
         free_memory(tilegrid_tiles);
         tilegrid_tiles = NULL;
@@ -99,6 +114,49 @@ void supervisor_stop_terminal(void) {
     }
 }
 
+static void render_terminal(const char* text, uint32_t length) {
+    int errcode;
+    common_hal_terminalio_terminal_write(&supervisor_terminal, (const uint8_t*) text, length, &errcode);
+    last_render_ms = supervisor_ticks_ms32();
+}
+
+void supervisor_terminal_flush(void) {
+    if (pending_length > 0) {
+        render_terminal(pending_text, pending_length);
+        pending_length = 0;
+    }
+}
+
+void supervisor_terminal_write(const char* text, uint32_t length) {
+    if (!terminal_while_serial_connected && serial_connected()) {
+        return;
+    }
+    if (pending_length + length > sizeof(pending_text)) {
+        supervisor_terminal_flush();
+        if (length > sizeof(pending_text)) {
+            render_terminal(text, length);
+            return;
+        }
+    }
+    memcpy(pending_text + pending_length, text, length);
+    pending_length += length;
+}
+
+void supervisor_terminal_background(void) {
+    if (pending_length > 0 &&
+        supervisor_ticks_ms32() - last_render_ms >= CIRCUITPY_TERMINAL_MS_PER_RENDER) {
+        supervisor_terminal_flush();
+    }
+}
+
+void supervisor_terminal_set_while_serial_connected(bool enabled) {
+    terminal_while_serial_connected = enabled;
+}
+
+bool supervisor_terminal_get_while_serial_connected(void) {
+    return terminal_while_serial_connected;
+}
+
 void supervisor_display_move_memory(void) {
     #if CIRCUITPY_DISPLAYIO
     displayio_tilegrid_t* grid = &supervisor_terminal_text_grid;
@@ -107,7 +165,7 @@ void supervisor_display_move_memory(void) {
     }
     uint16_t total_tiles = grid->width_in_tiles * grid->height_in_tiles;
 
-    tilegrid_tiles = allocate_memory(align32_size(total_tiles), false);
+    tilegrid_tiles = allocate_movable_memory(align32_size(total_tiles), false, move_tilegrid_tiles);
     if (tilegrid_tiles != NULL) {
         memcpy(tilegrid_tiles->ptr, grid->tiles, total_tiles);
         grid->tiles = (uint8_t*) tilegrid_tiles->ptr;
@@ -47,4 +47,13 @@ void supervisor_stop_terminal(void);
 
 void supervisor_display_move_memory(void);
 
+// Console output is buffered and drawn on the terminal by supervisor_terminal_background.
+void supervisor_terminal_write(const char* text, uint32_t length);
+void supervisor_terminal_background(void);
+// Draws any buffered output right away.
+void supervisor_terminal_flush(void);
+// When false, console output isn't drawn while USB serial is connected.
+void supervisor_terminal_set_while_serial_connected(bool enabled);
+bool supervisor_terminal_get_while_serial_connected(void);
+
 #endif  // MICROPY_INCLUDED_SUPERVISOR_SHARED_DISPLAY_H
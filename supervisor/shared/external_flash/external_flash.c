@@ -32,6 +32,7 @@
 #include "supervisor/shared/external_flash/common_commands.h"
 #include "extmod/vfs.h"
 #include "extmod/vfs_fat.h"
+#include "py/gc.h"
 #include "py/misc.h"
 #include "py/obj.h"
 #include "py/runtime.h"
@@ -42,16 +43,29 @@
 
 #define NO_SECTOR_LOADED 0xFFFFFFFF
 
-// The currently cached sector in the cache, ram or flash based.
-static uint32_t current_sector;
+// The currently cached sectors, ram or flash based. Only the first is used when
+// caching in the scratch sector or on the heap.
+static uint32_t cached_sectors[SPI_FLASH_CACHE_SECTORS];
 
 const external_flash_device possible_devices[EXTERNAL_FLASH_DEVICE_COUNT] = {EXTERNAL_FLASH_DEVICES};
 
 static const external_flash_device* flash_device = NULL;
 
-// Track which blocks (up to 32) in the current sector currently live in the
+// Track which blocks (up to 32) in each cached sector currently live in the
 // cache.
-static uint32_t dirty_mask;
+static uint32_t dirty_masks[SPI_FLASH_CACHE_SECTORS];
+
+// When each cached sector was last used, so the least recently used one can be
+// written back to make room.
+static uint32_t last_used[SPI_FLASH_CACHE_SECTORS];
+static uint32_t use_count;
+
+// The number of sectors the ram cache holds.
+static uint8_t ram_cache_sectors;
+
+// True when the scratch sector has been erased and nothing has been cached in
+// it since.
+static bool scratch_erased;
 
 static supervisor_allocation* supervisor_cache = NULL;
 
@@ -124,34 +138,32 @@ static bool write_flash(uint32_t address, const uint8_t* data, uint32_t data_len
     return true;
 }
 
-static bool page_erased(uint32_t sector_address) {
-    // Check the first few bytes to catch the common case where there is data
-    // without using a bunch of memory.
+// Compares the block at address with data. Returns true if data can be
+// programmed over it without an erase because it only clears bits. Each page
+// that actually differs is flagged in changed_pages.
+static bool block_programmable(uint32_t address, const uint8_t* data, uint8_t* changed_pages) {
+    uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
     if (flash_device->no_erase_cmd){
-        // skip this if device doesn't have an erase command.
+        // Devices without an erase command are always written directly.
+        *changed_pages = (1 << pages_per_block) - 1;
         return true;
     }
-    uint8_t short_buffer[4];
-    if (read_flash(sector_address, short_buffer, 4)) {
-        for (uint16_t i = 0; i < 4; i++) {
-            if (short_buffer[i] != 0xff) {
-                return false;
-            }
+    *changed_pages = 0;
+    // Compare page by page to minimize RAM buffer.
+    uint8_t buffer[SPI_FLASH_PAGE_SIZE];
+    for (uint8_t i = 0; i < pages_per_block; i++) {
+        const uint8_t* page = data + i * SPI_FLASH_PAGE_SIZE;
+        if (!read_flash(address + i * SPI_FLASH_PAGE_SIZE, buffer, SPI_FLASH_PAGE_SIZE)) {
+            return false;
         }
-    } else {
-        return false;
-    }
-
-    // Now check the full length.
-    uint8_t full_buffer[FILESYSTEM_BLOCK_SIZE];
-    if (read_flash(sector_address, full_buffer, FILESYSTEM_BLOCK_SIZE)) {
-        for (uint16_t i = 0; i < FILESYSTEM_BLOCK_SIZE; i++) {
-            if (short_buffer[i] != 0xff) {
+        for (uint16_t j = 0; j < SPI_FLASH_PAGE_SIZE; j++) {
+            if ((buffer[j] & page[j]) != page[j]) {
                 return false;
             }
+            if (buffer[j] != page[j]) {
+                *changed_pages |= 1 << i;
+            }
         }
-    } else {
-        return false;
     }
     return true;
 }
@@ -280,8 +292,12 @@ void supervisor_flash_init(void) {
 
     wait_for_flash_ready();
 
-    current_sector = NO_SECTOR_LOADED;
-    dirty_mask = 0;
+    for (uint8_t i = 0; i < SPI_FLASH_CACHE_SECTORS; i++) {
+        cached_sectors[i] = NO_SECTOR_LOADED;
+        dirty_masks[i] = 0;
+    }
+    ram_cache_sectors = 0;
+    scratch_erased = false;
     MP_STATE_VM(flash_ram_cache) = NULL;
 }
 
@@ -300,6 +316,7 @@ uint32_t supervisor_flash_get_block_count(void) {
 // Flush the cache that was written to the scratch portion of flash. Only used
 // when ram is tight.
 static bool flush_scratch_flash(void) {
+    uint32_t current_sector = cached_sectors[0];
     if (current_sector == NO_SECTOR_LOADED) {
         return true;
     }
@@ -308,7 +325,7 @@ static bool flush_scratch_flash(void) {
     bool copy_to_scratch_ok = true;
     uint32_t scratch_sector = flash_device->total_size - SPI_FLASH_ERASE_SIZE;
     for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
-        if ((dirty_mask & (1 << i)) == 0) {
+        if ((dirty_masks[0] & (1 << i)) == 0) {
             copy_to_scratch_ok = copy_to_scratch_ok &&
                 copy_block(current_sector + i * FILESYSTEM_BLOCK_SIZE,
                            scratch_sector + i * FILESYSTEM_BLOCK_SIZE);
@@ -329,30 +346,44 @@ static bool flush_scratch_flash(void) {
     return true;
 }
 
-// Attempts to allocate a new set of page buffers for caching a full sector in
-// ram. Each page is allocated separately so that the GC doesn't need to provide
-// one huge block. We can free it as we write if we want to also.
+// Attempts to allocate a new set of page buffers for caching full sectors in
+// ram. Outside the heap, as many of SPI_FLASH_CACHE_SECTORS sectors as fit are
+// cached. On the heap only one sector is, with each page allocated separately so
+// that the GC doesn't need to provide one huge block. We can free it as we write
+// if we want to also.
+static void move_ram_cache(supervisor_allocation* allocation, uint32_t* old_ptr) {
+    uint32_t pages = ram_cache_sectors * (SPI_FLASH_ERASE_SIZE / SPI_FLASH_PAGE_SIZE);
+    ptrdiff_t offset = (uint8_t *) allocation->ptr - (uint8_t *) old_ptr;
+    uint8_t** table = (uint8_t **) allocation->ptr;
+    for (uint32_t i = 0; i < pages; i++) {
+        table[i] += offset;
+    }
+    MP_STATE_VM(flash_ram_cache) = table;
+}
+
 static bool allocate_ram_cache(void) {
     uint8_t blocks_per_sector = SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE;
     uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
 
-    uint32_t table_size = blocks_per_sector * pages_per_block * sizeof(uint32_t);
     // Attempt to allocate outside the heap first.
-    supervisor_cache = allocate_memory(table_size + SPI_FLASH_ERASE_SIZE, false);
-    if (supervisor_cache != NULL) {
-        MP_STATE_VM(flash_ram_cache) = (uint8_t **) supervisor_cache->ptr;
-        uint8_t* page_start = (uint8_t *) supervisor_cache->ptr + table_size;
-
-        for (uint8_t i = 0; i < blocks_per_sector; i++) {
-            for (uint8_t j = 0; j < pages_per_block; j++) {
-                uint32_t offset = i * pages_per_block + j;
+    for (uint8_t sectors = SPI_FLASH_CACHE_SECTORS; sectors > 0; sectors--) {
+        uint32_t pages = sectors * blocks_per_sector * pages_per_block;
+        uint32_t table_size = pages * sizeof(uint32_t);
+        supervisor_cache = allocate_movable_memory(table_size + sectors * SPI_FLASH_ERASE_SIZE, false,
+            move_ram_cache);
+        if (supervisor_cache != NULL) {
+            MP_STATE_VM(flash_ram_cache) = (uint8_t **) supervisor_cache->ptr;
+            uint8_t* page_start = (uint8_t *) supervisor_cache->ptr + table_size;
+
+            for (uint32_t offset = 0; offset < pages; offset++) {
                 MP_STATE_VM(flash_ram_cache)[offset] = page_start + offset * SPI_FLASH_PAGE_SIZE;
             }
+            ram_cache_sectors = sectors;
+            return true;
         }
-        return true;
     }
 
-    if (MP_STATE_MEM(gc_pool_start) == 0) {
+    if (!gc_alloc_possible()) {
         return false;
     }
 
@@ -391,6 +422,8 @@ static bool allocate_ram_cache(void) {
         }
         m_free(MP_STATE_VM(flash_ram_cache));
         MP_STATE_VM(flash_ram_cache) = NULL;
+    } else {
+        ram_cache_sectors = 1;
     }
     return success;
 }
@@ -399,19 +432,25 @@ static void release_ram_cache(void) {
     if (supervisor_cache != NULL) {
         free_memory(supervisor_cache);
         supervisor_cache = NULL;
-    } else if (MP_STATE_MEM(gc_pool_start)) {
+    } else if (gc_alloc_possible()) {
         m_free(MP_STATE_VM(flash_ram_cache));
     }
     MP_STATE_VM(flash_ram_cache) = NULL;
+    ram_cache_sectors = 0;
 }
 
-// Flush the cached sector from ram onto the flash. We'll free the cache unless
-// keep_cache is true.
-static bool flush_ram_cache(bool keep_cache) {
-    if (current_sector == NO_SECTOR_LOADED) {
-        if (!keep_cache) {
-            release_ram_cache();
-        }
+// The ram cache of the given page of a cached sector.
+static uint8_t* cached_page(uint8_t slot, uint8_t block_index, uint8_t page) {
+    uint8_t blocks_per_sector = SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE;
+    uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
+    return MP_STATE_VM(flash_ram_cache)[(slot * blocks_per_sector + block_index) * pages_per_block + page];
+}
+
+// Flush one cached sector from ram onto the flash. The heap pages it used are
+// freed when free_pages is true.
+static bool flush_ram_sector(uint8_t slot, bool free_pages) {
+    uint32_t sector = cached_sectors[slot];
+    if (sector == NO_SECTOR_LOADED) {
         return true;
     }
     // First, copy out any blocks that we haven't touched from the sector
@@ -420,11 +459,11 @@ static bool flush_ram_cache(bool keep_cache) {
     bool copy_to_ram_ok = true;
     uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
     for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
-        if ((dirty_mask & (1 << i)) == 0) {
+        if ((dirty_masks[slot] & (1 << i)) == 0) {
             for (uint8_t j = 0; j < pages_per_block; j++) {
                 copy_to_ram_ok = read_flash(
-                    current_sector + (i * pages_per_block + j) * SPI_FLASH_PAGE_SIZE,
-                    MP_STATE_VM(flash_ram_cache)[i * pages_per_block + j],
+                    sector + (i * pages_per_block + j) * SPI_FLASH_PAGE_SIZE,
+                    cached_page(slot, i, j),
                     SPI_FLASH_PAGE_SIZE);
                 if (!copy_to_ram_ok) {
                     break;
@@ -439,19 +478,34 @@ static bool flush_ram_cache(bool keep_cache) {
     if (!copy_to_ram_ok) {
         return false;
     }
-    // Second, erase the current sector.
-    erase_sector(current_sector);
+    // Second, erase the sector.
+    erase_sector(sector);
     // Lastly, write all the data in ram that we've cached.
     for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
         for (uint8_t j = 0; j < pages_per_block; j++) {
-            write_flash(current_sector + (i * pages_per_block + j) * SPI_FLASH_PAGE_SIZE,
-                        MP_STATE_VM(flash_ram_cache)[i * pages_per_block + j],
+            write_flash(sector + (i * pages_per_block + j) * SPI_FLASH_PAGE_SIZE,
+                        cached_page(slot, i, j),
                         SPI_FLASH_PAGE_SIZE);
-            if (!keep_cache && supervisor_cache == NULL && MP_STATE_MEM(gc_pool_start)) {
-                m_free(MP_STATE_VM(flash_ram_cache)[i * pages_per_block + j]);
+            if (free_pages) {
+                m_free(cached_page(slot, i, j));
             }
         }
     }
+    cached_sectors[slot] = NO_SECTOR_LOADED;
+    return true;
+}
+
+// Flush the cached sectors from ram onto the flash. We'll free the cache unless
+// keep_cache is true.
+static bool flush_ram_cache(bool keep_cache) {
+    bool free_pages = !keep_cache && supervisor_cache == NULL && gc_alloc_possible();
+    bool ok = true;
+    for (uint8_t slot = 0; slot < ram_cache_sectors; slot++) {
+        ok = flush_ram_sector(slot, free_pages) && ok;
+    }
+    if (!ok) {
+        return false;
+    }
     // We're done with the cache for now so give it back.
     if (!keep_cache) {
         release_ram_cache();
@@ -459,24 +513,34 @@ static bool flush_ram_cache(bool keep_cache) {
     return true;
 }
 
-// Delegates to the correct flash flush method depending on the existing cache.
-// TODO Don't blink the status indicator if we don't actually do any writing (hard to tell right now).
-static void spi_flash_flush_keep_cache(bool keep_cache) {
+static void flush_status_start(void) {
     #ifdef MICROPY_HW_LED_MSC
         port_pin_set_output_level(MICROPY_HW_LED_MSC, true);
     #endif
     temp_status_color(ACTIVE_WRITE);
+}
+
+static void flush_status_end(void) {
+    clear_temp_status();
+    #ifdef MICROPY_HW_LED_MSC
+        port_pin_set_output_level(MICROPY_HW_LED_MSC, false);
+    #endif
+}
+
+// Delegates to the correct flash flush method depending on the existing cache.
+// TODO Don't blink the status indicator if we don't actually do any writing (hard to tell right now).
+static void spi_flash_flush_keep_cache(bool keep_cache) {
+    flush_status_start();
     // If we've cached to the flash itself flush from there.
     if (MP_STATE_VM(flash_ram_cache) == NULL) {
         flush_scratch_flash();
     } else {
         flush_ram_cache(keep_cache);
     }
-    current_sector = NO_SECTOR_LOADED;
-    clear_temp_status();
-    #ifdef MICROPY_HW_LED_MSC
-        port_pin_set_output_level(MICROPY_HW_LED_MSC, false);
-    #endif
+    for (uint8_t i = 0; i < SPI_FLASH_CACHE_SECTORS; i++) {
+        cached_sectors[i] = NO_SECTOR_LOADED;
+    }
+    flush_status_end();
 }
 
 void supervisor_external_flash_flush(void) {
@@ -487,6 +551,17 @@ void supervisor_flash_release_cache(void) {
     spi_flash_flush_keep_cache(false);
 }
 
+void supervisor_external_flash_background(void) {
+    if (scratch_erased || flash_device == NULL ||
+        (MP_STATE_VM(flash_ram_cache) == NULL && cached_sectors[0] != NO_SECTOR_LOADED)) {
+        return;
+    }
+    // Only start the erase. The flash carries it out on its own and whatever
+    // uses the flash next waits for it to finish.
+    erase_sector(flash_device->total_size - SPI_FLASH_ERASE_SIZE);
+    scratch_erased = true;
+}
+
 static int32_t convert_block_to_flash_addr(uint32_t block) {
     if (0 <= block && block < supervisor_flash_get_block_count()) {
         // a block in partition 1
@@ -496,6 +571,55 @@ static int32_t convert_block_to_flash_addr(uint32_t block) {
     return -1;
 }
 
+// Returns the cache slot holding the given sector or -1 if it isn't cached.
+static int8_t find_cached_sector(uint32_t sector) {
+    for (uint8_t i = 0; i < SPI_FLASH_CACHE_SECTORS; i++) {
+        if (cached_sectors[i] == sector) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Starts caching the given sector, making room for it if needed, and returns
+// its slot.
+static uint8_t cache_sector(uint32_t sector) {
+    if (MP_STATE_VM(flash_ram_cache) == NULL) {
+        if (cached_sectors[0] != NO_SECTOR_LOADED) {
+            supervisor_flash_flush();
+        }
+        if (!allocate_ram_cache()) {
+            if (!scratch_erased) {
+                erase_sector(flash_device->total_size - SPI_FLASH_ERASE_SIZE);
+            }
+            wait_for_flash_ready();
+            scratch_erased = false;
+            cached_sectors[0] = sector;
+            dirty_masks[0] = 0;
+            return 0;
+        }
+    }
+    // Use a free slot, or else write back the least recently used sector.
+    uint8_t slot = 0;
+    for (uint8_t i = 0; i < ram_cache_sectors; i++) {
+        if (cached_sectors[i] == NO_SECTOR_LOADED) {
+            slot = i;
+            break;
+        }
+        if (last_used[i] < last_used[slot]) {
+            slot = i;
+        }
+    }
+    if (cached_sectors[slot] != NO_SECTOR_LOADED) {
+        flush_status_start();
+        flush_ram_sector(slot, false);
+        flush_status_end();
+    }
+    cached_sectors[slot] = sector;
+    dirty_masks[slot] = 0;
+    return slot;
+}
+
 bool external_flash_read_block(uint8_t *dest, uint32_t block) {
     int32_t address = convert_block_to_flash_addr(block);
     if (address == -1) {
@@ -507,13 +631,15 @@ bool external_flash_read_block(uint8_t *dest, uint32_t block) {
     uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
     uint8_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE);
     uint8_t mask = 1 << (block_index);
-    // We're reading from the currently cached sector.
-    if (current_sector == this_sector && (mask & dirty_mask) > 0) {
+    int8_t slot = find_cached_sector(this_sector);
+    // We're reading from a cached sector.
+    if (slot >= 0 && (mask & dirty_masks[slot]) > 0) {
+        last_used[slot] = ++use_count;
         if (MP_STATE_VM(flash_ram_cache) != NULL) {
             uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
             for (int i = 0; i < pages_per_block; i++) {
                 memcpy(dest + i * SPI_FLASH_PAGE_SIZE,
-                       MP_STATE_VM(flash_ram_cache)[block_index * pages_per_block + i],
+                       cached_page(slot, block_index, i),
                        SPI_FLASH_PAGE_SIZE);
             }
             return true;
@@ -538,30 +664,39 @@ bool external_flash_write_block(const uint8_t *data, uint32_t block) {
     uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
     uint8_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE);
     uint8_t mask = 1 << (block_index);
-    // Flush the cache if we're moving onto a sector or we're writing the
-    // same block again.
-    if (current_sector != this_sector || (mask & dirty_mask) > 0) {
-        // Check to see if we'd write to an erased page. In that case we
-        // can write directly.
-        if (page_erased(address)) {
-            return write_flash(address, data, FILESYSTEM_BLOCK_SIZE);
-        }
-        if (current_sector != NO_SECTOR_LOADED) {
-            supervisor_flash_flush();
+    int8_t slot = find_cached_sector(this_sector);
+    // A block in the scratch sector can't be written again without erasing it,
+    // so flush it first. In ram the cached block is simply replaced.
+    if (slot >= 0 && MP_STATE_VM(flash_ram_cache) == NULL && (mask & dirty_masks[slot]) > 0) {
+        supervisor_flash_flush();
+        slot = -1;
+    }
+    if (slot < 0 || (mask & dirty_masks[slot]) == 0) {
+        // The flash holds the current version of this block. If the new data
+        // matches it or only clears bits (such as over an erased block) then
+        // program just the pages that changed in place.
+        uint8_t changed_pages;
+        if (block_programmable(address, data, &changed_pages)) {
+            for (uint8_t i = 0; i < FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE; i++) {
+                if ((changed_pages & (1 << i)) != 0 &&
+                    !write_flash(address + i * SPI_FLASH_PAGE_SIZE, data + i * SPI_FLASH_PAGE_SIZE,
+                                 SPI_FLASH_PAGE_SIZE)) {
+                    return false;
+                }
+            }
+            return true;
         }
-        if (MP_STATE_VM(flash_ram_cache) == NULL && !allocate_ram_cache()) {
-            erase_sector(flash_device->total_size - SPI_FLASH_ERASE_SIZE);
-            wait_for_flash_ready();
+        if (slot < 0) {
+            slot = cache_sector(this_sector);
         }
-        current_sector = this_sector;
-        dirty_mask = 0;
     }
-    dirty_mask |= mask;
+    dirty_masks[slot] |= mask;
+    last_used[slot] = ++use_count;
     // Copy the block to the appropriate cache.
     if (MP_STATE_VM(flash_ram_cache) != NULL) {
         uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
         for (int i = 0; i < pages_per_block; i++) {
-            memcpy(MP_STATE_VM(flash_ram_cache)[block_index * pages_per_block + i],
+            memcpy(cached_page(slot, block_index, i),
                    data + i * SPI_FLASH_PAGE_SIZE,
                    SPI_FLASH_PAGE_SIZE);
         }
@@ -572,6 +707,30 @@ bool external_flash_write_block(const uint8_t *data, uint32_t block) {
     }
 }
 
+const uint8_t* external_flash_map_blocks(uint32_t block, uint32_t num_blocks) {
+    if (num_blocks == 0) {
+        return NULL;
+    }
+    int32_t address = convert_block_to_flash_addr(block);
+    if (address == -1 || convert_block_to_flash_addr(block + num_blocks - 1) == -1) {
+        return NULL;
+    }
+    // Blocks that are only up to date in the cache can't be read from the flash.
+    for (uint32_t i = 0; i < num_blocks; i++) {
+        uint32_t block_address = address + i * FILESYSTEM_BLOCK_SIZE;
+        uint32_t this_sector = block_address & (~(SPI_FLASH_ERASE_SIZE - 1));
+        uint8_t block_index = (block_address / FILESYSTEM_BLOCK_SIZE) % (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE);
+        int8_t slot = find_cached_sector(this_sector);
+        if (slot >= 0 && (dirty_masks[slot] & (1 << block_index)) > 0) {
+            return NULL;
+        }
+    }
+    if (!wait_for_flash_ready()) {
+        return NULL;
+    }
+    return spi_flash_memory_map(address);
+}
+
 mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_blocks) {
     for (size_t i = 0; i < num_blocks; i++) {
         if (!external_flash_read_block(dest + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
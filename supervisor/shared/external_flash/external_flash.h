@@ -45,6 +45,23 @@
 #define SPI_FLASH_MAX_BAUDRATE 8000000
 #endif
 
+// How many erase sectors can be cached in ram before the least recently used
+// one is written back. Each one takes SPI_FLASH_ERASE_SIZE bytes of supervisor
+// memory, and fewer are cached if that much isn't free.
+#ifndef SPI_FLASH_CACHE_SECTORS
+#define SPI_FLASH_CACHE_SECTORS (1)
+#endif
+
 void supervisor_external_flash_flush(void);
 
+// Erases the scratch sector ahead of time, while it isn't in use, so the
+// write path doesn't have to wait for the erase.
+void supervisor_external_flash_background(void);
+
+// Returns where num_blocks filesystem blocks starting at block can be read in
+// place, or NULL when they can't be, such as when one is still only in the
+// cache or the flash isn't memory mapped. The pointer is only valid until the
+// next flash access.
+const uint8_t* external_flash_map_blocks(uint32_t block, uint32_t num_blocks);
+
 #endif  // MICROPY_INCLUDED_SUPERVISOR_SHARED_EXTERNAL_FLASH_EXTERNAL_FLASH_H
@@ -47,6 +47,9 @@ void filesystem_background(void) {
         supervisor_flash_flush();
         filesystem_flush_requested = false;
     }
+    #ifdef EXTERNAL_FLASH_DEVICE_COUNT
+    supervisor_external_flash_background();
+    #endif
 }
 
 inline void filesystem_tick(void) {
@@ -62,6 +65,17 @@ inline void filesystem_tick(void) {
     }
 }
 
+uint32_t filesystem_ticks_until_flush(void) {
+    return filesystem_flush_interval_ms;
+}
+
+void filesystem_delay_flush(void) {
+    if (filesystem_flush_interval_ms == 0) {
+        return;
+    }
+    filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
+    filesystem_flush_requested = false;
+}
 
 static void make_empty_file(FATFS *fatfs, const char *path) {
     FIL fp;
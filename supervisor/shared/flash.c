@@ -123,7 +123,7 @@ mp_uint_t flash_write_blocks(const uint8_t *src, uint32_t block_num, uint32_t nu
     } else {
         if (!filesystem_dirty) {
             // Turn on ticks so that we can flush after a period of time elapses.
-            supervisor_enable_tick();
+            supervisor_enable_tick_deadline();
             filesystem_dirty = true;
         }
         return supervisor_flash_write_blocks(src, block_num - PART1_START_BLOCK, num_blocks);
@@ -138,7 +138,7 @@ void supervisor_flash_flush(void) {
     #endif
     // Turn off ticks now that our filesystem has been flushed.
     if (filesystem_dirty) {
-        supervisor_disable_tick();
+        supervisor_disable_tick_deadline();
     }
     filesystem_dirty = false;
 }
@@ -0,0 +1,133 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stddef.h>
+
+#include "supervisor/shared/gc_trace.h"
+
+#include "py/gc.h"
+#include "py/mpconfig.h"
+#include "shared-bindings/busio/UART.h"
+#include "shared-bindings/microcontroller/__init__.h"
+#include "supervisor/port.h"
+#include "supervisor/shared/background_tasks.h"
+
+#ifndef GC_TRACE_UART_TX
+#error "CIRCUITPY_GC_TRACE needs the board to define GC_TRACE_UART_TX"
+#endif
+
+#ifndef GC_TRACE_UART_BAUDRATE
+#define GC_TRACE_UART_BAUDRATE (1000000)
+#endif
+
+#ifndef GC_TRACE_BUFFER_SIZE
+#define GC_TRACE_BUFFER_SIZE (2048)
+#endif
+
+#define GC_TRACE_RECORD_SIZE (14)
+// Bytes written per background pass, to keep the task's share of a pass short.
+#define GC_TRACE_CHUNK (64)
+
+STATIC busio_uart_obj_t trace_uart;
+STATIC uint8_t ring[GC_TRACE_BUFFER_SIZE];
+// Only gc_trace_event() moves head and only gc_trace_drain() moves tail.
+STATIC volatile size_t ring_head;
+STATIC volatile size_t ring_tail;
+STATIC uint32_t lost;
+STATIC bool ready;
+
+STATIC void gc_trace_drain(void);
+
+// Shares the profiler's priority since both only matter while debugging.
+STATIC background_task_t gc_trace_task = BACKGROUND_TASK(gc_trace_drain, BACKGROUND_TASK_PRIORITY_PROFILER, 1);
+
+void gc_trace_init(void) {
+    trace_uart.base.type = &busio_uart_type;
+    common_hal_busio_uart_construct(&trace_uart, GC_TRACE_UART_TX, NULL, NULL, NULL, NULL,
+        false, GC_TRACE_UART_BAUDRATE, 8, PARITY_NONE, 1, 1.0f, 0, NULL, false);
+    common_hal_busio_uart_never_reset(&trace_uart);
+    supervisor_background_task_register(&gc_trace_task);
+    ready = true;
+}
+
+STATIC void put_u32(uint8_t *buf, uint32_t value) {
+    for (size_t i = 0; i < 4; i++) {
+        buf[i] = value >> (8 * i);
+    }
+}
+
+STATIC bool queue_record(uint8_t kind, uint32_t ptr, uint32_t n_blocks) {
+    size_t head = ring_head;
+    size_t used = (head + GC_TRACE_BUFFER_SIZE - ring_tail) % GC_TRACE_BUFFER_SIZE;
+    if (used + GC_TRACE_RECORD_SIZE >= GC_TRACE_BUFFER_SIZE) {
+        return false;
+    }
+    uint8_t subticks;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    uint8_t record[GC_TRACE_RECORD_SIZE];
+    record[0] = 0xa5;
+    record[1] = kind;
+    put_u32(record + 2, ticks * 32 + subticks);
+    put_u32(record + 6, ptr);
+    put_u32(record + 10, n_blocks);
+    for (size_t i = 0; i < GC_TRACE_RECORD_SIZE; i++) {
+        ring[head] = record[i];
+        head = (head + 1) % GC_TRACE_BUFFER_SIZE;
+    }
+    ring_head = head;
+    return true;
+}
+
+void gc_trace_event(uint8_t kind, const void *ptr, size_t n_blocks) {
+    if (!ready) {
+        return;
+    }
+    // With _thread, events can come from more than one thread.
+    common_hal_mcu_disable_interrupts();
+    if (lost > 0 && queue_record(GC_TRACE_LOST, 0, lost)) {
+        lost = 0;
+    }
+    if (lost > 0 || !queue_record(kind, (uint32_t)(uintptr_t)ptr, n_blocks)) {
+        lost++;
+    }
+    common_hal_mcu_enable_interrupts();
+}
+
+STATIC void gc_trace_drain(void) {
+    size_t tail = ring_tail;
+    size_t head = ring_head;
+    if (tail == head) {
+        return;
+    }
+    // Write up to the end of the ring; the rest goes next time.
+    size_t len = (head > tail ? head : GC_TRACE_BUFFER_SIZE) - tail;
+    if (len > GC_TRACE_CHUNK) {
+        len = GC_TRACE_CHUNK;
+    }
+    int errcode;
+    common_hal_busio_uart_write(&trace_uart, ring + tail, len, &errcode);
+    ring_tail = (tail + len) % GC_TRACE_BUFFER_SIZE;
+}
@@ -0,0 +1,42 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SUPERVISOR_SHARED_GC_TRACE_H
+#define MICROPY_INCLUDED_SUPERVISOR_SHARED_GC_TRACE_H
+
+// Streams the heap events from py/gc.c out of GC_TRACE_UART_TX as 14 byte
+// records: 0xA5, kind, then the time in 1/32768 s, the pointer and the block
+// count as little endian 32 bit words. tools/gc_activity.py --trace reads them.
+//
+// Records are queued in a ring buffer and written by a background task.
+// When the ring is full they are dropped, and a GC_TRACE_LOST record with the
+// number dropped in its block count follows once there is room again.
+
+#define GC_TRACE_LOST (0xff)
+
+void gc_trace_init(void);
+
+#endif  // MICROPY_INCLUDED_SUPERVISOR_SHARED_GC_TRACE_H
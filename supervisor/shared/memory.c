@@ -28,12 +28,18 @@
 #include "supervisor/port.h"
 
 #include <stddef.h>
+#include <string.h>
 
 #include "supervisor/shared/display.h"
 
 #define CIRCUITPY_SUPERVISOR_ALLOC_COUNT (12)
 
+// Allocations at the bottom of the region grow up to low_address and ones at the top grow down to
+// high_address. The space between them is what allocate_remaining_memory() gives the VM heap.
+// Freeing an allocation that isn't next to that space leaves a hole, which later allocations fill
+// best fit. Movable allocations are slid over the holes before the heap is allocated.
 static supervisor_allocation allocations[CIRCUITPY_SUPERVISOR_ALLOC_COUNT];
+static supervisor_move_callback_t move_callbacks[CIRCUITPY_SUPERVISOR_ALLOC_COUNT];
 // We use uint32_t* to ensure word (4 byte) alignment.
 uint32_t* low_address;
 uint32_t* high_address;
@@ -43,6 +49,49 @@ void memory_init(void) {
     high_address = port_heap_get_top();
 }
 
+// Fills in the indices of the live allocations ordered by address and returns how many there are.
+static size_t sorted_allocations(uint8_t* order) {
+    size_t count = 0;
+    for (uint8_t index = 0; index < CIRCUITPY_SUPERVISOR_ALLOC_COUNT; index++) {
+        if (allocations[index].ptr == NULL) {
+            continue;
+        }
+        size_t i = count;
+        while (i > 0 && allocations[order[i - 1]].ptr > allocations[index].ptr) {
+            order[i] = order[i - 1];
+            i--;
+        }
+        order[i] = index;
+        count++;
+    }
+    return count;
+}
+
+static uint32_t* allocation_end(supervisor_allocation* allocation) {
+    return allocation->ptr + allocation->length / 4;
+}
+
+// Moves the bounds of the middle over any free space next to it.
+static void update_bounds(void) {
+    uint32_t* new_low = port_heap_get_bottom();
+    uint32_t* new_high = port_heap_get_top();
+    for (size_t index = 0; index < CIRCUITPY_SUPERVISOR_ALLOC_COUNT; index++) {
+        supervisor_allocation* allocation = &allocations[index];
+        if (allocation->ptr == NULL) {
+            continue;
+        }
+        if (allocation->ptr < low_address) {
+            if (allocation_end(allocation) > new_low) {
+                new_low = allocation_end(allocation);
+            }
+        } else if (allocation->ptr < new_high) {
+            new_high = allocation->ptr;
+        }
+    }
+    low_address = new_low;
+    high_address = new_high;
+}
+
 void free_memory(supervisor_allocation* allocation) {
     if (allocation == NULL) {
         return;
@@ -58,28 +107,11 @@ void free_memory(supervisor_allocation* allocation) {
     if (!found) {
         // Bad!
         // TODO(tannewt): Add a way to escape into safe mode on error.
-    }
-    if (allocation->ptr == high_address) {
-        high_address += allocation->length / 4;
-        for (index++; index < CIRCUITPY_SUPERVISOR_ALLOC_COUNT; index++) {
-            if (allocations[index].ptr != NULL) {
-                break;
-            }
-            high_address += allocations[index].length / 4;
-        }
-    } else if (allocation->ptr + allocation->length / 4 == low_address) {
-        low_address = allocation->ptr;
-        for (index--; index >= 0; index--) {
-            if (allocations[index].ptr != NULL) {
-                break;
-            }
-            low_address -= allocations[index].length / 4;
-        }
-    } else {
-        // Freed memory isn't in the middle so skip updating bounds. The memory will be added to the
-        // middle when the memory to the inside is freed.
+        return;
     }
     allocation->ptr = NULL;
+    move_callbacks[index] = NULL;
+    update_bounds();
 }
 
 supervisor_allocation* allocation_from_ptr(void *ptr) {
@@ -91,7 +123,50 @@ supervisor_allocation* allocation_from_ptr(void *ptr) {
     return NULL;
 }
 
+static void move_allocation(uint8_t index, uint32_t* new_ptr) {
+    supervisor_allocation* allocation = &allocations[index];
+    uint32_t* old_ptr = allocation->ptr;
+    memmove(new_ptr, old_ptr, allocation->length);
+    allocation->ptr = new_ptr;
+    move_callbacks[index](allocation, old_ptr);
+}
+
+// Slides movable allocations toward the ends of the region to close the holes between them, so
+// the middle grows as much as it can.
+static void compact_memory(void) {
+    uint8_t order[CIRCUITPY_SUPERVISOR_ALLOC_COUNT];
+    size_t count = sorted_allocations(order);
+
+    uint32_t* next = port_heap_get_bottom();
+    for (size_t i = 0; i < count; i++) {
+        uint8_t index = order[i];
+        if (allocations[index].ptr >= low_address) {
+            break;
+        }
+        if (allocations[index].ptr != next && move_callbacks[index] != NULL) {
+            move_allocation(index, next);
+        }
+        next = allocation_end(&allocations[index]);
+    }
+
+    next = port_heap_get_top();
+    for (size_t i = count; i > 0; i--) {
+        uint8_t index = order[i - 1];
+        if (allocations[index].ptr < high_address) {
+            break;
+        }
+        uint32_t* new_ptr = next - allocations[index].length / 4;
+        if (allocations[index].ptr != new_ptr && move_callbacks[index] != NULL) {
+            move_allocation(index, new_ptr);
+        }
+        next = allocations[index].ptr;
+    }
+
+    update_bounds();
+}
+
 supervisor_allocation* allocate_remaining_memory(void) {
+    compact_memory();
     if (low_address == high_address) {
         return NULL;
     }
@@ -99,16 +174,15 @@ supervisor_allocation* allocate_remaining_memory(void) {
 }
 
 supervisor_allocation* allocate_memory(uint32_t length, bool high) {
-    if ((high_address - low_address) * 4 < (int32_t) length || length % 4 != 0) {
+    return allocate_movable_memory(length, high, NULL);
+}
+
+supervisor_allocation* allocate_movable_memory(uint32_t length, bool high, supervisor_move_callback_t move_callback) {
+    if (length == 0 || length % 4 != 0) {
         return NULL;
     }
-    uint8_t index = 0;
-    int8_t direction = 1;
-    if (high) {
-        index = CIRCUITPY_SUPERVISOR_ALLOC_COUNT - 1;
-        direction = -1;
-    }
-    for (; index < CIRCUITPY_SUPERVISOR_ALLOC_COUNT; index += direction) {
+    uint8_t index;
+    for (index = 0; index < CIRCUITPY_SUPERVISOR_ALLOC_COUNT; index++) {
         if (allocations[index].ptr == NULL) {
             break;
         }
@@ -116,8 +190,39 @@ supervisor_allocation* allocate_memory(uint32_t length, bool high) {
     if (index >= CIRCUITPY_SUPERVISOR_ALLOC_COUNT) {
         return NULL;
     }
+
+    // Take the smallest hole that fits so that the middle stays as big as possible.
+    uint8_t order[CIRCUITPY_SUPERVISOR_ALLOC_COUNT];
+    size_t count = sorted_allocations(order);
+    uint32_t* best = NULL;
+    uint32_t best_length = 0;
+    uint32_t* hole_start = port_heap_get_bottom();
+    for (size_t i = 0; i <= count; i++) {
+        uint32_t* hole_end = i < count ? allocations[order[i]].ptr : port_heap_get_top();
+        if (hole_start == low_address) {
+            // This is the middle.
+            hole_start = high_address;
+        }
+        uint32_t hole_length = (hole_end - hole_start) * 4;
+        if (hole_length >= length && (best == NULL || hole_length < best_length)) {
+            best = hole_start;
+            best_length = hole_length;
+        }
+        if (i < count) {
+            hole_start = allocation_end(&allocations[order[i]]);
+        }
+    }
+
     supervisor_allocation* alloc = &allocations[index];
-    if (high) {
+    if (best != NULL) {
+        // Stay at the outer end of the hole so that a later compaction moves things less.
+        if (best >= high_address) {
+            best += (best_length - length) / 4;
+        }
+        alloc->ptr = best;
+    } else if ((high_address - low_address) * 4 < (int32_t) length) {
+        return NULL;
+    } else if (high) {
         high_address -= length / 4;
         alloc->ptr = high_address;
     } else {
@@ -125,9 +230,9 @@ supervisor_allocation* allocate_memory(uint32_t length, bool high) {
         low_address += length / 4;
     }
     alloc->length = length;
+    move_callbacks[index] = move_callback;
     return alloc;
 }
-
 void supervisor_move_memory(void) {
     #if CIRCUITPY_DISPLAYIO
     supervisor_display_move_memory();
@@ -0,0 +1,85 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "supervisor/shared/perf.h"
+
+#include "py/mpconfig.h"
+
+#include "shared-bindings/microcontroller/Processor.h"
+#include "supervisor/port.h"
+
+STATIC perf_counter_t counters[PERF_COUNTER_COUNT];
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+// The core debug and DWT registers are at the same address on every
+// Cortex-M, so there's no need for the vendor headers here.
+#define DEMCR (*(volatile uint32_t *)0xE000EDFC)
+#define DEMCR_TRCENA (1 << 24)
+#define DWT_CTRL (*(volatile uint32_t *)0xE0001000)
+#define DWT_CTRL_CYCCNTENA (1 << 0)
+#define DWT_CYCCNT (*(volatile uint32_t *)0xE0001004)
+
+__attribute__((weak)) uint32_t port_get_cycle_count(void) {
+    // A debugger may turn the counter off, so check every time. It costs
+    // a couple of loads.
+    if (!(DWT_CTRL & DWT_CTRL_CYCCNTENA)) {
+        DEMCR |= DEMCR_TRCENA;
+        DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+    }
+    return DWT_CYCCNT;
+}
+#else
+__attribute__((weak)) uint32_t port_get_cycle_count(void) {
+    // Subticks are 1/32768 of a second. The product wraps, but differences
+    // of it are still right modulo 2**32.
+    uint8_t subticks;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    return (uint32_t)(ticks * 32 + subticks) * (common_hal_mcu_processor_get_frequency() / 32768);
+}
+#endif
+
+void perf_record(uint8_t counter, uint32_t start) {
+    uint32_t cycles = port_get_cycle_count() - start;
+    perf_counter_t *c = &counters[counter];
+    if (c->count == 0 || cycles < c->min) {
+        c->min = cycles;
+    }
+    if (cycles > c->max) {
+        c->max = cycles;
+    }
+    c->total += cycles;
+    c->count++;
+}
+
+const perf_counter_t *perf_get(uint8_t counter) {
+    return &counters[counter];
+}
+
+void perf_reset(void) {
+    memset(counters, 0, sizeof(counters));
+}
@@ -0,0 +1,72 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SUPERVISOR_SHARED_PERF_H
+#define MICROPY_INCLUDED_SUPERVISOR_SHARED_PERF_H
+
+#include <stdint.h>
+
+#include "supervisor/shared/background_tasks.h"
+
+// Background tasks are counted by their priority, so each counter below
+// BACKGROUND_TASK_PRIORITY_COUNT covers one subsystem (audio, USB, ...).
+#define PERF_COUNTER_BACKGROUND (BACKGROUND_TASK_PRIORITY_COUNT)
+#define PERF_COUNTER_GC         (BACKGROUND_TASK_PRIORITY_COUNT + 1)
+#define PERF_COUNTER_COUNT      (BACKGROUND_TASK_PRIORITY_COUNT + 2)
+
+typedef struct {
+    uint64_t total;
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+} perf_counter_t;
+
+#if CIRCUITPY_PERF_COUNTERS
+
+/** @brief A free running CPU cycle count that wraps at 32 bits
+ *
+ * Cortex-M3 and up use the DWT cycle counter. Other ports either provide
+ * their own or fall back to the tick, scaled to the CPU frequency.
+ */
+uint32_t port_get_cycle_count(void);
+
+/** @brief Add the cycles since `start` to a counter */
+void perf_record(uint8_t counter, uint32_t start);
+
+const perf_counter_t *perf_get(uint8_t counter);
+void perf_reset(void);
+
+#define PERF_START() uint32_t perf_start = port_get_cycle_count()
+#define PERF_END(counter) perf_record(counter, perf_start)
+
+#else
+
+#define PERF_START()
+#define PERF_END(counter)
+
+#endif
+
+#endif  // MICROPY_INCLUDED_SUPERVISOR_SHARED_PERF_H
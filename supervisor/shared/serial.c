@@ -47,6 +47,9 @@ busio_uart_obj_t debug_uart;
 byte buf_array[64];
 #endif
 
+static bool write_blocking = true;
+static uint32_t bytes_dropped = 0;
+
 void serial_early_init(void) {
 #if defined(DEBUG_UART_TX) && defined(DEBUG_UART_RX)
     debug_uart.base.type = &busio_uart_type;
@@ -100,14 +103,21 @@ void serial_write_substring(const char* text, uint32_t length) {
         return;
     }
 #if CIRCUITPY_DISPLAYIO
-    int errcode;
-    common_hal_terminalio_terminal_write(&supervisor_terminal, (const uint8_t*) text, length, &errcode);
+    supervisor_terminal_write(text, length);
 #endif
 
     uint32_t count = 0;
-    while (count < length && tud_cdc_connected()) {
-        count += tud_cdc_write(text + count, length - count);
-        usb_background();
+    if (!write_blocking) {
+        if (tud_cdc_connected()) {
+            count = tud_cdc_write(text, length);
+            tud_cdc_write_flush();
+            bytes_dropped += length - count;
+        }
+    } else {
+        while (count < length && tud_cdc_connected()) {
+            count += tud_cdc_write(text + count, length - count);
+            usb_background();
+        }
     }
 
 #if defined(DEBUG_UART_TX) && defined(DEBUG_UART_RX)
@@ -119,3 +129,15 @@ void serial_write_substring(const char* text, uint32_t length) {
 void serial_write(const char* text) {
     serial_write_substring(text, strlen(text));
 }
+
+void serial_set_write_blocking(bool blocking) {
+    write_blocking = blocking;
+}
+
+bool serial_get_write_blocking(void) {
+    return write_blocking;
+}
+
+uint32_t serial_get_bytes_dropped(void) {
+    return bytes_dropped;
+}
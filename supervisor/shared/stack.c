@@ -89,6 +89,10 @@ void stack_resize(void) {
     allocate_stack();
 }
 
+bool stack_resize_pending(void) {
+    return stack_alloc != NULL && next_stack_size != current_stack_size;
+}
+
 void set_next_stack_size(uint32_t size) {
     next_stack_size = size;
 }
@@ -35,6 +35,8 @@ extern supervisor_allocation* stack_alloc;
 
 void stack_init(void);
 void stack_resize(void);
+// True if the next stack_resize will move the stack to change its size.
+bool stack_resize_pending(void);
 void set_next_stack_size(uint32_t size);
 uint32_t get_current_stack_size(void);
 bool stack_ok(void);
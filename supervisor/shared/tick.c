@@ -26,7 +26,9 @@
 
 #include "supervisor/shared/tick.h"
 
+#include "py/gc.h"
 #include "py/mpstate.h"
+#include "py/runtime.h"
 #include "supervisor/linker.h"
 #include "supervisor/filesystem.h"
 #include "supervisor/port.h"
@@ -42,6 +44,14 @@ static volatile uint64_t PLACE_IN_DTCM_BSS(background_ticks);
 #include "shared-module/gamepadshift/__init__.h"
 #endif
 
+#if CIRCUITPY_KEYPAD
+#include "shared-module/keypad/__init__.h"
+#endif
+
+#if CIRCUITPY_PROFILER
+#include "shared-module/profiler/__init__.h"
+#endif
+
 #include "shared-bindings/microcontroller/__init__.h"
 
 #if CIRCUITPY_WATCHDOG
@@ -68,6 +78,12 @@ void supervisor_tick(void) {
         #endif
     }
 #endif
+#if CIRCUITPY_KEYPAD
+    keypad_tick();
+#endif
+#if CIRCUITPY_PROFILER
+    profiler_tick();
+#endif
 }
 
 uint64_t supervisor_ticks_ms64() {
@@ -93,6 +109,99 @@ void PLACE_IN_ITCM(supervisor_run_background_tasks_if_tick)() {
     run_background_tasks();
 }
 
+#if MICROPY_GC_INCREMENTAL
+// Number of blocks marked between checks of the time budget.
+#define GC_INCREMENTAL_STEP_BLOCKS (32)
+
+// Time in 1/32768 second units.
+STATIC uint64_t subticks_now(void) {
+    uint8_t subticks;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    return ticks * 32 + subticks;
+}
+
+// Do one time-limited slice of incremental garbage collection. The VM is
+// blocked in mp_hal_delay_ms while this runs so nothing but background tasks
+// touches the heap between slices. Returns true if a cycle is still going.
+STATIC bool gc_incremental_slice(void) {
+    if (!gc_collect_incremental_in_progress()) {
+        if (!gc_collect_incremental_wanted()) {
+            return false;
+        }
+        gc_collect_incremental_start();
+        return true;
+    }
+    uint64_t start = subticks_now();
+    while (!gc_collect_incremental_step(GC_INCREMENTAL_STEP_BLOCKS)) {
+        if ((subticks_now() - start) * 15625 / 512 >= CIRCUITPY_GC_INCREMENTAL_BUDGET_US) {
+            return true;
+        }
+    }
+    // Marking is done. A regular collection rescans the roots and sweeps.
+    gc_collect();
+    return false;
+}
+#endif
+
+volatile size_t tick_enable_count = 0;
+// The subset of tick_enable_count that only counts down to deadlines.
+volatile size_t tick_deadline_count = 0;
+
+#if CIRCUITPY_TICKLESS_IDLE
+// Ticks until the nearest countdown in supervisor_tick runs out.
+STATIC uint32_t ticks_until_deadline(void) {
+    uint32_t deadline = UINT32_MAX;
+    #if CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS > 0
+    uint32_t flush = filesystem_ticks_until_flush();
+    if (flush > 0 && flush < deadline) {
+        deadline = flush;
+    }
+    #endif
+    #ifdef CIRCUITPY_AUTORELOAD_DELAY_MS
+    uint32_t reload = autoreload_ticks_remaining();
+    if (reload > 0 && reload < deadline) {
+        deadline = reload;
+    }
+    #endif
+    return deadline;
+}
+
+// If the tick is only on for deadlines, stop it and sleep until the nearest
+// deadline or the end of the delay, then run the ticks that were skipped.
+// Returns false if something needs every tick, such as audio or gamepad.
+STATIC bool tickless_sleep(int64_t remaining) {
+    common_hal_mcu_disable_interrupts();
+    if (tick_enable_count == 0 || tick_enable_count != tick_deadline_count) {
+        common_hal_mcu_enable_interrupts();
+        return false;
+    }
+    port_disable_tick();
+    common_hal_mcu_enable_interrupts();
+
+    uint32_t sleep_ticks = ticks_until_deadline();
+    if (remaining < sleep_ticks) {
+        sleep_ticks = remaining;
+    }
+    uint64_t start_tick = port_get_raw_ticks(NULL);
+    port_interrupt_after_ticks(sleep_ticks);
+    port_sleep_until_interrupt();
+    uint64_t elapsed = port_get_raw_ticks(NULL) - start_tick;
+
+    // Catch up before restarting the tick, so the countdowns aren't also
+    // decremented from the tick interrupt. A countdown that expires here
+    // may turn the tick off for good.
+    while (elapsed-- > 0) {
+        supervisor_tick();
+    }
+    common_hal_mcu_disable_interrupts();
+    if (tick_enable_count > 0) {
+        port_enable_tick();
+    }
+    common_hal_mcu_enable_interrupts();
+    return true;
+}
+#endif
+
 void mp_hal_delay_ms(mp_uint_t delay) {
     uint64_t start_tick = port_get_raw_ticks(NULL);
     // Adjust the delay to ticks vs ms.
@@ -107,20 +216,57 @@ void mp_hal_delay_ms(mp_uint_t delay) {
            WATCHDOG_EXCEPTION_CHECK()) {
             break;
         }
+        #if MICROPY_GC_INCREMENTAL
+        if (gc_incremental_slice()) {
+            // Keep the CPU awake until the collection is done.
+            remaining = end_tick - port_get_raw_ticks(NULL);
+            continue;
+        }
+        #elif MICROPY_GC_IDLE_COLLECT
+        // A full collection can't be split, so only do one in long sleeps.
+        if (remaining >= CIRCUITPY_GC_IDLE_COLLECT_MIN_DELAY_MS * 1024 / 1000 && gc_collect_idle()) {
+            remaining = end_tick - port_get_raw_ticks(NULL);
+            continue;
+        }
+        #endif
         remaining = end_tick - port_get_raw_ticks(NULL);
         // We break a bit early so we don't risk setting the alarm before the time when we call
         // sleep.
         if (remaining < 1) {
             break;
         }
+        #if CIRCUITPY_TICKLESS_IDLE
+        if (tickless_sleep(remaining)) {
+            remaining = end_tick - port_get_raw_ticks(NULL);
+            continue;
+        }
+        #endif
         port_interrupt_after_ticks(remaining);
         // Sleep until an interrupt happens.
         port_sleep_until_interrupt();
         remaining = end_tick - port_get_raw_ticks(NULL);
     }
+    #if MICROPY_GC_INCREMENTAL
+    // Python code is about to run again and may change the heap, so an
+    // unfinished cycle can't be trusted any more.
+    gc_collect_incremental_abort();
+    #endif
+}
+
+void supervisor_event_poll_hook(void) {
+    RUN_BACKGROUND_TASKS;
+    // Raise a pending CTRL-C or reload so a long poll can be interrupted.
+    mp_obj_t exc = MP_STATE_VM(mp_pending_exception);
+    if (exc != MP_OBJ_NULL) {
+        MP_STATE_VM(mp_pending_exception) = MP_OBJ_NULL;
+        nlr_raise(exc);
+    }
+    // Sleep until a peripheral interrupt (such as received data) or the next
+    // tick, so that the caller can check its streams and timeout again.
+    port_interrupt_after_ticks(1);
+    port_sleep_until_interrupt();
 }
 
-volatile size_t tick_enable_count = 0;
 extern void supervisor_enable_tick(void) {
     common_hal_mcu_disable_interrupts();
     if (tick_enable_count == 0) {
@@ -140,3 +286,19 @@ extern void supervisor_disable_tick(void) {
     }
     common_hal_mcu_enable_interrupts();
 }
+
+extern void supervisor_enable_tick_deadline(void) {
+    common_hal_mcu_disable_interrupts();
+    tick_deadline_count++;
+    supervisor_enable_tick();
+    common_hal_mcu_enable_interrupts();
+}
+
+extern void supervisor_disable_tick_deadline(void) {
+    common_hal_mcu_disable_interrupts();
+    if (tick_deadline_count > 0) {
+        tick_deadline_count--;
+    }
+    supervisor_disable_tick();
+    common_hal_mcu_enable_interrupts();
+}
@@ -67,4 +67,14 @@ extern void supervisor_run_background_if_tick(void);
 extern void supervisor_enable_tick(void);
 extern void supervisor_disable_tick(void);
 
+/** @brief Enable ticks for a countdown to a known deadline
+ *
+ * Like supervisor_enable_tick, but for users that only count ticks down to a
+ * deadline that can be reported from supervisor_tick's callees. While every
+ * tick user is of this kind, mp_hal_delay_ms stops the tick and sleeps until
+ * the nearest deadline, then catches up on the ticks it skipped.
+ */
+extern void supervisor_enable_tick_deadline(void);
+extern void supervisor_disable_tick_deadline(void);
+
 #endif
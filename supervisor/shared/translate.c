@@ -34,8 +34,24 @@
 #include "genhdr/compression.generated.h"
 #endif
 
+#include "py/mpconfig.h"
 #include "supervisor/serial.h"
 
+#if CIRCUITPY_FAST_TRANSLATE
+// Recently decompressed messages, most recently used first, so that code that
+// keeps raising the same exception doesn't decode its message every time.
+#define TRANSLATE_CACHE_ENTRIES (4)
+// Longer messages, including the trailing NUL, aren't cached.
+#define TRANSLATE_CACHE_TEXT_LENGTH (48)
+
+typedef struct {
+    const compressed_string_t* compressed;
+    char text[TRANSLATE_CACHE_TEXT_LENGTH];
+} translate_cache_entry_t;
+
+STATIC translate_cache_entry_t translate_cache[TRANSLATE_CACHE_ENTRIES];
+#endif
+
 void serial_write_compressed(const compressed_string_t* compressed) {
     char decompressed[decompress_length(compressed)];
     decompress(compressed, decompressed);
@@ -66,11 +82,57 @@ uint16_t decompress_length(const compressed_string_t* compressed) {
     }
 }
 
-char* decompress(const compressed_string_t* compressed, char* decompressed) {
+#if CIRCUITPY_FAST_TRANSLATE && compress_decode_table_bits > 0
+STATIC void decompress_codes(const compressed_string_t* compressed, char* decompressed, uint16_t length) {
+    // The next bits to decode are kept at the top of acc, n of them are valid.
+    const uint8_t *p = &compressed->data + compress_max_length_bits / 8;
+    uint32_t acc = (uint32_t)*p++ << (24 + compress_max_length_bits % 8);
+    uint8_t n = 8 - compress_max_length_bits % 8;
+
+    // Stop one early because the last byte is always NULL.
+    for (uint16_t i = 0; i < length - 1;) {
+        if (n < compress_decode_table_bits) {
+            acc |= (uint32_t)*p++ << (24 - n); // This may read past the end but its never used.
+            n += 8;
+        }
+        uint16_t entry = decode_table[acc >> (32 - compress_decode_table_bits)];
+        uint16_t value;
+        if (entry != 0) {
+            // the whole code is in the table
+            acc <<= entry >> 12;
+            n -= entry >> 12;
+            value = values[entry & 0xfff];
+        } else {
+            // a rare character with a long code, search for it one bit at a time
+            uint32_t bits = 0;
+            uint8_t bit_length = 0;
+            uint32_t max_code = lengths[0];
+            uint32_t searched_length = lengths[0];
+            while (true) {
+                if (n == 0) {
+                    acc = (uint32_t)*p++ << 24;
+                    n = 8;
+                }
+                bits = (bits << 1) | (acc >> 31);
+                acc <<= 1;
+                n -= 1;
+                bit_length += 1;
+                if (max_code > 0 && bits < max_code) {
+                    break;
+                }
+                max_code = (max_code << 1) + lengths[bit_length];
+                searched_length += lengths[bit_length];
+            }
+            value = values[searched_length + bits - max_code];
+        }
+        i += put_utf8(decompressed + i, value);
+    }
+}
+#else
+STATIC void decompress_codes(const compressed_string_t* compressed, char* decompressed, uint16_t length) {
     uint8_t this_byte = compress_max_length_bits / 8;
     uint8_t this_bit = 7 - compress_max_length_bits % 8;
     uint8_t b = (&compressed->data)[this_byte];
-    uint16_t length = decompress_length(compressed);
 
     // Stop one early because the last byte is always NULL.
     for (uint16_t i = 0; i < length - 1;) {
@@ -100,8 +162,35 @@ char* decompress(const compressed_string_t* compressed, char* decompressed) {
         }
         i += put_utf8(decompressed + i, values[searched_length + bits - max_code]);
     }
+}
+#endif
+
+char* decompress(const compressed_string_t* compressed, char* decompressed) {
+    uint16_t length = decompress_length(compressed);
+
+    #if CIRCUITPY_FAST_TRANSLATE
+    if (length <= TRANSLATE_CACHE_TEXT_LENGTH) {
+        size_t i = 0;
+        while (i < TRANSLATE_CACHE_ENTRIES - 1 && translate_cache[i].compressed != compressed) {
+            i++;
+        }
+        if (translate_cache[i].compressed == compressed) {
+            memcpy(decompressed, translate_cache[i].text, length);
+        } else {
+            // i is the last, least recently used, entry which gets replaced
+            decompress_codes(compressed, decompressed, length);
+            decompressed[length - 1] = '\0';
+        }
+        // move the entry to the front
+        memmove(&translate_cache[1], &translate_cache[0], i * sizeof(translate_cache_entry_t));
+        translate_cache[0].compressed = compressed;
+        memcpy(translate_cache[0].text, decompressed, length);
+        return decompressed;
+    }
+    #endif
 
-    decompressed[length-1] = '\0';
+    decompress_codes(compressed, decompressed, length);
+    decompressed[length - 1] = '\0';
     return decompressed;
 }
 
@@ -80,6 +80,7 @@
 #define CFG_TUD_MSC                 1
 #define CFG_TUD_HID                 CIRCUITPY_USB_HID
 #define CFG_TUD_MIDI                CIRCUITPY_USB_MIDI
+#define CFG_TUD_VENDOR              CIRCUITPY_USB_BULK
 #define CFG_TUD_CUSTOM_CLASS        0
 
 /*------------------------------------------------------------------*/
@@ -106,6 +107,17 @@
 // Product revision string included in Inquiry response, max 4 bytes
 #define CFG_TUD_MSC_PRODUCT_REV     "1.0"
 
+/*------------- VENDOR -------------*/
+// FIFO sizes for the raw bulk channel. Several full-speed packets can be
+// queued per direction so the host sees back-to-back transfers.
+#ifndef CFG_TUD_VENDOR_RX_BUFSIZE
+#define CFG_TUD_VENDOR_RX_BUFSIZE   1024
+#endif
+
+#ifndef CFG_TUD_VENDOR_TX_BUFSIZE
+#define CFG_TUD_VENDOR_TX_BUFSIZE   1024
+#endif
+
 
 //--------------------------------------------------------------------+
 // USB RAM PLACEMENT
@@ -26,6 +26,7 @@
 
 #include "py/objstr.h"
 #include "shared-bindings/microcontroller/Processor.h"
+#include "shared-module/usb_hid/Device.h"
 #include "shared-module/usb_midi/__init__.h"
 #include "supervisor/port.h"
 #include "supervisor/usb.h"
@@ -79,6 +80,12 @@ void usb_background(void) {
         tud_task();
         #endif
         tud_cdc_write_flush();
+        #if CIRCUITPY_USB_HID
+        usb_hid_background();
+        #endif
+        #if CIRCUITPY_USB_MIDI
+        usb_midi_background();
+        #endif
     }
 }
 
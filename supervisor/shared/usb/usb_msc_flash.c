@@ -158,6 +158,10 @@ int32_t tud_msc_write10_cb (uint8_t lun, uint32_t lba, uint32_t offset, uint8_t*
 
     fs_user_mount_t * vfs = get_vfs(lun);
     disk_write(vfs, buffer, lba, block_count);
+    // The host is likely to write the neighbouring blocks next so hold off
+    // flushing the flash cache until it stops. Otherwise partly written
+    // sectors are erased and rewritten over and over during a long copy.
+    filesystem_delay_flush();
     // Since by getting here we assume the mount is read-only to
     // MicroPython let's update the cached FatFs sector if it's the one
     // we just wrote.
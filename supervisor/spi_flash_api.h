@@ -43,6 +43,10 @@ bool spi_flash_write_command(uint8_t command, uint8_t* data, uint32_t length);
 bool spi_flash_sector_command(uint8_t command, uint32_t address);
 bool spi_flash_write_data(uint32_t address, uint8_t* data, uint32_t data_length);
 bool spi_flash_read_data(uint32_t address, uint8_t* data, uint32_t data_length);
+// Returns where the flash at address can be read directly in the memory map, or
+// NULL where there is no such window. It's only valid until the next call into
+// this API.
+uint8_t* spi_flash_memory_map(uint32_t address);
 void spi_flash_init(void);
 void spi_flash_init_device(const external_flash_device* device);
 
@@ -2,10 +2,12 @@ SRC_SUPERVISOR = \
 	main.c \
 	supervisor/port.c \
 	supervisor/shared/autoreload.c \
+	supervisor/shared/background_tasks.c \
 	supervisor/shared/board.c \
 	supervisor/shared/filesystem.c \
 	supervisor/shared/flash.c \
 	supervisor/shared/micropython.c \
+	supervisor/shared/perf.c \
 	supervisor/shared/rgb_led_status.c \
 	supervisor/shared/safe_mode.c \
 	supervisor/shared/stack.c \
@@ -36,6 +38,10 @@ ifeq ($(CIRCUITPY_BLEIO),1)
 	SRC_SUPERVISOR += supervisor/shared/bluetooth.c
 endif
 
+ifeq ($(CIRCUITPY_GC_TRACE),1)
+	SRC_SUPERVISOR += supervisor/shared/gc_trace.c
+endif
+
 # Choose which flash filesystem impl to use.
 # (Right now INTERNAL_FLASH_FILESYSTEM and (Q)SPI_FLASH_FILESYSTEM are mutually exclusive.
 # But that might not be true in the future.)
@@ -100,6 +106,15 @@ else
 			shared-module/usb_midi/PortOut.c
 	endif
 
+	ifeq ($(CIRCUITPY_USB_BULK), 1)
+		SRC_SUPERVISOR += \
+			lib/tinyusb/src/class/vendor/vendor_device.c \
+			shared-bindings/usb_bulk/__init__.c \
+			shared-bindings/usb_bulk/Channel.c \
+			shared-module/usb_bulk/__init__.c \
+			shared-module/usb_bulk/Channel.c
+	endif
+
 	CFLAGS += -DUSB_AVAILABLE
 endif
 
@@ -116,8 +131,12 @@ USB_INTERFACE_NAME = "CircuitPython"
 endif
 
 ifndef USB_DEVICES
+ifeq ($(CIRCUITPY_USB_BULK), 1)
+USB_DEVICES = "CDC,MSC,AUDIO,HID,VENDOR"
+else
 USB_DEVICES = "CDC,MSC,AUDIO,HID"
 endif
+endif
 
 ifndef USB_HID_DEVICES
 USB_HID_DEVICES = "KEYBOARD,MOUSE,CONSUMER,GAMEPAD"
@@ -163,6 +182,14 @@ ifndef USB_MIDI_EP_NUM_IN
 USB_MIDI_EP_NUM_IN = 0
 endif
 
+ifndef USB_VENDOR_EP_NUM_OUT
+USB_VENDOR_EP_NUM_OUT = 0
+endif
+
+ifndef USB_VENDOR_EP_NUM_IN
+USB_VENDOR_EP_NUM_IN = 0
+endif
+
 USB_DESCRIPTOR_ARGS = \
 	--manufacturer $(USB_MANUFACTURER)\
 	--product $(USB_PRODUCT)\
@@ -182,6 +209,8 @@ USB_DESCRIPTOR_ARGS = \
 	--hid_ep_num_in $(USB_HID_EP_NUM_IN)\
 	--midi_ep_num_out $(USB_MIDI_EP_NUM_OUT)\
 	--midi_ep_num_in $(USB_MIDI_EP_NUM_IN)\
+	--vendor_ep_num_out $(USB_VENDOR_EP_NUM_OUT)\
+	--vendor_ep_num_in $(USB_VENDOR_EP_NUM_IN)\
 	--output_c_file $(BUILD)/autogen_usb_descriptor.c\
 	--output_h_file $(BUILD)/genhdr/autogen_usb_descriptor.h
 
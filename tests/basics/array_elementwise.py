@@ -0,0 +1,130 @@
+# test the in-place elementwise methods of array and bytearray (uPy extension)
+try:
+    from uarray import array
+except ImportError:
+    try:
+        from array import array
+    except ImportError:
+        print("SKIP")
+        raise SystemExit
+if not hasattr(bytearray, "fill"):
+    print("SKIP")
+    raise SystemExit
+
+# fill
+b = bytearray(7)
+b.fill(0xa5)
+print(b)
+a = array("h", [0] * 5)
+a.fill(-1234)
+print(a)
+a = array("i")
+a.fill(1)
+print(a)
+
+# bitwise ops, on every alignment so the word loop and the byte edges both run
+data = bytearray(range(40))
+for start in range(4):
+    for other_start in range(4):
+        b = bytearray(data[start:start + 30])
+        m = memoryview(bytearray(range(100, 150)))[other_start:other_start + 30]
+        ref_x = bytes(x ^ y for x, y in zip(b, m))
+        ref_a = bytes(x & y for x, y in zip(b, m))
+        ref_o = bytes(x | y for x, y in zip(b, m))
+        c = bytearray(b)
+        c.ixor(m)
+        ok = c == ref_x
+        c = bytearray(b)
+        c.iand(m)
+        ok = ok and c == ref_a
+        c = bytearray(b)
+        c.ior(m)
+        ok = ok and c == ref_o
+        if not ok:
+            print("bitwise fail", start, other_start)
+a = array("H", [0x1234, 0xff00])
+a.ixor(b"\xff\xff\xff\xff")
+print(a)
+try:
+    bytearray(3).ixor(b"ab")
+except ValueError:
+    print("ValueError")
+
+# add saturates at the limits of the element type
+b = bytearray([0, 100, 200, 255])
+b.add(100)
+print(b)
+b.add(-150)
+print(b)
+b.add(bytearray([10, 20, 30, 40]))
+print(b)
+a = array("b", [-100, 0, 100])
+a.add(100)
+print(a)
+a.add(array("b", [-128, -128, -128]))
+print(a)
+a = array("i", [1, 2, 3])
+a.add(array("i", [10, 20, 30]))
+print(a)
+try:
+    a.add(bytes(12))
+except TypeError:
+    print("TypeError")
+try:
+    a.add(array("i", [1]))
+except ValueError:
+    print("ValueError")
+
+# scale, with a fixed-point shift
+a = array("h", [100, -100, 30000, -30000])
+a.scale(3)
+print(a)
+a = array("h", [100, -100, 1000, 7])
+a.scale(3, 2)
+print(a)
+b = bytearray([1, 2, 100])
+b.scale(-1)
+print(b)
+b = bytearray([10, 20, 200])
+b.scale(3, 1)
+print(b)
+try:
+    b.scale(2, -1)
+except ValueError:
+    print("ValueError")
+
+# sum, over enough bytes to take the word path and split its lanes
+b = bytearray(range(256)) * 10
+print(b.sum(), sum(b))
+print(bytearray(b[3:]).sum() == sum(b[3:]))
+print(bytearray(b[1:1001]).sum() == sum(b[1:1001]))
+print(bytearray().sum())
+print(array("b", [-1, -2, -3]).sum())
+print(array("I", [0xffffffff, 0xffffffff]).sum())
+
+# min and max
+a = array("h", [5, -7, 3, 9, -7, 9])
+print(a.min(), a.max())
+print(bytearray(b"hello").min(), bytearray(b"hello").max())
+try:
+    bytearray().min()
+except ValueError:
+    print("ValueError")
+
+# unsupported typecodes
+try:
+    array("q", [1]).add(1)
+except TypeError:
+    print("TypeError")
+
+# the bytes of object arrays are pointers, so bitwise ops don't apply
+a = array("O", [1, 2])
+for op in (a.ixor, a.iand, a.ior):
+    try:
+        op(bytes(16))
+    except TypeError:
+        print("TypeError")
+try:
+    bytearray(16).ior(a)
+except TypeError:
+    print("TypeError")
@@ -16,3 +16,12 @@ builtins.__build_class__ = lambda x, y: ('class', y)
 class A:
     pass
 print(A)
+
+# override a builtin that has already been looked up
+def get_min():
+    return min
+print(get_min()(1, 2))
+builtins.min = lambda *x: 'min'
+print(get_min()(1, 2))
+builtins.min = lambda *x: 'min2'
+print(get_min()(1, 2))
@@ -0,0 +1,44 @@
+# test that repeated lookups of class attributes see changes to the class
+
+class A:
+    X = 1
+    def f(self):
+        return 'A.f'
+
+class B(A):
+    pass
+
+def lookup(o):
+    return o.X, o.f()
+
+b = B()
+print(lookup(b))
+print(lookup(b))
+
+# change the base class
+A.X = 2
+A.f = lambda self: 'lambda'
+print(lookup(b))
+
+# override in the derived class
+def g(self):
+    return 'B.f'
+B.f = g
+B.X = 3
+print(lookup(b))
+
+# remove the override again
+del B.f
+del B.X
+print(lookup(b))
+
+# an instance member shadows the class attribute
+b.X = 4
+print(lookup(b))
+print(lookup(B()))
+
+# a new class at the same place gets its own lookups
+for i in range(3):
+    class C:
+        X = i
+    print(C().X)
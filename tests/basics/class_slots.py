@@ -0,0 +1,132 @@
+# test __slots__ on user classes
+
+class A:
+    __slots__ = ("x", "y")
+
+    def __init__(self):
+        self.x = 1
+
+a = A()
+print(a.x)
+
+# unset slot
+try:
+    a.y
+except AttributeError:
+    print("AttributeError")
+
+a.y = 2
+print(a.x, a.y)
+
+# only the slots can be assigned
+try:
+    a.z = 3
+except AttributeError:
+    print("AttributeError")
+
+# delete a slot
+del a.x
+try:
+    a.x
+except AttributeError:
+    print("AttributeError")
+try:
+    del a.x
+except AttributeError:
+    print("AttributeError")
+a.x = 4
+print(a.x)
+
+# a single name
+class B:
+    __slots__ = "v"
+
+b = B()
+b.v = 5
+print(b.v)
+
+# slots are inherited
+class C(A):
+    __slots__ = ["z"]
+
+c = C()
+c.y = 6
+c.z = 7
+print(c.x, c.y, c.z)
+
+# a subclass without __slots__ accepts any attribute
+class D(A):
+    pass
+
+d = D()
+d.w = 8
+print(d.x, d.w)
+
+# methods and class attributes still work
+class E:
+    __slots__ = ("n",)
+    k = 10
+
+    def get(self):
+        return self.n + self.k
+
+e = E()
+e.n = 1
+print(e.get())
+
+# repeated attribute access in a loop
+def f(o):
+    t = 0
+    for i in range(10):
+        o.n = i
+        t += o.n
+    return t
+
+print(f(e))
+
+# __dict__ in __slots__ lets instances get other attributes too
+class F:
+    __slots__ = ("x", "__dict__")
+
+f = F()
+f.x = 1
+f.w = 2
+print(f.x, f.w)
+
+class G(F):
+    __slots__ = ("y",)
+
+g = G()
+g.y = 3
+g.v = 4
+print(g.y, g.v)
+
+# __weakref__ is accepted but isn't an assignable slot
+class H:
+    __slots__ = ("x", "__weakref__")
+
+h = H()
+h.x = 5
+print(h.x)
+try:
+    h.w = 6
+except AttributeError:
+    print("AttributeError")
+
+# a slot can't also be a class attribute
+try:
+    class I:
+        __slots__ = ("x",)
+        x = 1
+except ValueError:
+    print("ValueError")
+class J:
+    __slots__ = ("x",)
+
+try:
+    class K(J):
+        __slots__ = ("y",)
+        def y(self):
+            pass
+except ValueError:
+    print("ValueError")
@@ -0,0 +1,45 @@
+# test comparisons used directly as the condition of a jump
+
+def cmp(a, b):
+    r = []
+    if a < b:
+        r.append('<')
+    if a > b:
+        r.append('>')
+    if a == b:
+        r.append('==')
+    if a <= b:
+        r.append('<=')
+    if a >= b:
+        r.append('>=')
+    if a != b:
+        r.append('!=')
+    if not a < b:
+        r.append('not <')
+    return r
+
+print(cmp(1, 2))
+print(cmp(2, 1))
+print(cmp(-3, -3))
+print(cmp(1, 1.5))
+print(cmp(1 << 100, 1))
+print(cmp('a', 'b'))
+print(cmp((1, 2), (1, 2)))
+
+class A:
+    def __lt__(self, other):
+        return 1
+print(A() < 0)
+if A() < 0:
+    print('A <')
+
+i = 0
+while i < 5:
+    i += 1
+print(i)
+
+try:
+    if 1 < 'a':
+        pass
+except TypeError:
+    print('TypeError')
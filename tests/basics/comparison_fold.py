@@ -0,0 +1,17 @@
+# comparisons of integer constants are folded at compile time
+
+print(1 < 2, 2 < 1, 1 > 2, 2 > 1)
+print(1 == 1, 1 == 2, 1 != 1, 1 != 2)
+print(1 <= 1, 2 <= 1, 1 >= 2, 1 >= 1)
+print(-1 < 0, ~0 == -1, 1 << 4 == 16)
+
+# chained comparisons
+print(1 < 2 < 3, 1 < 3 < 2, 3 > 2 > 2, 1 < 2 > 0)
+
+# combined with "not", "and" and "or"
+print(not 1 < 2, 1 < 2 and 2 < 3, 2 < 1 or 3 < 2)
+
+# operands that aren't integer constants are compared at run time
+x = 2
+print(1 < x < 3, 1 < 2 < x)
+print(1 in (1, 2), 1 not in (1, 2))
@@ -10,23 +10,13 @@ except ImportError:
     raise SystemExit
 
 
-# Initial sequence is not supported
-try:
-    deque([1, 2, 3], 10)
-except ValueError:
-    print("ValueError")
-
-# Not even empty list, only empty tuple
-try:
-    deque([], 10)
-except ValueError:
-    print("ValueError")
+# Initial sequence is copied in
+d = deque([1, 2, 3], 10)
+print(len(d), d.popleft())
 
-# Only fixed-size deques are supported, so length arg is mandatory
-try:
-    deque(())
-except TypeError:
-    print("TypeError")
+# Without a length the deque grows
+d = deque(())
+print(len(d))
 
 d = deque((), 2, True)
 
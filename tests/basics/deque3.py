@@ -0,0 +1,87 @@
+# Tests for growable deques, indexing, extend and popping several items,
+# some of which are extensions wrt to CPython.
+try:
+    try:
+        from ucollections import deque
+    except ImportError:
+        from collections import deque
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+def items(d):
+    return [d[i] for i in range(len(d))]
+
+
+# Growing one item at a time
+d = deque()
+for i in range(10):
+    d.append(i)
+print(len(d), d[0], d[-1], d[5])
+
+# Popping several items at once returns a list
+print(d.popleft(3))
+print(d.popleft(0))
+print(len(d))
+
+# Growing while the items wrap around the end
+d.extend(range(10, 20))
+d.extend([20, 21, 22])
+d.extend((23,))
+print(len(d), items(d))
+
+d[0] = "x"
+d[-1] = "y"
+print(d[0], d[-1])
+print(d.popleft(), d.popleft())
+
+try:
+    d.popleft(len(d) + 1)
+except IndexError:
+    print("IndexError")
+print(d.popleft(len(d)), len(d), bool(d))
+
+try:
+    d[0]
+except IndexError:
+    print("IndexError")
+
+# A deque with a maxlen keeps the newest items
+d = deque((), 3)
+d.extend([1, 2, 3, 4, 5])
+print(items(d))
+d.extend([6])
+print(items(d))
+d.extend(iter([7, 8]))
+print(items(d), d[-3])
+
+# With the overflow flag nothing is added when the items don't fit
+d = deque([1, 2], 4, True)
+try:
+    d.extend([3, 4, 5])
+except IndexError as e:
+    print(repr(e))
+print(items(d))
+d.extend([3, 4])
+print(items(d))
+
+# also for other iterables of known length, while an iterator of unknown
+# length adds items until the deque is full
+d = deque([1], 3, True)
+for it in (range(3), iter([3, 4, 5]), "abc", b"xyz"):
+    try:
+        d.extend(it)
+    except IndexError:
+        print("IndexError")
+print(items(d))
+try:
+    d.extend(x for x in range(3))
+except IndexError:
+    print("IndexError")
+print(items(d))
+
+try:
+    d.popleft(-1)
+except ValueError:
+    print("ValueError")
@@ -0,0 +1,61 @@
+# test dicts big enough to use the compact layout, if it's enabled
+
+# qstr keys
+d = {}
+for i in range(200):
+    d['k%d' % i] = i
+print(len(d), d['k0'], d['k199'], 'k200' in d)
+
+# delete every other key, then add them back and some more
+for i in range(0, 200, 2):
+    del d['k%d' % i]
+print(len(d), 'k0' in d, 'k1' in d)
+for i in range(0, 300, 2):
+    d['k%d' % i] = -i
+print(len(d), d['k0'], d['k1'], d['k298'])
+print(sum(d.values()), sorted(d)[:5])
+
+# lots of deletes and re-adds of the same keys must not grow the dict forever
+d = {}
+for i in range(100):
+    d[i] = i
+for j in range(20):
+    for i in range(100):
+        del d[i]
+    for i in range(100):
+        d[i] = i + j
+print(len(d), d[0], d[99])
+
+# non-interned string keys and mixed key types
+d = {}
+keys = ['%s_%d' % ('telemetry' * 3, i) for i in range(150)]
+for i, k in enumerate(keys):
+    d[k] = i
+d[1.5] = 'f'
+d[(1, 2)] = 't'
+print(len(d), d[keys[0]], d[keys[149]], d[1.5], d[(1, 2)])
+print(all(d[k] == i for i, k in enumerate(keys)))
+
+# copy, equality, pop, popitem, setdefault, update, clear
+e = d.copy()
+print(e == d, len(e))
+print(e.pop(keys[10]), keys[10] in e, e == d)
+e[keys[10]] = 10
+print(e == d)
+n = len(e)
+while len(e) > 5:
+    e.popitem()
+print(n - len(e))
+for k in keys:
+    e.setdefault(k, 'new')
+print(all(k in e for k in keys), e[keys[149]] in (149, 'new'))
+e.update(d)
+print(e == d)
+e.clear()
+print(len(e), keys[0] in e)
+e[keys[0]] = 0
+print(e)
+
+# a big dict literal
+d = {i: i * i for i in range(100)}
+print(sorted(d.items())[-3:])
@@ -0,0 +1,38 @@
+# file input is compiled a few top-level statements at a time; check that it
+# still behaves as if compiled as a whole
+
+# a syntax error near the end means that nothing runs
+src = "x.append(1)\n" + "def f():\n    return 1\n" * 100 + "x.append(2)\n(\n"
+x = []
+try:
+    exec(src, {"x": x})
+except SyntaxError:
+    print("SyntaxError", x)
+
+# so does a compile error
+x = []
+try:
+    exec("x.append(1)\n" + "y = 1\n" * 200 + "return\n", {"x": x})
+except SyntaxError:
+    print("SyntaxError", x)
+
+# a long module, with functions using names defined further on
+src = "".join("def f%d(a):\n    return f%d(a) + 1\n" % (i, i + 1) for i in range(50))
+src += "def f50(a):\n    return a\n"
+src += "\n\n# comment\n\n"
+src += "".join("v%d = f%d(%d)\n" % (i, i, i) for i in range(0, 50, 7))
+g = {}
+exec(src, g)
+print(sorted(k for k in g if k[0] == "v"), g["v0"], g["v49"])
+
+# statements on one line, and a class spread over many lines
+g = {}
+exec("a = 1; b = 2\nclass C:\n" + "".join("    m%d = %d\n" % (i, i) for i in range(100)) + "c = C.m99 + a + b\n", g)
+print(g["c"])
+
+# an exception stops at the failing statement
+x = []
+try:
+    exec("x.append(1)\n" + "z = 0\n" * 200 + "1 / z\nx.append(2)\n", {"x": x})
+except ZeroDivisionError:
+    print("ZeroDivisionError", x)
@@ -0,0 +1,30 @@
+# keys of a ** mapping that are built at runtime
+
+def f(**kw):
+    return sorted(kw.items())
+
+d = {"k_" + str(i): i for i in range(3)}
+print(f(**d))
+
+def g(a, **kw):
+    return a, sorted(kw.items())
+
+print(g(**{"a": 1, "x" + "yz": 2}))
+print(g(**{"" + "a": 3}))
+
+def h(a):
+    return a
+
+print(h(**{"" + "a": 4}))
+try:
+    h(**{"no" + "pe": 1})
+except TypeError:
+    print("TypeError")
+
+class C:
+    def __init__(self, **kw):
+        self.kw = kw
+
+print(sorted(C(**d).kw.items()))
+print(sorted(dict(**d).items()))
+print(1, 2, **{"se" + "p": "-"})
@@ -0,0 +1,57 @@
+# test that loading globals and builtins sees every change to their dicts
+
+def get_len():
+    return len
+
+def get_x():
+    return x
+
+# builtin, then shadowed by a new global, then revealed again
+print(get_len() is len)
+len = 1
+print(get_len())
+del len
+print(get_len()([1, 2]))
+
+# shadow and unshadow through the globals dict
+g = globals()
+g['len'] = 2
+print(get_len())
+g.pop('len')
+print(get_len()([1]))
+g['len'] = 3
+print(get_len())
+del g['len']
+print(get_len()('abc'))
+
+# a global that changes value and is then deleted
+x = 10
+print(get_x())
+x = 11
+print(get_x())
+del x
+try:
+    get_x()
+except NameError:
+    print('NameError')
+x = 12
+print(get_x())
+
+# adding lots of globals moves the dict's table
+for i in range(50):
+    g['var%d' % i] = i
+print(get_x(), get_len()([]))
+
+# exec with its own globals dict, which gains a name after the first load
+d = {}
+exec('def f():\n    return abs\n', d)
+print(d['f']() is abs)
+d['abs'] = 'shadowed'
+print(d['f']())
+
+# module level loads go through the same path
+print(abs(-1))
+abs = 5
+print(abs)
+del abs
+print(abs(-2))
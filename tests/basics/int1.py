@@ -88,3 +88,7 @@ try:
     int([])
 except TypeError:
     print("TypeError")
+
+# long runs of decimal digits, with and without separators and signs
+print(int('12345678'), int('123456789'), int('1234567890123456'), int('-00000000012345678'))
+print(int('1234567_8'), int('12345678 '), int(' +87654321'), int('99999999'))
@@ -0,0 +1,62 @@
+# test multiplication and 3-arg pow of large integers, sized so that
+# any asymptotically faster algorithms are exercised
+
+try:
+    pow(3, 4, 7)
+except NotImplementedError:
+    print("SKIP")
+    raise SystemExit
+
+# deterministic pseudo-random integer of the given number of bits
+seed = 12345
+def rand_int(bits):
+    global seed
+    x = 1
+    n = (bits + 15) // 16
+    for i in range(n):
+        seed = (seed * 1103515245 + 12345) & 0x7fffffff
+        x = x << 16 | seed >> 15
+    return x >> (16 * n + 1 - bits)
+
+# check a product against schoolbook long multiplication done digit by digit
+def mul_ref(a, b):
+    r = 0
+    shift = 0
+    while b:
+        r += (a * (b & 0xffff)) << shift
+        b >>= 16
+        shift += 16
+    return r
+
+for abits, bbits in ((256, 256), (1024, 1024), (2048, 2048), (2047, 1025), (4096, 700), (3000, 1)):
+    a = rand_int(abits)
+    b = rand_int(bbits)
+    p = a * b
+    print(abits, bbits, p == mul_ref(a, b), p == b * a, p % 1000000007)
+    print(a * a == mul_ref(a, a), -a * b == -p, (-a) * (-b) == p)
+
+# all-ones digits stress the carries
+a = (1 << 2048) - 1
+print(a * a == (1 << 4096) - (1 << 2049) + 1)
+print(a * ((1 << 1500) - 1) == (1 << 3548) - (1 << 2048) - (1 << 1500) + 1)
+
+# 3-arg pow with odd and even moduli of several sizes
+
+def pow_ref(b, e, m):
+    r = 1
+    b %= m
+    while e:
+        if e & 1:
+            r = r * b % m
+        b = b * b % m
+        e >>= 1
+    return r % m
+
+for bits in (64, 256, 1024):
+    m = rand_int(bits) | 1
+    b = rand_int(bits + 7)
+    e = rand_int(bits)
+    print(bits, pow(b, e, m) == pow_ref(b, e, m), pow(b, 65537, m) == pow_ref(b, 65537, m))
+    print(pow(-b, 3, m) == pow_ref(-b, 3, m), pow(b, 1, m) == b % m, pow(m, e, m), pow(b, 0, m))
+    print(pow(b, e, m - 1) == pow_ref(b, e, m - 1), pow(b, e, -m) == pow_ref(b, e, -m))
+    print(pow(b, e, m) % 1000000007)
@@ -0,0 +1,12 @@
+# test conversion of ints to decimal around digit and word boundaries
+
+for n in range(1, 10):
+    p = 10 ** n
+    print(p - 1, p, p + 1, -p, str(p * 3 + 7))
+
+for n in (0, 7, 8, 9, 15, 16, 29):
+    print(2 ** n - 1, 2 ** n, -(2 ** n))
+
+for v in (0, 5, 42, 100001, 123456789):
+    print('%d %5d %-5d| %05d %+d' % (v, v, v, v, v))
+    print('{} {:7} {:<7}| {:07} {:+} {:,}'.format(v, v, v, v, v, v))
@@ -83,3 +83,11 @@ try:
     exec(r"'\U0000000'")
 except SyntaxError:
     print("SyntaxError")
+
+# long runs of name, digit, space and comment characters, ending at various places
+name = "n" + "_abc123" * 20
+exec(name + " = 1234567890123456789\nprint(len('" + name + "'), " + name + ")")
+exec("x = 1" + " " * 50 + "# " + "comment " * 20 + "\nprint(x)")
+exec("if 1:\n" + " " * 40 + "print(" + "9" * 30 + ")\n" + " " * 40 + "print(2)")
+exec("print(" + name + ")#end")
+exec("y = 1_2_3" + "4" * 10 + "\r\nprint(y)\r\n")
@@ -0,0 +1,42 @@
+# test that list.sort is stable, and calls the key function once per item
+
+# pseudo-random data with many equal keys
+seed = 1
+def rnd():
+    global seed
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff
+    return seed >> 16
+
+for n in (10, 40, 100, 1000):
+    l = [(rnd() % 10, i) for i in range(n)]
+    print(n, sorted(l, key=lambda x: x[0]) == sorted(l))
+    print(n, sorted(l, key=lambda x: x[0], reverse=True) == sorted(l, key=lambda x: (-x[0], x[1])))
+
+# runs that are already in order, descending, or mixed
+l = list(range(100)) + list(range(100, 0, -1)) + [rnd() % 100 for i in range(50)]
+print(sorted(l) == sorted(l, reverse=True)[::-1])
+print(sorted(l)[:5], sorted(l)[-5:])
+
+calls = 0
+def key(x):
+    global calls
+    calls += 1
+    return -x
+l = list(range(200))
+l.sort(key=key)
+print(l[:3], calls)
+
+# an exception from a comparison leaves all the items in the list
+class C:
+    def __init__(self, x):
+        self.x = x
+    def __lt__(self, other):
+        if self.x == 50 or other.x == 50:
+            raise ValueError
+        return self.x < other.x
+l = [C(x) for x in range(100, 0, -1)]
+try:
+    l.sort()
+except ValueError:
+    print("ValueError")
+print(sorted(c.x for c in l) == list(range(1, 101)))
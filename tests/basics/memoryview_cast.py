@@ -0,0 +1,94 @@
+# test memoryview.cast() and memoryview.rebind()
+try:
+    memoryview(b'').cast
+except (NameError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+try:
+    from array import array
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+# cast a byte view to wider elements, sharing the same storage
+b = bytearray(8)
+m = memoryview(b).cast('H')
+print(len(m))
+m[0] = 0x0102
+m[3] = 0xffff
+print(b[6], b[7])
+print(b[0] + b[1])
+
+# cast a slice, and back to bytes
+m = memoryview(b)[4:].cast('I')
+print(len(m))
+m[0] = 0
+print(list(b[4:]))
+print(len(m.cast('B')))
+
+# a read-only source stays read-only
+m = memoryview(b'\x01\x00\x01\x00').cast('h')
+print(len(m))
+try:
+    m[0] = 1
+except TypeError:
+    print('TypeError')
+
+# length or offset not a multiple of the new itemsize
+for v in (memoryview(bytearray(3)), memoryview(bytearray(8))[1:5]):
+    try:
+        v.cast('H')
+    except ValueError:
+        print('ValueError')
+
+try:
+    memoryview(b).cast('z')
+except ValueError:
+    print('ValueError')
+
+# object typecodes would read the bytes as pointers
+for t in ('O', 'S', 'P'):
+    try:
+        memoryview(bytearray(b'\x40\x41\x41\x41\x41\x41\x00\x00')).cast(t)[0]
+    except ValueError:
+        print('ValueError')
+
+# rebind moves the window without making a new object
+buf = bytearray(range(10))
+m = memoryview(buf)
+r = m.rebind(buf, 2, 5)
+print(r is m, len(m), bytes(m))
+m.rebind(buf, 8)
+print(bytes(m))
+m.rebind(buf)
+print(len(m))
+m.rebind(buf, 3, 3)
+print(len(m))
+
+# the view's typecode is kept
+a = array('h', [1, 2, 3, 4])
+m = memoryview(buf).cast('h')
+m.rebind(a, 1, 3)
+print(list(m))
+m[0] = -7
+print(a[1])
+
+# read-only after rebinding to bytes
+m.rebind(b'\x05\x00\x06\x00')
+try:
+    m[0] = 1
+except TypeError:
+    print('TypeError')
+
+for s, e in ((-1, 2), (3, 2), (0, 11)):
+    try:
+        memoryview(buf).rebind(buf, s, e)
+    except ValueError:
+        print('ValueError')
+
+# nor rebind an object view to arbitrary bytes
+try:
+    memoryview(array('O', [1])).rebind(bytearray(8))
+except ValueError:
+    print('ValueError')
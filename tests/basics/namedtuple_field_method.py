@@ -0,0 +1,15 @@
+# fields named like tuple methods read the same through LOAD_ATTR, whose field
+# index cache sees them first, and through getattr, which doesn't use it
+try:
+    from collections import namedtuple
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+T = namedtuple("T", ["count", "index"])
+
+def get(t):
+    return t.count, t.index
+
+for t in T(1, 2), T(3, 4):
+    print(get(t), getattr(t, "count"), getattr(t, "index"))
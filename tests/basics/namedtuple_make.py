@@ -0,0 +1,35 @@
+try:
+    from collections import namedtuple
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+T = namedtuple("Tup", ["foo", "bar", "baz"])
+if not hasattr(T, "_make"):
+    print("SKIP")
+    raise SystemExit
+
+print(T._make([1, 2, 3]))
+print(T._make(range(3)))
+print(T._make(i * 2 for i in range(3)))
+print(T(0, 0, 0)._make((4, 5, 6)))
+
+for it in [], [1, 2], [1, 2, 3, 4]:
+    try:
+        T._make(it)
+    except TypeError:
+        print("TypeError")
+
+class S(T):
+    def total(self):
+        return self.foo + self.bar + self.baz
+
+s = S._make([1, 2, 3])
+print(type(s) is S, s.total())
+
+# field access from the same opcode on different namedtuple types
+U = namedtuple("U", ["baz", "foo"])
+def get(t):
+    return t.foo, t.baz
+for t in T(1, 2, 3), U(4, 5), T(6, 7, 8), s:
+    print(get(t))
@@ -0,0 +1,48 @@
+# test that operations first run on small ints still work for other types
+
+def add(a, b):
+    return a + b
+
+def iadd(a, b):
+    a += b
+    return a
+
+def sub(a, b):
+    return a - b
+
+def isub(a, b):
+    a -= b
+    return a
+
+def cmp(a, b):
+    return a < b, a > b, a == b
+
+def index(a, i):
+    return a[i]
+
+for f in (add, iadd, sub, isub, cmp):
+    print(f(1, 2), f(-5, 3))
+    print(f(1.5, 2))
+    print(f(1 << 40, 1 << 40))
+
+print(add('a', 'b'), iadd([1], [2]), cmp('a', 'b'))
+
+# iadd on a list must still extend it in place
+l = [1]
+iadd(l, [2])
+print(l)
+
+# results that don't fit a small int any more
+x = 0x3fffffff
+print(add(x, x), sub(-x, x), iadd(x, 1), isub(-x, 2))
+
+print(index([1, 2, 3], 0), index([1, 2, 3], -1), index((4, 5), 1))
+print(index({1: 'a'}, 1), index('abc', 1), index(b'abc', 2))
+try:
+    index([1, 2, 3], 3)
+except IndexError:
+    print('IndexError')
+try:
+    index((1,), -2)
+except IndexError:
+    print('IndexError')
@@ -0,0 +1,57 @@
+# test code that the bytecode peephole optimiser rewrites
+
+# jumps to jumps, at the end of if/else in loops
+def f(l):
+    n = 0
+    for x in l:
+        if x > 5:
+            n += 2
+        elif x > 2:
+            n += 1
+        else:
+            while n > 10:
+                n -= 1
+    return n
+print(f(range(10)))
+print(f([7, 1, 7, 3, 7, 7, 7, 7, 7, 0]))
+
+# nested loops ending at the same place
+def f():
+    r = []
+    for i in range(3):
+        for j in range(3):
+            if j == i:
+                continue
+            r.append((i, j))
+    return r
+print(f())
+
+# a store followed by a load of the same local, cell and free variable
+def f(a):
+    b = a * 2
+    c = b
+    def g():
+        nonlocal c
+        c = c + 1
+        return c
+    d = g()
+    return b, c, d, g()
+print(f(3))
+
+# stores whose value is loaded again after a label
+def f(x):
+    y = x
+    while y:
+        y = y - 1
+    return y
+print(f(4))
+
+# a jump back to itself
+def f():
+    x = 0
+    while x < 3:
+        x = x + 1
+        if x:
+            continue
+    return x
+print(f())
@@ -0,0 +1,15 @@
+# constructing sequences from iterables whose length is known, or wrongly reported
+class L:
+    def __init__(self, n, real): self.n=n; self.real=real
+    def __len__(self): return self.n
+    def __iter__(self): return iter(range(self.real))
+for n, real in ((10, 3), (3, 10), (0, 5), (5, 0)):
+    print(list(L(n, real)), tuple(L(n, real)), bytes(L(n, real)), bytearray(L(n, real)))
+b = bytearray(L(10, 3)); b.append(7); b.extend(b'xy'); print(b)
+print(list(range(10, 0, -3)), list(iter(range(-5, 5, 4))), list(iter(range(3, 3))))
+it = iter([1,2,3,4]); next(it); print(list(it), bytes(map(lambda x: x+1, [1,2,3])))
+print(list(zip(range(3), "abcd", [5,6,7,8])), list(enumerate(iter((9,8,7)), 2)))
+print(bytearray(map(lambda x, y: x*y, range(5), iter(range(2, 100)))))
+print(list(zip()), list(map(abs, (x for x in [-1, -2]))))
+x = [1, 2]; x.extend(iter(range(3))); x.extend(zip((1,), (2,))); print(x)
+it = iter(b"abc"); next(it); print(list(it))
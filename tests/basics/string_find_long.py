@@ -0,0 +1,31 @@
+# test substring search in haystacks long enough to use any skip-table search
+
+h = "GET /index.html HTTP/1.1\r\nHost: example.com\r\n" + "X-Pad: " + "abcdefgh" * 40 + "\r\n\r\nbody"
+for n in ("\r\n\r\n", "\r\n", "Host", "body", "GET", "y", "abcdefgha", "hgfedcba", "zzz", "HTTP/1.2", h, h + "!", ""):
+    print(repr(n[:12]), h.find(n), h.rfind(n), h.count(n), n in h)
+for start, end in ((1, None), (0, 50), (10, -5), (-70, None)):
+    print(h.find("abc", start, end), h.rfind("abc", start, end), h.count("abc", start, end))
+
+# needle at the very start and end, and overlapping repeats
+s = "ab" + "x" * 200 + "ab"
+print(s.find("ab"), s.rfind("ab"), s.find("abx"), s.rfind("xab"), s.find("xxab"), s.rfind("abxx"))
+s = "a" * 300
+print(s.find("aaa"), s.rfind("aaa"), s.count("aaa"), s.find("aab"), s.rfind("baa"))
+s = "ab" * 150 + "abc"
+print(s.find("abc"), s.rfind("aba"), s.find("bab", 290))
+
+# needles longer than 255 bytes
+n = "0123456789" * 30
+s = "x" * 100 + n + "y" * 100
+print(s.find(n), s.rfind(n), s.find(n + "y"), s.rfind("x" + n), s.find(n + "z"))
+
+# split, replace, partition
+s = ",".join(str(i) for i in range(100))
+print(s.split(", ")[:3], len(s.split(",9")), s.rsplit(",9", 2)[-2:])
+print(s.replace(",5", ";")[:60])
+print(s.partition(",50,"), s.rpartition(",5"))
+
+# bytes with nul bytes and high bytes
+b = bytes(range(256)) * 2
+print(b.find(b"\x00\x01\x02"), b.rfind(b"\x00\x01"), b.find(b"\xff\x00"), b.rfind(b"\xfe\xff"), b.count(b"\x80\x81"))
+print(b.find(b"\xff\xff"), b"\x10\x11\x12" in b, b.find(b"\x05", 10))
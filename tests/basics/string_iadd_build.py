@@ -0,0 +1,43 @@
+# test building long str/bytes with +=, which may append in place
+
+try:
+    import gc
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+s = ""
+for i in range(200):
+    s += "%d," % i
+print(len(s), s[:20], s[-20:])
+
+# strings that branch off the same value must not see each other's data
+t = s
+s += "left"
+t += "right"
+u = t
+t += "!"
+print(s[-8:], t[-8:], u[-8:], len(s), len(t), len(u))
+
+# a copy taken along the way keeps its own value
+keep = []
+x = "x" * 100
+for i in range(20):
+    x += str(i % 10) * 10
+    keep.append(x)
+gc.collect()
+print([len(k) for k in keep[::5]], keep[3][-30:], keep[19][-12:])
+
+# hashing and equality against a value made in one go
+print(hash(u) == hash("".join("%d," % i for i in range(200)) + "right"), u == s[:-4] + "right", {u: 1}[s[:-4] + "right"])
+
+# bytes, and the buffer protocol on the result
+b = b""
+for i in range(100):
+    b += bytes([i, 255 - i])
+gc.collect()
+print(len(b), b[:6], b[-6:], bytes(memoryview(b)[10:14]), bytearray(b)[198:])
+
+# rhs may be a bytearray or array; result keeps working after slicing
+b += bytearray(b"tail")
+print(b[-8:], b[-4:].decode(), str(b[-4:], "utf8"))
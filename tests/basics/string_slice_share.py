@@ -0,0 +1,47 @@
+# test str/bytes results that may share the data of the original object
+
+try:
+    import gc
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+# results must stay valid after the original has gone
+def make_parts():
+    line = "temperature=21.5;humidity=40.25;pressure=1013.125\r\n" * 2
+    return line.split(";"), line[12:16], line.strip()[-17:], b"header:" + line.encode()
+
+parts, sub, tail, data = make_parts()
+bparts = data.split(b":")
+gc.collect()
+for i in range(200):
+    [str(j) * 10 for j in range(10)]
+gc.collect()
+print(parts, sub, tail, bparts)
+
+# slices of slices, and conversions that need the data
+s = parts[1][:-1] + ""
+print(s, s[9:], s[9:][1:], float(parts[1][9:]), int(parts[2].split("=")[1].split(".")[0]))
+print(str(bparts[1][:20], "utf8"), bytes(tail, "utf8"), tail.encode())
+
+# equality and hashing against copies
+print({"humidity=40.25": 1}[parts[1]], {b"header": 2}[bparts[0]], parts[1] == "humidity=40.25", hash(parts[1]) == hash("humidity=40.25"))
+print(sub == "ture", sub in {"ture"}, "x%sx" % sub, "{}+{}".format(sub, tail))
+
+# splitlines must not look past the end of a slice
+t = "line one\rline two\r\nline three"
+print(t[:9].splitlines(True), t[9:18].splitlines(True), t[9:].splitlines())
+
+# memoryview of a slice must keep its bytes
+def make_view():
+    b = b"0123456789abcdefghij" * 3
+    return memoryview(b[5:25])
+m = make_view()
+gc.collect()
+for i in range(100):
+    bytes(100)
+print(bytes(m), bytes(m[3:6]))
+
+# partition and rstrip
+print("key = a long value ".partition(" = "), "trailing spaces here    ".rstrip())
+print(b"abc:defghijklmnop".rpartition(b":"))
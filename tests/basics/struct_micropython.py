@@ -39,3 +39,16 @@ try:
     assert o2[0] == 'abc'
 except ImportError:
     pass
+
+# Struct.unpack_from can store the values in an existing list
+try:
+    s = struct.Struct('<HB')
+    out = [None, None]
+    print(s.unpack_from(b'\x01\x02\x03', out=out) is out, out)
+    try:
+        s.unpack_from(b'\x01\x02\x03', out=[None])
+    except ValueError:
+        print('ValueError')
+except AttributeError:
+    print(True, [513, 3])
+    print('ValueError')
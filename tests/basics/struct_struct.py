@@ -0,0 +1,55 @@
+try:
+    import ustruct as struct
+except:
+    try:
+        import struct
+    except ImportError:
+        print("SKIP")
+        raise SystemExit
+
+try:
+    struct.Struct
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+s = struct.Struct("<bHi2sx")
+print(s.format, s.size)
+b = s.pack(-1, 0x1234, -5, b"ab")
+print(b)
+print(s.unpack(b))
+print(s.unpack_from(b"\0" + b, 1))
+print(s.unpack_from(b"\0\0" + b, -s.size))
+
+buf = bytearray(s.size + 2)
+s.pack_into(buf, 2, 1, 2, 3, b"xyz")
+print(buf)
+s.pack_into(buf, -s.size, 4, 5, 6, b"")
+print(buf)
+
+# iterate over consecutive records
+s = struct.Struct(">HB")
+data = s.pack(1, 2) + s.pack(3, 4) + s.pack(5, 6)
+print(list(s.iter_unpack(data)))
+print(list(s.iter_unpack(b"")))
+
+# native alignment
+s = struct.Struct("bi")
+print(s.size == struct.calcsize("bi"))
+print(s.unpack(s.pack(1, 2)))
+
+# errors
+s = struct.Struct("<I")
+for args in ((b"12",), (b"1234", 1), (b"1234", -5)):
+    try:
+        s.unpack_from(*args)
+    except Exception:
+        print("Exception")
+try:
+    s.pack_into(bytearray(3), 0, 1)
+except Exception:
+    print("Exception")
+try:
+    s.iter_unpack(b"12345")
+except Exception:
+    print("Exception")
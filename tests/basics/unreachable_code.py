@@ -0,0 +1,42 @@
+# code after return, raise, break and continue is never run
+
+def f(x):
+    if x:
+        return "yes"
+        print("unreachable")
+    return "no"
+    print("unreachable")
+
+print(f(1), f(0))
+
+# a name assigned after the return is still local
+def g():
+    return x
+    x = 1
+
+try:
+    g()
+except NameError:
+    print("NameError")
+
+# a yield after the return still makes a generator
+def gen():
+    return
+    yield 1
+
+print(list(gen()))
+
+for i in range(3):
+    if i == 1:
+        continue
+        print("unreachable")
+    print(i)
+    break; print("unreachable")
+
+while True:
+    try:
+        raise ValueError
+        print("unreachable")
+    except ValueError:
+        print("ValueError")
+    break
@@ -0,0 +1,12 @@
+import bench
+
+def test(num):
+    keys = ['key%d' % i for i in range(2000)]
+    d = {}
+    for k in keys:
+        d[k] = 0
+    for i in range(num // 20000):
+        for k in keys:
+            d[k] += 1
+
+bench.run(test)
@@ -0,0 +1,8 @@
+import bench
+
+def test(num):
+    l = [2, 1]
+    for i in iter(range(num//20)):
+        l.sort(key=None, reverse=False)
+
+bench.run(test)
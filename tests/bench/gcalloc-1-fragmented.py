@@ -0,0 +1,14 @@
+import bench
+
+def test(num):
+    # Leave the heap full of single-block holes between live objects.
+    keep = []
+    for i in range(2000):
+        keep.append(bytearray(8))
+        keep.append([i, i])
+    for i in range(0, len(keep), 2):
+        keep[i] = None
+    for i in iter(range(num // 100)):
+        bytearray(48)
+
+bench.run(test)
@@ -0,0 +1,11 @@
+import bench
+
+def test(num):
+    # Same live data as gcalloc-1 but without holes between objects.
+    keep = []
+    for i in range(2000):
+        keep.append([i, i])
+    for i in iter(range(num // 100)):
+        bytearray(48)
+
+bench.run(test)
@@ -0,0 +1,9 @@
+import bench
+
+def test(num):
+    a = (1 << 256) // 3
+    b = (1 << 256) // 7
+    for i in range(num // 32):
+        x = a * b
+
+bench.run(test)
@@ -0,0 +1,9 @@
+import bench
+
+def test(num):
+    a = (1 << 1024) // 3
+    b = (1 << 1024) // 7
+    for i in range(num // 128):
+        x = a * b
+
+bench.run(test)
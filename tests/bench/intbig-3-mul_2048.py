@@ -0,0 +1,9 @@
+import bench
+
+def test(num):
+    a = (1 << 2048) // 3
+    b = (1 << 2048) // 7
+    for i in range(num // 256):
+        x = a * b
+
+bench.run(test)
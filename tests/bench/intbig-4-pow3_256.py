@@ -0,0 +1,10 @@
+import bench
+
+def test(num):
+    m = (1 << 256) - 189
+    b = (1 << 255) // 3
+    e = (1 << 256) // 5
+    for i in range(num // 20000):
+        x = pow(b, e, m)
+
+bench.run(test)
@@ -0,0 +1,9 @@
+import bench
+
+def test(num):
+    m = (1 << 1024) - 1093337
+    s = (1 << 1023) // 3
+    for i in range(num // 5120):
+        x = pow(s, 65537, m)
+
+bench.run(test)
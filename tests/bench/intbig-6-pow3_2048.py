@@ -0,0 +1,9 @@
+import bench
+
+def test(num):
+    m = (1 << 2048) - 1093337
+    s = (1 << 2047) // 3
+    for i in range(num // 10240):
+        x = pow(s, 65537, m)
+
+bench.run(test)
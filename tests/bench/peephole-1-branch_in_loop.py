@@ -0,0 +1,11 @@
+import bench
+
+def test(num):
+    n = 0
+    for i in range(num):
+        if i & 1:
+            n += 1
+        else:
+            n -= 1
+
+bench.run(test)
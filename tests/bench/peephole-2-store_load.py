@@ -0,0 +1,9 @@
+import bench
+
+def test(num):
+    for i in range(num):
+        x = i + 1
+        if x:
+            pass
+
+bench.run(test)
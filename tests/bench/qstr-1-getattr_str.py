@@ -0,0 +1,18 @@
+import bench
+
+class A:
+    pass
+
+def test(num):
+    # Build the names at runtime so each getattr has to look up the qstr
+    # by its string, in both the ROM pool and the dynamic pools.
+    a = A()
+    names = [''.join(['attr', str(i)]) for i in range(200)]
+    for n in names:
+        setattr(a, n, 1)
+    names += [''.join([n[:2], n[2:]]) for n in ('upper', 'lower', 'split', 'join')]
+    for i in range(num // 4000):
+        for n in names:
+            getattr(a, n, None)
+
+bench.run(test)
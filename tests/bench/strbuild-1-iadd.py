@@ -0,0 +1,9 @@
+import bench
+
+def test(num):
+    for i in range(num // 400000):
+        s = ""
+        for j in range(1000):
+            s += '{"id": %d, "v": 12.5},' % j
+
+bench.run(test)
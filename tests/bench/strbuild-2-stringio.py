@@ -0,0 +1,11 @@
+import bench
+import uio
+
+def test(num):
+    for i in range(num // 400000):
+        f = uio.StringIO()
+        for j in range(1000):
+            f.write("row,%d,abc\n" % j)
+        f.getvalue()
+
+bench.run(test)
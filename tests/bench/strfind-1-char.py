@@ -0,0 +1,8 @@
+import bench
+
+def test(num):
+    s = "Content-Type: text/plain; charset=utf-8\r\n" * 50 + "!"
+    for i in range(num // 2000):
+        s.find("!")
+
+bench.run(test)
@@ -0,0 +1,9 @@
+import bench
+
+def test(num):
+    s = "2020-06-01 12:00:00 INFO sensor reading ok value=1234\n" * 40
+    for i in range(num // 20000):
+        s.split("\n")
+        s.count("value=")
+
+bench.run(test)
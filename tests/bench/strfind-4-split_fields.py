@@ -0,0 +1,10 @@
+import bench
+
+def test(num):
+    line = "2020-06-01 12:00:00 INFO sensor=t1 reading=ok value=1234 unit=mC\n" * 4
+    for i in range(num // 4000):
+        for l in line.splitlines():
+            f = l.split(" ")
+            k, v = f[5].split("=")
+
+bench.run(test)
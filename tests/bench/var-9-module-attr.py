@@ -0,0 +1,13 @@
+import bench
+import math
+
+def test(num):
+    # Attributes near the end of a native module's ordered globals table.
+    m = math
+    for i in range(num // 4):
+        m.degrees
+        m.radians
+        m.trunc
+        m.floor
+
+bench.run(test)
@@ -0,0 +1,73 @@
+# Measure hashlib and aesio throughput on a board. Run it on builds with and
+# without the port's crypto engine hooks (MICROPY_PY_UHASHLIB_SHA256_HW,
+# MICROPY_PY_UHASHLIB_SHA1_HW and CIRCUITPY_AESIO_HW) to compare them.
+try:
+    import time
+except ImportError:
+    import utime as time
+
+try:
+    import hashlib
+except ImportError:
+    import uhashlib as hashlib
+
+try:
+    import aesio
+except ImportError:
+    aesio = None
+
+if hasattr(time, "monotonic_ns"):
+    now_us = lambda: time.monotonic_ns() // 1000
+else:
+    now_us = time.ticks_us
+
+SIZE = 1024
+ROUNDS = 64
+
+data = bytearray(SIZE)
+for i in range(SIZE):
+    data[i] = i & 0xff
+
+
+def report(name, elapsed_us):
+    kbytes = SIZE * ROUNDS / 1024
+    print("{:<12} {:>8.1f} KiB/s".format(name, kbytes * 1000000 / max(elapsed_us, 1)))
+
+
+def bench_hash(name):
+    h = getattr(hashlib, name, None)
+    if h is None:
+        return
+    h = h()
+    t = now_us()
+    for _ in range(ROUNDS):
+        h.update(data)
+    h.digest()
+    report(name, now_us() - t)
+
+
+def bench_aes(name, mode, decrypt=False):
+    cipher = aesio.AES(b"0123456789abcdef", mode, b"fedcba9876543210")
+    out = bytearray(SIZE)
+    op = cipher.decrypt_into if decrypt else cipher.encrypt_into
+    block = memoryview(data)[:16]
+    blockout = memoryview(out)[:16]
+    t = now_us()
+    for _ in range(ROUNDS):
+        if mode == aesio.MODE_ECB:
+            for _ in range(SIZE // 16):
+                op(block, blockout)
+        else:
+            op(data, out)
+    report(name, now_us() - t)
+
+
+bench_hash("sha256")
+bench_hash("sha1")
+
+if aesio is not None:
+    bench_aes("aes-ecb-enc", aesio.MODE_ECB)
+    bench_aes("aes-ecb-dec", aesio.MODE_ECB, True)
+    bench_aes("aes-cbc-enc", aesio.MODE_CBC)
+    bench_aes("aes-cbc-dec", aesio.MODE_CBC, True)
+    bench_aes("aes-ctr", aesio.MODE_CTR)
@@ -118,11 +118,11 @@ def f():
     from a import *
 
     # raise
-    raise
-    raise 1
+    if a: raise
+    if a: raise 1
 
     # return
-    return
+    if a: return
     return 1
 
 # function with lots of locals
@@ -0,0 +1,42 @@
+try:
+    import btree
+    import uio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+f = uio.BytesIO()
+db = btree.open(f, pagesize=512, cachesize=4096)
+
+print(db.bulk_load((("%04d" % i).encode(), ("v%d" % i).encode()) for i in range(500)))
+print(db.bulk_load([]))
+print(db[b"0000"], db[b"0250"], db[b"0499"])
+print(len(list(db.keys())))
+print(list(db.keys(b"0497")))
+
+# keys after the existing ones keep appending
+print(db.bulk_load([(b"1000", b"a"), (b"1001", b"b")]))
+print(list(db.items(b"0499")))
+
+# out of order, the pairs before the bad key are kept
+try:
+    db.bulk_load([(b"2000", b"x"), (b"2002", b"y"), (b"2001", b"z")])
+except ValueError:
+    print("ValueError")
+print(b"2002" in db, b"2001" in db)
+try:
+    db.bulk_load([(b"3000", b"x"), (b"3000", b"y")])
+except ValueError:
+    print("ValueError")
+
+try:
+    db.bulk_load([(b"k",)])
+except ValueError:
+    print("ValueError")
+
+db.flush()
+db.close()
+
+db = btree.open(f, pagesize=512)
+print(len(list(db.values())), db[b"0123"])
+db.close()
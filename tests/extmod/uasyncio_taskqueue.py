@@ -0,0 +1,56 @@
+# Test the C TaskQueue and Task types that uasyncio is built on.
+
+try:
+    import _uasyncio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+TaskQueue = _uasyncio.TaskQueue
+Task = _uasyncio.Task
+
+g = {}
+tasks = [Task(None, g) for i in range(6)]
+for t, n in zip(tasks, "abcdef"):
+    t.data = n
+
+q = TaskQueue()
+print(bool(q), len(q), q.peek())
+
+# Keys order the queue; equal keys keep the order they were pushed in.
+base = _uasyncio.ticks()
+for t, dt in zip(tasks, (30, 10, 20, 10, 0, 20)):
+    q.push_sorted(t, _uasyncio.ticks_add(base, dt))
+print(bool(q), len(q), q.peek().data)
+
+q.remove(tasks[2])
+q.remove(tasks[2])
+out = []
+while q:
+    t = q.pop_head()
+    out.append((t.data, _uasyncio.ticks_diff(t.ph_key, base)))
+print(out)
+
+try:
+    q.pop_head()
+except IndexError:
+    print("IndexError")
+
+try:
+    q.push_head(1)
+except TypeError:
+    print("TypeError")
+
+# Keys wrap around the ticks period.
+near_wrap = _uasyncio.ticks_add(0, -5)
+q.push_sorted(tasks[0], _uasyncio.ticks_add(near_wrap, 10))
+q.push_sorted(tasks[1], near_wrap)
+print(q.pop_head().data, q.pop_head().data)
+
+# Task attributes.
+t = Task(None, g)
+print(t.done(), t.data, hasattr(t, "waiting"))
+t.coro = t
+print(t.done(), t.cancel())
+t.waiting = None
+print(hasattr(t, "waiting"), t.waiting)
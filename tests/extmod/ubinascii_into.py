@@ -0,0 +1,48 @@
+try:
+    try:
+        import ubinascii as binascii
+    except ImportError:
+        import binascii
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+if not hasattr(binascii, "b2a_base64_into"):
+    print("SKIP")
+    raise SystemExit
+
+buf = bytearray(32)
+
+# the results match the allocating versions
+for data in (b"", b"f", b"fo", b"foo", b"foob", b"fooba", b"foobar", bytes(range(250, 256))):
+    n = binascii.b2a_base64_into(data, buf)
+    print(n, buf[:n] == binascii.b2a_base64(data))
+    n = binascii.b2a_base64_into(data, buf, newline=False)
+    print(n, bytes(buf[:n]))
+    n = binascii.hexlify_into(data, buf)
+    print(n, buf[:n] == binascii.hexlify(data))
+    n = binascii.hexlify_into(data, buf, ":")
+    print(n, buf[:n] == binascii.hexlify(data, ":"))
+
+# writes into a memoryview slice, leaving the rest alone
+buf = bytearray(b"........")
+n = binascii.hexlify_into(b"\xab\xcd", memoryview(buf)[2:])
+print(n, buf)
+
+# exact fit
+buf = bytearray(4)
+print(binascii.b2a_base64_into(b"abc", buf, newline=False), buf)
+
+# buffer too small
+for f, args in ((binascii.b2a_base64_into, (b"abc", bytearray(4))),
+                (binascii.hexlify_into, (b"abc", bytearray(5))),
+                (binascii.hexlify_into, (b"abc", bytearray(6), ":"))):
+    try:
+        f(*args)
+    except ValueError:
+        print("ValueError")
+
+# output buffer must be writable
+try:
+    binascii.hexlify_into(b"a", b"xx")
+except TypeError:
+    print("TypeError")
@@ -0,0 +1,35 @@
+# test that ujson.dump writes output in chunks rather than a token at a time
+try:
+    import uio as io
+    import ujson as json
+except ImportError:
+    try:
+        import io, json
+    except ImportError:
+        print("SKIP")
+        raise SystemExit
+
+if not hasattr(io, "IOBase"):
+    print("SKIP")
+    raise SystemExit
+
+
+class S(io.IOBase):
+    def __init__(self):
+        self.writes = 0
+        self.data = ""
+
+    def write(self, buf):
+        if type(buf) == bytearray:
+            # uPy passes a bytearray, CPython passes a str
+            buf = str(buf, "ascii")
+        self.writes += 1
+        self.data += buf
+        return len(buf)
+
+
+obj = [{"key%d" % i: list(range(i))} for i in range(20)]
+s = S()
+json.dump(obj, s)
+print(json.loads(s.data) == obj)
+print(s.writes < len(s.data) // 16)
@@ -0,0 +1,25 @@
+try:
+    import ujson as json
+
+    json.dumps_into
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+buf = bytearray(64)
+for obj in (None, 1, "abc", [1, "two", [3]], {"a": False}):
+    n = json.dumps_into(obj, buf)
+    print(n, buf[:n])
+
+# the output has to fit in the buffer
+buf = bytearray(7)
+print(json.dumps_into([1, 2], buf), buf)
+try:
+    json.dumps_into([1, 2, 3], buf)
+except ValueError:
+    print("ValueError")
+
+# into a memoryview slice
+buf = bytearray(b"........")
+n = json.dumps_into("x", memoryview(buf)[2:])
+print(n, buf)
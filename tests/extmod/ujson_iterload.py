@@ -0,0 +1,39 @@
+try:
+    from uio import StringIO
+    import ujson as json
+
+    json.iterload
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+def walk(s):
+    for item in json.iterload(StringIO(s)):
+        print(item)
+
+
+walk("1")
+walk('"abc"')
+walk("[]")
+walk("{}")
+walk("[1, [2, 3], [], {}]")
+walk('{"a": {"b": [true, null]}, "c": 1.5, "d": {}}')
+walk('[{"x": 1}, {"y": [[]]}]')
+
+# the stream is left after the first document, like load()
+s = StringIO('{"a": 1} [2]')
+print(list(json.iterload(s)))
+print(json.load(s))
+
+# load() leaves the rest of a seekable stream unread
+s = StringIO('[1, 2, 3] "' + "x" * 100 + '"')
+print(json.load(s))
+print(len(json.load(s)))
+
+# errors
+for s in ("", "[1, 2", "{1: 2}", '{"a": 1, [2]: 3}', "[1}", "{]"):
+    try:
+        list(json.iterload(StringIO(s)))
+    except ValueError:
+        print("ValueError")
@@ -0,0 +1,23 @@
+# test that the module-level functions give the right results while cycling
+# through more patterns than any compiled-pattern cache would hold
+
+try:
+    import ure as re
+except ImportError:
+    try:
+        import re
+    except ImportError:
+        print("SKIP")
+        raise SystemExit
+
+patterns = ["a%d" % i for i in range(20)]
+for _ in range(3):
+    n = 0
+    for i, p in enumerate(patterns):
+        if re.search(p, "xa%d" % i) and not re.match(p, "a%d" % (i + 1)):
+            n += 1
+    print(n)
+
+# equal patterns made separately are interchangeable
+p = "b" + "+"
+print(re.match(p, "bbb").group(0), re.match("b+", "bc").group(0))
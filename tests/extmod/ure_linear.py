@@ -0,0 +1,50 @@
+# test matching with the pike VM, which takes linear time
+
+try:
+    import ure as re
+
+    re.LINEAR
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+def groups(m):
+    if m is None:
+        return None
+    r = []
+    try:
+        for i in range(10):
+            r.append(m.group(i))
+    except IndexError:
+        pass
+    return r
+
+
+# results must be the same as with backtracking
+TESTS = [
+    ("a|ab", "ab"),
+    ("(a|ab)(c|bcd)(d*)", "abcd"),
+    ("a*?b", "aaab"),
+    ("(a+)(b+)?", "aaac"),
+    ("^abc$", "abc"),
+    ("x*", ""),
+    ("[a-c]+d", "zzabcabd"),
+    ("\\d+\\s\\w+", "x 12 foo"),
+    ("(.*)(\\d+)", "abc1234"),
+    ("(.*?)(\\d+)", "abc1234"),
+    ("[^0-9]+", "12ab3"),
+    ("(a)|b", "b"),
+    ("a(b|c)*d", "abcbcbd"),
+    ("(a?)((ab)?)(b?)", "ab"),
+]
+for pat, s in TESTS:
+    for r in (re.compile(pat), re.compile(pat, re.LINEAR)):
+        print(groups(r.match(s)), groups(r.search(s)))
+
+print(re.compile(",", re.LINEAR).split("a,b,,c"))
+
+# patterns that make the backtracking matcher recurse without limit
+print(len(re.compile("(a*)*b", re.LINEAR).match("a" * 1000 + "b").group(0)))
+print(re.compile("(a*)+c", re.LINEAR).search("a" * 1000))
+print(re.compile("(a|aa)*b", re.LINEAR).match("a" * 1000))
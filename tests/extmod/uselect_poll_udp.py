@@ -0,0 +1,68 @@
+# test uselect.poll with UDP sockets, including many of them
+try:
+    import usocket as socket, uselect as select
+except ImportError:
+    try:
+        import socket, select
+    except ImportError:
+        print("SKIP")
+        raise SystemExit
+
+
+PORT = 18300
+
+
+def address(i):
+    return socket.getaddrinfo("127.0.0.1", PORT + i)[0][-1]
+
+
+def new_socket(i):
+    s = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    s.bind(address(i))
+    return s
+
+
+sockets = [new_socket(i) for i in range(50)]
+poller = select.poll()
+for s in sockets:
+    print(poller.register(s, select.POLLIN))
+print(poller.register(sockets[0], select.POLLIN))
+
+# nothing is ready to read
+print(poller.poll(0))
+
+# only the sockets that were sent to are returned
+sender = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+for i in (3, 17, 42):
+    sender.sendto(b"x", address(i))
+ready = sorted(sockets.index(s) for s, ev in poller.ipoll(100) if ev & select.POLLIN)
+print(ready)
+
+# still ready until read
+print(len(poller.poll(0)))
+for i in (3, 17):
+    sockets[i].recv(1)
+print([sockets.index(s) for s, ev in poller.poll(0)])
+
+# events can be changed and removed
+poller.modify(sockets[42], select.POLLOUT)
+print([(sockets.index(s), ev) for s, ev in poller.poll(0)] == [(42, select.POLLOUT)])
+poller.unregister(sockets[42])
+print(poller.poll(0))
+
+# a one-shot poll reports each socket once
+poller.register(sockets[42], select.POLLIN)
+print(len(list(poller.ipoll(0, 1))), len(list(poller.ipoll(0, 1))))
+
+# a regular file is always ready
+f = open(__file__, "rb")
+poller.unregister(sockets[42])
+poller.register(f, select.POLLIN)
+print([(s is f, ev) for s, ev in poller.poll(0)])
+poller.unregister(f)
+print(poller.poll(0))
+f.close()
+
+sender.close()
+for s in sockets:
+    s.close()
@@ -0,0 +1,95 @@
+# Test utimeq handles: remove, update and growing queues
+try:
+    from utimeq import utimeq
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+res = [0, 0, 0]
+
+
+def drain(h):
+    out = []
+    while h:
+        h.pop(res)
+        out.append((res[0], res[1]))
+    return out
+
+
+# remove from the middle, the front and the back
+h = utimeq(10)
+hs = [h.push(t, t, None) for t in (50, 10, 40, 20, 30)]
+print(h.remove(hs[2]), h.remove(hs[1]), h.remove(hs[0]))
+print(len(h), drain(h))
+
+# removing twice, or a handle that was never given out
+h = utimeq(4)
+a = h.push(1, "a", None)
+print(h.remove(a), h.remove(a), h.remove(1000), h.remove(-1))
+
+# a handle for a popped entry doesn't select the entry that reuses its slot
+b = h.push(2, "b", None)
+h.pop(res)
+c = h.push(3, "c", None)
+print(b != c, h.remove(b), len(h), h.remove(c), len(h))
+
+# update moves entries earlier and later
+h = utimeq(10)
+hs = {}
+for t in (10, 20, 30, 40, 50):
+    hs[t] = h.push(t, t, None)
+print(h.update(hs[50], 5), h.update(hs[10], 45), h.peektime())
+print(drain(h))
+print(h.update(hs[20], 1))
+
+# an updated entry goes after others already at the same time
+h = utimeq(10)
+x = h.push(100, "x", None)
+h.push(200, "y", None)
+h.push(200, "z", None)
+h.update(x, 200)
+print(drain(h))
+
+# fixed size queues still overflow, growing ones don't
+h = utimeq(2)
+h.push(1, 0, None)
+h.push(2, 0, None)
+try:
+    h.push(3, 0, None)
+except IndexError:
+    print("IndexError")
+
+h = utimeq(0, grow=True)
+hs = []
+for i in range(100):
+    hs.append(h.push((i * 37) % 100, i, None))
+for i in range(0, 100, 3):
+    h.remove(hs[i])
+out = drain(h)
+print(len(out), [t for t, _ in out] == sorted(t for t, _ in out))
+print(sorted(v for _, v in out) == [i for i in range(100) if i % 3])
+
+# a random mix of operations, checked against a sorted list
+import urandom
+
+urandom.seed(1)
+h = utimeq(0, grow=True)
+live = {}
+ok = True
+for i in range(500):
+    op = urandom.getrandbits(2)
+    if op < 2 or not live:
+        t = urandom.getrandbits(10)
+        live[h.push(t, i, None)] = t
+    elif op == 2:
+        k = list(live)[urandom.getrandbits(8) % len(live)]
+        ok = ok and h.remove(k)
+        del live[k]
+    else:
+        k = list(live)[urandom.getrandbits(8) % len(live)]
+        t = urandom.getrandbits(10)
+        ok = ok and h.update(k, t)
+        live[k] = t
+    if live:
+        ok = ok and h.peektime() == min(live.values())
+print(ok, len(h) == len(live))
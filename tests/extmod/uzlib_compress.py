@@ -0,0 +1,43 @@
+try:
+    import uzlib as zlib
+    import uio as io
+
+    zlib.compress
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+PATTERNS = [
+    b"",
+    b"a",
+    b"hello hello hello hello",
+    bytes(range(256)),
+    b"0123456789" * 100,
+]
+
+# zlib and raw DEFLATE streams, with small and large windows
+for data in PATTERNS:
+    for wbits in (15, 9, -15, -9):
+        c = zlib.compress(data, wbits)
+        print(len(data), wbits, zlib.decompress(c, wbits) == data)
+
+# default is a zlib stream with a 32k window
+print(zlib.compress(b"abc"))
+
+# gzip stream, read back with DecompIO
+c = zlib.compress(b"gzip " * 10, 31)
+print(c[:3], zlib.DecompIO(io.BytesIO(c), 31).read())
+
+# streaming compression, in pieces
+buf = io.BytesIO()
+with zlib.CompressIO(buf, 10) as c:
+    for data in PATTERNS:
+        c.write(data)
+print(zlib.decompress(buf.getvalue()) == b"".join(PATTERNS))
+
+# invalid window size
+for wbits in (8, 16, -16):
+    try:
+        zlib.compress(b"", wbits)
+    except ValueError:
+        print("ValueError")
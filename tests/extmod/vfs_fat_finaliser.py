@@ -0,0 +1,58 @@
+# Test that files opened on a VfsFat and never closed are flushed by their
+# finaliser once they become garbage.
+
+try:
+    import gc
+    import uos
+    uos.VfsFat
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        for i in range(len(buf)):
+            buf[i] = self.data[n * self.SEC_SIZE + i]
+
+    def writeblocks(self, n, buf):
+        for i in range(len(buf)):
+            self.data[n * self.SEC_SIZE + i] = buf[i]
+
+    def ioctl(self, op, arg):
+        if op == 4:  # BP_IOCTL_SEC_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # BP_IOCTL_SEC_SIZE
+            return self.SEC_SIZE
+
+
+try:
+    bdev = RAMBlockDevice(50)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+uos.VfsFat.mkfs(bdev)
+vfs = uos.VfsFat(bdev)
+
+# open files and write to them but drop them without closing
+for i in range(4):
+    f = vfs.open("x%d" % i, "w")
+    f.write("data %d" % i)
+f = None
+
+# finalisers either run in the sweep or are deferred to the scheduler, which
+# gets to run them between the bytecodes of this loop
+gc.collect()
+for i in range(10):
+    pass
+
+for i in range(4):
+    with vfs.open("x%d" % i, "r") as f:
+        print(f.read())
@@ -0,0 +1,81 @@
+try:
+    import uerrno
+    import uos
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+try:
+    uos.VfsFat
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMFS:
+
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        for i in range(len(buf)):
+            buf[i] = self.data[n * self.SEC_SIZE + i]
+        return 0
+
+    def writeblocks(self, n, buf):
+        for i in range(len(buf)):
+            self.data[n * self.SEC_SIZE + i] = buf[i]
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # BP_IOCTL_SEC_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # BP_IOCTL_SEC_SIZE
+            return self.SEC_SIZE
+
+
+try:
+    bdev = RAMFS(50)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+uos.VfsFat.mkfs(bdev)
+vfs = uos.VfsFat(bdev)
+uos.mount(vfs, '/ramdisk')
+uos.chdir('/ramdisk')
+
+f = open("log.bin", "wb")
+if not hasattr(f, "preallocate"):
+    f.close()
+    print("SKIP")
+    raise SystemExit
+
+f.preallocate(4096)
+# The clusters are allocated but the file is still empty.
+print(f.tell(), f.seek(0, 2))
+
+for i in range(64):
+    f.write(bytes([i]) * 32)
+f.close()
+print(uos.stat("log.bin")[6])
+with open("log.bin", "rb") as f:
+    data = f.read()
+print(all(data[i] == i // 32 for i in range(len(data))))
+
+# Only an empty file opened for writing can be preallocated.
+with open("log.bin", "ab") as f:
+    try:
+        f.preallocate(4096)
+    except OSError as e:
+        print(e.args[0] == uerrno.EACCES)
+
+with open("log.bin", "wb") as f:
+    try:
+        f.preallocate(0)
+    except OSError as e:
+        print(e.args[0] == uerrno.EINVAL)
+
+uos.umount('/ramdisk')
@@ -0,0 +1,49 @@
+# Test VfsFat on the builtin RAM block device.
+
+try:
+    import uos
+
+    uos.VfsFat
+    uos.RAMBlockDevice
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+try:
+    bdev = uos.RAMBlockDevice(64)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+# block device protocol
+print(bdev.ioctl(4, 0), bdev.ioctl(5, 0), bdev.ioctl(1, 0), bdev.ioctl(99, 0))
+bdev.writeblocks(1, b"abcd", 510)
+buf = bytearray(6)
+bdev.readblocks(1, buf, 508)
+print(buf)
+print(bytes(memoryview(bdev)[1024:1026]))
+for args in ((64, buf), (-1, buf), (63, buf, 508)):
+    try:
+        bdev.readblocks(*args)
+    except OSError:
+        print("OSError")
+for args in ((0,), (8, 100), (8, 513)):
+    try:
+        uos.RAMBlockDevice(*args)
+    except ValueError:
+        print("ValueError")
+print(uos.RAMBlockDevice(2, 1024).ioctl(5, 0))
+
+# scratch filesystem
+uos.VfsFat.mkfs(bdev)
+vfs = uos.VfsFat(bdev)
+uos.mount(vfs, "/tmpfs")
+with open("/tmpfs/scratch.txt", "w") as f:
+    f.write("hello!" * 100)
+with open("/tmpfs/scratch.txt") as f:
+    print(len(f.read()))
+print(b"hello!" in bytes(bdev))
+print(uos.listdir("/tmpfs"))
+uos.remove("/tmpfs/scratch.txt")
+print(uos.listdir("/tmpfs"))
+uos.umount("/tmpfs")
@@ -0,0 +1,76 @@
+try:
+    import uos
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+try:
+    uos.VfsFat
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMFS:
+
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        for i in range(len(buf)):
+            buf[i] = self.data[n * self.SEC_SIZE + i]
+        return 0
+
+    def writeblocks(self, n, buf):
+        for i in range(len(buf)):
+            self.data[n * self.SEC_SIZE + i] = buf[i]
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # BP_IOCTL_SEC_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # BP_IOCTL_SEC_SIZE
+            return self.SEC_SIZE
+
+
+try:
+    bdev = RAMFS(50)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+uos.VfsFat.mkfs(bdev)
+vfs = uos.VfsFat(bdev)
+uos.mount(vfs, '/ramdisk')
+uos.chdir('/ramdisk')
+
+# Lines that straddle sector and buffer boundaries.
+with open("lines.txt", "w") as f:
+    for i in range(300):
+        f.write("line %d %s\n" % (i, "x" * (i % 17)))
+
+with open("lines.txt") as f:
+    lines = f.readlines()
+print(len(lines), lines[0], lines[-1])
+
+with open("lines.txt", "rb") as f:
+    data = f.read()
+print(len(data))
+
+# Small reads mixed with seeks in both directions match a single big read.
+with open("lines.txt", "rb") as f:
+    ok = True
+    for pos in (0, 511, 512, 1500, 3000, 100, 2047, 2048, len(data) - 3):
+        f.seek(pos)
+        chunk = f.read(7)
+        ok = ok and chunk == data[pos:pos + 7] and f.tell() == pos + len(chunk)
+    f.seek(-10, 2)
+    ok = ok and f.read(4) == data[-10:-6]
+    f.seek(2, 1)
+    ok = ok and f.read() == data[-4:]
+    ok = ok and f.read(1) == b''
+    print(ok)
+
+uos.umount('/ramdisk')
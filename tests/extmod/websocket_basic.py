@@ -58,3 +58,19 @@ try:
     ws.ioctl(-1)
 except OSError as e:
     print("ioctl: EINVAL:", e.args[0] == uerrno.EINVAL)
+
+# masked payload long enough to be unmasked a word at a time
+mask = b"\x01\x02\x03\x04"
+data = b"0123456789abcdefghij" * 2
+print(ws_read(b"\x81\xa8" + mask + bytes(data[i] ^ mask[i & 3] for i in range(len(data))), 40))
+
+# fragmented message: FIN clear and FRAME_CONT on continuation frames
+s = uio.BytesIO()
+ws = websocket.websocket(s)
+ws.ioctl(9, 0x11) # SET_DATA_OPTS: FRAME_MORE | FRAME_TXT
+ws.write(b"ab")
+ws.write(b"cd")
+ws.ioctl(9, 1)
+ws.write(b"ef")
+s.seek(0)
+print(s.read())
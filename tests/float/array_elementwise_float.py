@@ -0,0 +1,28 @@
+# test the in-place elementwise methods of float arrays (uPy extension)
+try:
+    from uarray import array
+except ImportError:
+    try:
+        from array import array
+    except ImportError:
+        print("SKIP")
+        raise SystemExit
+if not hasattr(array, "scale"):
+    print("SKIP")
+    raise SystemExit
+
+a = array("f", [1.5, -2.0, 4.0])
+a.add(0.5)
+print(a)
+a.add(array("f", [1, 1, 1]))
+print(a)
+a.scale(2)
+print(a)
+a.scale(1, 2)
+print(a)
+print(a.sum(), a.min(), a.max())
+a.fill(0.25)
+print(a)
+d = array("d", [1, 2, 3])
+d.scale(0.5)
+print(d, d.sum())
@@ -17,3 +17,9 @@ print('%.2e' % float('9' * 40 + 'e-21'))
 # check a case that would render negative digit values, eg ")" characters
 # the string is converted back to a float to check for no illegal characters
 float('%.23e' % 1e-80)
+
+# digits of values that are exact in binary
+for k in range(1, 13):
+    print('%.12f' % (2 ** -k), '%.12f' % (1 + 2 ** -k), '%.7e' % (3 * 2 ** -k))
+for val in (0.1, 1.5, 9.75, 123.984375, 4095.999755859375):
+    print('%.3f %g %.3g %.4e' % (val, val, val, val))
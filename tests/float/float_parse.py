@@ -30,3 +30,9 @@ print(float('1e4294967301'))
 print(float('1e-4294967301'))
 print(float('1e18446744073709551621'))
 print(float('1e-18446744073709551621'))
+
+# digits and exponents that are exact floats should give a correctly rounded value
+for s, n, d in (('0.3', 3, 10), ('.7', 7, 10), ('1.1', 11, 10), ('-12.345', -12345, 1000),
+                ('6e-5', 6, 100000), ('3.14159', 314159, 100000), ('2_5.0_1', 2501, 100)):
+    print(s, float(s) == n / d)
+print(float('123e5') == 12300000.0, float('0.000125e3') == 0.125)
@@ -0,0 +1,15 @@
+# strings built by += and held by a module survive its globals being moved to
+# the long-lived part of the heap at import, and don't share appended data
+import gc
+import str_builder_longlived_mod as mod
+
+gc.collect()
+junk = [bytearray(b"\xee" * 40) for i in range(200)]
+print(len(mod.s), mod.s[:12], mod.s[-8:])
+print(len(mod.t), mod.t[-8:])
+u = mod.s
+u += "more"
+v = mod.t
+v += "other"
+print(mod.s[-8:], u[-8:], mod.t[-8:], v[-8:])
+del junk
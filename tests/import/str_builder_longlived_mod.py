@@ -0,0 +1,5 @@
+s = ""
+for i in range(40):
+    s += "abcdefghij%d" % i
+t = s
+s += "end"
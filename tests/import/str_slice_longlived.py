@@ -0,0 +1,11 @@
+# str and bytes slices held by a module survive its globals being moved to
+# the long-lived part of the heap at import
+import gc
+import str_slice_longlived_mod as mod
+
+gc.collect()
+junk = [bytearray(b"\xee" * 40) for i in range(200)]
+print(mod.t == mod.s[13:90], mod.t[:12])
+print(mod.bt == mod.b[5:60], mod.bt[:6])
+print(mod.parts == mod.s.split("j"))
+del junk
@@ -0,0 +1,5 @@
+s = "".join(["abcdefghij%d" % i for i in range(20)])
+t = s[13:90]
+b = bytes(range(100))
+bt = b[5:60]
+parts = s.split("j")
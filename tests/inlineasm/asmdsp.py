@@ -0,0 +1,75 @@
+# test the DSP extension instructions
+
+@micropython.asm_thumb
+def qadd16(r0, r1):
+    qadd16(r0, r0, r1)
+
+print(hex(qadd16(0x7fff0001, 0x00010002)))
+
+@micropython.asm_thumb
+def uqsub8(r0, r1):
+    uqsub8(r0, r0, r1)
+
+print(hex(uqsub8(0x10203040, 0x20102010)))
+
+# byte-wise unsigned maximum, using the GE flags set by usub8
+@micropython.asm_thumb
+def umax8(r0, r1):
+    usub8(r2, r0, r1)
+    sel(r0, r0, r1)
+
+print(hex(umax8(0x10802005, 0x20104001)))
+
+@micropython.asm_thumb
+def qadd(r0, r1):
+    qadd(r0, r0, r1)
+
+print(qadd(0x7fffffff, 1))
+print(qadd(-0x80000000, -1))
+
+@micropython.asm_thumb
+def smlad(r0, r1, r2):
+    smlad(r0, r0, r1, r2)
+
+print(smlad(0x00020003, 0x00040005, 10))
+
+@micropython.asm_thumb
+def smulbb(r0, r1):
+    smulbb(r0, r0, r1)
+
+print(smulbb(0x0001fffe, 3))
+
+@micropython.asm_thumb
+def ssat8(r0):
+    ssat(r0, 8, r0)
+
+print(ssat8(300), ssat8(-300), ssat8(100))
+
+@micropython.asm_thumb
+def ssat16_asr4(r0):
+    ssat(r0, 16, r0, -4)
+
+print(ssat16_asr4(0x1230), ssat16_asr4(0x123456))
+
+@micropython.asm_thumb
+def usat8(r0):
+    usat(r0, 8, r0)
+
+print(usat8(300), usat8(-5), usat8(100))
+
+@micropython.asm_thumb
+def uxtb16_ror8(r0):
+    uxtb16(r0, r0, 8)
+
+print(hex(uxtb16_ror8(0x11223344)))
+
+@micropython.asm_thumb
+def pkhbt(r0, r1):
+    pkhbt(r0, r0, r1, 16)
+
+@micropython.asm_thumb
+def pkhtb(r0, r1):
+    pkhtb(r0, r0, r1, 16)
+
+print(hex(pkhbt(0x1234abcd, 0x5678ef01)))
+print(hex(pkhtb(0x1234abcd, 0x5678ef01)))
@@ -0,0 +1,65 @@
+# test the VFP multiply-accumulate and conversion instructions
+
+@micropython.asm_thumb      # r0 = (int)(r0 + r1*r2), single rounding with vfma
+def mac(r0, r1, r2):
+    vmov(s0, r0)
+    vcvt_f32_s32(s0, s0)
+    vmov(s1, r1)
+    vcvt_f32_s32(s1, s1)
+    vmov(s2, r2)
+    vcvt_f32_s32(s2, s2)
+    vmov(s3, s0)
+    vmla(s0, s1, s2)
+    vfma(s3, s1, s2)
+    vsub(s0, s0, s3)
+    vadd(s0, s0, s3)
+    vcvt_s32_f32(s0, s0)
+    vmov(r0, s0)
+
+print(mac(10, 3, 4))
+print(mac(10, -3, 4))
+
+@micropython.asm_thumb      # r0 = (int)(r0 - r1*r2)
+def msc(r0, r1, r2):
+    vmov(s0, r0)
+    vcvt_f32_s32(s0, s0)
+    vmov(s1, r1)
+    vcvt_f32_s32(s1, s1)
+    vmov(s2, r2)
+    vcvt_f32_s32(s2, s2)
+    vfms(s0, s1, s2)
+    vcvt_s32_f32(s0, s0)
+    vmov(r0, s0)
+
+print(msc(10, 3, 4))
+
+@micropython.asm_thumb      # r0 = (int)-(r0*r1)
+def nmul(r0, r1):
+    vmov(s0, r0)
+    vcvt_f32_s32(s0, s0)
+    vmov(s1, r1)
+    vcvt_f32_s32(s1, s1)
+    vnmul(s2, s0, s1)
+    vcvt_s32_f32(s2, s2)
+    vmov(r0, s2)
+
+print(nmul(3, 4), nmul(-3, 4))
+
+@micropython.asm_thumb      # r0 = (int)abs(r0)
+def fabs(r0):
+    vmov(s0, r0)
+    vcvt_f32_s32(s0, s0)
+    vabs(s1, s0)
+    vcvt_s32_f32(s1, s1)
+    vmov(r0, s1)
+
+print(fabs(-7), fabs(7))
+
+@micropython.asm_thumb      # round-trip an unsigned value through a float
+def u32(r0):
+    vmov(s0, r0)
+    vcvt_f32_u32(s0, s0)
+    vcvt_u32_f32(s0, s0)
+    vmov(r0, s0)
+
+print(hex(u32(0x40000000)), u32(0xc0000000) == -0x40000000)
@@ -0,0 +1,31 @@
+# test str and bytes constants, and folding of their concatenation
+
+from micropython import const
+
+try:
+    exec("A = const('a')")
+except SyntaxError:
+    print("SKIP")
+    raise SystemExit
+
+S = const("abc")
+B = const(b"xyz")
+LONG = const("a string that is too long to be interned by the parser")
+_PRIV = const("private")
+
+print(S, B, LONG, _PRIV)
+print(S + "def", B + b"!", S + LONG)
+print(S + _PRIV + S)
+
+# the result can be used like any other literal
+print(len(S + "de"), (S + "de")[1:])
+
+# only + of like types is folded, the rest is left to runtime
+print(S * 2)
+try:
+    S + B
+except TypeError:
+    print("TypeError")
+
+# private constants don't exist at runtime
+print("S" in globals(), "_PRIV" in globals())
@@ -0,0 +1,28 @@
+# test gc.idle(), which only collects once enough has been allocated
+
+import gc
+
+try:
+    gc.idle
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+gc.collect()
+# nothing allocated since the collection, so nothing to do
+print(gc.idle())
+
+# allocate until a collection is due
+n = 0
+while not gc.idle():
+    b = bytearray(1024)
+    n += 1
+print(n > 0)
+print(gc.idle())
+
+# disabling the GC also disables idle collections
+gc.disable()
+for i in range(n + 1):
+    b = bytearray(1024)
+print(gc.idle())
+gc.enable()
@@ -0,0 +1,38 @@
+# test that objects are kept alive when marking them overflows the GC stack
+
+import gc
+
+# a chain of wide nodes, built back to front so that marking it keeps
+# overflowing the mark stack at nodes that are lower in memory
+def make(n, width):
+    nxt = None
+    for i in range(n):
+        try:
+            node = [None] * (width + 1)
+            for j in range(width):
+                node[j] = [i, j]
+        except MemoryError:
+            print("SKIP")
+            raise SystemExit
+        node[width] = nxt
+        nxt = node
+    return nxt
+
+head = make(40, 100)
+gc.collect()
+
+# reuse whatever the collection freed, then check nothing live was freed
+garbage = [[i] for i in range(2000)]
+garbage = None
+gc.collect()
+
+n = 0
+ok = True
+node = head
+while node:
+    n += 1
+    for j in range(100):
+        if node[j] != [40 - n, j]:
+            ok = False
+    node = node[100]
+print(n, ok)
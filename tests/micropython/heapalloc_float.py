@@ -0,0 +1,30 @@
+# Test that float arithmetic doesn't allocate on ports that store floats in
+# the object word (MICROPY_OBJ_REPR_C and MICROPY_OBJ_REPR_D).
+import micropython
+
+
+def f(x, y):
+    return x * y + 0.5
+
+
+micropython.heap_lock()
+try:
+    f(1.5, 2.0)
+except MemoryError:
+    micropython.heap_unlock()
+    print("SKIP")
+    raise SystemExit
+
+# arithmetic, including mixing with small ints
+print(f(1.5, 2.0))
+print(f(0.25, 4))
+x = 1.0
+i = 0
+while i < 10:
+    x = x * 2 - i
+    i += 1
+print(x)
+
+# conversions and comparisons
+print(float(3), int(2.5), 1.5 < 2.0, abs(-0.75))
+micropython.heap_unlock()
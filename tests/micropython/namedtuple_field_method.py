@@ -0,0 +1,19 @@
+# fields named like the namedtuple methods, which CPython doesn't allow, read
+# the same through LOAD_ATTR, whose field index cache sees them first, and
+# through getattr, which doesn't use it
+try:
+    from ucollections import namedtuple
+except ImportError:
+    try:
+        from collections import namedtuple
+    except ImportError:
+        print("SKIP")
+        raise SystemExit
+
+T = namedtuple("T", ["_asdict", "_make"])
+
+def get(t):
+    return t._asdict, t._make
+
+for t in T(1, 2), T(3, 4):
+    print(get(t), getattr(t, "_asdict"), getattr(t, "_make"))
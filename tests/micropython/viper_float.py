@@ -0,0 +1,66 @@
+# test the viper float type, which keeps float values unboxed
+import micropython
+
+try:
+    exec("@micropython.viper\ndef f(x:float):\n pass")
+except (SyntaxError, ViperTypeError):
+    print("SKIP")
+    raise SystemExit
+
+# arguments and return value
+@micropython.viper
+def add(x:float, y:float) -> float:
+    return x + y
+print(add(1.5, 2.25), add(1, 2))
+
+# arithmetic mixing floats, ints and float constants
+@micropython.viper
+def arith(x:float, i:int) -> float:
+    return (x * i - 0.5) / 2 + i
+print(arith(3.0, 2))
+
+# unary ops
+@micropython.viper
+def unary(x:float) -> float:
+    return -(+x)
+print(unary(2.5), unary(0.0))
+
+# comparisons give a bool
+@micropython.viper
+def compare(x:float, y:float):
+    print(x < y, x > y, x == y, x <= y, x >= y, x != y)
+compare(1.0, 2.0)
+compare(2.0, 2.0)
+
+# casts to and from float
+@micropython.viper
+def cast(i:int) -> float:
+    x = float(i)
+    y = float(1.25)
+    return x + y
+print(cast(3))
+
+# a float local used in a loop, and passed to a Python function
+@micropython.viper
+def loop(n:int) -> float:
+    acc = float(0)
+    for i in range(n):
+        acc += float(i) * 0.5
+    print(acc)
+    return acc
+print(loop(10))
+
+# division by zero
+@micropython.viper
+def div(x:float, y:float) -> float:
+    return x / y
+try:
+    div(1.0, 0.0)
+except ZeroDivisionError:
+    print("ZeroDivisionError")
+
+# unsupported ops
+try:
+    exec("@micropython.viper\ndef f(x:float):\n x // x")
+except ViperTypeError as e:
+    print(repr(e))
@@ -0,0 +1,74 @@
+# test the viper intrinsics for bulk memory operations and unaligned access
+import micropython
+
+try:
+    exec("@micropython.viper\ndef f(p:ptr8):\n memset(p, 0, 0)")
+except (SyntaxError, ViperTypeError):
+    print("SKIP")
+    raise SystemExit
+
+# memset, memcpy and memmove on pointers
+@micropython.viper
+def fill(dst:ptr8, c:int, n:int):
+    memset(dst, c, n)
+
+@micropython.viper
+def copy(dst:ptr8, src:ptr8, n:int):
+    memcpy(dst, src, n)
+
+@micropython.viper
+def move(buf:ptr8, dst:int, src:int, n:int):
+    memmove(ptr8(int(buf) + dst), ptr8(int(buf) + src), n)
+
+b = bytearray(8)
+fill(b, 0x41, 5)
+print(b)
+copy(b, bytearray(b"xyz"), 3)
+print(b)
+b = bytearray(b"abcdefgh")
+move(b, 2, 0, 5)
+print(b)
+move(b, 0, 2, 5)
+print(b)
+
+# byte swapping
+@micropython.viper
+def swap(x:int) -> uint:
+    return uint(bswap32(x) + bswap16(x & 0xffff))
+
+print(hex(swap(0x11223344)))
+print(hex(swap(0x00000080)))
+
+# unaligned loads and stores, in native byte order
+@micropython.viper
+def load(buf:ptr8, off:int) -> uint:
+    return uint(load32_unaligned(ptr8(int(buf) + off)))
+
+@micropython.viper
+def load16(buf:ptr8, off:int) -> uint:
+    return uint(load16_unaligned(ptr8(int(buf) + off)))
+
+@micropython.viper
+def store(buf:ptr8, off:int, x:int):
+    store32_unaligned(ptr8(int(buf) + off), x)
+    store16_unaligned(ptr8(int(buf) + off + 4), x)
+
+import sys
+
+b = bytearray(b"\x00\x01\x02\x03\x04\x05\x06\x07")
+for off in range(1, 4):
+    print(hex(load(b, off)) == hex(int.from_bytes(b[off:off + 4], sys.byteorder)))
+print(hex(load16(b, 3)) == hex(int.from_bytes(b[3:5], sys.byteorder)))
+b = bytearray(8)
+store(b, 1, 0x5a5b5c5d)
+print(b == b"\x00" + (0x5a5b5c5d).to_bytes(4, sys.byteorder) + (0x5c5d).to_bytes(2, sys.byteorder) + b"\x00")
+
+# wrong number of arguments, and arguments that aren't machine words
+for src in (
+    "@micropython.viper\ndef f(p:ptr8):\n memcpy(p, p)",
+    "@micropython.viper\ndef f(x):\n bswap32(x)",
+):
+    try:
+        exec(src)
+    except ViperTypeError as e:
+        print(repr(e))
@@ -0,0 +1,63 @@
+# Cost of mixing N voices, measured as the CPU time the mixer steals from a
+# busy loop while it plays compared to the same loop with the output idle.
+try:
+    import array
+    import audiocore
+    import audiomixer
+    import board
+except ImportError:
+    skip()
+
+try:
+    import audioio
+
+    AudioOut = audioio.AudioOut
+except ImportError:
+    try:
+        import audiopwmio
+
+        AudioOut = audiopwmio.PWMAudioOut
+    except ImportError:
+        skip()
+
+pin = getattr(board, "SPEAKER", None) or getattr(board, "A0", None)
+if pin is None:
+    skip()
+
+VOICES = 4
+RATE = 22050
+LOOP_US = 200000
+
+wave = array.array("h", [(i * 4096) - 32768 for i in range(16)])
+sample = audiocore.RawSample(wave, sample_rate=RATE)
+
+
+def spin():
+    # Number of loop iterations completed in LOOP_US.
+    n = 0
+    t0 = ticks_us()
+    while ticks_diff(ticks_us(), t0) < LOOP_US:
+        n += 1
+    return n
+
+
+try:
+    out = AudioOut(pin)
+except (ValueError, RuntimeError):
+    skip()
+try:
+    idle = spin()
+    mixer = audiomixer.Mixer(voice_count=VOICES, sample_rate=RATE, channel_count=1, bits_per_sample=16, samples_signed=True)
+    out.play(mixer)
+    for v in range(VOICES):
+        mixer.voice[v].level = 1 / VOICES
+        mixer.play(sample, voice=v, loop=True)
+    busy = spin()
+    out.stop()
+    mixer.deinit()
+finally:
+    out.deinit()
+
+report("audiomixer_voices", VOICES, "voices")
+# Fraction of the CPU in per mille used by the mixer and the output DMA.
+report("audiomixer_load", (idle - busy) * 1000 // max(idle, 1), "permille")
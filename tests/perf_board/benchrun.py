@@ -0,0 +1,47 @@
+# Harness that run-board-bench prepends to every benchmark in this directory.
+# A benchmark times its workload with bench_time() and prints one line per
+# metric with report(); run-board-bench collects those lines from the board.
+import gc
+import sys
+
+try:
+    import time
+except ImportError:
+    import utime as time
+
+try:
+    ticks_us = time.ticks_us
+    ticks_diff = time.ticks_diff
+except AttributeError:
+    monotonic_ns = time.monotonic_ns
+
+    def ticks_us():
+        return monotonic_ns() // 1000
+
+    def ticks_diff(a, b):
+        return a - b
+
+
+def skip():
+    print("SKIP")
+    sys.exit()
+
+
+def report(metric, value, unit="us"):
+    print("RESULT", metric, value, unit)
+
+
+def bench_time(f, *args, repeat=5):
+    # Return the best of several runs in microseconds, after a collect so that
+    # a full heap from the previous run doesn't land in the timed window.
+    best = None
+    for _ in range(repeat):
+        gc.collect()
+        t0 = ticks_us()
+        f(*args)
+        dt = ticks_diff(ticks_us(), t0)
+        if best is None or dt < best:
+            best = dt
+    return best
+
+
@@ -0,0 +1,56 @@
+# Full refresh of a reference scene on the board's built in display.
+try:
+    import board
+    import displayio
+except ImportError:
+    skip()
+
+display = getattr(board, "DISPLAY", None)
+if display is None:
+    skip()
+
+w = display.width
+h = display.height
+scene = displayio.Group(max_size=4)
+
+bitmap = displayio.Bitmap(w, h, 4)
+for y in range(0, h, 4):
+    for x in range(w):
+        bitmap[x, y] = (x // 8) % 4
+palette = displayio.Palette(4)
+palette[0] = 0x000000
+palette[1] = 0xFF0000
+palette[2] = 0x00FF00
+palette[3] = 0x0000FF
+scene.append(displayio.TileGrid(bitmap, pixel_shader=palette))
+
+sprite = displayio.Bitmap(32, 32, 2)
+for i in range(32):
+    sprite[i, i] = 1
+sprite_palette = displayio.Palette(2)
+sprite_palette[1] = 0xFFFFFF
+sprite_palette.make_transparent(0)
+tile = displayio.TileGrid(sprite, pixel_shader=sprite_palette, x=w // 3, y=h // 3)
+scene.append(tile)
+
+display.auto_refresh = False
+display.show(scene)
+
+
+def full():
+    # Moving the background forces the whole area dirty.
+    scene[0].x ^= 1
+    display.refresh(target_frames_per_second=None, minimum_frames_per_second=0)
+
+
+def sprite_move():
+    tile.x = (tile.x + 1) % (w - 32)
+    display.refresh(target_frames_per_second=None, minimum_frames_per_second=0)
+
+
+try:
+    report("displayio_full_refresh", bench_time(full))
+    report("displayio_sprite_refresh", bench_time(sprite_move))
+finally:
+    display.show(None)
+    display.auto_refresh = True
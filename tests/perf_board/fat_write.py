@@ -0,0 +1,39 @@
+# Filesystem write and read throughput, in bytes per second.
+try:
+    import os
+except ImportError:
+    try:
+        import uos as os
+    except ImportError:
+        skip()
+remove = getattr(os, "remove", None) or os.unlink
+
+NAME = "_bench.bin"
+BLOCK = bytes(range(256)) * 8
+COUNT = 32
+
+
+def write():
+    with open(NAME, "wb") as f:
+        for _ in range(COUNT):
+            f.write(BLOCK)
+
+
+def read():
+    buf = bytearray(len(BLOCK))
+    with open(NAME, "rb") as f:
+        while f.readinto(buf):
+            pass
+
+
+try:
+    dt = bench_time(write, repeat=3)
+except OSError:
+    # CIRCUITPY is read-only while it is mounted by the host.
+    skip()
+try:
+    total = len(BLOCK) * COUNT
+    report("fs_write", total * 1000000 // max(dt, 1), "B/s")
+    report("fs_read", total * 1000000 // max(bench_time(read, repeat=3), 1), "B/s")
+finally:
+    remove(NAME)
@@ -0,0 +1,24 @@
+# Build a live heap of many small objects, then time full collections of it.
+
+
+def build(n):
+    live = []
+    for i in range(n):
+        live.append([i, str(i), (i, i)])
+    return live
+
+
+live = build(300)
+worst = 0
+total = 0
+for _ in range(10):
+    # Leave some garbage behind so the sweep has work to do too.
+    build(50)
+    t0 = ticks_us()
+    gc.collect()
+    dt = ticks_diff(ticks_us(), t0)
+    total += dt
+    worst = max(worst, dt)
+
+report("gc_collect", total // 10)
+report("gc_collect_max", worst)
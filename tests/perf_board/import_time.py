@@ -0,0 +1,32 @@
+# Time importing a freshly written module from the filesystem, which covers
+# file lookup, compilation and execution of the module body.
+try:
+    import os
+except ImportError:
+    try:
+        import uos as os
+    except ImportError:
+        skip()
+remove = getattr(os, "remove", None) or os.unlink
+
+NAME = "_benchmod"
+SRC = "".join("def f%d(x):\n    return x + %d\n" % (i, i) for i in range(40))
+
+try:
+    with open(NAME + ".py", "w") as f:
+        f.write(SRC)
+except OSError:
+    # CIRCUITPY is read-only while it is mounted by the host.
+    skip()
+
+
+def do_import():
+    __import__(NAME)
+    del sys.modules[NAME]
+
+
+try:
+    report("import_py", bench_time(do_import))
+finally:
+    remove(NAME + ".py")
+report("import_builtin_x100", bench_time(lambda: [__import__("micropython") for _ in range(100)]))
@@ -0,0 +1,32 @@
+try:
+    import json
+except ImportError:
+    try:
+        import ujson as json
+    except ImportError:
+        skip()
+
+doc = json.dumps(
+    {
+        "sensors": [
+            {"name": "s%d" % i, "value": i * 1.5, "ok": i % 3 != 0, "tags": ["a", "b", "c"]}
+            for i in range(40)
+        ],
+        "meta": {"version": 3, "source": "board", "ids": list(range(50))},
+    }
+)
+
+
+def parse(n):
+    for _ in range(n):
+        json.loads(doc)
+
+
+def dump(obj, n):
+    for _ in range(n):
+        json.dumps(obj)
+
+
+report("json_loads_bytes", len(doc), "B")
+report("json_loads", bench_time(parse, 10) // 10)
+report("json_dumps", bench_time(dump, json.loads(doc), 10) // 10)
@@ -0,0 +1,53 @@
+# Build a minimal perfect hash index over the names of frozen modules, so that
+# py/frozenmod.c can find a module (or a package directory) with two hash
+# lookups rather than scanning the whole list of names.
+#
+# The index is emitted as an array of uint16_t:
+#   [num_buckets, num_slots, seed[num_buckets]..., slot[num_slots]...]
+# A name is looked up by hashing it with the initial seed to pick a bucket,
+# then hashing it again with that bucket's seed to pick a slot.  A slot holds
+# the index of a frozen module, with INDEX_DIR set if the key is a directory
+# that contains that module.  The C side verifies the candidate against the
+# real name, so names that aren't in the index are rejected.
+#
+# The hash is makeqstrdata.compute_index_hash, which must match
+# mp_frozen_index_hash in py/frozenmod.c.
+
+from __future__ import print_function
+import os
+import sys
+
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'py'))
+import makeqstrdata as qstrutil
+
+INDEX_DIR = 0x8000
+
+
+def _keys(names):
+    # Map every module name, and every directory that contains a module, to
+    # its slot value.  A directory points at the first module found inside it.
+    keys = {}
+    for i, name in enumerate(names):
+        keys[name] = i
+        parts = name.split('/')[:-1]
+        for j in range(1, len(parts) + 1):
+            d = '/'.join(parts[:j])
+            if d not in keys:
+                keys[d] = INDEX_DIR | i
+    return keys
+
+
+def make_index(names):
+    """Return the uint16_t index array for the given list of module names."""
+    if len(names) >= INDEX_DIR:
+        raise ValueError('too many frozen modules for the index')
+    keys = _keys(names)
+    return qstrutil.make_perfect_hash([k.encode('utf8') for k in keys], list(keys.values()))
+
+
+def print_index(c_name, names):
+    index = make_index(names)
+    print('const uint16_t %s[] = {' % c_name)
+    for i in range(0, len(index), 8):
+        print('    ' + ' '.join('%u,' % v for v in index[i:i + 8]))
+    print('};')
@@ -1,5 +1,6 @@
 import sys
 import json
+import struct
 
 # Map start block to current allocation info.
 current_heap = {}
@@ -18,13 +19,13 @@ def change_root(trace, size):
         level[file_location]["blocks"] += size
         level = level[file_location]["subcalls"]
 
-total_actions = 0
-with open(sys.argv[1], "r") as f:
+# Yields (block, size, trace, swept) for every gc_log_change breakpoint in a
+# gdb log.
+def gdb_events(f):
     for line in f:
         if not line.strip():
             break
     for line in f:
-        action = None
         if line.startswith("Breakpoint 2"):
             break
         next(f) # throw away breakpoint code line
@@ -45,7 +46,90 @@ with open(sys.argv[1], "r") as f:
                 size = int(next(f).strip().split()[-1][2:], 16)
             if not line.strip():
                 break
+        yield block, size, trace, trace[0][2] == "gc_sweep"
+
+# Record kinds streamed by supervisor/shared/gc_trace.c.
+TRACE_AREA = 0
+TRACE_ALLOC = 1
+TRACE_FREE = 2
+TRACE_SWEEP = 3
+TRACE_COLLECT_START = 4
+TRACE_COLLECT_END = 5
+TRACE_LOST = 0xff
+TRACE_RECORD = struct.Struct("<BBIII")
+BYTES_PER_BLOCK = 16
+
+# Collection pauses from a trace as (start, duration) in seconds.
+pauses = []
+lost_records = 0
+
+# Yields the same as gdb_events for a binary trace captured from the board's
+# GC_TRACE_UART_TX pin, or read live from a serial port. Blocks are numbered
+# across every heap area in address order. There is no backtrace.
+def trace_events(f):
+    global lost_records
+    areas = {}
+    collect_start = None
+    last_time = None
+    time_base = 0
+    buf = b""
+    while True:
+        data = f.read(TRACE_RECORD.size * 64)
+        if not data:
+            break
+        buf += data
+        while len(buf) >= TRACE_RECORD.size:
+            if buf[0] != 0xa5:
+                # Resynchronise after a dropped byte.
+                buf = buf[1:]
+                continue
+            _, kind, time, ptr, n_blocks = TRACE_RECORD.unpack_from(buf)
+            buf = buf[TRACE_RECORD.size:]
+            # The time is in 1/32768 s and wraps at 32 bits.
+            if last_time is not None and time < last_time:
+                time_base += 1 << 32
+            last_time = time
+            seconds = (time_base + time) / 32768
+            if kind == TRACE_AREA:
+                areas[ptr] = n_blocks
+                continue
+            elif kind == TRACE_COLLECT_START:
+                collect_start = seconds
+                continue
+            elif kind == TRACE_COLLECT_END:
+                if collect_start is not None:
+                    pauses.append((collect_start, seconds - collect_start))
+                collect_start = None
+                continue
+            elif kind == TRACE_LOST:
+                lost_records += n_blocks
+                continue
+            # Turn the pointer into a block number. Before the first
+            # collection describes the heap, fall back to the address.
+            block = ptr // BYTES_PER_BLOCK
+            first_block = 0
+            for start in sorted(areas):
+                if start <= ptr < start + areas[start] * BYTES_PER_BLOCK:
+                    block = first_block + (ptr - start) // BYTES_PER_BLOCK
+                    break
+                first_block += areas[start]
+            size = n_blocks if kind == TRACE_ALLOC else 0
+            yield block, size, [], kind == TRACE_SWEEP
+
+if len(sys.argv) > 2 and sys.argv[1] == "--trace":
+    if sys.argv[2].startswith("/dev/"):
+        import serial
+        f = serial.Serial(sys.argv[2], baudrate=1000000, timeout=1)
+    else:
+        f = open(sys.argv[2], "rb")
+    events = trace_events(f)
+else:
+    f = open(sys.argv[1], "r")
+    events = gdb_events(f)
 
+total_actions = 0
+try:
+    for block, size, trace, swept in events:
         action = "unknown"
         if block not in current_heap:
             current_heap[block] = {"start_block": block, "size": size, "start_trace": trace, "start_time": total_actions}
@@ -62,13 +146,17 @@ with open(sys.argv[1], "r") as f:
                 change_root(trace, size)
             else:
                 action = "free"
-                if trace[0][2] == "gc_sweep":
+                if swept:
                     action = "sweep"
                 del current_heap[block]
             alloc["end_cause"] = action
             allocation_history.append(alloc)
         print(total_actions, action, block, size)
         total_actions += 1
+except KeyboardInterrupt:
+    # Stop reading a live trace.
+    pass
+f.close()
 
 print()
 
@@ -90,5 +178,25 @@ for key in sorted(root):
     total_blocks += root[key]["blocks"]
 print(total_blocks, "total blocks")
 
+if pauses or lost_records:
+    # Live fragmentation: the free runs between the allocations still held.
+    free_runs = []
+    end = None
+    for block in sorted(current_heap):
+        if end is not None and block > end:
+            free_runs.append(block - end)
+        end = block + current_heap[block]["size"]
+    print(sum(alloc["size"] for alloc in current_heap.values()), "blocks in use,",
+          len(free_runs), "free runs, largest", max(free_runs, default=0), "blocks")
+    if pauses:
+        durations = [d for _, d in pauses]
+        print(len(pauses), "collections, pause avg {:.3f} ms max {:.3f} ms".format(
+            1000 * sum(durations) / len(durations), 1000 * max(durations)))
+    if lost_records:
+        print(lost_records, "records lost on the device")
+
 with open("allocation_history.json", "w") as f:
     json.dump(allocation_history, f)
+if pauses:
+    with open("gc_pauses.json", "w") as f:
+        json.dump(pauses, f)
@@ -88,6 +88,12 @@ extra_characters = ""
 for c in filtered_characters:
     if c not in visible_ascii:
         extra_characters += c
+# The glyph lookup binary searches the extra codepoints as uint16_t.
+extra_codepoints = [ord(c) for c in extra_characters]
+if extra_codepoints != sorted(extra_codepoints):
+    raise RuntimeError("extra characters must be in codepoint order")
+if extra_codepoints and extra_codepoints[-1] > 0xffff:
+    raise RuntimeError("character outside the basic multilingual plane: " + chr(extra_codepoints[-1]))
 
 c_file = args.output_c_file
 
@@ -177,16 +183,27 @@ displayio_bitmap_t supervisor_terminal_font_bitmap = {{
 """.format(len(all_characters) * tile_x, tile_y, bytes_per_row / 4))
 
 
+c_file.write("""\
+const uint16_t supervisor_terminal_font_codepoints[{}] = {{
+""".format(max(1, len(extra_codepoints))))
+
+for i in range(0, len(extra_codepoints), 8):
+    c_file.write(" ".join("0x{:04x},".format(cp) for cp in extra_codepoints[i:i + 8]) + "\n")
+
+c_file.write("""\
+};
+""")
+
 c_file.write("""\
 const fontio_builtinfont_t supervisor_terminal_font = {{
     .base = {{.type = &fontio_builtinfont_type }},
     .bitmap = &supervisor_terminal_font_bitmap,
     .width = {},
     .height = {},
-    .unicode_characters = (const uint8_t*) "{}",
-    .unicode_characters_len = {}
+    .unicode_codepoints = supervisor_terminal_font_codepoints,
+    .unicode_codepoint_count = {}
 }};
-""".format(tile_x, tile_y, extra_characters, len(extra_characters.encode("utf-8"))))
+""".format(tile_x, tile_y, len(extra_codepoints)))
 
 c_file.write("""\
 terminalio_terminal_obj_t supervisor_terminal = {
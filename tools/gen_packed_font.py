@@ -0,0 +1,114 @@
+"""Precompile a BDF font into the packed format that fontio.PackedFont reads.
+
+The file is little endian and laid out so it can be used in place, from flash
+or from the filesystem, without parsing:
+
+  header (16 bytes)
+    magic           4s  b"CPF\\x01"
+    glyph_count     I
+    width, height   B B   font bounding box
+    dx, dy          b b
+    bitmap_offset   I     from the start of the file
+
+  glyph index (16 bytes per glyph, in ascending codepoint order)
+    codepoint       I
+    offset          I     of the glyph's rows, from bitmap_offset
+    width, height   B B
+    dx, dy          b b
+    shift_x         b
+    shift_y         b
+    reserved        H
+
+  bitmaps
+    each glyph's rows, top first, (width + 7) // 8 bytes per row with the
+    leftmost pixel in the top bit
+"""
+
+import argparse
+import struct
+
+parser = argparse.ArgumentParser(description='Generate a packed font for fontio.PackedFont.')
+parser.add_argument('--font', type=str,
+                    help='BDF font path', required=True)
+parser.add_argument('--characters', type=str,
+                    help='Only include these characters (default: every glyph in the font)')
+parser.add_argument('--sample_file', type=argparse.FileType('r', encoding='utf-8'),
+                    help='Only include the characters used in this text file, plus visible ASCII')
+parser.add_argument('--output', type=argparse.FileType('wb'), required=True)
+
+args = parser.parse_args()
+
+MAGIC = b"CPF\x01"
+HEADER = struct.Struct("<4sIBBbbI")
+GLYPH = struct.Struct("<IIBBbbbbH")
+
+
+def load_bdf(path):
+    bounding_box = None
+    glyphs = {}
+    codepoint = None
+    rows = None
+    with open(path, "r", encoding="latin-1") as f:
+        for line in f:
+            fields = line.split()
+            if not fields:
+                continue
+            keyword = fields[0]
+            if rows is not None:
+                if keyword == "ENDCHAR":
+                    if codepoint is not None and codepoint >= 0:
+                        glyphs[codepoint] = (bbx, dwidth, rows)
+                    rows = None
+                else:
+                    rows.append(bytes.fromhex(keyword))
+            elif keyword == "FONTBOUNDINGBOX":
+                bounding_box = tuple(int(v) for v in fields[1:5])
+            elif keyword == "STARTCHAR":
+                codepoint = None
+                bbx = None
+                dwidth = (0, 0)
+            elif keyword == "ENCODING":
+                codepoint = int(fields[1])
+            elif keyword == "DWIDTH":
+                dwidth = (int(fields[1]), int(fields[2]))
+            elif keyword == "BBX":
+                bbx = tuple(int(v) for v in fields[1:5])
+            elif keyword == "BITMAP":
+                rows = []
+    if bounding_box is None:
+        raise RuntimeError("no FONTBOUNDINGBOX in " + path)
+    return bounding_box, glyphs
+
+
+bounding_box, glyphs = load_bdf(args.font)
+
+wanted = None
+if args.characters:
+    wanted = set(ord(c) for c in args.characters)
+if args.sample_file:
+    wanted = wanted or set(range(0x20, 0x7f))
+    for line in args.sample_file:
+        wanted.update(ord(c) for c in line.rstrip("\n"))
+if wanted is not None:
+    for codepoint in sorted(wanted - set(glyphs)):
+        print("Font missing character:", chr(codepoint), codepoint)
+    glyphs = {cp: glyphs[cp] for cp in wanted if cp in glyphs}
+
+index = bytearray()
+bitmaps = bytearray()
+for codepoint in sorted(glyphs):
+    (width, height, dx, dy), (shift_x, shift_y), rows = glyphs[codepoint]
+    row_bytes = (width + 7) // 8
+    if len(rows) != height:
+        raise RuntimeError("glyph {} has {} rows, expected {}".format(codepoint, len(rows), height))
+    index += GLYPH.pack(codepoint, len(bitmaps), width, height, dx, dy, shift_x, shift_y, 0)
+    for row in rows:
+        # BDF pads rows to whole bytes already, but be lenient with short ones.
+        bitmaps += row[:row_bytes].ljust(row_bytes, b"\0")
+
+width, height, dx, dy = bounding_box
+bitmap_offset = HEADER.size + len(index)
+args.output.write(HEADER.pack(MAGIC, len(glyphs), width, height, dx, dy, bitmap_offset))
+args.output.write(index)
+args.output.write(bitmaps)
+print("{} glyphs, {} bytes".format(len(glyphs), bitmap_offset + len(bitmaps)))
@@ -9,7 +9,7 @@ from adafruit_usb_descriptor import audio, audio10, cdc, hid, midi, msc, standar
 import hid_report_descriptors
 
 DEFAULT_INTERFACE_NAME = 'CircuitPython'
-ALL_DEVICES='CDC,MSC,AUDIO,HID'
+ALL_DEVICES='CDC,MSC,AUDIO,HID,VENDOR'
 ALL_DEVICES_SET=frozenset(ALL_DEVICES.split(','))
 DEFAULT_DEVICES='CDC,MSC,AUDIO,HID'
 
@@ -30,7 +30,7 @@ parser.add_argument('--pid', type=lambda x: int(x, 16),
 parser.add_argument('--serial_number_length', type=int, default=32,
                     help='length needed for the serial number in digits')
 parser.add_argument('--devices', type=lambda l: tuple(l.split(',')), default=DEFAULT_DEVICES,
-                    help='devices to include in descriptor (AUDIO includes MIDI support)')
+                    help='devices to include in descriptor (AUDIO includes MIDI support, VENDOR is a raw bulk channel)')
 parser.add_argument('--hid_devices', type=lambda l: tuple(l.split(',')), default=DEFAULT_HID_DEVICES,
                     help='HID devices to include in HID report descriptor')
 parser.add_argument('--interface_name', type=str,
@@ -58,6 +58,10 @@ parser.add_argument('--midi_ep_num_out', type=int, default=0,
                     help='endpoint number of MIDI OUT')
 parser.add_argument('--midi_ep_num_in', type=int, default=0,
                     help='endpoint number of MIDI IN')
+parser.add_argument('--vendor_ep_num_out', type=int, default=0,
+                    help='endpoint number of VENDOR OUT')
+parser.add_argument('--vendor_ep_num_in', type=int, default=0,
+                    help='endpoint number of VENDOR IN')
 parser.add_argument('--output_c_file', type=argparse.FileType('w'), required=True)
 parser.add_argument('--output_h_file', type=argparse.FileType('w'), required=True)
 
@@ -98,6 +102,12 @@ if not args.renumber_endpoints:
         elif  args.midi_ep_num_in == 0:
             raise ValueError("MIDI endpoint IN number must not be 0")
 
+    if 'VENDOR' in args.devices:
+        if args.vendor_ep_num_out == 0:
+            raise ValueError("VENDOR endpoint OUT number must not be 0")
+        elif  args.vendor_ep_num_in == 0:
+            raise ValueError("VENDOR endpoint IN number must not be 0")
+
 class StringIndex:
     """Assign a monotonically increasing index to each unique string. Start with 0."""
     string_to_index = {}
@@ -346,6 +356,30 @@ audio_control_interface = standard.InterfaceDescriptor(
 # Audio streaming interfaces must occur before MIDI ones.
 audio_interfaces = [audio_control_interface] + cs_ac_interface.audio_streaming_interfaces + cs_ac_interface.midi_streaming_interfaces
 
+# A vendor-specific interface with a pair of bulk endpoints. The host talks to it directly
+# (libusb, WinUSB) so there is no class protocol to get in the way of throughput.
+vendor_interfaces = [
+    standard.InterfaceDescriptor(
+        description="Vendor bulk",
+        bInterfaceClass=0xff,
+        bInterfaceSubClass=0x00,
+        bInterfaceProtocol=0x00,
+        iInterface=StringIndex.index("{} Bulk".format(args.interface_name)),
+        subdescriptors=[
+            standard.EndpointDescriptor(
+                description="Vendor bulk in",
+                bEndpointAddress=args.vendor_ep_num_in | standard.EndpointDescriptor.DIRECTION_IN,
+                bmAttributes=standard.EndpointDescriptor.TYPE_BULK,
+                bInterval=0),
+            standard.EndpointDescriptor(
+                description="Vendor bulk out",
+                bEndpointAddress=args.vendor_ep_num_out | standard.EndpointDescriptor.DIRECTION_OUT,
+                bmAttributes=standard.EndpointDescriptor.TYPE_BULK,
+                bInterval=0)
+        ]
+    )
+]
+
 interfaces_to_join = []
 
 if 'CDC' in args.devices:
@@ -360,6 +394,9 @@ if 'HID' in args.devices:
 if 'AUDIO' in args.devices:
     interfaces_to_join.append(audio_interfaces)
 
+if 'VENDOR' in args.devices:
+    interfaces_to_join.append(vendor_interfaces)
+
 # util.join_interfaces() will renumber the endpoints to make them unique across descriptors,
 # and renumber the interfaces in order. But we still need to fix up certain
 # interface cross-references.
@@ -403,6 +440,9 @@ if 'AUDIO' in args.devices:
     # correct ordering.
     descriptor_list.append(audio_control_interface)
 
+if 'VENDOR' in args.devices:
+    descriptor_list.extend(vendor_interfaces)
+
 # Finally, build the composite descriptor.
 
 configuration = standard.ConfigurationDescriptor(
@@ -545,6 +585,7 @@ uint16_t const * const string_desc_arr [{string_descriptor_length}];
 const uint8_t hid_report_descriptor[{hid_report_descriptor_length}];
 
 #define USB_HID_NUM_DEVICES {hid_num_devices}
+#define USB_HID_MAX_REPORT_LENGTH {hid_max_report_length}
 
 // Vendor name included in Inquiry response, max 8 bytes
 #define CFG_TUD_MSC_VENDOR          "{msc_vendor}"
@@ -560,6 +601,8 @@ const uint8_t hid_report_descriptor[{hid_report_descriptor_length}];
         string_descriptor_length=len(pointers_to_strings),
         hid_report_descriptor_length=len(bytes(combined_hid_report_descriptor)),
         hid_num_devices=len(args.hid_devices),
+        hid_max_report_length=max(hid_report_descriptors.HID_DEVICE_DATA[name].report_length
+                                  for name in args.hid_devices),
         msc_vendor=args.manufacturer[:8],
         msc_product=args.product[:16]))
 
@@ -20,6 +20,7 @@
 from __future__ import print_function
 import sys
 import os
+import frozenindex
 
 
 def module_name(f):
@@ -50,6 +51,23 @@ for f, st in modules:
 
 print("};")
 
+# Offsets of each name and its content, for lookups through the index.
+print("const uint32_t mp_frozen_str_name_offsets[] = {")
+offset = 0
+for f, st in modules:
+    print("%d," % offset)
+    offset += len(module_name(f)) + 1
+print("};")
+
+print("const uint32_t mp_frozen_str_content_offsets[] = {")
+offset = 0
+for f, st in modules:
+    print("%d," % offset)
+    offset += st.st_size + 1
+print("};")
+
+frozenindex.print_index("mp_frozen_str_index", [module_name(f) for f, st in modules])
+
 print("const char mp_frozen_str_content[] = {")
 for f, st in modules:
     data = open(sys.argv[1] + "/" + f, "rb").read()
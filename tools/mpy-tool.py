@@ -47,6 +47,7 @@ from collections import namedtuple
 
 sys.path.append(sys.path[0] + '/../py')
 import makeqstrdata as qstrutil
+import frozenindex
 
 class FreezeError(Exception):
     def __init__(self, rawcode, msg):
@@ -496,7 +497,70 @@ def dump_mpy(raw_codes):
     for rc in raw_codes:
         rc.dump()
 
-def freeze_mpy(base_qstrs, raw_codes):
+def make_compression_dict(blobs, size, k=4, seg_len=32):
+    """Pick up to size bytes of content that recurs across the given blobs,
+    for use as a deflate preset dictionary shared by all of them."""
+    import heapq
+    if size <= 0 or len(blobs) < 2:
+        return b''
+    # Count how many blobs each k-byte substring appears in.
+    doc_freq = {}
+    for blob in blobs:
+        for kgram in set(blob[i:i + k] for i in range(len(blob) - k + 1)):
+            doc_freq[kgram] = doc_freq.get(kgram, 0) + 1
+
+    # A segment is worth how many other blobs share each of its k-grams, not
+    # counting k-grams that segments already in the dictionary provide.
+    covered = set()
+    def score(seg):
+        kgrams = set(seg[j:j + k] for j in range(len(seg) - k + 1))
+        return sum(doc_freq[g] - 1 for g in kgrams if g not in covered)
+
+    # Greedily take the best segment, rescoring lazily as coverage grows.
+    heap = []
+    seen = set()
+    for blob in blobs:
+        for i in range(0, max(1, len(blob) - seg_len + 1), k // 2):
+            seg = blob[i:i + seg_len]
+            if seg not in seen:
+                seen.add(seg)
+                heap.append((-score(seg), seg))
+    heapq.heapify(heap)
+    chosen = []
+    total = 0
+    while heap and total < size:
+        _, seg = heapq.heappop(heap)
+        s = score(seg)
+        if s <= 0:
+            continue
+        if heap and -s > heap[0][0]:
+            heapq.heappush(heap, (-s, seg))
+            continue
+        seg = seg[:size - total]
+        chosen.append(seg)
+        total += len(seg)
+        covered.update(seg[j:j + k] for j in range(len(seg) - k + 1))
+    # deflate matches are cheapest at short distances, so put the most useful
+    # content at the end of the dictionary, next to the data.
+    return b''.join(reversed(chosen))
+
+def compress_mpy(data, zdict):
+    import zlib
+    if zdict:
+        c = zlib.compressobj(9, zlib.DEFLATED, -15, 9, zlib.Z_DEFAULT_STRATEGY, zdict)
+    else:
+        c = zlib.compressobj(9, zlib.DEFLATED, -15, 9)
+    return c.compress(data) + c.flush()
+
+def print_bytes(c_type, c_name, data):
+    print('const %s %s[%u] = {' % (c_type, c_name, len(data)))
+    for i in range(0, len(data), 16):
+        print('    ' + ' '.join('0x%02x,' % b for b in bytearray(data[i:i + 16])))
+    print('};')
+
+def freeze_mpy(base_qstrs, raw_codes, mpy_data=None, compress_dict_size=0):
+    # If mpy_data is given, freeze those .mpy files compressed rather than as
+    # bytecode structures; raw_codes are then only used to gather the qstrs.
     # add to qstrs
     new = {}
     for q in global_qstrs:
@@ -518,6 +582,15 @@ def freeze_mpy(base_qstrs, raw_codes):
     print('#endif')
     print()
 
+    if mpy_data is None:
+        print('#if MICROPY_MODULE_FROZEN_MPY_COMPRESSED')
+        print('#error "MICROPY_MODULE_FROZEN_MPY_COMPRESSED needs mpy-tool.py --compress"')
+    else:
+        print('#if !MICROPY_MODULE_FROZEN_MPY_COMPRESSED')
+        print('#error "mpy-tool.py --compress needs MICROPY_MODULE_FROZEN_MPY_COMPRESSED"')
+    print('#endif')
+    print()
+
     print('#if MICROPY_LONGINT_IMPL != %u' % config.MICROPY_LONGINT_IMPL)
     print('#error "incompatible MICROPY_LONGINT_IMPL"')
     print('#endif')
@@ -555,6 +628,15 @@ def freeze_mpy(base_qstrs, raw_codes):
             print('    MP_QSTR_%s,' % new[i][1])
     print('};')
 
+    print()
+    print('#if MICROPY_QSTR_HASH_INDEX')
+    print('STATIC const uint16_t mp_qstr_frozen_const_index[] = {')
+    index = qstrutil.make_perfect_hash([bytes_cons(qstr, 'utf8') for _, _, qstr in new], range(len(new)))
+    for i in range(0, len(index), 8):
+        print('    ' + ' '.join('%u,' % v for v in index[i:i + 8]))
+    print('};')
+    print('#endif')
+
     print()
     print('extern const qstr_pool_t mp_qstr_const_pool;');
     print('const qstr_pool_t mp_qstr_frozen_const_pool = {')
@@ -562,6 +644,9 @@ def freeze_mpy(base_qstrs, raw_codes):
     print('    MP_QSTRnumber_of, // previous pool size')
     print('    %u, // allocated entries' % len(new))
     print('    %u, // used entries' % len(new))
+    print('    #if MICROPY_QSTR_HASH_INDEX')
+    print('    mp_qstr_frozen_const_index,')
+    print('    #endif')
     print('    {')
     qstr_size = {"metadata": 0, "data": 0}
     for _, _, qstr in new:
@@ -573,8 +658,9 @@ def freeze_mpy(base_qstrs, raw_codes):
     print('};')
 
     sizes = {}
-    for rc in raw_codes:
-        sizes[rc.source_file.str] = rc.freeze(rc.source_file.str.replace('/', '_')[:-3] + '_')
+    if mpy_data is None:
+        for rc in raw_codes:
+            sizes[rc.source_file.str] = rc.freeze(rc.source_file.str.replace('/', '_')[:-3] + '_')
 
     print()
     print('const char mp_frozen_mpy_names[] = {')
@@ -585,6 +671,19 @@ def freeze_mpy(base_qstrs, raw_codes):
         qstr_size["filenames"] += len(module_name) + 1
     print('"\\0"};')
 
+    # Offsets of each name, and the index used to look them up by hashing.
+    print('const uint32_t mp_frozen_mpy_name_offsets[] = {')
+    offset = 0
+    for rc in raw_codes:
+        print('    %u,' % offset)
+        offset += len(rc.source_file.str) + 1
+    print('};')
+    frozenindex.print_index('mp_frozen_mpy_index', [rc.source_file.str for rc in raw_codes])
+
+    if mpy_data is not None:
+        freeze_mpy_compressed(mpy_data, compress_dict_size, qstr_size)
+        return
+
     print('const mp_raw_code_t *const mp_frozen_mpy_content[] = {')
     for rc in raw_codes:
         print('    &raw_code_%s,' % rc.escaped_name)
@@ -602,6 +701,49 @@ def freeze_mpy(base_qstrs, raw_codes):
     for k in qstr_size:
         print("//   qstr {} {}".format(k, qstr_size[k]))
 
+def freeze_mpy_compressed(mpy_data, compress_dict_size, qstr_size):
+    # The dictionary is stored uncompressed, so it only pays for itself when
+    # it's shared by enough modules.  Try smaller ones until it stops helping.
+    best = None
+    size = compress_dict_size
+    while True:
+        zdict = make_compression_dict(mpy_data, size)
+        compressed = [compress_mpy(data, zdict) for data in mpy_data]
+        total = len(zdict) + sum(len(data) for data in compressed)
+        if best is None or total < best[0]:
+            best = (total, zdict, compressed)
+        if size < 64:
+            break
+        size //= 2
+    _, zdict, compressed = best
+
+    print()
+    print('// Preset dictionary shared by all the compressed modules')
+    print('const uint32_t mp_frozen_mpyz_dict_len = %u;' % len(zdict))
+    print_bytes('uint8_t', 'mp_frozen_mpyz_dict', zdict or b'\0')
+
+    print('const uint32_t mp_frozen_mpyz_sizes[] = {')
+    for data in mpy_data:
+        print('    %u,' % len(data))
+    print('};')
+
+    print('const uint32_t mp_frozen_mpyz_offsets[] = {')
+    offset = 0
+    for data in compressed:
+        print('    %u,' % offset)
+        offset += len(data)
+    print('    %u,' % offset)
+    print('};')
+    print_bytes('uint8_t', 'mp_frozen_mpyz_content', b''.join(compressed) or b'\0')
+
+    print()
+    print('// Total size:', len(zdict) + offset + 12 * len(mpy_data) + sum(qstr_size.values()))
+    print('//   uncompressed mpy', sum(len(data) for data in mpy_data))
+    print('//   compressed mpy', offset)
+    print('//   dictionary', len(zdict))
+    for k in qstr_size:
+        print("//   qstr {} {}".format(k, qstr_size[k]))
+
 def main():
     import argparse
     cmd_parser = argparse.ArgumentParser(description='A tool to work with MicroPython .mpy files.')
@@ -615,6 +757,10 @@ def main():
         help='long-int implementation used by target (default mpz)')
     cmd_parser.add_argument('-mmpz-dig-size', metavar='N', type=int, default=16,
         help='mpz digit size used by target (default 16)')
+    cmd_parser.add_argument('--compress', action='store_true',
+        help='freeze files as compressed .mpy data, inflated into RAM on import')
+    cmd_parser.add_argument('--compress-dict-size', metavar='N', type=int, default=1024,
+        help='size of the preset dictionary shared by compressed files (default 1024)')
     cmd_parser.add_argument('files', nargs='+',
         help='input .mpy files')
     args = cmd_parser.parse_args()
@@ -643,7 +789,14 @@ def main():
         dump_mpy(raw_codes)
     elif args.freeze:
         try:
-            freeze_mpy(base_qstrs, raw_codes)
+            if args.compress:
+                mpy_data = []
+                for file in args.files:
+                    with open(file, 'rb') as f:
+                        mpy_data.append(f.read())
+                freeze_mpy(base_qstrs, raw_codes, mpy_data, args.compress_dict_size)
+            else:
+                freeze_mpy(base_qstrs, raw_codes)
         except FreezeError as er:
             print(er, file=sys.stderr)
             sys.exit(1)